@@ -0,0 +1,19 @@
+# Sources of the ROS-free solver core, MPC and everything it links, for
+# mpc_ros and for the ROS 2 package next to it (../mpc_ros2). The includer
+# sets MPC_ROS_DIR to this package.
+set(MPC_CPPAD_SOURCES
+    ${MPC_ROS_DIR}/src/cppad_instance.cpp ${MPC_ROS_DIR}/src/atomic_pattern.cpp ${MPC_ROS_DIR}/src/poly_ref_atomic.cpp
+    ${MPC_ROS_DIR}/src/tape_solver.cpp ${MPC_ROS_DIR}/src/stage_hessian.cpp ${MPC_ROS_DIR}/src/work_stealing_pool.cpp
+    ${MPC_ROS_DIR}/src/tape_optimize.cpp ${MPC_ROS_DIR}/src/sparsity_patterns.cpp ${MPC_ROS_DIR}/src/warm_start.cpp
+    ${MPC_ROS_DIR}/src/rti_solver.cpp ${MPC_ROS_DIR}/src/admm_qp.cpp ${MPC_ROS_DIR}/src/analytic_solver.cpp
+    ${MPC_ROS_DIR}/src/multi_start.cpp ${MPC_ROS_DIR}/src/horizon_selector.cpp ${MPC_ROS_DIR}/src/move_blocks.cpp
+    ${MPC_ROS_DIR}/src/input_spline.cpp ${MPC_ROS_DIR}/src/reduced_state.cpp ${MPC_ROS_DIR}/src/nlp_scaling.cpp
+    ${MPC_ROS_DIR}/src/time_grid.cpp ${MPC_ROS_DIR}/src/terminal_cost.cpp ${MPC_ROS_DIR}/src/wheel_dynamics.cpp
+    ${MPC_ROS_DIR}/src/cppad_parallel.cpp ${MPC_ROS_DIR}/src/event_trigger.cpp ${MPC_ROS_DIR}/src/linear_solver.cpp
+    ${MPC_ROS_DIR}/src/solve_policy.cpp ${MPC_ROS_DIR}/src/alloc_counter.cpp ${MPC_ROS_DIR}/src/trace_span.cpp
+    ${MPC_ROS_DIR}/src/solve_time_model.cpp ${MPC_ROS_DIR}/src/energy_meter.cpp
+    ${MPC_ROS_DIR}/src/perf_counters.cpp ${MPC_ROS_DIR}/src/plan_sensitivity.cpp ${MPC_ROS_DIR}/src/seed_provider.cpp
+    ${MPC_ROS_DIR}/src/model_jit.cpp ${MPC_ROS_DIR}/src/vehicle_mpc.cpp ${MPC_ROS_DIR}/src/ipopt_options.cpp
+    ${MPC_ROS_DIR}/src/remote_solve.cpp ${MPC_ROS_DIR}/src/newton_krylov.cpp
+    ${MPC_ROS_DIR}/src/solver_snapshot.cpp ${MPC_ROS_DIR}/src/model_params.cpp ${MPC_ROS_DIR}/src/tape_builder.cpp
+    ${MPC_ROS_DIR}/src/step_model.cpp)
@@ -18,29 +18,576 @@
 #define MPC_H
 
 #include <vector>
+#include <atomic>
+#include <functional>
 #include <map>
+#include <memory>
+#include <string>
 #include <Eigen/Core>
+#include "warm_start.h"
+#include "rti_solver.h"
+#include "newton_krylov.h"
+#include "analytic_solver.h"
+#include "multi_start.h"
+#include "horizon_selector.h"
+#include "solve_time_model.h"
+#include "ipopt_journal.h"
+#include "solve_policy.h"
+#include "solve_buffers.h"
+#include "tape_optimize.h"
+#include "wheel_dynamics.h"
+#include "input_spline.h"
+#include "seed_provider.h"
+#include "model_jit.h"
+#include "nlp_scaling.h"
+#include "vehicle_mpc.h"
+#include "model_params.h"
+#include "tape_builder.h"
 
 using namespace std;
 
+class TapeSolver;
+class SharedTape;
+class WorkStealingPool;
+class Executor;
+class RemoteSolveClient;
+class CondensedFG_eval;
+class StepModel;
+struct TapeRecipe;
+
+// Layout of a recorded tape: its model and the trailing parameters of its
+// domain, see MPC::tapeLayout()
+struct TapeLayout
+{
+    int n_coeffs; // path coefficients, 3 * steps reference poses with reference
+    bool reference; // the SolveReference() model
+    bool condensed, reduced; // CONDENSED, REDUCED, else the full layout
+    bool values; // the ModelParams values are tape parameters
+    bool obstacles, speeds; // obstacle term and speed reference
+    int corridor_faces; // 0 without a corridor
+};
+
 class MPC
 {
     public:
         MPC();
     
         // Solve the model given an initial state and polynomial coefficients.
-        // Return the first actuatotions.
+        // Return the first actuatotions. With DYNAMIC, state[6] is the
+        // measured turn rate (free within ANGVEL if state has 6 entries).
         vector<double> Solve(Eigen::VectorXd state, Eigen::VectorXd coeffs);
+        // Same model, but cte and etheta are measured against one reference
+        // pose per step, ref = [x(0..N-1), y(0..N-1), theta(0..N-1)] in the
+        // vehicle frame, e.g. sampled from an ArcPath. The CppAD and tape
+        // backends only (rti, analytic, hypotheses and ADAPTIVE are ignored).
+        vector<double> SolveReference(Eigen::VectorXd state, Eigen::VectorXd ref);
         vector<double> mpc_x;
         vector<double> mpc_y;
+        vector<double> mpc_theta;
+        // Predicted input sequence of the last solution
+        vector<double> mpc_angvel;
+        vector<double> mpc_accel;
+        // Predicted wheel torques, DYNAMIC only (empty otherwise) [N m]
+        vector<double> mpc_torque_right;
+        vector<double> mpc_torque_left;
+        // Predicted lateral speed in the body frame, holonomic
+        // VEHICLE_MODEL only (empty otherwise) [m/s]
+        vector<double> mpc_lateral;
+        // Step of each of these inputs on a time grid (see time_grid.h),
+        // empty when every step is _mpc_dt
+        vector<double> mpc_step_dt;
+        // Input gains along the last solution (SENSITIVITY), to correct
+        // the inputs from fresh poses between solves, see
+        // plan_sensitivity.h. Not Valid() on the rti/LTV, DYNAMIC, time
+        // grid, move block and reference models, with PATH_HEADING=0 and
+        // after an unusable solve.
+        PlanSensitivity mpc_sensitivity;
 
+        // Cost terms of the last solution
+        double _mpc_totalcost;
+        double _mpc_ctecost;
+        double _mpc_ethetacost;
+        double _mpc_velcost;
+
+        // Ipopt status and iteration count of the last solve
+        // (iterations are only reported by the tape, analytic and RTI backends, -1 otherwise)
+        int _mpc_status;
+        int _mpc_iterations;
+        // Solve time predicted for the last solve (PREDICT, see
+        // solve_time_model.h), 0 before the model is ready [ms]
+        double _mpc_predicted_ms;
+        // Ipopt iterates of the last solve, tape backend only
+        IpoptJournal _mpc_journal;
+        // Counts LoadParams() calls, tells which parameters a solve used
+        unsigned long _mpc_params_version;
+        // Time spent recording the tape in the last solve, 0 when reused [ms]
+        double _mpc_tape_ms;
+        // Tape sizes and Ipopt callback times of the last solve, tape
+        // backend only, see tape_optimize.h
+        TapeProfile _mpc_tape_profile;
+        // True if the last result is the shifted previous plan
+        bool _mpc_fallback;
+        // The last result satisfies the model: Ipopt converged, the
+        // iterate meets the constraints anyway, or it is the fallback.
+        // Otherwise its inputs should not be applied.
+        bool _mpc_feasible;
+        // Largest slack of the soft bounds (SOFT) in the last result, how
+        // far angvel or a exceed ANGVEL or MAXTHR [rad/s, m/s^2]
+        double _mpc_slack;
+        // Step of the last solution [s], DT unless the horizon is adaptive
+        double _mpc_dt;
+        // SolvePolicy phase of the last solve, -1 unless POLICY is set
+        int _mpc_phase;
+        // The last result is the reply of the batch server (SetRemote())
+        // and its round trip [ms]
+        bool _mpc_remote;
+        double _mpc_remote_rtt_ms;
+        // Cancel() was called during the last solve: its result is on the
+        // old reference and should not be applied
+        bool _mpc_cancelled;
+
+        // Weights, references and dt are parameters of the tapes and take
+        // effect on the next solve (with SetGeneratedModel() and SetJit()
+        // they are recorded again). A new STEPS with a recorded tape is
+        // recorded in the background and swapped in after the solve that
+        // finds it ready; until then the solves keep the previous horizon.
         void LoadParams(const std::map<string, double> &params);
+
+        // Record the tapes of the configured horizons in the background,
+        // e.g. at start-up, so that the first Solve() only waits for what
+        // is still missing instead of recording it. n_coeffs and obstacles
+        // as the solves will pass them, another layout is recorded again.
+        // corridor_faces and speeds the same for the corridor (0 without it)
+        // and the speed reference.
+        // Only for the tape backend; LoadParams and SetMoveBlocks first.
+        void Prepare(int n_coeffs, bool obstacles, int corridor_faces = 0, bool speeds = false);
+
+        // Wall-time budget of the next solves in seconds, <= 0 disables the
+        // deadline mode. In deadline mode an iterate cut off by the budget is
+        // used if it is feasible, otherwise the previous plan shifted by one
+        // step is followed (at most mpc_steps - 1 cycles in a row).
+        void SetDeadline(double seconds) { _deadline = seconds; }
+
+        // Stop the running solve from another thread, e.g. when a new
+        // reference arrives: Ipopt (tape, analytic and hypotheses backends)
+        // stops at its next iterate and the Newton-Krylov backend before its
+        // next step, the other backends run to the end. The solve returns
+        // with _mpc_cancelled set. Every solve clears the request when it
+        // starts, so a call between two solves cancels nothing.
+        void Cancel() { _cancel.store(true, std::memory_order_relaxed); }
+
+        // Within the goal distance of the node, the NEAR_GOAL phase of the
+        // Ipopt termination settings (POLICY), see solve_policy.h
+        void SetNearGoal(bool near_goal) { _policy.SetNearGoal(near_goal); }
+
+        // Ipopt's tol and acceptable_tol (those of the phases with POLICY)
+        // times scale >= 1 from the next solve, without recording the tape
+        // again; the knob of the CPU governor, see cpu_governor.h
+        void SetToleranceScale(double scale);
+
+        // Starting inputs of the solves without a shifted previous solution,
+        // in place of PURSUIT_SEED or zero inputs when seed covers the
+        // problem, see seed_provider.h. NULL to disable. Not used by the
+        // reference model.
+        void SetSeedProvider(const std::shared_ptr<SeedProvider> &seed) { _seed = seed; }
+
+        // Forget the stored plan, e.g. after the robot was put somewhere else
+        void ResetWarmStart() { _warm.Reset(); _fallbacks = 0; }
+        // Start the next solve from the last solution of other, e.g. the
+        // solver of the parameter profile switched away from, cut or padded
+        // to this horizon. On the thread that solves, between solves.
+        void AdoptWarmStart(const MPC &other);
+
+        // Obstacle term: 3 entries per horizon step (d0, dd/dx, dd/dy), the
+        // distance to the nearest obstacle of step i linearized by the caller
+        // as d0 + dd/dx * x_i + dd/dy * y_i in the vehicle frame of the solve.
+        // Steps closer than CLEARANCE add W_OBS * (CLEARANCE - d)^2 to the
+        // cost. Only the CppAD and tape backends on the full layout model
+        // it; an empty model or one of another horizon leaves it out.
+        void SetObstacleModel(const vector<double> &model) { _obstacle_model = model; }
+
+        // Free-space corridor: `faces` half-planes per horizon step, 3
+        // entries each (a_x, a_y, b), that keep step i >= 1 inside
+        // a_x * x_i + a_y * y_i <= b in the vehicle frame of the solve, see
+        // free_corridor.h. Hard constraints, unlike the obstacle term; rti,
+        // analytic, Newton-Krylov, hypotheses, CONDENSED and REDUCED are
+        // skipped while a corridor is set. An empty model or one of another
+        // horizon leaves it out.
+        void SetCorridorModel(const vector<double> &model, int faces)
+        {
+            _corridor_model = model;
+            _corridor_faces = faces;
+        }
+
+        // Reference speed of every horizon step instead of REF_V, e.g. a
+        // curvature limited profile of the path, see speed_profile.h. Only
+        // the CppAD and tape backends on the full layout model it, the
+        // others keep REF_V; an empty reference or one of another horizon too.
+        void SetSpeedReference(const vector<double> &speeds) { _speed_reference = speeds; }
+
+        // Memory the tape backend holds between solves, over every tape
+        // (one per candidate with ADAPTIVE), see TapeMemory
+        TapeMemory Memory() const;
+
+        // Tape of the last solve, read only, for UseSharedTape() of MPCs
+        // with the same parameters on other threads. NULL before the first
+        // taped solve, after LoadParams() and with a generated model. Its
+        // last reference has to be dropped on the thread that solves this
+        // MPC, see SharedTape.
+        std::shared_ptr<const SharedTape> ShareTape();
+        // Solve on tape, from ShareTape() of an MPC with the same
+        // parameters, instead of recording one. The next LoadParams() or a
+        // problem of other dimensions records again. False with ADAPTIVE,
+        // which keeps one tape per candidate.
+        bool UseSharedTape(const std::shared_ptr<const SharedTape> &tape);
+
+        // Hot restart, see solver_snapshot.h: the structure of the
+        // persistent tape and the warm start, written to path. False if it
+        // could not be written.
+        bool WriteSnapshot(const std::string &path) const;
+        // Adopt a snapshot of the same parameters, after LoadParams() and on
+        // the thread that solves: the next recording of the persistent tape
+        // takes its structure, and its warm start is kept if the snapshot is
+        // at most max_age seconds old. False if there is no valid snapshot
+        // at path for these parameters. Not with ADAPTIVE.
+        bool ReadSnapshot(const std::string &path, double max_age);
+
+        // Library written by GenerateModel(), used in persistent tape mode in
+        // place of the CppAD tape when it holds the model of the current
+        // parameters (otherwise the tape is recorded as usual). Empty to disable.
+        void SetGeneratedModel(const std::string &library);
+        // Compile the model of the current parameters with n_coeffs path
+        // coefficients to C, needs BUILD_CODEGEN
+        bool GenerateModel(const std::string &library, int n_coeffs);
+        // Compile every model the persistent tape records into directory
+        // in the background (needs BUILD_CODEGEN), and solve on the
+        // compiled model from the first solve after it is ready. The
+        // interpreted tape is used until then and when compiling fails.
+        // Only the SolveReference() model is left interpreted. Empty to
+        // disable.
+        void SetJit(const std::string &directory);
+        // Ipopt options of ipopt_options.h (mpc_ipopt_tune), applied over
+        // the ones Solve sets. Empty for none.
+        void SetIpoptOptions(const std::string &options);
+        // Worker threads of the node, see executor.h: its CONTROL queue
+        // takes the place of the HESSIAN_THREADS - 1 stage workers, its
+        // BACKGROUND queue compiles the SetJit() models. Queues that are
+        // off keep the threads of their own.
+        void SetExecutor(const Executor &executor);
+        // Solve on the batch server first, see remote_solve.h: the
+        // configured backend only runs when the reply misses
+        // REMOTE_TIMEOUT [s], a cheap one (LTV) keeps that fallback short.
+        // The results are the server's, without torques, lateral speeds or
+        // sensitivity. NULL to disable. Not used by the reference, DYNAMIC
+        // and VEHICLE_MODEL models.
+        void SetRemote(const std::shared_ptr<RemoteSolveClient> &remote) { _remote = remote; }
+
+        // Hold angvel and accel over blocks of steps, see move_blocks.h.
+        // Empty for one input per step. Only the CppAD and tape backends
+        // model it, rti, analytic and hypotheses are ignored while it is set.
+        void SetMoveBlocks(const std::vector<int> &blocks);
+
+        // Horizon the next Solve() picks at speed v on coeffs, see
+        // horizon_selector.h (STEPS and DT unless ADAPTIVE is set)
+        void PlannedHorizon(double v, const Eigen::VectorXd &coeffs, int &steps, double &dt) const;
+
+        // Cost and constraints of the model, fg as in FG_eval, at each of
+        // points (variables in the layout of the solve) on the path coeffs,
+        // e.g. to rank sampled or rollout starting points. width (1, 4 or
+        // 8) points go through one sweep of a tape recorded on
+        // simd_double<width>, see simd_double.h; the tape is recorded again
+        // when STEPS, DT, the weights, the blocks or coeffs.size() change.
+        void EvaluateFG(const Eigen::VectorXd &coeffs, const std::vector<std::vector<double> > &points,
+                        std::vector<std::vector<double> > &fg, int width = 8);
+
+        // Solve the same synthetic problems of params on every backend of
+        // linear_solver.h and return the fastest of those with the fewest
+        // failed solves, DEFAULT if none converges. report has the mean
+        // solve time of each backend. A backend that is not in the Ipopt
+        // build fails its first solve and is skipped.
+        static int CalibrateLinearSolver(const std::map<string, double> &params, std::string &report, int solves = 20);
     
     private:
         // Parameters for mpc solver
         double _max_angvel, _max_throttle, _bound_value;
         int _mpc_steps, _x_start, _y_start, _theta_start, _v_start, _cte_start, _etheta_start, _angvel_start, _a_start;
         std::map<string, double> _params;
+        // Values of _params the tapes take as parameters, see model_params.h
+        ModelParams _model;
+
+        // Move blocking, see SetMoveBlocks()
+        std::vector<int> _move_blocks, _block_of;
+        int _n_inputs; // per input, _mpc_steps - 1 without blocks
+        // B-spline inputs instead of the blocks (INPUT_SPLINE control
+        // points, 0 none), see input_spline.h. CppAD and tape backends.
+        int _spline_points;
+        InputSpline _spline;
+
+        // Non-uniform time grid of the DT_i parameters, see time_grid.h.
+        // Empty: every step is DT. Only the CppAD and tape backends model it.
+        std::vector<double> _step_dt;
+
+        // Persistent tape mode, see tape_solver.h
+        bool _persistent_tape;
+        std::shared_ptr<TapeSolver> _tape_solver;
+        bool _tape_stale; // parameters changed since the tape was recorded
+        bool _tape_reference; // the tape is of the SolveReference() model
+        TapeLayout _tape_layout; // of the last recording of _tape_solver
+        // _params of the tapes without the values they take as parameters,
+        // a LoadParams() that changes more records again, see tapeStructure()
+        std::map<string, double> _tape_structure;
+        // Records a tape of another STEPS while the solves go on, see
+        // LoadParams() and Prepare(); its Id() is the steps
+        TapeBuilder _tape_builder;
+        // Tapes of the other path fit orders (adaptive PathFit), parked by
+        // useOrderTape() instead of recorded over and dropped with the
+        // parameters they were recorded for
+        std::vector<std::shared_ptr<TapeSolver> > _order_tapes;
+        std::string _codegen_library;
+        std::shared_ptr<ModelJit> _jit; // SetJit()
+        std::string _jit_dir;
+        std::string _ipopt_options; // SetIpoptOptions()
+        std::string _jit_model; // model of the interpreted tape, empty when not compiled
+        ModelJit::Job _jit_job; // compiles _jit_model, until it is requested
+
+        // Tapes of EvaluateFG(), see MPC.cpp
+        struct BatchTapes;
+        std::shared_ptr<BatchTapes> _batch_tapes;
+
+        // Warm start mode
+        bool _warm_start;
+        WarmStart _warm;
+        // No previous solution to shift: start from a pure pursuit
+        // rollout along the path (PURSUIT_SEED)
+        bool _pursuit_seed;
+        // or from the inputs of _seed, see SetSeedProvider()
+        std::shared_ptr<SeedProvider> _seed;
+        std::vector<double> _seed_angvel, _seed_accel;
+
+        // Real-time iteration backend, also with LTV, see rti_solver.h
+        bool _rti;
+        RtiSolver _rti_solver;
+        // Gains of the Ipopt solutions from its linearization (SENSITIVITY)
+        bool _sensitivity;
+
+        // Hand-written derivatives instead of CppAD, see analytic_solver.h
+        bool _analytic;
+        AnalyticSolver _analytic_solver;
+
+        // Parallel solves from several starting points, see multi_start.h
+        MultiStart _multi_start;
+
+        // Hessian handed to Ipopt: 0 exact, 1 Gauss-Newton (cost only, tape
+        // and analytic solvers), 2 limited-memory (L-BFGS)
+        int _hessian_mode;
+
+        // Condensed (single shooting) formulation (CONDENSED): only the
+        // inputs are variables, FG_eval rolls the states out from the
+        // initial state. CppAD and tape backends, rti, analytic and
+        // hypotheses keep the multiple shooting layout.
+        bool _condensed;
+        // Matrix-free inexact Newton on the condensed problem instead of
+        // Ipopt (NEWTON_KRYLOV), see newton_krylov.h. One input per step
+        // and not with the torque model; rti, analytic and hypotheses take
+        // precedence.
+        bool _newton;
+        NewtonKrylov _newton_solver;
+
+        // Reduced state (REDUCED), see reduced_state.h: cte and etheta are
+        // computed inside FG_eval instead of being variables. CppAD and
+        // tape backends, CONDENSED takes precedence.
+        bool _reduced;
+
+        // Torque-level model (DYNAMIC), see wheel_dynamics.h. CppAD and
+        // tape backends on the full layout: CONDENSED, REDUCED and move
+        // blocks are ignored while it is set.
+        WheelDynamics _wheels;
+        // Motion model policy (VEHICLE_MODEL), see vehicle_mpc.h. Its own
+        // tape and solve; NULL for the models of FG_eval.
+        int _vehicle_model;
+        std::unique_ptr<VehicleSolver> _vehicle;
+        VehiclePlan _vehicle_plan;
+        // Batch server of SetRemote() and the wait for its replies
+        // (REMOTE_TIMEOUT) [s]
+        std::shared_ptr<RemoteSolveClient> _remote;
+        double _remote_timeout;
+        // Soft angvel and a bounds of the torque model (SOFT, weight
+        // W_SLACK), see FG_eval::_soft
+        bool _soft;
+        // LQR terminal cost (TERMINAL), see terminal_cost.h. CppAD and tape
+        // backends. Terminal set on the full layout: |cte| and |etheta| of
+        // the last step about the reference within TERMINAL_CTE and
+        // TERMINAL_ETHETA, 0 none.
+        bool _terminal;
+        double _terminal_cte, _terminal_etheta;
+
+        // tape_optimize level of the recorded tapes (OPTIMIZE)
+        int _tape_optimize;
+        // Taylor orders the tapes keep between solves (TAYLOR_CAPACITY, -1
+        // all), see TapeSolver::SetTaylorCapacity()
+        int _taylor_capacity;
+        // sparsity_patterns::Representation of the tape sweeps (SPARSITY,
+        // -1 auto), see TapeSolver::SetSparsity()
+        int _sparsity;
+        // Stop the tape solve once the inputs of the first INPUT_STOP steps
+        // (0 off) moved at most INPUT_STOP_TOL over INPUT_STOP_ITERS
+        // iterates, see TapeSolver::SetInputStop()
+        int _input_stop, _input_stop_iters;
+        double _input_stop_tol;
+        // Fixed user-scaling of the tape solves (SCALING) instead of Ipopt's
+        // gradient-based one, per layout, computed again after a change of
+        // the parameters or the layout
+        bool _scaling, _scaling_stale;
+        NlpScaling _scaling_full, _scaling_reduced, _scaling_condensed;
+
+        // Sparse Jacobian of the constraints (JACOBIAN): 0 reverse, 1 forward
+        // mode over a coloring, 2 reverse mode over the subgraph of each row
+        int _jacobian_method;
+
+        // Coloring of the sparse Hessian (HESSIAN_COLORING): 0 CppAD's
+        // symmetric, 1 CppAD's general, 2 ColPack's star (BUILD_COLPACK)
+        int _hessian_coloring;
+
+        // Exact Hessians reused across Ipopt iterations (HESSIAN_REUSE calls,
+        // while the step stays under HESSIAN_REUSE_STEP and the multipliers
+        // move less than HESSIAN_REUSE_LAMBDA), see TapeSolver::SetHessianReuse()
+        int _hessian_reuse;
+        double _hessian_reuse_step, _hessian_reuse_lambda;
+
+        // Ipopt linear solver (LINEAR_SOLVER) and its ordering (LINEAR_ORDER,
+        // -1 its default), see linear_solver.h
+        int _linear_solver, _linear_order;
+
+        // Jacobian and Hessian of the tape backend from a float tape
+        // (PRECISION=1), see TapeSolver::RecordSingle()
+        bool _single_precision;
+        // Cost and constraints of the tape backend also on tapes of their
+        // own (SPLIT_TAPE), see TapeSolver::RecordSplit()
+        bool _split_tape;
+        // Constant Jacobian entries left out of the sweeps (CONST_JACOBIAN),
+        // see TapeSolver::SetConstantJacobian()
+        bool _const_jacobian;
+
+        // Hessian of the tape backend summed over the steps of the
+        // horizon (HESSIAN_STAGES), see StageHessian; the full layout
+        // without the torque model only. With HESSIAN_THREADS > 1 the
+        // stages are split over that many threads, the solving one and the
+        // workers of _stage_pool.
+        bool _hessian_stages;
+        int _hessian_threads;
+        std::shared_ptr<WorkStealingPool> _stage_pool;
+        std::shared_ptr<WorkStealingPool> _control_pool, _background_pool; // SetExecutor()
+
+        // Vectors of Solve(), reused across solves
+        SolveBuffers _buffers;
+
+        // Deadline mode
+        double _deadline;
+        std::atomic<bool> _cancel; // Cancel()
+        int _fallbacks;
+        double _tol_scale; // SetToleranceScale()
+
+        // Predicted solve times, for the horizon and the policy before a solve
+        SolveTimeModel _predictor;
+
+        // Adaptive horizon, one tape per candidate
+        HorizonSelector _horizon;
+        std::vector<std::shared_ptr<TapeSolver> > _horizon_tapes;
+        std::vector<bool> _horizon_stale;
+        std::vector<std::unique_ptr<TapeBuilder> > _horizon_builders; // see Prepare()
+        int _horizon_index; // candidate of _params and _tape_solver, -1 before the first solve
+
+        // Ipopt termination settings by phase
+        SolvePolicy _policy;
+
+        // etheta against the path heading (PATH_HEADING, default) or
+        // integrated from the turn rate, see FG_eval::errorStep()
+        bool _path_heading;
+
+        // Dynamics recorded as one atomic operation per step (CHECKPOINT),
+        // CppAD and tape backends on the full layout, see step_model.h
+        bool _checkpoint;
+
+        // Obstacle term, see SetObstacleModel()
+        vector<double> _obstacle_model;
+        double _w_obs;
+
+        // Corridor, see SetCorridorModel()
+        vector<double> _corridor_model;
+        int _corridor_faces;
+        bool corridorSet() const { return _corridor_faces > 0 && !_corridor_model.empty(); }
+
+        // Speed reference, see SetSpeedReference()
+        vector<double> _speed_reference;
+
+        void updateIndices();
+        int input(int i) const { return _block_of.empty() ? i : _block_of[i]; }
+        // Variables of the inputs INPUT_STOP watches, offset less than in
+        // the layout of Solve() (condensed, reduced)
+        void setInputStop(size_t offset);
+        // SCALING of one of the _scaling_ layouts on the tape solver
+        void setScaling(const NlpScaling &layout);
+        void updateScaling();
+        // Input of step i of a plan, see FG_eval::Input()
+        template <class Vector>
+        double inputAt(const Vector &vars, int start, int i) const
+        {
+            return _spline.Enabled() ? _spline.Value(vars, start, i) : vars[start + input(i)];
+        }
+        int numTorques() const { return _wheels.Enabled() ? 2 * (_mpc_steps - 1) : 0; }
+        int numTorqueRows() const { return _wheels.Enabled() ? 2 * _mpc_steps - 1 : 0; }
+        int numSlacks() const { return _soft && _wheels.Enabled() ? 2 * (_mpc_steps - 1) : 0; }
+        void extendSlacks(std::vector<double> &vars, std::vector<double> &zl, std::vector<double> &zu,
+                          std::vector<double> &lambda) const;
+        void extendTorques(std::vector<double> &vars, std::vector<double> &zl, std::vector<double> &zu,
+                           std::vector<double> &lambda) const;
+        void expandInputs(const CPPAD_TESTVECTOR(double) &blocked, std::vector<double> &full) const;
+        void compressInputs(std::vector<double> &full) const;
+        std::map<string, double> horizonParams(int index) const;
+        void applyHorizon(int index);
+        double horizonBudget() const;
+        // Layout of a tape for the solves of these arguments, as n_params
+        // of them on a horizon of steps
+        TapeLayout tapeLayout(int n_coeffs, bool reference, bool obstacles, int corridor_faces, bool speeds) const;
+        static size_t numParams(const TapeLayout &layout, int steps);
+        // Copies of everything a recording reads, for the builder threads
+        TapeRecipe tapeRecipe(const std::map<string, double> &params, const TapeLayout &layout) const;
+        double recordTape(TapeSolver &tape_solver, const std::map<string, double> &params, const TapeLayout &layout);
+        // Swap in the parked tape of n_params parameters, or park the
+        // current one for a new TapeSolver, see _order_tapes
+        void useOrderTape(size_t n_vars, size_t n_params, bool reference);
+        // The solves record a persistent tape of FG_eval
+        bool tapeBackend() const;
+        // After new weights: the Gauss-Newton Hessians of the tapes
+        void resetGaussNewton();
+        std::map<string, double> tapeStructure(const std::map<string, double> &params) const;
+        // Horizon of steps for the solves and their sub-solvers
+        void applySteps(int steps);
+        // Background recording of the _tape_layout of STEPS, see LoadParams()
+        void startTapeBuild();
+        // Swap in a finished background recording, false if none is ready
+        bool takeTape();
+        bool takeHorizonTape(size_t index);
+        void cancelTapeBuilds();
+        // Writes the path model of the current parameters to a library, empty
+        // without BUILD_CODEGEN
+        std::function<bool(const std::string &)> modelGenerator(int n_coeffs, std::string &model) const;
+        void prepareJit(int n_coeffs);
+        void pollJit();
+        vector<double> solve(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, bool reference);
+        vector<double> solveVehicle(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs);
+        // False when the reply misses, see SetRemote()
+        bool solveRemote(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, vector<double> &result);
+        void solveCondensed(const std::string &options, const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs,
+                            bool reference, bool warm, CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> &solution);
+        void solveNewton(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, bool reference,
+                         CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> &solution);
+        // Solution of the condensed problem in the multiple shooting layout
+        void expandCondensed(const CondensedFG_eval &fg_eval, const Eigen::VectorXd &state,
+                             const CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> &condensed,
+                             CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> &solution) const;
+        void solveReduced(const std::string &options, const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs,
+                          bool reference, bool warm, CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> &solution);
 
 };
 
@@ -0,0 +1,103 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef ADMM_QP_H
+#define ADMM_QP_H
+
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseCholesky>
+
+// Sparse convex QP
+//
+//   min  1/2 x'P x + q'x   s.t.  l <= A x <= u
+//
+// solved by the ADMM iteration of OSQP (Stellato et al., 2020). Every
+// iteration solves the quasi-definite KKT system
+//
+//   [ P + sigma I        A'      ] [ x~ ]   [ sigma x - q         ]
+//   [      A       -diag(1/rho)  ] [ nu ] = [ z - diag(1/rho) y   ]
+//
+// with the same LDL' factorization (SimplicialLDLT, AMD ordering), so an
+// iteration costs two sparse triangular solves. The ordering and the
+// symbolic factorization are computed once per sparsity pattern in
+// Setup(). New values of A (UpdateA()), a new rho or a change of the
+// equality rows (l == u, which get 1e3 times rho) only refactor the
+// numbers, in the next Solve(). Every Solve() starts from the x, z and y
+// of the previous one, or from WarmStart().
+//
+// P and A are column-major (CSC); only the lower triangle of P is read.
+// The problem is not scaled and infeasibility is not detected: Solve()
+// fails when max_iter iterations do not meet the tolerances.
+class AdmmQp
+{
+    public:
+        typedef Eigen::SparseMatrix<double> Matrix;
+
+        struct Settings
+        {
+            Settings() : rho(0.1), sigma(1e-6), alpha(1.6), eps_abs(1e-4), eps_rel(1e-4),
+                         max_iter(4000), check_every(10), adaptive_rho(true) {}
+            double rho, sigma, alpha;  // step size, regularization, relaxation
+            double eps_abs, eps_rel;   // residual tolerances
+            int max_iter, check_every; // iteration cap, iterations between residual checks
+            bool adaptive_rho;         // rebalance rho at the checks (refactors)
+        };
+
+        AdmmQp();
+
+        void SetSettings(const Settings &settings);
+        const Settings &GetSettings() const { return _settings; }
+
+        // New problem structure. x, z and y start at zero. False if the
+        // KKT matrix cannot be factored.
+        bool Setup(const Matrix &P, const Matrix &A);
+        // Values of A in the pattern given to Setup()
+        void UpdateA(const Matrix &A);
+
+        void WarmStart(const Eigen::VectorXd &x, const Eigen::VectorXd &y);
+
+        // True if the tolerances were met
+        bool Solve(const Eigen::VectorXd &q, const Eigen::VectorXd &l, const Eigen::VectorXd &u);
+
+        const Eigen::VectorXd &X() const { return _x; }
+        const Eigen::VectorXd &Y() const { return _y; }
+        int Iterations() const { return _iterations; }
+        // Numeric factorizations since Setup()
+        int Factorizations() const { return _factorizations; }
+
+    private:
+        // rho of every row from the bounds, the KKT entries of those that changed
+        void updateRho(const Eigen::VectorXd &l, const Eigen::VectorXd &u);
+        bool factor();
+
+        Settings _settings;
+        int _n, _m;
+        Matrix _P, _A, _K;
+        Eigen::SimplicialLDLT<Matrix, Eigen::Lower, Eigen::AMDOrdering<int> > _ldlt;
+        std::vector<int> _diag_in_k, _a_in_k, _rho_in_k; // value offsets in _K
+        Eigen::VectorXd _rho, _rho_inv;
+        std::vector<char> _row_type; // 0 free, 1 inequality, 2 equality
+        double _rho_bar;
+        bool _stale; // _K changed since the last factorization
+        int _iterations, _factorizations;
+
+        Eigen::VectorXd _x, _z, _y;
+        Eigen::VectorXd _rhs, _sol, _zt, _Ax, _Px, _Aty;
+};
+
+#endif /* ADMM_QP_H */
@@ -0,0 +1,90 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <cstddef>
+#include <Eigen/Core>
+
+// Heap allocations of the calling thread, to check that the steady state
+// control cycle does not allocate. The counting operator new/delete are in
+// libmpc_alloc_hook (BUILD_ALLOC_HOOK=ON), preloaded into the process:
+//   LD_PRELOAD=<devel>/lib/libmpc_alloc_hook.so
+// so that they replace the ones of libstdc++ for every library of it,
+// move_base and its plugins included. Without it Active() is false and all
+// counts stay 0. CppAD's thread_alloc takes its blocks from operator new,
+// they are counted when it grows its pool, not when it hands them out.
+namespace alloc_counter
+{
+    struct Counts
+    {
+        unsigned long long allocs, frees, bytes;
+    };
+
+    // True when the hook library is loaded
+    bool Active();
+
+    // Since the calling thread started, 0 when not Active()
+    Counts Thread();
+
+    // Bytes CppAD's thread_alloc holds for the calling thread, in use and
+    // kept available for reuse
+    size_t CppadBytes();
+}
+
+// Allocations of the calling thread per stage of a control cycle, the
+// counterpart of StageClock
+class AllocClock
+{
+    public:
+        AllocClock() { Start(); }
+
+        void Start();
+
+        // Allocations since the previous Lap() (or Start()), their bytes in bytes
+        unsigned long long Lap(unsigned long long &bytes);
+
+        // Since Start()
+        alloc_counter::Counts Total() const;
+        // Change of CppadBytes() since Start()
+        long long CppadBytes() const;
+
+    private:
+        alloc_counter::Counts _start, _last;
+        size_t _cppad_start;
+};
+
+// Scope in which Eigen asserts on any heap allocation, when built with
+// EIGEN_RUNTIME_NO_MALLOC (EIGEN_NO_MALLOC=ON) and without NDEBUG. A no-op
+// otherwise. Scopes nest.
+class EigenNoMalloc
+{
+    public:
+#ifdef EIGEN_RUNTIME_NO_MALLOC
+        EigenNoMalloc() : _allowed(Eigen::internal::is_malloc_allowed()) { Eigen::internal::set_is_malloc_allowed(false); }
+        ~EigenNoMalloc() { Eigen::internal::set_is_malloc_allowed(_allowed); }
+    private:
+        bool _allowed;
+#else
+        EigenNoMalloc() {}
+#endif
+    private:
+        EigenNoMalloc(const EigenNoMalloc &);
+        EigenNoMalloc &operator=(const EigenNoMalloc &);
+};
+
+#endif /* ALLOC_COUNTER_H */
@@ -0,0 +1,162 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef ANALYTIC_SOLVER_H
+#define ANALYTIC_SOLVER_H
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+#include "cppad_instance.h"
+#include <cppad/ipopt/solve_result.hpp>
+
+class AnalyticNLP;
+namespace ipopt_util { class PersistentIpopt; }
+
+// Ipopt solve of the FG_eval model with hand-written derivatives.
+//
+// The objective gradient, the constraint Jacobian and the Hessian of the
+// Lagrangian of the unicycle model are evaluated in closed form, without
+// AD. Their sparsity pattern is built once per horizon length, after that
+// the evaluation callbacks only write into preallocated storage.
+//
+// Takes the same options, bounds and starting point as TapeSolver::Solve,
+// the path coefficients are passed as they are. Like TapeSolver it keeps
+// the IpoptApplication and re-optimizes while horizon and options stay. Variables use the
+// MPC::Solve layout: x, y, theta, v, cte, etheta blocks of N entries, then
+// angvel and a blocks of N - 1.
+//
+// The model rows are the same computation for every step, so they are
+// evaluated step-vectorized: the state blocks are already one array per
+// state over the horizon, the per-step terms (sin, cos, the path
+// polynomial) are kept the same way, and each row or Jacobian entry is one
+// loop over all the steps, written straight into Ipopt's arrays. -O3
+// vectorizes these loops, 4 steps per instruction with AVX2, 8 with
+// AVX-512 and 2 with NEON (BUILD_MARCH); the sin and cos loops only with
+// BUILD_FAST_MATH, libm is called per angle otherwise.
+class AnalyticSolver
+{
+    public:
+        typedef CPPAD_TESTVECTOR(double) Dvector;
+
+        AnalyticSolver();
+
+        // Same keys as MPC::LoadParams
+        void LoadParams(const std::map<std::string, double> &params);
+
+        // Heading error row of the model: true for
+        //   etheta1 = (theta0 - atan(f'(x0))) + angvel0 * dt   (MPC, planner)
+        // false for
+        //   etheta1 = etheta0 + angvel0 * dt                   (nav, tracking)
+        void SetPathHeading(bool path_heading);
+
+        // Gauss-Newton Hessian: the cost terms only, lambda is ignored
+        void SetGaussNewton(bool enable);
+
+        void Solve(const std::string &options, const Eigen::VectorXd &coeffs,
+                   const Dvector &xi, const Dvector &xl, const Dvector &xu,
+                   const Dvector &gl, const Dvector &gu,
+                   CppAD::ipopt::solve_result<Dvector> &solution,
+                   const Dvector *zl = NULL, const Dvector *zu = NULL,
+                   const Dvector *lambda = NULL);
+
+        // Ipopt iterations of the last Solve(), -1 if it did not run
+        int Iterations() const { return _iterations; }
+
+        // Wall-time budget of Solve(), see TapeSolver::SetTimeLimit
+        void SetTimeLimit(double seconds) { _time_limit = seconds; }
+        bool TimeLimitHit() const { return _time_limit_hit; }
+        // Cancellation token, see TapeSolver::SetCancel
+        void SetCancel(const std::atomic<bool> *cancel) { _cancel = cancel; }
+        bool CancelHit() const { return _cancel_hit; }
+
+        // Build the patterns for the current horizon if needed and set the
+        // path coefficients of the functions below, Solve() does both.
+        void Prepare(const Eigen::VectorXd &coeffs);
+
+        // Model functions at x. Jacobian() and Hessian() write the values in
+        // the order of the patterns below, the Hessian is the lower triangle
+        // of obj_factor * d2f + sum(lambda[i] * d2g[i]) (obj_factor * d2f
+        // with SetGaussNewton).
+        double Cost(const double *x) const;
+        void Gradient(const double *x, double *grad) const;
+        void Constraints(const double *x, double *g) const;
+        void Jacobian(const double *x, double *values) const;
+        void Hessian(const double *x, double obj_factor, const double *lambda, double *values) const;
+
+        size_t NumVars() const { return 8 * _mpc_steps - 2; }
+        size_t NumConstraints() const { return 6 * _mpc_steps; }
+        const std::vector<int> &JacobianRows() const { return _row_jac; }
+        const std::vector<int> &JacobianCols() const { return _col_jac; }
+        const std::vector<int> &HessianRows() const { return _row_hes; }
+        const std::vector<int> &HessianCols() const { return _col_hes; }
+
+    private:
+        friend class AnalyticNLP;
+
+        // Walk the Jacobian / Hessian entries in a fixed order. With a
+        // pattern argument the (row, col) of every entry are appended to it,
+        // otherwise the values are written (Hessian entries are added to
+        // their slot, several terms may share one).
+        void jacobian(const double *x, double *values, std::vector<int> *rows, std::vector<int> *cols) const;
+        void hessian(const double *x, double obj_factor, const double *lambda, double *values,
+                     std::vector<int> *rows, std::vector<int> *cols) const;
+        void buildPattern();
+
+        // Terms of the model rows of steps 0 .. N - 2 at x, one array per
+        // term over the steps; dddf only with curvature (the Hessian)
+        struct StageTerms
+        {
+            std::vector<double> c, s, ce, se; // cos, sin of theta and etheta
+            std::vector<double> f, df, ddf, dddf; // path polynomial and its derivatives
+            std::vector<double> heading; // atan(f'), rows with SetPathHeading
+        };
+        void stageTerms(const double *x, bool curvature) const;
+
+        double _dt, _ref_cte, _ref_etheta, _ref_vel;
+        double _w_cte, _w_etheta, _w_vel, _w_angvel, _w_accel, _w_angvel_d, _w_accel_d;
+        int _mpc_steps;
+        bool _path_heading, _gauss_newton;
+        std::vector<double> _coeffs;
+
+        // Patterns of the horizon they were built for (-1: none)
+        int _pattern_steps;
+        std::vector<int> _row_jac, _col_jac, _row_hes, _col_hes;
+        // Hessian slot of every entry written by hessian()
+        std::vector<int> _hes_slot;
+        std::vector<double> _x0;
+        // Sized with the patterns, filled by every evaluation
+        mutable StageTerms _terms;
+
+        // Ipopt state kept across solves; _nlp is owned by _ipopt and
+        // replaced with the patterns.
+        std::shared_ptr<ipopt_util::PersistentIpopt> _ipopt;
+        AnalyticNLP *_nlp;
+
+        int _iterations;
+        double _time_limit;
+        bool _time_limit_hit;
+        const std::atomic<bool> *_cancel;
+        bool _cancel_hit;
+        std::chrono::steady_clock::time_point _solve_begin;
+};
+
+#endif /* ANALYTIC_SOLVER_H */
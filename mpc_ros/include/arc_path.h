@@ -0,0 +1,56 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef ARC_PATH_H
+#define ARC_PATH_H
+
+#include <vector>
+#include "compact_path.h"
+
+// Reference path parameterized by arc length, as a C1 cubic Hermite spline
+// through the waypoints (Catmull-Rom tangents). Unlike the polynomial fit in
+// the vehicle x axis it follows U-turns and loops.
+//
+// Lookups take a segment hint owned by the caller: consecutive queries move
+// a few segments at most, so they cost O(1) instead of a search over the
+// whole path, and the path itself stays read-only and shareable.
+class ArcPath
+{
+    public:
+        ArcPath();
+
+        // Build from waypoints, repeated points are skipped. False if fewer
+        // than two distinct waypoints remain.
+        bool Set(const CompactPath &path);
+
+        bool Empty() const;
+        double Length() const;
+
+        // Arc length of the point of the path closest to (x, y). A negative
+        // hint searches the whole path.
+        double Project(double x, double y, int &hint) const;
+
+        // Position and heading at arc length s, clamped to the path
+        void Sample(double s, int &hint, double &x, double &y, double &theta) const;
+
+    private:
+        int locate(double s, int hint) const;
+
+        // Knots and tangents (d/ds) of the spline
+        std::vector<double> _s, _x, _y, _tx, _ty;
+};
+
+#endif /* ARC_PATH_H */
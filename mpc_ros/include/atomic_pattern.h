@@ -0,0 +1,61 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef ATOMIC_PATTERN_H
+#define ATOMIC_PATTERN_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "cppad_instance.h"
+
+// Base of the atomic functions of the MPC models (step_model.h,
+// poly_ref_atomic.h): the sparsity calls of CppAD are answered from the
+// fixed Jacobian and Hessian patterns of the function instead of a sweep,
+// for tapes that are recorded once and evaluated many times. Derived
+// classes provide forward and reverse and call SetPattern() in their
+// constructor. Uses bool sparsity.
+class PatternAtomic : public CppAD::atomic_base<double>
+{
+    protected:
+        PatternAtomic(const std::string &name, size_t n_in, size_t n_out);
+
+        // jac: n_out x n_in, row major. hes: the n_in x n_in pattern of
+        // the Hessian of every output, one after the other.
+        void SetPattern(const std::vector<bool> &jac, const std::vector<bool> &hes);
+
+        // vy of forward(): an output is a variable if any of its inputs is
+        void Variables(const CppAD::vector<bool> &vx, CppAD::vector<bool> &vy) const;
+
+        size_t _n_in, _n_out;
+
+    private:
+        virtual bool for_sparse_jac(size_t q, const CppAD::vector<bool> &r, CppAD::vector<bool> &s,
+                                    const CppAD::vector<double> &x);
+        virtual bool rev_sparse_jac(size_t q, const CppAD::vector<bool> &rt, CppAD::vector<bool> &st,
+                                    const CppAD::vector<double> &x);
+        virtual bool rev_sparse_hes(const CppAD::vector<bool> &vx, const CppAD::vector<bool> &s,
+                                    CppAD::vector<bool> &t, size_t q, const CppAD::vector<bool> &r,
+                                    const CppAD::vector<bool> &u, CppAD::vector<bool> &v,
+                                    const CppAD::vector<double> &x);
+
+        // Jacobian pattern by rows and by columns, and for every output
+        // and input the inputs of the nonzero Hessian entries of that row
+        std::vector<std::vector<size_t> > _jac_row, _jac_col;
+        std::vector<std::vector<std::vector<size_t> > > _hes;
+};
+
+#endif /* ATOMIC_PATTERN_H */
@@ -0,0 +1,64 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef BATCH_SOLVER_H
+#define BATCH_SOLVER_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+// Offline solves of many recorded problems (state, coeffs) on several
+// threads, for the Python bindings (src/mpc_python.cpp) and batch tools.
+//
+// Every thread solves a contiguous chunk of the samples on an MPC of its
+// own, created for the call, so a warm start runs along the recorded order
+// within the chunk as it did on the robot. The arrays are plain row-major
+// buffers, the bindings pass the memory of the NumPy arrays without a
+// copy, and nothing here touches Python.
+class BatchSolver
+{
+    public:
+        // One row of the results
+        struct Result
+        {
+            double angvel, accel; // first input
+            double cost;
+            double solve_ms;
+            int status;           // Ipopt status
+            int iterations;
+            int feasible;
+        };
+
+        // params: MPC::LoadParams keys. threads <= 0 takes one per core.
+        BatchSolver(const std::map<std::string, double> &params, int threads);
+
+        // n samples: states n x 6 (x, y, theta, v, cte, etheta), coeffs
+        // n x n_coeffs (the path polynomial, lowest order first). results
+        // has n entries. Samples are split into chunks of at least
+        // min_chunk, at most one chunk per thread.
+        void Solve(const double *states, const double *coeffs, size_t n, int n_coeffs, Result *results,
+                   size_t min_chunk = 64) const;
+
+        int Threads() const { return _threads; }
+        const std::map<std::string, double> &Params() const { return _params; }
+
+    private:
+        std::map<std::string, double> _params;
+        int _threads;
+};
+
+#endif /* BATCH_SOLVER_H */
@@ -0,0 +1,73 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef CALLBACK_QUEUES_H
+#define CALLBACK_QUEUES_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include <thread>
+#include <ros/ros.h>
+#include <ros/callback_queue.h>
+#include "realtime.h"
+
+// Callback queues of a controller node by priority, instead of every
+// subscription on the global queue of the spinner.
+//
+// Subscriptions and timers made through Control() go to a queue served by
+// one thread with the real-time settings of the node: odometry and the
+// control timer, which decide when a command goes out. The ones made
+// through Bulk() go to a queue of their own served by an AsyncSpinner at
+// normal priority: paths, goals and AMCL, whose callbacks may transform a
+// whole path. A long path callback then never sits in front of odomCB or
+// the control timer. Everything else, the services for example, stays on
+// the queue of the node handle.
+class CallbackQueues
+{
+    public:
+        CallbackQueues();
+        ~CallbackQueues();
+
+        // nh with its callbacks on the control or the bulk queue
+        ros::NodeHandle Control(const ros::NodeHandle &nh);
+        ros::NodeHandle Bulk(const ros::NodeHandle &nh);
+
+        // Serve both queues, bulk_threads threads on the bulk one. realtime
+        // is applied to the control thread, what failed ends up in
+        // RealtimeReport().
+        void Start(const RealtimeSettings &realtime, int bulk_threads);
+        void Stop();
+        bool Running() const { return _running; }
+
+        const std::string &RealtimeReport() const { return _realtime_report; }
+
+    private:
+        void Run(const RealtimeSettings &realtime);
+
+        ros::CallbackQueue _control, _bulk;
+        std::unique_ptr<ros::AsyncSpinner> _bulk_spinner;
+        std::thread _control_thread;
+        std::atomic<bool> _running;
+        std::mutex _mutex;
+        std::condition_variable _cond;
+        bool _started;
+        std::string _realtime_report;
+};
+
+#endif /* CALLBACK_QUEUES_H */
@@ -0,0 +1,137 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef CLOSED_LOOP_SIM_H
+#define CLOSED_LOOP_SIM_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "tracking_controller.h"
+#include "reference_trajectory.h"
+
+// Headless closed loop of the tracking controller, without ROS or Gazebo.
+//
+// Each control period the plant state is measured (with noise) and the
+// controller gets the window of the reference ahead of the robot: by default
+// the MPC of the tracking node, which fits the window as in the node
+// (path_length, delay_mode, see trackRefTrajNode.cpp) and takes the command
+// of MPC::Solve. CONTROLLER=1/2 runs Pure Pursuit or DWA in its place on the
+// same episodes, see tracking_controller.h. The command reaches the plant latency seconds later, which
+// integrates it in substeps as a unicycle (speed and turn rate applied as
+// commanded) or a differential drive (wheel speed limits and a first-order
+// wheel lag). Simulated time does not wait for the wall clock, an episode
+// runs as fast as the solver allows.
+//
+// The reference comes from ReferenceTrajectory, the curves of the tracking
+// demos; the tracking error is measured against the true pose.
+struct PlantConfig
+{
+    enum Model { UNICYCLE = 0, DIFF_DRIVE = 1 };
+
+    PlantConfig();
+
+    int model;
+    double substep;         // integration step [s]
+    double latency;         // command to actuation [s]
+    double pos_noise;       // std dev of the measured position [m]
+    double yaw_noise;       // and heading [rad]
+    double vel_noise;       // and speed [m/s]
+    double track_width;     // DIFF_DRIVE [m]
+    double wheel_radius;    // [m]
+    double max_wheel_speed; // [rad/s], <= 0 unlimited
+    double wheel_tau;       // time constant of the wheel speeds [s], 0 ideal
+};
+
+struct EpisodeConfig
+{
+    EpisodeConfig();
+
+    std::string trajectory; // circle, epitrochoid, square or infinite
+    double scale;           // of the curve
+    double duration;        // simulated time [s]
+    double start;           // start on the loop in [0, 1)
+    double offset;          // initial lateral offset from the reference [m]
+    double heading;         // and heading error [rad]
+    unsigned seed;          // of the measurement noise
+};
+
+struct EpisodeResult
+{
+    EpisodeResult();
+
+    double cte_rms, cte_max;   // distance to the reference [m]
+    double etheta_rms;         // heading error [rad]
+    double distance;           // travelled [m]
+    double mean_speed;         // [m/s]
+    int cycles;                // control periods
+    int infeasible;            // solves whose inputs were not feasible
+    double solve_ms_mean, solve_ms_max;
+    double cpu_ms_mean;        // thread CPU time of the commands
+    std::vector<float> solve_ms; // wall time of every command
+    unsigned long long allocs, alloc_bytes; // heap allocations of the commands, see alloc_counter.h
+    bool diverged;             // cte beyond divergence_dist, the episode stopped
+};
+
+class ClosedLoopSim
+{
+    public:
+        // params: MPC::LoadParams keys, DT is the control period as in the
+        // tracking node. Setup of the controller around the solver:
+        // PATH_LENGTH (2 m) of the fitted window, DELAY_MODE (1),
+        // MAX_SPEED (REF_V) and DIVERGENCE (2 m) of the tracking error.
+        // CONTROLLER picks the TrackingController (0 MPC).
+        ClosedLoopSim(const std::map<std::string, double> &params, const PlantConfig &plant);
+
+        // One episode on a fresh plant. The controller keeps its tapes and
+        // drops the plan of the previous episode.
+        EpisodeResult Run(const EpisodeConfig &episode);
+
+        // episodes on threads instances side by side, results in the order
+        // of episodes
+        static void RunAll(const std::map<std::string, double> &params, const PlantConfig &plant,
+                           const std::vector<EpisodeConfig> &episodes, int threads,
+                           std::vector<EpisodeResult> &results);
+
+        // MPC parameters with the defaults of the tracking node
+        static std::map<std::string, double> DefaultParams();
+
+        // PlantConfig field of a command line key (PLANT, LATENCY, POS_NOISE,
+        // YAW_NOISE, VEL_NOISE, SUBSTEP, TRACK_WIDTH, WHEEL_RADIUS,
+        // MAX_WHEEL_SPEED, WHEEL_TAU), false for any other key
+        static bool SetPlant(const std::string &key, double value, PlantConfig &plant);
+
+        // count episodes of duration on trajectory ("all" takes the four
+        // in turn), each from a random start on the loop, with a lateral
+        // offset in [-offset, offset] and a heading error in [-heading,
+        // heading]. Episode i is drawn from seed + i.
+        static std::vector<EpisodeConfig> RandomEpisodes(int count, const std::string &trajectory, double scale,
+                                                         double duration, double offset, double heading,
+                                                         unsigned seed);
+
+    private:
+        // Trajectory of type and scale, generated on first use
+        const ReferenceTrajectory *reference(const std::string &type, double scale);
+
+        std::map<std::string, double> _params;
+        PlantConfig _plant;
+        std::unique_ptr<TrackingController> _controller;
+        double _dt, _divergence;
+        std::map<std::pair<std::string, double>, std::shared_ptr<ReferenceTrajectory> > _references;
+};
+
+#endif /* CLOSED_LOOP_SIM_H */
@@ -0,0 +1,94 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef COARSE_GUIDE_H
+#define COARSE_GUIDE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <Eigen/Core>
+#include "MPC.h"
+#include "mailbox.h"
+
+// Problem of one coarse solve, in the SolveReference() form: the state and
+// the reference poses in the vehicle frame of the pose px, py, theta.
+struct GuideRequest
+{
+    GuideRequest();
+
+    double stamp;          // time of the state [s]
+    double px, py, theta;  // vehicle frame in the odom frame
+    Eigen::VectorXd state; // x, y, theta, v, cte, etheta (, angvel)
+    Eigen::VectorXd ref;   // x, y and theta of one reference pose per coarse step
+};
+
+// Prediction of the coarse MPC, in the odom frame so it outlives the pose it
+// was solved from. Pose i is reached at stamp + t[i].
+struct GuidePlan
+{
+    GuidePlan();
+
+    // Pose and speed at time t by linear interpolation, false outside of
+    // the horizon. theta is unwrapped along the plan.
+    bool Sample(double t, double &x, double &y, double &theta, double &v) const;
+
+    double stamp; // time of the request's state [s]
+    std::vector<double> t, x, y, theta, v;
+};
+
+// Long horizon guide of a short horizon tracker: a second MPC with a large
+// step solves on its own thread at a low rate, and the tracker samples its
+// newest plan as reference poses and speed. Request() and Latest() are the
+// tracker's side of two Mailboxes, neither waits for a coarse solve; the
+// requests of one period are merged into the newest one.
+class CoarseGuide
+{
+    public:
+        CoarseGuide();
+        ~CoarseGuide();
+
+        // params of the tracker with STEPS and DT replaced by the coarse
+        // horizon, solved at rate [Hz]
+        void Start(const std::map<std::string, double> &params, int steps, double dt, double rate);
+        void Stop();
+        bool IsRunning() const;
+
+        // Tracker only: fill Back() and hand it over with Request()
+        GuideRequest &Back() { return _requests.Back(); }
+        void Request() { _requests.Publish(); }
+        // Tracker only: the newest plan, NULL before the first. It stays
+        // valid until the next call.
+        const GuidePlan *Latest() { return _plans.Take(); }
+
+    private:
+        void Run();
+        bool solve(const GuideRequest &request, GuidePlan &plan);
+
+        MPC _mpc;
+        double _period; // [s]
+        std::thread _thread;
+        mutable std::mutex _mutex;
+        std::condition_variable _cond; // cuts the wait of Run() short on Stop()
+        bool _running;
+        Mailbox<GuideRequest> _requests;
+        Mailbox<GuidePlan> _plans;
+};
+
+#endif /* COARSE_GUIDE_H */
@@ -0,0 +1,73 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef CODEGEN_MODEL_H
+#define CODEGEN_MODEL_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cppad/cg.hpp>
+
+// FG model compiled to C with CppADCodeGen (only built with BUILD_CODEGEN).
+//
+// Generate() records fg_eval once with CppAD::cg::CG<double> as the base
+// type and writes a shared library holding straight-line code for f, g,
+// the sparse Jacobian of [f, g] and the sparse Hessian of the Lagrangian.
+// The domain is [vars | params] as in TapeSolver, so the same library
+// serves every path. Weights, dt and the horizon end up as literals in the
+// generated code, the model name is what tells configurations apart.
+class CodegenModel
+{
+    public:
+        typedef CppAD::cg::CG<double> CGD;
+        typedef CPPAD_TESTVECTOR(CppAD::AD<CGD>) ADvector;
+        typedef std::function<void(ADvector&, const ADvector&)> FgFunction;
+
+        // Write <library><so extension> with C sources in <library>_sources
+        static bool Generate(const std::string &library, const std::string &model,
+                             size_t n_vars, size_t n_constraints, size_t n_params,
+                             const FgFunction &fg_eval);
+
+        // Open the library and check the model dimensions, false if the
+        // library has no such model
+        bool Load(const std::string &library, const std::string &model,
+                  size_t n_vars, size_t n_constraints, size_t n_params);
+
+        // [f, g] at x = [vars | params]
+        void ForwardZero(const std::vector<double> &x, std::vector<double> &fg);
+
+        // Values in the order of JacobianSparsity() / HessianSparsity(),
+        // w weights the rows of [f, g]
+        void SparseJacobian(const std::vector<double> &x, std::vector<double> &jac);
+        void SparseHessian(const std::vector<double> &x, const std::vector<double> &w,
+                           std::vector<double> &hes);
+
+        const std::vector<size_t> &JacobianRows() const { return _row_jac; }
+        const std::vector<size_t> &JacobianCols() const { return _col_jac; }
+        const std::vector<size_t> &HessianRows() const { return _row_hes; }
+        const std::vector<size_t> &HessianCols() const { return _col_hes; }
+
+    private:
+        std::unique_ptr<CppAD::cg::DynamicLib<double> > _lib;
+        std::unique_ptr<CppAD::cg::GenericModel<double> > _model;
+        std::vector<size_t> _row_jac, _col_jac, _row_hes, _col_hes;
+        std::vector<size_t> _row_tmp, _col_tmp;
+};
+
+#endif /* CODEGEN_MODEL_H */
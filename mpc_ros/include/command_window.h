@@ -0,0 +1,74 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef COMMAND_WINDOW_H
+#define COMMAND_WINDOW_H
+
+#include <algorithm>
+#include "solver_thread.h"
+
+// MPCCommand in fixed-size arrays, a plain struct that LatestValue hands
+// from the solving thread to a real-time loop without allocating. Steps
+// past CAPACITY are dropped; a window with no steps stops the wheels.
+struct CommandWindow
+{
+    enum { CAPACITY = 64 };
+
+    CommandWindow() : stamp(0.0), size(0), torques(false) {}
+
+    // cmd NULL for no command
+    void Assign(const MPCCommand *cmd)
+    {
+        size = 0;
+        torques = false;
+        if (!cmd || cmd->speed.size() != cmd->angvel.size() || cmd->dt <= 0.0)
+            return;
+        stamp = cmd->stamp;
+        size = std::min<int>(cmd->speed.size(), CAPACITY);
+        torques = cmd->torque_right.size() == cmd->speed.size() && cmd->torque_left.size() == cmd->speed.size();
+        const bool grid = cmd->step_dt.size() == cmd->speed.size();
+        double t = 0.0;
+        for (int k = 0; k < size; k++)
+        {
+            t += grid ? cmd->step_dt[k] : cmd->dt;
+            end[k] = t;
+            speed[k] = cmd->speed[k];
+            angvel[k] = cmd->angvel[k];
+            torque_right[k] = torques ? cmd->torque_right[k] : 0.0;
+            torque_left[k] = torques ? cmd->torque_left[k] : 0.0;
+        }
+    }
+
+    // Index of the step at time t, -1 outside of the window. Inputs are
+    // piecewise constant over each step, as in MPCCommand.
+    int Step(double t) const
+    {
+        const double elapsed = std::max(0.0, t - stamp);
+        for (int k = 0; k < size; k++)
+            if (elapsed < end[k])
+                return k;
+        return -1;
+    }
+
+    double stamp; // time of the state snapshot the solve started from [s]
+    int size;
+    bool torques; // torque_right and torque_left hold the DYNAMIC model torques
+    double end[CAPACITY]; // end of each step after stamp [s]
+    double speed[CAPACITY], angvel[CAPACITY];
+    double torque_right[CAPACITY], torque_left[CAPACITY]; // [N m]
+};
+
+#endif /* COMMAND_WINDOW_H */
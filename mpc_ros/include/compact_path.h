@@ -0,0 +1,88 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef COMPACT_PATH_H
+#define COMPACT_PATH_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <nav_msgs/Path.h>
+
+// Reference path as the controllers read it: x, y, yaw and the cumulative
+// arc length s of the waypoints, each in one contiguous array, with one
+// frame id and stamp for the whole path.
+//
+// A nav_msgs::Path carries a header with a frame id string and a quaternion
+// per pose, while the fits, the nearest point searches and the lookahead
+// only read x and y. The nodes convert at the ROS boundary, Set() when a
+// path message arrives and ToMsg() to publish one, and hand CompactPath to
+// everything in between. compact_path_msg.h decodes a Path message on the
+// wire into a CompactPath without building the message first.
+class CompactPath
+{
+    public:
+        typedef boost::shared_ptr<const CompactPath> ConstPtr;
+
+        CompactPath();
+
+        // Waypoints of path, in the frame of its header (of its first pose
+        // when the header has none)
+        void Set(const nav_msgs::Path &path);
+        // path with one pose per waypoint, orientation from the yaw, frame
+        // and stamp of this path on the header and every pose
+        void ToMsg(nav_msgs::Path &path) const;
+
+        void Clear();
+        void Reserve(size_t n);
+        // Waypoint at the end, s grows by the distance to the last one
+        void PushBack(double x, double y, double yaw);
+        void PushBack(const geometry_msgs::Pose &pose);
+        // Drop the first n waypoints, s starts over at 0
+        void EraseFront(size_t n);
+        // Move every waypoint by the planar rigid transform (x, y, yaw), e.g.
+        // the change of map -> odom since the path was transformed to odom.
+        // One pass over each array, s stays.
+        void Transform(double x, double y, double yaw);
+
+        size_t Size() const { return _x.size(); }
+        bool Empty() const { return _x.empty(); }
+        double X(size_t i) const { return _x[i]; }
+        double Y(size_t i) const { return _y[i]; }
+        double Yaw(size_t i) const { return _yaw[i]; }
+        double S(size_t i) const { return _s[i]; }
+        double Length() const { return _s.empty() ? 0.0 : _s.back(); }
+        // The arrays, Size() entries each
+        const double *Xs() const { return _x.data(); }
+        const double *Ys() const { return _y.data(); }
+        const std::vector<double> &Ss() const { return _s; }
+
+        const std::string &Frame() const { return _frame; }
+        void SetFrame(const std::string &frame) { _frame = frame; }
+        const ros::Time &Stamp() const { return _stamp; }
+        void SetStamp(const ros::Time &stamp) { _stamp = stamp; }
+
+        // Yaw of the unit quaternion (qx, qy, qz, qw)
+        static double QuaternionYaw(double qx, double qy, double qz, double qw);
+
+    private:
+        std::vector<double> _x, _y, _yaw, _s;
+        std::string _frame;
+        ros::Time _stamp;
+};
+
+#endif /* COMPACT_PATH_H */
@@ -0,0 +1,146 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef COMPACT_PATH_MSG_H
+#define COMPACT_PATH_MSG_H
+
+#include <cmath>
+#include <string>
+#include <stdint.h>
+#include <ros/serialization.h>
+#include <ros/message_traits.h>
+#include <nav_msgs/Path.h>
+#include "compact_path.h"
+
+// CompactPath on the wire as a nav_msgs/Path. With these traits a node
+// subscribes to a Path topic with a CompactPath callback, or publishes a
+// CompactPath on one, and roscpp (de)serializes it directly:
+//
+//   _sub_path = _nh.subscribe(topic, 1, &Node::pathCB, this);
+//   void Node::pathCB(const CompactPath::ConstPtr &path);
+//
+// Reading keeps the position x, y and the yaw of every pose. The pose
+// headers are skipped in the buffer, their frame id strings are never
+// allocated; only the frame of the path header is kept, or of the first
+// pose when the header has none, as in CompactPath::Set(). Writing gives
+// every pose the frame and stamp of the path, z 0 and the orientation of
+// the yaw, as CompactPath::ToMsg().
+namespace ros
+{
+namespace message_traits
+{
+
+template <> struct MD5Sum<CompactPath>
+{
+    static const char *value() { return MD5Sum<nav_msgs::Path>::value(); }
+    static const char *value(const CompactPath &) { return value(); }
+};
+
+template <> struct DataType<CompactPath>
+{
+    static const char *value() { return DataType<nav_msgs::Path>::value(); }
+    static const char *value(const CompactPath &) { return value(); }
+};
+
+template <> struct Definition<CompactPath>
+{
+    static const char *value() { return Definition<nav_msgs::Path>::value(); }
+    static const char *value(const CompactPath &) { return value(); }
+};
+
+} // namespace message_traits
+
+namespace serialization
+{
+
+template <> struct Serializer<CompactPath>
+{
+    template <typename Stream>
+    inline static void write(Stream &stream, const CompactPath &path)
+    {
+        const uint32_t seq = 0, sec = path.Stamp().sec, nsec = path.Stamp().nsec;
+        stream.next(seq);
+        stream.next(sec);
+        stream.next(nsec);
+        stream.next(path.Frame());
+        stream.next(uint32_t(path.Size()));
+        const double zero = 0.0;
+        for (size_t i = 0; i < path.Size(); i++)
+        {
+            stream.next(seq);
+            stream.next(sec);
+            stream.next(nsec);
+            stream.next(path.Frame());
+            stream.next(path.X(i));
+            stream.next(path.Y(i));
+            stream.next(zero);
+            stream.next(zero);
+            stream.next(zero);
+            stream.next(std::sin(0.5 * path.Yaw(i)));
+            stream.next(std::cos(0.5 * path.Yaw(i)));
+        }
+    }
+
+    template <typename Stream>
+    inline static void read(Stream &stream, CompactPath &path)
+    {
+        uint32_t seq, sec, nsec, n;
+        std::string frame;
+        stream.next(seq);
+        stream.next(sec);
+        stream.next(nsec);
+        stream.next(frame);
+        stream.next(n);
+
+        path.Clear();
+        path.Reserve(n);
+        for (uint32_t i = 0; i < n; i++)
+        {
+            uint32_t pose_seq, pose_sec, pose_nsec, frame_len;
+            stream.next(pose_seq);
+            stream.next(pose_sec);
+            stream.next(pose_nsec);
+            stream.next(frame_len);
+            const uint8_t *pose_frame = stream.advance(frame_len);
+            if (i == 0 && frame.empty())
+                frame.assign(reinterpret_cast<const char *>(pose_frame), frame_len);
+
+            double x, y, z, qx, qy, qz, qw;
+            stream.next(x);
+            stream.next(y);
+            stream.next(z);
+            stream.next(qx);
+            stream.next(qy);
+            stream.next(qz);
+            stream.next(qw);
+            path.PushBack(x, y, CompactPath::QuaternionYaw(qx, qy, qz, qw));
+        }
+        path.SetFrame(frame);
+        path.SetStamp(ros::Time(sec, nsec));
+    }
+
+    inline static uint32_t serializedLength(const CompactPath &path)
+    {
+        // seq, stamp and frame id of a header, a pose is 7 doubles
+        const uint32_t header = 4 + 8 + 4 + path.Frame().size();
+        return header + 4 + path.Size() * (header + 7 * 8);
+    }
+};
+
+} // namespace serialization
+} // namespace ros
+
+#endif /* COMPACT_PATH_MSG_H */
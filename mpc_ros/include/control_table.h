@@ -0,0 +1,87 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef CONTROL_TABLE_H
+#define CONTROL_TABLE_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+
+// Explicit MPC: the first control (angvel, accel) of MPC::Solve tabulated
+// offline on a grid over (v, cte, etheta, c2, c3) and interpolated
+// multilinearly at runtime. The state of the solve is (0, 0, 0, v, cte,
+// etheta) and the path the cubic cte + tan(etheta) x + c2 x^2 + c3 x^3 of
+// MPC_Node, anything else is out of the table.
+//
+// File layout (little endian, written by mpc_table): a Header, then two
+// floats per grid point, the last axis running fastest. Points whose solve
+// failed are NaN. Open() maps the file read-only, nothing is copied.
+class ControlTable
+{
+    public:
+        enum { DIMS = 5 };
+
+        struct Axis
+        {
+            double min, max;
+            int n; // >= 2 points
+        };
+
+        ControlTable();
+        ~ControlTable();
+
+        // Empty table of axes[DIMS] for the model parameters params_hash
+        void Create(const Axis axes[DIMS], unsigned long long params_hash);
+        size_t Size() const { return _size; }
+        // Query of grid point index
+        void Point(size_t index, double query[DIMS]) const;
+        void Set(size_t index, double angvel, double accel);
+        bool Write(const std::string &path) const;
+
+        bool Open(const std::string &path);
+        void Close();
+        bool Valid() const { return _values != NULL; }
+        unsigned long long ParamsHash() const { return _params_hash; }
+
+        // Interpolated control at query, false outside the grid or next to
+        // a failed point
+        bool Lookup(const double query[DIMS], double &angvel, double &accel) const;
+
+        // Query of a solve, false if it is not one the table can cover
+        static bool Query(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, double query[DIMS]);
+        // Solve of a query, inverse of Query()
+        static void Problem(const double query[DIMS], Eigen::VectorXd &state, Eigen::VectorXd &coeffs);
+        // FNV-1a of the MPC::LoadParams keys that shape the solution
+        static unsigned long long HashParams(const std::map<std::string, double> &params);
+
+    private:
+        ControlTable(const ControlTable &);
+        ControlTable &operator=(const ControlTable &);
+
+        Axis _axes[DIMS];
+        size_t _stride[DIMS], _size;
+        unsigned long long _params_hash;
+
+        std::vector<float> _data;   // Create()d table
+        const float *_values;       // _data or the mapping
+        void *_map;
+        size_t _map_size;
+};
+
+#endif /* CONTROL_TABLE_H */
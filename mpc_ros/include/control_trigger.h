@@ -0,0 +1,70 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef CONTROL_TRIGGER_H
+#define CONTROL_TRIGGER_H
+
+#include <atomic>
+
+// Odometry-synchronous control: the control cycle starts on every k-th
+// odometry message (or fused state estimate), offset seconds after it
+// arrived, instead of on a free-running timer whose phase drifts against
+// the state and adds half a period of staleness on average. The control
+// timer stays as a watchdog: it runs the cycle when none started for
+// watchdog control periods, e.g. when the odometry stops.
+//
+// Odometry() belongs to the odometry callback; Started() and Overdue() may
+// be called from the cycle and the watchdog on any threads.
+class ControlTrigger
+{
+    public:
+        ControlTrigger();
+
+        // every >= 1 messages per cycle, offset [s] after the k-th one,
+        // watchdog in control periods
+        void Configure(bool enabled, int every, double offset, double watchdog);
+        bool Enabled() const { return _enabled; }
+        double Offset() const { return _offset; }
+        int Every() const { return _every; }
+        // Every factor times as many messages per cycle as configured, the
+        // CPU governor lowers the control rate through it
+        void Scale(double factor);
+
+        // An odometry message arrived: true on every k-th, the cycle is due
+        // Offset() seconds later
+        bool Odometry();
+        // A control cycle started at time t, either way
+        void Started(double t) { _last = t; }
+        // No cycle started for watchdog periods of length period at time t,
+        // the periods scaled as by Scale()
+        bool Overdue(double t, double period) const;
+
+        // Cycles the watchdog ran since Configure()
+        unsigned Watchdog() const { return _watchdog_cycles; }
+        void CountWatchdog() { _watchdog_cycles++; }
+
+    private:
+        bool _enabled;
+        int _base_every;
+        std::atomic<int> _every;
+        int _count;
+        double _offset, _watchdog;
+        std::atomic<double> _last;
+        std::atomic<unsigned> _watchdog_cycles;
+};
+
+#endif /* CONTROL_TRIGGER_H */
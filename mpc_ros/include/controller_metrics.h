@@ -0,0 +1,170 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef CONTROLLER_METRICS_H
+#define CONTROLLER_METRICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct TapeMemory;
+
+// Cumulative histogram of one quantity with fixed bucket edges. Observe()
+// only does relaxed atomic increments, so the control cycle never waits
+// on the thread that reads the metrics; a reader may see a sample in the
+// count before it shows up in the sum.
+class MetricHistogram
+{
+    public:
+        // edges ascending, bucket i counts values <= edges[i] that are
+        // above edges[i-1], the last one everything above the last edge
+        explicit MetricHistogram(const std::vector<double> &edges);
+
+        void Observe(double value);
+
+        const std::vector<double> &Edges() const { return _edges; }
+        uint64_t Bucket(int i) const { return _buckets[i].load(std::memory_order_relaxed); }
+        uint64_t Count() const { return _count.load(std::memory_order_relaxed); }
+        double Sum() const { return _sum.load(std::memory_order_relaxed); }
+
+        // Prometheus text format, name_bucket{le=..} cumulative, name_sum and
+        // name_count, values multiplied by scale (e.g. ms to seconds). Without
+        // header the HELP and TYPE lines are left out, for more samples of
+        // one metric with other labels.
+        void Render(const std::string &name, const std::string &help, const std::string &labels,
+                    double scale, std::string &out, bool header = true) const;
+
+    private:
+        std::vector<double> _edges;
+        std::vector<std::atomic<uint64_t> > _buckets;
+        std::atomic<uint64_t> _count;
+        std::atomic<double> _sum;
+};
+
+// A backend solving the inputs of the primary solver in shadow mode next to
+// it, see shadow_solver.h: its latency and iterations, and how far its first
+// command is from the one that was applied
+class ShadowMetrics
+{
+    public:
+        explicit ShadowMetrics(const std::string &backend);
+
+        // One shadow solve of solve_ms, primary_ms the primary solve of
+        // the same inputs, the differences absolute
+        void ObserveSolve(double solve_ms, int iterations, double primary_ms, double angvel_diff, double accel_diff);
+        // Inputs replaced before the backend got to them
+        void CountDropped() { _dropped.fetch_add(1, std::memory_order_relaxed); }
+        void CountInfeasible() { _infeasible.fetch_add(1, std::memory_order_relaxed); }
+
+        const std::string &Backend() const { return _backend; }
+        uint64_t Solves() const { return _solve_ms.Count(); }
+        uint64_t Faster() const { return _faster.load(std::memory_order_relaxed); }
+        uint64_t Dropped() const { return _dropped.load(std::memory_order_relaxed); }
+        uint64_t Infeasible() const { return _infeasible.load(std::memory_order_relaxed); }
+
+        // Every shadow metric of all backends, labels plus backend="..."
+        static void Prometheus(const std::vector<std::unique_ptr<ShadowMetrics> > &shadows,
+                               const std::string &labels, std::string &out);
+
+    private:
+        std::string _backend;
+        MetricHistogram _solve_ms, _iterations, _angvel_diff, _accel_diff;
+        std::atomic<uint64_t> _faster, _dropped, _infeasible;
+};
+
+// Health metrics of a controller for fleet aggregation: solve latency,
+// iterations and status codes, deadline misses, fallbacks, TF staleness and
+// the tracking errors. The Observe/Count calls are lock-free and meant for
+// the control cycle; Prometheus() and the getters are read from another
+// thread (diagnostics timer, HTTP exporter, see metrics_exporter.h).
+class ControllerMetrics
+{
+    public:
+        // CppAD::ipopt::solve_result::status_type, the last one for anything
+        // outside of it
+        static const int NUM_STATUS = 15;
+
+        ControllerMetrics();
+
+        // One control cycle of total_ms
+        void ObserveCycle(double total_ms);
+        // One solve, iterations < 0 when not reported
+        void ObserveSolve(double solve_ms, int iterations, int status);
+        // Tracking errors at the start of a cycle, [m] and [rad]
+        void ObserveTracking(double cte, double etheta);
+
+        void CountDeadlineMiss() { _deadline_misses.fetch_add(1, std::memory_order_relaxed); }
+        void CountFallback() { _fallbacks.fetch_add(1, std::memory_order_relaxed); }
+        void CountInfeasible() { _infeasible.fetch_add(1, std::memory_order_relaxed); }
+        void CountTfStale() { _tf_stale.fetch_add(1, std::memory_order_relaxed); }
+
+        // Bytes the solver holds between solves, in the stores of TapeMemory
+        enum MemoryStore { MEMORY_TAPE, MEMORY_TAYLOR, MEMORY_SPARSITY, MEMORY_IPOPT, NUM_MEMORY_STORES };
+        void SetMemory(MemoryStore store, uint64_t bytes) { _memory[store].store(bytes, std::memory_order_relaxed); }
+        uint64_t Memory(MemoryStore store) const { return _memory[store].load(std::memory_order_relaxed); }
+        static const char *MemoryStoreName(int store);
+        // Every store of memory, e.g. MPC::Memory() after a solve
+        void SetMemory(const TapeMemory &memory);
+
+        // Degradation level of the CPU governor and the CPU share of its
+        // last window, see cpu_governor.h
+        void SetGovernor(int level, double cpu_share)
+        {
+            _governor_level.store(level, std::memory_order_relaxed);
+            _cpu_share.store(cpu_share, std::memory_order_relaxed);
+        }
+        int GovernorLevel() const { return _governor_level.load(std::memory_order_relaxed); }
+        double CpuShare() const { return _cpu_share.load(std::memory_order_relaxed); }
+
+        uint64_t Cycles() const { return _cycle_ms.Count(); }
+        uint64_t Solves() const { return _solve_ms.Count(); }
+        uint64_t Status(int status) const { return _status[statusIndex(status)].load(std::memory_order_relaxed); }
+        uint64_t DeadlineMisses() const { return _deadline_misses.load(std::memory_order_relaxed); }
+        uint64_t Fallbacks() const { return _fallbacks.load(std::memory_order_relaxed); }
+        uint64_t Infeasible() const { return _infeasible.load(std::memory_order_relaxed); }
+        uint64_t TfStale() const { return _tf_stale.load(std::memory_order_relaxed); }
+        double SolveMsSum() const { return _solve_ms.Sum(); }
+        double IterationSum() const { return _iterations.Sum(); }
+        double CteSum() const { return _cte.Sum(); }
+        double EthetaSum() const { return _etheta.Sum(); }
+        uint64_t TrackingCount() const { return _cte.Count(); }
+
+        static const char *StatusName(int status);
+
+        // Metrics of one more shadow backend, before the metrics are read
+        // from another thread
+        ShadowMetrics &AddShadow(const std::string &backend);
+
+        // Every metric in the Prometheus text exposition format, each sample
+        // with labels (e.g. controller="/mpc_node", or empty)
+        std::string Prometheus(const std::string &labels) const;
+
+    private:
+        static int statusIndex(int status) { return (status >= 0 && status < NUM_STATUS) ? status : NUM_STATUS - 1; }
+
+        MetricHistogram _cycle_ms, _solve_ms, _iterations, _cte, _etheta;
+        std::atomic<uint64_t> _status[NUM_STATUS];
+        std::atomic<uint64_t> _deadline_misses, _fallbacks, _infeasible, _tf_stale;
+        std::atomic<uint64_t> _memory[NUM_MEMORY_STORES];
+        std::atomic<int> _governor_level;
+        std::atomic<double> _cpu_share;
+        std::vector<std::unique_ptr<ShadowMetrics> > _shadows;
+};
+
+#endif /* CONTROLLER_METRICS_H */
@@ -0,0 +1,42 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef CONTROLLER_NODELET_H
+#define CONTROLLER_NODELET_H
+
+#include <boost/shared_ptr.hpp>
+#include <nodelet/nodelet.h>
+
+// Runs one of the controller classes of the standalone nodes as a nodelet.
+// Node is constructed from the public and private node handles; the
+// multi-threaded ones put its callbacks on the thread pool of the manager,
+// like the AsyncSpinner does in the executables. Messages between nodelets
+// of the same manager are handed over as shared pointers, without
+// serialization.
+template <class Node>
+class ControllerNodelet : public nodelet::Nodelet
+{
+    private:
+        virtual void onInit()
+        {
+            _node.reset(new Node(getMTNodeHandle(), getMTPrivateNodeHandle()));
+        }
+
+        boost::shared_ptr<Node> _node;
+};
+
+#endif /* CONTROLLER_NODELET_H */
@@ -0,0 +1,72 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef COSTMAP_SNAPSHOT_H
+#define COSTMAP_SNAPSHOT_H
+
+#include <cstddef>
+#include <vector>
+
+// Copy of the part of the costmap one planning cycle looks at, so that
+// the obstacle terms and the footprint checks read it without the costmap
+// lock. Take() is the only access under the lock: one memcpy per row of a
+// square window around the robot, aligned to the costmap cells and of the
+// same size from cycle to cycle (as long as the radius and the resolution
+// stay), so that DistanceField shifts instead of rebuilding when the
+// window moves. Rows are contiguous (the layout of Costmap2D::getCharMap())
+// and the window starts on a cache line.
+class CostmapSnapshot
+{
+    public:
+        CostmapSnapshot();
+
+        // Window of half size radius [m] around (x, y), clamped to the
+        // costmap, from costs of size_x * size_y cells, row major, cell
+        // (0, 0) spanning [origin, origin + resolution). The caller holds
+        // the costmap lock.
+        void Take(const unsigned char *costs, unsigned int size_x, unsigned int size_y,
+                  double resolution, double origin_x, double origin_y,
+                  double x, double y, double radius);
+        // Until the next Take()
+        void Invalidate() { _valid = false; }
+        bool Valid() const { return _valid; }
+
+        const unsigned char *Costs() const { return &_buffer[_offset]; }
+        unsigned int SizeX() const { return _size_x; }
+        unsigned int SizeY() const { return _size_y; }
+        double Resolution() const { return _resolution; }
+        double OriginX() const { return _origin_x; }
+        double OriginY() const { return _origin_y; }
+
+        // Every point of the n points grown by margin [m] lies inside the
+        // window, or on cells off the costmap anyway
+        bool Covers(const double *x, const double *y, size_t n, double margin) const;
+
+    private:
+        enum { ALIGN = 64 };
+
+        bool _valid;
+        std::vector<unsigned char> _buffer;
+        size_t _offset; // of the first cell in _buffer, ALIGN aligned
+        unsigned int _size_x, _size_y;
+        double _resolution, _origin_x, _origin_y;
+        // Window in costmap cells and the costmap size, for Covers()
+        int _x0, _y0;
+        unsigned int _map_x, _map_y;
+        double _map_origin_x, _map_origin_y;
+};
+
+#endif /* COSTMAP_SNAPSHOT_H */
@@ -70,9 +70,12 @@ Was a adolc_prefix specified on the cmake command line.
 
 /*!
 def CPPAD_HAS_COLPACK
-Was a colpack_prefix specified on the cmake command line.
+Was a colpack_prefix specified on the cmake command line
+(mpc_ros: or -DCPPAD_HAS_COLPACK=1, see BUILD_COLPACK).
 */
+# ifndef CPPAD_HAS_COLPACK
 # define CPPAD_HAS_COLPACK 0
+# endif
 
 /*!
 def CPPAD_HAS_EIGEN
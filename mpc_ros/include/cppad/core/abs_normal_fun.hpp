@@ -304,14 +304,14 @@ void ADFun<Base>::abs_normal_fun(ADFun<Base>& g, ADFun<Base>& a) const
 	size_t        i_op;               // index of this operator
 	size_t        i_var;              // variable index for this operator
 	i_op = 0;
-	play_.get_op_info(i_op, op, arg, i_var);
+	play_->get_op_info(i_op, op, arg, i_var);
 	CPPAD_ASSERT_UNKNOWN( op == BeginOp );
 	//
 	bool    more_operators = true;
 	while( more_operators )
 	{
 		// next op
-		play_.get_op_info(++i_op, op, arg, i_var);
+		play_->get_op_info(++i_op, op, arg, i_var);
 		switch( op )
 		{	// absolute value operator
 			case AbsOp:
@@ -342,7 +342,7 @@ void ADFun<Base>::abs_normal_fun(ADFun<Base>& g, ADFun<Base>& a) const
 	//
 	// number of variables in both operation sequences
 	// (the AbsOp operators are replace by InvOp operators)
-	const size_t num_var = play_.num_var_rec();
+	const size_t num_var = play_->num_var_rec();
 	//
 	// mapping from old variable index to new variable index
 	CPPAD_ASSERT_UNKNOWN(
@@ -354,7 +354,7 @@ void ADFun<Base>::abs_normal_fun(ADFun<Base>& g, ADFun<Base>& a) const
 	//
 	// record the independent variables in f
 	i_op = 0;
-	play_.get_op_info(i_op, op, arg, i_var);
+	play_->get_op_info(i_op, op, arg, i_var);
 	CPPAD_ASSERT_UNKNOWN( op == BeginOp );
 	more_operators   = true;
 	while( more_operators )
@@ -380,7 +380,7 @@ void ADFun<Base>::abs_normal_fun(ADFun<Base>& g, ADFun<Base>& a) const
 			break;
 		}
 		if( more_operators )
-			play_.get_op_info(++i_op, op, arg, i_var);
+			play_->get_op_info(++i_op, op, arg, i_var);
 	}
 	// add one for the phantom variable
 	CPPAD_ASSERT_UNKNOWN( 1 + Domain() == i_var );
@@ -394,7 +394,7 @@ void ADFun<Base>::abs_normal_fun(ADFun<Base>& g, ADFun<Base>& a) const
 	addr_t new_arg[6];
 	//
 	// Parameters in recording of f
-	const Base* f_parameter = play_.GetPar();
+	const Base* f_parameter = play_->GetPar();
 	//
 	// now loop through the rest of the
 	more_operators = true;
@@ -443,6 +443,7 @@ void ADFun<Base>::abs_normal_fun(ADFun<Base>& g, ADFun<Base>& a) const
 			case Log1pOp:
 			case SignOp:
 			case SinOp:
+			case SinCosOp:
 			case SinhOp:
 			case SqrtOp:
 			case TanOp:
@@ -522,6 +523,18 @@ void ADFun<Base>::abs_normal_fun(ADFun<Base>& g, ADFun<Base>& a) const
 			rec.PutArg( new_arg[0], new_arg[1] );
 			f2g_var[i_var] = rec.PutOp(op);
 			break;
+			// --------------------------------------------------------------
+			// Parameter times the product of two variables, one result
+			case MulpvvOp:
+			CPPAD_ASSERT_NARG_NRES(op, 3, 1);
+			CPPAD_ASSERT_UNKNOWN( size_t( f2g_var[ arg[1] ] ) < num_var );
+			CPPAD_ASSERT_UNKNOWN( size_t( f2g_var[ arg[2] ] ) < num_var );
+			new_arg[0] = rec.PutPar( f_parameter[ arg[0] ] );
+			new_arg[1] = f2g_var[ arg[1] ];
+			new_arg[2] = f2g_var[ arg[2] ];
+			rec.PutArg( new_arg[0], new_arg[1], new_arg[2] );
+			f2g_var[i_var] = rec.PutOp(op);
+			break;
 			// ---------------------------------------------------
 			// Conditional expression operators
 			case CExpOp:
@@ -617,8 +630,8 @@ void ADFun<Base>::abs_normal_fun(ADFun<Base>& g, ADFun<Base>& a) const
 			else
 			{	new_arg[3] = rec.PutPar( f_parameter[ arg[3] ] );
 			}
-			new_arg[2] = rec.PutTxt( play_.GetTxt( arg[2] ) );
-			new_arg[4] = rec.PutTxt( play_.GetTxt( arg[4] ) );
+			new_arg[2] = rec.PutTxt( play_->GetTxt( arg[2] ) );
+			new_arg[4] = rec.PutTxt( play_->GetTxt( arg[4] ) );
 			//
 			rec.PutArg(
 				new_arg[0] ,
@@ -765,12 +778,12 @@ void ADFun<Base>::abs_normal_fun(ADFun<Base>& g, ADFun<Base>& a) const
 			CPPAD_ASSERT_UNKNOWN(false);
 		}
 		if( more_operators )
-			play_.get_op_info(++i_op, op, arg, i_var);
+			play_->get_op_info(++i_op, op, arg, i_var);
 	}
 	// Check a few expected results
-	CPPAD_ASSERT_UNKNOWN( rec.num_op_rec() == play_.num_op_rec() );
-	CPPAD_ASSERT_UNKNOWN( rec.num_var_rec() == play_.num_var_rec() );
-	CPPAD_ASSERT_UNKNOWN( rec.num_load_op_rec() == play_.num_load_op_rec() );
+	CPPAD_ASSERT_UNKNOWN( rec.num_op_rec() == play_->num_op_rec() );
+	CPPAD_ASSERT_UNKNOWN( rec.num_var_rec() == play_->num_var_rec() );
+	CPPAD_ASSERT_UNKNOWN( rec.num_load_op_rec() == play_->num_load_op_rec() );
 
 	// -----------------------------------------------------------------------
 	// Use rec to create the function g
@@ -828,14 +841,15 @@ void ADFun<Base>::abs_normal_fun(ADFun<Base>& g, ADFun<Base>& a) const
 
 	// Transferring the recording swaps its vectors so do this last
 	// replace the recording in g (this ADFun object)
-	g.play_.get(rec, n + s);
+	g.unshare_op_seq();
+	g.play_->get(rec, n + s);
 
 	// resize subgraph_info_
 	g.subgraph_info_.resize(
 		g.ind_taddr_.size(),   // n_ind
 		g.dep_taddr_.size(),   // n_dep
-		g.play_.num_op_rec(),  // n_op
-		g.play_.num_var_rec()  // n_var
+		g.play_->num_op_rec(),  // n_op
+		g.play_->num_var_rec()  // n_var
 	);
 
 	// ------------------------------------------------------------------------
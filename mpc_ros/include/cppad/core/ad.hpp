@@ -221,6 +221,7 @@ public:
 	inline AD fabs_me(void) const;
 	inline AD log_me(void) const;
 	inline AD sin_me(void) const;
+	inline void sincos_me(AD& s, AD& c) const;
 	inline AD sign_me(void) const;
 	inline AD sinh_me(void) const;
 	inline AD sqrt_me(void) const;
@@ -48,6 +48,7 @@ $childtable%
 
 $end
 */
+# include <memory>
 # include <cppad/local/subgraph/info.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
@@ -127,8 +128,9 @@ private:
 	/// (if zero, the operation corresponds to a parameter).
 	local::pod_vector<addr_t> load_op_;
 
-	/// the operation sequence corresponding to this object
-	local::player<Base> play_;
+	/// the operation sequence corresponding to this object,
+	/// possibly shared with other objects (see share_op_seq)
+	std::shared_ptr< local::player<Base> > play_;
 
 	/// Packed results of the forward mode Jacobian sparsity calculations.
 	/// for_jac_sparse_pack_.n_set() != 0  implies other sparsity results
@@ -149,6 +151,12 @@ private:
 	template <typename ADvector>
 	void Dependent(local::ADTape<Base> *tape, const ADvector &y);
 
+	/// give this object a player of its own before play_ is changed
+	void unshare_op_seq(void)
+	{	if( play_.use_count() > 1 )
+			play_.reset( new local::player<Base> );
+	}
+
 	// ------------------------------------------------------------
 	// vector of bool version of ForSparseJac
 	// (see doxygen in for_sparse_jac.hpp)
@@ -275,7 +283,7 @@ private:
 public:
 	/// copy constructor
 	ADFun(const ADFun& g)
-	: num_var_tape_(0)
+	: num_var_tape_(0), play_( new local::player<Base> )
 	{	CppAD::ErrorHandler::Call(
 		true,
 		__LINE__,
@@ -294,6 +302,14 @@ public:
 	// (see doxygen in fun_construct.hpp)
 	void operator=(const ADFun& f);
 
+	// assignment that shares the operation sequence of f
+	// (see doxygen in fun_construct.hpp)
+	void share_op_seq(const ADFun& f);
+
+	/// is the operation sequence shared with another object
+	bool op_seq_shared(void) const
+	{	return play_.use_count() > 1; }
+
 	/// sequence constructor
 	template <typename ADvector>
 	ADFun(const ADvector &x, const ADvector &y);
@@ -501,19 +517,19 @@ public:
 
 	/// number of operators in the operation sequence
 	size_t size_op(void) const
-	{	return play_.num_op_rec(); }
+	{	return play_->num_op_rec(); }
 
 	/// number of operator arguments in the operation sequence
 	size_t size_op_arg(void) const
-	{	return play_.num_op_arg_rec(); }
+	{	return play_->num_op_arg_rec(); }
 
 	/// amount of memory required for the operation sequence
 	size_t size_op_seq(void) const
-	{	return play_.Memory(); }
+	{	return play_->Memory(); }
 
 	/// number of parameters in the operation sequence
 	size_t size_par(void) const
-	{	return play_.num_par_rec(); }
+	{	return play_->num_par_rec(); }
 
 	/// number taylor coefficient orders calculated
 	size_t size_order(void) const
@@ -525,7 +541,7 @@ public:
 
 	/// number of characters in the operation sequence
 	size_t size_text(void) const
-	{	return play_.num_text_rec(); }
+	{	return play_->num_text_rec(); }
 
 	/// number of variables in opertion sequence
 	size_t size_var(void) const
@@ -533,7 +549,7 @@ public:
 
 	/// number of VecAD indices in the operation sequence
 	size_t size_VecAD(void) const
-	{	return play_.num_vec_ind_rec(); }
+	{	return play_->num_vec_ind_rec(); }
 
 	/// set number of orders currently allocated (user API)
 	void capacity_order(size_t c);
@@ -700,7 +716,7 @@ public:
 		+ for_jac_sparse_pack_.memory()
 		+ for_jac_sparse_set_.memory()
 		+ subgraph_info_.memory();
-		size_t total   = num_var_tape_  * pervar + play_.Memory();
+		size_t total   = num_var_tape_  * pervar + play_->Memory();
 		return total;
 	}
 
@@ -712,7 +728,7 @@ public:
 	/// Deprecated: Does this AD operation sequence use
 	/// VecAD<Base>::reference operands
 	bool use_VecAD(void) const
-	{	return play_.num_vec_ind_rec() > 0; }
+	{	return play_->num_vec_ind_rec() > 0; }
 
 	/// Deprecated: # taylor_ coefficient orders calculated
 	/// (per variable,direction)
@@ -732,6 +748,7 @@ public:
 # include <cppad/local/forward1sweep.hpp>
 # include <cppad/local/forward2sweep.hpp>
 # include <cppad/local/reverse_sweep.hpp>
+# include <cppad/local/hes_dir_sweep.hpp>
 # include <cppad/local/for_jac_sweep.hpp>
 # include <cppad/local/rev_jac_sweep.hpp>
 # include <cppad/local/rev_hes_sweep.hpp>
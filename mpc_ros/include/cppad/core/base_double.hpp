@@ -179,6 +179,16 @@ namespace CppAD {
 	{	return std::fabs(x); }
 }
 /* %$$
+The $code CppAD::sincos$$ function of $code AD<double>$$ has this
+counterpart so code templated on the scalar type can use it for both:
+$srccode%cpp% */
+namespace CppAD {
+	inline void sincos(const double& x, double& s, double& c)
+	{	s = std::sin(x);
+		c = std::cos(x);
+	}
+}
+/* %$$
 
 $head sign$$
 The following defines the $code CppAD::sign$$ function that
@@ -295,14 +295,15 @@ void ADFun<Base>::Dependent(local::ADTape<Base> *tape, const ADvector &y)
 	// Now that each dependent variable has a place in the tape,
 	// and there is a EndOp at the end of the tape, we can transfer the
 	// recording to the player and and erase the recording; i.e. ERASE Rec_.
-	play_.get(tape->Rec_, n);
+	unshare_op_seq();
+	play_->get(tape->Rec_, n);
 
 	// ind_taddr_
 	// Note that play_ has been set, we can use it to check operators
 	ind_taddr_.resize(n);
 	CPPAD_ASSERT_UNKNOWN( n < num_var_tape_);
 	for(j = 0; j < n; j++)
-	{	CPPAD_ASSERT_UNKNOWN( play_.GetOp(j+1) == local::InvOp );
+	{	CPPAD_ASSERT_UNKNOWN( play_->GetOp(j+1) == local::InvOp );
 		ind_taddr_[j] = j+1;
 	}
 
@@ -314,8 +315,8 @@ void ADFun<Base>::Dependent(local::ADTape<Base> *tape, const ADvector &y)
 	subgraph_info_.resize(
 		ind_taddr_.size(),   // n_dep
 		dep_taddr_.size(),   // n_ind
-		play_.num_op_rec(),  // n_op
-		play_.num_var_rec()  // n_var
+		play_->num_op_rec(),  // n_op
+		play_->num_var_rec()  // n_var
 	);
 	// ---------------------------------------------------------------------
 	// End set ad_fun.hpp private member data
@@ -325,7 +326,7 @@ void ADFun<Base>::Dependent(local::ADTape<Base> *tape, const ADvector &y)
 	AD<Base>::tape_manage(tape_manage_delete);
 
 	// total number of varables in this recording
-	CPPAD_ASSERT_UNKNOWN( num_var_tape_  == play_.num_var_rec() );
+	CPPAD_ASSERT_UNKNOWN( num_var_tape_  == play_->num_var_rec() );
 
 	// used to determine if there is an operation sequence in *this
 	CPPAD_ASSERT_UNKNOWN( num_var_tape_  > 0 );
@@ -192,7 +192,7 @@ void ADFun<Base>::for_hes_sparsity(
 		}
 		// forward Jacobian sparsity for all variables on tape
 		local::for_jac_sweep(
-			&play_,
+			play_.get(),
 			dependency,
 			n,
 			num_var_tape_,
@@ -208,7 +208,7 @@ void ADFun<Base>::for_hes_sparsity(
 		}
 		// reverse Jacobian sparsity for all variables on tape
 		local::rev_jac_sweep(
-			&play_,
+			play_.get(),
 			dependency,
 			n,
 			num_var_tape_,
@@ -220,7 +220,7 @@ void ADFun<Base>::for_hes_sparsity(
 		//
 		// compute forward Hessian sparsity pattern
 		local::for_hes_sweep(
-			&play_,
+			play_.get(),
 			n,
 			num_var_tape_,
 			internal_for_jac,
@@ -245,7 +245,7 @@ void ADFun<Base>::for_hes_sparsity(
 		}
 		// forward Jacobian sparsity for all variables on tape
 		local::for_jac_sweep(
-			&play_,
+			play_.get(),
 			dependency,
 			n,
 			num_var_tape_,
@@ -262,7 +262,7 @@ void ADFun<Base>::for_hes_sparsity(
 		}
 		// reverse Jacobian sparsity for all variables on tape
 		local::rev_jac_sweep(
-			&play_,
+			play_.get(),
 			dependency,
 			n,
 			num_var_tape_,
@@ -274,7 +274,7 @@ void ADFun<Base>::for_hes_sparsity(
 		//
 		// compute forward Hessian sparsity pattern
 		local::for_hes_sweep(
-			&play_,
+			play_.get(),
 			n,
 			num_var_tape_,
 			internal_for_jac,
@@ -245,7 +245,7 @@ void ADFun<Base>::for_jac_sparsity(
 
 		// compute sparsity for other variables
 		local::for_jac_sweep(
-			&play_,
+			play_.get(),
 			dependency,
 			n,
 			num_var_tape_,
@@ -275,7 +275,7 @@ void ADFun<Base>::for_jac_sparsity(
 
 		// compute sparsity for other variables
 		local::for_jac_sweep(
-			&play_,
+			play_.get(),
 			dependency,
 			n,
 			num_var_tape_,
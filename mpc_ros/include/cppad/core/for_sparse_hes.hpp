@@ -208,7 +208,7 @@ void ADFun<Base>::ForSparseHesCase(
 	for(size_t i = 0; i < n; i++)
 	{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[i] < n + 1 );
 		// ind_taddr_[i] is operator taddr for i-th independent variable
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[i] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[i] ) == local::InvOp );
 		//
 		// Use add_element when only adding one element per set is added.
 		if( r[i] )
@@ -217,7 +217,7 @@ void ADFun<Base>::ForSparseHesCase(
 	// compute forward Jacobiain sparsity pattern
 	bool dependency = false;
 	local::for_jac_sweep(
-		&play_,
+		play_.get(),
 		dependency,
 		n,
 		num_var_tape_,
@@ -236,7 +236,7 @@ void ADFun<Base>::ForSparseHesCase(
 	// compute reverse sparsity pattern for dependency analysis
 	// (note that we are only want non-zero derivatives not true dependency)
 	local::rev_jac_sweep(
-		&play_,
+		play_.get(),
 		dependency,
 		n,
 		num_var_tape_,
@@ -248,7 +248,7 @@ void ADFun<Base>::ForSparseHesCase(
 	//
 	// compute the Hessian sparsity patterns
 	local::for_hes_sweep(
-		&play_,
+		play_.get(),
 		n,
 		num_var_tape_,
 		for_jac_pattern,
@@ -266,7 +266,7 @@ void ADFun<Base>::ForSparseHesCase(
 	for(size_t i = 0; i < n; i++)
 	{	// ind_taddr_[i] is operator taddr for i-th independent variable
 		CPPAD_ASSERT_UNKNOWN( ind_taddr_[i] == i + 1 );
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[i] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[i] ) == local::InvOp );
 
 		// extract the result from for_hes_pattern
 		local::sparse_pack::const_iterator itr(for_hes_pattern, ind_taddr_[i] );
@@ -332,7 +332,7 @@ void ADFun<Base>::ForSparseHesCase(
 	{	size_t i = *itr_1++;
 		CPPAD_ASSERT_UNKNOWN( ind_taddr_[i] < n + 1 );
 		// ind_taddr_[i] is operator taddr for i-th independent variable
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[i] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[i] ) == local::InvOp );
 		//
 		// Use add_element when only adding one element per set is added.
 		for_jac_pattern.add_element( ind_taddr_[i], ind_taddr_[i] );
@@ -340,7 +340,7 @@ void ADFun<Base>::ForSparseHesCase(
 	// compute forward Jacobiain sparsity pattern
 	bool dependency = false;
 	local::for_jac_sweep(
-		&play_,
+		play_.get(),
 		dependency,
 		n,
 		num_var_tape_,
@@ -366,7 +366,7 @@ void ADFun<Base>::ForSparseHesCase(
 	// compute reverse sparsity pattern for dependency analysis
 	// (note that we are only want non-zero derivatives not true dependency)
 	local::rev_jac_sweep(
-		&play_,
+		play_.get(),
 		dependency,
 		n,
 		num_var_tape_,
@@ -379,7 +379,7 @@ void ADFun<Base>::ForSparseHesCase(
 	//
 	// compute the Hessian sparsity patterns
 	local::for_hes_sweep(
-		&play_,
+		play_.get(),
 		n,
 		num_var_tape_,
 		for_jac_pattern,
@@ -392,7 +392,7 @@ void ADFun<Base>::ForSparseHesCase(
 	CPPAD_ASSERT_UNKNOWN( for_hes_pattern.end() == n+1 );
 	for(size_t i = 0; i < n; i++)
 	{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[i] == i + 1 );
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[i] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[i] ) == local::InvOp );
 
 		// extract the result from for_hes_pattern
 		local::sparse_list::const_iterator itr_2(for_hes_pattern, ind_taddr_[i] );
@@ -475,13 +475,13 @@ is the base type for this recording.
 is a vector with size n that specifies the sparsity pattern
 for the diagonal of \f$ R \f$,
 where n is the number of independent variables
-corresponding to the operation sequence stored in play_.
+corresponding to the operation sequence stored in play_->
 
 \param s
 is a vector with size m that specifies the sparsity pattern
 for the vector \f$ S \f$,
 where m is the number of dependent variables
-corresponding to the operation sequence stored in play_.
+corresponding to the operation sequence stored in play_->
 
 \param h
 The input size and elements of h do not matter.
@@ -524,7 +524,7 @@ void ADFun<Base>::ForSparseHesCheckpoint(
 
 	// compute Hessian sparsity pattern for all variables
 	local::for_hes_sweep(
-		&play_,
+		play_.get(),
 		n,
 		num_var_tape_,
 		for_jac_sparse_set_,
@@ -544,7 +544,7 @@ void ADFun<Base>::ForSparseHesCheckpoint(
 
 		// ind_taddr_[j] is operator taddr for j-th independent variable
 		CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] == j + 1 );
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[j] ) == local::InvOp );
 
 		// extract the result from for_hes_pattern
 		CPPAD_ASSERT_UNKNOWN( for_hes_pattern.end() == q );
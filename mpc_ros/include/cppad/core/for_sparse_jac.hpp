@@ -288,7 +288,7 @@ void ADFun<Base>::ForSparseJacCase(
 	for(size_t i = 0; i < n; i++)
 	{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[i] < num_var_tape_ );
 		// ind_taddr_[i] is operator taddr for i-th independent variable
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[i] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[i] ) == local::InvOp );
 
 		// set bits that are true
 		if( transpose )
@@ -306,7 +306,7 @@ void ADFun<Base>::ForSparseJacCase(
 
 	// evaluate the sparsity patterns
 	local::for_jac_sweep(
-		&play_,
+		play_.get(),
 		dependency,
 		n,
 		num_var_tape_,
@@ -422,7 +422,7 @@ void ADFun<Base>::ForSparseJacCase(
 				CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_ );
 				// operator for j-th independent variable
 				CPPAD_ASSERT_UNKNOWN(
-					play_.GetOp( ind_taddr_[j] ) == local::InvOp
+					play_->GetOp( ind_taddr_[j] ) == local::InvOp
 				);
 				for_jac_sparse_set_.post_element( ind_taddr_[j], i);
 			}
@@ -432,7 +432,7 @@ void ADFun<Base>::ForSparseJacCase(
 	{	for(size_t i = 0; i < n; i++)
 		{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[i] < num_var_tape_ );
 			// ind_taddr_[i] is operator taddr for i-th independent variable
-			CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[i] ) == local::InvOp );
+			CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[i] ) == local::InvOp );
 
 			// add the elements that are present
 			itr_1 = r[i].begin();
@@ -453,7 +453,7 @@ void ADFun<Base>::ForSparseJacCase(
 
 	// evaluate the sparsity patterns
 	local::for_jac_sweep(
-		&play_,
+		play_.get(),
 		dependency,
 		n,
 		num_var_tape_,
@@ -664,7 +664,7 @@ void ADFun<Base>::ForSparseJacCheckpoint(
 	}
 	for(size_t j = 0; j < n; j++)
 	{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] == (j+1) );
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[j] ) == local::InvOp );
 	}
 # endif
 
@@ -702,7 +702,7 @@ void ADFun<Base>::ForSparseJacCheckpoint(
 
 	// evaluate the sparsity pattern for all variables
 	local::for_jac_sweep(
-		&play_,
+		play_.get(),
 		dependency,
 		n,
 		num_var_tape_,
@@ -141,7 +141,7 @@ VectorBase ADFun<Base>::Forward(
 	{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
 
 		// ind_taddr_[j] is operator taddr for j-th independent variable
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[j] ) == local::InvOp );
 
 		if( p == q )
 			taylor_[ C * ind_taddr_[j] + q] = xq[j];
@@ -152,10 +152,10 @@ VectorBase ADFun<Base>::Forward(
 	}
 
 	// evaluate the derivatives
-	CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
-	CPPAD_ASSERT_UNKNOWN( load_op_.size()  == play_.num_load_op_rec() );
+	CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_->num_op_rec() );
+	CPPAD_ASSERT_UNKNOWN( load_op_.size()  == play_->num_load_op_rec() );
 	if( q == 0 )
-	{	local::forward0sweep(&play_, s, true,
+	{	local::forward0sweep(play_.get(), s, true,
 			n, num_var_tape_, C,
 			taylor_.data(), cskip_op_.data(), load_op_,
 			compare_change_count_,
@@ -164,7 +164,7 @@ VectorBase ADFun<Base>::Forward(
 		);
 	}
 	else
-	{	local::forward1sweep(&play_, s, true, p, q,
+	{	local::forward1sweep(play_.get(), s, true, p, q,
 			n, num_var_tape_, C,
 			taylor_.data(), cskip_op_.data(), load_op_,
 			compare_change_count_,
@@ -372,7 +372,7 @@ VectorBase ADFun<Base>::Forward(
 	{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
 
 		// ind_taddr_[j] is operator taddr for j-th independent variable
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[j] ) == local::InvOp );
 
 		for(ell = 0; ell < r; ell++)
 		{	size_t index = ((c-1)*r + 1)*ind_taddr_[j] + (q-1)*r + ell + 1;
@@ -381,10 +381,10 @@ VectorBase ADFun<Base>::Forward(
 	}
 
 	// evaluate the derivatives
-	CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
-	CPPAD_ASSERT_UNKNOWN( load_op_.size()  == play_.num_load_op_rec() );
+	CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_->num_op_rec() );
+	CPPAD_ASSERT_UNKNOWN( load_op_.size()  == play_->num_load_op_rec() );
 	local::forward2sweep(
-		&play_,
+		play_.get(),
 		q,
 		r,
 		n,
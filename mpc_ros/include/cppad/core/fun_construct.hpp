@@ -248,7 +248,8 @@ check_for_nan_(true) ,
 compare_change_count_(1),
 compare_change_number_(0),
 compare_change_op_index_(0),
-num_var_tape_(0)
+num_var_tape_(0),
+play_( new local::player<Base> )
 { }
 
 /*!
@@ -303,8 +304,9 @@ void ADFun<Base>::operator=(const ADFun<Base>& f)
 	load_op_                   = f.load_op_;
 	subgraph_info_             = f.subgraph_info_;
 	//
-	// player
-	play_                      = f.play_;
+	// player, a copy of its own even if it shares the one of f
+	unshare_op_seq();
+	*play_                     = *f.play_;
 	//
 	// sparse_pack
 	for_jac_sparse_pack_.resize(0, 0);
@@ -341,6 +343,71 @@ void ADFun<Base>::operator=(const ADFun<Base>& f)
 	}
 }
 
+/*!
+ADFun assignment that shares the operation sequence
+
+The C++ syntax for this operation is
+\verbatim
+	g.share_op_seq(f)
+\endverbatim
+where \c g and \c f are ADFun<Base> ADFun objects.
+The player of \c f is shared with \c g instead of copied.
+The Taylor coefficients and the forward sparsity are not copied,
+\c g has its own and they start empty.
+The player is only read by the sweeps,
+so \c f and \c g can be evaluated by different threads at the same time.
+It must not be changed while it is shared;
+Dependent, optimize and the assignment operator
+give an object a player of its own first.
+The memory of the player is returned by the thread that drops the
+last object sharing it, which in parallel mode must be the thread
+that recorded it (see thread_alloc).
+
+\tparam Base
+is the base for the recording that can be stored in this ADFun object;
+i.e., operation sequences that were recorded using the type \c AD<Base>.
+
+\param f
+ADFun object containing the operation sequence to be shared.
+*/
+template <typename Base>
+void ADFun<Base>::share_op_seq(const ADFun<Base>& f)
+{	if( &f == this )
+		return;
+	//
+	// size_t objects
+	has_been_optimized_        = f.has_been_optimized_;
+	check_for_nan_             = f.check_for_nan_;
+	compare_change_count_      = f.compare_change_count_;
+	compare_change_number_     = 0;
+	compare_change_op_index_   = 0;
+	num_order_taylor_          = 0;
+	cap_order_taylor_          = 0;
+	num_direction_taylor_      = 0;
+	num_var_tape_              = f.num_var_tape_;
+	//
+	// CppAD::vector objects
+	ind_taddr_.resize( f.ind_taddr_.size() );
+	ind_taddr_                 = f.ind_taddr_;
+	dep_taddr_.resize( f.dep_taddr_.size() );
+	dep_taddr_                 = f.dep_taddr_;
+	dep_parameter_.resize( f.dep_parameter_.size() );
+	dep_parameter_             = f.dep_parameter_;
+	//
+	// pod_vector objects
+	taylor_.clear();
+	cskip_op_                  = f.cskip_op_;
+	load_op_                   = f.load_op_;
+	subgraph_info_             = f.subgraph_info_;
+	//
+	// player
+	play_                      = f.play_;
+	//
+	// sparse_pack, sparse_set
+	for_jac_sparse_pack_.resize(0, 0);
+	for_jac_sparse_set_.resize(0, 0);
+}
+
 /*!
 ADFun constructor from an operation sequence.
 
@@ -378,6 +445,7 @@ are stored in this ADFun object.
 template <typename Base>
 template <typename VectorAD>
 ADFun<Base>::ADFun(const VectorAD &x, const VectorAD &y)
+: play_( new local::player<Base> )
 {
 	CPPAD_ASSERT_KNOWN(
 		x.size() > 0,
@@ -439,9 +507,9 @@ ADFun<Base>::ADFun(const VectorAD &x, const VectorAD &y)
 	}
 
 	// use independent variable values to fill in values for others
-	CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
-	CPPAD_ASSERT_UNKNOWN( load_op_.size()  == play_.num_load_op_rec() );
-	local::forward0sweep(&play_, std::cout, false,
+	CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_->num_op_rec() );
+	CPPAD_ASSERT_UNKNOWN( load_op_.size()  == play_->num_load_op_rec() );
+	local::forward0sweep(play_.get(), std::cout, false,
 		n, num_var_tape_, cap_order_taylor_, taylor_.data(),
 		cskip_op_.data(), load_op_,
 		compare_change_count_,
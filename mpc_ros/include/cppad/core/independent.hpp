@@ -169,6 +169,27 @@ inline void Independent(VectorAD &x)
 {	size_t abort_op_index = 0;
 	Independent(x, abort_op_index);
 }
+/*!
+mpc_ros: storage for the next recording of this thread.
+
+A recording grows its operator, argument and parameter vectors from empty.
+When the size is known, e.g. for a model recorded again (size_op(),
+size_op_arg() and size_par() of its last recording, before optimize),
+the next Independent() of this thread reserves them up front and
+forgets the hint.
+
+\tparam Base
+base type of the next recording.
+*/
+template <typename Base>
+inline void RecordReserve(size_t n_op, size_t n_arg, size_t n_par)
+{	size_t* hint = local::recorder<Base>::reserve_hint(
+		thread_alloc::thread_num()
+	);
+	hint[0] = n_op;
+	hint[1] = n_arg;
+	hint[2] = n_par;
+}
 
 } // END_CPPAD_NAMESPACE
 
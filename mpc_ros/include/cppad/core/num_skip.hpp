@@ -84,20 +84,20 @@ size_t ADFun<Base>::number_skip(void)
 
 	// start playback
 	i_op = 0;
-	play_.get_op_info(i_op, op, arg, i_var);
+	play_->get_op_info(i_op, op, arg, i_var);
 	CPPAD_ASSERT_UNKNOWN(op == local::BeginOp)
 	while(op != local::EndOp)
 	{	// next op
-		play_.get_op_info(++i_op, op, arg, i_var);
+		play_->get_op_info(++i_op, op, arg, i_var);
 		//
 		if( op == local::UserOp )
 		{	// skip only appears at front or back UserOp of user atomic call
 			bool skip_call = cskip_op_[i_op];
-			play_.get_user_info(op, arg, user_old, user_m, user_n);
+			play_->get_user_info(op, arg, user_old, user_m, user_n);
 			CPPAD_ASSERT_UNKNOWN( NumRes(op) == 0 );
 			size_t num_op = user_m + user_n + 1;
 			for(size_t i = 0; i < num_op; i++)
-			{	play_.get_op_info(++i_op, op, arg, i_var);
+			{	play_->get_op_info(++i_op, op, arg, i_var);
 				if( skip_call )
 					num_var_skip += NumRes(op);
 			}
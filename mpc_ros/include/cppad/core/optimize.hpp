@@ -87,6 +87,14 @@ $cref PrintFor$$ operations will be removed form the optimized function.
 These operators are useful for reporting problems evaluating derivatives
 at independent variable values different from those used to record a function.
 
+$subhead no_fused_mul_op$$
+The product of two variables $icode%w% = %x% * %y%$$ whose only use is
+$icode%z% = %p% * %w%$$, with $icode p$$ a parameter, is recorded as one
+operator $icode%z% = %p% * (%x% * %y%)%$$ that does not compute $icode w$$;
+see the comments in $code local/optimize/optimize_run.hpp$$.
+If the sub-string $code no_fused_mul_op$$ appears in $icode options$$,
+the two operators are kept.
+
 $head Examples$$
 $children%
 	example/optimize/forward_active.cpp
@@ -216,6 +224,8 @@ template <class Base>
 void ADFun<Base>::optimize(const std::string& options)
 {	// place to store the optimized version of the recording
 	local::recorder<Base> rec;
+	// mpc_ros: the optimized recording is at most as large as this one
+	rec.reserve(play_->num_op_rec(), play_->num_op_arg_rec(), play_->num_par_rec());
 
 	// number of independent variables
 	size_t n = ind_taddr_.size();
@@ -228,7 +238,7 @@ void ADFun<Base>::optimize(const std::string& options)
 	if( check_zero_order )
 	{	// zero order coefficients for independent vars
 		for(j = 0; j < n; j++)
-		{	CPPAD_ASSERT_UNKNOWN( play_.GetOp(j+1) == local::InvOp );
+		{	CPPAD_ASSERT_UNKNOWN( play_->GetOp(j+1) == local::InvOp );
 			CPPAD_ASSERT_UNKNOWN( ind_taddr_[j]    == j+1   );
 			x[j] = taylor_[ ind_taddr_[j] * cap_order_taylor_ + 0];
 		}
@@ -247,13 +257,14 @@ void ADFun<Base>::optimize(const std::string& options)
 # endif
 
 	// create the optimized recording
-	local::optimize::optimize_run<Base>(options, n, dep_taddr_, &play_, &rec);
+	local::optimize::optimize_run<Base>(options, n, dep_taddr_, play_.get(), &rec);
 
 	// number of variables in the recording
 	num_var_tape_  = rec.num_var_rec();
 
 	// now replace the recording
-	play_.get(rec, n);
+	unshare_op_seq();
+	play_->get(rec, n);
 
 	// set flag so this function knows it has been optimized
 	has_been_optimized_ = true;
@@ -270,14 +281,14 @@ void ADFun<Base>::optimize(const std::string& options)
 
 	// resize and initilaize conditional skip vector
 	// (must use player size because it now has the recoreder information)
-	cskip_op_.resize( play_.num_op_rec() );
+	cskip_op_.resize( play_->num_op_rec() );
 
 	// resize subgraph_info_
 	subgraph_info_.resize(
 		ind_taddr_.size(),    // n_ind
 		dep_taddr_.size(),    // n_dep
-		play_.num_op_rec(),   // n_op
-		play_.num_var_rec()   // n_var
+		play_->num_op_rec(),   // n_op
+		play_->num_var_rec()   // n_var
 	);
 
 # ifndef NDEBUG
@@ -202,7 +202,7 @@ void ADFun<Base>::rev_hes_sparsity(
 		//
 		// compute the Hessian sparsity pattern
 		local::rev_hes_sweep(
-			&play_,
+			play_.get(),
 			n,
 			num_var_tape_,
 			for_jac_sparse_pack_,
@@ -231,7 +231,7 @@ void ADFun<Base>::rev_hes_sparsity(
 		//
 		// compute the Hessian sparsity pattern
 		local::rev_hes_sweep(
-			&play_,
+			play_.get(),
 			n,
 			num_var_tape_,
 			for_jac_sparse_set_,
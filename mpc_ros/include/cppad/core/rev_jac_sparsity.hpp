@@ -205,7 +205,7 @@ void ADFun<Base>::rev_jac_sparsity(
 
 		// compute sparsity for other variables
 		local::rev_jac_sweep(
-			&play_,
+			play_.get(),
 			dependency,
 			n,
 			num_var_tape_,
@@ -234,7 +234,7 @@ void ADFun<Base>::rev_jac_sparsity(
 
 		// compute sparsity for other variables
 		local::rev_jac_sweep(
-			&play_,
+			play_.get(),
 			dependency,
 			n,
 			num_var_tape_,
@@ -276,7 +276,7 @@ void ADFun<Base>::RevSparseHesCase(
 
 	// compute the Hessian sparsity patterns
 	local::rev_hes_sweep(
-		&play_,
+		play_.get(),
 		n,
 		num_var_tape_,
 		for_jac_sparse_pack_,
@@ -300,7 +300,7 @@ void ADFun<Base>::RevSparseHesCase(
 
 		// ind_taddr_[j] is operator taddr for j-th independent variable
 		CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] == j + 1 );
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[j] ) == local::InvOp );
 
 		// extract the result from rev_hes_pattern
 		CPPAD_ASSERT_UNKNOWN( rev_hes_pattern.end() == q );
@@ -405,7 +405,7 @@ void ADFun<Base>::RevSparseHesCase(
 
 	// compute the Hessian sparsity patterns
 	local::rev_hes_sweep(
-		&play_,
+		play_.get(),
 		n,
 		num_var_tape_,
 		for_jac_sparse_set_,
@@ -420,7 +420,7 @@ void ADFun<Base>::RevSparseHesCase(
 	for(j = 0; j < n; j++)
 	{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_ );
 		CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] == j + 1 );
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[j] ) == local::InvOp );
 
 		// extract the result from rev_hes_pattern
 		// and add corresponding elements to result sets in h
@@ -537,7 +537,7 @@ The value r in this call is a sparsity pattern for the matrix \f$ R \f$.
 is a vector with size m that specifies the sparsity pattern
 for the vector \f$ S \f$,
 where m is the number of dependent variables
-corresponding to the operation sequence stored in play_.
+corresponding to the operation sequence stored in play_->
 
 \param h
 The input size and elements of h do not matter.
@@ -579,7 +579,7 @@ void ADFun<Base>::RevSparseHesCheckpoint(
 
 	// compute Hessian sparsity pattern for all variables
 	local::rev_hes_sweep(
-		&play_,
+		play_.get(),
 		n,
 		num_var_tape_,
 		for_jac_sparse_set_,
@@ -599,7 +599,7 @@ void ADFun<Base>::RevSparseHesCheckpoint(
 
 		// ind_taddr_[j] is operator taddr for j-th independent variable
 		CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] == j + 1 );
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[j] ) == local::InvOp );
 
 		// extract the result from rev_hes_pattern
 		CPPAD_ASSERT_UNKNOWN( rev_hes_pattern.end() == q );
@@ -258,7 +258,7 @@ void ADFun<Base>::RevSparseJacCase(
 
 	// evaluate the sparsity patterns
 	local::rev_jac_sweep(
-		&play_,
+		play_.get(),
 		dependency,
 		n,
 		num_var_tape_,
@@ -271,7 +271,7 @@ void ADFun<Base>::RevSparseJacCase(
 	{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] == (j+1) );
 
 		// ind_taddr_[j] is operator taddr for j-th independent variable
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[j] ) == local::InvOp );
 
 		// extract the result from var_sparsity
 		if( transpose )
@@ -401,7 +401,7 @@ void ADFun<Base>::RevSparseJacCase(
 
 	// evaluate the sparsity patterns
 	local::rev_jac_sweep(
-		&play_,
+		play_.get(),
 		dependency,
 		n,
 		num_var_tape_,
@@ -415,7 +415,7 @@ void ADFun<Base>::RevSparseJacCase(
 	{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] == (j+1) );
 
 		// ind_taddr_[j] is operator taddr for j-th independent variable
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[j] ) == local::InvOp );
 
 		CPPAD_ASSERT_UNKNOWN( var_sparsity.end() == q );
 		local::sparse_list::const_iterator itr_2(var_sparsity, j+1);
@@ -593,7 +593,7 @@ void ADFun<Base>::RevSparseJacCheckpoint(
 
 	// evaluate the sparsity pattern for all variables
 	local::rev_jac_sweep(
-		&play_,
+		play_.get(),
 		dependency,
 		n,
 		num_var_tape_,
@@ -611,7 +611,7 @@ void ADFun<Base>::RevSparseJacCheckpoint(
 	{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] == (j+1) );
 
 		// ind_taddr_[j] is operator taddr for j-th independent variable
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[j] ) == local::InvOp );
 
 		// extract the result from var_sparsity
 		CPPAD_ASSERT_UNKNOWN( var_sparsity.end() == q );
@@ -152,13 +152,13 @@ VectorBase ADFun<Base>::Reverse(size_t q, const VectorBase &w)
 	}
 
 	// evaluate the derivatives
-	CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
-	CPPAD_ASSERT_UNKNOWN( load_op_.size()  == play_.num_load_op_rec() );
+	CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_->num_op_rec() );
+	CPPAD_ASSERT_UNKNOWN( load_op_.size()  == play_->num_load_op_rec() );
 	local::reverse_sweep(
 		q - 1,
 		n,
 		num_var_tape_,
-		&play_,
+		play_.get(),
 		cap_order_taylor_,
 		taylor_.data(),
 		q,
@@ -174,7 +174,7 @@ VectorBase ADFun<Base>::Reverse(size_t q, const VectorBase &w)
 	{	CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
 
 		// independent variable taddr equals its operator taddr
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp( ind_taddr_[j] ) == local::InvOp );
 
 		// by the Reverse Identity Theorem
 		// partial of y^{(k)} w.r.t. u^{(0)} is equal to
@@ -12,6 +12,12 @@ A copy of this license is included in the COPYING file of this distribution.
 Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
 -------------------------------------------------------------------------- */
 
+// maximum number of colors in one forward-over-reverse pass by default,
+// e.g. -DCPPAD_SPARSE_HESSIAN_MAX_MULTIPLE_DIRECTION=1 for one per color
+# ifndef CPPAD_SPARSE_HESSIAN_MAX_MULTIPLE_DIRECTION
+# define CPPAD_SPARSE_HESSIAN_MAX_MULTIPLE_DIRECTION 16
+# endif
+
 /*
 $begin sparse_hessian$$
 $spell
@@ -234,6 +240,24 @@ The $code colpack.star$$ method is deprecated.
 It is the same as the $code colpack.symmetric$$
 which should be used instead.
 
+$subhead group_max$$
+This field has prototype
+$codei%
+	size_t %work%.group_max
+%$$
+It is the maximum number of colors done in one multi-direction
+forward-over-reverse pass; i.e., one first order forward sweep and one
+second order reverse sweep that carry $icode group_max$$ directions,
+with all the directions of a variable stored next to each other.
+Each operator of the tape is then decoded once per pass instead of once
+per color, at the cost of $codei%4 * %group_max%$$ values per variable
+of work space.
+The default value (after a constructor or $code clear()$$) is
+$code CPPAD_SPARSE_HESSIAN_MAX_MULTIPLE_DIRECTION$$ (16 unless defined
+on the compiler command line); one is the pair of sweeps per color
+described under $cref/n_sweep/sparse_hessian/n_sweep/$$.
+The Hessian values do not depend on $icode group_max$$.
+
 $subhead p$$
 If $icode work$$ is present, and it is not the first call after
 its construction or a clear,
@@ -344,13 +368,19 @@ class sparse_hessian_work {
 		CppAD::vector<size_t> order;
 		/// results of the coloring algorithm
 		CppAD::vector<size_t> color;
+		/// maximum number of colors in one multi-direction pass
+		/// (this field is set by user)
+		size_t group_max;
 
 		/// constructor
-		sparse_hessian_work(void) : color_method("cppad.symmetric")
+		sparse_hessian_work(void)
+		: color_method("cppad.symmetric")
+		, group_max(CPPAD_SPARSE_HESSIAN_MAX_MULTIPLE_DIRECTION)
 		{ }
 		/// inform CppAD that this information needs to be recomputed
 		void clear(void)
 		{	color_method = "cppad.symmetric";
+			group_max    = CPPAD_SPARSE_HESSIAN_MAX_MULTIPLE_DIRECTION;
 			row.clear();
 			col.clear();
 			order.clear();
@@ -527,6 +557,58 @@ size_t ADFun<Base>::SparseHessianCompute(
 	for(ell = 0; ell < n; ell++) if( color[ell] < n )
 		n_color = std::max(n_color, color[ell] + 1);
 
+	// colors in groups, see hes_dir_sweep.hpp
+	if( work.group_max > 1 )
+	{	for(k = 0; k < K; k++)
+			hes[k] = zero;
+
+		// up to group_max colors in one pass of hes_dir_sweep
+		const size_t m   = dep_taddr_.size();
+		const size_t C   = (cap_order_taylor_ - 1) * num_direction_taylor_ + 1;
+		const size_t g   = std::min(work.group_max, n_color);
+		local::pod_vector<Base> dir_taylor(num_var_tape_ * 2 * g);
+		local::pod_vector<Base> dir_partial(num_var_tape_ * 2 * g);
+		k = 0;
+		for(size_t first = 0; first < n_color && k < K; first += g)
+		{	size_t r = std::min(g, n_color - first);
+
+			// zero order from Forward(0, x) above, one direction per color
+			for(i = 0; i < num_var_tape_; i++)
+			{	for(ell = 0; ell < r; ell++)
+				{	dir_taylor[ (i * r + ell) * 2 + 0 ] = taylor_[i * C];
+					dir_taylor[ (i * r + ell) * 2 + 1 ] = zero;
+					dir_partial[ (i * r + ell) * 2 + 0 ] = zero;
+					dir_partial[ (i * r + ell) * 2 + 1 ] = zero;
+				}
+			}
+			for(i = 0; i < n; i++)
+			if( first <= color[i] && color[i] < first + r )
+				dir_taylor[ (ind_taddr_[i] * r + color[i] - first) * 2 + 1 ] = one;
+			local::forward_hes_dir_sweep(
+				play_.get(), n, num_var_tape_, r, dir_taylor.data(),
+				cskip_op_.data(), load_op_
+			);
+
+			// w^T F'(x) u in every direction
+			for(i = 0; i < m; i++)
+				for(ell = 0; ell < r; ell++)
+					dir_partial[ (dep_taddr_[i] * r + ell) * 2 + 1 ] += w[i];
+			local::reverse_hes_dir_sweep(
+				play_.get(), n, num_var_tape_, r, dir_taylor.data(),
+				dir_partial.data(), cskip_op_.data(), load_op_
+			);
+
+			// set the components of the result with these colors
+			while( k < K && color[ row[ order[k] ] ] < first + r )
+			{	ell = color[ row[ order[k] ] ] - first;
+				hes[ order[k] ] =
+					dir_partial[ (ind_taddr_[ col[ order[k] ] ] * r + ell) * 2 ];
+				k++;
+			}
+		}
+		return n_color;
+	}
+
 	// direction vector for calls to forward (rows of the Hessian)
 	VectorBase u(n);
 
@@ -858,4 +940,5 @@ VectorBase ADFun<Base>::SparseHessian(const VectorBase &x, const VectorBase &w)
 }
 
 } // END_CPPAD_NAMESPACE
+# undef CPPAD_SPARSE_HESSIAN_MAX_MULTIPLE_DIRECTION
 # endif
@@ -12,10 +12,11 @@ A copy of this license is included in the COPYING file of this distribution.
 Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
 -------------------------------------------------------------------------- */
 
-// maximum number of sparse directions to compute at the same time
-
-// # define CPPAD_SPARSE_JACOBIAN_MAX_MULTIPLE_DIRECTION 1
+// maximum number of sparse directions to compute at the same time,
+// e.g. -DCPPAD_SPARSE_JACOBIAN_MAX_MULTIPLE_DIRECTION=1 for one per sweep
+# ifndef CPPAD_SPARSE_JACOBIAN_MAX_MULTIPLE_DIRECTION
 # define CPPAD_SPARSE_JACOBIAN_MAX_MULTIPLE_DIRECTION 64
+# endif
 
 /*
 $begin sparse_jacobian$$
@@ -530,6 +530,39 @@ namespace CppAD {
      CPPAD_STANDARD_MATH_UNARY_AD(tan, local::TanOp)
      CPPAD_STANDARD_MATH_UNARY_AD(tanh, local::TanhOp)
 
+	// sin(x) and cos(x) together: one SinOp, which computes cos(x) as its
+	// auxiliary result, and a SinCosOp that passes that result on as c
+	// instead of a CosOp evaluating it again
+	template <class Base>
+	inline void sincos(const AD<Base> &x, AD<Base> &s, AD<Base> &c)
+	{	x.sincos_me(s, c); }
+	template <class Base>
+	inline void AD<Base>::sincos_me (AD<Base> &s, AD<Base> &c) const
+	{
+		AD<Base> s_result, c_result;
+		s_result.value_ = CppAD::sin(value_);
+		c_result.value_ = CppAD::cos(value_);
+		CPPAD_ASSERT_UNKNOWN( Parameter(s_result) );
+		CPPAD_ASSERT_UNKNOWN( Parameter(c_result) );
+
+		if( Variable(*this) )
+		{	CPPAD_ASSERT_UNKNOWN( local::NumArg(local::SinOp) == 1 );
+			CPPAD_ASSERT_UNKNOWN( local::NumArg(local::SinCosOp) == 1 );
+			local::ADTape<Base> *tape = tape_this();
+			tape->Rec_.PutArg(taddr_);
+			s_result.taddr_   = tape->Rec_.PutOp(local::SinOp);
+			s_result.tape_id_ = tape->id_;
+			tape->Rec_.PutArg(s_result.taddr_);
+			c_result.taddr_   = tape->Rec_.PutOp(local::SinCosOp);
+			c_result.tape_id_ = tape->id_;
+		}
+		s = s_result;
+		c = c_result;
+	}
+	template <class Base>
+	inline void sincos(const VecAD_reference<Base> &x, AD<Base> &s, AD<Base> &c)
+	{	x.ADBase().sincos_me(s, c); }
+
 # if CPPAD_USE_CPLUSPLUS_2011
      CPPAD_STANDARD_MATH_UNARY_AD(asinh, local::AsinhOp)
      CPPAD_STANDARD_MATH_UNARY_AD(acosh, local::AcoshOp)
@@ -184,18 +184,18 @@ void ADFun<Base>::subgraph_reverse( const VectorBool& select_domain )
 
 	// map_user_op
 	if( subgraph_info_.map_user_op().size() == 0 )
-		subgraph_info_.set_map_user_op(&play_);
+		subgraph_info_.set_map_user_op(play_.get());
 	else
-	{	CPPAD_ASSERT_UNKNOWN( subgraph_info_.check_map_user_op(&play_) );
+	{	CPPAD_ASSERT_UNKNOWN( subgraph_info_.check_map_user_op(play_.get()) );
 	}
 	CPPAD_ASSERT_UNKNOWN(
-		subgraph_info_.map_user_op().size() == play_.num_op_rec()
+		subgraph_info_.map_user_op().size() == play_->num_op_rec()
 	);
 
 	// initialize for reverse mode subgraph computations
-	subgraph_info_.init_rev(&play_, select_domain);
+	subgraph_info_.init_rev(play_.get(), select_domain);
 	CPPAD_ASSERT_UNKNOWN(
-		subgraph_info_.in_subgraph().size() == play_.num_op_rec()
+		subgraph_info_.in_subgraph().size() == play_->num_op_rec()
 	);
 
 	return;
@@ -292,12 +292,12 @@ void ADFun<Base>::subgraph_reverse(
 	// subgraph of operators connected to dependent variable ell
 	pod_vector<addr_t> subgraph;
 	subgraph_info_.get_rev(
-		&play_, dep_taddr_, addr_t(ell), subgraph
+		play_.get(), dep_taddr_, addr_t(ell), subgraph
 	);
 
 	// Add all the atomic function call operators
 	// for calls that have first operator in the subgraph
-	local::subgraph::entire_call(&play_, subgraph);
+	local::subgraph::entire_call(play_.get(), subgraph);
 
 	// sort the subgraph
 	std::sort( subgraph.data(), subgraph.data() + subgraph.size() );
@@ -322,7 +322,7 @@ void ADFun<Base>::subgraph_reverse(
 		local::OpCode        op;
 		const addr_t*        arg;
 		size_t               i_var;
-		play_.get_op_info(i_op, op, arg, i_var);
+		play_->get_op_info(i_op, op, arg, i_var);
 		if( NumRes(op) == 0 )
 		{	CPPAD_ASSERT_UNKNOWN(
 				op == local::UserOp  ||
@@ -345,14 +345,14 @@ void ADFun<Base>::subgraph_reverse(
 	subgraph_partial_[ dep_taddr_[ell] * q + q - 1] = Base(1);
 
 	// evaluate the derivatives
-	CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
-	CPPAD_ASSERT_UNKNOWN( load_op_.size()  == play_.num_load_op_rec() );
+	CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_->num_op_rec() );
+	CPPAD_ASSERT_UNKNOWN( load_op_.size()  == play_->num_load_op_rec() );
 	size_t n = Domain();
 	local::reverse_sweep(
 		q - 1,
 		n,
 		num_var_tape_,
-		&play_,
+		play_.get(),
 		cap_order_taylor_,
 		taylor_.data(),
 		q,
@@ -380,10 +380,10 @@ void ADFun<Base>::subgraph_reverse(
 	dw.resize(n * q);
 	for(size_t c = 0; c < col_size; ++c)
 	{	size_t i_op = subgraph[c];
-		CPPAD_ASSERT_UNKNOWN( play_.GetOp(i_op) == local::InvOp );
+		CPPAD_ASSERT_UNKNOWN( play_->GetOp(i_op) == local::InvOp );
 		//
 		size_t j = i_op - 1;
-		CPPAD_ASSERT_UNKNOWN( i_op == play_.var2op(ind_taddr_[j]) );
+		CPPAD_ASSERT_UNKNOWN( i_op == play_->var2op(ind_taddr_[j]) );
 		//
 		// return paritial for this independent variable
 		col[c] = j;
@@ -175,7 +175,7 @@ void ADFun<Base>::subgraph_sparsity(
     local::pod_vector<size_t> row;
     local::pod_vector<size_t> col;
 	local::subgraph::subgraph_sparsity(
-		&play_,
+		play_.get(),
 		subgraph_info_,
 		dep_taddr_,
 		select_domain,
@@ -1,42 +0,0 @@
-# ifndef CPPAD_CORE_ARITHMETIC_HPP
-# define CPPAD_CORE_ARITHMETIC_HPP
-
-/* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
-
-CppAD is distributed under multiple licenses. This distribution is under
-the terms of the
-                    GNU General Public License Version 3.
-
-A copy of this license is included in the COPYING file of this distribution.
-Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
--------------------------------------------------------------------------- */
-
-/*
--------------------------------------------------------------------------------
-$begin Arithmetic$$
-$spell
-	Op
-	const
-$$
-
-
-
-$section AD Arithmetic Operators and Compound Assignments$$
-
-$childtable%
-	cppad/core/unary_plus.hpp%
-	cppad/core/unary_minus.hpp%
-	cppad/core/ad_binary.hpp%
-	cppad/core/compound_assign.hpp
-%$$
-
-$end
--------------------------------------------------------------------------------
-*/
-# include <cppad/core/unary_plus.hpp>
-# include <cppad/core/unary_minus.hpp>
-# include <cppad/core/ad_binary.hpp>
-# include <cppad/core/compound_assign.hpp>
-
-# endif
@@ -1,52 +0,0 @@
-// $Id$
-# ifndef CPPAD_CORE_CONVERT_HPP
-# define CPPAD_CORE_CONVERT_HPP
-
-/* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-16 Bradley M. Bell
-
-CppAD is distributed under multiple licenses. This distribution is under
-the terms of the
-                    GNU General Public License Version 3.
-
-A copy of this license is included in the COPYING file of this distribution.
-Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
--------------------------------------------------------------------------- */
-
-/*
-$begin Convert$$
-$spell
-$$
-
-
-$section Conversion and I/O of AD Objects$$
-$mindex convert from$$
-
-$children%
-	cppad/core/value.hpp%
-	cppad/core/integer.hpp%
-	cppad/core/ad_to_string.hpp%
-	cppad/core/ad_io.hpp%
-	cppad/core/print_for.hpp%
-	cppad/core/var2par.hpp
-%$$
-$table
-$rref Value$$
-$rref Integer$$
-$rref ad_output$$
-$rref PrintFor$$
-$rref Var2Par$$
-$tend
-
-
-$end
-*/
-
-# include <cppad/core/value.hpp>
-# include <cppad/core/integer.hpp>
-# include <cppad/core/ad_to_string.hpp>
-# include <cppad/core/ad_io.hpp>
-# include <cppad/core/print_for.hpp>
-# include <cppad/core/var2par.hpp>
-
-# endif
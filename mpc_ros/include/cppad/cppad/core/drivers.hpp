@@ -1,22 +0,0 @@
-# ifndef CPPAD_CORE_DRIVERS_HPP
-# define CPPAD_CORE_DRIVERS_HPP
-
-/* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
-
-CppAD is distributed under multiple licenses. This distribution is under
-the terms of the
-                    GNU General Public License Version 3.
-
-A copy of this license is included in the COPYING file of this distribution.
-Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
--------------------------------------------------------------------------- */
-
-# include <cppad/core/jacobian.hpp>
-# include <cppad/core/hessian.hpp>
-# include <cppad/core/for_one.hpp>
-# include <cppad/core/rev_one.hpp>
-# include <cppad/core/for_two.hpp>
-# include <cppad/core/rev_two.hpp>
-
-# endif
@@ -1,27 +0,0 @@
-# ifndef CPPAD_EXAMPLE_EIGEN_PLUGIN_HPP
-# define CPPAD_EXAMPLE_EIGEN_PLUGIN_HPP
-/* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
-
-CppAD is distributed under multiple licenses. This distribution is under
-the terms of the
-                    GNU General Public License Version 3.
-
-A copy of this license is included in the COPYING file of this distribution.
-Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
--------------------------------------------------------------------------- */
-/*$
-$begin eigen_plugin.hpp$$
-$spell
-	eigen_plugin.hpp
-	typedef
-$$
-
-$section Source Code for eigen_plugin.hpp$$
-$srccode%cpp% */
-// Declaration needed, before eigen-3.3.3, so Eigen vector is a simple vector
-typedef Scalar value_type;
-/* %$$
-$end
-*/
-# endif
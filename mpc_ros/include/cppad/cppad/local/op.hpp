@@ -1,60 +0,0 @@
-// $Id: op.hpp 3876 2017-02-10 12:45:08Z bradbell $
-# ifndef CPPAD_LOCAL_OP_HPP
-# define CPPAD_LOCAL_OP_HPP
-
-/* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
-
-CppAD is distributed under multiple licenses. This distribution is under
-the terms of the
-                    GNU General Public License Version 3.
-
-A copy of this license is included in the COPYING file of this distribution.
-Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
--------------------------------------------------------------------------- */
-
-// used by the sparse operators
-# include <cppad/local/sparse_internal.hpp>
-
-// operations
-# include <cppad/core/std_math_98.hpp>
-# include <cppad/local/abs_op.hpp>
-# include <cppad/local/add_op.hpp>
-# include <cppad/local/acos_op.hpp>
-# include <cppad/local/acosh_op.hpp>
-# include <cppad/local/asin_op.hpp>
-# include <cppad/local/asinh_op.hpp>
-# include <cppad/local/atan_op.hpp>
-# include <cppad/local/atanh_op.hpp>
-# include <cppad/local/comp_op.hpp>
-# include <cppad/local/cond_op.hpp>
-# include <cppad/local/cos_op.hpp>
-# include <cppad/local/cosh_op.hpp>
-# include <cppad/local/cskip_op.hpp>
-# include <cppad/local/csum_op.hpp>
-# include <cppad/local/discrete_op.hpp>
-# include <cppad/local/div_op.hpp>
-# include <cppad/local/erf_op.hpp>
-# include <cppad/local/exp_op.hpp>
-# include <cppad/local/expm1_op.hpp>
-# include <cppad/local/load_op.hpp>
-# include <cppad/local/log_op.hpp>
-# include <cppad/local/log1p_op.hpp>
-# include <cppad/local/mul_op.hpp>
-# include <cppad/local/parameter_op.hpp>
-# include <cppad/local/pow_op.hpp>
-# include <cppad/local/print_op.hpp>
-# include <cppad/local/sign_op.hpp>
-# include <cppad/local/sin_op.hpp>
-# include <cppad/local/sinh_op.hpp>
-# include <cppad/local/sqrt_op.hpp>
-# include <cppad/local/sub_op.hpp>
-# include <cppad/local/sparse_binary_op.hpp>
-# include <cppad/local/sparse_unary_op.hpp>
-# include <cppad/local/store_op.hpp>
-# include <cppad/local/tan_op.hpp>
-# include <cppad/local/tanh_op.hpp>
-# include <cppad/local/zmul_op.hpp>
-
-
-# endif
@@ -112,6 +112,17 @@ If the value is $code false$$, $code ipopt::solve$$
 will tape the operation sequence at the value
 of $icode xi$$ and use that sequence for the entire optimization process.
 The default value is $code false$$.
+$subhead Optimize$$
+You can control the optimization of the operation sequence
+(when retape is false) with the following syntax:
+$codei%
+	Optimize %value%
+%$$
+If the value is $code false$$ the operation sequence is not optimized,
+if it is $code true$$ it is optimized with the default options.
+Any other value is one of the $cref/options/optimize/options/$$
+of $code optimize$$, several lines add up.
+The default value is $code true$$.
 $subhead Sparse$$
 You can set the sparse Jacobian and Hessian flag with the following syntax:
 $codei%
@@ -137,6 +148,21 @@ $codei%
 	%value% == true && %direction% == reverse
 %$$
 the Jacobians will be calculated using $code SparseJacobianReverse$$.
+If
+$codei%
+	%value% == true && %direction% == subgraph
+%$$
+the Jacobians will be calculated by $cref subgraph_reverse$$ on the
+subgraph of each row, without a coloring; Hessians as for reverse.
+$subhead Coloring$$
+You can choose the coloring of the sparse Hessian with the following syntax:
+$codei%
+	Coloring %method%
+%$$
+where $icode method$$ is one of the
+$cref/color_method/sparse_hessian/work/color_method/$$ values of
+$code sparse_hessian$$; $code colpack.symmetric$$ requires ColPack.
+The default is $code cppad.symmetric$$.
 $subhead String$$
 You can set any Ipopt string option using a line with the following syntax:
 $codei%
@@ -451,6 +477,10 @@ void solve(
 	bool retape          = false;
 	bool sparse_forward  = false;
 	bool sparse_reverse  = false;
+	bool sparse_subgraph = false;
+	std::string hes_coloring;
+	bool optimize        = true;
+	std::string optimize_options;
 	while( begin_1 < options.size() )
 	{	// split this line into tokens
 		while( options[begin_1] == ' ')
@@ -505,22 +535,38 @@ void solve(
 			);
 			retape = (tok_2 == "true");
 		}
+		else if( tok_1 == "Optimize" )
+		{	if( tok_2 == "false" )
+				optimize = false;
+			else if( tok_2 == "true" )
+				optimize = true;
+			else
+			{	optimize = true;
+				if( optimize_options.size() > 0 )
+					optimize_options += " ";
+				optimize_options += tok_2;
+			}
+		}
+		else if( tok_1 == "Coloring" )
+			hes_coloring = tok_2;
 		else if( tok_1 == "Sparse" )
 		{	CPPAD_ASSERT_KNOWN(
 				(tok_2 == "true") | (tok_2 == "false") ,
 				"ipopt::solve: Sparse value is not true or false"
 			);
 			CPPAD_ASSERT_KNOWN(
-				(tok_3 == "forward") | (tok_3 == "reverse") ,
-				"ipopt::solve: Sparse direction is not forward or reverse"
+				(tok_3 == "forward") | (tok_3 == "reverse") | (tok_3 == "subgraph") ,
+				"ipopt::solve: Sparse direction is not forward, reverse or subgraph"
 			);
 			if( tok_2 == "false" )
-			{	sparse_forward = false;
-				sparse_reverse = false;
+			{	sparse_forward  = false;
+				sparse_reverse  = false;
+				sparse_subgraph = false;
 			}
 			else
-			{	sparse_forward = tok_3 == "forward";
-				sparse_reverse = tok_3 == "reverse";
+			{	sparse_forward  = tok_3 == "forward";
+				sparse_subgraph = tok_3 == "subgraph";
+				sparse_reverse  = (tok_3 == "reverse") | sparse_subgraph;
 			}
 		}
 		else if ( tok_1 == "String" )
@@ -536,7 +582,7 @@ void solve(
 		else	CPPAD_ASSERT_KNOWN(
 			false,
 			"ipopt::solve: First token is not one of\n"
-			"Retape, Sparse, String, Numeric, Integer"
+			"Retape, Optimize, Coloring, Sparse, String, Numeric, Integer"
 		);
 
 		begin_1 = end_3;
@@ -579,7 +625,11 @@ void solve(
 		retape,
 		sparse_forward,
 		sparse_reverse,
-		solution
+		solution,
+		optimize,
+		optimize_options,
+		sparse_subgraph,
+		hes_coloring
 	);
 
 	// Run the IpoptApplication
@@ -16,6 +16,7 @@ Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
 # include <coin/IpIpoptApplication.hpp>
 # include <coin/IpTNLP.hpp>
 # include <cppad/ipopt/solve_result.hpp>
+# include "trace_span.h" // mpc_ros
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 namespace ipopt {
@@ -82,6 +83,13 @@ private:
 	/// Should sparse methods be used to compute Jacobians and Hessians
 	/// with reverse mode used for Jacobian.
 	bool                            sparse_reverse_;
+	/// should the tape be optimized (when retape is false)
+	bool                            optimize_;
+	/// options of the optimize call
+	std::string                     optimize_options_;
+	/// Should the Jacobian of g(x) be computed by reverse mode on the
+	/// subgraph of each row instead of by coloring (implies sparse_reverse_).
+	bool                            sparse_subgraph_;
 	/// final results are returned to this structure
 	solve_result<Dvector>&          solution_;
 	// ------------------------------------------------------------------
@@ -113,6 +121,8 @@ private:
 	CppAD::vector<size_t>           col_order_jac_;
 	/// Work vector used by SparseJacobian, stored here to avoid recalculation.
 	CppAD::sparse_jacobian_work     work_jac_;
+	/// One row of the Jacobian, used by the subgraph method (zero between calls).
+	Dvector                         jac_row_;
 	// ----------------------------------------------------------------------
 	// Hessian information
 	// ----------------------------------------------------------------------
@@ -133,6 +143,26 @@ private:
 	// Private member functions
 	// ------------------------------------------------------------------
 	/*!
+	mpc_ros: [size_op, size_op_arg, size_par] of the last recording of
+	this FG_eval by a thread, reserved by the next solve of the thread.
+	Zero-initialized before any thread runs.
+	*/
+	static size_t* last_recording(size_t thread)
+	{	static size_t last[CPPAD_MAX_NUM_THREADS][3];
+		return last[thread];
+	}
+	/*!
+	mpc_ros: entries of the Hessian pattern of the last solve with this
+	FG_eval by a thread, zero before the first. The next solve computes its
+	patterns with sets if that Hessian had fewer entries per row than
+	vectorBool units, and the rows more than two units (see
+	sparsity_patterns.h in mpc_ros), bit-packed otherwise.
+	*/
+	static size_t& last_hes_nnz(size_t thread)
+	{	static size_t last[CPPAD_MAX_NUM_THREADS];
+		return last[thread];
+	}
+	/*!
 	Cache information for a new value of x.
 
 	\param x
@@ -160,6 +190,10 @@ private:
 			{	x0_[i] = x[i];
 				a_x[i] = x[i];
 			}
+			// mpc_ros: same model as the last recording
+			CppAD::RecordReserve<double>(
+				adfun_.size_op(), adfun_.size_op_arg(), adfun_.size_par()
+			);
 			CppAD::Independent(a_x);
 			fg_eval_(a_fg, a_x);
 			adfun_.Dependent(a_x, a_fg);
@@ -217,6 +251,19 @@ public:
 
 	\param solution
 	object where final results are stored.
+
+	\param optimize
+	should the tape be optimized when retape is false.
+
+	\param optimize_options
+	options passed to ADFun::optimize.
+
+	\param sparse_subgraph
+	should the Jacobian of g(x) be computed with subgraph_reverse
+	(requires sparse_reverse).
+
+	\param hes_coloring
+	color_method of the sparse Hessian work, empty for the default.
 	*/
 	solve_callback(
 		size_t                 nf              ,
@@ -231,7 +278,11 @@ public:
 		bool                   retape          ,
 		bool                   sparse_forward  ,
 		bool                   sparse_reverse  ,
-		solve_result<Dvector>& solution ) :
+		solve_result<Dvector>& solution        ,
+		bool                   optimize = true ,
+		const std::string&     optimize_options = "" ,
+		bool                   sparse_subgraph = false ,
+		const std::string&     hes_coloring = "" ) :
 	nf_ ( nf ),
 	nx_ ( nx ),
 	ng_ ( ng ),
@@ -244,7 +295,10 @@ public:
 	retape_ ( retape ),
 	sparse_forward_ ( sparse_forward ),
 	sparse_reverse_ ( sparse_reverse ),
-	solution_ ( solution )
+	solution_ ( solution ),
+	optimize_ ( optimize ),
+	optimize_options_ ( optimize_options ),
+	sparse_subgraph_ ( sparse_subgraph )
 	{	CPPAD_ASSERT_UNKNOWN( ! ( sparse_forward_ & sparse_reverse_ ) );
 
 		size_t i, j;
@@ -263,20 +317,51 @@ public:
 			ADvector a_x(nx_), a_fg(nfg);
 			for(i = 0; i < nx_; i++)
 				a_x[i] = xi_[i];
+			// mpc_ros: as large as the recording of the last solve with
+			// this FG_eval on this thread
+			size_t* last = last_recording( CppAD::thread_alloc::thread_num() );
+			CppAD::RecordReserve<double>(last[0], last[1], last[2]);
 			CppAD::Independent(a_x);
 			fg_eval_(a_fg, a_x);
 			adfun_.Dependent(a_x, a_fg);
+			last[0] = adfun_.size_op();
+			last[1] = adfun_.size_op_arg();
+			last[2] = adfun_.size_par();
 			// optimize because we will make repeated use of this tape
-			adfun_.optimize();
+			if( optimize_ )
+				adfun_.optimize(optimize_options_);
 		}
 		if( sparse_forward_ | sparse_reverse_ )
 		{	CPPAD_ASSERT_UNKNOWN( ! retape );
 			size_t m = nf_ + ng_;
 			//
 			// -----------------------------------------------------------
+			// mpc_ros: sets for a long sparse model
+			size_t& hes_nnz = last_hes_nnz(
+				CppAD::thread_alloc::thread_num()
+			);
+			size_t n_unit = (nx_ - 1) / vectorBool::bit_per_unit() + 1;
+			bool use_set = n_unit > 2 && hes_nnz > 0 &&
+				hes_nnz < n_unit * nx_;
+			// -----------------------------------------------------------
 			// Jacobian
 			pattern_jac_.resize( m * nx_ );
-			if( nx_ <= m )
+			if( use_set )
+			{	// the forward pattern is the Jacobian, and is kept for the
+				// Hessian below
+				std::vector< std::set<size_t> > r(nx_), s;
+				for(i = 0; i < nx_; i++)
+					r[i].insert(i);
+				s = adfun_.ForSparseJac(nx_, r);
+				for(i = 0; i < m * nx_; i++)
+					pattern_jac_[i] = false;
+				for(i = 0; i < m; i++)
+				{	std::set<size_t>::const_iterator itr;
+					for(itr = s[i].begin(); itr != s[i].end(); itr++)
+						pattern_jac_[i * nx_ + *itr] = true;
+				}
+			}
+			else if( nx_ <= m )
 			{	// use forward mode to compute sparsity
 
 				// number of bits that are packed into one unit in vectorBool
@@ -364,45 +449,63 @@ public:
 			// -----------------------------------------------------------
 			// Hessian
 			pattern_hes_.resize(nx_ * nx_);
+			if( use_set )
+			{	std::vector< std::set<size_t> > s(1), h;
+				for(i = 0; i < m; i++)
+					s[0].insert(i);
+				h = adfun_.RevSparseHes(nx_, s);
+				adfun_.size_forward_set(0);
+				for(i = 0; i < nx_ * nx_; i++)
+					pattern_hes_[i] = false;
+				for(i = 0; i < nx_; i++)
+				{	std::set<size_t>::const_iterator itr;
+					for(itr = h[i].begin(); itr != h[i].end(); itr++)
+						pattern_hes_[i * nx_ + *itr] = true;
+				}
+			}
+			else
+			{	// number of bits that are packed into one unit in vectorBool
+				size_t n_column = vectorBool::bit_per_unit();
 
-			// number of bits that are packed into one unit in vectorBool
-			size_t n_column = vectorBool::bit_per_unit();
-
-			// sparsity patterns for current columns
-			vectorBool r(nx_ * n_column), h(nx_ * n_column);
+				// sparsity patterns for current columns
+				vectorBool r(nx_ * n_column), h(nx_ * n_column);
 
-			// sparsity pattern for range space of function
-			vectorBool s(m);
-			for(i = 0; i < m; i++)
-				s[i] = true;
+				// sparsity pattern for range space of function
+				vectorBool s(m);
+				for(i = 0; i < m; i++)
+					s[i] = true;
 
-			// compute the sparsity pattern n_column columns at a time
-			size_t n_loop = (nx_ - 1) / n_column + 1;
-			for(size_t i_loop = 0; i_loop < n_loop; i_loop++)
-			{	// starting column index for this iteration
-				size_t i_column = i_loop * n_column;
+				// compute the sparsity pattern n_column columns at a time
+				size_t n_loop = (nx_ - 1) / n_column + 1;
+				for(size_t i_loop = 0; i_loop < n_loop; i_loop++)
+				{	// starting column index for this iteration
+					size_t i_column = i_loop * n_column;
 
-				// pattern that picks out the appropriate columns
-				for(i = 0; i < nx_; i++)
-				{	for(j = 0; j < n_column; j++)
-						r[i * n_column + j] = (i == i_column + j);
-				}
-				adfun_.ForSparseJac(n_column, r);
+					// pattern that picks out the appropriate columns
+					for(i = 0; i < nx_; i++)
+					{	for(j = 0; j < n_column; j++)
+							r[i * n_column + j] = (i == i_column + j);
+					}
+					adfun_.ForSparseJac(n_column, r);
 
-				// sparsity pattern corresponding to paritls w.r.t. (theta, u)
-				// of partial w.r.t. the selected columns
-				bool transpose = true;
-				h = adfun_.RevSparseHes(n_column, s, transpose);
+					// sparsity pattern corresponding to paritls w.r.t. (theta, u)
+					// of partial w.r.t. the selected columns
+					bool transpose = true;
+					h = adfun_.RevSparseHes(n_column, s, transpose);
 
-				// fill in the corresponding columns of total_sparsity
-				for(i = 0; i < nx_; i++)
-				{	for(j = 0; j < n_column; j++)
-					{	if( i_column + j < nx_ )
-							pattern_hes_[i * nx_ + i_column + j] =
-								h[i * n_column + j];
+					// fill in the corresponding columns of total_sparsity
+					for(i = 0; i < nx_; i++)
+					{	for(j = 0; j < n_column; j++)
+						{	if( i_column + j < nx_ )
+								pattern_hes_[i * nx_ + i_column + j] =
+									h[i * n_column + j];
+						}
 					}
 				}
 			}
+			hes_nnz = 0;
+			for(i = 0; i < nx_ * nx_; i++)
+				hes_nnz += pattern_hes_[i];
 			// Set row and column indices for Lower triangle of Hessian
 			// of Lagragian.  These indices are in row major order.
 			for(i = 0; i < nx_; i++)
@@ -437,6 +540,15 @@ public:
 		// Column order indirect sort of the Jacobian indices
 		col_order_jac_.resize( col_jac_.size() );
 		index_sort( col_jac_, col_order_jac_ );
+
+		CPPAD_ASSERT_UNKNOWN( ! sparse_subgraph_ || sparse_reverse_ );
+		if( hes_coloring.size() > 0 )
+			work_hes_.color_method = hes_coloring;
+		if( sparse_subgraph_ )
+		{	jac_row_.resize(nx_);
+			for(j = 0; j < nx_; j++)
+				jac_row_[j] = 0.0;
+		}
 	}
 	// -----------------------------------------------------------------------
 	/*!
@@ -628,6 +740,7 @@ public:
 		bool           new_x       ,
 		Number&        obj_value   )
 	{	size_t i;
+		MPC_TRACE_SPAN("eval_f"); // mpc_ros: see trace_span.h
 		if( new_x )
 			cache_new_x(x);
 		//
@@ -667,6 +780,7 @@ public:
 		bool            new_x    ,
 		Number*         grad_f   )
 	{	size_t i;
+		MPC_TRACE_SPAN("eval_grad_f"); // mpc_ros: see trace_span.h
 		if( new_x )
 			cache_new_x(x);
 		//
@@ -714,6 +828,7 @@ public:
 		Index   m            ,
 		Number* g            )
 	{	size_t i;
+		MPC_TRACE_SPAN("eval_g"); // mpc_ros: see trace_span.h
 		if( new_x )
 			cache_new_x(x);
 		//
@@ -790,6 +905,7 @@ public:
 
 		Number* values)
 	{	size_t i, j, k, ell;
+		MPC_TRACE_SPAN("eval_jac_g"); // mpc_ros: see trace_span.h
 		CPPAD_ASSERT_UNKNOWN(static_cast<size_t>(m)         == ng_ );
 		CPPAD_ASSERT_UNKNOWN(static_cast<size_t>(n)         == nx_ );
 		//
@@ -821,6 +937,29 @@ public:
 			for(k = 0; k < nk; k++)
 				values[k] = jac[k];
 		}
+		else if( sparse_subgraph_ )
+		{	// reverse sweep over the subgraph of each row, at the
+			// zero order coefficients left by cache_new_x
+			CppAD::vector<bool> select_domain(nx_);
+			for(j = 0; j < nx_; j++)
+				select_domain[j] = true;
+			adfun_.subgraph_reverse(select_domain);
+			CppAD::vector<size_t> dw_col;
+			Dvector dw;
+			k = 0;
+			while( k < nk )
+			{	i = row_jac_[k];
+				adfun_.subgraph_reverse(1, i, dw_col, dw);
+				for(ell = 0; ell < dw_col.size(); ell++)
+					jac_row_[ dw_col[ell] ] = dw[ dw_col[ell] ];
+				while( k < nk && row_jac_[k] == i )
+				{	values[k] = jac_row_[ col_jac_[k] ];
+					k++;
+				}
+				for(ell = 0; ell < dw_col.size(); ell++)
+					jac_row_[ dw_col[ell] ] = 0.0;
+			}
+		}
 		else if( sparse_reverse_ )
 		{	Dvector jac(nk);
 			adfun_.SparseJacobianReverse(
@@ -970,6 +1109,7 @@ public:
 		Index*        jCol           ,
 		Number*       values         )
 	{	size_t i, j, k;
+		MPC_TRACE_SPAN("eval_h"); // mpc_ros: see trace_span.h
 		CPPAD_ASSERT_UNKNOWN(static_cast<size_t>(m) == ng_ );
 		CPPAD_ASSERT_UNKNOWN(static_cast<size_t>(n) == nx_ );
 		//
@@ -58,7 +58,7 @@ inline void forward_atan_op(
 
 	size_t k;
 	if( p == 0 )
-	{	z[0] = atan( x[0] );
+	{	z[0] = math_atan( x[0] );
 		b[0] = Base(1.0) + x[0] * x[0];
 		p++;
 	}
@@ -157,7 +157,7 @@ inline void forward_atan_op_0(
 	Base* z = taylor + i_z * cap_order;
 	Base* b = z      -       cap_order; // called y in documentation
 
-	z[0] = atan( x[0] );
+	z[0] = math_atan( x[0] );
 	b[0] = Base(1.0) + x[0] * x[0];
 }
 /*!
@@ -61,8 +61,7 @@ inline void forward_cos_op(
 	// (except that there is a sign difference for the hyperbolic case).
 	size_t k;
 	if( p == 0 )
-	{	s[0] = sin( x[0] );
-		c[0] = cos( x[0] );
+	{	math_sincos(x[0], s[0], c[0]);
 		p++;
 	}
 	for(size_t j = p; j <= q; j++)
@@ -118,6 +117,15 @@ inline void forward_cos_op_dir(
 	// rest of this routine is identical for the following cases:
 	// forward_sin_op, forward_cos_op, forward_sinh_op, forward_cosh_op
 	// (except that there is a sign difference for the hyperbolic case).
+	if( q == 1 )
+	{	// first order (sparse Jacobians), contiguous in the directions
+		Base s0 = s[0], c0 = c[0];
+		for(size_t ell = 1; ell <= r; ell++)
+		{	s[ell] =   x[ell] * c0;
+			c[ell] = - x[ell] * s0;
+		}
+		return;
+	}
 	size_t m = (q-1) * r + 1;
 	for(size_t ell = 0; ell < r; ell++)
 	{	s[m+ell] =   Base(double(q)) * x[m + ell] * c[0];
@@ -163,8 +171,7 @@ inline void forward_cos_op_0(
 	Base* c = taylor + i_z * cap_order;  // called z in documentation
 	Base* s = c      -       cap_order;  // called y in documentation
 
-	c[0] = cos( x[0] );
-	s[0] = sin( x[0] );
+	math_sincos(x[0], s[0], c[0]);
 }
 /*!
 Compute reverse mode partial derivatives for result of op = CosOp.
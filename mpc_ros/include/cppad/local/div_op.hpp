@@ -104,6 +104,13 @@ inline void forward_divvv_op_dir(
 
 	// Using CondExp, it can make sense to divide by zero,
 	// so do not make it an error.
+	if( q == 1 )
+	{	// first order (sparse Jacobians), contiguous in the directions
+		Base z0 = z[0], y0 = y[0];
+		for(size_t ell = 1; ell <= r; ell++)
+			z[ell] = (x[ell] - z0 * y[ell]) / y0;
+		return;
+	}
 	size_t m = (q-1) * r + 1;
 	for(size_t ell = 0; ell < r; ell++)
 	{	z[m+ell] = x[m+ell] - z[0] * y[m+ell];
@@ -296,6 +303,13 @@ inline void forward_divpv_op_dir(
 
 	// Using CondExp, it can make sense to divide by zero,
 	// so do not make it an error.
+	if( q == 1 )
+	{	// first order (sparse Jacobians), contiguous in the directions
+		Base z0 = z[0], y0 = y[0];
+		for(size_t ell = 1; ell <= r; ell++)
+			z[ell] = - z0 * y[ell] / y0;
+		return;
+	}
 	size_t m = (q-1) * r + 1;
 	for(size_t ell = 0; ell < r; ell++)
 	{	z[m+ell] = - z[0] * y[m+ell];
@@ -0,0 +1,162 @@
+# ifndef CPPAD_LOCAL_FAST_MATH_HPP
+# define CPPAD_LOCAL_FAST_MATH_HPP
+
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
+
+CppAD is distributed under multiple licenses. This distribution is under
+the terms of the
+                    GNU General Public License Version 3.
+
+A copy of this license is included in the COPYING file of this distribution.
+Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
+-------------------------------------------------------------------------- */
+
+# include <cmath>
+
+/*!
+\file fast_math.hpp
+Zero order values of sin, cos and atan in the forward sweeps.
+
+With CPPAD_FAST_MATH set to 1 the sweeps of a double tape take them from
+inline polynomial kernels instead of libm calls: Cody-Waite reduction to
+[-pi/4, pi/4] and the Cephes polynomials for sin and cos, which come out
+of one reduction together (SinOp, CosOp and SinCosOp need both), and
+the Cephes rational approximation of atan. The kernels have no calls and
+no data dependent branches inside the reduced range, so the lanes of
+simd_double vectorize. Outside |x| < CPPAD_FAST_MATH_MAX_REDUCE sin and
+cos fall back to libm; sincos_reduced() is the kernel without that test,
+for loops that test the range once for all their angles (AnalyticSolver).
+
+Error, measured against long double over random and near-k*pi/2 x:
+sin and cos are within 1.6 ulp of the exact value below |x| < 1e4 and
+2.5 ulp up to the range limit, and 2 ulp of glibc's (4 near the limit).
+The absolute error stays below 2e-16 in the whole range, so next to the
+zeros of the result (x close to a multiple of pi / 2) the error relative
+to the tiny result grows well past that, the three part pi / 2 is not
+precise enough there. atan is within 1 ulp of the exact value and of
+glibc's. This is not the 0.5 ulp of libm, so compare the solutions, not
+the bits, with and without CPPAD_FAST_MATH.
+
+The higher orders are computed from these zero order values by the usual
+recursions, sin' = cos from the same kernel and atan' = 1 / (1 + x * x),
+so the derivatives are those of the functions to within the same error.
+*/
+
+# ifndef CPPAD_FAST_MATH
+# define CPPAD_FAST_MATH 0
+# endif
+
+// The three part split of pi / 2 keeps j * pi / 2 exact up to here
+# define CPPAD_FAST_MATH_MAX_REDUCE 1e8
+
+namespace CppAD { namespace fast_math { // BEGIN_CPPAD_FAST_MATH_NAMESPACE
+
+/// s = sin(x), c = cos(x) for |x| < CPPAD_FAST_MATH_MAX_REDUCE; no
+/// branches, so that loops over it vectorize
+inline void sincos_reduced(double x, double& s, double& c)
+{	// nearest multiple j of pi / 2, rounded by adding 1.5 * 2^52
+	const double shift = 6755399441055744.0;
+	const double j     = (x * 0.63661977236758134308 + shift) - shift;
+	const double r     = ( (x - j * 1.57079625129699707031)
+	                     - j * 7.54978941586159635336e-8 )
+	                     - j * 5.3903028581581190529e-15;
+	const double z     = r * r;
+	const double sr    = r + r * z * ((((( 1.58962301576546568060e-10 * z
+		- 2.50507477628578072866e-8) * z
+		+ 2.75573136213857245213e-6) * z
+		- 1.98412698295895385996e-4) * z
+		+ 8.33333333332211858878e-3) * z
+		- 1.66666666666666307295e-1);
+	const double cr    = 1.0 - 0.5 * z + z * z * ((((( -1.13585365213876817300e-11 * z
+		+ 2.08757008419747316778e-9) * z
+		- 2.75573141792967388112e-7) * z
+		+ 2.48015872888517045348e-5) * z
+		- 1.38888888888730564116e-3) * z
+		+ 4.16666666666665929218e-2);
+	// quadrant: x = r + j * pi / 2, q = j mod 4 in [-2, 2], in doubles
+	// (there is no vector double to int64 conversion before AVX-512)
+	const double q    = j - 4.0 * ((j * 0.25 + shift) - shift);
+	const bool   odd  = q == 1.0 || q == -1.0;
+	const double ss   = odd ? cr : sr;
+	const double cc   = odd ? sr : cr;
+	s = (q == 2.0 || q == -2.0 || q == -1.0) ? -ss : ss;
+	c = (q == 1.0 || q == 2.0 || q == -2.0) ? -cc : cc;
+}
+
+/// s = sin(x), c = cos(x)
+inline void sincos(double x, double& s, double& c)
+{	if( ! (std::fabs(x) < CPPAD_FAST_MATH_MAX_REDUCE) )
+	{	s = std::sin(x);
+		c = std::cos(x);
+		return;
+	}
+	sincos_reduced(x, s, c);
+}
+
+/// sin(x)
+inline double sin(double x)
+{	double s, c;
+	sincos(x, s, c);
+	return s;
+}
+
+/// cos(x)
+inline double cos(double x)
+{	double s, c;
+	sincos(x, s, c);
+	return c;
+}
+
+/// atan(x)
+inline double atan(double x)
+{	const double a    = std::fabs(x);
+	// atan(a) = y + atan(t) with |t| <= 0.66
+	const bool   big  = a > 2.41421356237309504880;  // tan(3 pi / 8)
+	const bool   mid  = ! big && a > 0.66;
+	const double t    = big ? -1.0 / a : mid ? (a - 1.0) / (a + 1.0) : a;
+	const double y    = big ? 1.57079632679489661923 : mid ? 0.78539816339744830962 : 0.0;
+	const double more = big ? 6.123233995736765886130e-17 : mid ? 3.061616997868382943065e-17 : 0.0;
+	const double z    = t * t;
+	const double p    = ((( -8.750608600031904122785e-1 * z
+		- 1.615753718733365076637e1) * z
+		- 7.500855792314704667340e1) * z
+		- 1.228866684490136173410e2) * z
+		- 6.485021904942025371773e1;
+	const double d    = (((( z
+		+ 2.485846490142306297962e1) * z
+		+ 1.650270098316988542046e2) * z
+		+ 4.328810604912902668951e2) * z
+		+ 4.853903996359136964868e2) * z
+		+ 1.945506571482613964425e2;
+	const double r    = y + (t * z * p / d + t + more);
+	return x < 0.0 ? -r : r;
+}
+
+} } // END_CPPAD_FAST_MATH_NAMESPACE
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+
+/// zero order sin and cos of the SinOp, CosOp and SinCosOp sweeps
+template <class Base>
+inline void math_sincos(const Base& x, Base& s, Base& c)
+{	s = sin(x);
+	c = cos(x);
+}
+
+/// zero order atan of the AtanOp sweeps
+template <class Base>
+inline Base math_atan(const Base& x)
+{	return atan(x); }
+
+# if CPPAD_FAST_MATH
+inline void math_sincos(const double& x, double& s, double& c)
+{	fast_math::sincos(x, s, c); }
+
+inline double math_atan(const double& x)
+{	return fast_math::atan(x); }
+# endif
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+
+# endif
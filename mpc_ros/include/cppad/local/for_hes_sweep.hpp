@@ -243,6 +243,7 @@ void for_hes_sweep(
 			case ExpOp:
 			case LogOp:
 			case SinOp:
+			case SinCosOp:
 			case SinhOp:
 			case SqrtOp:
 			case TanOp:
@@ -325,6 +326,15 @@ void for_hes_sweep(
 			break;
 			// -------------------------------------------------
 
+			case MulpvvOp:
+			CPPAD_ASSERT_NARG_NRES(op, 3, 1)
+			// the variables are arg[1] and arg[2]
+			forward_sparse_hessian_mul_op(
+				arg + 1, for_jac_sparse, for_hes_sparse
+			);
+			break;
+			// -------------------------------------------------
+
 			case PowpvOp:
 			CPPAD_ASSERT_NARG_NRES(op, 2, 3)
 			forward_sparse_hessian_nonlinear_unary_op(
@@ -442,6 +442,15 @@ void for_jac_sweep(
 			break;
 			// -------------------------------------------------
 
+			case MulpvvOp:
+			CPPAD_ASSERT_NARG_NRES(op, 3, 1);
+			// the variables are arg[1] and arg[2]
+			forward_sparse_jacobian_binary_op(
+				i_var, arg + 1, var_sparsity
+			);
+			break;
+			// -------------------------------------------------
+
 			case ParOp:
 			CPPAD_ASSERT_NARG_NRES(op, 1, 1);
 			var_sparsity.clear(i_var);
@@ -497,6 +506,15 @@ void for_jac_sweep(
 			break;
 			// -------------------------------------------------
 
+			case SinCosOp:
+			// cos(x) of the SinOp at arg[0], which has the sparsity of x
+			CPPAD_ASSERT_NARG_NRES(op, 1, 1);
+			forward_sparse_jacobian_unary_op(
+				i_var, arg[0], var_sparsity
+			);
+			break;
+			// -------------------------------------------------
+
 			case SinhOp:
 			// cosh(x), sinh(x)
 			CPPAD_ASSERT_NARG_NRES(op, 1, 2);
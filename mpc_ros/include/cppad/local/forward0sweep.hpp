@@ -585,6 +585,12 @@ void forward0sweep(
 			break;
 			// -------------------------------------------------
 
+			case MulpvvOp:
+			CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+			forward_mulpvv_op_0(i_var, arg, parameter, J, taylor);
+			break;
+			// -------------------------------------------------
+
 			case NepvOp:
 			if( compare_change_count )
 			{	forward_nepv_op_0(
@@ -654,6 +660,13 @@ void forward0sweep(
 			break;
 			// -------------------------------------------------
 
+			case SinCosOp:
+			// cos(x) of the SinOp at arg[0]
+			CPPAD_ASSERT_UNKNOWN( i_var < numvar  );
+			forward_sincos_op_0(i_var, arg[0], J, taylor);
+			break;
+			// -------------------------------------------------
+
 			case SinhOp:
 			// cosh(x), sinh(x)
 			CPPAD_ASSERT_UNKNOWN( i_var < numvar  );
@@ -678,6 +678,12 @@ void forward1sweep(
 			break;
 			// -------------------------------------------------
 
+			case MulpvvOp:
+			CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+			forward_mulpvv_op(p, q, i_var, arg, parameter, J, taylor);
+			break;
+			// -------------------------------------------------
+
 			case NepvOp:
 			if( ( p == 0 ) & ( compare_change_count > 0 ) )
 			{	forward_nepv_op_0(
@@ -753,6 +759,13 @@ void forward1sweep(
 			break;
 			// -------------------------------------------------
 
+			case SinCosOp:
+			// cos(x) of the SinOp at arg[0]
+			CPPAD_ASSERT_UNKNOWN( i_var < numvar  );
+			forward_sincos_op(p, q, i_var, arg[0], J, taylor);
+			break;
+			// -------------------------------------------------
+
 			case SinhOp:
 			// cosh(x), sinh(x)
 			CPPAD_ASSERT_UNKNOWN( i_var < numvar  );
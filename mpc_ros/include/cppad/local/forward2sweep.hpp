@@ -445,6 +445,12 @@ void forward2sweep(
 			break;
 			// -------------------------------------------------
 
+			case MulpvvOp:
+			CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+			forward_mulpvv_op_dir(q, r, i_var, arg, parameter, J, taylor);
+			break;
+			// -------------------------------------------------
+
 			case ParOp:
 			k = i_var*(J-1)*r + i_var + (q-1)*r + 1;
 			for(ell = 0; ell < r; ell++)
@@ -488,6 +494,13 @@ void forward2sweep(
 			break;
 			// -------------------------------------------------
 
+			case SinCosOp:
+			// cos(x) of the SinOp at arg[0]
+			CPPAD_ASSERT_UNKNOWN( i_var < numvar  );
+			forward_sincos_op_dir(q, r, i_var, arg[0], J, taylor);
+			break;
+			// -------------------------------------------------
+
 			case SinhOp:
 			// cosh(x), sinh(x)
 			CPPAD_ASSERT_UNKNOWN( i_var < numvar  );
@@ -563,6 +576,7 @@ void forward2sweep(
 				user_atom->set_old(user_old);
 				for(ell = 0; ell < r; ell++)
 				{	// set user_tx
+					bool zero_dir = q == 1;
 					for(j = 0; j < user_n; j++)
 					{	size_t j_all     = j * (q * r + 1);
 						size_t j_one     = j * user_q1;
@@ -572,6 +586,19 @@ void forward2sweep(
 							size_t k_one       = j_one + k;
 							user_tx_one[k_one] = user_tx_all[k_all];
 						}
+						zero_dir &= IdenticalZero( user_tx_one[j_one+1] );
+					}
+					if( zero_dir )
+					{	// first order is linear in the direction; most
+						// colors of a sparse Jacobian do not reach the
+						// arguments of this call
+						for(i = 0; i < user_m; i++)
+						{	if( user_iy[i] > 0 )
+							{	size_t i_taylor = user_iy[i]*((J-1)*r+1);
+								taylor[i_taylor + 1 + ell] = Base(0.0);
+							}
+						}
+						continue;
 					}
 					// set user_ty
 					for(i = 0; i < user_m; i++)
@@ -77,7 +77,7 @@ hash coded and zero is returned:
 
 \li unary operators:
 AbsOp, AcosOp, AcoshOp, AsinOp, AsinhOp, AtanOp, AtanhOp, CosOp, CoshOp
-ExpOp, Expm1Op, LogOp, Log1pOp, SinOp, SinhOp, SqrtOp, TanOp, TanhOp
+ExpOp, Expm1Op, LogOp, Log1pOp, SinOp, SinCosOp, SinhOp, SqrtOp, TanOp, TanhOp
 
 \li binary operators where first argument is a parameter:
 AddpvOp, DivpvOp, MulpvOp, PowpvOp, SubpvOp, ZmulpvOp
@@ -91,6 +91,9 @@ DisOp
 \li binary operators where both arguments are variables:
 AddvvOp, DivvvOp, MulvvOp, PowvvOp, SubvvOp, ZmulvvOp
 
+\li parameter times the product of two variables:
+MulpvvOp
+
 \param arg
 is a vector of length \c NumArg(op) or 2 (which ever is smaller),
 containing the corresponding argument indices for this operator.
@@ -176,6 +179,19 @@ unsigned short local_hash_code(
 			code += v[i];
 		break;
 
+		// Parameter times the product of two variables
+		case MulpvvOp:
+		CPPAD_ASSERT_UNKNOWN( NumArg(op) == 3 );
+		v = reinterpret_cast<const unsigned short*>(par + arg[0]);
+		i = short_base;
+		while(i--)
+			code += v[i];
+		v = reinterpret_cast<const unsigned short*>(arg + 1);
+		i = 2 * short_addr_t;
+		while(i--)
+			code += v[i];
+		break;
+
 		// Binary operator where first argument is an index and
 		// second is a variable (same as both variables).
 		case DisOp:
@@ -227,6 +243,7 @@ unsigned short local_hash_code(
 		case Log1pOp:
 		case SignOp:
 		case SinOp:
+		case SinCosOp:
 		case SinhOp:
 		case SqrtOp:
 		case TanOp:
@@ -0,0 +1,945 @@
+# ifndef CPPAD_LOCAL_HES_DIR_SWEEP_HPP
+# define CPPAD_LOCAL_HES_DIR_SWEEP_HPP
+
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
+
+CppAD is distributed under multiple licenses. This distribution is under
+the terms of the
+                    GNU General Public License Version 3.
+
+A copy of this license is included in the COPYING file of this distribution.
+Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
+-------------------------------------------------------------------------- */
+
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+\file hes_dir_sweep.hpp
+First order forward and second order reverse in r directions at once,
+the forward-over-reverse pair that SparseHessian does once per color.
+
+The coefficients of all the directions of a variable are stored next to
+each other:
+<code>taylor[ (i * r + ell) * 2 + k ]</code>
+is the k-th order Taylor coefficient of variable i in direction ell
+(the zero order coefficient is the same in every direction) and
+<code>partial[ (i * r + ell) * 2 + k ]</code>
+is the corresponding partial.
+Direction ell of this layout is the single direction layout with
+<code>cap_order = nc_partial = 2 * r</code> starting at
+<code>taylor + 2 * ell</code>, so each operator applies the order one
+kernels of forward1sweep and reverse_sweep to every direction in turn while
+its arguments are decoded only once.
+*/
+
+/*
+\def CPPAD_HES_DIR_FORWARD
+Apply the forward kernel call to every direction,
+taylor is the single direction view of direction ell.
+*/
+# define CPPAD_HES_DIR_FORWARD(call)              \
+	for(size_t ell = 0; ell < r; ell++)          \
+	{	Base* taylor = Taylor + 2 * ell;         \
+		call;                                    \
+	}
+
+/*
+\def CPPAD_HES_DIR_REVERSE
+Apply the reverse kernel call to every direction,
+taylor and partial are the single direction views of direction ell.
+*/
+# define CPPAD_HES_DIR_REVERSE(call)             \
+	for(size_t ell = 0; ell < r; ell++)          \
+	{	const Base* taylor  = Taylor + 2 * ell;  \
+		Base*       partial = Partial + 2 * ell; \
+		call;                                    \
+	}
+
+/*!
+First order forward mode in r directions.
+
+\param play
+is the recording; Forward(0) has been done on it, which set
+cskip_op and var_by_load_op.
+
+\param r
+is the number of directions.
+
+\param Taylor
+\b Input: the zero order coefficients of every variable and direction,
+and the first order coefficients of the independent variables.
+\n
+\b Output: the first order coefficients of the other variables.
+*/
+template <class Base>
+void forward_hes_dir_sweep(
+	const local::player<Base>* play,
+	size_t                     n,
+	size_t                     numvar,
+	size_t                     r,
+	Base*                      Taylor,
+	const bool*                cskip_op,
+	const pod_vector<addr_t>&  var_by_load_op
+)
+{	CPPAD_ASSERT_UNKNOWN( play->num_var_rec() == numvar );
+	CPPAD_ASSERT_UNKNOWN( r > 0 );
+
+	// single direction kernels, order one
+	const size_t p = 1;
+	const size_t q = 1;
+	const size_t J = 2 * r;
+
+	const size_t num_par = play->num_par_rec();
+	const Base* parameter = CPPAD_NULL;
+	if( num_par > 0 )
+		parameter = play->GetPar();
+
+	// work space used by UserOp
+	vector<bool>   user_vx;        // empty vecotor
+	vector<bool>   user_vy;        // empty vecotor
+	vector<size_t> user_ix;        // variable index of arguments, 0 for parameter
+	vector<size_t> user_iy;        // variable index of results, 0 for parameter
+	vector<Base>   user_tx;        // argument vector Taylor coefficients
+	vector<Base>   user_ty;        // result vector Taylor coefficients
+	atomic_base<Base>* user_atom = CPPAD_NULL;
+# ifndef NDEBUG
+	bool user_ok = false;
+# endif
+	size_t user_old=0, user_m=0, user_n=0, user_i=0, user_j=0;
+	enum_user_state user_state = start_user;
+
+	OpCode        op;
+	size_t        i_op = 0;
+	size_t        i_var;
+	const addr_t* arg = CPPAD_NULL;
+	play->get_op_info(i_op, op, arg, i_var);
+	CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+
+	bool more_operators = true;
+	while(more_operators)
+	{	play->get_op_info(++i_op, op, arg, i_var);
+		CPPAD_ASSERT_UNKNOWN( i_op < play->num_op_rec() );
+
+		// same skipping as forward1sweep
+		while( cskip_op[i_op] )
+		{	if( op == UserOp )
+			{	play->get_user_info(op, arg, user_old, user_m, user_n);
+				i_op += user_m + user_n;
+				play->get_op_info(++i_op, op, arg, i_var);
+				CPPAD_ASSERT_UNKNOWN( op == UserOp );
+			}
+			play->get_op_info(++i_op, op, arg, i_var);
+			CPPAD_ASSERT_UNKNOWN( i_op < play->num_op_rec() );
+		}
+
+		switch( op )
+		{
+			case AbsOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_abs_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+			case AddvvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_addvv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case AddpvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_addpv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case AcosOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_acos_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case AcoshOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_acosh_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+# endif
+
+			case AsinOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_asin_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case AsinhOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_asinh_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+# endif
+
+			case AtanOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_atan_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case AtanhOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_atanh_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+# endif
+
+			case CExpOp:
+			CPPAD_HES_DIR_FORWARD( forward_cond_op(
+				p, q, i_var, arg, num_par, parameter, J, taylor
+			) )
+			break;
+
+			case CosOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_cos_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+			case CoshOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_cosh_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+			case CSumOp:
+			CPPAD_HES_DIR_FORWARD( forward_csum_op(
+				p, q, i_var, arg, num_par, parameter, J, taylor
+			) )
+			break;
+
+			case DisOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_dis_op(p, q, 1, i_var, arg, J, taylor) )
+			break;
+
+			case DivvvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_divvv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case DivpvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_divpv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case DivvpOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_divvp_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case EndOp:
+			more_operators = false;
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case ErfOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_erf_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+# endif
+
+			case ExpOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_exp_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case Expm1Op:
+			CPPAD_HES_DIR_FORWARD(
+				forward_expm1_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+# endif
+
+			case LdpOp:
+			case LdvOp:
+			CPPAD_HES_DIR_FORWARD( forward_load_op(
+				play, op, p, q, 1, J, i_var, arg, var_by_load_op.data(), taylor
+			) )
+			break;
+
+			case LogOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_log_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case Log1pOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_log1p_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+# endif
+
+			case MulpvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_mulpv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case MulvvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_mulvv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case MulpvvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_mulpvv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case ParOp:
+			for(size_t ell = 0; ell < r; ell++)
+				Taylor[ (i_var * r + ell) * 2 + 1 ] = Base(0.0);
+			break;
+
+			case PowvpOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_powvp_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case PowpvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_powpv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case PowvvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_powvv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case SignOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_sign_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+			case SinOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_sin_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+			case SinCosOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_sincos_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+			case SinhOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_sinh_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+			case SqrtOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_sqrt_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+			case SubvvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_subvv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case SubpvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_subpv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case SubvpOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_subvp_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case TanOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_tan_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+			case TanhOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_tanh_op(p, q, i_var, arg[0], J, taylor) )
+			break;
+
+			case ZmulpvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_zmulpv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case ZmulvpOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_zmulvp_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case ZmulvvOp:
+			CPPAD_HES_DIR_FORWARD(
+				forward_zmulvv_op(p, q, i_var, arg, parameter, J, taylor) )
+			break;
+
+			case UserOp:
+			user_atom = play->get_user_info(op, arg, user_old, user_m, user_n);
+			if( user_state == start_user )
+			{	user_state = arg_user;
+				user_i     = 0;
+				user_j     = 0;
+				user_ix.resize(user_n);
+				user_iy.resize(user_m);
+				user_tx.resize(user_n * 2);
+				user_ty.resize(user_m * 2);
+			}
+			else
+			{	CPPAD_ASSERT_UNKNOWN( user_state == end_user );
+				user_state = start_user;
+				user_atom->set_old(user_old);
+				// the atomic function sees one direction at a time
+				for(size_t ell = 0; ell < r; ell++)
+				{	for(size_t j = 0; j < user_n; j++) if( user_ix[j] > 0 )
+					{	size_t index = (user_ix[j] * r + ell) * 2;
+						user_tx[j * 2 + 0] = Taylor[index + 0];
+						user_tx[j * 2 + 1] = Taylor[index + 1];
+					}
+					for(size_t i = 0; i < user_m; i++) if( user_iy[i] > 0 )
+						user_ty[i * 2 + 0] = Taylor[ (user_iy[i] * r + ell) * 2 ];
+# ifdef NDEBUG
+					user_atom->forward(p, q, user_vx, user_vy, user_tx, user_ty);
+# else
+					user_ok = user_atom->forward(
+						p, q, user_vx, user_vy, user_tx, user_ty
+					);
+					if( ! user_ok )
+					{	std::string msg =
+							user_atom->afun_name()
+							+ ": atomic_base.forward: returned false";
+						CPPAD_ASSERT_KNOWN(false, msg.c_str() );
+					}
+# endif
+					for(size_t i = 0; i < user_m; i++) if( user_iy[i] > 0 )
+						Taylor[ (user_iy[i] * r + ell) * 2 + 1 ] = user_ty[i * 2 + 1];
+				}
+			}
+			break;
+
+			case UsrapOp:
+			CPPAD_ASSERT_UNKNOWN( user_state == arg_user );
+			CPPAD_ASSERT_UNKNOWN( user_j < user_n );
+			user_ix[user_j]         = 0;
+			user_tx[user_j * 2 + 0] = parameter[ arg[0] ];
+			user_tx[user_j * 2 + 1] = Base(0.0);
+			++user_j;
+			if( user_j == user_n )
+				user_state = ret_user;
+			break;
+
+			case UsravOp:
+			CPPAD_ASSERT_UNKNOWN( user_state == arg_user );
+			CPPAD_ASSERT_UNKNOWN( user_j < user_n );
+			user_ix[user_j] = arg[0];
+			++user_j;
+			if( user_j == user_n )
+				user_state = ret_user;
+			break;
+
+			case UsrrpOp:
+			CPPAD_ASSERT_UNKNOWN( user_state == ret_user );
+			CPPAD_ASSERT_UNKNOWN( user_i < user_m );
+			user_iy[user_i]         = 0;
+			user_ty[user_i * 2 + 0] = parameter[ arg[0] ];
+			++user_i;
+			if( user_i == user_m )
+				user_state = end_user;
+			break;
+
+			case UsrrvOp:
+			CPPAD_ASSERT_UNKNOWN( user_state == ret_user );
+			CPPAD_ASSERT_UNKNOWN( user_i < user_m );
+			user_iy[user_i] = i_var;
+			++user_i;
+			if( user_i == user_m )
+				user_state = end_user;
+			break;
+
+			// no first order action
+			case BeginOp:
+			case CSkipOp:
+			case InvOp:
+			case EqpvOp:
+			case EqvvOp:
+			case LtpvOp:
+			case LtvpOp:
+			case LtvvOp:
+			case LepvOp:
+			case LevpOp:
+			case LevvOp:
+			case NepvOp:
+			case NevvOp:
+			case PriOp:
+			case StppOp:
+			case StpvOp:
+			case StvpOp:
+			case StvvOp:
+			break;
+
+			default:
+			CPPAD_ASSERT_UNKNOWN(false);
+		}
+	}
+	CPPAD_ASSERT_UNKNOWN( user_state == start_user );
+}
+
+/*!
+Second order reverse mode in r directions, after forward_hes_dir_sweep.
+
+\param Partial
+\b Input: the partials with respect to the dependent variables,
+zero for the other variables.
+\n
+\b Output: <code>Partial[ (i * r + ell) * 2 + 0 ]</code> is, for an
+independent variable i, the derivative of
+the weighted first order coefficient of the range in direction ell,
+i.e. what <code>Reverse(2, w)</code> returns in <code>dw[j * 2 + 1]</code>.
+*/
+template <class Base>
+void reverse_hes_dir_sweep(
+	const local::player<Base>* play,
+	size_t                     n,
+	size_t                     numvar,
+	size_t                     r,
+	const Base*                Taylor,
+	Base*                      Partial,
+	const bool*                cskip_op,
+	const pod_vector<addr_t>&  var_by_load_op
+)
+{	CPPAD_ASSERT_UNKNOWN( play->num_var_rec() == numvar );
+	CPPAD_ASSERT_UNKNOWN( r > 0 );
+
+	// single direction kernels, derivative of the first order
+	const size_t d = 1;
+	const size_t J = 2 * r;
+	const size_t K = 2 * r;
+
+	const size_t num_par = play->num_par_rec();
+	const Base* parameter = CPPAD_NULL;
+	if( num_par > 0 )
+		parameter = play->GetPar();
+
+	// work space used by UserOp
+	vector<size_t> user_ix;
+	vector<size_t> user_iy;
+	vector<Base>   user_tx;
+	vector<Base>   user_ty;
+	vector<Base>   user_px;
+	vector<Base>   user_py;
+	atomic_base<Base>* user_atom = CPPAD_NULL;
+# ifndef NDEBUG
+	bool user_ok = false;
+# endif
+	size_t user_old=0, user_m=0, user_n=0, user_i=0, user_j=0;
+	enum_user_state user_state = end_user;
+
+	size_t i_op = play->num_op_rec();
+	while(i_op > 0)
+	{	OpCode        op;
+		const addr_t* arg;
+		size_t        i_var;
+		play->get_op_info(--i_op, op, arg, i_var);
+
+		// same skipping as reverse_sweep
+		while( cskip_op[i_op] )
+		{	if( op == UserOp )
+			{	play->get_user_info(op, arg, user_old, user_m, user_n);
+				CPPAD_ASSERT_UNKNOWN( i_op > user_m + user_n );
+				i_op -= user_m + user_n + 1;
+				CPPAD_ASSERT_UNKNOWN( play->GetOp(i_op) == UserOp );
+			}
+			CPPAD_ASSERT_UNKNOWN( i_op > 0 );
+			play->get_op_info(--i_op, op, arg, i_var);
+		}
+
+		switch( op )
+		{
+			case AbsOp:
+			CPPAD_HES_DIR_REVERSE( reverse_abs_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+			case AcosOp:
+			CPPAD_HES_DIR_REVERSE( reverse_acos_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case AcoshOp:
+			CPPAD_HES_DIR_REVERSE( reverse_acosh_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+# endif
+
+			case AddvvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_addvv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case AddpvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_addpv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case AsinOp:
+			CPPAD_HES_DIR_REVERSE( reverse_asin_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case AsinhOp:
+			CPPAD_HES_DIR_REVERSE( reverse_asinh_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+# endif
+
+			case AtanOp:
+			CPPAD_HES_DIR_REVERSE( reverse_atan_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case AtanhOp:
+			CPPAD_HES_DIR_REVERSE( reverse_atanh_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+# endif
+
+			case CSumOp:
+			CPPAD_HES_DIR_REVERSE( reverse_csum_op(
+				d, i_var, arg, K, partial
+			) )
+			break;
+
+			case CExpOp:
+			CPPAD_HES_DIR_REVERSE( reverse_cond_op(
+				d, i_var, arg, num_par, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case CosOp:
+			CPPAD_HES_DIR_REVERSE( reverse_cos_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+			case CoshOp:
+			CPPAD_HES_DIR_REVERSE( reverse_cosh_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+			case DivvvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_divvv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case DivpvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_divpv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case DivvpOp:
+			CPPAD_HES_DIR_REVERSE( reverse_divvp_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case ErfOp:
+			CPPAD_HES_DIR_REVERSE( reverse_erf_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+# endif
+
+			case ExpOp:
+			CPPAD_HES_DIR_REVERSE( reverse_exp_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case Expm1Op:
+			CPPAD_HES_DIR_REVERSE( reverse_expm1_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+# endif
+
+			case LdpOp:
+			case LdvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_load_op(
+				op, d, i_var, arg, J, taylor, K, partial, var_by_load_op.data()
+			) )
+			break;
+
+			case LogOp:
+			CPPAD_HES_DIR_REVERSE( reverse_log_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+			case Log1pOp:
+			CPPAD_HES_DIR_REVERSE( reverse_log1p_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+# endif
+
+			case MulpvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_mulpv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case MulvvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_mulvv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case MulpvvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_mulpvv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case PowvpOp:
+			CPPAD_HES_DIR_REVERSE( reverse_powvp_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case PowpvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_powpv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case PowvvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_powvv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case SignOp:
+			CPPAD_HES_DIR_REVERSE( reverse_sign_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+			case SinOp:
+			CPPAD_HES_DIR_REVERSE( reverse_sin_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+			case SinCosOp:
+			CPPAD_HES_DIR_REVERSE( reverse_sincos_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+			case SinhOp:
+			CPPAD_HES_DIR_REVERSE( reverse_sinh_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+			case SqrtOp:
+			CPPAD_HES_DIR_REVERSE( reverse_sqrt_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+			case SubvvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_subvv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case SubpvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_subpv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case SubvpOp:
+			CPPAD_HES_DIR_REVERSE( reverse_subvp_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case TanOp:
+			CPPAD_HES_DIR_REVERSE( reverse_tan_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+			case TanhOp:
+			CPPAD_HES_DIR_REVERSE( reverse_tanh_op(
+				d, i_var, arg[0], J, taylor, K, partial
+			) )
+			break;
+
+			case ZmulpvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_zmulpv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case ZmulvpOp:
+			CPPAD_HES_DIR_REVERSE( reverse_zmulvp_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case ZmulvvOp:
+			CPPAD_HES_DIR_REVERSE( reverse_zmulvv_op(
+				d, i_var, arg, parameter, J, taylor, K, partial
+			) )
+			break;
+
+			case UserOp:
+			user_atom = play->get_user_info(op, arg, user_old, user_m, user_n);
+			if( user_state == end_user )
+			{	user_state = ret_user;
+				user_i     = user_m;
+				user_j     = user_n;
+				user_ix.resize(user_n);
+				user_iy.resize(user_m);
+				user_tx.resize(user_n * 2);
+				user_px.resize(user_n * 2);
+				user_ty.resize(user_m * 2);
+				user_py.resize(user_m * 2);
+			}
+			else
+			{	CPPAD_ASSERT_UNKNOWN( user_state == start_user );
+				user_state = end_user;
+				user_atom->set_old(user_old);
+				// the atomic function sees one direction at a time
+				for(size_t ell = 0; ell < r; ell++)
+				{	for(size_t j = 0; j < user_n; j++) if( user_ix[j] > 0 )
+					{	size_t index = (user_ix[j] * r + ell) * 2;
+						user_tx[j * 2 + 0] = Taylor[index + 0];
+						user_tx[j * 2 + 1] = Taylor[index + 1];
+					}
+					for(size_t i = 0; i < user_m; i++) if( user_iy[i] > 0 )
+					{	size_t index = (user_iy[i] * r + ell) * 2;
+						user_ty[i * 2 + 0] = Taylor[index + 0];
+						user_ty[i * 2 + 1] = Taylor[index + 1];
+						user_py[i * 2 + 0] = Partial[index + 0];
+						user_py[i * 2 + 1] = Partial[index + 1];
+					}
+# ifdef NDEBUG
+					user_atom->reverse(d, user_tx, user_ty, user_px, user_py);
+# else
+					user_ok = user_atom->reverse(
+						d, user_tx, user_ty, user_px, user_py
+					);
+					if( ! user_ok )
+					{	std::string msg =
+							user_atom->afun_name()
+							+ ": atomic_base.reverse: returned false";
+						CPPAD_ASSERT_KNOWN(false, msg.c_str() );
+					}
+# endif
+					for(size_t j = 0; j < user_n; j++) if( user_ix[j] > 0 )
+					{	size_t index = (user_ix[j] * r + ell) * 2;
+						Partial[index + 0] += user_px[j * 2 + 0];
+						Partial[index + 1] += user_px[j * 2 + 1];
+					}
+				}
+			}
+			break;
+
+			case UsrapOp:
+			CPPAD_ASSERT_UNKNOWN( user_state == arg_user );
+			CPPAD_ASSERT_UNKNOWN( 0 < user_j && user_j <= user_n );
+			--user_j;
+			user_ix[user_j]         = 0;
+			user_tx[user_j * 2 + 0] = parameter[ arg[0] ];
+			user_tx[user_j * 2 + 1] = Base(0.0);
+			if( user_j == 0 )
+				user_state = start_user;
+			break;
+
+			case UsravOp:
+			CPPAD_ASSERT_UNKNOWN( user_state == arg_user );
+			CPPAD_ASSERT_UNKNOWN( 0 < user_j && user_j <= user_n );
+			--user_j;
+			user_ix[user_j] = arg[0];
+			if( user_j == 0 )
+				user_state = start_user;
+			break;
+
+			case UsrrpOp:
+			CPPAD_ASSERT_UNKNOWN( user_state == ret_user );
+			CPPAD_ASSERT_UNKNOWN( 0 < user_i && user_i <= user_m );
+			--user_i;
+			user_iy[user_i]         = 0;
+			user_ty[user_i * 2 + 0] = parameter[ arg[0] ];
+			user_ty[user_i * 2 + 1] = Base(0.0);
+			user_py[user_i * 2 + 0] = Base(0.0);
+			user_py[user_i * 2 + 1] = Base(0.0);
+			if( user_i == 0 )
+				user_state = arg_user;
+			break;
+
+			case UsrrvOp:
+			CPPAD_ASSERT_UNKNOWN( user_state == ret_user );
+			CPPAD_ASSERT_UNKNOWN( 0 < user_i && user_i <= user_m );
+			--user_i;
+			user_iy[user_i] = i_var;
+			if( user_i == 0 )
+				user_state = arg_user;
+			break;
+
+			// no contribution to the partials
+			case BeginOp:
+			case CSkipOp:
+			case DisOp:
+			case EndOp:
+			case InvOp:
+			case EqpvOp:
+			case EqvvOp:
+			case LtpvOp:
+			case LtvpOp:
+			case LtvvOp:
+			case LepvOp:
+			case LevpOp:
+			case LevvOp:
+			case NepvOp:
+			case NevvOp:
+			case ParOp:
+			case PriOp:
+			case StppOp:
+			case StpvOp:
+			case StvpOp:
+			case StvvOp:
+			break;
+
+			default:
+			CPPAD_ASSERT_UNKNOWN(false);
+		}
+	}
+	CPPAD_ASSERT_UNKNOWN( user_state == end_user );
+}
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+
+// preprocessor symbols that are local to this file
+# undef CPPAD_HES_DIR_FORWARD
+# undef CPPAD_HES_DIR_REVERSE
+
+# endif
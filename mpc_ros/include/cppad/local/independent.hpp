@@ -49,6 +49,13 @@ void ADTape<Base>::Independent(VectorAD &x, size_t abort_op_index)
 	// set the abort index before doing anything else
 	Rec_.set_abort_op_index(abort_op_index);
 
+	// mpc_ros: storage asked for by RecordReserve, then forget it
+	size_t* hint = recorder<Base>::reserve_hint( thread_alloc::thread_num() );
+	if( hint[0] > 0 )
+	{	Rec_.reserve(hint[0], hint[1], hint[2]);
+		hint[0] = hint[1] = hint[2] = 0;
+	}
+
 	// mark the beginning of the tape and skip the first variable index
 	// (zero) because parameters use taddr zero
 	CPPAD_ASSERT_NARG_NRES(BeginOp, 1, 1);
@@ -98,6 +98,13 @@ inline void forward_mulvv_op_dir(
 	Base* z = taylor +    i_z * num_taylor_per_var;
 
 	size_t k, ell, m;
+	if( q == 1 )
+	{	// first order (sparse Jacobians), contiguous in the directions
+		Base x0 = x[0], y0 = y[0];
+		for(ell = 1; ell <= r; ell++)
+			z[ell] = x0 * y[ell] + x[ell] * y0;
+		return;
+	}
 	for(ell = 0; ell < r; ell++)
 	{	m = (q-1)*r + ell + 1;
 		z[m] = x[0] * y[m] + x[m] * y[0];
@@ -354,6 +361,197 @@ inline void reverse_mulpv_op(
 	}
 }
 
+// --------------------------- Mulpvv ----------------------------------------
+/*!
+Compute forward mode Taylor coefficients for result of op = MulpvvOp.
+
+The C++ source code corresponding to this operation is
+\verbatim
+	z = p * (x * y)
+\endverbatim
+where p is a parameter and x, y are variables.
+It is recorded by optimize in place of a MulvvOp, w = x * y,
+that is only used by a MulpvOp, z = p * w.
+The arguments are arg[0], the index of p, and arg[1], arg[2], the indices
+of x and y; the coefficients are those of the pair, p * w[d].
+
+\copydetails CppAD::local::forward_binary_op
+*/
+
+template <class Base>
+inline void forward_mulpvv_op(
+	size_t        p           ,
+	size_t        q           ,
+	size_t        i_z         ,
+	const addr_t* arg         ,
+	const Base*   parameter   ,
+	size_t        cap_order   ,
+	Base*         taylor      )
+{
+	// check assumptions
+	CPPAD_ASSERT_UNKNOWN( NumArg(MulpvvOp) == 3 );
+	CPPAD_ASSERT_UNKNOWN( NumRes(MulpvvOp) == 1 );
+	CPPAD_ASSERT_UNKNOWN( q < cap_order );
+	CPPAD_ASSERT_UNKNOWN( p <= q );
+
+	// Taylor coefficients corresponding to arguments and result
+	Base* x = taylor + arg[1] * cap_order;
+	Base* y = taylor + arg[2] * cap_order;
+	Base* z = taylor + i_z    * cap_order;
+
+	// Parameter value
+	Base c = parameter[ arg[0] ];
+
+	size_t k;
+	for(size_t d = p; d <= q; d++)
+	{	Base w = Base(0.0);
+		for(k = 0; k <= d; k++)
+			w += x[d-k] * y[k];
+		z[d] = c * w;
+	}
+}
+/*!
+Multiple directions forward mode Taylor coefficients for op = MulpvvOp.
+
+The C++ source code corresponding to this operation is
+\verbatim
+	z = p * (x * y)
+\endverbatim
+see forward_mulpvv_op.
+
+\copydetails CppAD::local::forward_binary_op_dir
+*/
+
+template <class Base>
+inline void forward_mulpvv_op_dir(
+	size_t        q           ,
+	size_t        r           ,
+	size_t        i_z         ,
+	const addr_t* arg         ,
+	const Base*   parameter   ,
+	size_t        cap_order   ,
+	Base*         taylor      )
+{
+	// check assumptions
+	CPPAD_ASSERT_UNKNOWN( NumArg(MulpvvOp) == 3 );
+	CPPAD_ASSERT_UNKNOWN( NumRes(MulpvvOp) == 1 );
+	CPPAD_ASSERT_UNKNOWN( 0 < q );
+	CPPAD_ASSERT_UNKNOWN( q < cap_order );
+
+	// Taylor coefficients corresponding to arguments and result
+	size_t num_taylor_per_var = (cap_order-1) * r + 1;
+	Base* x = taylor + arg[1] * num_taylor_per_var;
+	Base* y = taylor + arg[2] * num_taylor_per_var;
+	Base* z = taylor +    i_z * num_taylor_per_var;
+
+	// Parameter value
+	Base c = parameter[ arg[0] ];
+
+	size_t k, ell, m;
+	if( q == 1 )
+	{	// first order (sparse Jacobians), contiguous in the directions
+		Base x0 = x[0], y0 = y[0];
+		for(ell = 1; ell <= r; ell++)
+			z[ell] = c * (x0 * y[ell] + x[ell] * y0);
+		return;
+	}
+	for(ell = 0; ell < r; ell++)
+	{	m = (q-1)*r + ell + 1;
+		Base w = x[0] * y[m] + x[m] * y[0];
+		for(k = 1; k < q; k++)
+			w += x[(q-k-1)*r + ell + 1] * y[(k-1)*r + ell + 1];
+		z[m] = c * w;
+	}
+}
+/*!
+Compute zero order forward mode Taylor coefficient for result of op = MulpvvOp.
+
+The C++ source code corresponding to this operation is
+\verbatim
+	z = p * (x * y)
+\endverbatim
+see forward_mulpvv_op.
+
+\copydetails CppAD::local::forward_binary_op_0
+*/
+
+template <class Base>
+inline void forward_mulpvv_op_0(
+	size_t        i_z         ,
+	const addr_t* arg         ,
+	const Base*   parameter   ,
+	size_t        cap_order   ,
+	Base*         taylor      )
+{
+	// check assumptions
+	CPPAD_ASSERT_UNKNOWN( NumArg(MulpvvOp) == 3 );
+	CPPAD_ASSERT_UNKNOWN( NumRes(MulpvvOp) == 1 );
+
+	// Taylor coefficients corresponding to arguments and result
+	Base* x = taylor + arg[1] * cap_order;
+	Base* y = taylor + arg[2] * cap_order;
+	Base* z = taylor + i_z    * cap_order;
+
+	z[0] = parameter[ arg[0] ] * (x[0] * y[0]);
+}
+
+/*!
+Compute reverse mode partial derivatives for result of op = MulpvvOp.
+
+The C++ source code corresponding to this operation is
+\verbatim
+	z = p * (x * y)
+\endverbatim
+see forward_mulpvv_op. The partial of z is scaled by p once per order,
+as the MulpvOp would have passed it to w, and then split between x and y
+as by the MulvvOp.
+
+\copydetails CppAD::local::reverse_binary_op
+*/
+
+template <class Base>
+inline void reverse_mulpvv_op(
+	size_t        d           ,
+	size_t        i_z         ,
+	const addr_t* arg         ,
+	const Base*   parameter   ,
+	size_t        cap_order   ,
+	const Base*   taylor      ,
+	size_t        nc_partial  ,
+	Base*         partial     )
+{
+	// check assumptions
+	CPPAD_ASSERT_UNKNOWN( NumArg(MulpvvOp) == 3 );
+	CPPAD_ASSERT_UNKNOWN( NumRes(MulpvvOp) == 1 );
+	CPPAD_ASSERT_UNKNOWN( d < cap_order );
+	CPPAD_ASSERT_UNKNOWN( d < nc_partial );
+
+	// Arguments
+	const Base* x  = taylor + arg[1] * cap_order;
+	const Base* y  = taylor + arg[2] * cap_order;
+
+	// Partial derivatives corresponding to arguments and result
+	Base* px = partial + arg[1] * nc_partial;
+	Base* py = partial + arg[2] * nc_partial;
+	Base* pz = partial + i_z    * nc_partial;
+
+	// Parameter value
+	Base c = parameter[ arg[0] ];
+
+	// number of indices to access
+	size_t j = d + 1;
+	size_t k;
+	while(j)
+	{	--j;
+		Base pw = azmul(pz[j], c);
+		for(k = 0; k <= j; k++)
+		{
+			px[j-k] += azmul(pw, y[k]);
+			py[k]   += azmul(pw, x[j-k]);
+		}
+	}
+}
+
 
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
@@ -18,6 +18,7 @@ Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
 
 // operations
 # include <cppad/core/std_math_98.hpp>
+# include <cppad/local/fast_math.hpp>
 # include <cppad/local/abs_op.hpp>
 # include <cppad/local/add_op.hpp>
 # include <cppad/local/acos_op.hpp>
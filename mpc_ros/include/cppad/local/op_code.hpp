@@ -109,6 +109,7 @@ enum OpCode {
 	LtvpOp,   // variable  < parameter
 	LtvvOp,   // variable  < variable
 	MulpvOp,  // parameter  * variable
+	MulpvvOp, // parameter * (variable * variable), recorded by optimize
 	MulvvOp,  // variable   * variable
 	NepvOp,   // parameter  != variable
 	NevvOp,   // variable   != variable
@@ -119,6 +120,7 @@ enum OpCode {
 	PriOp,    // PrintFor(text, parameter or variable, parameter or variable)
 	SignOp,   // sign(variable)
 	SinOp,    // sin(variable)
+	SinCosOp, // cos(variable), auxiliary result of the SinOp that is the argument
 	SinhOp,   // sinh(variable)
 	SqrtOp,   // sqrt(variable)
 	StppOp,   // z[parameter] = parameter (first parameter converted to index)
@@ -214,6 +216,7 @@ inline size_t NumArg( OpCode op)
 		2, // LtvpOp
 		2, // LtvvOp
 		2, // MulpvOp
+		3, // MulpvvOp
 		2, // MulvvOp
 		2, // NepvOp
 		2, // NevvOp
@@ -224,6 +227,7 @@ inline size_t NumArg( OpCode op)
 		5, // PriOp
 		1, // SignOp
 		1, // SinOp
+		1, // SinCosOp
 		1, // SinhOp
 		1, // SqrtOp
 		3, // StppOp
@@ -320,6 +324,7 @@ inline size_t NumRes(OpCode op)
 		0, // LtvpOp
 		0, // LtvvOp
 		1, // MulpvOp
+		1, // MulpvvOp
 		1, // MulvvOp
 		0, // NepvOp
 		0, // NevvOp
@@ -330,6 +335,7 @@ inline size_t NumRes(OpCode op)
 		0, // PriOp
 		1, // SignOp
 		2, // SinOp
+		1, // SinCosOp
 		2, // SinhOp
 		1, // SqrtOp
 		0, // StppOp
@@ -411,6 +417,7 @@ inline const char* OpName(OpCode op)
 		"Ltvp"  ,
 		"Ltvv"  ,
 		"Mulpv" ,
+		"Mulpvv",
 		"Mulvv" ,
 		"Nepv"  ,
 		"Nevv"  ,
@@ -421,6 +428,7 @@ inline const char* OpName(OpCode op)
 		"Pri"   ,
 		"Sign"  ,
 		"Sin"   ,
+		"SinCos",
 		"Sinh"  ,
 		"Sqrt"  ,
 		"Stpp"  ,
@@ -714,6 +722,13 @@ void printOp(
 		printOpField(os, " pr=", play->GetPar(ind[1]), ncol);
 		break;
 
+		case MulpvvOp:
+		CPPAD_ASSERT_UNKNOWN( NumArg(op) == 3 );
+		printOpField(os, " pl=", play->GetPar(ind[0]), ncol);
+		printOpField(os, " vl=", ind[1], ncol);
+		printOpField(os, " vr=", ind[2], ncol);
+		break;
+
 		case AbsOp:
 		case AcosOp:
 		case AcoshOp:
@@ -729,6 +744,7 @@ void printOp(
 		case Log1pOp:
 		case SignOp:
 		case SinOp:
+		case SinCosOp:
 		case SinhOp:
 		case SqrtOp:
 		case UsravOp:
@@ -943,6 +959,7 @@ inline size_t arg_is_variable(
 		case Log1pOp:
 		case LogOp:
 		case SignOp:
+		case SinCosOp:
 		case SinhOp:
 		case SinOp:
 		case SqrtOp:
@@ -1017,6 +1034,13 @@ inline size_t arg_is_variable(
 		// --------------------------------------------------------------------
 		// cases where NumArg(op) == 3
 
+		case MulpvvOp:
+		CPPAD_ASSERT_UNKNOWN( NumArg(op) == 3 );
+		is_variable[0] = false;
+		is_variable[1] = true;
+		is_variable[2] = true;
+		break;
+
 		case LdpOp:
 		case StppOp:
 		CPPAD_ASSERT_UNKNOWN( NumArg(op) == 3 );
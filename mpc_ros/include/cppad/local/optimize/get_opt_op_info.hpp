@@ -66,6 +66,8 @@ structure that holds the information for each of the operators.
 The output value of opt_op_info[i_arg].usage is increased; to be specific,
 If sum_result is true and the input value of opt_op_info[i_arg].usage
 is no_usage, its output value is csum_usage.
+If the result is a MulpvOp, the argument is a MulvvOp and the input value
+of opt_op_info[i_arg].usage is no_usage, its output value is fuse_usage.
 Otherwise, the output value of opt_op_info[i_arg].usage is yes_usage.
 
 \param cexp_set
@@ -108,13 +110,21 @@ inline void usage_cexp_result2arg(
 		}
 	}
 	// usage
-	bool csum = sum_result && opt_op_info[i_arg].usage == no_usage;
+	bool first = opt_op_info[i_arg].usage == no_usage;
+	bool csum  = sum_result && first;
 	if( csum )
 	{	OpCode op_a = play->GetOp(i_arg);
 		csum = add_or_subtract( op_a );
 	}
+	bool fuse = (! sum_result) && first;
+	if( fuse )
+	{	fuse  = play->GetOp(i_result) == MulpvOp;
+		fuse &= play->GetOp(i_arg) == MulvvOp;
+	}
 	if( csum )
 		opt_op_info[i_arg].usage = csum_usage;
+	else if( fuse )
+		opt_op_info[i_arg].usage = fuse_usage;
 	else
 		opt_op_info[i_arg].usage = yes_usage;
 	//
@@ -146,6 +156,10 @@ if this is true, arguments are considered used if they appear in
 print forward operators; i.e., PriOp.
 This is also a side effect; i.e. NumRes(PriOp) is zero.
 
+\param fused_mul_op
+if this is false, no operator has fuse_usage upon return;
+i.e., MulvvOp operators only used by a MulpvOp are kept as they are.
+
 \param play
 This is the old operation sequence.
 
@@ -201,6 +215,7 @@ void get_opt_op_info(
 	bool                          conditional_skip    ,
 	bool                          compare_op          ,
 	bool                          print_for_op        ,
+	bool                          fused_mul_op        ,
 	const player<Base>*           play                ,
 	const vector<size_t>&         dep_taddr           ,
 	vector<struct_cexp_info>&     cexp_info           ,
@@ -375,6 +390,7 @@ void get_opt_op_info(
 			case PowvpOp:
 			case SignOp:
 			case SinOp:
+			case SinCosOp:
 			case SinhOp:
 			case SqrtOp:
 			case TanOp:
@@ -428,6 +444,19 @@ void get_opt_op_info(
 			}
 			break; // --------------------------------------------
 
+			// arg[1] and arg[2] are the only variables
+			case MulpvvOp:
+			CPPAD_ASSERT_UNKNOWN( NumRes(op) > 0 );
+			if( use_result != no_usage )
+			{	for(size_t i = 1; i < 3; i++)
+				{	size_t j_op = play->var2op(arg[i]);
+					usage_cexp_result2arg(
+						play, sum_op, i_op, j_op, opt_op_info, cexp_set
+					);
+				}
+			}
+			break; // --------------------------------------------
+
 			// Conditional expression operators
 			// arg[2], arg[3], arg[4], arg[5] are parameters or variables
 			case CExpOp:
@@ -804,7 +833,7 @@ void get_opt_op_info(
 			//
 			// reverse_user using opt_op_info instead of play
 			CPPAD_ASSERT_NARG_NRES(op, 1, 0);
-			CPPAD_ASSERT_UNKNOWN( 0 < user_j && user_j < user_n );
+			CPPAD_ASSERT_UNKNOWN( 0 < user_j && user_j <= user_n );
 			--user_j;
 			if( user_j == 0 )
 				user_state = start_user;
@@ -862,8 +891,8 @@ void get_opt_op_info(
 			CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
 			//
 			// reverse_user using opt_op_info instead of play
-			CPPAD_ASSERT_NARG_NRES(op, 0, 1);
-			CPPAD_ASSERT_UNKNOWN( 0 < user_i && user_i < user_m );
+			CPPAD_ASSERT_NARG_NRES(op, 1, 0);
+			CPPAD_ASSERT_UNKNOWN( 0 < user_i && user_i <= user_m );
 			--user_i;
 			if( user_i == 0 )
 				user_state = arg_user;
@@ -875,6 +904,11 @@ void get_opt_op_info(
 			CPPAD_ASSERT_UNKNOWN(0);
 		}
 	}
+	if( ! fused_mul_op )
+	{	for(i_op = 0; i_op < num_op; ++i_op)
+			if( opt_op_info[i_op].usage == fuse_usage )
+				opt_op_info[i_op].usage = yes_usage;
+	}
 	// ----------------------------------------------------------------------
 	// compute previous in opt_op_info
 	// ----------------------------------------------------------------------
@@ -943,6 +977,7 @@ void get_opt_op_info(
 			case LtvpOp:
 			case LtvvOp:
 			case MulpvOp:
+			case MulpvvOp:
 			case MulvvOp:
 			case NepvOp:
 			case NevvOp:
@@ -951,6 +986,7 @@ void get_opt_op_info(
 			case PowvvOp:
 			case SignOp:
 			case SinOp:
+			case SinCosOp:
 			case SinhOp:
 			case SqrtOp:
 			case SubpvOp:
@@ -1018,6 +1054,7 @@ void get_opt_op_info(
 	{	size_t j_op = i_op;
 		bool keep = opt_op_info[i_op].usage != no_usage;
 		keep     &= opt_op_info[i_op].usage != csum_usage;
+		keep     &= opt_op_info[i_op].usage != fuse_usage;
 		keep     &= opt_op_info[i_op].previous == 0;
 		if( keep )
 		{	sparse_list_const_iterator itr(cexp_set, i_op);
@@ -43,8 +43,8 @@ inline size_t optimize_hash_code(
 	size_t        num_arg ,
 	const addr_t* arg     )
 {
-	// there is only one case where num_arg == 3
-	CPPAD_ASSERT_UNKNOWN( op == ErfOp || num_arg <= 2 );
+	// there are only two cases where num_arg == 3
+	CPPAD_ASSERT_UNKNOWN( op == ErfOp || op == MulpvvOp || num_arg <= 2 );
 	CPPAD_ASSERT_UNKNOWN( num_arg <= 3 );
 	size_t sum = size_t(op);
 	for(size_t i = 0; i < num_arg; i++)
@@ -31,7 +31,7 @@ struct struct_opt_op_info {
 	addr_t previous;
 
 	/// How is this operator used to compute the dependent variables.
-	/// If usage = csum_usage or usage = no_usage, previous = 0.
+	/// If usage = csum_usage, fuse_usage or no_usage, previous = 0.
 	enum_usage usage;
 
 };
@@ -60,6 +60,13 @@ If the sub-string "no_print_for" appears,
 then print forward (PriOp) operators will be removed from the optimized tape.
 These operators are useful for reporting problems evaluating derivatives
 at independent variable values different from those used to record a function.
+\li
+If the sub-string "no_fused_mul_op" appears,
+a product of two variables that is only used as the variable of a
+parameter times variable product is kept as two operators.
+Otherwise the pair is recorded as one MulpvvOp, z = p * (x * y),
+saving one operator and one variable (these are frequent in least squares
+objectives, p * (x - r) * (x - r), and in steps like v * cos(theta) * dt).
 
 \param n
 is the number of independent variables on the tape.
@@ -92,6 +99,7 @@ void optimize_run(
 	bool conditional_skip = true;
 	bool compare_op       = true;
 	bool print_for_op     = true;
+	bool fused_mul_op     = true;
 	size_t index = 0;
 	while( index < options.size() )
 	{	while( index < options.size() && options[index] == ' ' )
@@ -106,6 +114,8 @@ void optimize_run(
 				compare_op = false;
 			else if( option == "no_print_for_op" )
 				print_for_op = false;
+			else if( option == "no_fused_mul_op" )
+				fused_mul_op = false;
 			else
 			{	option += " is not a valid optimize option";
 				CPPAD_ASSERT_KNOWN( false , option.c_str() );
@@ -137,6 +147,7 @@ void optimize_run(
 		conditional_skip,
 		compare_op,
 		print_for_op,
+		fused_mul_op,
 		play,
 		dep_taddr,
 		cexp_info,
@@ -331,6 +342,7 @@ void optimize_run(
 			case Log1pOp:
 			case SignOp:
 			case SinOp:
+			case SinCosOp:
 			case SinhOp:
 			case SqrtOp:
 			case TanOp:
@@ -466,6 +478,18 @@ void optimize_run(
 			{	size_t j_op = previous;
 				old2new[i_op].new_var = old2new[j_op].new_var;
 			}
+			else if( op == MulpvOp &&
+				opt_op_info[ play->var2op(arg[1]) ].usage == fuse_usage )
+			{	// p * (x * y) as one operator
+				size_pair = record_pvv(
+					play                ,
+					old2new             ,
+					i_op                ,
+					rec
+				);
+				old2new[i_op].new_op  = addr_t( size_pair.i_op );
+				old2new[i_op].new_var = addr_t( size_pair.i_var );
+			}
 			else
 			{	//
 				size_pair = record_pv(
@@ -526,6 +550,26 @@ void optimize_run(
 			}
 			break;
 			// ---------------------------------------------------
+			// Parameter times the product of two variables, one result
+			case MulpvvOp:
+			previous = opt_op_info[i_op].previous;
+			if( previous > 0 )
+			{	size_t j_op = previous;
+				old2new[i_op].new_var = old2new[j_op].new_var;
+			}
+			else
+			{	//
+				size_pair = record_pvv(
+					play                ,
+					old2new             ,
+					i_op                ,
+					rec
+				);
+				old2new[i_op].new_op  = addr_t( size_pair.i_op );
+				old2new[i_op].new_var = addr_t( size_pair.i_var );
+			}
+			break;
+			// ---------------------------------------------------
 			// Conditional expression operators
 			case CExpOp:
 			CPPAD_ASSERT_NARG_NRES(op, 6, 1);
@@ -87,6 +87,67 @@ struct_size_pair record_pv(
 	CPPAD_ASSERT_UNKNOWN( 0 < new_arg[1] && size_t(new_arg[1]) < ret.i_var );
 	return ret;
 }
+/*!
+Record an operation of the form parameter * (variable * variable).
+
+\param play
+player object corresponding to the old recroding.
+
+\param old2new
+mapping from old operator index to information about the new recording.
+
+\param i_op
+is the index in the old operation sequence for this operator.
+The operator must be a MulpvvOp, or a MulpvOp whose variable is the result
+of a MulvvOp with fuse_usage (which is not in the new recording).
+
+\param rec
+is the object that will record the new operations.
+
+\return
+is the operator and variable indices in the new operation sequence.
+*/
+template <class Base>
+struct_size_pair record_pvv(
+	const player<Base>*                                play           ,
+	const CppAD::vector<struct struct_old2new>&        old2new        ,
+	size_t                                             i_op           ,
+	recorder<Base>*                                    rec            )
+{
+	// get_op_info
+	OpCode        op;
+	const addr_t* arg;
+	size_t        i_var;
+	play->get_op_info(i_op, op, arg, i_var);
+	CPPAD_ASSERT_UNKNOWN( op == MulpvOp || op == MulpvvOp );
+	//
+	// parameter and the two variables of the product
+	const Base* par = play->GetPar();
+	CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < play->num_par_rec() );
+	addr_t new_arg[3];
+	new_arg[0] = rec->PutPar( par[arg[0]] );
+	if( op == MulpvvOp )
+	{	new_arg[1] = old2new[ play->var2op(arg[1]) ].new_var;
+		new_arg[2] = old2new[ play->var2op(arg[2]) ].new_var;
+	}
+	else
+	{	OpCode        op_w;
+		const addr_t* arg_w;
+		size_t        i_var_w;
+		play->get_op_info( play->var2op(arg[1]), op_w, arg_w, i_var_w);
+		CPPAD_ASSERT_UNKNOWN( op_w == MulvvOp );
+		new_arg[1] = old2new[ play->var2op(arg_w[0]) ].new_var;
+		new_arg[2] = old2new[ play->var2op(arg_w[1]) ].new_var;
+	}
+	rec->PutArg( new_arg[0], new_arg[1], new_arg[2] );
+	//
+	struct_size_pair ret;
+	ret.i_op  = rec->num_op_rec();
+	ret.i_var = rec->PutOp(MulpvvOp);
+	CPPAD_ASSERT_UNKNOWN( 0 < new_arg[1] && size_t(new_arg[1]) < ret.i_var );
+	CPPAD_ASSERT_UNKNOWN( 0 < new_arg[2] && size_t(new_arg[2]) < ret.i_var );
+	return ret;
+}
 
 } } } // END_CPPAD_LOCAL_OPTIMIZE_NAMESPACE
 
@@ -28,7 +28,13 @@ enum enum_usage {
 	a dependent variable. Hence case it can be removed as part of a
 	cumulative summation starting at its parent or above.
 	*/
-	csum_usage
+	csum_usage,
+	/*!
+	This operator is a MulvvOp that is only used once, by a MulpvOp.
+	Furthermore, its result is not a dependent variable. Hence it can be
+	removed by recording its parent as one MulpvvOp.
+	*/
+	fuse_usage
 };
 
 } } } // END_CPPAD_LOCAL_OPTIMIZE_NAMESPACE
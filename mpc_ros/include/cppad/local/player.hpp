@@ -297,6 +297,7 @@ public:
 				case PowvpOp:
 				case SignOp:
 				case SinOp:
+				case SinCosOp:
 				case SinhOp:
 				case SqrtOp:
 				case SubvpOp:
@@ -339,6 +340,12 @@ public:
 				CPPAD_ASSERT_UNKNOWN(op_arg[1] <= arg_var_bound );
 				break;
 
+				// MulpvvOp
+				case MulpvvOp:
+				CPPAD_ASSERT_UNKNOWN(op_arg[1] <= arg_var_bound );
+				CPPAD_ASSERT_UNKNOWN(op_arg[2] <= arg_var_bound );
+				break;
+
 				// StpvOp
 				case StpvOp:
 				CPPAD_ASSERT_UNKNOWN(op_arg[2] <= arg_var_bound );
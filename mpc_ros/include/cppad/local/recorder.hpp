@@ -83,6 +83,33 @@ public:
 	~recorder(void)
 	{ }
 
+	/*!
+	mpc_ros: reserve storage for an empty recording.
+
+	The operator, argument and parameter vectors otherwise start empty and
+	are copied every time they grow. Each count is a capacity; the
+	recording may end up larger or smaller.
+	*/
+	void reserve(size_t n_op, size_t n_arg, size_t n_par)
+	{	CPPAD_ASSERT_UNKNOWN( op_vec_.size() == 0 );
+		op_vec_.resize(n_op);
+		op_vec_.resize(0);
+		arg_vec_.resize(n_arg);
+		arg_vec_.resize(0);
+		par_vec_.resize(n_par);
+		par_vec_.resize(0);
+	}
+
+	/*!
+	mpc_ros: capacities [op, arg, par] for the next recording of a thread,
+	see RecordReserve. Zero-initialized before any thread runs.
+	*/
+	static size_t* reserve_hint(size_t thread)
+	{	static size_t hint[CPPAD_MAX_NUM_THREADS][3];
+		CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS );
+		return hint[thread];
+	}
+
 	/*!
 	Frees all information in recording.
 
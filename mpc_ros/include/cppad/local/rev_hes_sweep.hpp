@@ -465,6 +465,15 @@ void rev_hes_sweep(
 			break;
 			// -------------------------------------------------
 
+			case MulpvvOp:
+			CPPAD_ASSERT_NARG_NRES(op, 3, 1)
+			// the variables are arg[1] and arg[2]
+			reverse_sparse_hessian_mul_op(
+			i_var, arg + 1, RevJac, for_jac_sparse, rev_hes_sparse
+			);
+			break;
+			// -------------------------------------------------
+
 			case ParOp:
 			CPPAD_ASSERT_NARG_NRES(op, 1, 1)
 
@@ -515,6 +524,15 @@ void rev_hes_sweep(
 			break;
 			// -------------------------------------------------
 
+			case SinCosOp:
+			// cos(x) of the SinOp at arg[0]: nonlinear in it, as in x
+			CPPAD_ASSERT_NARG_NRES(op, 1, 1)
+			reverse_sparse_hessian_nonlinear_unary_op(
+			i_var, arg[0], RevJac, for_jac_sparse, rev_hes_sparse
+			);
+			break;
+			// -------------------------------------------------
+
 			case SinhOp:
 			// cosh(x), sinh(x)
 			CPPAD_ASSERT_NARG_NRES(op, 1, 2)
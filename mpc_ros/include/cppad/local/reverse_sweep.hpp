@@ -546,6 +546,14 @@ void reverse_sweep(
 			break;
 			// --------------------------------------------------
 
+			case MulpvvOp:
+			CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+			reverse_mulpvv_op(
+				d, i_var, arg, parameter, J, Taylor, K, Partial
+			);
+			break;
+			// --------------------------------------------------
+
 			case ParOp:
 			break;
 			// --------------------------------------------------
@@ -594,6 +602,14 @@ void reverse_sweep(
 			break;
 			// -------------------------------------------------
 
+			case SinCosOp:
+			CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+			reverse_sincos_op(
+				d, i_var, arg[0], J, Taylor, K, Partial
+			);
+			break;
+			// -------------------------------------------------
+
 			case SinhOp:
 			CPPAD_ASSERT_UNKNOWN( i_var < numvar );
 			reverse_sinh_op(
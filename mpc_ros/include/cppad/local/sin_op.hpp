@@ -61,8 +61,7 @@ inline void forward_sin_op(
 	// (except that there is a sign difference for the hyperbolic case).
 	size_t k;
 	if( p == 0 )
-	{	s[0] = sin( x[0] );
-		c[0] = cos( x[0] );
+	{	math_sincos(x[0], s[0], c[0]);
 		p++;
 	}
 	for(size_t j = p; j <= q; j++)
@@ -118,6 +117,15 @@ inline void forward_sin_op_dir(
 	// rest of this routine is identical for the following cases:
 	// forward_sin_op, forward_cos_op, forward_sinh_op, forward_cosh_op
 	// (except that there is a sign difference for the hyperbolic case).
+	if( q == 1 )
+	{	// first order (sparse Jacobians), contiguous in the directions
+		Base s0 = s[0], c0 = c[0];
+		for(size_t ell = 1; ell <= r; ell++)
+		{	s[ell] =   x[ell] * c0;
+			c[ell] = - x[ell] * s0;
+		}
+		return;
+	}
 	size_t m = (q-1) * r + 1;
 	for(size_t ell = 0; ell < r; ell++)
 	{	s[m+ell] =   Base(double(q)) * x[m + ell] * c[0];
@@ -164,8 +172,7 @@ inline void forward_sin_op_0(
 	Base* s = taylor + i_z * cap_order;  // called z in documentation
 	Base* c = s      -       cap_order;  // called y in documentation
 
-	s[0] = sin( x[0] );
-	c[0] = cos( x[0] );
+	math_sincos(x[0], s[0], c[0]);
 }
 
 /*!
@@ -236,5 +243,175 @@ inline void reverse_sin_op(
 	px[0] -= azmul(pc[0], s[0]);
 }
 
+/*!
+Compute forward mode Taylor coefficients for result of op = SinCosOp.
+
+The C++ source code corresponding to this operation is
+\verbatim
+	sincos(x, s, c)
+\endverbatim
+where the argument of SinCosOp is the primary result s of the SinOp
+recorded for sin(x). Its auxiliary result is c = cos(x),
+so the coefficients of z = c are copied from there without evaluating
+cos again.
+
+\param p
+lowest order of the Taylor coefficients that we are computing.
+
+\param q
+highest order of the Taylor coefficients that we are computing.
+
+\param i_z
+variable index corresponding to the result for this operation.
+
+\param i_x
+variable index corresponding to the argument for this operator,
+the primary result of a SinOp.
+
+\param cap_order
+maximum number of orders that will fit in the taylor array.
+
+\param taylor
+\b Input: <code>taylor [ (i_x - 1) * cap_order + k ]</code>
+for k = p , ... , q, is the k-th order Taylor coefficient of cos(x).
+\n
+\b Output: <code>taylor [ i_z * cap_order + k ]</code>
+for k = p , ... , q, is the k-th order Taylor coefficient of z.
+*/
+template <class Base>
+inline void forward_sincos_op(
+	size_t p           ,
+	size_t q           ,
+	size_t i_z         ,
+	size_t i_x         ,
+	size_t cap_order   ,
+	Base*  taylor      )
+{
+	// check assumptions
+	CPPAD_ASSERT_UNKNOWN( NumArg(SinCosOp) == 1 );
+	CPPAD_ASSERT_UNKNOWN( NumRes(SinCosOp) == 1 );
+	CPPAD_ASSERT_UNKNOWN( 0 < i_x && i_x < i_z );
+	CPPAD_ASSERT_UNKNOWN( q < cap_order );
+	CPPAD_ASSERT_UNKNOWN( p <= q );
+
+	const Base* c = taylor + (i_x - 1) * cap_order;
+	Base* z       = taylor + i_z * cap_order;
+	for(size_t k = p; k <= q; k++)
+		z[k] = c[k];
+}
+
+/*!
+Multiple directions forward mode Taylor coefficients for op = SinCosOp.
+
+Copies the order q coefficients of all r directions of the auxiliary
+result cos(x) of the SinOp at i_x, see forward_sincos_op.
+\copydetails CppAD::local::forward_unary1_op_dir
+*/
+template <class Base>
+inline void forward_sincos_op_dir(
+	size_t q           ,
+	size_t r           ,
+	size_t i_z         ,
+	size_t i_x         ,
+	size_t cap_order   ,
+	Base*  taylor      )
+{
+	// check assumptions
+	CPPAD_ASSERT_UNKNOWN( NumArg(SinCosOp) == 1 );
+	CPPAD_ASSERT_UNKNOWN( NumRes(SinCosOp) == 1 );
+	CPPAD_ASSERT_UNKNOWN( 0 < i_x && i_x < i_z );
+	CPPAD_ASSERT_UNKNOWN( 0 < q );
+	CPPAD_ASSERT_UNKNOWN( q < cap_order );
+
+	size_t num_taylor_per_var = (cap_order-1) * r + 1;
+	const Base* c = taylor + (i_x - 1) * num_taylor_per_var;
+	Base* z       = taylor + i_z * num_taylor_per_var;
+	size_t m = (q-1) * r + 1;
+	for(size_t ell = 0; ell < r; ell++)
+		z[m+ell] = c[m+ell];
+}
+
+/*!
+Compute zero order forward mode Taylor coefficient for op = SinCosOp.
+
+Copies the value of the auxiliary result cos(x) of the SinOp at i_x,
+see forward_sincos_op.
+\copydetails CppAD::local::forward_unary1_op_0
+*/
+template <class Base>
+inline void forward_sincos_op_0(
+	size_t i_z         ,
+	size_t i_x         ,
+	size_t cap_order   ,
+	Base*  taylor      )
+{
+	// check assumptions
+	CPPAD_ASSERT_UNKNOWN( NumArg(SinCosOp) == 1 );
+	CPPAD_ASSERT_UNKNOWN( NumRes(SinCosOp) == 1 );
+	CPPAD_ASSERT_UNKNOWN( 0 < i_x && i_x < i_z );
+	CPPAD_ASSERT_UNKNOWN( 0 < cap_order );
+
+	taylor[ i_z * cap_order ] = taylor[ (i_x - 1) * cap_order ];
+}
+
+/*!
+Compute reverse mode partial derivatives for result of op = SinCosOp.
+
+The partials of z are added to those of the auxiliary result cos(x) of
+the SinOp at i_x. The SinOp comes earlier in the tape, so its reverse
+step, which takes the partials of both of its results to x, runs after
+this one.
+
+\param d
+highest order Taylor coefficient that we are computing the partial
+derivatives with respect to.
+
+\param i_z
+variable index corresponding to the result for this operation.
+
+\param i_x
+variable index corresponding to the argument for this operation,
+the primary result of a SinOp.
+
+\param cap_order
+maximum number of orders that will fit in the taylor array.
+
+\param taylor
+not used.
+
+\param nc_partial
+number of columns in the matrix containing all the partial derivatives.
+
+\param partial
+\b Input: <code>partial [ i_z * nc_partial + k ]</code>
+for k = 0 , ... , d is the partial of G with respect to the k-th order
+coefficient of z.
+\n
+\b Output: <code>partial [ (i_x - 1) * nc_partial + k ]</code>
+for k = 0 , ... , d has that added to it.
+*/
+template <class Base>
+inline void reverse_sincos_op(
+	size_t      d            ,
+	size_t      i_z          ,
+	size_t      i_x          ,
+	size_t      cap_order    ,
+	const Base* taylor       ,
+	size_t      nc_partial   ,
+	Base*       partial      )
+{
+	// check assumptions
+	CPPAD_ASSERT_UNKNOWN( NumArg(SinCosOp) == 1 );
+	CPPAD_ASSERT_UNKNOWN( NumRes(SinCosOp) == 1 );
+	CPPAD_ASSERT_UNKNOWN( 0 < i_x && i_x < i_z );
+	CPPAD_ASSERT_UNKNOWN( d < cap_order );
+	CPPAD_ASSERT_UNKNOWN( d < nc_partial );
+
+	const Base* pz = partial + i_z * nc_partial;
+	Base* pc       = partial + (i_x - 1) * nc_partial;
+	for(size_t k = 0; k <= d; k++)
+		pc[k] += pz[k];
+}
+
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
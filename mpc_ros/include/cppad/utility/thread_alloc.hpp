@@ -15,6 +15,8 @@ Please visit http://www.coin-or.org/CppAD/ for information on other licenses.
 # include <sstream>
 # include <limits>
 # include <memory>
+# include <new>
+# include <cstdlib>
 
 
 # ifdef _MSC_VER
@@ -46,6 +48,20 @@ Minimum number of double values that will fit in an allocation.
 */
 # define CPPAD_MIN_DOUBLE_CAPACITY 16
 
+/*!
+\def CPPAD_THREAD_ALLOC_ALIGN
+mpc_ros: alignment in bytes of the memory get_memory returns, a power of
+two (BUILD_ALIGNED_ALLOC sets 64, one cache line). The block information
+in front of the memory is padded to a multiple of it and the blocks come
+from posix_memalign, so every pod_vector, CppAD::vector and ADFun Taylor
+buffer starts on it and the lanes of a simd_double never split a cache
+line. 0, the default, keeps the alignment of operator new. Has to be the
+same in every translation unit.
+*/
+# ifndef CPPAD_THREAD_ALLOC_ALIGN
+# define CPPAD_THREAD_ALLOC_ALIGN 0
+# endif
+
 /*!
 \def CPPAD_TRACE_CAPACITY
 If NDEBUG is not defined, print all calls to \c get_memory and \c return_memory
@@ -122,6 +138,47 @@ private:
 		{ }
 	};
 
+	// ---------------------------------------------------------------------
+	/// mpc_ros: bytes from a block to its memory, sizeof(block_t) rounded
+	/// up to CPPAD_THREAD_ALLOC_ALIGN
+	static size_t header_bytes(void)
+	{
+# if CPPAD_THREAD_ALLOC_ALIGN
+		const size_t align = CPPAD_THREAD_ALLOC_ALIGN;
+		return (sizeof(block_t) + align - 1) / align * align;
+# else
+		return sizeof(block_t);
+# endif
+	}
+	/// memory of a block
+	static void* memory_of(block_t* node)
+	{	return reinterpret_cast<char*>(node) + header_bytes(); }
+	/// block of the memory returned by get_memory
+	static block_t* block_of(void* v_ptr)
+	{	return reinterpret_cast<block_t*>(
+			reinterpret_cast<char*>(v_ptr) - header_bytes()
+		);
+	}
+	/// a new block with bytes of memory from the system
+	static void* system_new(size_t bytes)
+	{
+# if CPPAD_THREAD_ALLOC_ALIGN
+		void* v_node = CPPAD_NULL;
+		if( posix_memalign(&v_node, CPPAD_THREAD_ALLOC_ALIGN, header_bytes() + bytes) != 0 )
+			throw std::bad_alloc();
+		return v_node;
+# else
+		return ::operator new(header_bytes() + bytes);
+# endif
+	}
+	static void system_delete(void* v_node)
+	{
+# if CPPAD_THREAD_ALLOC_ALIGN
+		std::free(v_node);
+# else
+		::operator delete(v_node);
+# endif
+	}
 	// ---------------------------------------------------------------------
 	/// Vector of fixed capacity values for this allocator
 	static const capacity_t* capacity_info(void)
@@ -822,7 +879,7 @@ $end
 			available_root->next_ = node->next_;
 
 			// return value for get_memory
-			void* v_ptr = reinterpret_cast<void*>(node + 1);
+			void* v_ptr = memory_of(node);
 # ifndef NDEBUG
 # ifndef CPPAD_DEBUG_AND_RELEASE
 			// add node to inuse list
@@ -847,10 +904,10 @@ $end
 		// Create a new node with thread_alloc information at front.
 		// This uses the system allocator, which is thread safe, but slower,
 		// because the thread might wait for a lock on the allocator.
-		v_node          = ::operator new(sizeof(block_t) + cap_bytes);
+		v_node          = system_new(cap_bytes);
 		node            = reinterpret_cast<block_t*>(v_node);
 		node->tc_index_ = tc_index;
-		void* v_ptr     = reinterpret_cast<void*>(node + 1);
+		void* v_ptr     = memory_of(node);
 
 # ifndef NDEBUG
 # ifndef CPPAD_DEBUG_AND_RELEASE
@@ -936,7 +993,7 @@ $end
 	static void return_memory(void* v_ptr)
 	{	size_t num_cap   = capacity_info()->number;
 
-		block_t* node    = reinterpret_cast<block_t*>(v_ptr) - 1;
+		block_t* node    = block_of(v_ptr);
 		size_t tc_index  = node->tc_index_;
 		size_t thread    = tc_index / num_cap;
 		size_t c_index   = tc_index % num_cap;
@@ -991,7 +1048,7 @@ $end
 
 		// check for case where we just return the memory to the system
 		if( ! set_get_hold_memory(false) )
-		{	::operator delete( reinterpret_cast<void*>(node) );
+		{	system_delete( reinterpret_cast<void*>(node) );
 			return;
 		}
 
@@ -1079,7 +1136,7 @@ $end
 			while( v_ptr != CPPAD_NULL )
 			{	block_t* node = reinterpret_cast<block_t*>(v_ptr);
 				void* next    = node->next_;
-				::operator delete(v_ptr);
+				system_delete(v_ptr);
 				v_ptr         = next;
 
 				dec_available(capacity, thread);
@@ -1363,7 +1420,7 @@ $end
 		// number of Type values in the allocation
 		size_out         = num_bytes / sizeof(Type);
 		// store this number in the extra field
-		block_t* node    = reinterpret_cast<block_t*>(v_ptr) - 1;
+		block_t* node    = block_of(v_ptr);
 		node->extra_     = size_out;
 
 		// call default constructor for each element
@@ -1442,7 +1499,7 @@ $end
 	template <class Type>
 	static void delete_array(Type* array)
 	{	// determine the number of values in the array
-		block_t* node = reinterpret_cast<block_t*>(array) - 1;
+		block_t* node = block_of(reinterpret_cast<void*>(array));
 		size_t size     = node->extra_;
 
 		// call destructor for each element
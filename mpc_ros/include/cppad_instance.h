@@ -0,0 +1,53 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef CPPAD_INSTANCE_H
+#define CPPAD_INSTANCE_H
+
+#include <cppad/cppad.hpp>
+
+// CppAD for AD<double>, compiled once.
+//
+// Every source of the package that records or evaluates a tape used to
+// instantiate AD<double> and ADFun<double> by itself, and the package
+// builds each of those sources into several targets. The declarations
+// below make the sources include this header in place of cppad/cppad.hpp
+// and leave the members to src/cppad_instance.cpp, which the mpc_cppad
+// library compiles next to the rest of the shared solver code, see
+// CMakeLists.txt. Inline members are still expanded where they are used.
+//
+// Only the member templates for CPPAD_TESTVECTOR, the vectors of
+// TapeSolver and of the FG_eval classes, are listed. The Ipopt callback of
+// CppAD::ipopt::solve depends on each FG_eval and stays in its source, the
+// one shared by the models (TapeNLP of tape_solver.cpp) is in mpc_cppad.
+//
+// Sources that need another base first, see simd_double.h, include it
+// before this header.
+namespace CppAD
+{
+    extern template class AD<double>;
+    extern template class ADFun<double>;
+
+    extern template void ADFun<double>::Dependent(
+        const CPPAD_TESTVECTOR(AD<double>) &x,
+        const CPPAD_TESTVECTOR(AD<double>) &y);
+    extern template CPPAD_TESTVECTOR(double) ADFun<double>::Forward(
+        size_t q, const CPPAD_TESTVECTOR(double) &xq, std::ostream &s);
+    extern template CPPAD_TESTVECTOR(double) ADFun<double>::Reverse(
+        size_t p, const CPPAD_TESTVECTOR(double) &w);
+}
+
+#endif /* CPPAD_INSTANCE_H */
@@ -0,0 +1,50 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef CPPAD_PARALLEL_H
+#define CPPAD_PARALLEL_H
+
+#include <cstddef>
+
+// CppAD used from more than one thread of a process.
+//
+// thread_alloc keeps its memory per thread, and AD<double> one tape per
+// thread, only once parallel_setup() tells them how the threads are
+// numbered. Setup() does that together with parallel_ad<double>() (and
+// <float>, for the single precision tapes of TapeSolver) and
+// hold_memory(true), so a thread keeps the blocks it frees for its next
+// solve instead of handing them back to the system allocator.
+//
+// Threads get a number on their first CppAD call and give it back, with
+// the memory they hold, when they exit. The process is in parallel mode
+// while more than one of them is alive; memory then has to be freed by
+// the thread that allocated it (CppAD asserts on it). At most
+// CPPAD_MAX_NUM_THREADS threads can use CppAD at the same time.
+namespace cppad_parallel
+{
+    // Called by the MPC constructors. The first call has to come before a
+    // second thread uses CppAD, later calls do nothing.
+    void Setup();
+
+    // Number of the calling thread as seen by CppAD
+    size_t ThreadNum();
+
+    // Threads currently numbered
+    size_t ActiveThreads();
+}
+
+#endif /* CPPAD_PARALLEL_H */
@@ -0,0 +1,107 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef CPU_GOVERNOR_H
+#define CPU_GOVERNOR_H
+
+#include <vector>
+
+// CPU budget governor of the controller, for robots whose CPU is shared
+// with perception.
+//
+// Every window seconds the governor takes the CPU time of the process (all
+// of its threads) per wall second, the share of one core, and the mean
+// deadline slack of the cycles, (period - cycle time) / period. A window
+// above share or below min_slack counts as over budget; up_windows of them
+// in a row step one level down a ladder of degradations, down_windows in a
+// row below release * share (with the slack back above min_slack) step one
+// level back up.
+//
+// The ladder is built once from the configured controller, level 0, taking
+// each knob one step in turn within the operator bounds: the visualization
+// every 2nd, 4th, ... cycle (max_viz_every), the Ipopt tolerances times 10
+// (max_tol_scale, see SolvePolicy), the Gauss-Newton Hessian (gauss_newton,
+// from the exact one only), 3/4 of the horizon steps with the dt stretched
+// to keep the horizon time (min_steps, max_dt) and 4/5 of the controller
+// frequency (min_freq). Level changes that touch the steps, dt or the
+// Hessian reload the MPC parameters and record the tape again, hence the
+// hysteresis. The adaptive horizon keeps choosing below the governed steps
+// and the deadline follows the governed period, see horizon_selector.h.
+class CpuGovernor
+{
+    public:
+        struct Config
+        {
+            Config();
+
+            double share;      // CPU seconds per wall second, <= 0 disables
+            double min_slack;  // of the cycle period
+            double window;     // [s]
+            int up_windows, down_windows;
+            double release;    // of share
+            int max_viz_every;
+            double max_tol_scale;
+            bool gauss_newton;
+            int min_steps;
+            double max_dt, min_freq;
+        };
+
+        struct Level
+        {
+            int steps;
+            double dt;
+            int hessian;       // MPC HESSIAN
+            double tol_scale;
+            int viz_every;     // publish the visualization every viz_every cycles
+            double freq;       // controller frequency [Hz]
+        };
+
+        CpuGovernor();
+
+        // Ladder from base within the bounds of config, level 0
+        void Configure(const Config &config, const Level &base);
+        bool Enabled() const { return _config.share > 0.0; }
+
+        // End of a control cycle of cycle_ms at the period of the current
+        // level [s]. True when the level changed, Current() is the new one.
+        bool Cycle(double cycle_ms, double period);
+
+        int Index() const { return _index; }
+        int Levels() const { return (int)_ladder.size(); }
+        const Level &Current() const { return _ladder[_index]; }
+        const Level &At(int index) const { return _ladder[index]; }
+        // Of the last window
+        double Share() const { return _share; }
+        double Slack() const { return _slack; }
+
+        // CPU time of the process [s]
+        static double ProcessCpu();
+        // Wall time of a steady clock [s]
+        static double Now();
+
+    private:
+        Config _config;
+        std::vector<Level> _ladder;
+        int _index;
+
+        double _window_start, _cpu_start;
+        double _slack_sum;
+        int _slack_count;
+        int _over, _under;
+        double _share, _slack;
+};
+
+#endif /* CPU_GOVERNOR_H */
@@ -0,0 +1,93 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef DISTANCE_FIELD_H
+#define DISTANCE_FIELD_H
+
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+// Euclidean distance from every cell of a grid to the nearest obstacle
+// cell, for the obstacle term of the planner MPC.
+//
+// Update() compares the grid with the one of the previous call and only
+// re-propagates around the cells that changed (dynamic brushfire: cells
+// whose obstacle disappeared are cleared by a raise wave, then new and
+// remaining obstacles spread again by a lower wave). Each cell keeps its
+// nearest obstacle cell; distances are exact up to the usual error of
+// propagating obstacles over 8 neighbors, a fraction of a cell. A rolling
+// costmap that moved by whole cells is shifted instead of rebuilt.
+//
+// Distance() interpolates bilinearly between cell centers, so the distance
+// and its gradient are defined everywhere at O(1) cost. Cells inside
+// obstacles read 0, outside the grid the border value is used, and
+// distances are capped at max_distance.
+class DistanceField
+{
+    public:
+        DistanceField(double max_distance = 2.0);
+
+        // Grid of size_x * size_y costs, row major, cell (0, 0) spans
+        // [origin, origin + resolution). Costs >= threshold are obstacles
+        // except those >= unknown (costmap_2d: 254 lethal, 255 no information).
+        void Update(const unsigned char *costs, unsigned int size_x, unsigned int size_y,
+                    double resolution, double origin_x, double origin_y,
+                    unsigned char threshold = 254, unsigned char unknown = 255);
+
+        // Distance [m] at (x, y) and its gradient, false before the first Update()
+        bool Distance(double x, double y, double &distance, double &grad_x, double &grad_y) const;
+
+        void SetMaxDistance(double max_distance);
+        bool Empty() const { return _size_x == 0; }
+
+        // Cells whose distance was recomputed by the last Update()
+        size_t UpdatedCells() const { return _updated; }
+
+    private:
+        typedef std::pair<int, int> Entry; // squared distance in cells, cell index
+        enum { NO_SITE = -1 };
+
+        void rebuild(unsigned int size_x, unsigned int size_y);
+        bool shift(int dx, int dy);
+        void setObstacle(int cell);
+        void removeObstacle(int cell);
+        void propagate();
+        void raise(int cell);
+        void lower(int cell);
+        void setSite(int cell, int site, int sq_dist);
+        int sqDist(int cell, int site) const;
+        double at(int cx, int cy) const;
+
+        double _max_distance;
+        int _size_x, _size_y;
+        double _resolution, _origin_x, _origin_y;
+
+        // Per cell: obstacle flag of the last Update(), nearest obstacle
+        // cell and squared distance to it in cells, raise wave flag, and
+        // the capped distance in meters read by Distance()
+        std::vector<unsigned char> _occupied;
+        std::vector<int> _site, _sq_dist;
+        std::vector<unsigned char> _to_raise;
+        std::vector<float> _distance;
+
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > _open;
+        size_t _updated;
+};
+
+#endif /* DISTANCE_FIELD_H */
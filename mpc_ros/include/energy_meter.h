@@ -0,0 +1,74 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef ENERGY_METER_H
+#define ENERGY_METER_H
+
+#include <string>
+
+// Energy the machine draws, to weigh horizons, backends and rates by joules
+// as well as by milliseconds. Unlike perf_counters it is not per thread:
+// the sources count a whole package or power rail, other processes
+// included, so a solve is best measured on an otherwise idle machine and
+// against the idle draw. Off until Enable(), which takes the first source
+// it can read of
+//   rapl   the package zones of /sys/class/powercap/intel-rapl:<n> (Intel,
+//          and AMD since Linux 5.8), root only since Linux 5.10
+//   perf   the energy-pkg event of the perf power PMU, one CPU per package
+//          (kernel.perf_event_paranoid at 0 or below)
+//   hwmon  the first energy<n>_input (uJ) or power<n>_input (uW, integrated
+//          between reads) of /sys/class/hwmon, the board rails of ARM
+//          boards with an INA or SCMI sensor
+// or reads the file given instead, which must follow the hwmon units. The
+// counters update about every millisecond: a stage much shorter than that
+// reads 0 or a whole update.
+namespace energy_meter
+{
+    // Start metering, false without a readable source
+    bool Enable(const std::string &path = "");
+    bool Enabled();
+
+    // Joules since Enable(), 0 while disabled. Thread safe, a read() of
+    // each zone or rail per call.
+    double Read();
+
+    // Source in use for reports: "rapl", "perf", "hwmon" or "" while disabled
+    const char *Name();
+}
+
+// Energy per stage of a control cycle, the counterpart of StageClock and
+// PerfClock
+class EnergyClock
+{
+    public:
+        EnergyClock() { Start(); }
+
+        void Start() { _last = energy_meter::Read(); }
+        // Joules since the previous Lap() (or Start())
+        double Lap()
+        {
+            const double now = energy_meter::Read();
+            const double lap = now - _last;
+            _last = now;
+            return lap;
+        }
+
+    private:
+        double _last;
+};
+
+#endif /* ENERGY_METER_H */
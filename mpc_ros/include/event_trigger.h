@@ -0,0 +1,68 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef EVENT_TRIGGER_H
+#define EVENT_TRIGGER_H
+
+#include <atomic>
+#include <vector>
+
+// Event-triggered MPC: while the robot follows the prediction of the last
+// solve, its input sequence is replayed instead of solving again. A new
+// solve is due when the measured pose leaves the predicted one by more than
+// max_position or max_heading, when the prediction is older than max_age or
+// past its horizon, and after Reset() (new plan or goal, failed solve).
+//
+// Store() and Holds() belong to the thread that solves; Reset() may be
+// called from any other (path callbacks).
+class EventTrigger
+{
+    public:
+        EventTrigger();
+
+        // max_position [m], max_heading [rad], max_age [s]
+        void Configure(bool enabled, double max_position, double max_heading, double max_age);
+        bool Enabled() const { return _enabled; }
+
+        // Prediction of a solve at time stamp. x, y, theta are in the frame
+        // of the robot pose (ox, oy, otheta) at stamp (the vehicle frame of
+        // the nodes), pose i is predicted at stamp + offset + the steps
+        // before it, dt each or step_dt[k] on a non-uniform grid. Before
+        // the first one the robot moves on from (ox, oy, otheta).
+        void Store(double stamp, double ox, double oy, double otheta, const std::vector<double> &x,
+                   const std::vector<double> &y, const std::vector<double> &theta, double offset, double dt,
+                   const std::vector<double> &step_dt);
+        void Reset() { _stale = true; }
+
+        // The robot measured at (x, y, theta) at time t is still on the
+        // prediction: replay it instead of solving
+        bool Holds(double t, double x, double y, double theta);
+
+        // Solves skipped since the last one
+        int Skipped() const { return _skipped; }
+
+    private:
+        bool _enabled;
+        double _max_position, _max_heading, _max_age;
+        std::atomic<bool> _stale;
+        double _stamp;
+        // Prediction in the frame of the measurements, _t absolute
+        std::vector<double> _t, _x, _y, _theta;
+        int _skipped;
+};
+
+#endif /* EVENT_TRIGGER_H */
@@ -0,0 +1,89 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include "work_stealing_pool.h"
+
+// Worker threads of a node or plugin, configured once, that its
+// subsystems submit their work to instead of starting threads of their
+// own, so the cores they use are chosen in one place.
+//
+// Each queue is a WorkStealingPool whose workers take the SCHED_FIFO
+// priority and CPUs of the queue (RealtimeSettings) when they start:
+//
+//   CONTROL     work a solve waits for: the stage Hessians of the tape
+//               backend (MPC::SetExecutor), the scoring of the hybrid
+//               fallback of MPCPlannerROS
+//   BACKGROUND  work nothing waits for: compiling the JIT models
+//               (ModelJit)
+//
+// A queue with 0 threads is off, its subsystems keep their own threads as
+// before. Threads bound to one piece of long running state stay out of the
+// executor: the solver, reference prep and log writer loops, the
+// hypotheses of MultiStart (tasks pinned to CppAD memory) and the tape
+// builds, which own their thread for CppAD's memory as well.
+class Executor
+{
+    public:
+        enum Queue { CONTROL = 0, BACKGROUND = 1, NUM_QUEUES };
+
+        struct QueueConfig
+        {
+            QueueConfig() : threads(0), priority(0) {}
+
+            int threads;
+            int priority;     // SCHED_FIFO 1..99, 0 leaves the scheduler alone
+            std::string cpus; // e.g. "2,3", empty for any CPU
+        };
+
+        Executor();
+
+        // Start the workers of every queue, once
+        void Configure(const QueueConfig config[NUM_QUEUES]);
+
+        // Pool of queue, NULL while the queue is off
+        const std::shared_ptr<WorkStealingPool> &Pool(int queue) const { return _pools[queue]; }
+        int Threads(int queue) const { return _pools[queue] ? _pools[queue]->Size() : 0; }
+
+        // Steps of the real-time setup the workers could not take, for the
+        // owner to log. Complete once every worker started.
+        std::string Report() const;
+
+        // "control", "background"
+        static const char *Name(int queue);
+
+    private:
+        Executor(const Executor &);
+        Executor &operator=(const Executor &);
+
+        // Shared with the workers, which may outlive the executor in the
+        // subsystems holding its pools
+        struct Reports
+        {
+            std::mutex mutex;
+            std::string text;
+        };
+
+        std::shared_ptr<WorkStealingPool> _pools[NUM_QUEUES];
+        std::shared_ptr<Reports> _report;
+};
+
+#endif /* EXECUTOR_H */
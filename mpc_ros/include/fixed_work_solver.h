@@ -0,0 +1,73 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef FIXED_WORK_SOLVER_H
+#define FIXED_WORK_SOLVER_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+#include "rti_solver.h"
+
+// Deterministic solve mode, for worst-case execution time evidence.
+//
+// Ipopt stops on its tolerances, so its iterations, and the time of a
+// solve, follow the data. This mode does the same work on every call:
+// SQP_ITERATIONS (1: the real-time iteration) Gauss-Newton SQP steps of
+// RtiSolver from the previous plan shifted by one step, each QP a Riccati
+// recursion with at most ACTIVE_SET_MAX_ITER active set iterations (the
+// one data dependent loop left, 0 keeps the RiccatiQp bound). The model
+// derivatives are closed form, there is no AD tape and no Ipopt. A QP that
+// fails keeps the shifted plan, so a failure costs no more than a solve.
+//
+// Init() sizes every buffer for the horizon of its parameters, after it
+// Solve() and Reset() do not allocate; Solve() runs in an EigenNoMalloc
+// scope and mpc_wcet counts the allocations with the hook library. LTV is
+// ignored, the sparse QP factorizes on the heap.
+class FixedWorkSolver
+{
+    public:
+        FixedWorkSolver();
+
+        // Same keys as MPC::LoadParams, and SQP_ITERATIONS and
+        // ACTIVE_SET_MAX_ITER. One solve from rest with n_coeffs path
+        // coefficients sizes the buffers.
+        void Init(const std::map<std::string, double> &params, int n_coeffs);
+
+        // First inputs of the plan from state (x, y, theta, v, cte, etheta)
+        // along coeffs. False if a QP failed.
+        bool Solve(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, double &angvel, double &accel);
+        // The next solve starts from rest
+        void Reset() { _vars.clear(); }
+
+        int Steps() const { return _steps; }
+        int SqpIterations() const { return _sqp_iterations; }
+        // Active set iterations of the QPs of the last solve
+        int QpIterations() const { return _qp_iterations; }
+        // Plan of the last solve in the MPC::Solve layout
+        const std::vector<double> &Plan() const { return _vars; }
+
+    private:
+        // Plan one step ahead in place, the last step repeated
+        void shift();
+
+        RtiSolver _rti;
+        std::vector<double> _vars;
+        int _steps, _sqp_iterations, _qp_iterations;
+};
+
+#endif /* FIXED_WORK_SOLVER_H */
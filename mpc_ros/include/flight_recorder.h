@@ -0,0 +1,107 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ipopt_journal.h"
+#include "trajectory_log.h"
+
+// What the solver got and did in one control cycle
+struct FlightFrame
+{
+    FlightFrame() : params_version(0), deadline_ms(0) {}
+
+    TrajectoryRecord record;      // inputs, command, status; seq is set by FlightRecorder
+    unsigned long params_version; // MPC::_mpc_params_version of the solve
+    double deadline_ms;           // solve budget, 0 without a deadline
+    IpoptJournal journal;         // MPC::_mpc_journal
+};
+
+// Always-on recorder of the last cycles of the controller.
+//
+// Record() keeps each cycle in a fixed ring without allocating. Whenever a
+// cycle misses its deadline, ends with a status other than success, or a
+// dump was asked for with Request(), the ring is copied to a second buffer
+// and a background thread writes it to <directory>/flight_<time>_<n>:
+//   .lg  the records in the TrajectoryLog format, replayed by mpc_solve_bench
+//   .txt the same cycles as text, with the parameter version and the last
+//        Ipopt iterates of every solve
+// If the writer is still busy with the previous dump the new one is
+// skipped, automatic dumps closer than min_interval are suppressed so a
+// sustained problem does not fill the disk.
+class FlightRecorder
+{
+    public:
+        // Reasons of a dump
+        enum { DEADLINE_MISS = 1, STATUS = 2, REQUEST = 4 };
+
+        FlightRecorder();
+        ~FlightRecorder();
+
+        // Allocate cycles frames and start the writer, empty directory is
+        // the working directory.
+        bool Open(const std::string &directory, size_t cycles = 100, double min_interval = 5.0);
+        void Close();
+        bool IsOpen() const { return _running.load(); }
+
+        // From the control thread only. Never blocks.
+        void Record(const FlightFrame &frame);
+        // From any thread: dump after the next Record()
+        void Request() { _requested.store(true); }
+
+        unsigned long Dumps() const { return _dumps.load(); }
+        unsigned long Skipped() const { return _skipped.load(); }
+        // File of the last dump without the extension, empty before the first
+        std::string LastDump();
+
+        // Reasons to dump frame for, 0 if it is a normal cycle
+        static int Anomaly(const FlightFrame &frame);
+
+    private:
+        void run();
+        void write(const std::string &path, int reason);
+
+        std::string _directory;
+        double _min_interval;
+        double _last_stamp; // of the last automatic dump
+        uint32_t _seq;
+
+        // Ring of the control thread, _count cycles ending before _next
+        std::vector<FlightFrame> _frames;
+        size_t _next, _count;
+
+        // Copy of the ring for the writer, owned by it while _pending
+        std::vector<FlightFrame> _snapshot;
+        size_t _snapshot_size;
+        int _reason;
+        bool _pending;
+        std::string _last_dump;
+        std::mutex _mutex;
+        std::condition_variable _wake;
+
+        std::thread _writer;
+        std::atomic<bool> _running, _requested;
+        std::atomic<unsigned long> _dumps, _skipped;
+};
+
+#endif /* FLIGHT_RECORDER_H */
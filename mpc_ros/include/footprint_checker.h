@@ -0,0 +1,65 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef FOOTPRINT_CHECKER_H
+#define FOOTPRINT_CHECKER_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Collision check of a whole predicted trajectory against a costmap.
+//
+// The footprint polygon is rasterized once per heading bin into row spans
+// of cell offsets around the cell of the robot center. A span covers the
+// polygon grown by one cell, so that it holds wherever in its cell the
+// center is. Checking a pose then reads a few contiguous runs of the cost
+// array, one per footprint row, with no geometry left in the loop.
+class FootprintChecker
+{
+    public:
+        FootprintChecker(int headings = 64);
+
+        // Footprint points (x, y) in the robot frame [m]. The masks are only
+        // built again when the polygon or the resolution changed.
+        void SetFootprint(const std::vector<std::pair<double, double> > &polygon, double resolution);
+        bool Empty() const { return _masks.empty(); }
+
+        // Highest cost under the footprint over poses [begin, n) of the
+        // trajectory, in the frame of the grid (cell (0, 0) spans
+        // [origin, origin + resolution), costs row major). Cells off the
+        // grid are not looked at, unknown cells count as free. first_lethal
+        // is the first pose on a cost >= lethal, -1 if none.
+        int TrajectoryCost(const unsigned char *costs, unsigned int size_x, unsigned int size_y,
+                           double origin_x, double origin_y,
+                           const double *x, const double *y, const double *theta, size_t n, size_t begin,
+                           unsigned char lethal, unsigned char unknown, int &first_lethal) const;
+
+    private:
+        struct Span
+        {
+            int dy, dx0, dx1; // cells [dx0, dx1] of row dy
+        };
+
+        void build();
+
+        int _headings;
+        double _resolution;
+        std::vector<std::pair<double, double> > _polygon;
+        std::vector<std::vector<Span> > _masks; // per heading bin
+};
+
+#endif /* FOOTPRINT_CHECKER_H */
@@ -0,0 +1,85 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef FREE_CORRIDOR_H
+#define FREE_CORRIDOR_H
+
+#include <cstddef>
+#include <vector>
+
+// Convex polygons of free space along the horizon, for the corridor
+// constraints of the planner MPC (MPC::SetCorridorModel).
+//
+// Update() collects the obstacle cells of the costmap around the seeds (one
+// point per horizon step) and grows one polygon per seed: the nearest
+// obstacle point still inside the polygon adds a face tangent to it, facing
+// the seed and backed off by the margin, which cuts away every point behind
+// it, until no point is left or the faces run out. Each polygon is then at
+// most `faces` half-planes n . p <= b and contains its seed. Obstacles
+// farther than range from the seed are not looked at, with too few faces
+// some may stay inside; the obstacle term still sees those.
+//
+// The window slides by about one step per cycle, so a polygon of the last
+// Update() that still holds the new seed with the margin and still has no
+// obstacle point inside is kept instead of grown again: the constraints of
+// a step stay the same from one cycle to the next while the map is.
+class FreeCorridor
+{
+    public:
+        enum { MAX_FACES = 8 };
+
+        FreeCorridor();
+
+        // faces per polygon (clamped to [3, MAX_FACES]), range around the
+        // seed [m], margin kept from the obstacle points [m]
+        void Configure(int faces, double range, double margin);
+        int Faces() const { return _faces; }
+
+        // Polygons around the n seeds (x[i], y[i]) of the grid of size_x *
+        // size_y costs, row major, cell (0, 0) spanning [origin, origin +
+        // resolution). Costs >= threshold are obstacles except those >=
+        // unknown (costmap_2d: 253 inscribed, 254 lethal, 255 no information).
+        void Update(const double *x, const double *y, size_t n, const unsigned char *costs, unsigned int size_x,
+                    unsigned int size_y, double resolution, double origin_x, double origin_y,
+                    unsigned char threshold = 253, unsigned char unknown = 255);
+
+        // Faces of polygon i in the frame at (ox, oy, yaw) of the grid: 3 *
+        // Faces() entries (a_x, a_y, b) from model[3 * Faces() * i], unused
+        // faces read 0 <= 1
+        void Faces(size_t i, double ox, double oy, double yaw, double *model) const;
+
+        size_t Polygons() const { return _seeds.size() / 2; }
+        // Polygons of the last Update() kept from the one before
+        size_t Reused() const { return _reused; }
+
+    private:
+        bool inside(size_t polygon, double x, double y, double slack) const;
+        bool free(size_t polygon) const;
+        void grow(size_t polygon, double sx, double sy);
+
+        int _faces;
+        double _range, _margin;
+
+        // Per polygon the seed (x, y) and _faces faces (n_x, n_y, b), unused
+        // ones 0 <= 1; the previous Update() in the _prev_ ones
+        std::vector<double> _seeds, _polygons, _prev_seeds, _prev_polygons;
+        // Obstacle points (x, y) around all seeds, those of one seed and
+        // the working set of grow()
+        std::vector<double> _points, _local, _open;
+        size_t _reused;
+};
+
+#endif /* FREE_CORRIDOR_H */
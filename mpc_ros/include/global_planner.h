@@ -13,15 +13,28 @@
  #include <nav_msgs/Path.h>
 #include <tf/transform_listener.h>
 #include <geometry_msgs/Twist.h>
+#include <ros/callback_queue.h>
 
 #include <Eigen/Core>
 #include <Eigen/QR>
+#include "path_index.h"
+#include "compact_path_msg.h"
+#include "latest_msg.h"
+#include "transform_cache.h"
+#include "path_transform.h"
+#include "route_store.h"
+#include "grid_planner.h"
+#include "hybrid_astar.h"
+#include "trajectory_log.h"
+#include "tracking_analytics.h"
+#include "metrics_exporter.h"
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <map>
 
 // inlcude iostream and string libraries
 #include <iostream>
-#include <fstream>
 #include <string>
 
  using std::string;
@@ -46,36 +59,76 @@
                );
   
     ros::NodeHandle _nh;
-    ros::Timer _errtimer;
     ros::Publisher _pub_globalpath;
     ros::Subscriber _sub_odom, _sub_get_path, _sub_goal, _sub_cmd;
     nav_msgs::Odometry _odom;
-    nav_msgs::Path _odom_path;
-    nav_msgs::Path _desired_path;
+    LatestMsg<CompactPath> _desired_path; // decoded straight from the message, see compact_path_msg.h
     tf::TransformListener _tf_listener;
+    TransformCache _tf_cache; // see transform_cache.h
+    PathTransform _path_transform; // see path_transform.h
+    // Precomputed route from ~<name>/route_file, replaces desired_path
+    RouteStore _route;
+    std::string _route_frame;
+    size_t _route_hint;
+    // Last replayed plan. It is reused while the path (or the route), its
+    // transform to map and the goal stay the same: the path is transformed
+    // once, and unmoved progress returns the cached window.
+    CompactPath::ConstPtr _cache_path; // NULL for the route
+    tf::Transform _cache_transform;
+    geometry_msgs::PoseStamped _cache_goal;
+    std::vector<geometry_msgs::PoseStamped> _cache_poses; // desired path in map
+    CompactPath _cache_map_path;
+    std::vector<geometry_msgs::PoseStamped> _cache_plan;
+    int _cache_start; // min_idx of _cache_plan, -1 for none
+    // Search on the global costmap instead (~<name>/planner grid or
+    // hybrid), see grid_planner.h and hybrid_astar.h
+    costmap_2d::Costmap2DROS* _costmap_ros;
+    std::string _planner;
+    GridPlanner _grid;
+    HybridAStar _hybrid;
+    std::vector<unsigned char> _grid_costs;
+    std::vector<int> _grid_cells;
+    std::vector<HybridAStar::Pose2> _hybrid_path;
 
     double _waypointsDist;  //minimum distance between points of path
     int min_idx; //nearest point
+    PathIndex _path_index;
     double _pathLength;
     double _cte;
     double _oreient;
     int _controller_freq;
-    bool _goal_received;
+    std::atomic<bool> _goal_received;
     double _linear_vel;
     double _angular_vel;
 
-    unsigned int idx;
-    std::fstream file;
+    // Tracking error against the last plan. Odometry and commands are
+    // served by a callback queue and thread of their own, the planner only
+    // hands over the plan, see tracking_analytics.h
+    ros::CallbackQueue _analytics_queue;
+    std::unique_ptr<ros::AsyncSpinner> _analytics_spinner;
+    ros::Subscriber _sub_analytics_odom;
+    ros::Timer _analytics_timer;
+    LatestMsg<CompactPath> _tracked_path; // the part ahead of the last plan
+    TrackingAnalytics _analytics;
+    MetricsExporter _metrics;
+    // Binary trajectory log of the tracking error, ~<name>/log_path
+    TrajectoryLog _log;
 
     void odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg);
-    void desiredPathCB(const nav_msgs::Path::ConstPtr& pathMsg);
+    void desiredPathCB(const CompactPath::ConstPtr& pathMsg);
     void goalCB(const geometry_msgs::PoseStamped::ConstPtr& goalMsg);
-    void CalError(const ros::TimerEvent&);
+    void analyticsOdomCB(const nav_msgs::Odometry::ConstPtr& odomMsg);
+    void analyticsReport(const ros::TimerEvent&);
     void getCmdCB(const geometry_msgs::Twist&);
-
-    double polyeval(Eigen::VectorXd coeffs, double x);        
-    Eigen::VectorXd polyfit(Eigen::VectorXd xvals, Eigen::VectorXd yvals, int order);
-
+    bool routePlan(const nav_msgs::Odometry &odom, const geometry_msgs::PoseStamped& goal,
+                   std::vector<geometry_msgs::PoseStamped>& plan);
+    bool cachedPlan(const CompactPath::ConstPtr &path, const tf::Transform &transform,
+                    const geometry_msgs::PoseStamped& goal, int start, std::vector<geometry_msgs::PoseStamped>& plan) const;
+    void storePlan(const CompactPath::ConstPtr &path, const tf::Transform &transform,
+                   const geometry_msgs::PoseStamped& goal, int start, const std::vector<geometry_msgs::PoseStamped>& plan, size_t first);
+    bool costmapPlan(const geometry_msgs::PoseStamped& start, const geometry_msgs::PoseStamped& goal,
+                     std::vector<geometry_msgs::PoseStamped>& plan);
+    void trackPath(const CompactPath &path);
 
   };
  };
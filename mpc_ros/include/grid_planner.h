@@ -0,0 +1,110 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef GRID_PLANNER_H
+#define GRID_PLANNER_H
+
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+// Shortest path over the cells of a costmap, for GeonPlanner.
+//
+// D* Lite (Koenig and Likhachev) on the 8 connected grid: the search runs
+// from the goal, so its tree stays valid while the robot moves, and
+// Update() compares the grid with the one of the previous call and only
+// repairs the search around the cells whose cost changed. A plan to the
+// same goal then costs about the number of changed cells instead of the
+// size of the map. Another goal, size, resolution or origin starts over.
+//
+// A step costs its length, 7/5 for a diagonal, times 1 + cost_factor *
+// cost / 252 averaged over its two cells; inscribed and lethal cells
+// (costmap_2d: 253 and 254) are never entered, unknown cells (255) only with
+// allow_unknown, as free cells.
+class GridPlanner
+{
+    public:
+        GridPlanner(double cost_factor = 3.0, bool allow_unknown = false);
+
+        // Grid of size_x * size_y costs, row major, cell (0, 0) spans
+        // [origin, origin + resolution)
+        void Update(const unsigned char *costs, unsigned int size_x, unsigned int size_y,
+                    double resolution, double origin_x, double origin_y);
+
+        // Cells from start to goal, both included. False when the goal
+        // cannot be reached or a cell is outside the grid or not free.
+        bool Plan(int start_x, int start_y, int goal_x, int goal_y, std::vector<int> &cells);
+
+        void SetCostFactor(double cost_factor);
+        void SetAllowUnknown(bool allow_unknown);
+        void Reset();
+
+        int SizeX() const { return _size_x; }
+        int SizeY() const { return _size_y; }
+        double Resolution() const { return _resolution; }
+        double OriginX() const { return _origin_x; }
+        double OriginY() const { return _origin_y; }
+        int Index(int cx, int cy) const { return cy * _size_x + cx; }
+        bool Inside(int cx, int cy) const { return cx >= 0 && cy >= 0 && cx < _size_x && cy < _size_y; }
+
+        // Cost multiplier of entering cell, infinite for cells never entered
+        double Traversal(int cell) const { return _traversal[cell] * 0.01; }
+        // Cost from cell to the goal of the last Plan() in straight steps,
+        // a lower bound where the search did not reach
+        double CostToGoal(int cell) const;
+
+        // Cells whose cost changed in the updates before the last Plan(),
+        // and cells expanded by it
+        size_t ChangedCells() const { return _changed_cells; }
+        size_t Expanded() const { return _expanded; }
+
+    private:
+        typedef std::pair<double, double> Key;
+        typedef std::pair<Key, int> Entry; // key, cell
+
+        void rebuild(unsigned int size_x, unsigned int size_y);
+        void setTraversal(int cell, unsigned char cost);
+        void restart(int goal);
+        Key key(int cell) const;
+        void updateCell(int cell);
+        void computePath();
+        double edge(int from, int to, int n) const;
+        double heuristic(int a, int b) const;
+
+        double _cost_factor;
+        bool _allow_unknown;
+        int _size_x, _size_y;
+        double _resolution, _origin_x, _origin_y;
+
+        // Per cell: cost of the last Update(), cost multiplier in
+        // hundredths, and the cost to the goal (g) and its one step
+        // lookahead (rhs) of D* Lite
+        std::vector<unsigned char> _costs;
+        std::vector<float> _traversal;
+        std::vector<double> _g, _rhs;
+        std::vector<int> _changed;
+
+        // Entries are never removed, an entry whose key is out of date is
+        // skipped or pushed again when it comes up
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > _open;
+        int _start, _last_start, _goal;
+        double _km;
+        size_t _changed_cells, _expanded;
+};
+
+#endif /* GRID_PLANNER_H */
@@ -0,0 +1,135 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef HARDWARE_CONTROLLER_H
+#define HARDWARE_CONTROLLER_H
+
+#include <string>
+#include <boost/shared_ptr.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <controller_interface/controller.h>
+#include <hardware_interface/joint_command_interface.h>
+#include <ros/ros.h>
+#include "command_window.h"
+#include "latest_value.h"
+
+// Runs one of the controller classes of the nodes as a ros_control
+// controller, the way ControllerNodelet runs them in a nodelet manager.
+// Node is constructed from the root and controller node handles, so its
+// timers and subscribers (and the solver thread with mpc_async_solve) run
+// on the non real-time callback threads of the controller manager. Instead
+// of publishing cmd_vel or wheel commands it hands every command sequence
+// over through a LatestValue<CommandWindow> (Node::SetCommandSink), and
+// update() samples the sequence at the time of the hardware loop and writes
+// the two wheel joints directly: no message, no lock, no allocation.
+//
+// Interface is the joint interface of the wheels:
+// - VelocityJointInterface: wheel speeds from the speed and angvel of the
+//   sequence
+// - EffortJointInterface: the torques of the DYNAMIC model if the sequence
+//   has them, otherwise wheel_torque_gain times the wheel speed error, the
+//   wheel loop of tracking_reference_trajectory at the rate of the hardware
+//
+// Parameters, in the namespace of the controller besides those of Node:
+// left_wheel_joint, right_wheel_joint, wheel_radius, track_width,
+// wheel_torque_gain, and command_timeout (stop the wheels when the newest
+// sequence is older) [s].
+template <class Node, class Interface>
+class HardwareController : public controller_interface::Controller<Interface>
+{
+    public:
+        HardwareController()
+            : _wheel_radius(0.1), _track_width(0.265), _gain(0.001), _timeout(0.5) {}
+
+        virtual bool init(Interface *hw, ros::NodeHandle &root_nh, ros::NodeHandle &controller_nh)
+        {
+            std::string left, right;
+            controller_nh.param<std::string>("left_wheel_joint", left, "left_wheel_joint");
+            controller_nh.param<std::string>("right_wheel_joint", right, "right_wheel_joint");
+            controller_nh.param("wheel_radius", _wheel_radius, _wheel_radius); // unit: m
+            controller_nh.param("track_width", _track_width, _track_width); // distance between the wheels, unit: m
+            controller_nh.param("wheel_torque_gain", _gain, _gain); // torque per wheel speed error [Nm s/rad]
+            controller_nh.param("command_timeout", _timeout, _timeout); // unit: s
+            try
+            {
+                _left = hw->getHandle(left);
+                _right = hw->getHandle(right);
+            }
+            catch (const hardware_interface::HardwareInterfaceException &e)
+            {
+                ROS_ERROR_STREAM("HardwareController: " << e.what());
+                return false;
+            }
+
+            _node.reset(new Node(root_nh, controller_nh));
+            _node->SetCommandSink(&_commands);
+            return true;
+        }
+
+        virtual void starting(const ros::Time &)
+        {
+            write(0.0, 0.0, false);
+        }
+
+        virtual void update(const ros::Time &time, const ros::Duration &)
+        {
+            const double t = time.toSec();
+            int k = -1;
+            if (_commands.Get(_window) && t - _window.stamp < _timeout)
+                k = _window.Step(t);
+            if (k < 0)
+            {
+                write(0.0, 0.0, false);
+                return;
+            }
+            if (EFFORT && _window.torques)
+            {
+                write(_window.torque_right[k], _window.torque_left[k], true);
+                return;
+            }
+            const double half = _window.angvel[k] * _track_width / 2;
+            write((_window.speed[k] + half) / _wheel_radius, (_window.speed[k] - half) / _wheel_radius, false);
+        }
+
+        virtual void stopping(const ros::Time &)
+        {
+            write(0.0, 0.0, false);
+        }
+
+    private:
+        static const bool EFFORT = boost::is_same<Interface, hardware_interface::EffortJointInterface>::value;
+
+        // Wheel speeds [rad/s], or torques [N m] if torques is set
+        void write(double right, double left, bool torques)
+        {
+            if (EFFORT && !torques)
+            {
+                right = _gain * (right - _right.getVelocity());
+                left = _gain * (left - _left.getVelocity());
+            }
+            _right.setCommand(right);
+            _left.setCommand(left);
+        }
+
+        // Declared before _node, which writes it until it is destroyed
+        LatestValue<CommandWindow> _commands;
+        CommandWindow _window;
+        hardware_interface::JointHandle _left, _right;
+        boost::shared_ptr<Node> _node;
+        double _wheel_radius, _track_width, _gain, _timeout;
+};
+
+#endif /* HARDWARE_CONTROLLER_H */
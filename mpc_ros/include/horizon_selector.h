@@ -0,0 +1,82 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef HORIZON_SELECTOR_H
+#define HORIZON_SELECTOR_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+#include "solve_time_model.h"
+
+// Horizon (steps and dt) of the next MPC solve in adaptive horizon mode.
+//
+// The candidates are N = MIN_STEPS, MIN_STEPS + HORIZON_STEP, ..., STEPS at
+// DT, and the same N at 2 * DT. A solve has to look HORIZON_PREVIEW seconds
+// ahead plus the time to brake from the current speed at MAXTHR. The
+// shortest fine candidate that covers it is picked; the coarse dt only
+// when no fine one does and the path bends less than 0.05 rad per coarse
+// step at the current speed. Candidates whose solve time, predicted from
+// the measured time per step, exceeds the budget are dropped down to
+// MIN_STEPS; with a SolveTimeModel that is ready its prediction for this
+// solve replaces the time per step. Longer horizons are taken at once, shorter ones after HOLD
+// cycles in a row of asking for them, so that the warm start (lost on a
+// switch) is not thrown away every cycle.
+class HorizonSelector
+{
+    public:
+        struct Horizon
+        {
+            int steps;
+            double dt;
+        };
+
+        HorizonSelector();
+
+        // Same keys as MPC::LoadParams, ADAPTIVE enables the mode
+        void LoadParams(const std::map<std::string, double> &params);
+        bool Enabled() const { return _enabled; }
+
+        const std::vector<Horizon> &Candidates() const { return _candidates; }
+
+        // Candidate for a solve at speed v on the path polynomial coeffs
+        // (vehicle frame) within budget seconds (<= 0: no limit). Choose()
+        // leaves the state alone, Next() makes the choice current.
+        int Choose(double v, const Eigen::VectorXd &coeffs, double budget) const;
+        int Next(double v, const Eigen::VectorXd &coeffs, double budget);
+        int Current() const { return _current; }
+
+        // Wall time of a solve on candidate index
+        void Measure(int index, double seconds);
+        // Predicts the solve times instead of Measure(), NULL for none
+        void SetPredictor(const SolveTimeModel *model) { _model = model; }
+
+    private:
+        int desired(double v, const Eigen::VectorXd &coeffs, double budget) const;
+
+        bool _enabled;
+        std::vector<Horizon> _candidates; // fine ones first, by steps
+        int _fine;                        // number of fine candidates
+        double _preview, _max_throttle;
+        int _hold;
+
+        int _current, _shorter_cycles;
+        double _step_time; // measured solve time per step [s], 0 before the first
+        const SolveTimeModel *_model;
+};
+
+#endif /* HORIZON_SELECTOR_H */
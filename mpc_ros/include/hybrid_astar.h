@@ -0,0 +1,79 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef HYBRID_ASTAR_H
+#define HYBRID_ASTAR_H
+
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "grid_planner.h"
+
+// Kinematically feasible plan for GeonPlanner's hybrid mode.
+//
+// Hybrid A* (Dolgov et al.): nodes are continuous poses, expanded by arcs of
+// the minimum turning radius to the left and right and a straight segment,
+// one cell diagonal long, forward only. A node is kept per cell and heading
+// bin. The heuristic is the cost to the goal of GridPlanner, which has to
+// have planned to the same goal, so obstacles are accounted for and its
+// incremental repairs carry over. It is weighted by heuristic_weight: the
+// 8 connected costs are flat over many headings and a corner the grid path
+// cuts tighter than the turning radius, unweighted the search floods them.
+// Arcs are costed like GridPlanner steps, turns a little more so straight
+// lines win ties.
+class HybridAStar
+{
+    public:
+        struct Pose2
+        {
+            double x, y, yaw;
+        };
+
+        HybridAStar(double min_turning_radius = 0.5, int heading_bins = 72, int max_expansions = 100000,
+                    double heuristic_weight = 2.0);
+
+        // Poses from start to goal [m, rad], the last one is goal. False
+        // when the goal was not reached within max_expansions.
+        bool Plan(const GridPlanner &grid, const Pose2 &start, const Pose2 &goal, std::vector<Pose2> &path);
+
+        void Configure(double min_turning_radius, int heading_bins, int max_expansions, double heuristic_weight);
+        size_t Expanded() const { return _expanded; }
+
+    private:
+        struct Node
+        {
+            Pose2 pose;
+            double g;
+            int parent;
+        };
+        typedef std::pair<double, int> Entry; // f, node
+
+        bool collides(const GridPlanner &grid, const Pose2 &from, double curvature, double length, Pose2 &to) const;
+        long long bin(const GridPlanner &grid, const Pose2 &pose, int &cell) const;
+
+        double _min_turning_radius, _heuristic_weight;
+        int _heading_bins, _max_expansions;
+        std::vector<Node> _nodes;
+        std::unordered_map<long long, int> _best; // node per visited cell and heading bin
+        std::vector<unsigned char> _closed; // per node
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > _open;
+        size_t _expanded;
+};
+
+#endif /* HYBRID_ASTAR_H */
@@ -0,0 +1,71 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef INPUT_SPLINE_H
+#define INPUT_SPLINE_H
+
+#include <vector>
+
+// B-spline inputs of the MPC (INPUT_SPLINE): angvel and accel over the
+// horizon are each a clamped cubic B-spline of a few control points, and
+// the control points are the decision variables instead of one input per
+// step (or per block, see move_blocks.h). The input of a step is a fixed
+// linear combination of at most four neighbouring points, so the inputs
+// are smooth by construction, and as the spline stays within the hull of
+// its points, bounds on the points bound every input.
+//
+// The spline runs over the start times of the steps - 1 inputs (the time
+// grid, see time_grid.h, or uniform), clamped so that the first input is
+// the first point and the last input the last point.
+class InputSpline
+{
+    public:
+        InputSpline() : _points(0) {}
+
+        // points control points (at least 4, at most steps - 1) over the
+        // inputs of steps with the transitions step_dt, empty: uniform.
+        // False, and no spline, otherwise.
+        bool Set(int points, int steps, const std::vector<double> &step_dt);
+        void Clear();
+
+        bool Enabled() const { return _points > 0; }
+        int Points() const { return _points; }
+
+        // Input of step i from the points at vars[start ...]
+        template <class Vector>
+        typename Vector::value_type Value(const Vector &vars, int start, int i) const
+        {
+            const int first = start + _first[i];
+            const double *weight = &_weight[4 * i];
+            return weight[0] * vars[first] + weight[1] * vars[first + 1] + weight[2] * vars[first + 2]
+                   + weight[3] * vars[first + 3];
+        }
+
+        // Step whose input sets point k when a plan of one input per step
+        // is turned into points (warm start, seeds): the nearest one to the
+        // Greville abscissa of the point, where the point pulls hardest
+        int Sample(int k) const { return _sample[k]; }
+        // First of the four points input i is made of
+        int First(int i) const { return _first[i]; }
+
+    private:
+        int _points;
+        std::vector<int> _first; // first point of each input
+        std::vector<double> _weight; // four weights per input
+        std::vector<int> _sample; // per point
+};
+
+#endif /* INPUT_SPLINE_H */
@@ -0,0 +1,113 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef INTEGRATOR_H
+#define INTEGRATOR_H
+
+#include "cppad_instance.h"
+
+// Integration of the unicycle states of the MPC models over one step dt
+// (INTEGRATOR), x' = v cos(theta), y' = v sin(theta), theta' = w, v' = a,
+// with w and a held over the step. theta and v are linear in time, so
+// every method integrates them exactly and differs only in x and y:
+//
+//   EULER  x0 + v0 cos(theta0) dt, the model of the original FG_eval
+//   RK2    midpoint rule, error O(dt^3) per step
+//   RK4    classical Runge-Kutta (cppad/utility/runge_45.hpp is the
+//          adaptive relative). k2 == k3 here since the right-hand side
+//          does not depend on x and y, which leaves Simpson's rule,
+//          error O(dt^5) per step
+//   ARC    closed form over the arc, exact. Below |w| < ARC_MIN_ANGVEL
+//          the closed form loses its digits to cancellation and RK4 is
+//          used in its place (through CondExp, so it stays one tape).
+//
+// sin and cos of an angle are taken together (CppAD::sincos), one SinOp
+// on the tape for both.
+//
+// A few operations more per step buy a larger dt for the same prediction,
+// so the same preview distance takes fewer steps.
+namespace integrator
+{
+    enum Method { EULER = 0, RK2 = 1, RK4 = 2, ARC = 3 };
+
+    const double ARC_MIN_ANGVEL = 1e-3; // [rad/s]
+
+    // Name of the method for logs
+    inline const char *Name(int method)
+    {
+        switch (method)
+        {
+            case RK2: return "rk2";
+            case RK4: return "rk4";
+            case ARC: return "arc";
+            default: return "euler";
+        }
+    }
+
+    // State at t + dt from the state at t and the inputs w, a. dt is a
+    // double, or a Scalar when it is a parameter of the tape.
+    template <class Scalar, class Time>
+    void Step(int method, const Time &dt, const Scalar &x0, const Scalar &y0, const Scalar &theta0, const Scalar &v0,
+              const Scalar &w, const Scalar &a, Scalar &x1, Scalar &y1, Scalar &theta1, Scalar &v1)
+    {
+        theta1 = theta0 + w * dt;
+        v1 = v0 + a * dt;
+        if (method == RK2)
+        {
+            const Scalar thetam = theta0 + w * (0.5 * dt);
+            const Scalar vm = v0 + a * (0.5 * dt);
+            Scalar sinm, cosm;
+            CppAD::sincos(thetam, sinm, cosm);
+            x1 = x0 + vm * cosm * dt;
+            y1 = y0 + vm * sinm * dt;
+        }
+        else if (method == RK4 || method == ARC)
+        {
+            const Scalar thetam = theta0 + w * (0.5 * dt);
+            const Scalar vm = v0 + a * (0.5 * dt);
+            Scalar sin0, cos0, sinm, cosm, sin1, cos1;
+            CppAD::sincos(theta0, sin0, cos0);
+            CppAD::sincos(thetam, sinm, cosm);
+            CppAD::sincos(theta1, sin1, cos1);
+            x1 = x0 + (v0 * cos0 + 4.0 * vm * cosm + v1 * cos1) * (dt / 6.0);
+            y1 = y0 + (v0 * sin0 + 4.0 * vm * sinm + v1 * sin1) * (dt / 6.0);
+            if (method == ARC)
+            {
+                // int (v0 + a t) cos(theta0 + w t) dt by parts. On straight
+                // steps, where it is not taken, the closed form is
+                // evaluated at w = 1 to keep NaN out of the sweeps.
+                const Scalar w_abs = CppAD::abs(w), w_min(ARC_MIN_ANGVEL);
+                const Scalar ws = CppAD::CondExpLt(w_abs, w_min, Scalar(1.0), w);
+                Scalar sinw, cosw;
+                CppAD::sincos(theta0 + ws * dt, sinw, cosw);
+                const Scalar x_arc = x0 + (v1 * sinw - v0 * sin0) / ws + a * (cosw - cos0) / (ws * ws);
+                const Scalar y_arc = y0 - (v1 * cosw - v0 * cos0) / ws + a * (sinw - sin0) / (ws * ws);
+                x1 = CppAD::CondExpLt(w_abs, w_min, x1, x_arc);
+                y1 = CppAD::CondExpLt(w_abs, w_min, y1, y_arc);
+            }
+        }
+        else
+        {
+            Scalar sin0, cos0;
+            CppAD::sincos(theta0, sin0, cos0);
+            x1 = x0 + v0 * cos0 * dt;
+            y1 = y0 + v0 * sin0 * dt;
+        }
+    }
+}
+
+#endif /* INTEGRATOR_H */
@@ -0,0 +1,57 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef IPOPT_JOURNAL_H
+#define IPOPT_JOURNAL_H
+
+#include <cstddef>
+#include <cstdint>
+
+// One line of the Ipopt iteration output, in single precision
+struct IpoptIterate
+{
+    int32_t iter;
+    int32_t ls_trials;
+    float obj, inf_pr, inf_du, mu, d_norm, alpha_pr;
+};
+
+// The last CAPACITY iterates of one solve, fixed size so that it can be
+// copied around without allocating (flight_recorder.h). Earlier iterates
+// are overwritten and only counted.
+struct IpoptJournal
+{
+    static const size_t CAPACITY = 16;
+
+    IpoptJournal() { Clear(); }
+
+    void Clear() { count = 0; }
+    void Add(const IpoptIterate &iterate)
+    {
+        iterates[count % CAPACITY] = iterate;
+        count++;
+    }
+    // Iterates kept and the i-th one of them, oldest first
+    size_t Size() const { return count < CAPACITY ? count : CAPACITY; }
+    const IpoptIterate &At(size_t i) const
+    {
+        return iterates[count <= CAPACITY ? i : (count + i) % CAPACITY];
+    }
+
+    uint32_t count; // iterates of the solve, kept or not
+    IpoptIterate iterates[CAPACITY];
+};
+
+#endif /* IPOPT_JOURNAL_H */
@@ -0,0 +1,46 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef IPOPT_OPTIONS_H
+#define IPOPT_OPTIONS_H
+
+#include <string>
+
+// Ipopt options file of MPC::SetIpoptOptions(), as written by
+// mpc_ipopt_tune: one option per line in the CppAD::ipopt::solve syntax,
+//
+//   # comment
+//   String  mu_strategy adaptive
+//   Numeric bound_push  1e-6
+//
+// The lines go after the options MPC::Solve sets itself and override
+// them, except for the termination settings of the solve policy.
+namespace ipopt_options
+{
+    // Checked option lines of text, comments and blank lines dropped.
+    // False with the line number in error for a line that is not
+    // "String|Numeric|Integer name value" (or whose value is no number),
+    // Sparse and Coloring are CppAD's and not taken either.
+    bool Parse(const std::string &text, std::string &options, std::string &error);
+
+    // Parse() of the file at path
+    bool Load(const std::string &path, std::string &options, std::string &error);
+
+    // options under the comment lines of header, false if path cannot be written
+    bool Write(const std::string &path, const std::string &options, const std::string &header);
+}
+
+#endif /* IPOPT_OPTIONS_H */
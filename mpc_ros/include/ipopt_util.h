@@ -0,0 +1,231 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef IPOPT_UTIL_H
+#define IPOPT_UTIL_H
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include "cppad_instance.h"
+#include <cppad/ipopt/solve_result.hpp>
+#include <coin/IpIpoptApplication.hpp>
+#include <coin/IpTNLP.hpp>
+
+// Pieces of CppAD::ipopt::solve shared by the TNLPs of this package
+// (TapeSolver, AnalyticSolver), so that they accept the same options and
+// report results the same way, and the IpoptApplication they keep.
+namespace ipopt_util
+{
+    typedef CPPAD_TESTVECTOR(double) Dvector;
+    typedef CppAD::ipopt::solve_result<Dvector> SolveResult;
+
+    // Sparse Jacobian method, the direction of the last "Sparse true" line:
+    // reverse or forward mode over a coloring, or reverse mode over the
+    // subgraph of each row (no coloring)
+    enum Jacobian { JACOBIAN_REVERSE, JACOBIAN_FORWARD, JACOBIAN_SUBGRAPH };
+
+    // Options in the CppAD::ipopt::solve syntax, one per line.
+    inline void ApplyOptions(Ipopt::IpoptApplication &app, const std::string &options, Jacobian &jacobian)
+    {
+        jacobian = JACOBIAN_REVERSE;
+        std::istringstream lines(options);
+        std::string line;
+        while (std::getline(lines, line))
+        {
+            std::istringstream tokens(line);
+            std::string tok_1, tok_2, tok_3;
+            if (!(tokens >> tok_1 >> tok_2))
+                continue;
+            tokens >> tok_3;
+
+            if (tok_1 == "Sparse")
+                jacobian = tok_2 != "true" ? JACOBIAN_REVERSE
+                           : tok_3 == "forward" ? JACOBIAN_FORWARD
+                           : tok_3 == "subgraph" ? JACOBIAN_SUBGRAPH : JACOBIAN_REVERSE;
+            else if (tok_1 == "String")
+                app.Options()->SetStringValue(tok_2, tok_3);
+            else if (tok_1 == "Numeric")
+                app.Options()->SetNumericValue(tok_2, std::atof(tok_3.c_str()));
+            else if (tok_1 == "Integer")
+                app.Options()->SetIntegerValue(tok_2, std::atoi(tok_3.c_str()));
+        }
+    }
+
+    // Options a PersistentIpopt changes on the running application instead
+    // of creating a new one: the termination settings of SolvePolicy
+    inline bool IsTuningOption(const std::string &name)
+    {
+        return name == "tol" || name == "acceptable_tol" || name == "acceptable_iter" ||
+               name == "max_iter" || name == "mu_strategy";
+    }
+
+    // Options split into the tuning lines and the others, with the names
+    // of the tuning options and the String tuning lines (those select
+    // algorithm objects) to tell what changed between two tunings
+    inline void SplitTuning(const std::string &options, std::string &structure, std::string &tuning,
+                            std::string &names, std::string &strings)
+    {
+        structure.clear();
+        tuning.clear();
+        names.clear();
+        strings.clear();
+        std::istringstream lines(options);
+        std::string line;
+        while (std::getline(lines, line))
+        {
+            std::istringstream tokens(line);
+            std::string tok_1, tok_2;
+            tokens >> tok_1 >> tok_2;
+            if (!IsTuningOption(tok_2))
+            {
+                structure += line + "\n";
+                continue;
+            }
+            tuning += line + "\n";
+            names += tok_2 + "\n";
+            if (tok_1 == "String")
+                strings += line + "\n";
+        }
+    }
+
+    inline SolveResult::status_type Status(Ipopt::SolverReturn status)
+    {
+        switch (status)
+        {
+            case Ipopt::SUCCESS:                   return SolveResult::success;
+            case Ipopt::MAXITER_EXCEEDED:          return SolveResult::maxiter_exceeded;
+            case Ipopt::STOP_AT_TINY_STEP:         return SolveResult::stop_at_tiny_step;
+            case Ipopt::STOP_AT_ACCEPTABLE_POINT:  return SolveResult::stop_at_acceptable_point;
+            case Ipopt::LOCAL_INFEASIBILITY:       return SolveResult::local_infeasibility;
+            case Ipopt::USER_REQUESTED_STOP:       return SolveResult::user_requested_stop;
+            case Ipopt::DIVERGING_ITERATES:        return SolveResult::diverging_iterates;
+            case Ipopt::RESTORATION_FAILURE:       return SolveResult::restoration_failure;
+            case Ipopt::ERROR_IN_STEP_COMPUTATION: return SolveResult::error_in_step_computation;
+            case Ipopt::INVALID_NUMBER_DETECTED:   return SolveResult::invalid_number_detected;
+            case Ipopt::INTERNAL_ERROR:            return SolveResult::internal_error;
+            default:                               return SolveResult::unknown;
+        }
+    }
+
+    // IpoptApplication kept across solves.
+    //
+    // Options are applied, and the application initialized, only when the
+    // options string differs from the previous one. Tuning options (see
+    // IsTuningOption) whose values alone changed are set on the running
+    // application, and take effect in the next ReOptimizeTNLP; a changed
+    // mu_strategy makes the next solve rebuild the algorithm objects with
+    // OptimizeTNLP on the same application. The problem is solved
+    // with ReOptimizeTNLP after the first solve, which keeps the algorithm
+    // objects and the symbolic factorization of the linear solver. The TNLP
+    // has to stay the same object with the same structure for that, so a
+    // new one is handed to SetProblem() whenever the structure changes.
+    class PersistentIpopt
+    {
+        public:
+            PersistentIpopt() : _initialized(false), _jacobian(JACOBIAN_REVERSE), _solved(false) {}
+
+            // False if Initialize() fails. A new application is created on any
+            // other change, so options dropped from the string do not linger.
+            bool SetOptions(const std::string &options)
+            {
+                std::string structure, tuning, names, strings;
+                SplitTuning(options, structure, tuning, names, strings);
+                if (_initialized && structure == _options && names == _tuning_names)
+                {
+                    if (tuning == _tuning)
+                        return true;
+                    Jacobian unused;
+                    ApplyOptions(*_app, tuning, unused);
+                    if (strings != _tuning_strings)
+                        _solved = false;
+                    _tuning = tuning;
+                    _tuning_strings = strings;
+                    return true;
+                }
+                _app = new Ipopt::IpoptApplication();
+                ApplyOptions(*_app, options, _jacobian);
+                _options = structure;
+                _tuning = tuning;
+                _tuning_names = names;
+                _tuning_strings = strings;
+                _solved = false;
+                _initialized = _app->Initialize() == Ipopt::Solve_Succeeded;
+                return _initialized;
+            }
+            Jacobian JacobianMethod() const { return _jacobian; }
+
+            void SetProblem(const Ipopt::SmartPtr<Ipopt::TNLP> &nlp)
+            {
+                _nlp = nlp;
+                _solved = false;
+            }
+            bool HasProblem() const { return IsValid(_nlp); }
+
+            Ipopt::ApplicationReturnStatus Solve()
+            {
+                const Ipopt::ApplicationReturnStatus status = _solved ? _app->ReOptimizeTNLP(_nlp)
+                                                                      : _app->OptimizeTNLP(_nlp);
+                _solved = true;
+                return status;
+            }
+
+            // Iterations of the last Solve(), -1 if unknown
+            int Iterations()
+            {
+                if (!IsValid(_app) || !IsValid(_app->Statistics()))
+                    return -1;
+                return _app->Statistics()->IterationCount();
+            }
+
+        private:
+            Ipopt::SmartPtr<Ipopt::IpoptApplication> _app;
+            Ipopt::SmartPtr<Ipopt::TNLP> _nlp;
+            std::string _options, _tuning, _tuning_names, _tuning_strings;
+            bool _initialized;
+            Jacobian _jacobian;
+            bool _solved;
+    };
+
+    // Copy of TNLP::finalize_solution arguments into a solve_result
+    inline void StoreSolution(Ipopt::SolverReturn status, size_t n, const Ipopt::Number* x,
+                              const Ipopt::Number* z_L, const Ipopt::Number* z_U, size_t m,
+                              const Ipopt::Number* g, const Ipopt::Number* lambda, Ipopt::Number obj_value,
+                              SolveResult &solution)
+    {
+        solution.status = Status(status);
+        solution.x.resize(n);
+        solution.zl.resize(n);
+        solution.zu.resize(n);
+        for (size_t j = 0; j < n; j++)
+        {
+            solution.x[j] = x[j];
+            solution.zl[j] = z_L[j];
+            solution.zu[j] = z_U[j];
+        }
+        solution.g.resize(m);
+        solution.lambda.resize(m);
+        for (size_t i = 0; i < m; i++)
+        {
+            solution.g[i] = g[i];
+            solution.lambda[i] = lambda[i];
+        }
+        solution.obj_value = obj_value;
+    }
+}
+
+#endif /* IPOPT_UTIL_H */
@@ -0,0 +1,55 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef LATENCY_COMPENSATOR_H
+#define LATENCY_COMPENSATOR_H
+
+#include "latency_stats.h"
+
+// Delay compensation of the MPC initial state. The odometry measured at
+// its header stamp is predicted to the moment the command takes effect:
+// the age of the message, the rest of the control cycle (a percentile of
+// the recent cycles) and the latency of the drive, at most max_latency.
+class LatencyCompensator
+{
+    public:
+        LatencyCompensator();
+
+        // percentile in [0, 1] of the cycle times, actuation and
+        // max_latency [s]
+        void Configure(double percentile, double actuation, double max_latency);
+
+        // Duration of a control cycle from the odometry read to the
+        // command [s]
+        void AddCycle(double seconds) { _cycles.Add(seconds); }
+
+        // Prediction interval of odometry stamped odom_stamp, read at now
+        // [s]. A zero stamp (not set by the driver) counts as fresh.
+        double Latency(double now, double odom_stamp) const;
+
+        // Unicycle state after latency seconds from the origin of the
+        // vehicle frame at speed v, with the inputs w and a being applied
+        // meanwhile (closed form over the arc, see integrator.h)
+        static void Predict(double latency, double v, double w, double a,
+                            double &x, double &y, double &theta, double &v_out);
+
+    private:
+        RollingStats _cycles;
+        double _percentile, _actuation, _max_latency;
+};
+
+#endif /* LATENCY_COMPENSATOR_H */
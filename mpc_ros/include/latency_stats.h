@@ -0,0 +1,78 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef LATENCY_STATS_H
+#define LATENCY_STATS_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Monotonic stopwatch for the stages of a control cycle. Unlike
+// ros::Time it does not follow simulated time.
+class StageClock
+{
+    public:
+        StageClock() { Start(); }
+
+        void Start() { _last = _start = std::chrono::steady_clock::now(); }
+
+        // Milliseconds since the previous Lap() (or Start())
+        double Lap()
+        {
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            const double ms = std::chrono::duration<double, std::milli>(now - _last).count();
+            _last = now;
+            return ms;
+        }
+
+        // Milliseconds since Start()
+        double Total() const
+        {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _start).count();
+        }
+
+    private:
+        std::chrono::steady_clock::time_point _start, _last;
+};
+
+// Fixed window of the latest samples of one quantity
+class RollingStats
+{
+    public:
+        explicit RollingStats(int window = 100);
+
+        void Add(double value);
+        int Size() const { return _values.size(); }
+
+        // Nearest rank percentile of the window, p in [0, 1]
+        double Percentile(double p) const;
+        double Max() const;
+
+        // Counts of the window per bin, edges ascending. Bin i holds
+        // [edges[i-1], edges[i]), the last bin everything above.
+        std::vector<unsigned int> Histogram(const std::vector<double> &edges) const;
+
+        // "p50 p95 max" of the window, for logging
+        std::string Summary() const;
+
+    private:
+        int _window, _next;
+        std::vector<double> _values;
+};
+
+#endif /* LATENCY_STATS_H */
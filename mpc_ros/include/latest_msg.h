@@ -0,0 +1,47 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef LATEST_MSG_H
+#define LATEST_MSG_H
+
+#include <boost/shared_ptr.hpp>
+
+// Newest message of a topic, shared between the subscriber callbacks and the
+// control loop. Writers swap in the message pointer, readers get a reference
+// to it: the message is never copied and a reader never sees half of an
+// update, however many spinner threads are running.
+template <class M>
+class LatestMsg
+{
+    public:
+        typedef boost::shared_ptr<const M> ConstPtr;
+
+        void Set(const ConstPtr &msg)
+        {
+            boost::atomic_store(&_msg, msg);
+        }
+
+        // Empty pointer until the first message arrived
+        ConstPtr Get() const
+        {
+            return boost::atomic_load(&_msg);
+        }
+
+    private:
+        ConstPtr _msg;
+};
+
+#endif /* LATEST_MSG_H */
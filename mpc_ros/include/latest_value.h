@@ -0,0 +1,89 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef LATEST_VALUE_H
+#define LATEST_VALUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+
+// Newest value of a small plain struct, handed from one writer thread to any
+// number of readers without a lock: a sequence lock over atomic words. Set()
+// never waits; Get() retries while a write is in progress, which only lasts a
+// few stores, and never returns a half-written value. For types that are
+// copied with memcpy, see LatestMsg for messages.
+template <class T>
+class LatestValue
+{
+    public:
+        LatestValue()
+        {
+            _seq.store(0);
+            for (size_t i = 0; i < WORDS; i++)
+                _words[i].store(0);
+        }
+
+        // Single writer thread only
+        void Set(const T &value)
+        {
+            uint64_t words[WORDS] = {};
+            std::memcpy(words, &value, sizeof(T));
+            const unsigned seq = _seq.load(std::memory_order_relaxed);
+            _seq.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t i = 0; i < WORDS; i++)
+                _words[i].store(words[i], std::memory_order_relaxed);
+            _seq.store(seq + 2, std::memory_order_release);
+        }
+
+        // False until the first Set()
+        bool Get(T &value) const
+        {
+            unsigned version;
+            return Get(value, version);
+        }
+
+        // Also the number of Set() calls the value is the result of
+        bool Get(T &value, unsigned &version) const
+        {
+            uint64_t words[WORDS];
+            unsigned before, after;
+            do
+            {
+                before = _seq.load(std::memory_order_acquire);
+                for (size_t i = 0; i < WORDS; i++)
+                    words[i] = _words[i].load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                after = _seq.load(std::memory_order_relaxed);
+            } while ((before & 1) || before != after);
+
+            version = before / 2;
+            if (before == 0)
+                return false;
+            std::memcpy(&value, words, sizeof(T));
+            return true;
+        }
+
+    private:
+        enum { WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t) };
+
+        std::atomic<unsigned> _seq; // odd while a write is in progress
+        std::atomic<uint64_t> _words[WORDS];
+};
+
+#endif /* LATEST_VALUE_H */
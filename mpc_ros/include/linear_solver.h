@@ -0,0 +1,64 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef LINEAR_SOLVER_H
+#define LINEAR_SOLVER_H
+
+#include <string>
+
+// Sparse linear solver of Ipopt's Newton steps (LINEAR_SOLVER parameter).
+//
+// Ipopt factorizes the KKT matrix once or more per iteration, for the MPC
+// sizes most of a solve. Which backends are there depends on the Ipopt
+// build: MUMPS comes with the install guide, the HSL solvers (MA27, MA57,
+// MA77, MA86, MA97) and Pardiso only when they were built or can be
+// loaded. A solve on a missing backend fails, MPC::CalibrateLinearSolver()
+// skips those.
+namespace linear_solver
+{
+    enum Backend
+    {
+        DEFAULT = 0, // whatever Ipopt was built with
+        MUMPS,
+        MA27,
+        MA57,
+        MA77,
+        MA86,
+        MA97,
+        PARDISO,
+        NUM_BACKENDS
+    };
+
+    // Ipopt name of backend, "default" for DEFAULT
+    const char *Name(int backend);
+
+    // Backend of an Ipopt name, "" and "default" are DEFAULT, -1 if unknown
+    int Parse(const std::string &name);
+
+    // Option lines of CppAD::ipopt::solve for backend. order >= 0 picks the
+    // fill-reducing ordering (LINEAR_ORDER): the mumps_pivot_order and
+    // ma57_pivot_order numbers, for MA77, MA86, MA97 and Pardiso the index
+    // into their ordering names (ma97: auto, best, amd, metis, ...). MA27
+    // has no choice.
+    std::string SolveOptions(int backend, int order);
+
+    // MA86, MA97 and Pardiso run on OpenMP, OMP_NUM_THREADS is set to
+    // threads (LINEAR_THREADS). Only read when the backend is first
+    // loaded, i.e. before the first solve on it; 0 leaves it alone.
+    void SetThreads(int threads);
+}
+
+#endif /* LINEAR_SOLVER_H */
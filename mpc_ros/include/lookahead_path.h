@@ -0,0 +1,62 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef LOOKAHEAD_PATH_H
+#define LOOKAHEAD_PATH_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "compact_path.h"
+
+// Lookahead point search of the Pure Pursuit controller.
+//
+// Set() shares the waypoints of a CompactPath, in the frame of the path,
+// and their cumulative arc length. Find() returns the first waypoint ahead of
+// the car that is at least the lookahead distance away, like a scan over
+// the whole path would, but starts from the first waypoint ahead found by
+// the previous call and bisects for the distance crossing: a chord is never
+// longer than its arc, so the arc lengths bound the crossing from below,
+// and past that bound the distance to the car grows along the path unless
+// the path turns back within the lookahead. A bisection result that is not
+// ahead of the car falls back to the scan.
+class LookaheadPath
+{
+    public:
+        LookaheadPath();
+
+        // Waypoints of path, the search starts over
+        void Set(const CompactPath::ConstPtr &path);
+
+        bool Empty() const { return !_path || _path->Empty(); }
+        size_t Size() const { return _path ? _path->Size() : 0; }
+        const std::string &Frame() const { return _path ? _path->Frame() : _no_frame; }
+
+        // Lookahead waypoint of the car at (x, y) with heading yaw, in the
+        // frame of the path. False if there is none, (px, py) is then the
+        // last waypoint.
+        bool Find(double x, double y, double yaw, double lfw, double &px, double &py);
+
+    private:
+        bool Ahead(size_t i, double x, double y, double c, double s) const;
+        double SqDist(size_t i, double x, double y) const;
+
+        CompactPath::ConstPtr _path;
+        std::string _no_frame;
+        size_t _current; // first waypoint ahead of the car at the last call
+};
+
+#endif /* LOOKAHEAD_PATH_H */
@@ -0,0 +1,76 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef MAILBOX_H
+#define MAILBOX_H
+
+#include <atomic>
+
+// Single-slot mailbox from one producer thread to one consumer thread: a
+// triple buffer. The producer fills Back() and publishes it, the consumer
+// takes the newest published value; neither ever waits for the other and
+// values the consumer did not get to are overwritten. Unlike LatestValue the
+// value is not copied, so T may own memory (Eigen vectors): the slots are
+// reused, an assignment of the same size does not allocate.
+template <class T>
+class Mailbox
+{
+    public:
+        Mailbox() : _back(0), _front(1), _taken(false)
+        {
+            _middle.store(2);
+        }
+
+        // Producer only: the slot to fill, it may hold an old value
+        T &Back() { return _slots[_back]; }
+
+        // Producer only: hand Back() over, the next Back() is another slot
+        void Publish()
+        {
+            const unsigned middle = _middle.exchange(_back | FRESH, std::memory_order_acq_rel);
+            _back = middle & INDEX;
+        }
+
+        // Consumer only: the newest published value, NULL before the first
+        // one. It stays valid until the next Take().
+        const T *Take()
+        {
+            if (_middle.load(std::memory_order_relaxed) & FRESH)
+            {
+                const unsigned middle = _middle.exchange(_front, std::memory_order_acq_rel);
+                _front = middle & INDEX;
+                _taken = true;
+            }
+            return _taken ? &_slots[_front] : 0;
+        }
+
+        // True if a value newer than the last Take() is waiting
+        bool Fresh() const
+        {
+            return (_middle.load(std::memory_order_acquire) & FRESH) != 0;
+        }
+
+    private:
+        enum { INDEX = 3, FRESH = 4 };
+
+        T _slots[3];
+        unsigned _back;  // producer's slot
+        unsigned _front; // consumer's slot
+        bool _taken;     // consumer got a value
+        std::atomic<unsigned> _middle; // the slot in between, FRESH if not taken yet
+};
+
+#endif /* MAILBOX_H */
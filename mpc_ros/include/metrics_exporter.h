@@ -0,0 +1,64 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef METRICS_EXPORTER_H
+#define METRICS_EXPORTER_H
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <ros/ros.h>
+#include "controller_metrics.h"
+
+// Publishes the ControllerMetrics of a controller: a summary of the last
+// period on /diagnostics (WARN when a solve missed its deadline, fell back
+// or was not applied in that period), and optionally every metric in the
+// Prometheus text format on http://<host>:<port>/metrics.
+//
+// The control cycle only touches Metrics(), which is lock-free; the
+// timer callback and the HTTP thread read it.
+class MetricsExporter
+{
+    public:
+        MetricsExporter();
+        ~MetricsExporter();
+
+        // period [s] of the diagnostics, port 0 disables the HTTP exporter
+        void Start(ros::NodeHandle &nh, const std::string &name, double period, int port);
+        void Stop();
+
+        ControllerMetrics &Metrics() { return _metrics; }
+
+    private:
+        void publishDiagnostics(const ros::TimerEvent&);
+        bool listen(int port);
+        void serve();
+
+        ControllerMetrics _metrics;
+        ros::Publisher _pub_diag;
+        ros::Timer _timer;
+        std::string _name, _labels;
+
+        // Totals at the last report, the diagnostics show the difference
+        uint64_t _last_cycles, _last_solves, _last_misses, _last_fallbacks, _last_infeasible, _last_stale, _last_tracking;
+        double _last_solve_ms, _last_iterations, _last_cte, _last_etheta;
+
+        int _listen_fd;
+        std::atomic<bool> _serving;
+        std::thread _http;
+};
+
+#endif /* METRICS_EXPORTER_H */
@@ -0,0 +1,91 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef MODE_ARBITER_H
+#define MODE_ARBITER_H
+
+#include <cstddef>
+#include "compact_path.h"
+
+// Phases of the goal approach that are left to analytic control laws
+// instead of the MPC, which adds no tracking there and solves poorly
+// conditioned problems at near zero speed:
+//
+//   MPC_TRACKING  farther than approach_dist of plan length from the goal
+//   APPROACH      within approach_dist: pure pursuit over the rest of the
+//                 plan, braking to stop at the goal (ApproachCommand)
+//   ROTATE        goal position reached (latched by the caller): the
+//                 stop-rotate controller turns to the goal orientation
+//   STANDSTILL    goal reached and stopped: zero command
+//
+// The solver is not run outside MPC_TRACKING. APPROACH is only left again
+// beyond approach_dist + hysteresis, and no mode is left before it held
+// min_cycles cycles, so the plan length jittering around the threshold
+// does not toggle between the laws. approach_dist <= 0 keeps the MPC until
+// the position is reached.
+class ModeArbiter
+{
+    public:
+        enum Mode { MPC_TRACKING = 0, APPROACH = 1, ROTATE = 2, STANDSTILL = 3, NUM_MODES };
+
+        struct Config
+        {
+            Config();
+
+            double approach_dist;  // [m]
+            double hysteresis;     // [m]
+            int min_cycles;
+            double lookahead;      // of the approach pure pursuit [m]
+            double approach_accel; // braking of the approach [m/s^2]
+        };
+
+        ModeArbiter();
+
+        void Configure(const Config &config);
+        const Config &Settings() const { return _config; }
+        // Back to MPC_TRACKING, e.g. for a new plan
+        void Reset();
+
+        // Mode of this cycle from the plan length left to the goal
+        // (goal_dist) and the goal checks of the caller
+        Mode Update(double goal_dist, bool position_reached, bool goal_reached);
+        Mode Current() const { return _mode; }
+        // Whether the last Update() changed the mode
+        bool Changed() const { return _changed; }
+        static const char *Name(int mode);
+
+        // Plan length left from the waypoint start of path to its end, plus
+        // the distance of (x, y) to that waypoint [m]
+        static double GoalDistance(const CompactPath &path, size_t start, double x, double y);
+
+        // APPROACH command at pose (x, y, theta) and speed v over the
+        // waypoints of path from start: the first one at lookahead
+        // (the goal when closer) is pursued, the speed ramps by
+        // approach_accel * dt up to max_speed and down to stop at the goal.
+        // A target behind the robot turns it in place first.
+        void ApproachCommand(const CompactPath &path, size_t start, double x, double y, double theta, double v,
+                             double dt, double max_speed, double max_angvel, double &speed, double &angvel) const;
+
+    private:
+        void set(Mode mode);
+
+        Config _config;
+        Mode _mode;
+        int _cycles; // in _mode
+        bool _changed;
+};
+
+#endif /* MODE_ARBITER_H */
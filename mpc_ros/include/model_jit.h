@@ -0,0 +1,69 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef MODEL_JIT_H
+#define MODEL_JIT_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+class WorkStealingPool;
+
+// Models compiled on a background thread while the solver keeps running on
+// its interpreted tape, see MPC::SetJit().
+//
+// Request() runs a job (for MPC, CodegenModel::Generate() of the tape just
+// recorded) on a worker thread, at most one at a time and once per key. The
+// solving thread polls Ready() between two solves and swaps the compiled
+// model in once its job succeeded, so no solve ever waits on the compiler. The worker only records and compiles, the library is opened on
+// the solving thread. With a pool (the BACKGROUND queue of executor.h)
+// the jobs run as its tasks instead of on a thread of their own.
+class ModelJit
+{
+    public:
+        typedef std::function<bool()> Job;
+
+        explicit ModelJit(const std::shared_ptr<WorkStealingPool> &pool = std::shared_ptr<WorkStealingPool>())
+            : _pool(pool), _busy(false) {}
+        // Waits for a running job
+        ~ModelJit();
+
+        // False while a job is running or when key was requested before
+        bool Wants(const std::string &key);
+        // Start job for key if Wants(key)
+        bool Request(const std::string &key, const Job &job);
+        // The job of key has succeeded
+        bool Ready(const std::string &key);
+
+    private:
+        ModelJit(const ModelJit &);
+        ModelJit &operator=(const ModelJit &);
+
+        std::shared_ptr<WorkStealingPool> _pool;
+        std::thread _worker;
+        std::atomic<bool> _busy;
+        std::mutex _mutex;
+        std::condition_variable _done; // of a job on _pool
+        std::set<std::string> _requested, _compiled;
+};
+
+#endif /* MODEL_JIT_H */
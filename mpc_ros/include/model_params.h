@@ -0,0 +1,50 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef MODEL_PARAMS_H
+#define MODEL_PARAMS_H
+
+#include <map>
+#include <string>
+
+// Parameters of the MPC model, parsed once from the LoadParams map instead
+// of on every solve.
+//
+// The values enter the recorded tape as parameters next to the path
+// coefficients, so changing a weight, a reference, the clearance or dt
+// never records again; only steps changes the structure of the tape.
+struct ModelParams
+{
+    enum Value { DT, REF_CTE, REF_ETHETA, REF_V, W_CTE, W_EPSI, W_V, W_ANGVEL, W_A,
+                 W_DANGVEL, W_DA, W_OBS, CLEARANCE, NUM_VALUES };
+    // Key of each value in the LoadParams map
+    static const char *const KEYS[NUM_VALUES];
+
+    ModelParams();
+
+    // Take the keys present in params. True if steps or a value changed,
+    // each such call also bumps version.
+    bool Load(const std::map<std::string, double> &params);
+
+    // Only the values (and version) differ
+    bool SameStructure(const ModelParams &other) const { return steps == other.steps; }
+
+    int steps;
+    double values[NUM_VALUES];
+    unsigned long version;
+};
+
+#endif /* MODEL_PARAMS_H */
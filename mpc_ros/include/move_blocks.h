@@ -0,0 +1,38 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef MOVE_BLOCKS_H
+#define MOVE_BLOCKS_H
+
+#include <string>
+#include <vector>
+
+// Move blocking of the MPC inputs: angvel and accel are held over blocks
+// of steps, so each block is one decision variable instead of one per
+// step. Blocks are given by their lengths, "1,1,2,4,8" keeps the first
+// two steps free and then holds the inputs over 2, 4 and 8 steps. The
+// last length repeats until the horizon is covered, the last block is cut
+// at the end of the horizon.
+
+// Block lengths from a comma (or space) separated list, empty if the text
+// is empty or has an entry that is not a positive integer
+std::vector<int> ParseMoveBlocks(const std::string &text);
+
+// Block of each of the steps - 1 inputs of a horizon, counting from 0.
+// Empty without blocks.
+std::vector<int> MoveBlockIndex(const std::vector<int> &blocks, int steps);
+
+#endif /* MOVE_BLOCKS_H */
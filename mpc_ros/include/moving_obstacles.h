@@ -0,0 +1,95 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef MOVING_OBSTACLES_H
+#define MOVING_OBSTACLES_H
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// Tracked obstacles that move (people, forklifts), predicted at constant
+// velocity over the horizon for the time-indexed separation of the planner
+// MPC. Each set of tracks is indexed in a space-time hash: a track is
+// entered in every cell (x, y, time slice) its prediction sweeps, its
+// radius included, so the query of one horizon step looks only at the 3x3
+// cells around the step's point in the slice of the step's time. Its cost
+// grows with the obstacles near the robot at that time, not with the tracks.
+//
+// Set() hashes on the thread of the caller (the track callback) and swaps
+// in an immutable Snapshot, the control cycle takes the newest one with
+// Latest() once and queries it without a lock.
+class MovingObstacles
+{
+    public:
+        struct Track
+        {
+            Track();
+
+            unsigned int id;
+            double x, y;   // at the stamp of its set [m]
+            double vx, vy; // [m/s]
+            double radius; // [m]
+        };
+
+        class Snapshot
+        {
+            public:
+                Snapshot();
+
+                // Of the tracks predicted near x, y at time t, the closest
+                // one counting its radius: its position at t and radius.
+                // Past the horizon they hold their last predicted position.
+                // False if none is near.
+                bool Closest(double x, double y, double t, double &qx, double &qy, double &radius) const;
+
+                double Stamp() const { return _stamp; }
+                size_t Size() const { return _tracks.size(); }
+
+            private:
+                friend class MovingObstacles;
+
+                long long key(double x, double y, long long slice) const;
+
+                double _stamp, _cell, _slice, _horizon;
+                std::vector<Track> _tracks;
+                // Track indices by cell and slice
+                std::unordered_map<long long, std::vector<unsigned int> > _cells;
+        };
+        typedef std::shared_ptr<const Snapshot> ConstPtr;
+
+        MovingObstacles();
+
+        // cell: size of the hash cells and so the reach of a query [m],
+        // slice: time of one hash layer [s], horizon: prediction [s], sets
+        // older than max_age are not returned [s]. Drops the current set.
+        void Configure(double cell, double slice, double horizon, double max_age);
+
+        // All tracks of the tracker, measured at stamp; replaces the last set
+        void Set(double stamp, const std::vector<Track> &tracks);
+
+        // The newest set, NULL if there is none younger than max_age at now
+        ConstPtr Latest(double now) const;
+
+    private:
+        double _cell, _slice, _horizon, _max_age;
+        mutable std::mutex _mutex;
+        ConstPtr _latest;
+};
+
+#endif /* MOVING_OBSTACLES_H */
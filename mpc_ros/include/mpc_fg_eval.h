@@ -0,0 +1,44 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef MPC_FG_EVAL_H
+#define MPC_FG_EVAL_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <Eigen/Core>
+#include "cppad_instance.h"
+
+// Speed kernel of the MPC model in the style of cppad/speed (det_by_lu,
+// ode_evaluate, sparse_jac_fun, ...): the objective and constraints of the
+// FG_eval of MPC::Solve for the MPC::LoadParams keys in params (STEPS, DT,
+// the weights, INTEGRATOR, PATH_HEADING, the time grid, DYNAMIC), on the
+// path polynomial coeffs. See src/mpc_fg_speed.cpp.
+//
+// mpc_fg_eval_size() gives the size n of the domain (the variables of
+// Solve) and m of the range (the objective and the constraints).
+// mpc_fg_eval() evaluates fg = f(x), x of size n; Scalar is double or
+// CppAD::AD<double> (between CppAD::Independent and Dependent to record
+// the model).
+void mpc_fg_eval_size(const std::map<std::string, double> &params, size_t &n, size_t &m);
+
+template <class Scalar>
+void mpc_fg_eval(const std::map<std::string, double> &params, const Eigen::VectorXd &coeffs,
+                 const CPPAD_TESTVECTOR(Scalar) &x, CPPAD_TESTVECTOR(Scalar) &fg);
+
+#endif /* MPC_FG_EVAL_H */
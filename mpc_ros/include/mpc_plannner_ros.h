@@ -19,6 +19,8 @@
 
 #include <vector>
 #include <map>
+#include <atomic>
+#include <memory>
 #include <Eigen/Core>
 // abstract class from which our plugin inherits
 #include <nav_core/base_local_planner.h>
@@ -38,10 +40,40 @@
 #include <tf/transform_listener.h>
 #include <costmap_2d/costmap_2d_ros.h>
 #include <dynamic_reconfigure/server.h>
+#include <std_srvs/Trigger.h>
 #include <mpc_ros/MPCPlannerConfig.h>
 
 #include "ros/ros.h"
-#include "mpc_plannner.h"
+#include "MPC.h"
+#include "latest_msg.h"
+#include "path_fit.h"
+#include "plan_window.h"
+#include "path_visualizer.h"
+#include "transform_cache.h"
+#include "latency_stats.h"
+#include "planner_stats.h"
+#include "latency_compensator.h"
+#include "distance_field.h"
+#include "footprint_checker.h"
+#include "move_blocks.h"
+#include "event_trigger.h"
+#include "solution_cache.h"
+#include "work_stealing_pool.h"
+#include "executor.h"
+#include "metrics_exporter.h"
+#include "solver_thread.h"
+#include "neighbor_plans.h"
+#include "moving_obstacles.h"
+#include "scan_circles.h"
+#include "free_corridor.h"
+#include "costmap_snapshot.h"
+#include "speed_profile.h"
+#include "plan_prefetch.h"
+#include "mode_arbiter.h"
+#include <mpc_ros/FleetTrajectory.h>
+#include <mpc_ros/TrackedObstacles.h>
+#include <memory>
+#include <mutex>
 #include <iostream>
 #include <math.h>
 #include <geometry_msgs/PoseWithCovarianceStamped.h>
@@ -55,6 +87,7 @@
 #include <tf2_ros/buffer.h>
 #include <nav_msgs/Path.h>
 #include <nav_msgs/Odometry.h>
+#include <sensor_msgs/LaserScan.h>
 #include <visualization_msgs/Marker.h>
 #include <fstream>
 #include <Eigen/QR>
@@ -75,9 +108,10 @@ namespace mpc_ros{
                 costmap_2d::Costmap2DROS* costmap_ros);
 
             // for visualisation, publishers of global and local plan
-            ros::Publisher g_plan_pub_, l_plan_pub_;
+            PathVisualizer g_plan_pub_, l_plan_pub_;
             void publishLocalPlan(std::vector<geometry_msgs::PoseStamped>& path);
             void publishGlobalPlan(std::vector<geometry_msgs::PoseStamped>& path);
+            void publishGlobalPlan(const PlanWindow& plan);
 
             void LoadParams(const std::map<string, double> &params);
 
@@ -93,7 +127,7 @@ namespace mpc_ros{
             /**
              * @brief  Update the cost functions before planning
              * @param  global_pose The robot's current pose
-             * @param  new_plan The new global plan
+             * @param  plan The remaining part of the global plan
              * @param  footprint_spec The robot's footprint
              *
              * The obstacle cost function gets the footprint.
@@ -102,7 +136,7 @@ namespace mpc_ros{
              *   that is modified based on the global_pose 
              */
             void updatePlanAndLocalCosts(const geometry_msgs::PoseStamped& global_pose,
-                const std::vector<geometry_msgs::PoseStamped>& new_plan,
+                const PlanWindow& plan,
                 const std::vector<geometry_msgs::Point>& footprint_spec);
             // see constructor body for explanations
 
@@ -113,12 +147,33 @@ namespace mpc_ros{
             std::string global_frame_; ///< @brief The frame in which the controller will run
             std::string robot_base_frame_; ///< @brief Used as the base frame id of the robot
             std::vector<geometry_msgs::Point> footprint_spec_;
-            std::vector<geometry_msgs::PoseStamped> global_plan_;
+            PlanWindow global_plan_; ///< @brief The global plan in the odom frame, see plan_window.h
       
             base_local_planner::LocalPlannerUtil planner_util_;
             base_local_planner::LatchedStopRotateController latchedStopRotateController_;
-            base_local_planner::OdometryHelperRos odom_helper_;
-            geometry_msgs::PoseStamped current_pose_;
+            base_local_planner::OdometryHelperRos odom_helper_; // fed by odomCB, no subscription of its own
+
+            // What one move_base cycle works on, captured once by whichever of
+            // isGoalReached() and computeVelocityCommands() runs first and
+            // shared by every stage after it: one pose lookup, one odometry
+            // message, one copy of the limits and the footprint per tick.
+            struct CycleContext
+            {
+                geometry_msgs::PoseStamped pose; // robot in the costmap frame
+                geometry_msgs::PoseStamped robot_vel; // odometry twist as odom_helper_ gives it
+                nav_msgs::Odometry::ConstPtr odom;
+                base_local_planner::LocalPlannerLimits limits;
+                std::vector<geometry_msgs::Point> footprint;
+                ros::Time stamp;
+                bool open; // captured and not consumed by computeVelocityCommands yet
+                CycleContext() : open(false) {}
+            };
+            CycleContext _cycle;
+            bool beginCycle();
+            // What findBestPath() works on: a copy of _cycle and global_plan_,
+            // taken by the solver thread with async_solve
+            CycleContext _solve_cycle;
+            PlanWindow _solve_plan;
             
             base_local_planner::SimpleTrajectoryGenerator generator_;
             base_local_planner::SimpleScoredSamplingPlanner scored_sampling_planner_;
@@ -148,32 +203,242 @@ namespace mpc_ros{
 
             ros::NodeHandle _nh;
             ros::Subscriber _sub_odom;
-            ros::Publisher _pub_odompath, _pub_mpctraj;
+            ros::Publisher _pub_stats;
+            PathVisualizer _pub_odompath, _pub_mpctraj; // throttled, see path_visualizer.h
             tf2_ros::Buffer *tf_;  ///
+            TransformCache _tf_cache; // non-blocking plan transform, see transform_cache.h
             
-            nav_msgs::Odometry _odom;
-            nav_msgs::Path _odom_path, _mpc_traj; 
+            LatestMsg<nav_msgs::Odometry> _odom;
+            PlanSamples _plan_samples; // MPC reference, extended every cycle, see plan_window.h
             //ackermann_msgs::AckermannDriveStamped _ackermann_msg;
             geometry_msgs::Twist _twist_msg;
 
             string _map_frame, _odom_frame, _base_frame;
 
-            MPC _mpc;
+            // Parameter profiles (~profiles), each with a solver of its own
+            // built and prepared at startup, the configured parameters first.
+            // _mpc is the one of the active profile; a switch requested by
+            // reconfigureCB takes effect at the start of the next cycle.
+            struct SolverProfile
+            {
+                string name;
+                map<string, double> params; // MPC::LoadParams keys over the configured ones
+                std::unique_ptr<MPC> mpc;
+            };
+            vector<SolverProfile> _profiles;
+            MPC *_mpc;
+            int _active_profile;
+            std::atomic<int> _requested_profile;
+            PathFit _path_fit;
             map<string, double> _mpc_params;
             double _mpc_steps, _ref_cte, _ref_etheta, _ref_vel, _w_cte, _w_etheta, _w_vel, 
                 _w_angvel, _w_accel, _w_angvel_d, _w_accel_d, _max_angvel, _max_throttle, _bound_value;
 
             //double _Lf; 
             double _dt, _w, _throttle, _speed, _max_speed;
-            double _pathLength, _goalRadius, _waypointsDist;
-            int _downSampling;
-            bool _debug_info, _delay_mode;
-            double polyeval(Eigen::VectorXd coeffs, double x);
-            Eigen::VectorXd polyfit(Eigen::VectorXd xvals, Eigen::VectorXd yvals, int order);
+            double _pathLength, _goalRadius, _waypointsDist, _viz_rate;
+            int _downSampling, _hessian, _hypotheses;
+            int _linear_solver, _linear_order; // Ipopt linear solver, see linear_solver.h
+            int _taylor_capacity; // Taylor orders the tapes keep between solves, see TapeSolver::SetTaylorCapacity()
+            int _hessian_reuse; // Ipopt iterations an exact Hessian is kept for, see TapeSolver::SetHessianReuse()
+            double _hessian_reuse_step, _hessian_reuse_lambda;
+            int _sparsity; // sparsity sweeps of the tapes, see TapeSolver::SetSparsity()
+            bool _debug_info, _delay_mode, _persistent_tape, _warm_start, _rti, _analytic, _publish_stats, _deadline_mode, _adaptive_horizon;
+            double _cycle_overhead; // cycle time besides the solve [s], for the deadline budget
+            // Delay mode over the measured odometry age and cycle time
+            // instead of dt, see latency_compensator.h
+            bool _latency_compensation;
+            LatencyCompensator _latency;
+            int _min_steps;
+            double _horizon_preview;
+            bool _predict_solve_time; // Solve time learned from the past solves, see solve_time_model.h
+            double _predict_forget;
+            std::string _move_blocks;
+
+            // Obstacle term of the MPC from the local costmap, see distance_field.h
+            bool _obstacle_avoidance;
+            double _obstacle_clearance, _w_obstacle;
+            DistanceField _distance_field;
+            std::vector<double> _obstacle_model;
+            std::vector<double> _prev_plan_x, _prev_plan_y, _prev_plan_theta; // last prediction in the costmap frame
+            double _prev_plan_dt;
+            std::vector<double> _lin_x, _lin_y; // points of the horizon the models are built around, costmap frame
+
+            // Corridor constraints of the MPC, convex free space of the
+            // local costmap around the horizon, see free_corridor.h
+            bool _corridor;
+            FreeCorridor _free_corridor;
+            std::vector<double> _corridor_model;
+            double _corridor_range;
+
+            // The costmap around the robot of this cycle, copied under one
+            // lock for the obstacle model, the corridor and the footprint
+            // checks of the solver thread, see costmap_snapshot.h
+            CostmapSnapshot _costmap_snapshot;
+            double _roi_radius;
+
+            // Curvature and acceleration limited reference speed per step
+            // instead of ref_vel, computed once per plan, see speed_profile.h
+            bool _curvature_speed;
+            double _profile_lat_accel, _profile_accel, _profile_window, _profile_end_speed;
+            SpeedProfile _speed_profile;
+            std::vector<double> _speed_reference;
+            // The profile of the next mission leg, published on ~next_plan
+            // before its setPlan(), see plan_prefetch.h
+            bool _prefetch_plans;
+            PlanPrefetch _plan_prefetch;
+            ros::Subscriber _sub_next_plan;
+            void nextPlanCB(const nav_msgs::Path::ConstPtr& msg);
+
+            // Goal approach, rotation and standstill by analytic laws with
+            // the solver suspended (mode_arbiter), see mode_arbiter.h
+            bool _arbitrate_modes;
+            ModeArbiter _mode_arbiter;
+            FootprintChecker _rotate_checker; // of the move_base thread, the solver thread owns _footprint_checker
+            std::vector<std::pair<double, double> > _rotate_footprint;
+
+            // Fleet mode: the prediction is published on fleet_topic in
+            // fleet_frame, those of the other robots keep their distance
+            // through the obstacle term, see neighbor_plans.h
+            bool _fleet;
+            unsigned int _fleet_id;
+            std::string _fleet_frame;
+            double _fleet_radius, _fleet_margin;
+            ros::Publisher _pub_fleet;
+            ros::Subscriber _sub_fleet;
+            mpc_ros::FleetTrajectory _fleet_msg;
+            NeighborPlans _neighbors;
+            std::vector<NeighborPlans::Plan> _near; // of this cycle
+            bool _fleet_valid; // costmap to fleet frame below is known this cycle
+            double _fleet_c, _fleet_s, _fleet_tx, _fleet_ty;
+            double _fleet_stamp; // time of the state of this cycle [s]
+
+            // Tracked moving obstacles on moving_obstacles_topic in
+            // _moving_frame, predicted to the time of every step through
+            // the obstacle term, see moving_obstacles.h
+            bool _moving_obstacles;
+            std::string _moving_frame;
+            double _moving_margin;
+            ros::Subscriber _sub_moving;
+            MovingObstacles _moving;
+            std::vector<MovingObstacles::Track> _moving_tracks; // of the callback
+            MovingObstacles::ConstPtr _moving_near; // of this cycle, NULL without
+            double _moving_c, _moving_s, _moving_tx, _moving_ty; // costmap to moving frame
+            double _moving_stamp; // time of the state of this cycle [s]
+
+            // Obstacles straight from the newest laser scan, clustered into
+            // circles, as one more source of the obstacle term
+            bool _scan_obstacles;
+            double _scan_max_age;
+            ros::Subscriber _sub_scan;
+            LatestMsg<sensor_msgs::LaserScan> _scan;
+            ScanCircles _scan_circles;
+            bool _scan_valid; // _scan_circles are of this cycle
+
+            // Footprint check of the prediction, see footprint_checker.h. A
+            // colliding plan is replaced by the last collision-free one, one
+            // step further each cycle while it stays clear.
+            bool _check_footprint;
+            FootprintChecker _footprint_checker;
+            std::vector<std::pair<double, double> > _footprint;
+            std::vector<double> _safe_x, _safe_y, _safe_theta, _safe_angvel, _safe_accel;
+            size_t _safe_step;
+
+            // Event-triggered mode, see event_trigger.h: the inputs of the
+            // last solve are replayed while the robot follows its prediction
+            EventTrigger _event_trigger;
+            std::vector<double> _event_angvel, _event_accel;
+            double _event_stamp, _event_dt;
+
+            // Solutions of recent inputs, see solution_cache.h. The version
+            // moves on when applyMpcParams() changes the solver parameters.
+            SolutionCache _solution_cache;
+            std::string _cached_move_blocks;
+
+            // Hybrid mode: when the footprint check rejects the MPC plan and
+            // no collision-free one is left, a lattice of (v, w) around the
+            // MPC command is rolled out by generator_ and scored by
+            // scored_sampling_planner_ (obstacle, path and goal costs) on the
+            // pool, and the cheapest valid candidate is driven.
+            bool _hybrid_fallback;
+            int _hybrid_v_samples, _hybrid_w_samples, _hybrid_threads;
+            double _hybrid_v_range, _hybrid_w_range, _hybrid_sim_time;
+            std::unique_ptr<base_local_planner::ObstacleCostFunction> _hybrid_obstacle_costs;
+            std::unique_ptr<base_local_planner::MapGridCostFunction> _hybrid_path_costs, _hybrid_goal_costs;
+            std::shared_ptr<WorkStealingPool> _hybrid_pool; // CONTROL queue of _executor when it is on
+            Executor _executor; // see executor.h
+            std::vector<geometry_msgs::PoseStamped> _hybrid_plan; // remaining plan in the costmap frame
+
+            // Rolling per-stage latency of the control cycle, see planner_stats.h
+            PlannerStats _stage_stats;
+            MetricsExporter _metrics; // solve and tracking health, see metrics_exporter.h
+            // Chrome trace of the spans on ~write_trace (BUILD_TRACE), see trace_span.h
+            std::string _trace_path;
+            ros::ServiceServer _srv_trace;
+
+            // Background solving (async_solve): computeVelocityCommands()
+            // hands its cycle to _solver_thread and follows the last finished
+            // command sequence, failing only when it is older than
+            // _async_max_age. setPlan() leaves the parameters and the event
+            // trigger to the solver thread, which owns _mpc, and with
+            // _cancel_on_replan cancels the solve on the old plan.
+            bool _async_solve, _cancel_on_replan;
+            double _async_max_age;
+            std::mutex _request_mutex;
+            CycleContext _request_cycle;
+            PlanWindow _request_plan;
+            bool _request_params, _request_new_plan;
+            MPCCommand _cycle_cmd; // inputs the last findBestPath() follows, async_solve only
+
+            // Hot restart: the solver state is written to _snapshot_file
+            // every _snapshot_every feasible solves and read back on the
+            // first solve, on the thread that solves, see solver_snapshot.h
+            std::string _snapshot_file;
+            int _snapshot_every;
+            double _snapshot_max_age;
+            unsigned _snapshot_cycle;
+            bool _snapshot_read;
+            MPCCommand _async_cmd; // computeVelocityCommands() side
+            bool asyncVelocityCommands(geometry_msgs::Twist& cmd_vel);
+            bool solveAsync(MPCCommand &cmd);
 
             void odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg);
+            bool writeTraceCB(std_srvs::Trigger::Request &req, std_srvs::Trigger::Response &res);
             void desiredPathCB(const nav_msgs::Path::ConstPtr& pathMsg);
             void controlLoopCB(const ros::TimerEvent&);
+            void publishStats(mpc_ros::MPCStats &stats);
+            void applyMpcParams();
+            void loadProfiles(ros::NodeHandle &private_nh);
+            void switchProfile();
+            void linearizationPoints(const geometry_msgs::PoseStamped& global_pose, double v, int steps, double dt);
+            void updateObstacleModel(const geometry_msgs::PoseStamped& global_pose, int steps);
+            void updateCorridor(const geometry_msgs::PoseStamped& global_pose, int steps);
+            void takeCostmapSnapshot(const geometry_msgs::PoseStamped& global_pose);
+            void keepPrediction(const geometry_msgs::PoseStamped& global_pose);
+            void fleetCB(const mpc_ros::FleetTrajectory::ConstPtr& msg);
+            void scanCB(const sensor_msgs::LaserScan::ConstPtr& msg);
+            void updateScanCircles(const geometry_msgs::PoseStamped& global_pose, double stamp);
+            // The obstacle term of the MPC has a source
+            bool obstacleTerm() const { return _obstacle_avoidance || _fleet || _scan_obstacles || _moving_obstacles; }
+            void updateNeighbors(const geometry_msgs::PoseStamped& global_pose, double stamp);
+            bool neighborDistance(int i, double dt, double wx, double wy, double &d, double &ddx, double &ddy) const;
+            void movingCB(const mpc_ros::TrackedObstacles::ConstPtr& msg);
+            void updateMovingObstacles(double stamp);
+            bool movingDistance(int i, double dt, double wx, double wy, double &d, double &ddx, double &ddy) const;
+            void publishFleetPlan(const geometry_msgs::PoseStamped& global_pose);
+            void storeSolution(SolutionCache::Solution &solution) const;
+            void restoreSolution(const SolutionCache::Solution &solution);
+            bool sampledFallback(const Eigen::Vector3f &pos, const Eigen::Vector3f &vel, const Eigen::Vector3f &goal,
+                                 double v_mpc, double w_mpc, base_local_planner::Trajectory &best);
+            int footprintCost(const std::vector<double> &x, const std::vector<double> &y,
+                              const std::vector<double> &theta, size_t begin, int &first_lethal);
+            bool analyticVelocityCommands(ModeArbiter::Mode mode, geometry_msgs::Twist& cmd_vel);
+            // Obstacle check of the stop-rotate controller: the footprint
+            // over one period at vel_samples from pos, costmap frame
+            bool checkRotation(Eigen::Vector3f pos, Eigen::Vector3f vel, Eigen::Vector3f vel_samples);
+
+            // Declared last: the solver thread is joined before the members it uses go away
+            SolverThread _solver_thread;
     };
 };
 #endif /* MPC_LOCAL_PLANNER_NODE_ROS_H */
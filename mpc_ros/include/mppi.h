@@ -0,0 +1,122 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef MPPI_H
+#define MPPI_H
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <Eigen/Core>
+
+class DistanceField;
+
+// Model predictive path integral control (MPPI) of the unicycle of the
+// MPC, for the MPPI local planner.
+//
+// Every Solve() rolls out SAMPLES noisy copies of the nominal input
+// sequence (gaussian noise SIGMA_W on angvel and SIGMA_A on a, clipped to
+// ANGVEL and MAXTHR) and scores them against the fitted path, the speed
+// reference and an obstacle distance field. The nominal sequence moves
+// to the average of the noise weighted with exp(-cost / LAMBDA). The next
+// Solve() starts from it shifted by one step.
+//
+// The rollouts run in batches of LANES, the state of a batch is one array
+// per component and the dynamics and path cost of a step are plain loops
+// over the lanes, which -O3 vectorizes. The batches are split over THREADS - 1 worker threads kept
+// across solves and the calling thread. Each thread draws its noise from
+// its own generator.
+class Mppi
+{
+    public:
+        enum { LANES = 8 };
+
+        Mppi();
+        ~Mppi();
+
+        // Same keys as MPC::LoadParams (STEPS, DT, REF_V, W_CTE, W_EPSI,
+        // W_V, W_ANGVEL, W_A, W_DANGVEL, W_DA, ANGVEL, MAXTHR, W_OBS,
+        // CLEARANCE) and SAMPLES, LAMBDA, SIGMA_W, SIGMA_A, MAX_SPEED,
+        // THREADS. A new STEPS starts from zero inputs.
+        void LoadParams(const std::map<std::string, double> &params);
+
+        // Obstacle term: distance field and the pose of the vehicle frame
+        // of the solve in it. Steps closer than CLEARANCE add
+        // W_OBS * (CLEARANCE - d)^2, steps in an obstacle COLLISION_COST.
+        // NULL leaves the term out.
+        void SetObstacles(const DistanceField *field, double ox, double oy, double yaw);
+
+        // state = (x, y, theta, v, cte, etheta) in the vehicle frame as for
+        // MPC::Solve, coeffs of the path. Returns the first (angvel, a).
+        std::vector<double> Solve(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs);
+
+        // Forget the nominal sequence, e.g. for a new plan
+        void Reset();
+
+        // Rollout of the nominal sequence of the last Solve()
+        std::vector<double> mpc_x, mpc_y, mpc_theta;
+        std::vector<double> mpc_angvel, mpc_accel;
+        double _mppi_cost;      // of the nominal sequence Solve() started from
+        double _mppi_min_cost;  // lowest sample cost
+        double _mppi_ess;       // effective sample size of the weights
+        int _mppi_collisions;   // samples that hit an obstacle
+
+        static const double COLLISION_COST;
+
+    private:
+        // Noise and cost of the rollouts [begin, end), thread is the index
+        // of the generator
+        void rollouts(int begin, int end, int thread);
+        void work(int index, unsigned int generation);
+        void startWorkers(int threads);
+        void stopWorkers();
+
+        int _steps, _samples, _threads;
+        double _dt, _ref_v, _max_speed, _lambda, _sigma_w, _sigma_a, _max_angvel, _max_throttle;
+        double _w_cte, _w_etheta, _w_vel, _w_angvel, _w_accel, _w_dangvel, _w_daccel;
+        double _w_obs, _clearance;
+        unsigned int _seed;
+
+        // Nominal inputs, steps - 1 each, and whether they are a solution
+        std::vector<double> _angvel, _accel;
+        bool _warm;
+
+        // Noise of every sample, (batch, step, lane), and its cost
+        std::vector<double> _noise_w, _noise_a, _cost;
+        std::vector<unsigned char> _hit;
+        std::vector<std::mt19937> _rngs;
+
+        // Problem data of the running Solve()
+        double _x0, _y0, _theta0, _v0;
+        Eigen::VectorXd _coeffs;
+        const DistanceField *_field;
+        double _field_x, _field_y, _field_yaw;
+
+        // Workers of the batch ranges 1..n-1
+        std::vector<std::thread> _workers;
+        std::mutex _mutex;
+        std::condition_variable _start_cond, _done_cond;
+        unsigned int _generation;
+        int _busy;
+        bool _stop;
+};
+
+#endif /* MPPI_H */
@@ -0,0 +1,99 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef MPPI_PLANNER_ROS_H
+#define MPPI_PLANNER_ROS_H
+
+#include <string>
+#include <vector>
+#include <map>
+// abstract class from which our plugin inherits
+#include <nav_core/base_local_planner.h>
+#include <base_local_planner/local_planner_util.h>
+#include <base_local_planner/latched_stop_rotate_controller.h>
+#include <base_local_planner/odometry_helper_ros.h>
+#include <costmap_2d/costmap_2d_ros.h>
+#include <tf2_ros/buffer.h>
+#include <nav_msgs/Odometry.h>
+
+#include "ros/ros.h"
+#include "mppi.h"
+#include "latest_msg.h"
+#include "path_fit.h"
+#include "plan_window.h"
+#include "path_visualizer.h"
+#include "transform_cache.h"
+#include "planner_stats.h"
+#include "distance_field.h"
+
+namespace mpc_ros{
+
+    // Sampling-based local planner next to MPCPlannerROS: the same plan
+    // handling (odom-frame PlanWindow, downsampled PlanSamples, cubic
+    // PathFit) and MPCStats instrumentation, with the Ipopt solve replaced
+    // by MPPI rollouts against the path and the local costmap, see mppi.h.
+    // The obstacles are a cost of the rollouts instead of constraints, so
+    // the runtime of a cycle only depends on the number of samples.
+    class MPPIPlannerROS : public nav_core::BaseLocalPlanner
+    {
+        public:
+            MPPIPlannerROS();
+            ~MPPIPlannerROS();
+
+            // Local planner plugin functions
+            void initialize(std::string name, tf2_ros::Buffer* tf,
+                costmap_2d::Costmap2DROS* costmap_ros);
+            bool setPlan(const std::vector<geometry_msgs::PoseStamped>& orig_global_plan);
+            bool computeVelocityCommands(geometry_msgs::Twist& cmd_vel);
+            bool isGoalReached();
+
+        private:
+            costmap_2d::Costmap2DROS* costmap_ros_;
+            costmap_2d::Costmap2D* costmap_;
+            tf2_ros::Buffer *tf_;
+            bool initialized_;
+
+            base_local_planner::LocalPlannerUtil planner_util_;
+            base_local_planner::LatchedStopRotateController latchedStopRotateController_;
+            base_local_planner::OdometryHelperRos odom_helper_;
+            geometry_msgs::PoseStamped current_pose_;
+
+            ros::NodeHandle _nh;
+            ros::Subscriber _sub_odom;
+            ros::Publisher _pub_stats;
+            PathVisualizer _pub_globalplan, _pub_localplan, _pub_odompath, _pub_mppitraj;
+            TransformCache _tf_cache;
+            LatestMsg<nav_msgs::Odometry> _odom;
+            PlanWindow _global_plan; // odom frame, see plan_window.h
+            PlanSamples _plan_samples;
+            PathFit _path_fit;
+            DistanceField _distance_field;
+            PlannerStats _stage_stats;
+
+            Mppi _mppi;
+            std::map<std::string, double> _mppi_params;
+            std::string _map_frame, _odom_frame, _base_frame;
+            double _dt, _w, _throttle, _max_speed, _path_length, _waypoints_dist;
+            bool _delay_mode, _debug_info, _publish_stats, _obstacle_avoidance;
+
+            // Control cycle, false if no command could be computed
+            bool computeCommand(const geometry_msgs::PoseStamped& global_pose, double &speed, double &angvel);
+            void publishStats(mpc_ros::MPCStats &stats);
+            void odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg);
+    };
+};
+#endif /* MPPI_PLANNER_ROS_H */
@@ -0,0 +1,124 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef MULTI_START_H
+#define MULTI_START_H
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <Eigen/Core>
+#include "cppad_instance.h"
+#include <cppad/ipopt/solve_result.hpp>
+#include "analytic_solver.h"
+
+// Several Ipopt solves of the analytic model run in parallel from different
+// starting points, the feasible result with the lowest cost is kept.
+//
+// Hypothesis 0 starts from the point handed to Solve() (the shifted
+// previous solution when multipliers are given), 1 from zero inputs, 2 from
+// a pure pursuit rollout along the path and the others from pursuit
+// rollouts towards a lower or higher REF_V (0.75, 1.25, 0.5, 1.5, ... times
+// the reference), which they also track. Every result is scored with the
+// nominal cost, so the ones of the REF_V variants compare with the rest.
+//
+// Each hypothesis keeps its own AnalyticSolver and runs on a worker thread
+// kept across solves (hypothesis 0 on the calling thread); the time limit
+// stops them all at the same deadline. Ipopt has to be built with a
+// thread-safe linear solver: MA27 / MA57, or MUMPS from Ipopt 3.14 on,
+// which serializes its factorizations.
+class MultiStart
+{
+    public:
+        typedef CPPAD_TESTVECTOR(double) Dvector;
+
+        MultiStart();
+        ~MultiStart();
+
+        // Same keys as MPC::LoadParams, HYPOTHESES is the number of
+        // hypotheses (< 2 disables the multi-start solve)
+        void LoadParams(const std::map<std::string, double> &params);
+        int Hypotheses() const { return int(_hypotheses.size()); }
+
+        // See AnalyticSolver::SetPathHeading
+        void SetPathHeading(bool path_heading);
+
+        // Wall-time budget of every hypothesis, <= 0 disables. Iterates cut
+        // off by it are kept if they satisfy the model.
+        void SetTimeLimit(double seconds) { _time_limit = seconds; }
+        // Cancellation token of every hypothesis, see TapeSolver::SetCancel
+        void SetCancel(const std::atomic<bool> *cancel) { _cancel = cancel; }
+
+        // Same arguments as AnalyticSolver::Solve. The objective value of
+        // the solution is its nominal cost.
+        void Solve(const std::string &options, const Eigen::VectorXd &coeffs,
+                   const Dvector &xi, const Dvector &xl, const Dvector &xu,
+                   const Dvector &gl, const Dvector &gu,
+                   CppAD::ipopt::solve_result<Dvector> &solution,
+                   const Dvector *zl = NULL, const Dvector *zu = NULL,
+                   const Dvector *lambda = NULL);
+
+        // Hypothesis of the last solution and its Ipopt iterations, -1 if none
+        int Winner() const { return _winner; }
+        int Iterations() const;
+
+    private:
+        struct Hypothesis
+        {
+            AnalyticSolver solver;
+            double ref_vel;
+            bool run, warm;
+            std::string options;
+            Dvector x;
+            CppAD::ipopt::solve_result<Dvector> result;
+        };
+
+        // Rollout of the model with pure pursuit steering towards the path
+        // and accelerating to ref_vel, from the initial state in x
+        void pursuitSeed(const Eigen::VectorXd &coeffs, double ref_vel, Dvector &x) const;
+        void solve(int index);
+        // Worker loop, generation is the one it was started at
+        void work(int index, unsigned int generation);
+        void stopWorkers();
+
+        std::map<std::string, double> _params;
+        std::vector<std::unique_ptr<Hypothesis> > _hypotheses;
+        AnalyticSolver _nominal; // scores the results
+        bool _path_heading;
+        double _time_limit, _ref_vel, _max_angvel, _max_throttle;
+        const std::atomic<bool> *_cancel;
+        int _winner;
+
+        // Problem data of the running Solve()
+        const Eigen::VectorXd *_coeffs;
+        const Dvector *_xl, *_xu, *_gl, *_gu, *_zl, *_zu, *_lambda;
+
+        // Workers of hypotheses 1..n-1
+        std::vector<std::thread> _workers;
+        std::mutex _mutex;
+        std::condition_variable _start_cond, _done_cond;
+        unsigned int _generation;
+        int _busy;
+        bool _stop;
+};
+
+#endif /* MULTI_START_H */
@@ -0,0 +1,85 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef NEIGHBOR_PLANS_H
+#define NEIGHBOR_PLANS_H
+
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+// Predicted positions of the other robots of a fleet, for time-indexed
+// separation along this robot's horizon. The plans are indexed by a spatial
+// hash of their first point, so Near() only looks at the 3x3 cells around
+// the robot: its cost grows with the robots nearby, not with the fleet.
+// Set() and Near() may run on different threads.
+class NeighborPlans
+{
+    public:
+        struct Plan
+        {
+            Plan();
+
+            // Position at time t, held at the first and last point outside
+            // of the plan. False if the plan is empty.
+            bool At(double t, double &x, double &y) const;
+
+            unsigned int robot;
+            double stamp;  // time of the first point [s]
+            double dt;     // between the points [s]
+            double radius; // [m]
+            std::vector<double> xy;
+        };
+
+        NeighborPlans();
+
+        // cell: size of the hash cells and so the reach of Near() [m].
+        // Plans older than max_age are dropped [s]. Clears the plans.
+        void Configure(double cell, double max_age);
+
+        // Plan of robot, replaces its previous one: steps points x, y in
+        // xy, dt apart from stamp on
+        void Set(unsigned int robot, double stamp, double radius, double dt, const float *xy, int steps);
+
+        // Copy the plans of the cells around x, y younger than max_age at
+        // now into near, the one of robot self excluded. Drops the stale ones.
+        void Near(unsigned int self, double x, double y, double now, std::vector<Plan> &near);
+
+        // Of near, the robot closest to x, y at time t: its position and
+        // radius. False if near is empty.
+        static bool Closest(const std::vector<Plan> &near, double t, double x, double y, double &qx, double &qy, double &radius);
+
+        size_t Size() const;
+
+    private:
+        struct Entry
+        {
+            Plan plan;
+            long long cell;
+        };
+
+        static long long key(long long ix, long long iy);
+        long long cell(double x, double y) const;
+        void unlink(unsigned int robot, long long key);
+
+        double _cell, _max_age;
+        mutable std::mutex _mutex;
+        std::unordered_map<unsigned int, Entry> _plans;
+        std::unordered_map<long long, std::vector<unsigned int> > _cells; // robots by the cell of their first point
+        std::vector<unsigned int> _stale; // of the last Near()
+};
+
+#endif /* NEIGHBOR_PLANS_H */
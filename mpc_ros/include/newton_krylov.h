@@ -0,0 +1,155 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef NEWTON_KRYLOV_H
+#define NEWTON_KRYLOV_H
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include "cppad_instance.h"
+#include "riccati_qp.h"
+
+// Matrix-free inexact Newton backend (NEWTON_KRYLOV) for long horizons,
+// such as the coarse MPC of coarse_guide.h.
+//
+// The problem is the one of CONDENSED: the inputs are the only variables,
+// within their bounds, and the cost is recorded once on a CppAD tape with
+// the domain [inputs | params] (see TapeSolver for the parameters). Every
+// Newton step solves H p = -g over the inputs off their bounds by
+// preconditioned conjugate gradients, where each product H v is one
+// forward sweep of order 1 and one reverse sweep of order 2 of the tape
+// (forward-over-reverse). The Hessian is never formed: the memory and the
+// work of a product are those of the tape, linear in the horizon, and the
+// products per step are capped by NK_CG_ITER.
+//
+// The step is kept within a trust region (Steihaug): CG stops at the
+// forcing tolerance min(0.5, sqrt(|g|)) |g| of the free gradient, at the
+// cap, or on the boundary of the region on negative curvature or a step
+// past it. The step is then projected on the bounds and taken if the cost
+// decreases by a fraction of the decrease of the quadratic model, whose
+// ratio also grows or shrinks the region; the inputs stay feasible
+// throughout. Converged once the projected gradient is below NK_TOL in the
+// max norm, or the model decrease is below the rounding of the cost.
+//
+// The preconditioner keeps the stage structure: it is the Hessian of an LQ
+// problem over the horizon whose inputs are the variables, set by the
+// caller from a linear model of the errors (see MPC::solveNewton), and is
+// applied by the Riccati recursion of riccati_qp.h, linear in the horizon.
+// Its matrices only change with the inputs held on a bound, so within a
+// Newton step every CG iteration reuses the stage factors and only sweeps
+// the vectors. An input on a bound gets a large weight instead, which
+// decouples it.
+class NewtonKrylov
+{
+    public:
+        typedef CPPAD_TESTVECTOR(double) Dvector;
+        typedef CPPAD_TESTVECTOR(CppAD::AD<double>) ADvector;
+        // fg[0] is the cost, vars has n_vars + n_params entries
+        typedef std::function<void(ADvector&, const ADvector&)> CostFunction;
+
+        enum Status
+        {
+            CONVERGED = 0,
+            MAX_ITER,    // NK_MAX_ITER Newton steps, or the time limit
+            LINE_SEARCH, // the trust region collapsed, the iterate is the last one
+            INVALID      // not recorded, or the sizes do not match
+        };
+
+        NewtonKrylov();
+
+        // NK_MAX_ITER, NK_CG_ITER and NK_TOL, see above
+        void LoadParams(const std::map<std::string, double> &params);
+
+        // Record the cost on the domain [vars | params]. name tells
+        // recordings apart, Record() is skipped while it is the one of the
+        // tape (see FG_eval::ModelName()).
+        void Record(size_t n_vars, size_t n_params, const std::string &name, const CostFunction &cost);
+        bool IsRecorded(const std::string &name) const { return _recorded && name == _name; }
+        size_t NumVars() const { return _nx; }
+        size_t NumParams() const { return _np; }
+
+        // Preconditioner stages at the iterate x, asked for at the start of
+        // every Newton step: z holds the errors of the model and the
+        // previous inputs (for the input rate terms), u angvel and a. Only
+        // the matrices are used, N stages for the variables [angvel 0..N-2
+        // | a 0..N-2]. Other sizes, or no function, leave CG
+        // unpreconditioned.
+        enum { NZ = 5, NU = 2 };
+        typedef RiccatiQp<NZ, NU> Preconditioner;
+        typedef std::function<void(const Dvector &x, Preconditioner::Stages &stages)> StageFunction;
+        void SetPreconditioner(const StageFunction &stages) { _pre_function = stages; }
+
+        // Wall-time budget of Solve(), 0 for none
+        void SetTimeLimit(double seconds) { _time_limit = seconds; }
+        bool TimeLimitHit() const { return _time_limit_hit; }
+        // Cancellation token, checked before every Newton step; a cancelled
+        // Solve() returns the last accepted iterate, NULL for none
+        void SetCancel(const std::atomic<bool> *cancel) { _cancel = cancel; }
+        bool CancelHit() const { return _cancel_hit; }
+
+        // Minimize the cost over lower <= x <= upper from x (clipped to
+        // the bounds), which receives the last iterate
+        Status Solve(const Dvector &params, const Dvector &lower, const Dvector &upper, Dvector &x);
+
+        // Of the last Solve(): cost at x, Newton steps and Hessian products
+        double Cost() const { return _cost; }
+        int Iterations() const { return _iterations; }
+        int Products() const { return _products; }
+
+    private:
+        // Zero order sweep at x (with the parameters of Solve()), the cost
+        double value(const Dvector &x);
+        // Gradient of the cost at the point of the last value()
+        void gradient(Dvector &g);
+        // Hessian times v at the point of the last value(), into hv
+        void product(const Dvector &v, Dvector &hv);
+        // Preconditioner at x for the free variables, then z = M^-1 r by
+        // one Riccati solve of the LQ problem with the input gradient -r
+        void factor(const Dvector &x, const std::vector<bool> &free);
+        void precondition(const Dvector &r, Dvector &z);
+
+        CppAD::ADFun<double> _fun;
+        bool _recorded;
+        std::string _name;
+        size_t _nx, _np;
+        int _max_iter, _cg_max_iter;
+        double _tol;
+        double _time_limit;
+        bool _time_limit_hit;
+        const std::atomic<bool> *_cancel;
+        bool _cancel_hit;
+
+        double _cost;
+        int _iterations, _products;
+
+        // Work vectors, sized on Record(): the tape domain, the order 1
+        // direction and the reverse weight of the cost
+        Dvector _x, _dx, _w;
+        // The preconditioner of the current Newton step
+        StageFunction _pre_function;
+        Preconditioner _pre;
+        Preconditioner::Stages _pre_stages;
+        Preconditioner::StateTrajectory _pre_z;
+        Preconditioner::InputTrajectory _pre_u;
+        std::vector<bool> _pre_free;
+        bool _pre_valid;
+};
+
+#endif /* NEWTON_KRYLOV_H */
@@ -0,0 +1,76 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef NLP_SCALING_H
+#define NLP_SCALING_H
+
+#include "cppad_instance.h"
+#include <cppad/ipopt/solve_result.hpp>
+
+// Fixed scaling of the MPC problem (SCALING), handed to Ipopt as
+// nlp_scaling_method user-scaling, see TapeSolver::SetScaling().
+//
+// Ipopt's default gradient-based scaling evaluates the gradients at the
+// start point of every solve. The variables of the MPC mix positions of
+// up to the reach of the horizon with angles, speeds and inputs, and the
+// weights of the cost go up to the thousands, but all of that follows
+// from the parameters: the factors here are computed once per parameter
+// set and layout. A variable is scaled by 1 / max(1, its magnitude), a
+// model row like the state it integrates, and the objective so that the
+// gradient of a unit error under the largest weight is at most 100
+// (nlp_scaling_max_gradient).
+//
+//   variables:  [x | y | theta | v | cte | etheta | angvel | a | tail]
+//   rows:       [x | y | theta | v | cte | etheta | tail]
+//
+// The tail (torques and slacks of the torque model and their rows) is
+// left unscaled.
+class NlpScaling
+{
+    public:
+        typedef CPPAD_TESTVECTOR(double) Dvector;
+
+        // Typical sizes of the quantities of one solve
+        struct Magnitudes
+        {
+            double position; // reach of the horizon
+            double speed;
+            double angvel; // bound of the inputs
+            double accel;
+            double weight; // largest weight of the cost
+        };
+
+        NlpScaling() : _objective(1.0) {}
+
+        // Factors of the layout of MPC::Solve(): steps states, n_inputs per
+        // input, n_tail_vars and n_tail_rows behind them
+        void Set(int steps, int n_inputs, int n_tail_vars, int n_tail_rows, const Magnitudes &size);
+        // The same factors in the layout of REDUCED (see reduced_state.h)
+        // and of CONDENSED (the inputs, no rows)
+        void Reduce(int steps, NlpScaling &reduced) const;
+        void Condense(int steps, NlpScaling &condensed) const;
+
+        double Objective() const { return _objective; }
+        const Dvector &X() const { return _x; }
+        const Dvector &G() const { return _g; }
+        bool Empty() const { return _x.size() == 0; }
+
+    private:
+        double _objective;
+        Dvector _x, _g;
+};
+
+#endif /* NLP_SCALING_H */
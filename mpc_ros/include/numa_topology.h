@@ -0,0 +1,59 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef NUMA_TOPOLOGY_H
+#define NUMA_TOPOLOGY_H
+
+#include <string>
+#include <vector>
+
+// NUMA nodes of the machine and their CPUs, read from sysfs
+// (/sys/devices/system/node), without libnuma. A machine or kernel without
+// NUMA reports one node with every online CPU.
+//
+// Placement relies on the first-touch policy of Linux, made explicit with
+// BindThread(): a thread kept on the CPUs of one node and preferring its
+// memory gets the pages of its heap allocations, the CppAD thread_alloc
+// pools (see cppad_parallel.h) and the Ipopt objects it creates from that
+// node. Memory it frees goes back to pools of the same thread, so it stays
+// local.
+class NumaTopology
+{
+    public:
+        NumaTopology();
+
+        int Nodes() const { return int(_cpus.size()); }
+        // CPUs of node, in the order of the cpulist
+        const std::vector<int> &Cpus(int node) const { return _cpus[node]; }
+        // Kernel id of node (the N of nodeN), may have gaps
+        int Id(int node) const { return _ids[node]; }
+
+        // Node of each of workers threads, the nodes taking turns so every
+        // node gets workers / Nodes() of them (one more for the first ones)
+        std::vector<int> Spread(int workers) const;
+
+        // Keep the calling thread on the CPUs of node and make it prefer the
+        // memory of that node (set_mempolicy MPOL_PREFERRED). Best effort as
+        // RealtimeSettings::Apply(): false when a step failed, report says why.
+        bool BindThread(int node, std::string &report) const;
+
+    private:
+        std::vector<std::vector<int> > _cpus;
+        std::vector<int> _ids;
+};
+
+#endif /* NUMA_TOPOLOGY_H */
@@ -0,0 +1,112 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef PARAM_TUNER_H
+#define PARAM_TUNER_H
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include "closed_loop_sim.h"
+
+// Search over the MPC parameters on the closed-loop simulator, see
+// closed_loop_sim.h and mpc_tune.cpp.
+//
+// Every candidate runs the same episodes. It is scored by its tracking
+// error (mean over the episodes of the rms cte) and its mean solve time.
+// Nothing weighs one against the other: the result is the Pareto front
+// of the two, from which a point is picked for a solve time budget. The
+// solve times are measured with every core busy; they rank the candidates
+// but are longer than on an idle robot.
+namespace param_tuner
+{
+    // One tuned MPC::LoadParams key, either a list of values (grid) or a
+    // range [lo, hi] that the Bayesian search samples, on a log scale if
+    // log, rounded if integer (STEPS).
+    struct Dimension
+    {
+        std::string key;
+        std::vector<double> values;
+        double lo, hi;
+        bool log, integer;
+    };
+
+    // KEY=a,b,c is a list, KEY=lo:hi a range; grid_points values of a range
+    // for the grid search. False if text is neither.
+    bool ParseDimension(const std::string &key, const std::string &text, int grid_points, Dimension &dim);
+
+    struct Candidate
+    {
+        Candidate() : cte(0.0), cte_p90(0.0), solve_ms(0.0), solve_max(0.0), diverged(0), evaluated(false) {}
+
+        std::map<std::string, double> values; // of the tuned keys
+        double cte;       // mean rms cte over the episodes [m]
+        double cte_p90;   // 90th percentile of the rms cte [m]
+        double solve_ms;  // mean solve time [ms]
+        double solve_max; // slowest solve [ms]
+        int diverged;     // episodes that left the reference
+        bool evaluated;
+    };
+
+    // Every combination of the values of dims
+    std::vector<Candidate> Grid(const std::vector<Dimension> &dims);
+
+    // Run episodes for each candidate not yet evaluated, on params with its
+    // values set. Candidates go to threads workers side by side, each on a
+    // ClosedLoopSim of its own; fewer candidates than threads share the
+    // threads over their episodes instead.
+    void Evaluate(const std::map<std::string, double> &params, const PlantConfig &plant,
+                  const std::vector<EpisodeConfig> &episodes, int threads, std::vector<Candidate> &candidates);
+
+    // Indices of the candidates that no other one beats on both cte and
+    // solve_ms, by increasing solve_ms. Diverged candidates are left out.
+    std::vector<size_t> ParetoFront(const std::vector<Candidate> &candidates);
+
+    // Point of the front for a solve time budget [ms]: the lowest cte
+    // within it, or with budget <= 0 the knee (nearest to the best cte and
+    // solve_ms, both scaled to the front). front must not be empty.
+    size_t Pick(const std::vector<Candidate> &candidates, const std::vector<size_t> &front, double budget);
+
+    // Bayesian search over the ranges of dims (ParEGO): a Gaussian process
+    // on a random weighting of the two scores, normalized, and the points
+    // of largest expected improvement. Each point of a batch draws its own
+    // weighting, so a batch spreads along the front.
+    class BayesSearch
+    {
+        public:
+            BayesSearch(const std::vector<Dimension> &dims, unsigned seed);
+
+            // Random points to start from, before anything is known
+            std::vector<Candidate> Initial(size_t count);
+            // count new points given the evaluated ones
+            std::vector<Candidate> Suggest(const std::vector<Candidate> &evaluated, size_t count);
+
+        private:
+            std::vector<double> unit(const Candidate &c) const;
+            Candidate candidate(const std::vector<double> &u) const;
+
+            std::vector<Dimension> _dims;
+            std::mt19937 _rng;
+    };
+
+    // Node parameters (trackRefTrajNode, MPC_Node) of params with the values
+    // of c, as YAML: the weights, the horizon, controller_freq for DT. Keys
+    // without a node parameter are written as comments.
+    std::string Yaml(const std::map<std::string, double> &params, const Candidate &c, const std::string &header);
+}
+
+#endif /* PARAM_TUNER_H */
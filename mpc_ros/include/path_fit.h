@@ -0,0 +1,83 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef PATH_FIT_H
+#define PATH_FIT_H
+
+#include <Eigen/Core>
+
+// Cubic fit of the reference path in the vehicle frame, shared by the MPC
+// nodes, the local planner plugin and the global planner.
+//
+// The waypoints are transformed and accumulated straight into the 4x4
+// normal equations, so the cost does not depend on anything but the number
+// of waypoints and no memory is allocated per call.
+//
+// The adaptive fit (SetAdaptive) takes the lowest order up to MAX_ORDER whose
+// RMS residual is within tolerance, on the nearest half, quarter or eighth of
+// the waypoints when no order explains them all: order 1 on straight
+// segments, a short window in sharp turns. Windows shorter than min_window
+// along x are not tried, the horizon should not run far past the fitted
+// waypoints. An order in which the normal
+// equations are worse conditioned than max_condition is not tried, and the
+// cubic of all the waypoints is kept when nothing fits. Coeffs() then has
+// Order() + 1 entries.
+class PathFit
+{
+    public:
+        static const int ORDER = 3;
+        static const int MAX_ORDER = 5;
+
+        PathFit();
+
+        // max_order 0 keeps the cubic
+        void SetAdaptive(int max_order, double tolerance = 0.01, double min_window = 0.5, double max_condition = 1e10);
+
+        // Fit y = c0 + c1 x + c2 x^2 + c3 x^3 to the waypoints seen from the
+        // pose (px, py, theta). False if the waypoints do not define a cubic.
+        // path is a CompactPath, or anything else with Xs(), Ys() and
+        // Size(), so that this header does not need ROS.
+        template <class Path>
+        bool Fit(const Path &path, double px, double py, double theta)
+        {
+            return Fit(path.Xs(), path.Ys(), (int)path.Size(), px, py, theta);
+        }
+        // n waypoints (xs[i], ys[i])
+        bool Fit(const double *xs, const double *ys, int n, double px, double py, double theta);
+
+        // Coefficients of the last successful fit, lowest order first
+        const Eigen::VectorXd &Coeffs() const { return _fits[_order]; }
+        // Order of the last fit and its waypoints, the nearest ones of the path
+        int Order() const { return _order; }
+        int Points() const { return _points; }
+
+        // Value and slope of the fitted polynomial at x
+        double Eval(double x) const;
+        double Slope(double x) const;
+
+        // Horner evaluation of any coefficient vector
+        static double Eval(const Eigen::VectorXd &coeffs, double x);
+
+    private:
+        bool fitAdaptive(const double *xs, const double *ys, int n, double px, double py, double theta);
+
+        Eigen::VectorXd _fits[MAX_ORDER + 1]; // by order, sized once
+        int _order, _points;
+        int _max_order;
+        double _tolerance, _min_window, _max_condition;
+};
+
+#endif /* PATH_FIT_H */
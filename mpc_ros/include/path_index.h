@@ -0,0 +1,76 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef PATH_INDEX_H
+#define PATH_INDEX_H
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <stdint.h>
+#include "compact_path.h"
+
+// Progress of the robot along a reference path, shared by the tracking node
+// and the global planner.
+//
+// Nearest() only looks at the `window` poses ahead of the last match, so
+// following the path costs the same however long it is. When the best pose
+// of the window is farther than relocalize_dist, because the robot was moved
+// or the path was replaced, a uniform grid over the whole path finds the
+// nearest pose instead. Orientations are never looked at unless Yaw() is
+// called.
+class PathIndex
+{
+    public:
+        PathIndex(int window = 50, double relocalize_dist = 1.0);
+
+        // Track path. A republication of the indexed path (same frame, size
+        // and end points) keeps the grid and the progress. A path that starts
+        // k poses further along the indexed one, as a planner trimming what
+        // is behind the robot publishes it, keeps the progress shifted by k.
+        // Anything else starts over. The grid is only rebuilt when a
+        // relocalization needs it.
+        void Set(const CompactPath::ConstPtr &path);
+        const CompactPath::ConstPtr &Path() const { return _path; }
+
+        // Index of the pose nearest to (x, y), which becomes the new progress
+        size_t Nearest(double x, double y);
+        size_t Current() const { return _current; }
+
+        // Yaw of the i-th pose
+        double Yaw(size_t i) const { return _path->Yaw(i); }
+
+    private:
+        typedef std::pair<uint64_t, uint32_t> Cell; // cell key, pose index
+
+        bool Shifted(const CompactPath &path, size_t &offset) const;
+        void Build();
+        size_t Relocalize(double x, double y) const;
+        double SqDist(size_t i, double x, double y) const;
+        int CellOf(double v) const;
+        static uint64_t Key(int cx, int cy);
+
+        CompactPath::ConstPtr _path;
+        std::vector<Cell> _grid; // sorted by key
+        bool _grid_valid;
+        int _min_cx, _max_cx, _min_cy, _max_cy;
+        size_t _current;
+        int _window;
+        double _relocalize_dist;
+};
+
+#endif /* PATH_INDEX_H */
@@ -0,0 +1,71 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef PATH_TRANSFORM_H
+#define PATH_TRANSFORM_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <Eigen/Core>
+#include <geometry_msgs/PoseStamped.h>
+#include <tf/transform_datatypes.h>
+#include <tf2/LinearMath/Transform.h>
+#include "compact_path.h"
+
+// One rigid transform applied to a whole path at once.
+//
+// Transform() gathers the positions and orientations of the poses into one
+// contiguous column per component and moves each column with a single Eigen
+// expression, so the arithmetic runs vectorized over the path instead of
+// through a tf::Pose per waypoint. Pose messages are only built by Pose()
+// for the waypoints a caller actually keeps; X(), Y() and Yaw() read the
+// result without building one.
+class PathTransform
+{
+    public:
+        typedef std::vector<geometry_msgs::PoseStamped> Poses;
+
+        PathTransform();
+
+        // out = transform * in for every pose of in, see TransformCache::Apply
+        void Transform(const tf::Transform &transform, const Poses &in);
+        void Transform(const tf2::Transform &transform, const Poses &in);
+        // The same from a decoded path, z 0 and the stamp of the path
+        void Transform(const tf::Transform &transform, const CompactPath &in);
+
+        size_t Size() const { return _size; }
+        double X(size_t i) const { return _out(i, PX); }
+        double Y(size_t i) const { return _out(i, PY); }
+        double Yaw(size_t i) const;
+
+        // i-th transformed pose with the stamp of its input, labelled with frame
+        void Pose(size_t i, const std::string &frame, geometry_msgs::PoseStamped &out) const;
+
+    private:
+        enum Column { PX, PY, PZ, QX, QY, QZ, QW, COLUMNS };
+
+        void Transform(const double origin[3], const double rotation[4], const Poses &in);
+        void Resize(size_t size);
+        // _out = transform * _in
+        void Apply(const double origin[3], const double rotation[4]);
+
+        Eigen::Array<double, Eigen::Dynamic, COLUMNS> _in, _out; // one column per component
+        std::vector<ros::Time> _stamps;
+        size_t _size;
+};
+
+#endif /* PATH_TRANSFORM_H */
@@ -0,0 +1,63 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef PATH_VISUALIZER_H
+#define PATH_VISUALIZER_H
+
+#include <string>
+#include <ros/ros.h>
+#include <nav_msgs/Path.h>
+#include "compact_path.h"
+
+// Visualization topic of a controller. Messages go out at most at the
+// configured rate and only while somebody subscribes, so a headless robot
+// pays nothing for them. The message is kept between publishes: refilling
+// it reuses the pose storage instead of allocating a new path every cycle.
+class PathVisualizer
+{
+    public:
+        PathVisualizer();
+
+        void Advertise(ros::NodeHandle &nh, const std::string &topic);
+
+        // Publish rate [Hz], 0 publishes on every call
+        void SetRate(double rate);
+
+        // True if somebody listens and the last message is one period old
+        bool Due(const ros::Time &now) const;
+
+        // Message to fill, with n poses. The poses keep their storage and
+        // their own headers are left alone, the path header is what counts.
+        nav_msgs::Path &Reset(const std::string &frame, const ros::Time &stamp, size_t n);
+
+        // Pose from a planar position and heading, without going through RPY
+        static void SetPose(geometry_msgs::PoseStamped &pose, double x, double y, double yaw);
+
+        // Publish the message filled by Reset(), or one kept elsewhere
+        void Publish(const ros::Time &now);
+        void Publish(const nav_msgs::Path &msg, const ros::Time &now);
+        // Through the kept message, in the frame and with the stamp of path
+        void Publish(const CompactPath &path, const ros::Time &now);
+
+    private:
+        ros::Publisher _pub;
+        nav_msgs::Path _msg;
+        ros::Duration _period;
+        ros::Time _last;
+};
+
+#endif /* PATH_VISUALIZER_H */
@@ -0,0 +1,89 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <cstdint>
+
+// Hardware performance counters of the calling thread (Linux
+// perf_event_open), to tell whether a stage of the control cycle is bound
+// by memory (cache misses per instruction) or by compute (instructions per
+// cycle). Counting is off until Enable(); then each thread opens its own
+// counter group on its first Read(), user space only. Without permission
+// (kernel.perf_event_paranoid > 2 for unprivileged users) or on other
+// systems Read() reports zeros. Counters the CPU or a VM does not have stay
+// 0 as well.
+namespace perf_counters
+{
+    enum Event { CYCLES, INSTRUCTIONS, CACHE_MISSES, BRANCH_MISSES, NUM_EVENTS };
+
+    struct Counts
+    {
+        Counts() { for (int k = 0; k < NUM_EVENTS; k++) value[k] = 0; }
+
+        Counts &operator+=(const Counts &other)
+        {
+            for (int k = 0; k < NUM_EVENTS; k++)
+                value[k] += other.value[k];
+            return *this;
+        }
+        Counts operator-(const Counts &other) const
+        {
+            Counts diff;
+            for (int k = 0; k < NUM_EVENTS; k++)
+                diff.value[k] = value[k] - other.value[k];
+            return diff;
+        }
+
+        uint64_t value[NUM_EVENTS];
+    };
+
+    // Start counting, false if the calling thread cannot open the counters
+    bool Enable();
+    bool Enabled();
+
+    // Counts of the calling thread since its group was opened, false (and
+    // zeros) while disabled. One read() system call.
+    bool Read(Counts &counts);
+
+    // Name of event for reports
+    const char *Name(int event);
+}
+
+// Counters of the calling thread per stage of a control cycle, the
+// counterpart of StageClock and AllocClock
+class PerfClock
+{
+    public:
+        PerfClock() { Start(); }
+
+        void Start() { perf_counters::Read(_last); }
+        // Counts since the previous Lap() (or Start())
+        perf_counters::Counts Lap()
+        {
+            perf_counters::Counts now;
+            perf_counters::Read(now);
+            const perf_counters::Counts lap = now - _last;
+            _last = now;
+            return lap;
+        }
+
+    private:
+        perf_counters::Counts _last;
+};
+
+#endif /* PERF_COUNTERS_H */
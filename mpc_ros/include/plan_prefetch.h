@@ -0,0 +1,78 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef PLAN_PREFETCH_H
+#define PLAN_PREFETCH_H
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "plan_window.h"
+#include "speed_profile.h"
+
+// Next leg of a mission, prepared ahead of its setPlan(): a mission
+// executive publishes the plan towards the next goal while the robot still
+// drives the current one, and the speed profile of that plan, the part of a
+// new plan that costs more than a cycle, is computed here on a thread of its
+// own. setPlan() with the same plan marks it with Match(), and the first
+// cycle on it takes the profile with Adopt() instead of SpeedProfile::Update().
+//
+// Request() and Match() may be called from any thread, Configure() and
+// Adopt() belong to the thread of the control cycle.
+class PlanPrefetch
+{
+    public:
+        PlanPrefetch();
+        ~PlanPrefetch();
+
+        void Start();
+        void Stop();
+
+        // SpeedProfile::Configure() of the profiles prepared from now on, a
+        // change prepares the waiting plan again
+        void Configure(double max_speed, double max_angvel, double max_lat_accel, double max_accel, double window,
+                       double end_speed);
+
+        // Plan of the next leg, replacing an earlier one
+        void Request(const PlanWindow::Poses &plan);
+        // plan is the prepared one, pose by pose: the next Adopt() takes
+        // its profile. False if it is another one or not prepared yet.
+        bool Match(const PlanWindow::Poses &plan);
+        // The matched plan in the odom frame: its profile goes to profile,
+        // see SpeedProfile::Adopt(). Each path is tried once, without a lock
+        // unless a plan was matched.
+        bool Adopt(const CompactPath::ConstPtr &path, SpeedProfile &profile);
+
+    private:
+        void Run();
+
+        std::thread _thread;
+        std::mutex _mutex;
+        std::condition_variable _cond;
+        bool _running, _pending;
+        double _config[6];
+        PlanWindow::Poses _request;
+        // Prepared, _profile on the poses of _plan
+        bool _ready;
+        PlanWindow::Poses _plan;
+        SpeedProfile _profile;
+        std::atomic<bool> _matched;
+        CompactPath::ConstPtr _tried;
+};
+
+#endif /* PLAN_PREFETCH_H */
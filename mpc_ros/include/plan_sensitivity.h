@@ -0,0 +1,72 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef PLAN_SENSITIVITY_H
+#define PLAN_SENSITIVITY_H
+
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+
+// First-order update of a solved plan between full solves. Around the
+// optimum the inputs the solver would return for a slightly different
+// state follow u_k + K_k (s - s_k), where K_k = du_k/ds_k is the
+// parametric sensitivity of the solution to the state at step k. So a
+// fresh pose measured at a high rate corrects the replayed inputs
+// without solving again.
+//
+// The gains come from the Riccati recursion of rti_solver.h on the QP at
+// the solution with the exact Hessian of the Lagrangian, so they are the
+// sensitivity of the NLP of the kinematic Euler model of FG_eval, not of
+// Ipopt's KKT system (its factorization is not reachable through the
+// TNLP interface). Inputs at a bound are not corrected.
+//
+// RtiSolver::Sensitivity() fills the plan, the node sets the origin.
+// Read-only afterwards, so one copy can be shared with the control timer.
+class PlanSensitivity
+{
+    public:
+        typedef Eigen::Matrix<double, 6, 1> State;
+        typedef Eigen::Matrix<double, 2, 1> Input;
+        typedef Eigen::Matrix<double, 2, 6> Gain;
+
+        PlanSensitivity();
+        void Clear();
+        bool Valid() const { return !gains.empty(); }
+
+        // The plan starts at the robot pose (ox, oy, otheta) at stamp (the
+        // vehicle frame of the nodes), state k is predicted at stamp +
+        // offset + k dt
+        void SetOrigin(double stamp, double ox, double oy, double otheta, double offset);
+
+        // Change of angvel and a for the robot measured at (x, y, theta)
+        // with speed v at time t, within the input bounds. False before
+        // the first state or past the horizon.
+        bool Correct(double t, double x, double y, double theta, double v, double &dangvel, double &daccel) const;
+
+        // Plan and gains of RtiSolver::Sensitivity(), stage-major (x, y,
+        // theta, v, cte, etheta) and (angvel, a)
+        std::vector<State, Eigen::aligned_allocator<State> > states;
+        std::vector<Input, Eigen::aligned_allocator<Input> > inputs;
+        std::vector<Gain, Eigen::aligned_allocator<Gain> > gains;
+        Eigen::VectorXd coeffs;
+        double dt, max_angvel, max_throttle;
+
+    private:
+        double _stamp, _offset, _ox, _oy, _otheta;
+};
+
+#endif /* PLAN_SENSITIVITY_H */
@@ -0,0 +1,97 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef PLAN_WINDOW_H
+#define PLAN_WINDOW_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <boost/shared_ptr.hpp>
+#include <geometry_msgs/PoseStamped.h>
+#include "compact_path.h"
+#include <tf2/LinearMath/Transform.h>
+
+// Global plan of the local planner plugin, stored once per setPlan() in the
+// odom frame and never copied afterwards. Each control cycle only moves the
+// start index past the poses the robot has passed; readers index the
+// remaining poses relative to that start. Next to the poses the plan is kept
+// as a CompactPath, whose arc lengths bound the search of Advance() and
+// whose positions feed PlanSamples.
+class PlanWindow
+{
+    public:
+        typedef std::vector<geometry_msgs::PoseStamped> Poses;
+        typedef boost::shared_ptr<const Poses> ConstPtr;
+
+        PlanWindow();
+
+        // Transform the plan with plan_to_odom and keep it. The poses are
+        // copied exactly once, here.
+        void Set(const Poses &plan, const tf2::Transform &plan_to_odom, const std::string &odom_frame);
+        void Clear();
+
+        // Move the start to the pose nearest to (x, y). Only the poses up to
+        // max_dist of arc length ahead of the current start are searched, so
+        // the cost is bounded by the horizon and not by the plan length or
+        // the part already passed.
+        void Advance(double x, double y, double max_dist);
+
+        bool Empty() const { return Size() == 0; }
+        size_t Size() const { return _plan ? _plan->size() - _start : 0; }
+        size_t Start() const { return _start; }
+
+        // i-th pose from the start and the goal
+        const geometry_msgs::PoseStamped &operator[](size_t i) const { return (*_plan)[_start + i]; }
+        const geometry_msgs::PoseStamped &Back() const { return _plan->back(); }
+
+        // Shared handle on the whole plan, for consumers that outlive a cycle
+        const ConstPtr &Plan() const { return _plan; }
+        // The same plan as positions, yaws and arc lengths
+        const CompactPath::ConstPtr &Path() const { return _path; }
+
+    private:
+        ConstPtr _plan;
+        CompactPath::ConstPtr _path;
+        size_t _start;
+};
+
+// Downsampled reference of a PlanWindow, kept across control cycles.
+//
+// The samples are every stride-th pose of the plan, counted from the plan's
+// first pose, starting at the last sample at or before the window start and
+// reaching count poses past it. Update() drops the samples the robot has
+// passed and copies only the new ones at the far end, so a cycle costs the
+// poses gained and not the window. A new plan, stride or count starts over.
+class PlanSamples
+{
+    public:
+        PlanSamples();
+
+        // The waypoints of the returned path belong to PlanSamples, its
+        // frame and stamp to the caller
+        CompactPath &Update(const PlanWindow &plan, size_t stride, size_t count);
+        void Clear();
+
+    private:
+        CompactPath::ConstPtr _plan;
+        size_t _stride, _count;
+        size_t _first; // plan index of the first sample
+        CompactPath _path;
+};
+
+#endif /* PLAN_WINDOW_H */
@@ -0,0 +1,51 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef PLANNER_STATS_H
+#define PLANNER_STATS_H
+
+#include <string>
+#include <vector>
+#include <mpc_ros/MPCStats.h>
+#include "latency_stats.h"
+
+// Rolling per-stage latency of the control cycle of the local planner
+// plugins, in the stages of MPCStats.msg
+class PlannerStats
+{
+    public:
+        enum { STAGE_TF, STAGE_PATH, STAGE_FIT, STAGE_TAPE, STAGE_SOLVE, STAGE_PUBLISH, STAGE_TOTAL, NUM_STAGES };
+
+        explicit PlannerStats(int window = 100);
+
+        // Adds the stage durations of stats
+        void Add(const mpc_ros::MPCStats &stats);
+        // Cycles in the window
+        int Size() const { return _stages[STAGE_TOTAL].Size(); }
+
+        // One "p50 p95 max" line per stage, for logging
+        std::string Table() const;
+
+        // Histogram of total_ms over the window into total_hist
+        void FillHistogram(mpc_ros::MPCStats &stats) const;
+
+    private:
+        std::vector<RollingStats> _stages;
+        std::vector<double> _hist_edges;
+};
+
+#endif /* PLANNER_STATS_H */
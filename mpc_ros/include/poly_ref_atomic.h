@@ -0,0 +1,83 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef POLY_REF_ATOMIC_H
+#define POLY_REF_ATOMIC_H
+
+#include <cstddef>
+#include <string>
+#include "cppad_instance.h"
+#include "atomic_pattern.h"
+
+// Reference terms of the MPC models: the fitted path polynomial f at x and
+// the heading of the path there, atan(f'(x)).
+//
+// Recorded operation by operation these are most of the operations of a
+// step on the tape. PolyRefAtomic enters them as one atomic operation and
+// evaluates value, first and second derivatives in closed form, with
+// exact sparsity patterns (see atomic_pattern.h). Forward and reverse are
+// written for the orders Ipopt needs, forward order 1 and reverse over
+// one order of Taylor coefficients (Hessian-vector products).
+//
+// Inputs [x | c_0 .. c_{n-1}], outputs [f(x) | atan(f'(x))].
+class PolyRefAtomic : public PatternAtomic
+{
+    public:
+        enum { MAX_COEFFS = 8 };
+
+        // Instance for n_coeffs <= MAX_COEFFS coefficients, constructed on the first call.
+        // CppAD does not allow that in parallel mode: NULL then, if no MPC
+        // constructor asked for it before.
+        static PolyRefAtomic *Get(size_t n_coeffs);
+
+        size_t NumCoeffs() const { return _n_in - 1; }
+
+    private:
+        explicit PolyRefAtomic(size_t n_coeffs);
+        static std::string name(size_t n_coeffs);
+
+        // f, f', f'', f''' at x
+        void derivatives(const double *c, double x, double d[4]) const;
+
+        virtual bool forward(size_t p, size_t q, const CppAD::vector<bool> &vx, CppAD::vector<bool> &vy,
+                             const CppAD::vector<double> &tx, CppAD::vector<double> &ty);
+        virtual bool reverse(size_t q, const CppAD::vector<double> &tx, const CppAD::vector<double> &ty,
+                             CppAD::vector<double> &px, const CppAD::vector<double> &py);
+};
+
+// f0 = f(x0) and heading = atan(f'(x0)) for the polynomial c. The AD<double>
+// version goes through PolyRefAtomic when it exists for c.size(), other
+// scalars (CodegenModel) are recorded in Horner form.
+template <class Vector, class Scalar>
+void PolyRef(const Vector &c, const Scalar &x0, Scalar &f0, Scalar &heading)
+{
+    // f(x0) and f'(x0) evaluated together in Horner form, so the tape
+    // holds multiplies and adds instead of pow
+    const int n_coeffs = c.size();
+    f0 = c[n_coeffs - 1];
+    Scalar grad(0.0);
+    for (int k = n_coeffs - 2; k >= 0; k--)
+    {
+        grad = grad * x0 + f0;
+        f0 = f0 * x0 + c[k];
+    }
+    heading = CppAD::atan(grad);
+}
+
+void PolyRef(const CPPAD_TESTVECTOR(CppAD::AD<double>) &c, const CppAD::AD<double> &x0,
+             CppAD::AD<double> &f0, CppAD::AD<double> &heading);
+
+#endif /* POLY_REF_ATOMIC_H */
@@ -0,0 +1,61 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef REALTIME_H
+#define REALTIME_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Real-time setup of a thread: SCHED_FIFO priority, CPU affinity and a
+// prefaulted stack, so the solve is not preempted by costmap updates or
+// logging and does not take page faults on its first deep call.
+//
+// Every step is best effort. Without the privilege (CAP_SYS_NICE or
+// RLIMIT_RTPRIO for the priority, CAP_IPC_LOCK or RLIMIT_MEMLOCK for the
+// lock) the step is skipped, the thread stays on SCHED_OTHER and the reason
+// is appended to the report for the caller to log.
+class RealtimeSettings
+{
+    public:
+        RealtimeSettings();
+
+        // priority 1..99 for SCHED_FIFO, 0 leaves the scheduler alone.
+        // cpus is a list like "2,3" or "2-3", empty for any CPU.
+        void Configure(int priority, const std::string &cpus, std::size_t prefault_stack_kb);
+        bool Enabled() const { return _priority > 0 || !_cpus.empty() || _prefault_stack > 0; }
+
+        // Apply to the calling thread. False when a step failed, report
+        // says which and why.
+        bool Apply(std::string &report) const;
+
+        // mlockall(MCL_CURRENT | MCL_FUTURE) for the whole process, with
+        // malloc keeping freed memory instead of returning it to the system,
+        // and heap_mb of heap touched once so later allocations of the
+        // solver do not fault. Call once, before the threads start.
+        static bool LockMemory(std::size_t heap_mb, std::string &report);
+
+        // "2,4-6" -> {2, 4, 5, 6}, invalid entries are dropped
+        static std::vector<int> ParseCpus(const std::string &cpus);
+
+    private:
+        int _priority;
+        std::vector<int> _cpus;
+        std::size_t _prefault_stack;
+};
+
+#endif /* REALTIME_H */
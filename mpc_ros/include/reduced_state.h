@@ -0,0 +1,53 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef REDUCED_STATE_H
+#define REDUCED_STATE_H
+
+#include "cppad_instance.h"
+#include <cppad/ipopt/solve_result.hpp>
+
+// Reduced state of the MPC models (REDUCED). cte and etheta follow from x,
+// y, theta, v and the inputs along the horizon, given their initial
+// values, so FG_eval can compute them inline in the cost instead of
+// carrying them as variables with model constraints of their own. That
+// drops 2N of the variables and 2N of the constraints.
+//
+//   full, as in Solve():  [x | y | theta | v | cte | etheta | inputs]
+//   reduced:              [x | y | theta | v | inputs]
+//
+// The constraints keep the rows of x, y, theta and v in the same order, the
+// reduced rows are the first 4N of the full ones.
+namespace reduced_state
+{
+    typedef CPPAD_TESTVECTOR(double) Dvector;
+    typedef CppAD::ipopt::solve_result<Dvector> SolveResult;
+
+    // Entries of the reduced variables (start, bounds, bound multipliers)
+    // out of the full ones
+    void ReduceVars(int steps, const Dvector &full, Dvector &reduced);
+    // Entries of the reduced constraints (bounds, multipliers)
+    void ReduceRows(int steps, const Dvector &full, Dvector &reduced);
+
+    // Reduced solution in the full layout. cte and etheta (steps entries
+    // each) are the errors of reduced.x, which satisfy their model rows
+    // exactly: the values of those rows are the initial errors and zero,
+    // their multipliers and the bound multipliers of the errors are zero.
+    void ExpandSolution(int steps, const SolveResult &reduced, const Dvector &cte, const Dvector &etheta,
+                        SolveResult &full);
+}
+
+#endif /* REDUCED_STATE_H */
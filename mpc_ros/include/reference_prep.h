@@ -0,0 +1,75 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef REFERENCE_PREP_H
+#define REFERENCE_PREP_H
+
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <Eigen/Core>
+#include "mailbox.h"
+
+// Reference of one solve, prepared from the newest odometry and path: the
+// pose it was seen from and the fit of the path in the vehicle frame.
+struct ReferencePacket
+{
+    ReferencePacket();
+
+    double stamp;           // odometry time [s]
+    double px, py, theta;   // pose in the odom frame
+    double v, angvel;       // measured speed [m/s] and turn rate [rad/s]
+    bool fitted;            // false if the path did not define a cubic, nothing below is set
+    Eigen::VectorXd coeffs; // PathFit of the path seen from the pose
+    double cte, etheta;     // tracking errors at the pose
+};
+
+// Prepares the reference on its own thread, ahead of the solver: Notify()
+// from the odometry and path callbacks wakes it up, updates arriving while
+// it runs are merged into one. The solver takes the freshest packet from a
+// Mailbox with Latest(), without a lock and without waiting for a fit.
+class ReferencePrep
+{
+    public:
+        // Fills the packet from the newest inputs, false if there are none
+        // yet (nothing is published)
+        typedef std::function<bool(ReferencePacket&)> PrepFunction;
+
+        ReferencePrep();
+        ~ReferencePrep();
+
+        void Start(const PrepFunction &prep);
+        void Stop();
+        bool IsRunning() const;
+
+        void Notify();
+        // Single consumer: the freshest packet, NULL before the first. It
+        // stays valid until the next call.
+        const ReferencePacket *Latest() { return _mailbox.Take(); }
+
+    private:
+        void Run();
+
+        PrepFunction _prep;
+        std::thread _thread;
+        mutable std::mutex _mutex;
+        std::condition_variable _cond;
+        bool _running, _pending;
+        Mailbox<ReferencePacket> _mailbox;
+};
+
+#endif /* REFERENCE_PREP_H */
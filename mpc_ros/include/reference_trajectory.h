@@ -0,0 +1,71 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef REFERENCE_TRAJECTORY_H
+#define REFERENCE_TRAJECTORY_H
+
+#include <string>
+#include <vector>
+#include <nav_msgs/Path.h>
+#include "compact_path.h"
+
+// Closed reference trajectories of the tracking demos (circle, epitrochoid,
+// square, infinite), the curves of script/mpc_trajectory_generation.py.
+//
+// Generate() samples the curve once at a fixed arc length spacing, into a
+// table of positions and headings. Window() then copies the poses of the
+// next stretch of the loop into a path, a message to publish or a
+// CompactPath for the controllers, so a publisher or the tracking node
+// only moves that window along instead of rebuilding the whole trajectory.
+class ReferenceTrajectory
+{
+    public:
+        ReferenceTrajectory();
+
+        // type: circle, epitrochoid, square or infinite (infinity). spacing
+        // [m] between the poses, scale multiplies the curve. False for an
+        // unknown type.
+        bool Generate(const std::string &type, double spacing, double scale = 1.0);
+
+        bool Empty() const { return _x.empty(); }
+        size_t Size() const { return _x.size(); }
+        double Spacing() const { return _spacing; }
+        double Length() const { return _x.size() * _spacing; }
+
+        double X(size_t i) const { return _x[i]; }
+        double Y(size_t i) const { return _y[i]; }
+        double Theta(size_t i) const { return _theta[i]; }
+
+        // Every pose of the loop once
+        void Full(const std::string &frame, const ros::Time &stamp, nav_msgs::Path &path) const;
+        void Full(const std::string &frame, const ros::Time &stamp, CompactPath &path) const;
+
+        // Poses from index start on over length [m], past the end of the
+        // table the loop starts over
+        void Window(size_t start, double length, const std::string &frame, const ros::Time &stamp,
+                    nav_msgs::Path &path) const;
+        void Window(size_t start, double length, const std::string &frame, const ros::Time &stamp,
+                    CompactPath &path) const;
+
+    private:
+        size_t windowSize(double length) const;
+        void pose(size_t i, const std::string &frame, const ros::Time &stamp, geometry_msgs::PoseStamped &pose) const;
+
+        double _spacing;
+        std::vector<double> _x, _y, _theta;
+};
+
+#endif /* REFERENCE_TRAJECTORY_H */
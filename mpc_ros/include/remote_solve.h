@@ -0,0 +1,153 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef REMOTE_SOLVE_H
+#define REMOTE_SOLVE_H
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <Eigen/Core>
+
+// Datagrams between MPC (RemoteSolveClient) and the UDP port of the batch
+// server (src/MPC_BatchNode.cpp). One REQUEST per control cycle carries the
+// state, the path polynomial and the version of the parameters; the
+// parameters themselves travel in a PARAMS datagram only when they change or
+// the server asks for them (UNKNOWN_PARAMS). Fixed layout in host byte
+// order, the robots and the server have to share it.
+namespace remote_solve
+{
+    const uint32_t MAGIC = 0x4d504352; // "MPCR"
+    const int MAX_COEFFS = 8;
+    const int MAX_STEPS = 64;
+    const int MAX_PARAMS_TEXT = 4096;
+
+    enum Type { REQUEST = 1, PARAMS = 2, REPLY = 3 };
+    // The RobotSolveResult values, plus a request of unknown parameters
+    enum Result { SOLVED = 0, FALLBACK = 1, FAILED = 2, EXPIRED = 3, INVALID = 4, UNKNOWN_PARAMS = 5 };
+
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t type;
+        char robot_id[32];       // NUL terminated
+        uint32_t seq;            // of the request, echoed by its reply
+        uint32_t params_version; // of the parameters the request was meant for
+    };
+
+    struct Request
+    {
+        Header header;
+        double state[6];         // x, y, theta, v, cte, etheta
+        double coeffs[MAX_COEFFS];
+        uint32_t n_coeffs;
+        float deadline;          // [s] from the arrival at the server, 0 for none
+    };
+
+    struct Params
+    {
+        Header header;
+        uint32_t size;           // of text
+        char text[MAX_PARAMS_TEXT]; // "KEY=value\n" per MPC::LoadParams key
+    };
+
+    struct Reply
+    {
+        Header header;
+        uint32_t result;         // Result
+        int32_t status;          // CppAD::ipopt::solve_result status
+        int32_t iterations;
+        float objective;
+        float angvel, accel;     // first command
+        float solve_ms;
+        uint32_t steps;          // predicted states, inputs are steps - 1
+        float x[MAX_STEPS], y[MAX_STEPS], theta[MAX_STEPS];
+        float angvel_seq[MAX_STEPS], accel_seq[MAX_STEPS];
+    };
+
+    // "KEY=value\n" lines of params, false if they do not fit
+    bool EncodeParams(const std::map<std::string, double> &params, Params &packet);
+    bool DecodeParams(const Params &packet, size_t length, std::map<std::string, double> &params);
+
+    void SetRobotId(Header &header, const std::string &robot_id);
+    // Magic, type and a NUL terminated robot id
+    bool Valid(const Header &header, uint32_t type);
+}
+
+// Counters of a RemoteSolveClient, the round trip of the replies as an
+// EWMA and the largest of the last 100 to 200
+struct RemoteStats
+{
+    unsigned long sent, replies, late, misses;
+    double rtt_ms, rtt_max_ms;
+};
+
+// Solves over the network on the batch server with a bound on the wait:
+// Solve() sends a request and waits for its reply at most timeout. A miss
+// (too late, lost, failed on the server) returns false and the caller
+// solves locally; replies that turn up later are dropped, timed when they
+// are read. After MISS_STREAK misses in a row Solve() waits only on every
+// MISS_STREAK-th request, the others just send and check, until a reply is
+// on time again. Not thread-safe, one client per MPC.
+class RemoteSolveClient
+{
+    public:
+        RemoteSolveClient();
+        ~RemoteSolveClient();
+
+        // Non-blocking UDP socket to "host:port", false (see Error()) if it
+        // cannot be resolved or opened
+        bool Open(const std::string &address, const std::string &robot_id);
+        bool IsOpen() const { return _socket >= 0; }
+        const std::string &Error() const { return _error; }
+
+        // The parameters are (re)sent first when version is not the one the
+        // server has acknowledged
+        bool Solve(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs,
+                   const std::map<std::string, double> &params, unsigned long version,
+                   double timeout, remote_solve::Reply &reply);
+
+        const RemoteStats &Stats() const { return _stats; }
+        // Round trip of the last reply on time [ms]
+        double LastRtt() const { return _last_rtt_ms; }
+
+        static const int MISS_STREAK = 5;
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        bool sendParams(const std::map<std::string, double> &params, unsigned long version);
+        // One pending datagram, false if there is none. Only replies are
+        // returned, timed by the send time of their request.
+        bool receive(remote_solve::Reply &reply, double &rtt_ms);
+        void addRtt(double rtt_ms);
+        // A reply of an earlier request
+        void addLate(const remote_solve::Reply &reply, double rtt_ms);
+
+        int _socket;
+        std::string _robot_id, _error;
+        uint32_t _seq;
+        unsigned long _acked_version, _sent_version;
+        Clock::time_point _sent_at[64]; // by seq
+        int _miss_streak;
+        double _last_rtt_ms;
+        RemoteStats _stats;
+        int _window;
+        double _window_max, _last_window_max;
+};
+
+#endif /* REMOTE_SOLVE_H */
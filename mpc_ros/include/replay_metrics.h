@@ -0,0 +1,74 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef REPLAY_METRICS_H
+#define REPLAY_METRICS_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Per tick measurements of a replay (see src/mpc_replay.cpp) and their
+// comparison against a stored baseline. No ROS in here.
+struct ReplayTick
+{
+    double stamp; // bag time of the tick [s]
+    bool replied; // a command arrived within the reply timeout
+    double latency_ms; // odometry out -> command back, wall time
+    double v, w; // command
+    double recorded_v, recorded_w; // command of the recording, NaN if none
+    double tracking_error; // distance of the robot to the path [m], NaN without path
+};
+
+class ReplayMetrics
+{
+    public:
+        void Add(const ReplayTick &tick) { _ticks.push_back(tick); }
+        const std::vector<ReplayTick> &Ticks() const { return _ticks; }
+
+        // ticks, missed (no reply), latency_p50/p95/max_ms, cmd_delta_v/w
+        // mean and max (against the recording, left out without one),
+        // cmd_jump_v/w max (tick to tick), tracking_error_mean/max
+        std::map<std::string, double> Summary() const;
+
+        // One line per tick, for plotting
+        bool WriteCsv(const std::string &path) const;
+
+    private:
+        std::vector<ReplayTick> _ticks;
+};
+
+// Baseline files hold "key: value" lines of Summary(), # starts a comment
+bool WriteBaseline(const std::string &path, const std::map<std::string, double> &summary);
+bool ReadBaseline(const std::string &path, std::map<std::string, double> &baseline);
+
+// Allowed increase of a metric over its baseline: relative * baseline + absolute
+struct ReplayTolerance
+{
+    double relative, absolute;
+};
+
+// Metrics of the baseline that the summary exceeds by more than their
+// tolerance, as printable lines. The tolerance of a metric is the entry
+// with the longest key that starts its name ("latency" for latency_p95_ms),
+// else "default". Metrics missing from the summary fail too; ticks is not
+// compared.
+std::vector<std::string> CompareBaseline(const std::map<std::string, double> &summary,
+                                         const std::map<std::string, double> &baseline,
+                                         const std::map<std::string, ReplayTolerance> &tolerances);
+
+#endif /* REPLAY_METRICS_H */
@@ -0,0 +1,326 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef RICCATI_QP_H
+#define RICCATI_QP_H
+
+#include <algorithm>
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/Cholesky>
+#include <Eigen/StdVector>
+
+// Stage-wise QP of an MPC horizon, solved by a Riccati recursion:
+//
+//   min  sum_k 1/2 z_k'Q_k z_k + q_k'z_k + 1/2 u_k'R_k u_k + r_k'u_k + u_k'S_k z_k
+//   s.t. z_{k+1} = A_k z_k + B_k u_k + d_k,  z_0 given,  lb_k <= u_k <= ub_k
+//
+// for k = 0..N-2, plus the terminal 1/2 z'Q z + q'z of the last stage. Each
+// active set iteration is one backward and one forward sweep, so the cost
+// grows linearly with the horizon instead of cubically as with a condensed
+// dense QP. The input bounds are handled by a primal active set method:
+// bounded inputs are held at their bound in the sweeps and the bound with
+// the worst multiplier is released once the reduced problem is solved.
+//
+// NZ and NU are the state and input dimensions per stage. Stage matrices
+// are fixed-size Eigen types and the work vectors are kept between calls,
+// so after the first solve of a horizon nothing is allocated.
+//
+// The matrix part of the backward sweep (the Riccati matrix, the feedback
+// and the factor of the input Hessian) of a stage only depends on the
+// matrices and the active inputs of that stage and of the stages after it.
+// It is kept per stage and only recomputed from the last stage backwards
+// that changed: an active set iteration that moves one bound redoes the
+// stages up to that one, and a tick whose tail matches the last is only
+// swept for the vectors there. Matrices match when every entry is within
+// SetReuseTolerance() (relative) of those the factor was computed with;
+// the default 0 asks for equal ones, which keeps the result exact.
+template <int NZ, int NU>
+class RiccatiQp
+{
+    public:
+        typedef Eigen::Matrix<double, NZ, NZ> MatrixZZ;
+        typedef Eigen::Matrix<double, NZ, NU> MatrixZU;
+        typedef Eigen::Matrix<double, NU, NZ> MatrixUZ;
+        typedef Eigen::Matrix<double, NU, NU> MatrixUU;
+        typedef Eigen::Matrix<double, NZ, 1> VectorZ;
+        typedef Eigen::Matrix<double, NU, 1> VectorU;
+
+        struct Stage
+        {
+            EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+            MatrixZZ A, Q;
+            MatrixZU B;
+            MatrixUU R;
+            MatrixUZ S;
+            VectorZ d, q;
+            VectorU r, lb, ub;
+        };
+        typedef std::vector<Stage, Eigen::aligned_allocator<Stage> > Stages;
+        typedef std::vector<VectorZ, Eigen::aligned_allocator<VectorZ> > StateTrajectory;
+        typedef std::vector<VectorU, Eigen::aligned_allocator<VectorU> > InputTrajectory;
+
+        RiccatiQp() { _iterations = 0; _max_iterations = 0; _reuse_tol = 0.0; _cache_steps = 0; _factored = 0; }
+
+        // Cap of the active set iterations, 0 for 4 per bounded input and
+        // stage (+ 10). A cap that is hit fails the Solve().
+        void SetMaxIterations(int iterations) { _max_iterations = std::max(0, iterations); }
+
+        // stages[N-1] only needs Q and q. u holds the starting inputs and
+        // receives the solution, z the state trajectory. False if a stage
+        // Hessian is not positive definite or the active set does not settle.
+        bool Solve(const Stages &stages, const VectorZ &z0, StateTrajectory &z, InputTrajectory &u);
+
+        // Largest relative change of a stage matrix entry that keeps the
+        // factor of the stage, 0 for exact reuse only
+        void SetReuseTolerance(double tol) { _reuse_tol = std::max(0.0, tol); }
+
+        // Active set iterations of the last Solve()
+        int Iterations() const { return _iterations; }
+        // Stages whose matrix part was computed in the last Solve(), over
+        // all of its iterations
+        int FactoredStages() const { return _factored; }
+        // Feedback u_k = K_k z_k + k_k of the final face of the last
+        // successful Solve(): the sensitivity of the optimal input to the
+        // state, with the rows of the inputs held at a bound zero
+        const MatrixUZ &Gain(int k) const { return _K[k]; }
+        // Cost-to-go gradient at z_k = 0 of the last Solve(): the costate,
+        // i.e. the multiplier of the dynamics into stage k, at the solution
+        const VectorZ &Costate(int k) const { return _p[k]; }
+
+    private:
+        typedef Eigen::Matrix<int, NU, 1> Active;
+
+        // Matrix part of the backward sweep of a stage and the stage
+        // matrices and active inputs it was computed from
+        struct Factor
+        {
+            EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+            MatrixZZ A, Q;
+            MatrixZU B;
+            MatrixUU R, Huu, D;
+            MatrixUZ S, Huz;
+            Active active;
+            Eigen::LLT<MatrixUU> llt;
+        };
+
+        template <class M>
+        bool close(const M &now, const M &then) const
+        {
+            return ((now - then).array().abs() <= _reuse_tol * (1.0 + then.array().abs())).all();
+        }
+
+        // Optimum with the inputs flagged in _active held at their value in
+        // u, and the input gradients of the objective there (in _grad)
+        bool solveFace(const Stages &stages, const VectorZ &z0, StateTrajectory &z, InputTrajectory &u);
+
+        int _iterations, _max_iterations;
+        std::vector<Active, Eigen::aligned_allocator<Active> > _active;
+        std::vector<Factor, Eigen::aligned_allocator<Factor> > _factors;
+        MatrixZZ _terminal_Q; // of _P[N - 1]
+        double _reuse_tol;
+        int _cache_steps; // horizon of _factors, 0 when they are invalid
+        int _factored;
+        std::vector<MatrixZZ, Eigen::aligned_allocator<MatrixZZ> > _P;
+        std::vector<MatrixUZ, Eigen::aligned_allocator<MatrixUZ> > _K;
+        StateTrajectory _p;
+        InputTrajectory _k, _grad, _target;
+};
+
+template <int NZ, int NU>
+bool RiccatiQp<NZ, NU>::solveFace(const Stages &stages, const VectorZ &z0, StateTrajectory &z, InputTrajectory &u)
+{
+    const int N = stages.size();
+    _P.resize(N);
+    _p.resize(N);
+    _K.resize(N - 1);
+    _k.resize(N - 1);
+
+    // Backward sweep with the policy u = K z + k. For a bounded input the
+    // row of K is zero and k is the bound, the free inputs minimize the
+    // stage Hessian restricted to them. The matrix part is kept from the
+    // last sweep as long as every stage from the last one down matches.
+    _factors.resize(N - 1);
+    bool reuse = _cache_steps == N && close(stages[N - 1].Q, _terminal_Q);
+    if (!reuse)
+    {
+        _P[N - 1] = _terminal_Q = stages[N - 1].Q;
+        _cache_steps = 0;
+    }
+    _p[N - 1] = stages[N - 1].q;
+    for (int k = N - 2; k >= 0; k--)
+    {
+        const Stage &st = stages[k];
+        Factor &f = _factors[k];
+        const MatrixZZ &P = _P[k + 1];
+        reuse = reuse && f.active == _active[k] && close(st.A, f.A) && close(st.B, f.B) && close(st.Q, f.Q)
+                && close(st.R, f.R) && close(st.S, f.S);
+        if (!reuse)
+        {
+            const MatrixZU PB = P * st.B;
+            const MatrixUU Huu = st.R + st.B.transpose() * PB;
+            const MatrixUZ Huz = st.S + PB.transpose() * st.A;
+            VectorU mask;
+            for (int j = 0; j < NU; j++)
+                mask[j] = _active[k][j] ? 0.0 : 1.0;
+            const MatrixUU D = mask.asDiagonal();
+            f.llt.compute(D * Huu * D + (MatrixUU::Identity() - D));
+            if (f.llt.info() != Eigen::Success)
+            {
+                _cache_steps = 0;
+                return false;
+            }
+            f.A = st.A;
+            f.B = st.B;
+            f.Q = st.Q;
+            f.R = st.R;
+            f.S = st.S;
+            f.active = _active[k];
+            f.Huu = Huu;
+            f.Huz = Huz;
+            f.D = D;
+            _K[k] = -f.llt.solve(D * Huz);
+
+            const MatrixUZ HK = Huu * _K[k];
+            const MatrixZZ Pk = st.Q + st.A.transpose() * P * st.A + Huz.transpose() * _K[k]
+                                + _K[k].transpose() * Huz + _K[k].transpose() * HK;
+            _P[k] = 0.5 * (Pk + Pk.transpose());
+            _factored++;
+        }
+
+        const VectorZ s = P * st.d + _p[k + 1];
+        const VectorU hu = st.r + st.B.transpose() * s;
+        VectorU c;
+        for (int j = 0; j < NU; j++)
+            c[j] = _active[k][j] ? u[k][j] : 0.0;
+        _k[k] = c - f.llt.solve(f.D * (hu + f.Huu * c));
+        _p[k] = st.q + st.A.transpose() * s + f.Huz.transpose() * _k[k] + _K[k].transpose() * (f.Huu * _k[k] + hu);
+    }
+    _cache_steps = N;
+
+    // Forward sweep
+    z.resize(N);
+    z[0] = z0;
+    for (int k = 0; k < N - 1; k++)
+    {
+        const Stage &st = stages[k];
+        u[k] = _K[k] * z[k] + _k[k];
+        z[k + 1] = st.A * z[k] + st.B * u[k] + st.d;
+    }
+
+    // dJ/du_k = R u + r + S z + B' lambda_{k+1}, lambda the cost-to-go gradient
+    _grad.resize(N - 1);
+    for (int k = 0; k < N - 1; k++)
+    {
+        const Stage &st = stages[k];
+        const VectorZ lambda = _P[k + 1] * z[k + 1] + _p[k + 1];
+        _grad[k] = st.R * u[k] + st.r + st.S * z[k] + st.B.transpose() * lambda;
+    }
+    return true;
+}
+
+template <int NZ, int NU>
+bool RiccatiQp<NZ, NU>::Solve(const Stages &stages, const VectorZ &z0, StateTrajectory &z, InputTrajectory &u)
+{
+    const int N = stages.size();
+    _iterations = 0;
+    _factored = 0;
+    if (N < 2 || (int)u.size() != N - 1)
+        return false;
+
+    // 0: free, -1: at lower bound, +1: at upper bound
+    _active.resize(N - 1);
+    for (int k = 0; k < N - 1; k++)
+    {
+        const Stage &st = stages[k];
+        for (int j = 0; j < NU; j++)
+        {
+            u[k][j] = std::min(std::max(u[k][j], st.lb[j]), st.ub[j]);
+            _active[k][j] = u[k][j] <= st.lb[j] ? -1 : (u[k][j] >= st.ub[j] ? 1 : 0);
+        }
+    }
+
+    const int max_iterations = _max_iterations > 0 ? _max_iterations : 4 * NU * (N - 1) + 10;
+    for (_iterations = 1; _iterations <= max_iterations; _iterations++)
+    {
+        // Optimum of the current face, then move towards it as far as the bounds allow
+        _target = u;
+        if (!solveFace(stages, z0, z, _target))
+            return false;
+
+        double alpha = 1.0;
+        int block_k = -1, block_j = -1;
+        bool block_upper = false;
+        for (int k = 0; k < N - 1; k++)
+        {
+            const Stage &st = stages[k];
+            for (int j = 0; j < NU; j++)
+            {
+                const double p = _target[k][j] - u[k][j];
+                if (_active[k][j])
+                    continue;
+                if (p > 0 && u[k][j] + p > st.ub[j] && (st.ub[j] - u[k][j]) / p < alpha)
+                {
+                    alpha = (st.ub[j] - u[k][j]) / p;
+                    block_k = k;
+                    block_j = j;
+                    block_upper = true;
+                }
+                else if (p < 0 && u[k][j] + p < st.lb[j] && (st.lb[j] - u[k][j]) / p < alpha)
+                {
+                    alpha = (st.lb[j] - u[k][j]) / p;
+                    block_k = k;
+                    block_j = j;
+                    block_upper = false;
+                }
+            }
+        }
+        if (block_k >= 0)
+        {
+            for (int k = 0; k < N - 1; k++)
+                u[k] += alpha * (_target[k] - u[k]);
+            _active[block_k][block_j] = block_upper ? 1 : -1;
+            u[block_k][block_j] = block_upper ? stages[block_k].ub[block_j] : stages[block_k].lb[block_j];
+            continue;
+        }
+        u = _target;
+
+        // Face optimum reached, release the bound with the worst multiplier
+        int release_k = -1, release_j = -1;
+        double worst = 0;
+        for (int k = 0; k < N - 1; k++)
+        {
+            for (int j = 0; j < NU; j++)
+            {
+                const double mult = _active[k][j] < 0 ? _grad[k][j] : (_active[k][j] > 0 ? -_grad[k][j] : 0.0);
+                if (mult < worst)
+                {
+                    worst = mult;
+                    release_k = k;
+                    release_j = j;
+                }
+            }
+        }
+        if (release_k < 0)
+            return true;
+        _active[release_k][release_j] = 0;
+    }
+    _iterations = max_iterations;
+    return false;
+}
+
+#endif /* RICCATI_QP_H */
@@ -0,0 +1,78 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef ROUTE_STORE_H
+#define ROUTE_STORE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Precomputed route of a facility, memory-mapped from a file so that a
+// library of long routes costs no heap and planning on one is a lookup.
+//
+// File layout (little endian, written by mpc_route): a header with the pose
+// count and whether the route is a loop, then the arrays x, y, yaw and the
+// arc length s of the poses, doubles each. Open() maps the file read-only,
+// nothing is copied.
+class RouteStore
+{
+    public:
+        RouteStore();
+        ~RouteStore();
+
+        // Route through the poses, s is computed. False for fewer than two
+        // poses, arrays of different sizes or a failed write.
+        static bool Write(const std::string &path, const std::vector<double> &x, const std::vector<double> &y,
+                          const std::vector<double> &yaw, bool closed);
+
+        bool Open(const std::string &path);
+        void Close();
+        bool Valid() const { return _x != NULL; }
+
+        size_t Size() const { return _size; }
+        bool Closed() const { return _closed; }
+        // Arc length of the route, with the closing segment of a loop
+        double Length() const;
+
+        double X(size_t i) const { return _x[i]; }
+        double Y(size_t i) const { return _y[i]; }
+        double Yaw(size_t i) const { return _yaw[i]; }
+        double S(size_t i) const { return _s[i]; }
+
+        // Pose nearest to (x, y). The window poses ahead of hint are checked
+        // first, the whole route only when none of them is within
+        // relocalize_dist. hint becomes the result.
+        size_t Nearest(double x, double y, size_t &hint, int window = 50, double relocalize_dist = 1.0) const;
+
+        // Number of poses from start on that cover length [m] of arc; a loop
+        // continues at its first pose, an open route ends at its last
+        size_t Slice(size_t start, double length) const;
+
+    private:
+        RouteStore(const RouteStore &);
+        RouteStore &operator=(const RouteStore &);
+
+        double sqDist(size_t i, double x, double y) const;
+
+        size_t _size;
+        bool _closed;
+        const double *_x, *_y, *_yaw, *_s;
+        void *_map;
+        size_t _map_size;
+};
+
+#endif /* ROUTE_STORE_H */
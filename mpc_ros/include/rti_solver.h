@@ -0,0 +1,136 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef RTI_SOLVER_H
+#define RTI_SOLVER_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+#include "riccati_qp.h"
+#include "admm_qp.h"
+#include "plan_sensitivity.h"
+
+// Real-time iteration backend for MPC::Solve.
+//
+// Instead of solving the NLP to convergence every cycle, one Gauss-Newton
+// SQP step is taken around the previous solution shifted by one step. The
+// model and the cost are the ones FG_eval encodes: unicycle kinematics with
+// the cte/etheta rows of the fitted polynomial, quadratic tracking, input
+// and input rate terms. Since the cost is already quadratic the
+// Gauss-Newton Hessian is exact, only the dynamics are linearized.
+//
+// The QP keeps the stage structure of the horizon and is solved by a
+// Riccati recursion (riccati_qp.h), linear in the number of steps. State
+// bounds (mpc_bound_value) are not enforced. The recursion keeps the
+// matrix part of the stages at the end of the horizon that did not change
+// from the last tick, or by no more than QP_REUSE_TOL.
+//
+// The state and input dimensions are compile-time constants and the
+// linearization point is kept stage-major, so the model and the stage
+// matrices are fixed-size Eigen types. The horizon stays a runtime value:
+// the work vectors are sized on the first step of a horizon and reused.
+//
+// LTV (linear time-varying MPC) solves the same linearization as one
+// sparse QP over all stages instead: the deviations of the states and
+// inputs in the MPC::Solve layout, with the initial state, the linearized
+// dynamics and the input bounds as rows of A. A is written in CSC form
+// straight from the model Jacobians, into a pattern built once per
+// horizon, and the QP goes to AdmmQp (admm_qp.h), which keeps the
+// ordering of its factorization and starts from the multipliers of the
+// previous tick shifted by one stage.
+//
+// Variables use the MPC::Solve layout: x, y, theta, v, cte, etheta blocks
+// of N entries, then angvel and a blocks of N - 1.
+class RtiSolver
+{
+    public:
+        // States x, y, theta, v, cte, etheta and inputs angvel, a per stage
+        enum { NX = 6, NU = 2, NZ = NX + NU };
+        typedef Eigen::Matrix<double, NX, 1> State;
+        typedef Eigen::Matrix<double, NX, NX> StateMatrix;
+        typedef Eigen::Matrix<double, NX, NU> InputMatrix;
+
+        RtiSolver();
+
+        // Same keys as MPC::LoadParams, and QP_EPS, QP_MAX_ITER of the LTV
+        // QP and ACTIVE_SET_MAX_ITER, QP_REUSE_TOL of the Riccati one (see
+        // RiccatiQp)
+        void LoadParams(const std::map<std::string, double> &params);
+
+        // One SQP step from the linearization point in vars, which receives
+        // the new iterate. If vars does not hold a full trajectory the
+        // inputs are zero and the states are rolled out from state. False if
+        // the QP could not be solved, vars is then the linearization point.
+        bool Step(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, std::vector<double> &vars);
+
+        // Objective of FG_eval at vars
+        double Cost(const std::vector<double> &vars) const;
+
+        // Gains of the QP linearized at vars (n entries in the layout
+        // below, e.g. a converged Ipopt solution) and the plan itself, see
+        // plan_sensitivity.h. The QP has the exact Hessian of the
+        // Lagrangian (the curvature of the dynamics weighted by the
+        // costates), or the Gauss-Newton one where that is not positive
+        // definite. False if vars is not a full trajectory or the QP has no
+        // solution, sens is then cleared.
+        bool Sensitivity(const Eigen::VectorXd &coeffs, const double *vars, size_t n, PlanSensitivity &sens);
+
+        // Active set (ADMM with LTV) iterations of the last QP
+        int QpIterations() const { return _qp_iterations; }
+        bool Sparse() const { return _sparse; }
+
+    private:
+        // Discrete unicycle model, next = F(s, u), with the Jacobians
+        // A = dF/ds and B = dF/du when requested
+        void model(const State &s, double w, double a, const Eigen::VectorXd &coeffs,
+                   State &next, StateMatrix *A, InputMatrix *B) const;
+        // Stage QP of the deviations from _s, _u into _stages
+        void buildStages(const Eigen::VectorXd &coeffs);
+        // sum_i lambda_i d2F_i/ds2 at s, the curvature of the dynamics the
+        // Gauss-Newton Hessian leaves out
+        void curvature(const State &s, const State &lambda, const Eigen::VectorXd &coeffs, StateMatrix &H) const;
+
+        double _dt, _ref_cte, _ref_etheta, _ref_vel;
+        double _w_cte, _w_etheta, _w_vel, _w_angvel, _w_accel, _w_angvel_d, _w_accel_d;
+        double _max_angvel, _max_throttle;
+        int _mpc_steps;
+        int _qp_iterations;
+        bool _sparse;
+
+        // Stage-major linearization point and the QP work vectors
+        typedef RiccatiQp<NZ, NU> Qp;
+        std::vector<State, Eigen::aligned_allocator<State> > _s;
+        Qp::InputTrajectory _u, _du;
+        Qp::StateTrajectory _dz;
+        Qp::Stages _stages;
+        Qp _qp;
+
+        // LTV: the QP of the linearization point, sparse
+        bool stepSparse(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, std::vector<double> &vars);
+        // Pattern of the QP and P for a horizon of N steps
+        bool setupSparse(int N);
+        AdmmQp _admm;
+        AdmmQp::Matrix _qp_P, _qp_A;
+        std::vector<int> _jac_in_a; // value offsets in _qp_A of -A_k, -B_k per stage
+        Eigen::VectorXd _qp_q, _qp_l, _qp_u, _qp_x, _qp_y;
+        int _sparse_steps; // horizon of the pattern, 0 before the first
+        bool _sparse_warm; // _admm holds the multipliers of the previous tick
+};
+
+#endif /* RTI_SOLVER_H */
@@ -0,0 +1,62 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SCAN_CIRCLES_H
+#define SCAN_CIRCLES_H
+
+#include <vector>
+
+// Obstacles of the planner MPC straight from a laser scan, without the
+// update cycle of the costmap layers. One sweep over the beams splits the
+// scan where consecutive points are farther apart than max_gap and cuts the
+// runs at 2 max_radius, each piece is covered by a circle: a person is one
+// circle, a wall a chain of them. Only the max_circles closest to the robot
+// are kept, so the obstacle term looks at a handful of circles per step.
+class ScanCircles
+{
+    public:
+        struct Circle
+        {
+            double x, y, radius;
+        };
+
+        ScanCircles();
+
+        void Configure(double max_gap, double max_radius, double max_range, int max_circles);
+
+        // Beams of a scan as in sensor_msgs/LaserScan. The points are placed
+        // by the 2D transform of the sensor (x, y, yaw) into the frame of
+        // the circles, and sorted by their distance to rx, ry of that frame.
+        void Update(const float *ranges, int n, double angle_min, double angle_increment, double range_min, double range_max,
+                    double x, double y, double yaw, double rx, double ry);
+
+        const std::vector<Circle> &Circles() const { return _circles; }
+
+        // Distance of x, y to the edge of the closest circle and its
+        // gradient, false without circles
+        bool Distance(double x, double y, double &d, double &ddx, double &ddy) const;
+
+    private:
+        void close(double rx, double ry);
+
+        double _max_gap, _max_radius, _max_range;
+        int _max_circles;
+        std::vector<Circle> _circles;
+        std::vector<double> _px, _py; // points of the piece being swept
+        std::vector<double> _keys, _sorted; // distances of the circles to the robot, for the selection
+};
+
+#endif /* SCAN_CIRCLES_H */
@@ -0,0 +1,100 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SEED_PROVIDER_H
+#define SEED_PROVIDER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+
+// Starting inputs of a solve that has no previous solution to shift: a
+// new plan, tracking reacquired, the first solve. MPC::Solve rolls the
+// states out from them with the model, so the start is feasible, and
+// falls back to the pure pursuit seed (PURSUIT_SEED) or zero inputs when
+// the provider has nothing. See MPC::SetSeedProvider().
+class SeedProvider
+{
+    public:
+        virtual ~SeedProvider() {}
+
+        // steps - 1 turn rates and accelerations for the solve from state
+        // (x, y, theta, v, cte, etheta) on the path coeffs. False if the
+        // provider does not cover it. Called from the thread that solves.
+        virtual bool Seed(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, int steps,
+                          std::vector<double> &angvel, std::vector<double> &accel) = 0;
+};
+
+// Reference SeedProvider: the input sequences of solved problems, trained
+// offline by mpc_seed from trajectory logs or flight recorder dumps, and
+// the inverse-distance weighted mean of those of the nearest problems at
+// runtime. A problem is the feature vector (v, cte, etheta, c0..c3) of the
+// cubic path of MPC_Node, each feature divided by its spread over the
+// training set. The search is brute force over fixed-size vectors, a few
+// microseconds for some thousand samples.
+//
+// File layout (host byte order, written by Write()): a header with the
+// horizon, the sample count, the parameter hash and the feature scales,
+// then per sample the features as doubles and the angvel and a sequences
+// as floats.
+class NeighborSeed : public SeedProvider
+{
+    public:
+        enum { FEATURES = 7 };
+        typedef Eigen::Matrix<double, FEATURES, 1> Feature;
+
+        NeighborSeed();
+
+        // Empty training set for a horizon of steps and the model
+        // parameters params_hash (ControlTable::HashParams)
+        void Create(int steps, unsigned long long params_hash);
+        // Training sample, false if coeffs is not a cubic or the sequences
+        // do not have steps - 1 entries
+        bool Add(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs,
+                 const std::vector<double> &angvel, const std::vector<double> &accel);
+        bool Write(const std::string &path);
+        bool Open(const std::string &path);
+
+        size_t Size() const { return _features.size(); }
+        int Steps() const { return _steps; }
+        unsigned long long ParamsHash() const { return _params_hash; }
+        // Neighbours of a query, 3 by default
+        void SetNeighbors(int neighbors) { _neighbors = neighbors < 1 ? 1 : neighbors; }
+
+        bool Seed(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, int steps,
+                  std::vector<double> &angvel, std::vector<double> &accel);
+
+        // Features of a problem, false if coeffs is not a cubic
+        static bool Features(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, Feature &feature);
+
+    private:
+        // Scales of the features from the training set
+        void updateScale();
+
+        int _steps, _neighbors;
+        unsigned long long _params_hash;
+        Feature _scale;
+        std::vector<Feature, Eigen::aligned_allocator<Feature> > _features, _scaled;
+        std::vector<float> _inputs; // per sample steps - 1 angvel, then steps - 1 a
+
+        // Search buffers, kept between queries
+        std::vector<int> _nearest;
+        std::vector<double> _distance;
+};
+
+#endif /* SEED_PROVIDER_H */
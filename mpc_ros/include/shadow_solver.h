@@ -0,0 +1,89 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SHADOW_SOLVER_H
+#define SHADOW_SOLVER_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+
+class ShadowMetrics;
+class ControllerMetrics;
+
+// Shadow mode: candidate solver backends solve the inputs of every primary
+// solve on threads of their own, and only their latency, iterations and
+// the difference of their first command to the applied one are kept, in
+// ShadowMetrics of the controller metrics. Nothing of them is applied.
+//
+// The primary never waits on them: Submit() only try-locks the mailbox of
+// each backend, and a backend still busy with an older input has that
+// input replaced (counted as dropped). The threads run at SCHED_IDLE
+// (nice 19 where that is refused), optionally on their own CPUs, so they
+// only get the cores the primary and the rest of the system leave idle.
+// Each backend keeps its own warm start from its own last solution.
+class ShadowSolver
+{
+    public:
+        // A backend: the MPC parameters that select it over those of the
+        // primary, and whether it solves the generated model
+        struct Backend
+        {
+            std::string name;
+            std::map<std::string, double> params;
+            bool codegen;
+        };
+
+        // Comma separated backends: ipopt, rti, ltv, analytic or codegen,
+        // each optionally followed by +KEY=value overrides of MPC
+        // parameters, e.g. "rti,ipopt+HESSIAN=1". False on an unknown
+        // name or a malformed override, error says which.
+        static bool Parse(const std::string &spec, std::vector<Backend> &backends, std::string &error);
+
+        ShadowSolver();
+        ~ShadowSolver();
+
+        // Every backend gets a ShadowMetrics in metrics, so before the
+        // metrics are read from another thread. Their threads run on cpus
+        // ("2,3" or "2-3", empty for any), codegen_library is the model of
+        // codegen backends.
+        void Configure(const std::vector<Backend> &backends, const std::string &codegen_library,
+                       const std::string &cpus, ControllerMetrics &metrics);
+        // One thread per backend, solving with params and move_blocks of
+        // the primary and the overrides of the backend
+        void Start(const std::map<std::string, double> &params, const std::vector<int> &move_blocks);
+        void Stop();
+        bool Enabled() const { return !_workers.empty(); }
+
+        // Parameters of the primary changed, every backend reloads before
+        // its next solve
+        void SetParams(const std::map<std::string, double> &params, const std::vector<int> &move_blocks);
+
+        // Inputs of a primary solve of solve_ms and its first command.
+        // Never waits.
+        void Submit(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, double deadline, bool near_goal,
+                    double angvel, double accel, double solve_ms);
+
+    private:
+        struct Worker;
+        static void run(Worker *worker);
+
+        std::vector<std::unique_ptr<Worker> > _workers;
+};
+
+#endif /* SHADOW_SOLVER_H */
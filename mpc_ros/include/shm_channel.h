@@ -0,0 +1,141 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SHM_CHANNEL_H
+#define SHM_CHANNEL_H
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <string>
+#include <stdint.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "latest_value.h"
+
+// Newest value of a plain struct between processes: the sequence lock of
+// LatestValue in a POSIX shared memory segment (/dev/shm/<name>). One
+// writer process Create()s it and Set()s, any number of readers Open() it
+// and Take() new values; no syscall, copy through the kernel or lock on
+// either side, a handoff is a few hundred stores and loads. The segment
+// outlives the writer, readers keep their mapping across its restarts.
+// Both sides have to be built with the same T (checked by size) on one
+// machine. For the plain structs of shm_topics.h and CommandWindow.
+template <class T>
+class ShmChannel
+{
+    public:
+        ShmChannel() : _segment(NULL), _version(0) {}
+        ~ShmChannel() { Close(); }
+
+        // Writer: the segment of name, created if needed. A segment left by
+        // an earlier writer with the same T is taken over as it is.
+        bool Create(const std::string &name) { return map(name, true); }
+        // Reader: the segment of a writer, false while there is none yet
+        bool Open(const std::string &name) { return map(name, false); }
+        bool IsOpen() const { return _segment != NULL; }
+        const std::string &Error() const { return _error; }
+
+        void Close()
+        {
+            if (_segment)
+                munmap(_segment, sizeof(Segment));
+            _segment = NULL;
+        }
+
+        // Writer only
+        void Set(const T &value) { _segment->value.Set(value); }
+
+        // Reader only. False unless a value was Set() since the last Take().
+        bool Take(T &value)
+        {
+            unsigned version;
+            if (!_segment || !_segment->value.Get(value, version) || version == _version)
+                return false;
+            _version = version;
+            return true;
+        }
+
+    private:
+        struct Segment
+        {
+            std::atomic<uint32_t> magic; // MAGIC once value is constructed
+            uint32_t size;          // sizeof(T)
+            LatestValue<T> value;
+        };
+        static const uint32_t MAGIC = 0x4d505348; // "MPSH"
+
+        bool map(const std::string &name, bool create)
+        {
+            Close();
+            const std::string path = name.empty() || name[0] == '/' ? name : "/" + name;
+            const int fd = shm_open(path.c_str(), create ? O_RDWR | O_CREAT : O_RDWR, 0660);
+            if (fd < 0)
+                return fail(path);
+            struct stat st;
+            if (create && fstat(fd, &st) == 0 && st.st_size == 0 && ftruncate(fd, sizeof(Segment)) != 0)
+            {
+                close(fd);
+                return fail(path);
+            }
+            if (fstat(fd, &st) != 0 || size_t(st.st_size) != sizeof(Segment))
+            {
+                close(fd);
+                _error = path + " is not a segment of this type";
+                return false;
+            }
+            void *mem = mmap(NULL, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            close(fd);
+            if (mem == MAP_FAILED)
+                return fail(path);
+            Segment *segment = static_cast<Segment *>(mem);
+            if (segment->magic.load(std::memory_order_acquire) != MAGIC || segment->size != sizeof(T))
+            {
+                if (!create)
+                {
+                    munmap(mem, sizeof(Segment));
+                    _error = path + " is not initialized yet";
+                    return false;
+                }
+                // A fresh segment is zero, the value has to be constructed
+                new (&segment->value) LatestValue<T>();
+                segment->size = sizeof(T);
+                segment->magic.store(MAGIC, std::memory_order_release);
+            }
+            _segment = segment;
+            _version = 0;
+            _error.clear();
+            return true;
+        }
+
+        bool fail(const std::string &path)
+        {
+            _error = path + ": " + strerror(errno);
+            return false;
+        }
+
+        // Only address-free atomics work across processes
+        static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2, "lock-free atomics needed");
+
+        Segment *_segment;
+        unsigned _version; // of the last Take()
+        std::string _error;
+};
+
+#endif /* SHM_CHANNEL_H */
@@ -0,0 +1,60 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SHM_TOPICS_H
+#define SHM_TOPICS_H
+
+#include <stdint.h>
+
+// Plain structs of the shared memory channels of MPC_Node (shm_channel.h),
+// for the localization and base driver processes on the other end. Stamps
+// are ROS time in seconds.
+
+// Odometry in (shm_odom), as nav_msgs/Odometry: pose in the odom frame,
+// twist in the body frame
+struct ShmOdometry
+{
+    double stamp;
+    double x, y, z;
+    double qx, qy, qz, qw;
+    double vx, vy, wz;
+};
+
+// cmd_vel out (shm_cmd_vel)
+struct ShmTwist
+{
+    double stamp;
+    double linear_x, angular_z;
+};
+
+// Predicted trajectory out (shm_trajectory), the layout of
+// msg/MPCTrajectory.msg in fixed arrays, in the vehicle frame of the solve
+struct ShmTrajectory
+{
+    enum { CAPACITY = 64, STRIDE = 6 };
+
+    double stamp;
+    int32_t steps;          // points in states, at most CAPACITY
+    int32_t grid;           // step_dt holds the step of each point, else dt
+    float dt;
+    float states[CAPACITY * STRIDE]; // x, y, theta, v, angvel, accel
+    float step_dt[CAPACITY];
+    int32_t status, iterations;
+    float solve_ms, cost;
+    uint8_t feasible, fallback;
+};
+
+#endif /* SHM_TOPICS_H */
@@ -0,0 +1,73 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SHM_TRANSPORT_H
+#define SHM_TRANSPORT_H
+
+#include <atomic>
+#include <string>
+#include <nav_msgs/Odometry.h>
+#include <mpc_ros/MPCTrajectory.h>
+#include "shm_channel.h"
+#include "shm_topics.h"
+#include "command_window.h"
+
+// Shared memory channels of a controller node in place of its hot topics,
+// see shm_channel.h: odometry in, cmd_vel, the command sequence (wheel
+// commands, as the ros_control loop of hardware_controller.h gets them) and
+// the compact trajectory out. Every channel is optional, the ROS topics stay
+// up next to them. The node takes the ROS odometry only while no shared
+// odometry arrived for odom_timeout.
+class ShmTransport
+{
+    public:
+        // Segment names, empty ones are off
+        struct Config
+        {
+            std::string odom, cmd_vel, commands, trajectory;
+            double odom_timeout; // [s]
+        };
+
+        ShmTransport();
+
+        // The output segments are created here, the odometry segment is
+        // opened once its writer made it. Failures in report.
+        void Configure(const Config &config, std::string &report);
+
+        // Newest shared odometry since the last call, NULL if there is none.
+        // One thread only (the control loop).
+        nav_msgs::Odometry::Ptr TakeOdometry(const std::string &frame, const std::string &child_frame);
+        // A shared odometry arrived within odom_timeout, from any thread
+        bool OdometryLive() const;
+
+        void PublishTwist(double stamp, double linear_x, double angular_z);
+        void PublishCommands(const CommandWindow &window);
+        bool TrajectoryOpen() const { return _trajectory.IsOpen(); }
+        void PublishTrajectory(const mpc_ros::MPCTrajectory &traj);
+
+    private:
+        static double now();
+
+        Config _config;
+        ShmChannel<ShmOdometry> _odom;
+        ShmChannel<ShmTwist> _cmd_vel;
+        ShmChannel<CommandWindow> _commands;
+        ShmChannel<ShmTrajectory> _trajectory;
+        double _odom_retry; // next Open() of the odometry
+        std::atomic<double> _odom_seen;
+};
+
+#endif /* SHM_TRANSPORT_H */
@@ -0,0 +1,297 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SIMD_DOUBLE_H
+#define SIMD_DOUBLE_H
+
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <cppad/base_require.hpp>
+
+// N doubles operated on lane by lane, a CppAD Base type: a tape recorded
+// on AD< simd_double<N> > evaluates N points per Forward() sweep. The
+// lanes are plain loops over the array, which -O3 vectorizes (N = 4 fills
+// an AVX2 register, 2 a NEON one); decoding the tape is paid once per
+// sweep instead of once per point.
+//
+// Like CppAD's base_*.hpp for a non-standard Base type, include this header
+// before <cppad/cppad.hpp>.
+//
+// Comparisons, IdenticalZero() and the like hold if they hold in every
+// lane. Recording decides on them, so its parameters (constants) have
+// to be the same in every lane, and only the independent variables
+// differ. CondExp selects per lane. Conditional skips have no per-lane
+// meaning, so do not optimize() these tapes. No alignment is asked for,
+// because CppAD's thread_alloc only guarantees that of double; with
+// BUILD_ALIGNED_ALLOC its buffers start on 64 bytes, so that the lanes of
+// N = 4 or 8 never straddle a cache line in the Taylor coefficients.
+template <size_t N>
+class simd_double
+{
+    public:
+        simd_double()
+        {
+            for (size_t i = 0; i < N; i++)
+                _v[i] = 0.0;
+        }
+        simd_double(double x)
+        {
+            for (size_t i = 0; i < N; i++)
+                _v[i] = x;
+        }
+
+        static size_t size() { return N; }
+        double &operator[](size_t i) { return _v[i]; }
+        const double &operator[](size_t i) const { return _v[i]; }
+
+        simd_double operator+() const { return *this; }
+        simd_double operator-() const
+        {
+            simd_double r;
+            for (size_t i = 0; i < N; i++)
+                r._v[i] = -_v[i];
+            return r;
+        }
+
+#define SIMD_DOUBLE_ASSIGN(op)                                  \
+        simd_double &operator op##=(const simd_double &y)       \
+        {                                                       \
+            for (size_t i = 0; i < N; i++)                      \
+                _v[i] op##= y._v[i];                            \
+            return *this;                                       \
+        }                                                       \
+        friend simd_double operator op(simd_double x, const simd_double &y) \
+        {                                                       \
+            return x op##= y;                                   \
+        }
+        SIMD_DOUBLE_ASSIGN(+)
+        SIMD_DOUBLE_ASSIGN(-)
+        SIMD_DOUBLE_ASSIGN(*)
+        SIMD_DOUBLE_ASSIGN(/)
+#undef SIMD_DOUBLE_ASSIGN
+
+        // True if it holds in every lane (!= in some)
+#define SIMD_DOUBLE_COMPARE(op)                                 \
+        friend bool operator op(const simd_double &x, const simd_double &y) \
+        {                                                       \
+            bool all = true;                                    \
+            for (size_t i = 0; i < N; i++)                      \
+                all &= x._v[i] op y._v[i];                      \
+            return all;                                         \
+        }
+        SIMD_DOUBLE_COMPARE(==)
+        SIMD_DOUBLE_COMPARE(<)
+        SIMD_DOUBLE_COMPARE(<=)
+        SIMD_DOUBLE_COMPARE(>)
+        SIMD_DOUBLE_COMPARE(>=)
+#undef SIMD_DOUBLE_COMPARE
+        friend bool operator!=(const simd_double &x, const simd_double &y) { return !(x == y); }
+
+        friend std::ostream &operator<<(std::ostream &os, const simd_double &x)
+        {
+            os << '{';
+            for (size_t i = 0; i < N; i++)
+                os << (i == 0 ? "" : ", ") << x._v[i];
+            return os << '}';
+        }
+
+    private:
+        double _v[N];
+};
+
+// Lane-wise function of one simd_double
+template <size_t N, class Fun>
+inline simd_double<N> simd_apply(const simd_double<N> &x, Fun fun)
+{
+    simd_double<N> r;
+    for (size_t i = 0; i < N; i++)
+        r[i] = fun(x[i]);
+    return r;
+}
+
+// Base requirements, see cppad/base_require.hpp
+namespace CppAD
+{
+    template <size_t N>
+    inline simd_double<N> CondExpOp(enum CompareOp cop, const simd_double<N> &left, const simd_double<N> &right,
+                                    const simd_double<N> &exp_if_true, const simd_double<N> &exp_if_false)
+    {
+        simd_double<N> r;
+        for (size_t i = 0; i < N; i++)
+            r[i] = CondExpTemplate(cop, left[i], right[i], exp_if_true[i], exp_if_false[i]);
+        return r;
+    }
+
+#define SIMD_DOUBLE_COND_EXP_REL(Rel, Op)                                                     \
+    template <size_t N>                                                                       \
+    inline simd_double<N> CondExp##Rel(const simd_double<N> &left, const simd_double<N> &right, \
+                                       const simd_double<N> &exp_if_true, const simd_double<N> &exp_if_false) \
+    {                                                                                         \
+        return CondExpOp(Op, left, right, exp_if_true, exp_if_false);                         \
+    }
+    SIMD_DOUBLE_COND_EXP_REL(Lt, CompareLt)
+    SIMD_DOUBLE_COND_EXP_REL(Le, CompareLe)
+    SIMD_DOUBLE_COND_EXP_REL(Eq, CompareEq)
+    SIMD_DOUBLE_COND_EXP_REL(Ge, CompareGe)
+    SIMD_DOUBLE_COND_EXP_REL(Gt, CompareGt)
+#undef SIMD_DOUBLE_COND_EXP_REL
+
+    template <size_t N>
+    inline bool EqualOpSeq(const simd_double<N> &x, const simd_double<N> &y) { return x == y; }
+
+    template <size_t N>
+    inline bool IdenticalPar(const simd_double<N> &) { return true; }
+    template <size_t N>
+    inline bool IdenticalZero(const simd_double<N> &x) { return x == simd_double<N>(0.0); }
+    template <size_t N>
+    inline bool IdenticalOne(const simd_double<N> &x) { return x == simd_double<N>(1.0); }
+    template <size_t N>
+    inline bool IdenticalEqualPar(const simd_double<N> &x, const simd_double<N> &y) { return x == y; }
+
+    // VecAD indices, taken from the first lane
+    template <size_t N>
+    inline int Integer(const simd_double<N> &x) { return static_cast<int>(x[0]); }
+
+    template <size_t N>
+    inline simd_double<N> azmul(const simd_double<N> &x, const simd_double<N> &y)
+    {
+        simd_double<N> r;
+        for (size_t i = 0; i < N; i++)
+            r[i] = x[i] == 0.0 ? 0.0 : x[i] * y[i];
+        return r;
+    }
+
+    template <size_t N>
+    inline bool GreaterThanZero(const simd_double<N> &x) { return x > simd_double<N>(0.0); }
+    template <size_t N>
+    inline bool GreaterThanOrZero(const simd_double<N> &x) { return x >= simd_double<N>(0.0); }
+    template <size_t N>
+    inline bool LessThanZero(const simd_double<N> &x) { return x < simd_double<N>(0.0); }
+    template <size_t N>
+    inline bool LessThanOrZero(const simd_double<N> &x) { return x <= simd_double<N>(0.0); }
+    template <size_t N>
+    inline bool abs_geq(const simd_double<N> &x, const simd_double<N> &y)
+    {
+        bool all = true;
+        for (size_t i = 0; i < N; i++)
+            all &= std::fabs(x[i]) >= std::fabs(y[i]);
+        return all;
+    }
+
+#define SIMD_DOUBLE_UNARY(fun)                                              \
+    template <size_t N>                                                     \
+    inline simd_double<N> fun(const simd_double<N> &x)                      \
+    {                                                                       \
+        return simd_apply(x, static_cast<double (*)(double)>(std::fun));    \
+    }
+    SIMD_DOUBLE_UNARY(acos)
+    SIMD_DOUBLE_UNARY(asin)
+    SIMD_DOUBLE_UNARY(atan)
+    SIMD_DOUBLE_UNARY(cos)
+    SIMD_DOUBLE_UNARY(cosh)
+    SIMD_DOUBLE_UNARY(exp)
+    SIMD_DOUBLE_UNARY(fabs)
+    SIMD_DOUBLE_UNARY(log)
+    SIMD_DOUBLE_UNARY(log10)
+    SIMD_DOUBLE_UNARY(sin)
+    SIMD_DOUBLE_UNARY(sinh)
+    SIMD_DOUBLE_UNARY(sqrt)
+    SIMD_DOUBLE_UNARY(tan)
+    SIMD_DOUBLE_UNARY(tanh)
+# if CPPAD_USE_CPLUSPLUS_2011
+    SIMD_DOUBLE_UNARY(erf)
+    SIMD_DOUBLE_UNARY(asinh)
+    SIMD_DOUBLE_UNARY(acosh)
+    SIMD_DOUBLE_UNARY(atanh)
+    SIMD_DOUBLE_UNARY(expm1)
+    SIMD_DOUBLE_UNARY(log1p)
+# endif
+#undef SIMD_DOUBLE_UNARY
+
+    template <size_t N>
+    inline simd_double<N> abs(const simd_double<N> &x) { return fabs(x); }
+
+    template <size_t N>
+    inline simd_double<N> sign(const simd_double<N> &x)
+    {
+        simd_double<N> r;
+        for (size_t i = 0; i < N; i++)
+            r[i] = x[i] > 0.0 ? 1.0 : x[i] == 0.0 ? 0.0 : -1.0;
+        return r;
+    }
+
+    template <size_t N>
+    inline simd_double<N> pow(const simd_double<N> &x, const simd_double<N> &y)
+    {
+        simd_double<N> r;
+        for (size_t i = 0; i < N; i++)
+            r[i] = std::pow(x[i], y[i]);
+        return r;
+    }
+
+    template <size_t N>
+    class numeric_limits< simd_double<N> >
+    {
+        public:
+            static simd_double<N> min() { return std::numeric_limits<double>::min(); }
+            static simd_double<N> max() { return std::numeric_limits<double>::max(); }
+            static simd_double<N> epsilon() { return std::numeric_limits<double>::epsilon(); }
+            static simd_double<N> quiet_NaN() { return std::numeric_limits<double>::quiet_NaN(); }
+            static const int digits10 = std::numeric_limits<double>::digits10;
+    };
+
+    template <size_t N>
+    struct to_string_struct< simd_double<N> >
+    {
+        std::string operator()(const simd_double<N> &x)
+        {
+            std::stringstream os;
+            os << std::setprecision(1 + std::numeric_limits<double>::digits10) << x;
+            return os.str();
+        }
+    };
+}
+
+// After the functions above, which its generic kernels call
+#include <cppad/local/fast_math.hpp>
+
+#if CPPAD_FAST_MATH
+// Zero order kernels of the sweeps lane by lane
+namespace CppAD
+{
+    namespace local
+    {
+        template <size_t N>
+        inline void math_sincos(const simd_double<N> &x, simd_double<N> &s, simd_double<N> &c)
+        {
+            for (size_t i = 0; i < N; i++)
+                fast_math::sincos(x[i], s[i], c[i]);
+        }
+        template <size_t N>
+        inline simd_double<N> math_atan(const simd_double<N> &x)
+        {
+            return simd_apply(x, fast_math::atan);
+        }
+    }
+}
+#endif
+
+#endif /* SIMD_DOUBLE_H */
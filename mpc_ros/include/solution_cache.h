@@ -0,0 +1,81 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef SOLUTION_CACHE_H
+#define SOLUTION_CACHE_H
+
+#include <vector>
+#include <Eigen/Core>
+
+// The last few MPC solutions keyed on their quantized inputs: initial
+// state, path coefficients, obstacle model, corridor, speed reference and a
+// version of the solver parameters. move_base calls the planner again with
+// the same pose and plan during oscillation checks and recoveries, a hit
+// hands back the stored solution instead of solving once more.
+class SolutionCache
+{
+    public:
+        // Outputs of MPC::Solve() kept per entry
+        struct Solution
+        {
+            double w, throttle, dt;
+            std::vector<double> x, y, theta, angvel, accel;
+            double total_cost, cte_cost, etheta_cost, vel_cost;
+            int status;
+        };
+
+        explicit SolutionCache(size_t capacity = 4);
+
+        // resolution: quantum of every key value, inputs closer than it
+        // share an entry. Disabling or another resolution clears it.
+        void Configure(bool enabled, double resolution);
+        bool Enabled() const { return _enabled; }
+
+        // New solver parameters, the entries of older versions never hit
+        void Invalidate() { _version++; }
+        void Clear();
+
+        // Stored solution of these inputs, 0 on a miss. The key is kept
+        // for the Insert() of the same cycle.
+        const Solution *Find(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs,
+                             const std::vector<double> &obstacles, const std::vector<double> &corridor,
+                             const std::vector<double> &speeds);
+        // Stores the solution of the last Find(), replacing the oldest entry
+        void Insert(const Solution &solution);
+
+        unsigned long Hits() const { return _hits; }
+        unsigned long Misses() const { return _misses; }
+
+    private:
+        struct Entry
+        {
+            std::vector<long long> key;
+            Solution solution;
+        };
+
+        bool _enabled;
+        double _resolution;
+        unsigned long _version;
+        std::vector<Entry> _entries;
+        size_t _capacity, _next; // ring, _next is the oldest once full
+        std::vector<long long> _key;
+        unsigned long _hits, _misses;
+
+        bool append(double value);
+};
+
+#endif /* SOLUTION_CACHE_H */
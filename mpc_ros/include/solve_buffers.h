@@ -0,0 +1,82 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef SOLVE_BUFFERS_H
+#define SOLVE_BUFFERS_H
+
+#include <vector>
+#include "cppad_instance.h"
+#include <cppad/ipopt/solve_result.hpp>
+
+// Vectors of one MPC::Solve, kept in the MPC so that the solves after the
+// first one reuse their memory instead of allocating it again. CppAD
+// vectors keep their capacity when resized to a smaller or equal length,
+// and what CppAD allocates itself stays in the thread_alloc pool of the
+// thread (hold_memory, see cppad_parallel.h).
+struct SolveBuffers
+{
+    typedef CPPAD_TESTVECTOR(double) Dvector;
+
+    // Size the problem vectors and clear the solution, which is then empty
+    // as if newly constructed but keeps its memory
+    void Resize(size_t n_vars, size_t n_constraints, size_t n_params)
+    {
+        vars.resize(n_vars);
+        vars_zl.resize(n_vars);
+        vars_zu.resize(n_vars);
+        lambda.resize(n_constraints);
+        vars_lowerbound.resize(n_vars);
+        vars_upperbound.resize(n_vars);
+        constraints_lowerbound.resize(n_constraints);
+        constraints_upperbound.resize(n_constraints);
+        params.resize(n_params);
+
+        solution.x.resize(0);
+        solution.zl.resize(0);
+        solution.zu.resize(0);
+        solution.g.resize(0);
+        solution.lambda.resize(0);
+        solution.obj_value = 0.0;
+        solution.status = CppAD::ipopt::solve_result<Dvector>::not_defined;
+    }
+
+    Dvector vars, vars_zl, vars_zu, lambda;
+    Dvector vars_lowerbound, vars_upperbound;
+    Dvector constraints_lowerbound, constraints_upperbound;
+    Dvector params; // trailing tape entries: path coefficients (and obstacle model)
+    CppAD::ipopt::solve_result<Dvector> solution;
+
+    // Shifted previous solution, see WarmStart::Shift
+    std::vector<double> w_vars, w_zl, w_zu, w_lambda;
+
+    // Variables watched by INPUT_STOP, see MPC::setInputStop
+    std::vector<size_t> input_stop;
+
+    // Inputs-only problem of the condensed formulation (CONDENSED), no
+    // constraints, see MPC::solveCondensed
+    Dvector condensed_vars, condensed_zl, condensed_zu, condensed_lowerbound, condensed_upperbound;
+    Dvector condensed_constraints; // empty bounds
+    CppAD::ipopt::solve_result<Dvector> condensed_solution;
+
+    // Problem without the cte and etheta variables and rows (REDUCED),
+    // see MPC::solveReduced
+    Dvector reduced_vars, reduced_zl, reduced_zu, reduced_lowerbound, reduced_upperbound;
+    Dvector reduced_constraints_lowerbound, reduced_constraints_upperbound, reduced_lambda;
+    CppAD::ipopt::solve_result<Dvector> reduced_solution;
+};
+
+#endif /* SOLVE_BUFFERS_H */
@@ -0,0 +1,47 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SOLVE_CORPUS_H
+#define SOLVE_CORPUS_H
+
+#include <Eigen/Core>
+#include <string>
+#include <vector>
+
+// Recorded (state, coeffs) samples of the offline solve tools
+// (mpc_solve_bench, mpc_ipopt_tune). Two CSV layouts are accepted, lines
+// that do not parse as numbers (headers) are skipped:
+//
+//   x,y,theta,v,cte,etheta,c0,c1,c2,c3    full state and path polynomial
+//   idx,cte,etheta,v,w                    the assets/*.csv controller logs
+//
+// For the log layout the robot sits at the origin of its own frame and the
+// path is the line through (0, cte) with heading etheta. Binary logs written
+// by TrajectoryLog (log_path of the nodes) are read as well, with the state
+// and coefficients of every record.
+struct SolveSample
+{
+    Eigen::VectorXd state, coeffs;
+};
+
+// One CSV line, false if it is not in either layout
+bool ParseSolveSample(const std::string &line, SolveSample &sample);
+
+// Samples of the log or CSV file at path in their order, false with the
+// reason in error if it cannot be read or holds none
+bool LoadSolveCorpus(const std::string &path, std::vector<SolveSample> &samples, std::string &error);
+
+#endif /* SOLVE_CORPUS_H */
@@ -0,0 +1,95 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SOLVE_POLICY_H
+#define SOLVE_POLICY_H
+
+#include <algorithm>
+#include <map>
+#include <string>
+
+// Ipopt termination settings of the next MPC solve by operating phase.
+//
+// The first STARTUP_SOLVES solves after a cold start, and those after a
+// solve that failed while tracking, run in the STARTUP phase: tight
+// tolerances, many iterations and the adaptive barrier update, to find
+// a good plan to warm start from. Steady TRACKING solves start from the
+// shifted previous plan and stop early at coarse tolerances with the
+// monotone barrier update, since the next cycle refines the same plan
+// anyway. NEAR_GOAL (set by the node within its goal distance) tightens
+// them again for docking. With a deadline, max_iter is also capped to
+// the iterations that fit in SLACK times the budget at the measured
+// time per iteration; a solve that hits the cap ends at the first
+// acceptable point. With a prediction of the solve (Predict(),
+// solve_time_model.h) the cap takes the predicted time per iteration, and
+// a solve predicted to need more iterations than fit starts with its
+// tolerances coarsened by the ratio, at most MAX_COARSEN times.
+class SolvePolicy
+{
+    public:
+        enum Phase { STARTUP, TRACKING, NEAR_GOAL, NUM_PHASES };
+
+        struct Settings
+        {
+            double tol, acceptable_tol;
+            int acceptable_iter, max_iter;
+            bool adaptive_mu;
+        };
+
+        SolvePolicy();
+
+        // Same keys as MPC::LoadParams, POLICY enables it. The settings
+        // of a phase are TOL_<P>, ACCEPTABLE_TOL_<P>, ACCEPTABLE_ITER_<P>,
+        // MAX_ITER_<P> and ADAPTIVE_MU_<P>, P one of STARTUP, TRACKING
+        // and GOAL.
+        void LoadParams(const std::map<std::string, double> &params);
+        bool Enabled() const { return _enabled; }
+
+        void SetNearGoal(bool near_goal) { _near_goal = near_goal; }
+        // tol and acceptable_tol of every phase times scale (>= 1), the
+        // CPU governor's knob, see cpu_governor.h
+        void SetToleranceScale(double scale) { _tol_scale = std::max(1.0, scale); }
+        // Back to the STARTUP phase, on a cold start
+        void Restart() { _startup_left = _startup_solves; }
+
+        // Phase of the next solve within deadline seconds (<= 0: no
+        // limit), its options in the CppAD::ipopt::solve syntax
+        Phase Next(double deadline, std::string &options);
+        // Predicted iterations and time per iteration [ms] of the next
+        // solve, for the next Next() only
+        void Predict(double iterations, double iteration_ms);
+        // Outcome of the solve after Next()
+        void Observe(bool converged, double solve_ms, int iterations);
+
+        Phase Current() const { return _phase; }
+        const Settings &PhaseSettings(Phase phase) const { return _settings[phase]; }
+        static const char *Name(int phase);
+
+    private:
+        bool _enabled;
+        Settings _settings[NUM_PHASES];
+        int _startup_solves;
+        double _slack;
+
+        bool _near_goal;
+        int _startup_left;
+        Phase _phase;
+        double _iteration_ms; // measured time per iteration, 0 before the first
+        double _predicted_iterations, _predicted_ms; // Predict(), 0 without
+        double _tol_scale;
+};
+
+#endif /* SOLVE_POLICY_H */
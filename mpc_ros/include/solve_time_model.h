@@ -0,0 +1,87 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef SOLVE_TIME_MODEL_H
+#define SOLVE_TIME_MODEL_H
+
+#include <map>
+#include <string>
+#include <Eigen/Core>
+
+// Online prediction of the iterations and the wall time of the next MPC
+// solve, so that the horizon (horizon_selector.h) and the tolerances
+// (solve_policy.h) are fit to the deadline before a solve rather than
+// corrected after a miss.
+//
+// Iterations are linear in the features of a solve: the bend of the path
+// (|2 c2| + |6 c3| at the robot), the speed change since the last solve,
+// whether it starts from a shifted plan, the change of the reference at the
+// robot (c0 and c1), the iterations of the last solve and the horizon. The
+// time per iteration is linear in the horizon. Both are fitted by
+// recursive least squares with the forgetting factor PREDICT_FORGET on the
+// outcome of every solve, so they follow the load of the machine; nothing
+// is predicted before MIN_SAMPLES solves. Fixed-size, no allocation.
+class SolveTimeModel
+{
+    public:
+        enum { FEATURES = 7, MIN_SAMPLES = 20 };
+
+        SolveTimeModel();
+
+        // Same keys as MPC::LoadParams, PREDICT enables it. Learned
+        // weights are kept.
+        void LoadParams(const std::map<std::string, double> &params);
+        bool Enabled() const { return _enabled; }
+        bool Ready() const { return _enabled && _samples >= MIN_SAMPLES; }
+
+        // Inputs of the next solve: speed v, path polynomial coeffs in the
+        // vehicle frame, warm if it starts from the shifted previous plan
+        void Features(double v, const Eigen::VectorXd &coeffs, bool warm);
+        // Of a solve of steps with the last Features(), at least 1 iteration
+        double Iterations(int steps) const;
+        double IterationMs(int steps) const;
+        double SolveMs(int steps) const { return Iterations(steps) * IterationMs(steps); }
+
+        // Outcome of the solve after Features(), without the taping time.
+        // Backends that report no iterations (< 0) do not train it.
+        void Observe(int steps, int iterations, double solve_ms);
+
+        // Mean relative error of the predicted solve times so far
+        double Error() const { return _error; }
+
+    private:
+        typedef Eigen::Matrix<double, FEATURES, 1> Vector;
+        typedef Eigen::Matrix<double, FEATURES, FEATURES> Matrix;
+
+        void features(int steps, Vector &x) const;
+
+        bool _enabled;
+        double _forget;
+        int _samples;
+        // Iterations of the features, time per iteration of [1, steps]
+        Vector _w;
+        Matrix _p;
+        Eigen::Vector2d _u;
+        Eigen::Matrix2d _q;
+        // Inputs of the next solve, and of the last one
+        double _bend, _dv, _warm, _dref;
+        double _last_v, _last_c0, _last_c1;
+        int _last_iterations;
+        double _error;
+};
+
+#endif /* SOLVE_TIME_MODEL_H */
@@ -0,0 +1,80 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef SOLVER_SNAPSHOT_H
+#define SOLVER_SNAPSHOT_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "tape_solver.h"
+#include "warm_start.h"
+
+// Hot restart of an MPC: what a restarted node or a reloaded planner plugin
+// would otherwise rebuild cold over its first cycles, in one file. Point it
+// to /dev/shm to keep it in memory.
+//
+//  - the TapeStructure of the persistent tape: sparsity patterns, entry
+//    lists and the colorings the first solve computes. The tape itself is
+//    recorded again, a few milliseconds; with the structure adopted
+//    (TapeSolver::AdoptStructure) that recording skips the sparsity sweeps
+//    and the first solve the coloring.
+//  - the warm start, primal and dual, taken only while it is younger than
+//    the caller allows: the robot went on while the process was down.
+//
+// Ipopt's symbolic factorization lives in the linear solver and is done
+// again on the first solve.
+//
+// A snapshot is valid for a model when the hash of all MPC parameters
+// matches and the tape records with the same dimensions and number of
+// variables and operations after optimize(), which a change of the model
+// code would also alter. Write() goes through a temporary file and a
+// rename, so a reader never sees half of one. Host byte order, a snapshot
+// is not meant to move between machines. The structure is in CppAD memory:
+// read and adopt it on the thread that solves.
+struct SolverSnapshot
+{
+    SolverSnapshot();
+
+    unsigned long long params_hash; // HashParams() of the parameters
+    unsigned long params_version;   // MPC::_mpc_params_version when written
+    double stamp;                   // wall time of the write [s since epoch]
+
+    // Persistent tape, structure NULL without one
+    size_t n_vars, n_constraints, n_params, size_var, size_op;
+    double hes_density;
+    std::shared_ptr<TapeStructure> structure;
+
+    // Warm start, steps 0 without one
+    int steps;
+    std::vector<double> x, zl, zu, lambda;
+
+    // From the tape (NULL for none) and warm start of an MPC
+    void Capture(const TapeSolver *tape, const WarmStart &warm);
+
+    bool Write(const std::string &path) const;
+    // False if the file is missing, of another format or truncated
+    bool Read(const std::string &path);
+
+    // FNV-1a over every key and value
+    static unsigned long long HashParams(const std::map<std::string, double> &params);
+    // Wall time now [s since epoch]
+    static double Now();
+};
+
+#endif /* SOLVER_SNAPSHOT_H */
@@ -0,0 +1,95 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SOLVER_THREAD_H
+#define SOLVER_THREAD_H
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include "realtime.h"
+#include "plan_sensitivity.h"
+
+// Result of one MPC solve: the first command and the rest of the predicted
+// input sequence, so the control timer can keep replaying it while the next
+// solve is still running.
+struct MPCCommand
+{
+    MPCCommand();
+
+    // Speed and angular velocity to apply at time t, taken from the predicted
+    // sequence. False if t is outside of the predicted horizon.
+    bool Sample(double t, double &speed, double &angvel) const;
+    // Wheel torques to apply at time t, same steps. False if the solve
+    // did not predict torques (DYNAMIC model only).
+    bool SampleTorque(double t, double &right, double &left) const;
+
+    double stamp;   // time of the state snapshot the solve started from [s]
+    double dt;      // step of the prediction [s]
+    std::vector<double> step_dt; // step of each entry on a non-uniform grid, empty when all are dt [s]
+    std::vector<double> speed;
+    std::vector<double> angvel;
+    std::vector<double> torque_right, torque_left; // [N m], empty without the DYNAMIC model
+    std::shared_ptr<const PlanSensitivity> sensitivity; // input gains along the plan, NULL without SENSITIVITY
+
+private:
+    int step(double t) const; // index of the prediction step at t, -1 outside
+};
+
+// Runs the MPC solve on its own thread. Notify() wakes it up; it then starts
+// from the newest state, so requests arriving during a solve are merged into
+// one. The timer reads the latest command with Latest() and never blocks on
+// the solver.
+class SolverThread
+{
+    public:
+        typedef std::function<bool(MPCCommand&)> SolveFunction;
+
+        SolverThread();
+        ~SolverThread();
+
+        // The thread applies realtime before its first solve, Start() waits
+        // for it and RealtimeReport() tells what could not be applied
+        void Start(const SolveFunction &solve, const RealtimeSettings &realtime = RealtimeSettings());
+        void Stop();
+        bool IsRunning() const;
+
+        void Notify();
+        // Drop the current command, e.g. when the goal is reached
+        void Clear();
+        bool Latest(MPCCommand &cmd) const;
+        const std::string &RealtimeReport() const { return _realtime_report; }
+
+    private:
+        void Run();
+
+        SolveFunction _solve;
+        RealtimeSettings _realtime;
+        std::string _realtime_report;
+        bool _started;
+        std::thread _thread;
+        mutable std::mutex _mutex;
+        std::condition_variable _cond;
+        bool _running, _pending, _valid;
+        unsigned int _generation;
+        MPCCommand _latest;
+};
+
+#endif /* SOLVER_THREAD_H */
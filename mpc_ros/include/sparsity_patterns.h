@@ -0,0 +1,66 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SPARSITY_PATTERNS_H
+#define SPARSITY_PATTERNS_H
+
+#include <cstddef>
+#include "cppad_instance.h"
+
+// Sparsity patterns of a recorded MPC tape (SPARSITY parameter).
+//
+// CppAD propagates the patterns either as bit-packed rows (vectorBool, one
+// bit per column and variable) or as a std::set per variable. The packed
+// sweeps cost size_var * n / 64 words whatever the structure, the set sweeps
+// cost the entries in the sets. Banded models with a long horizon (a few
+// entries per Hessian row) are three times faster with sets, models with a
+// dense coupling term (the sets grow to n entries) ten times slower. The tape
+// alone does not tell which one it is before the first sweep, so AUTO picks
+// from the Hessian density of a previous pattern of the same model.
+namespace sparsity_patterns
+{
+    enum Representation
+    {
+        AUTO = -1, // SET after a sparse enough Hessian, PACK otherwise (default)
+        PACK = 0,  // vectorBool
+        SET = 1    // std::vector<std::set<size_t> >
+    };
+
+    // Representation for a tape with n columns. density is nnz / n^2 of the
+    // Hessian pattern of the last record of the model, < 0 if none: sets
+    // need more than two packed words per row and fewer Hessian entries per
+    // row than packed words.
+    Representation Choose(int requested, size_t n, double density);
+
+    // Jacobian (m x n) and Hessian of the sum of all rows (n x n) of fun,
+    // row major, using rep (AUTO is PACK). The forward sparsity is freed.
+    void Compute(CppAD::ADFun<double> &fun, Representation rep,
+                 CppAD::vectorBool &jac, CppAD::vectorBool &hes);
+
+    // Entries (row[k], col[k]) of the Jacobian of fun whose value does not
+    // depend on the domain: no Hessian entry of row[k] in row col[k]. One
+    // packed reverse Hessian sweep per row; rows are in order, as in
+    // TapeStructure. The forward sparsity is freed.
+    void ConstantEntries(CppAD::ADFun<double> &fun, const CppAD::vector<size_t> &row,
+                         const CppAD::vector<size_t> &col, CppAD::vector<bool> &constant);
+
+    // nnz / n^2 of an n x n pattern
+    double Density(const CppAD::vectorBool &pattern, size_t n);
+
+    const char *Name(int rep);
+}
+
+#endif /* SPARSITY_PATTERNS_H */
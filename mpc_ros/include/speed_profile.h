@@ -0,0 +1,78 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef SPEED_PROFILE_H
+#define SPEED_PROFILE_H
+
+#include <cstddef>
+#include <vector>
+#include "compact_path.h"
+
+// Reference speed along a plan that the robot can actually drive, for the
+// per-step speed reference of the planner MPC (MPC::SetSpeedReference).
+//
+// Per waypoint the speed is limited by the reference speed, by the angular
+// velocity and the lateral acceleration on the local curvature (three-point
+// curvature over a window of arc length, the waypoints of a grid planner
+// are too jagged for their direct neighbors), and by braking at the
+// acceleration limit for every slower waypoint ahead down to the end speed
+// at the goal. Update() runs once per plan: a new plan whose tail matches
+// the last one (a replan towards the same goal) keeps the speeds of that
+// tail and recomputes only the waypoints before it.
+//
+// Reference() rolls the profile out over the horizon from the current arc
+// length and speed, accelerating at most at the acceleration limit.
+class SpeedProfile
+{
+    public:
+        SpeedProfile();
+
+        // Reference speed [m/s], angular velocity [rad/s], lateral and
+        // longitudinal acceleration [m/s^2], curvature window [m], speed at
+        // the goal [m/s]. Other values than the last ones recompute the
+        // whole next plan.
+        void Configure(double max_speed, double max_angvel, double max_lat_accel, double max_accel, double window,
+                       double end_speed);
+
+        // Profile of path, nothing to do for the path of the last call
+        void Update(const CompactPath::ConstPtr &path);
+        // The profile of the same waypoints in another frame, computed by
+        // profile with the same configuration ahead of time (plan_prefetch.h):
+        // path takes its speeds instead of an Update() and profile is left
+        // empty. False, nothing changed, for other waypoints or settings.
+        bool Adopt(SpeedProfile &profile, const CompactPath::ConstPtr &path);
+        void Clear();
+
+        // Speed at arc length s of the path, linear between waypoints
+        double Speed(double s) const;
+        // n steps of dt from arc length s at speed v
+        void Reference(double s, double v, double dt, size_t n, double *speeds) const;
+
+        bool Empty() const { return _v.empty(); }
+        // Waypoints computed by the last Update() that changed the path
+        size_t Recomputed() const { return _recomputed; }
+
+    private:
+        size_t matchingTail(const CompactPath &path) const;
+        double limit(const CompactPath &path, size_t i, size_t &begin, size_t &end) const;
+
+        double _max_speed, _max_angvel, _max_lat_accel, _max_accel, _window, _end_speed;
+        CompactPath::ConstPtr _path;
+        std::vector<double> _v, _v_prev; // per waypoint of _path
+        size_t _recomputed;
+};
+
+#endif /* SPEED_PROFILE_H */
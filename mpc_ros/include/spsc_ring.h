@@ -0,0 +1,78 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Bounded lock-free queue for exactly one producer and one consumer thread.
+// The capacity is rounded up to a power of two; a full ring rejects the
+// element instead of blocking or allocating, so Push() is safe to call from
+// the control loop.
+template <class T>
+class SpscRing
+{
+    public:
+        explicit SpscRing(size_t capacity)
+        {
+            size_t size = 2;
+            while (size < capacity)
+                size *= 2;
+            _buffer.resize(size);
+            _mask = size - 1;
+            _head.store(0);
+            _tail.store(0);
+        }
+
+        size_t Capacity() const { return _buffer.size(); }
+
+        // Producer thread only. False if the ring is full.
+        bool Push(const T &value)
+        {
+            const size_t head = _head.load(std::memory_order_relaxed);
+            if (head - _tail.load(std::memory_order_acquire) >= _buffer.size())
+                return false;
+            _buffer[head & _mask] = value;
+            _head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer thread only. False if the ring is empty.
+        bool Pop(T &value)
+        {
+            const size_t tail = _tail.load(std::memory_order_relaxed);
+            if (tail == _head.load(std::memory_order_acquire))
+                return false;
+            value = _buffer[tail & _mask];
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        std::vector<T> _buffer;
+        size_t _mask;
+        // Free-running counters, head written by the producer and tail by
+        // the consumer. Padded apart so they do not share a cache line.
+        std::atomic<size_t> _head;
+        char _pad[64];
+        std::atomic<size_t> _tail;
+};
+
+#endif /* SPSC_RING_H */
@@ -0,0 +1,148 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef STAGE_HESSIAN_H
+#define STAGE_HESSIAN_H
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "cppad_instance.h"
+
+class WorkStealingPool;
+
+// Hessian of the Lagrangian of a partially separable model, summed stage by
+// stage instead of one colored sweep over the whole tape.
+//
+// A stage is a small function h(z) of a few entries of the tape domain
+// [vars | params], for the MPC one step of the horizon: the states at both
+// ends, its inputs, the path coefficients, and as outputs its model rows and
+// the cost terms of the step. Stages of one kind share a tape of their own,
+// recorded once; the MPC has one kind per step length and per set of cost
+// terms. The Hessian of w' h with respect to the leading vars entries of z
+// takes a few directions of a tape of some hundred operations, whose
+// coefficients stay in the cache, and is added to the Ipopt entries through
+// an index computed once.
+//
+// This is the Hessian of the whole tape only if the stages add up to it:
+// every row of fg that is not linear is an output of exactly one stage, and
+// the cost terms of the stages sum to fg[0] up to terms linear in the vars.
+// The caller decides that; Map() only checks that each stage entry is in the
+// Ipopt pattern.
+//
+// The stages are independent, so with SetThreads() Evaluate() splits them
+// into contiguous blocks, one for the calling thread and one per worker of
+// a pool. Neighbouring stages share variables, a block reads one slice of
+// x. Each worker records its own copy of the stage tapes (its Taylor
+// coefficients and CppAD memory stay on its thread, see cppad_parallel.h)
+// and sums into a Hessian of its own; the blocks are added in order, so the
+// result does not depend on the timing of the threads.
+class StageHessian
+{
+    public:
+        typedef CPPAD_TESTVECTOR(double) Dvector;
+        typedef CPPAD_TESTVECTOR(CppAD::AD<double>) ADvector;
+        // h = stage(z)
+        typedef std::function<void(ADvector&, const ADvector&)> StageFunction;
+
+        StageHessian() : _mapped(false), _pending(0) {}
+        // Frees the stage tapes of the workers on the workers
+        ~StageHessian();
+
+        // Record a kind of stage with n_z inputs and n_h outputs, the
+        // Hessian is taken with respect to the first n_hes inputs. Returns
+        // the kind for AddStage().
+        size_t AddKind(size_t n_z, size_t n_hes, size_t n_h, const StageFunction &stage);
+        // A stage of kind: z[j] is entry source[j] of [vars | params], the
+        // first n_hes of them vars. h[k] is weighted by w[row[k]] of the
+        // Lagrangian, row 0 is the cost and row 1 + i constraint i.
+        void AddStage(size_t kind, const std::vector<size_t> &source, const std::vector<size_t> &row);
+        size_t NumKinds() const { return _kinds.size(); }
+        size_t NumStages() const { return _stages.size(); }
+
+        // Position of every stage entry among the Ipopt entries (lower
+        // triangle, row_hes[k] >= col_hes[k]). False if one is missing.
+        bool Map(const CppAD::vector<size_t> &row_hes, const CppAD::vector<size_t> &col_hes);
+        bool IsMapped() const { return _mapped; }
+
+        // hes[k] = entry k of the Hessian of w' fg at x = [vars | params],
+        // after Map()
+        void Evaluate(const Dvector &x, const Dvector &w, Dvector &hes);
+
+        // Also evaluate on the workers of pool, pinned to them, one block of
+        // stages each; NULL for the calling thread only
+        void SetThreads(const std::shared_ptr<WorkStealingPool> &pool);
+        int NumThreads() const { return 1 + int(_workers.size()); }
+
+        // Memory of the stage tapes and the index, without the copies of
+        // the workers
+        size_t Bytes() const;
+
+    private:
+        StageHessian(const StageHessian &);
+        StageHessian &operator=(const StageHessian &);
+
+        struct Kind
+        {
+            StageFunction stage; // to record the copies of the workers
+            CppAD::ADFun<double> fun;
+            size_t n_z, n_hes, n_h;
+            // Pattern of the stage Hessian over z and its lower triangle
+            // entries in the first n_hes columns
+            CppAD::vectorBool pattern;
+            CppAD::vector<size_t> row, col;
+            CppAD::sparse_hessian_work work;
+            Dvector z, w, hes;
+        };
+        struct Stage
+        {
+            size_t kind;
+            std::vector<size_t> source, row;
+            // Ipopt entry of each entry of the kind; entries of two z that
+            // are the same variable off the diagonal count twice
+            std::vector<size_t> slot;
+            std::vector<double> scale;
+        };
+
+        // Copies of the stage tapes and the Hessian of a block of stages,
+        // only touched by their worker
+        struct Worker
+        {
+            std::vector<std::unique_ptr<Kind> > kinds;
+            Dvector hes;
+        };
+
+        static std::unique_ptr<Kind> record(size_t n_z, size_t n_hes, size_t n_h, const StageFunction &stage);
+        // hes = sum of the stages [begin, end) over kinds
+        void evaluate(std::vector<std::unique_ptr<Kind> > &kinds, size_t begin, size_t end,
+                      const Dvector &x, const Dvector &w, Dvector &hes) const;
+        // Run task(worker) on every worker and wait for all of them
+        void runWorkers(const std::function<void(size_t)> &task);
+
+        std::vector<std::unique_ptr<Kind> > _kinds;
+        std::vector<Stage> _stages;
+        bool _mapped;
+
+        std::shared_ptr<WorkStealingPool> _pool;
+        std::vector<Worker> _workers; // one per worker of _pool
+        std::mutex _mutex;
+        std::condition_variable _done;
+        size_t _pending; // workers still running, under _mutex
+};
+
+#endif /* STAGE_HESSIAN_H */
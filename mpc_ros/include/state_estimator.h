@@ -0,0 +1,94 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef STATE_ESTIMATOR_H
+#define STATE_ESTIMATOR_H
+
+#include <mutex>
+#include <Eigen/Core>
+
+// Extended Kalman filter of the unicycle state, run inside the controller
+// node on the sensor callbacks instead of reading it from an EKF node.
+//
+// The state x, y, theta (odom frame), v, w is predicted with constant speed
+// and turn rate between measurements, random walks on v and w. The wheel
+// speeds measure v and w, the gyro measures w, and pose corrections (the
+// odometry message, AMCL transformed to the odom frame) measure x, y and
+// theta; the first pose starts the filter. Both are fixed-size Eigen types,
+// an update never allocates.
+//
+// Measurements arrive late, a pose correction by a whole localization cycle:
+// the filter keeps its last states, the residual of a measurement older than
+// the newest one is taken against the state of its stamp and corrects the
+// current state. Older than max_age they are dropped.
+//
+// All calls lock, the callbacks may run on different threads.
+class StateEstimator
+{
+    public:
+        enum { X, Y, THETA, V, W, SIZE };
+        typedef Eigen::Matrix<double, SIZE, 1> State;
+        typedef Eigen::Matrix<double, SIZE, SIZE> Covariance;
+
+        StateEstimator();
+
+        // Standard deviations of the random walks on v [m/s^2] and w
+        // [rad/s^2], of the wheel speeds [m/s] and [rad/s], of the gyro
+        // [rad/s] and of a pose without its own covariance [m] and [rad];
+        // oldest measurement used [s]
+        void Configure(double accel_noise, double angaccel_noise, double wheel_v_noise, double wheel_w_noise,
+                       double gyro_noise, double position_noise, double heading_noise, double max_age);
+        void Reset();
+        bool Initialized() const;
+
+        // Pose in the odom frame measured at stamp [s], variances <= 0 take
+        // the configured noise
+        void UpdatePose(double stamp, double x, double y, double theta, double var_xy = -1, double var_theta = -1);
+        // Speed and turn rate of the wheels
+        void UpdateWheels(double stamp, double v, double w);
+        // Turn rate of the gyro
+        void UpdateGyro(double stamp, double w);
+
+        // Estimate predicted to stamp, false before the first pose
+        bool Predict(double stamp, double &x, double &y, double &theta, double &v, double &w) const;
+        // Time of the newest measurement [s]
+        double Stamp() const;
+
+    private:
+        enum { HISTORY = 32 };
+
+        static void propagate(State &x, double dt);
+        void predict(double stamp);
+        bool past(double stamp, State &x) const;
+        template <int M>
+        void correct(double stamp, const Eigen::Matrix<double, M, SIZE> &h, const Eigen::Matrix<double, M, 1> &z,
+                     const Eigen::Matrix<double, M, M> &r, bool angle);
+
+        mutable std::mutex _mutex;
+        bool _initialized;
+        double _stamp;
+        State _x;
+        Covariance _p;
+        double _accel_noise, _angaccel_noise, _wheel_v_noise, _wheel_w_noise, _gyro_noise;
+        double _position_noise, _heading_noise, _max_age;
+
+        // Ring of the last states after each measurement
+        double _history_stamp[HISTORY];
+        State _history[HISTORY];
+        int _history_next, _history_size;
+};
+
+#endif /* STATE_ESTIMATOR_H */
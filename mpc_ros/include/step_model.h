@@ -0,0 +1,87 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef STEP_MODEL_H
+#define STEP_MODEL_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "cppad_instance.h"
+#include "atomic_pattern.h"
+
+// One step of the unicycle model of FG_eval as a CppAD atomic function.
+//
+// Residuals() records the six dynamics constraints of step t -> t+1
+// operation by operation. Called through a StepModel instead, the step is a
+// single atomic operation of the MPC tape: the step is recorded once into a
+// small ADFun, which the tape sweeps evaluate for every step, so the tape
+// grows by one operation per step instead of a few dozen.
+//
+// This is CppAD::checkpoint with two changes. checkpoint keeps one ADFun
+// and its Taylor coefficients for all threads, while tapes are recorded on
+// a TapeBuilder thread and solved on another one; here every thread
+// evaluates its own copy of the step. The sparsity patterns are not swept
+// through that copy but taken from tables, see atomic_pattern.h.
+
+class StepModel : public PatternAtomic
+{
+    public:
+        typedef CPPAD_TESTVECTOR(CppAD::AD<double>) ADvector;
+
+        // Inputs: the state at t and t+1, the inputs held over the step,
+        // dt, then the path polynomial coefficients
+        enum Input
+        {
+            X0, Y0, THETA0, V0, CTE0, ETHETA0,
+            X1, Y1, THETA1, V1, CTE1, ETHETA1,
+            ANGVEL, ACCEL, DT, COEFFS
+        };
+        // Outputs, in the order of the constraint blocks of FG_eval
+        enum Residual { R_X, R_Y, R_THETA, R_V, R_CTE, R_ETHETA, NUM_RESIDUALS };
+
+        // The constraints of one step, in.size() == COEFFS + n_coeffs.
+        // etheta against the path heading at x0 (PATH_HEADING, see
+        // FG_eval::errorStep()) or integrated from the turn rate alone.
+        static void Residuals(const ADvector &in, ADvector &out, size_t n_coeffs, bool path_heading);
+
+        // Instance for n_coeffs coefficients, constructed on the first call.
+        // CppAD does not allow that in parallel mode: NULL then, if no MPC
+        // constructor asked for it before.
+        static StepModel *Get(size_t n_coeffs, bool path_heading);
+
+        // Record the step of the calling thread, before that thread records
+        // a tape with this function (one tape per thread at a time)
+        void Prepare() const;
+
+        size_t NumInputs() const { return _n_in; }
+
+    private:
+        StepModel(size_t n_coeffs, bool path_heading);
+        static std::string name(size_t n_coeffs, bool path_heading);
+
+        CppAD::ADFun<double> &fun() const;
+
+        virtual bool forward(size_t p, size_t q, const CppAD::vector<bool> &vx, CppAD::vector<bool> &vy,
+                             const CppAD::vector<double> &tx, CppAD::vector<double> &ty);
+        virtual bool reverse(size_t q, const CppAD::vector<double> &tx, const CppAD::vector<double> &ty,
+                             CppAD::vector<double> &px, const CppAD::vector<double> &py);
+
+        size_t _n_coeffs;
+        bool _path_heading;
+};
+
+#endif /* STEP_MODEL_H */
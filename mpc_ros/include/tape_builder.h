@@ -0,0 +1,72 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef TAPE_BUILDER_H
+#define TAPE_BUILDER_H
+
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "tape_solver.h"
+
+// Records a TapeSolver on a thread of its own while the solves go on with
+// the previous one, e.g. after the horizon was changed at run time.
+//
+// Take() copies the finished tape into the caller's TapeSolver on the
+// calling thread; the builder frees its own copy before it exits, so every
+// block of CppAD memory is returned by the thread that allocated it. A new
+// Start() or Cancel() waits for the recording in progress and drops it.
+class TapeBuilder
+{
+    public:
+        typedef std::function<void(TapeSolver&)> RecordFunction;
+
+        TapeBuilder();
+        ~TapeBuilder();
+
+        // Record with record() in the background, id tells the builds apart
+        void Start(const RecordFunction &record, unsigned long id);
+        void Cancel();
+
+        // A build was started and not taken or cancelled yet
+        bool Busy() const { return _thread.joinable(); }
+        unsigned long Id() const { return _id; }
+
+        // Block until the build in progress is ready, for a caller that
+        // would otherwise record the same tape itself. Only while Busy().
+        void Wait();
+
+        // Copy the finished tape into tape. False while still recording.
+        // record_ms is the wall time of the recording.
+        bool Take(TapeSolver &tape, double &record_ms);
+
+    private:
+        enum State { RECORDING, READY, DONE };
+
+        void Run(RecordFunction record);
+        void Join();
+
+        std::thread _thread;
+        std::mutex _mutex;
+        std::condition_variable _cond;
+        State _state;
+        TapeSolver *_built; // owned by the builder thread, valid while READY
+        double _record_ms;
+        unsigned long _id;
+};
+
+#endif /* TAPE_BUILDER_H */
@@ -0,0 +1,123 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef TAPE_OPTIMIZE_H
+#define TAPE_OPTIMIZE_H
+
+#include <cstddef>
+#include <string>
+#include "cppad_instance.h"
+#include "perf_counters.h"
+
+// Optimization of the recorded MPC tapes (OPTIMIZE parameter).
+//
+// CppAD's optimize() by default adds conditional skip operations, which
+// only pay off when a CondExp guards a large subexpression, and keeps the
+// comparison operations for compare_change(). The MPC models are straight
+// line code apart from the obstacle CondExp of the planner, whose guarded
+// branch is a single multiply, and nothing asks for compare_change(), so
+// the default level drops both. Every level but NONE records the weighted
+// squares and v * cos(theta) * dt products as one operator each, see
+// no_fused_mul_op in cppad/core/optimize.hpp.
+namespace tape_optimize
+{
+    enum Level
+    {
+        NONE = 0,          // keep the tape as recorded
+        STRAIGHT_LINE = 1, // no_conditional_skip no_compare_op (default)
+        CPPAD_DEFAULT = 2  // optimize() with its default options
+    };
+
+    // Options string of ADFun::optimize for level
+    const char *Options(int level);
+
+    // Optimize fun at level, nothing for NONE
+    void Apply(CppAD::ADFun<double> &fun, int level);
+    // Same for the single precision tapes of TapeSolver::RecordSingle()
+    void Apply(CppAD::ADFun<float> &fun, int level);
+
+    // Option lines of CppAD::ipopt::solve for level, see Optimize in
+    // cppad/ipopt/solve.hpp
+    std::string SolveOptions(int level);
+}
+
+// Size of a tape before and after optimize() and the time (and hardware
+// counters) spent in the Ipopt callbacks of the last solve, see
+// TapeSolver::Profile().
+struct TapeProfile
+{
+    enum Callback { EVAL_F, EVAL_GRAD_F, EVAL_G, EVAL_JAC_G, EVAL_H, NUM_CALLBACKS };
+
+    TapeProfile() { Clear(); }
+    void Clear()
+    {
+        recorded_var = recorded_op = size_var = size_op = 0;
+        hessian_colors = 0;
+        optimize_ms = 0;
+        sparsity = 0;
+        sparsity_ms = 0;
+        ClearCallbacks();
+    }
+    void ClearCallbacks()
+    {
+        for (int k = 0; k < NUM_CALLBACKS; k++)
+        {
+            calls[k] = 0;
+            callback_ms[k] = 0;
+            callback_perf[k] = perf_counters::Counts();
+        }
+        hessian_reuses = 0;
+    }
+
+    size_t recorded_var, recorded_op; // size_var(), size_op() as recorded
+    size_t size_var, size_op;         // after optimize()
+    double optimize_ms;
+    int sparsity;                     // sparsity_patterns::Representation used
+    double sparsity_ms;               // Jacobian and Hessian sparsity sweeps
+    size_t hessian_colors;            // sweeps of a sparse Hessian, 0 before the first
+    int calls[NUM_CALLBACKS];
+    double callback_ms[NUM_CALLBACKS];
+    // Hardware counters of the callbacks, zeros unless perf_counters::Enable()d
+    perf_counters::Counts callback_perf[NUM_CALLBACKS];
+    int hessian_reuses;               // eval_h calls answered without a sweep, see TapeSolver::SetHessianReuse()
+};
+
+// Bytes a TapeSolver holds between solves, see TapeSolver::Memory()
+struct TapeMemory
+{
+    TapeMemory() : tape(0), taylor(0), sparsity(0), ipopt(0), shared(0) {}
+
+    size_t tape;     // operation sequences of the double and the float tape
+    size_t taylor;   // Taylor coefficients and forward sparsity kept per variable
+    size_t sparsity; // patterns, their Ipopt entries and the colorings
+    size_t ipopt;    // Jacobian and Hessian triplets and the vectors of the TNLP,
+                     // a lower bound: the factor of the linear solver is not included
+    size_t shared;   // operation sequences and structure of a SharedTape, not in Total(),
+                     // the process holds them once for all its solvers
+    size_t Total() const { return tape + taylor + sparsity + ipopt; }
+
+    TapeMemory &operator+=(const TapeMemory &other)
+    {
+        tape += other.tape;
+        taylor += other.taylor;
+        sparsity += other.sparsity;
+        ipopt += other.ipopt;
+        shared += other.shared;
+        return *this;
+    }
+};
+
+#endif /* TAPE_OPTIMIZE_H */
@@ -0,0 +1,416 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef TAPE_SOLVER_H
+#define TAPE_SOLVER_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "cppad_instance.h"
+#include <cppad/ipopt/solve_result.hpp>
+#include "ipopt_journal.h"
+#include "tape_optimize.h"
+
+// Drop-in replacement for CppAD::ipopt::solve that keeps the recorded
+// operation sequence between calls.
+//
+// The tape domain is [vars | params]: Ipopt only sees the first n_vars
+// entries, the trailing n_params entries are fixed to the values passed to
+// Solve(). This stands in for dynamic parameters, which the vendored CppAD
+// does not have, so quantities that change every cycle can be fed in
+// without recording again. The tails of the MPC.cpp layouts:
+//   full:      path coefficients or reference poses, ModelParams values,
+//              obstacle model, corridor faces, speed reference
+//   reduced:   path coefficients, cte0 and etheta0, ModelParams values
+//   condensed: initial state, path coefficients, ModelParams values
+// The ModelParams values are constants of the tape instead with a generated
+// or JIT model. Sparsity patterns and the sparse Jacobian/Hessian work
+// (coloring) are computed once per tape.
+//
+// With BUILD_CODEGEN the tape can be replaced by a compiled model, see
+// codegen_model.h, which Ipopt then calls without going through CppAD.
+class CodegenModel;
+class StageHessian;
+class TapeNLP;
+class TapeSolver;
+namespace ipopt_util { class PersistentIpopt; }
+
+// Structure of a recorded tape that the solves do not change: sparsity of
+// [f, g] with respect to [vars | params], the entries handed to Ipopt (vars
+// columns only) and the sparse Jacobian/Hessian work (coloring). Only read
+// by the sweeps once colored, so solvers of one model share it, see
+// TapeSolver::Share().
+struct TapeStructure
+{
+    TapeStructure();
+
+    CppAD::vectorBool pattern_jac, pattern_hes;
+    CppAD::vector<size_t> row_jac, col_jac, row_hes, col_hes;
+    // Jacobian entries the sweeps compute, in row order, and the entry of
+    // row_jac, col_jac of each; the others are constant (const_entry),
+    // see TapeSolver::SetConstantJacobian(). linear_row: per constraint
+    // (row i + 1 of [f, g]) whether all its entries are constant.
+    CppAD::vector<size_t> row_sweep, col_sweep, sweep_entry, const_entry;
+    std::vector<bool> linear_row;
+    bool const_jacobian; // the constant entries were looked for
+    int jac_method; // ipopt_util::Jacobian of the coloring in work_jac
+    CppAD::sparse_jacobian_work work_jac;
+    CppAD::sparse_hessian_work work_hes;
+
+    // Sweep and constant entries from constant (per entry of row_jac),
+    // for n_constraints rows
+    void SetConstant(const CppAD::vector<bool> &constant, size_t n_constraints, bool detected);
+
+    size_t Bytes() const;
+};
+
+// Immutable part of a recorded TapeSolver, shared by any number of
+// solvers of the same model on any number of threads: the operation
+// sequences of the double (and float) tape and the TapeStructure. Each
+// solver keeps its own Taylor coefficients, forward sparsity, Gauss-Newton
+// Hessian and Ipopt state.
+//
+// CppAD memory has to be freed by the thread that allocated it, so the
+// last reference to a SharedTape has to be dropped on the thread that
+// recorded it. A solver that uses it holds a reference until it records
+// again or is Reset().
+class SharedTape
+{
+    public:
+        size_t NumVars() const { return _nx; }
+        size_t NumConstraints() const { return _ng; }
+        size_t NumParams() const { return _np; }
+        // id passed to TapeSolver::Share(), tells models of the same
+        // dimensions apart
+        unsigned long Id() const { return _id; }
+        // Operation sequences and structure, counted once however many
+        // solvers use them
+        size_t Bytes() const;
+
+    private:
+        friend class TapeSolver;
+        SharedTape() {}
+
+        CppAD::ADFun<double> _fun;
+        CppAD::ADFun<float> _fun_single;
+        bool _single;
+        size_t _nx, _ng, _np;
+        unsigned long _id;
+        std::shared_ptr<TapeStructure> _structure;
+        // settings and statistics of the recording
+        int _optimize, _hes_coloring, _sparsity;
+        double _hes_density;
+        size_t _recorded_size[3];
+        TapeProfile _profile;
+};
+
+class TapeSolver
+{
+    public:
+        typedef CPPAD_TESTVECTOR(double) Dvector;
+        typedef CPPAD_TESTVECTOR(CppAD::AD<double>) ADvector;
+        // fg[0] is the cost, fg[1..n_constraints] the constraints,
+        // vars has n_vars + n_params entries.
+        typedef std::function<void(ADvector&, const ADvector&)> FgFunction;
+        // The same model on the single precision tape, see RecordSingle()
+        typedef CPPAD_TESTVECTOR(float) Fvector;
+        typedef CPPAD_TESTVECTOR(CppAD::AD<float>) AFvector;
+        typedef std::function<void(AFvector&, const AFvector&)> FloatFgFunction;
+
+        TapeSolver();
+
+        // Record and optimize the tape, then compute the sparsity patterns.
+        // Recording again with the same dimensions and patterns keeps the
+        // colorings and the Ipopt state of the previous tape.
+        void Record(size_t n_vars, size_t n_constraints, size_t n_params, const FgFunction &fg_eval);
+        bool IsRecorded() const { return _recorded; }
+
+        // Mixed precision: record the model of the last Record() once more
+        // on AD<float>. Ipopt then gets the constraint Jacobian and the
+        // Hessian from float sweeps over the patterns and colorings of the
+        // double tape, which halves their memory traffic. The cost, its
+        // gradient and the constraints stay double, so the iterates still
+        // converge to the double solution and only the Newton steps are
+        // perturbed. The subgraph Jacobian (JACOBIAN=2) stays double.
+        // Record() drops the float tape. False, and the double tape is used,
+        // if fg_eval does not have the dimensions of the double one.
+        bool RecordSingle(const FloatFgFunction &fg_eval);
+        bool IsSingle() const { return _single; }
+
+        // Split tapes: record the model of the last Record() twice more, as
+        // an optimized tape of the cost alone and one of the constraints
+        // alone. A reverse sweep for the cost gradient then runs over the
+        // least-squares terms only, the Jacobian sweeps and the constraint
+        // values skip them, and each callback evaluates only the tape it
+        // needs. The whole tape stays for the patterns and the Hessian.
+        // Only with the reverse Jacobian on the double tape (JACOBIAN=0,
+        // no float tape), otherwise unused. Record() drops them; a solver
+        // on a SharedTape sweeps the whole tape. False if fg_eval does not
+        // have the dimensions of the whole tape.
+        bool RecordSplit(const FgFunction &fg_eval);
+        bool IsSplit() const { return _split; }
+
+        // Look for the Jacobian entries that depend on neither the vars
+        // nor the params (linear terms: the initial state, the v and theta
+        // steps) when the next Record() finds a new structure, one reverse
+        // Hessian sparsity sweep per constraint row. Their values are then
+        // swept once per Record() and left out of the colorings and sweeps
+        // of every later eval_jac_g. If all equality (or all inequality)
+        // rows of a solve are linear, Ipopt is told so with jac_c_constant
+        // (jac_d_constant). Their Hessian is empty by the pattern already.
+        void SetConstantJacobian(bool enable) { _const_jacobian = enable; }
+        // Constant Ipopt entries of the Jacobian of the last Record()
+        size_t ConstantEntries() const { return _structure->const_entry.size(); }
+        void Reset();
+
+        // Deep copy of the tape, patterns and colorings of other into the
+        // memory of the calling thread, for a tape recorded on another one:
+        // CppAD memory has to be freed by the thread that allocated it. The
+        // Ipopt state starts over.
+        void CopyFrom(const TapeSolver &other);
+
+        // The tape, patterns and colorings of the last Record(), read only
+        // from now on, for ShareFrom() of other solvers. Best taken after a
+        // Solve(), which colors the work; a solver that would still have to
+        // color it takes a copy of the structure first. id is kept for the
+        // caller, see SharedTape::Id(). NULL before Record() or with a
+        // generated model.
+        std::shared_ptr<const SharedTape> Share(unsigned long id = 0);
+        // Solve on tape instead of recording one, on any thread. Costs a
+        // copy of the small per tape vectors, the operation sequences and
+        // the structure are not copied. The Ipopt state starts over; the
+        // next Record() or Reset() lets go of tape.
+        void ShareFrom(const std::shared_ptr<const SharedTape> &tape);
+        bool IsShared() const { return (bool)_shared; }
+
+        // Hot restart, see solver_snapshot.h. Structure(): patterns, entry
+        // lists and colorings of the last Record(), NULL before. A structure
+        // adopted before the next Record() replaces its sparsity sweeps if
+        // the tape comes out with these dimensions and, after optimize(),
+        // size_var and size_op; otherwise it is dropped and the patterns are
+        // computed as usual. On a recorded tape it only replaces a structure
+        // of the same patterns, to bring its colorings along.
+        std::shared_ptr<const TapeStructure> Structure() const;
+        void AdoptStructure(const std::shared_ptr<TapeStructure> &structure, size_t n_vars, size_t n_constraints,
+                            size_t n_params, size_t size_var, size_t size_op, double hes_density);
+        bool AdoptedStructure() const { return _adopted; }
+
+        // Use the model from a library written by CodegenModel::Generate
+        // instead of recording. False if the library has no model of that
+        // name and dimensions, or if built without BUILD_CODEGEN.
+        bool LoadGenerated(const std::string &library, const std::string &model,
+                           size_t n_vars, size_t n_constraints, size_t n_params);
+        bool IsGenerated() const { return (bool)_generated; }
+
+        size_t NumVars() const { return _nx; }
+        size_t NumConstraints() const { return _ng; }
+        size_t NumParams() const { return _np; }
+
+        // Same options string and result as CppAD::ipopt::solve,
+        // "Retape" is ignored since the tape is reused by construction.
+        // The IpoptApplication is kept as well: later solves of the same
+        // tape with the same options go through ReOptimizeTNLP.
+        // zl, zu and lambda are the initial multipliers Ipopt asks for
+        // with warm_start_init_point.
+        void Solve(const std::string &options, const Dvector &params,
+                   const Dvector &xi, const Dvector &xl, const Dvector &xu,
+                   const Dvector &gl, const Dvector &gu,
+                   CppAD::ipopt::solve_result<Dvector> &solution,
+                   const Dvector *zl = NULL, const Dvector *zu = NULL,
+                   const Dvector *lambda = NULL);
+
+        // Ipopt iterations of the last Solve(), -1 if it did not run
+        int Iterations() const { return _iterations; }
+        // Iterates of the last Solve(), from the intermediate callback
+        const IpoptJournal &Journal() const { return _journal; }
+
+        // Wall-time budget of Solve() in seconds, <= 0 disables it. When it
+        // runs out Ipopt is stopped from its intermediate callback and the
+        // current iterate is returned with status user_requested_stop.
+        void SetTimeLimit(double seconds) { _time_limit = seconds; }
+        bool TimeLimitHit() const { return _time_limit_hit; }
+
+        // Cancellation token, read by the intermediate callback: once it is
+        // set Ipopt stops at its next iterate with status user_requested_stop.
+        // It belongs to the caller and may be set from any thread, NULL for
+        // none.
+        void SetCancel(const std::atomic<bool> *cancel) { _cancel = cancel; }
+        bool CancelHit() const { return _cancel_hit; }
+
+        // Early stop once the applied inputs settled: Ipopt is stopped from
+        // its intermediate callback when none of the variables in watch
+        // moved more than tol over iterations iterates in a row and the
+        // primal infeasibility is at most max_inf_pr. The iterate is
+        // returned with status user_requested_stop. Empty watch disables it.
+        void SetInputStop(const std::vector<size_t> &watch, double tol, int iterations, double max_inf_pr);
+        bool InputStopHit() const { return _input_stop_hit; }
+
+        // Factors of Ipopt's user-scaling (the options select it with
+        // "String nlp_scaling_method user-scaling"), scaled = factor *
+        // unscaled, see nlp_scaling.h. An x or g not of the problem size
+        // leaves those unscaled. The problem is set up again when they change.
+        void SetScaling(double objective, const Dvector &x, const Dvector &g);
+
+        // Gauss-Newton Hessian: drop the constraint curvature and hand Ipopt
+        // obj_factor times the cost Hessian only. The cost is a sum of
+        // squares of the variables, so that Hessian is constant and is
+        // evaluated once per tape.
+        void SetGaussNewton(bool enable);
+        bool GaussNewton() const { return _gauss_newton; }
+        // Evaluate that Hessian again on the next solve, after parameters of
+        // the cost (the weights) changed
+        void ResetGaussNewton() { _gn_valid = false; }
+
+        // Lazy exact Hessian (HESSIAN_REUSE): eval_h answers with the values
+        // of its last sweep in the same solve, for up to iterations calls in
+        // a row, while no variable moved by more than max_step and no
+        // multiplier by more than max_lambda times max(1, |lambda|) since,
+        // and obj_factor is the same. The gradients and the Jacobian stay
+        // exact, Ipopt's line search copes with the older curvature. 0
+        // iterations (default) sweeps on every call. Not with Gauss-Newton.
+        void SetHessianReuse(int iterations, double max_step, double max_lambda);
+
+        // Coloring of the sparse Hessian (HESSIAN_COLORING), one direction
+        // of the forward-over-reverse pass in eval_h per color: 0 CppAD's
+        // symmetric (default), 1 CppAD's general, 2 ColPack's star coloring,
+        // which needs BUILD_COLPACK and is CppAD's symmetric otherwise.
+        void SetHessianColoring(int method);
+        // color_method of sparse_hessian_work for method
+        static const char *HessianColoring(int method);
+
+        // Hessian of the Lagrangian summed over the stages of a partially
+        // separable model (HESSIAN_STAGES), see stage_hessian.h, instead of
+        // the colored sweep over the whole tape, until the next Record() or
+        // Reset(). Takes precedence over the float tape. False, and the
+        // whole tape is used, if a stage entry is not in the Hessian pattern.
+        bool SetStages(const std::shared_ptr<StageHessian> &stages);
+        bool HasStages() const { return (bool)_stages; }
+
+        // tape_optimize level of the next Record(), STRAIGHT_LINE by default
+        void SetOptimize(int level) { _optimize = level; }
+        int Optimize() const { return _optimize; }
+
+        // Tape sizes of the last Record() and callback times of the last
+        // Solve(), empty for a generated model
+        const TapeProfile &Profile() const { return _profile; }
+
+        // Memory of the tapes, their derivative work and the Ipopt problem.
+        // What is shared with other solvers through a SharedTape is in
+        // TapeMemory::shared instead of tape and sparsity.
+        TapeMemory Memory() const;
+
+        // Taylor coefficient orders the tapes keep after Solve(): 0 frees
+        // them, 1 keeps the function values only, < 0 (default) keeps what
+        // the Hessian sweeps left. What is dropped is allocated again by the
+        // next solve, so this trades memory for allocations in the cycle.
+        void SetTaylorCapacity(int orders) { _taylor_capacity = orders; }
+
+        // Representation of the sparsity sweeps of the next Record(), see
+        // sparsity_patterns.h. AUTO (default) decides from the Hessian of
+        // the previous Record(), the first one is bit-packed.
+        void SetSparsity(int rep) { _sparsity = rep; }
+
+        // Largest violation of gl <= g <= gu
+        static double MaxViolation(const Dvector &g, const Dvector &gl, const Dvector &gu);
+
+    private:
+        friend class TapeNLP;
+
+        // Structure to change, copied first if it is shared
+        TapeStructure &ownStructure();
+        // jac_c_constant / jac_d_constant lines for the rows of gl, gu
+        // whose Jacobian is constant, see SetConstantJacobian()
+        std::string linearOptions(const Dvector &gl, const Dvector &gu) const;
+        // Let go of a SharedTape of ShareFrom() entirely, none of its
+        // vectors may outlive the reference
+        void releaseShared();
+
+        std::shared_ptr<const SharedTape> _shared; // of ShareFrom(), declared first to outlive what it backs
+        CppAD::ADFun<double> _fun;
+        CppAD::ADFun<float> _fun_single; // valid while _single
+        bool _single;
+        CppAD::ADFun<double> _fun_obj, _fun_con; // valid while _split
+        bool _split;
+        // SetConstantJacobian(), and the values of the constant entries of
+        // the last Record() while _jac_const_valid
+        bool _const_jacobian;
+        Dvector _jac_const;
+        bool _jac_const_valid;
+        size_t _nx, _ng, _np;
+        bool _recorded;
+        int _iterations;
+        double _time_limit;
+        bool _time_limit_hit;
+        const std::atomic<bool> *_cancel;
+        bool _cancel_hit;
+        // SetInputStop(): watched variables, their values at the previous
+        // iterate and how many iterates in a row they stayed within tol
+        std::vector<size_t> _stop_watch;
+        std::vector<double> _stop_last;
+        double _stop_tol, _stop_inf_pr;
+        int _stop_iterations, _stop_streak;
+        bool _input_stop_hit;
+        // SetScaling()
+        double _scale_objective;
+        Dvector _scale_x, _scale_g;
+        IpoptJournal _journal;
+        std::chrono::steady_clock::time_point _solve_begin;
+        int _optimize;
+        int _hes_coloring;
+        int _taylor_capacity;
+        int _sparsity;
+        // nnz / n^2 of the Hessian pattern of the last Record(), -1 before
+        // the first, kept by Reset() for the AUTO sparsity
+        double _hes_density;
+        // AdoptStructure() for the next Record(), and whether the last one took it
+        std::shared_ptr<TapeStructure> _adopt;
+        size_t _adopt_dims[5];
+        bool _adopted;
+        // size_op, size_op_arg and size_par of the last recording, before
+        // optimize, reserved when the same model is recorded again
+        size_t _recorded_size[3];
+        TapeProfile _profile;
+
+        // Patterns, Ipopt entries and colorings, never NULL, possibly
+        // shared with other solvers
+        std::shared_ptr<TapeStructure> _structure;
+
+        // Cost Hessian for the Gauss-Newton mode, valid while _gn_valid
+        bool _gauss_newton, _gn_valid;
+        Dvector _gn_hes;
+        // SetHessianReuse()
+        int _hes_reuse;
+        double _hes_reuse_step, _hes_reuse_lambda;
+
+        // Stages of SetStages(), mapped to the Ipopt entries, not shared
+        std::shared_ptr<StageHessian> _stages;
+
+        // Compiled model, and the entry of its sparse Jacobian / Hessian
+        // behind each Ipopt entry (_gen_grad: row 0 of the Jacobian).
+        std::shared_ptr<CodegenModel> _generated;
+        CppAD::vector<size_t> _gen_jac, _gen_grad, _gen_grad_col, _gen_hes;
+
+        // Ipopt state kept across solves; _nlp is owned by _ipopt and
+        // replaced whenever the tape changes.
+        std::shared_ptr<ipopt_util::PersistentIpopt> _ipopt;
+        TapeNLP *_nlp;
+};
+
+#endif /* TAPE_SOLVER_H */
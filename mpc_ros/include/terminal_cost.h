@@ -0,0 +1,54 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef TERMINAL_COST_H
+#define TERMINAL_COST_H
+
+#include <map>
+#include <string>
+
+// Terminal cost of the MPC horizon (TERMINAL): the errors of the last step
+// are weighted by the cost-to-go of an LQR instead of the stage weights, so
+// the tail past the horizon is priced in and a short horizon stays stable
+// on curves where it would otherwise need 40-50 steps.
+//
+// The LQR is of the tracking errors e = [cte, etheta, v] about REF_CTE,
+// REF_ETHETA and REF_V, the model linearized about driving a straight path
+// at REF_V, for the dt of the last step (DT, or the last DT_i):
+//
+//   cte+ = cte + REF_V dt etheta,  etheta+ = etheta + dt angvel,  v+ = v + dt a
+//
+// with the stage weights Q = diag(W_CTE, W_EPSI, W_V), R = diag(W_ANGVEL,
+// W_A); W_DANGVEL and W_DA are left out. P of the discrete Riccati equation
+// is block diagonal, [cte, etheta] and v.
+//
+// P travels with the other MPC parameters, as "TERMINAL_P_CTE",
+// "TERMINAL_P_CTE_ETHETA", "TERMINAL_P_ETHETA" and "TERMINAL_P_V", so it is
+// computed once when they change and every FG_eval of them reads it.
+
+// Store P of the weights, dt and REF_V in params (replacing a previous one).
+// False, and no P in params, if the Riccati iteration does not converge
+// (e.g. REF_V 0, where cte can not be steered).
+bool SetTerminalCost(std::map<std::string, double> &params);
+
+// Drop P from params
+void EraseTerminalCost(std::map<std::string, double> &params);
+
+// P of params, false without one
+bool TerminalCost(const std::map<std::string, double> &params, double &p_cte, double &p_cte_etheta,
+                  double &p_etheta, double &p_vel);
+
+#endif /* TERMINAL_COST_H */
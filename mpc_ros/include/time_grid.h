@@ -0,0 +1,43 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef TIME_GRID_H
+#define TIME_GRID_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Non-uniform time grid of the MPC horizon: fine steps near the robot and
+// coarse ones far ahead, e.g. 0.05 s growing to 0.3 s, so a long preview
+// takes fewer steps while the first commands stay accurate.
+//
+// The grid travels with the other MPC parameters, as "DT_0", "DT_1", ...
+// for the first transitions; the last entry repeats to the end of the
+// horizon. Without "DT_0" every step is DT.
+
+// Store grid in params (replacing a previous one), nothing if it is empty.
+// False, and params unchanged, if an entry is not positive.
+bool SetTimeGrid(std::map<std::string, double> &params, const std::vector<double> &grid);
+
+// Drop the grid from params
+void EraseTimeGrid(std::map<std::string, double> &params);
+
+// dt of each of the steps - 1 transitions, empty without a grid
+std::vector<double> TimeGridSteps(const std::map<std::string, double> &params, int steps);
+
+#endif /* TIME_GRID_H */
@@ -0,0 +1,72 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef TRACE_SPAN_H
+#define TRACE_SPAN_H
+
+#include <cstdint>
+#include <string>
+
+// Scoped spans of the control cycle for a timeline of the threads, compiled
+// in with BUILD_TRACE=ON (MPC_TRACE) and to nothing otherwise:
+//   MPC_TRACE_SPAN("solve");
+// records the time from there to the end of the scope on the calling
+// thread. Every thread writes into a ring of its own last CAPACITY spans
+// without locking, only its first span takes a mutex to register the ring.
+// WriteChrome() exports the rings as Chrome trace JSON, which
+// chrome://tracing and ui.perfetto.dev open.
+namespace trace_span
+{
+    // Spans kept per thread, older ones are overwritten
+    const size_t CAPACITY = 1 << 14;
+
+    class Span
+    {
+        public:
+            // name is kept as a pointer, a string literal
+            explicit Span(const char *name);
+            ~Span();
+
+        private:
+            const char *_name;
+            uint64_t _begin;
+
+            Span(const Span &);
+            Span &operator=(const Span &);
+    };
+
+    // Name of the calling thread in the export
+    void SetThreadName(const std::string &name);
+
+    // Built with BUILD_TRACE
+    bool Enabled();
+
+    // Spans of all threads, those that ended included. Can run while spans
+    // are recorded, the ones overwritten during the copy are left out.
+    bool WriteChrome(const std::string &path);
+}
+
+#ifdef MPC_TRACE
+#define MPC_TRACE_CONCAT_(a, b) a##b
+#define MPC_TRACE_CONCAT(a, b) MPC_TRACE_CONCAT_(a, b)
+#define MPC_TRACE_SPAN(name) trace_span::Span MPC_TRACE_CONCAT(trace_span_, __LINE__)(name)
+#define MPC_TRACE_THREAD(name) trace_span::SetThreadName(name)
+#else
+#define MPC_TRACE_SPAN(name) ((void)0)
+#define MPC_TRACE_THREAD(name) ((void)0)
+#endif
+
+#endif /* TRACE_SPAN_H */
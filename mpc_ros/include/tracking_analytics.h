@@ -0,0 +1,75 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef TRACKING_ANALYTICS_H
+#define TRACKING_ANALYTICS_H
+
+#include <cstddef>
+#include <string>
+#include "compact_path.h"
+#include "path_index.h"
+#include "latency_stats.h"
+
+// Tracking error of the robot against the planned path, one sample per
+// odometry message.
+//
+// Observe() projects the position on the segments around the nearest pose
+// (found by PathIndex from the last match on, so one sample costs the same
+// however long the path is) and returns cte and etheta with the sign
+// convention of the controllers: the path relative to the vehicle, positive
+// to the left. The absolute errors are accumulated into a running mean and
+// max since Reset() and into a rolling window for the percentiles.
+class TrackingAnalytics
+{
+    public:
+        TrackingAnalytics(int window = 200);
+
+        // Path the robot is supposed to follow, an empty pointer pauses
+        void SetPath(const CompactPath::ConstPtr &path);
+        const CompactPath::ConstPtr &Path() const { return _index.Path(); }
+
+        // Error of the pose (x, y, theta) in the frame of the path. False
+        // without a path of at least two poses.
+        bool Observe(double x, double y, double theta, double &cte, double &etheta);
+
+        // Forget the statistics, the path is kept
+        void Reset();
+
+        size_t Samples() const { return _samples; }
+        double CteMean() const { return _samples ? _cte_sum / _samples : 0.0; }
+        double CteMax() const { return _cte_max; }
+        double EthetaMean() const { return _samples ? _etheta_sum / _samples : 0.0; }
+        double EthetaMax() const { return _etheta_max; }
+        // Of the rolling window, |cte| and |etheta|
+        const RollingStats &CteWindow() const { return _cte_window; }
+        const RollingStats &EthetaWindow() const { return _etheta_window; }
+
+        // "n mean p95 max" of cte and etheta, for logging
+        std::string Summary() const;
+
+    private:
+        // Projection of (x, y) on the segment i, i + 1: squared distance,
+        // the foot point and the heading of the segment
+        bool project(size_t i, double x, double y, double &d2, double &fx, double &fy, double &yaw) const;
+
+        PathIndex _index;
+        int _window;
+        size_t _samples;
+        double _cte_sum, _cte_max, _etheta_sum, _etheta_max;
+        RollingStats _cte_window, _etheta_window;
+};
+
+#endif /* TRACKING_ANALYTICS_H */
@@ -0,0 +1,131 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef TRACKING_CONTROLLER_H
+#define TRACKING_CONTROLLER_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include "MPC.h"
+#include "path_fit.h"
+#include "compact_path.h"
+
+// Headless path tracking controllers that ClosedLoopSim and mpc_compare
+// drive with the same inputs: the measured pose and speed and the window of
+// the reference ahead of the robot. Each one is the control law of a
+// controller of this package without its ROS plumbing:
+//
+//   MPC           the tracking node: cubic fit of the window and MPC::Solve
+//                 (DELAY_MODE, MAX_SPEED), see trackRefTrajNode.cpp
+//   PURE_PURSUIT  Pure_Pursuit.cpp: first waypoint ahead at PP_LFW (0.5 m),
+//                 turn rate 2 sin(alpha) / PP_LFW times PP_GAIN (1) within
+//                 PP_MAX_W (ANGVEL), the speed ramps by PP_SPEED_INC
+//                 (0.2 m/s) per cycle to REF_V
+//   DWA           the trajectory rollout of dwa_local_planner with the
+//                 settings of params/dwa_local_planner_params.yaml: constant
+//                 (v, w) samples in the window of reachable velocities,
+//                 scored by the path and goal distance of their end point and
+//                 of the forward point. No costmap, so no obstacle cost, and
+//                 distances are Euclidean instead of grid distances. DWA_*
+//                 keys override the settings, DWA_MAX_VEL defaults to REF_V.
+//
+// Keys not given take the defaults of the nodes.
+class TrackingController
+{
+    public:
+        enum Type { MPC_TRACKING = 0, PURE_PURSUIT = 1, DWA = 2, NUM_TYPES };
+
+        virtual ~TrackingController() {}
+
+        // Controller of type with params (MPC::LoadParams keys and the ones
+        // above), NULL for an unknown type
+        static std::unique_ptr<TrackingController> Create(int type, const std::map<std::string, double> &params);
+        // "mpc", "pure_pursuit", "dwa"
+        static const char *Name(int type);
+        // Type of a name, -1 if unknown
+        static int Parse(const std::string &name);
+
+        // Length of the reference window Command() wants [m]
+        virtual double PathLength() const = 0;
+        // Drops the state of the previous run (warm start, last command)
+        virtual void Reset() = 0;
+        // Command of the robot at the measured pose (x, y, theta) and speed v
+        // for window, in the frame of the pose. False if there is none (e.g.
+        // the window does not define a path), the last one then stays.
+        virtual bool Command(const CompactPath &window, double x, double y, double theta, double v,
+                             double &speed, double &angvel) = 0;
+        // Whether the last command was a feasible solution
+        virtual bool Feasible() const { return true; }
+};
+
+class MPCTrackingController : public TrackingController
+{
+    public:
+        explicit MPCTrackingController(const std::map<std::string, double> &params);
+
+        double PathLength() const { return _path_length; }
+        void Reset();
+        bool Command(const CompactPath &window, double x, double y, double theta, double v,
+                     double &speed, double &angvel);
+        bool Feasible() const { return _mpc._mpc_feasible; }
+
+    private:
+        MPC _mpc;
+        PathFit _path_fit;
+        double _dt, _path_length, _max_speed;
+        bool _delay_mode;
+        double _angvel, _accel; // last inputs, for the delay mode prediction
+};
+
+class PurePursuitController : public TrackingController
+{
+    public:
+        explicit PurePursuitController(const std::map<std::string, double> &params);
+
+        double PathLength() const { return _path_length; }
+        void Reset() { _velocity = 0.0; }
+        bool Command(const CompactPath &window, double x, double y, double theta, double v,
+                     double &speed, double &angvel);
+
+    private:
+        double _path_length, _lfw, _vcmd, _gain, _max_w, _speed_inc;
+        double _velocity; // ramped speed command
+};
+
+class DWAController : public TrackingController
+{
+    public:
+        explicit DWAController(const std::map<std::string, double> &params);
+
+        double PathLength() const;
+        void Reset() { _angvel = 0.0; }
+        bool Command(const CompactPath &window, double x, double y, double theta, double v,
+                     double &speed, double &angvel);
+
+    private:
+        // Nearest distance of (x, y) to the window
+        static double pathDistance(const CompactPath &window, double x, double y);
+
+        double _dt, _path_length;
+        double _min_vel, _max_vel, _max_rot, _acc_x, _acc_theta;
+        double _sim_time, _sim_granularity, _angular_granularity;
+        int _vx_samples, _vth_samples;
+        double _path_bias, _goal_bias, _forward_point;
+        double _angvel; // last command, DWA reads it from the odometry
+};
+
+#endif /* TRACKING_CONTROLLER_H */
@@ -0,0 +1,108 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef TRAJECTORY_LOG_H
+#define TRAJECTORY_LOG_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "spsc_ring.h"
+
+// One control cycle. Written to the file as is, so the layout is part of
+// the format: change TrajectoryLog::VERSION along with it.
+struct TrajectoryRecord
+{
+    TrajectoryRecord();
+
+    double stamp;           // time of the state snapshot [s]
+    double state[6];        // x, y, theta, v, cte, etheta as passed to the solver
+    double coeffs[4];       // path polynomial in the vehicle frame
+    double speed, angvel;   // command applied from this cycle
+    double solve_ms;        // solve duration [ms]
+    double cost;            // total cost of the solution
+    uint32_t seq;           // set by TrajectoryLog::Push, a gap means dropped records
+    int32_t status;         // CppAD::ipopt::solve_result status, -1 without a solver
+    int32_t iterations;     // Ipopt iterations, -1 if unknown
+    uint32_t flags;         // FALLBACK, ...
+
+    // FALLBACK: shifted previous plan, SOFT_BOUND: a soft bound is
+    // exceeded, INFEASIBLE: the solve failed the model, nothing applied
+    enum { FALLBACK = 1, SOFT_BOUND = 2, INFEASIBLE = 4 };
+};
+
+// Binary trajectory log written from a background thread.
+//
+// The control thread only copies a TrajectoryRecord into a lock-free ring
+// (SpscRing), the writer thread drains it every flush period and appends
+// the records to the file. When the file exceeds max_bytes it is rotated
+// like logrotate: path -> path.1 -> ... -> path.<max_files>, the oldest one
+// is removed. If the writer falls behind, records are dropped and counted
+// rather than blocking the control loop.
+//
+// File layout: a 16 byte header ("MPCTRAJ\0", version, record size) and
+// then the records back to back in host byte order.
+class TrajectoryLog
+{
+    public:
+        static const uint32_t VERSION = 1;
+
+        TrajectoryLog();
+        ~TrajectoryLog();
+
+        // Create (truncate) path and start the writer. max_bytes == 0
+        // disables rotation, capacity is the number of records buffered.
+        bool Open(const std::string &path, size_t max_bytes = 64 << 20, int max_files = 4,
+                  size_t capacity = 4096, double flush_period = 0.1);
+        // Write what is buffered and stop the writer
+        void Close();
+        bool IsOpen() const { return _running.load(); }
+
+        // From one thread only (the one running the control cycle). Never
+        // blocks; false if the log is closed or the ring is full. Numbers
+        // the records, dropped ones included.
+        bool Push(const TrajectoryRecord &record);
+        unsigned long Dropped() const { return _dropped.load(); }
+
+        // Records of a file written by TrajectoryLog, false if it is not one
+        static bool Read(const std::string &path, std::vector<TrajectoryRecord> &records);
+        // Write records in the same format at once, without the writer thread
+        static bool Write(const std::string &path, const std::vector<TrajectoryRecord> &records);
+
+    private:
+        void run();
+        bool openFile();
+        void rotate();
+
+        std::string _path;
+        size_t _max_bytes, _bytes;
+        int _max_files;
+        double _flush_period;
+        FILE *_file;
+        uint32_t _seq; // producer side
+
+        std::unique_ptr<SpscRing<TrajectoryRecord> > _ring;
+        std::thread _writer;
+        std::atomic<bool> _running;
+        std::atomic<unsigned long> _dropped;
+};
+
+#endif /* TRAJECTORY_LOG_H */
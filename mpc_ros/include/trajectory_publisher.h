@@ -0,0 +1,54 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef TRAJECTORY_PUBLISHER_H
+#define TRAJECTORY_PUBLISHER_H
+
+#include <string>
+#include <vector>
+#include <ros/ros.h>
+#include <mpc_ros/MPCTrajectory.h>
+
+// Compact trajectory topic of a controller (compact_trajectory): the
+// prediction of a solve as one MPCTrajectory, six floats per step, instead
+// of a header and a pose with a quaternion per point. Nothing is filled
+// while nobody subscribes. The message is kept between publishes, so its
+// arrays reuse their storage.
+class TrajectoryPublisher
+{
+    public:
+        void Advertise(ros::NodeHandle &nh, const std::string &topic);
+
+        // True if advertised and somebody listens
+        bool Active() const;
+
+        // Message of the predicted points (x, y, theta) and inputs, step dt
+        // or step_dt when that is not empty. v is computed from the points.
+        // The solve fields are left to the caller.
+        mpc_ros::MPCTrajectory &Fill(const std::string &frame, const ros::Time &stamp,
+                                     const std::vector<double> &x, const std::vector<double> &y,
+                                     const std::vector<double> &theta, const std::vector<double> &angvel,
+                                     const std::vector<double> &accel, double dt,
+                                     const std::vector<double> &step_dt);
+
+        void Publish();
+
+    private:
+        ros::Publisher _pub;
+        mpc_ros::MPCTrajectory _msg;
+};
+
+#endif /* TRAJECTORY_PUBLISHER_H */
@@ -0,0 +1,89 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef TRANSFORM_CACHE_H
+#define TRANSFORM_CACHE_H
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <ros/ros.h>
+#include <geometry_msgs/PoseStamped.h>
+#include <geometry_msgs/Transform.h>
+#include <tf/transform_listener.h>
+#include <tf2/LinearMath/Transform.h>
+#include <tf2_ros/buffer.h>
+#include "controller_metrics.h"
+
+// Non-blocking TF lookups for callbacks and control loops.
+//
+// Lookup() asks for the newest transform and never waits. When TF cannot
+// provide one, the last good transform of the same frame pair is handed out
+// for up to max_age after it was obtained: map -> odom only moves with
+// localization updates, so the robot keeps following its plan on odometry
+// alone during a short TF outage. Past max_age the lookup fails and the
+// caller simply tries again on its next tick.
+//
+// Every change between fresh, stale and lost is logged and, if advertised,
+// published on /diagnostics; degraded states are repeated once a second.
+class TransformCache
+{
+    public:
+        enum State { FRESH, STALE, LOST };
+
+        explicit TransformCache(double max_age = 0.5);
+
+        void SetMaxAge(double max_age);
+        void AdvertiseDiagnostics(ros::NodeHandle &nh, const std::string &name);
+        // Count the lookups answered with a stale transform, nullptr stops
+        void SetMetrics(ControllerMetrics *metrics);
+
+        // target <- source, e.g. lookup("odom", "map") maps map poses to odom
+        bool Lookup(const tf::TransformListener &tf, const std::string &target, const std::string &source, tf::Transform &transform);
+        bool Lookup(const tf2_ros::Buffer &tf, const std::string &target, const std::string &source, tf2::Transform &transform);
+
+        State GetState(const std::string &target, const std::string &source) const;
+
+        // out = transform * in, labelled with frame
+        static void Apply(const tf::Transform &transform, const geometry_msgs::PoseStamped &in,
+                          const std::string &frame, geometry_msgs::PoseStamped &out);
+
+    private:
+        struct Entry
+        {
+            Entry() : valid(false), state(FRESH) {}
+            geometry_msgs::Transform last;
+            ros::Time stamp;    // when last was looked up
+            ros::Time reported; // last diagnostic
+            bool valid;
+            State state;
+        };
+
+        // Record the outcome of a lookup and fill msg with the transform to use
+        bool Update(const std::string &target, const std::string &source, bool ok,
+                    const std::string &error, geometry_msgs::Transform &msg);
+        void Report(const std::string &key, Entry &entry, const ros::Time &now, const std::string &error);
+
+        mutable std::mutex _mutex;
+        std::map<std::string, Entry> _entries;
+        ros::Duration _max_age;
+        ros::Publisher _pub_diag;
+        std::string _name;
+        ControllerMetrics *_metrics;
+};
+
+#endif /* TRANSFORM_CACHE_H */
@@ -0,0 +1,227 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef VEHICLE_MODEL_H
+#define VEHICLE_MODEL_H
+
+#include <cmath>
+#include <map>
+#include <string>
+#include "cppad_instance.h"
+#include "integrator.h"
+
+// Motion models of VehicleMPC (see vehicle_mpc.h) as policy types. A model
+// fixes the size of its state (NX) and of its inputs (NU) at compile time
+// and its step is inlined into the recorded tape: the solver is written
+// once, each model is an instantiation of it instead of a branch per step.
+//
+// A model provides
+//
+//   NX, NU                      and the indices of its states and inputs
+//   LoadParams(params)          its constants (INTEGRATOR, WHEELBASE, ...)
+//   Step(dt, x, u, x1)          state x1 at t + dt, Scalar double or AD<double>
+//   Heading(x), Speed(x)        against the path heading and REF_V
+//   Angular(k)                  input k is weighted by W_ANGVEL and
+//                               W_DANGVEL, otherwise by W_A and W_DA
+//   Limits(params, lower, upper) bounds of the inputs
+//   FromState(state, x)         from the [x, y, theta, v, ...] of MPC::Solve
+//   Command(x, u, x1, ..)       turn rate, acceleration and lateral speed
+//                               of the step, for the nodes
+namespace vehicle_model
+{
+    enum Type { NONE = 0, DIFF_DRIVE = 1, BICYCLE = 2, HOLONOMIC = 3 };
+
+    inline double Param(const std::map<std::string, double> &params, const char *key, double value)
+    {
+        const std::map<std::string, double>::const_iterator it = params.find(key);
+        return it != params.end() ? it->second : value;
+    }
+
+    // Unicycle of the MPC models: (x, y, theta, v), inputs the turn rate
+    // and the acceleration, integrated by INTEGRATOR (see integrator.h)
+    struct DiffDrive
+    {
+        enum { X, Y, THETA, V, NX };
+        enum { ANGVEL, ACCEL, NU };
+
+        DiffDrive() : integrator(integrator::EULER) {}
+        static const char *Name() { return "diff_drive"; }
+
+        void LoadParams(const std::map<std::string, double> &params)
+        {
+            integrator = Param(params, "INTEGRATOR", integrator);
+        }
+
+        template <class Scalar>
+        void Step(double dt, const Scalar *x, const Scalar *u, Scalar *x1) const
+        {
+            integrator::Step(integrator, dt, x[X], x[Y], x[THETA], x[V], u[ANGVEL], u[ACCEL],
+                             x1[X], x1[Y], x1[THETA], x1[V]);
+        }
+        template <class Scalar>
+        Scalar Heading(const Scalar *x) const { return x[THETA]; }
+        template <class Scalar>
+        Scalar Speed(const Scalar *x) const { return x[V]; }
+        static bool Angular(int k) { return k == ANGVEL; }
+
+        void Limits(const std::map<std::string, double> &params, double *lower, double *upper) const
+        {
+            upper[ANGVEL] = Param(params, "ANGVEL", 3.0);
+            upper[ACCEL] = Param(params, "MAXTHR", 1.0);
+            lower[ANGVEL] = -upper[ANGVEL];
+            lower[ACCEL] = -upper[ACCEL];
+        }
+        void FromState(const double *state, double *x) const
+        {
+            x[X] = state[0];
+            x[Y] = state[1];
+            x[THETA] = state[2];
+            x[V] = state[3];
+        }
+        void Command(const double *x, const double *u, const double *x1,
+                     double &angvel, double &accel, double &lateral) const
+        {
+            angvel = u[ANGVEL];
+            accel = u[ACCEL];
+            lateral = 0.0;
+        }
+
+        int integrator;
+    };
+
+    // Kinematic bicycle about the rear axle, theta' = v tan(steer) / L
+    // (WHEELBASE L), inputs the steering angle (within MAXSTEER) and the
+    // acceleration. The angle is held over the step and v is linear in
+    // time, so the mean speed of the step turns theta exactly; x and y are
+    // integrated by INTEGRATOR with that turn rate.
+    struct KinematicBicycle
+    {
+        enum { X, Y, THETA, V, NX };
+        enum { STEER, ACCEL, NU };
+
+        KinematicBicycle() : integrator(integrator::EULER), wheelbase(0.3) {}
+        static const char *Name() { return "bicycle"; }
+
+        void LoadParams(const std::map<std::string, double> &params)
+        {
+            integrator = Param(params, "INTEGRATOR", integrator);
+            wheelbase = Param(params, "WHEELBASE", wheelbase);
+        }
+
+        template <class Scalar>
+        void Step(double dt, const Scalar *x, const Scalar *u, Scalar *x1) const
+        {
+            const Scalar angvel = (x[V] + u[ACCEL] * (0.5 * dt)) * CppAD::tan(u[STEER]) / wheelbase;
+            integrator::Step(integrator, dt, x[X], x[Y], x[THETA], x[V], angvel, u[ACCEL],
+                             x1[X], x1[Y], x1[THETA], x1[V]);
+        }
+        template <class Scalar>
+        Scalar Heading(const Scalar *x) const { return x[THETA]; }
+        template <class Scalar>
+        Scalar Speed(const Scalar *x) const { return x[V]; }
+        static bool Angular(int k) { return k == STEER; }
+
+        void Limits(const std::map<std::string, double> &params, double *lower, double *upper) const
+        {
+            upper[STEER] = Param(params, "MAXSTEER", 0.5);
+            upper[ACCEL] = Param(params, "MAXTHR", 1.0);
+            lower[STEER] = -upper[STEER];
+            lower[ACCEL] = -upper[ACCEL];
+        }
+        void FromState(const double *state, double *x) const
+        {
+            x[X] = state[0];
+            x[Y] = state[1];
+            x[THETA] = state[2];
+            x[V] = state[3];
+        }
+        void Command(const double *x, const double *u, const double *x1,
+                     double &angvel, double &accel, double &lateral) const
+        {
+            angvel = 0.5 * (x[V] + x1[V]) * std::tan(u[STEER]) / wheelbase;
+            accel = u[ACCEL];
+            lateral = 0.0;
+        }
+
+        int integrator;
+        double wheelbase; // [m]
+    };
+
+    // Holonomic base (mecanum or omni wheels), heading and velocity
+    // independent: (x, y, theta, vx, vy) with the velocity in the frame of
+    // the path, inputs its acceleration and the turn rate. The model is
+    // linear and integrated exactly. REF_V is the speed along the heading,
+    // the lateral speed is free.
+    struct Holonomic
+    {
+        enum { X, Y, THETA, VX, VY, NX };
+        enum { AX, AY, ANGVEL, NU };
+
+        static const char *Name() { return "holonomic"; }
+
+        void LoadParams(const std::map<std::string, double> &params) {}
+
+        template <class Scalar>
+        void Step(double dt, const Scalar *x, const Scalar *u, Scalar *x1) const
+        {
+            x1[X] = x[X] + x[VX] * dt + u[AX] * (0.5 * dt * dt);
+            x1[Y] = x[Y] + x[VY] * dt + u[AY] * (0.5 * dt * dt);
+            x1[THETA] = x[THETA] + u[ANGVEL] * dt;
+            x1[VX] = x[VX] + u[AX] * dt;
+            x1[VY] = x[VY] + u[AY] * dt;
+        }
+        template <class Scalar>
+        Scalar Heading(const Scalar *x) const { return x[THETA]; }
+        template <class Scalar>
+        Scalar Speed(const Scalar *x) const
+        {
+            Scalar s, c;
+            CppAD::sincos(x[THETA], s, c);
+            return x[VX] * c + x[VY] * s;
+        }
+        static bool Angular(int k) { return k == ANGVEL; }
+
+        void Limits(const std::map<std::string, double> &params, double *lower, double *upper) const
+        {
+            upper[AX] = upper[AY] = Param(params, "MAXTHR", 1.0);
+            upper[ANGVEL] = Param(params, "ANGVEL", 3.0);
+            for (int k = 0; k < NU; k++)
+            {
+                lower[k] = -upper[k];
+            }
+        }
+        // The state of MPC::Solve has no lateral speed, it starts at zero
+        void FromState(const double *state, double *x) const
+        {
+            x[X] = state[0];
+            x[Y] = state[1];
+            x[THETA] = state[2];
+            x[VX] = state[3] * std::cos(state[2]);
+            x[VY] = state[3] * std::sin(state[2]);
+        }
+        // Acceleration along the heading, lateral speed in the body frame
+        // at the end of the step
+        void Command(const double *x, const double *u, const double *x1,
+                     double &angvel, double &accel, double &lateral) const
+        {
+            angvel = u[ANGVEL];
+            accel = u[AX] * std::cos(x[THETA]) + u[AY] * std::sin(x[THETA]);
+            lateral = -x1[VX] * std::sin(x1[THETA]) + x1[VY] * std::cos(x1[THETA]);
+        }
+    };
+}
+
+#endif /* VEHICLE_MODEL_H */
@@ -0,0 +1,116 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef VEHICLE_MPC_H
+#define VEHICLE_MPC_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+#include "vehicle_model.h"
+
+class TapeSolver;
+
+// Plan of a VehicleSolver, one entry per step (the inputs one less)
+struct VehiclePlan
+{
+    std::vector<double> x, y, theta;
+    std::vector<double> angvel, accel, lateral; // Command() of each step
+    double cost, cte_cost, etheta_cost, vel_cost;
+    int status; // CppAD::ipopt::solve_result status
+    int iterations;
+    double tape_ms; // recording time of this solve, 0 when reused [ms]
+};
+
+// Path tracking MPC of MPC::Solve on the motion model of VEHICLE_MODEL
+// (see vehicle_model.h), for the fleets that are not all differential
+// drives. The model is picked once, when the parameters are loaded; the
+// solves then run the tape of its instantiation.
+class VehicleSolver
+{
+    public:
+        virtual ~VehicleSolver() {}
+
+        // VEHICLE_MODEL of vehicle_model::Type, NULL for NONE (the models
+        // of MPC itself)
+        static std::unique_ptr<VehicleSolver> Create(int model);
+
+        virtual const char *Name() const = 0;
+        // STEPS, DT, REF_*, the W_* weights, BOUND and the constants of the model
+        virtual void LoadParams(const std::map<std::string, double> &params) = 0;
+        // state [x, y, theta, v, ...] and the polynomial of the path in the
+        // same frame; false if Ipopt did not converge
+        virtual bool Solve(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, VehiclePlan &plan) = 0;
+        // Forget the previous plan, the next solve starts from zero inputs
+        virtual void Reset() = 0;
+};
+
+// Multiple shooting on Model: the variables are the NX states of every
+// step, then the NU inputs of every step but the last, the rows the initial
+// state and the steps. The cost is that of FG_eval on the errors against
+// the path polynomial (cte = f(x) - y, etheta = heading - atan(f'(x))),
+// which are functions of the state here instead of states of their own.
+//
+// The tape is recorded once per parameter change and number of path
+// coefficients, which are its parameters. Each solve starts from the
+// inputs of the previous plan shifted by one step, rolled out from the new
+// state.
+template <class Model>
+class VehicleMPC : public VehicleSolver
+{
+    public:
+        enum { NX = Model::NX, NU = Model::NU };
+
+        VehicleMPC();
+        ~VehicleMPC();
+
+        const char *Name() const { return Model::Name(); }
+        void LoadParams(const std::map<std::string, double> &params);
+        bool Solve(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, VehiclePlan &plan);
+        void Reset() { _inputs.clear(); }
+
+        const Model &GetModel() const { return _model; }
+
+        size_t NumVars() const { return _steps * NX + (_steps - 1) * NU; }
+        size_t NumConstraints() const { return _steps * NX; }
+
+        // Objective and rows, fg[0] the cost, vars the variables and then
+        // the coefficients. Scalar double or AD<double>.
+        template <class Vector>
+        void Evaluate(Vector &fg, const Vector &vars, size_t n_coeffs) const;
+        // cte, etheta and speed parts of the cost of a solution
+        void CostTerms(const double *vars, const Eigen::VectorXd &coeffs,
+                       double &cte_cost, double &etheta_cost, double &vel_cost) const;
+
+    private:
+        Model _model;
+        std::map<std::string, double> _params;
+        int _steps;
+        double _dt, _ref_cte, _ref_etheta, _ref_vel;
+        double _w_cte, _w_etheta, _w_vel, _w_angvel, _w_accel, _w_angvel_d, _w_accel_d;
+        double _bound;
+        double _lower[NU], _upper[NU];
+        std::string _options;
+
+        std::unique_ptr<TapeSolver> _tape;
+        bool _stale;
+        // Inputs of the previous plan, (steps - 1) * NU
+        std::vector<double> _inputs;
+};
+
+#endif /* VEHICLE_MPC_H */
@@ -0,0 +1,70 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef WARM_START_H
+#define WARM_START_H
+
+#include <cstddef>
+#include <vector>
+
+// Keeps the last MPC solution and hands it back shifted by one step as the
+// starting point of the next solve.
+//
+// Layout is the one used by every MPC::Solve: x, y, theta, v, cte, etheta
+// blocks of `steps` entries, then angvel and a blocks of `steps - 1`.
+// Constraints are six blocks of `steps`, the initial state row first.
+class WarmStart
+{
+    public:
+        WarmStart();
+
+        void Reset();
+        bool IsValid(int steps) const;
+
+        // Keep the primal and dual solution of a converged solve
+        void Store(int steps, const std::vector<double> &x, const std::vector<double> &zl,
+                   const std::vector<double> &zu, const std::vector<double> &lambda);
+        // Same from arrays of n_vars and n_constraints entries, without
+        // temporaries (the storage is reused once sized)
+        void Store(int steps, const double *x, const double *zl, const double *zu, size_t n_vars,
+                   const double *lambda, size_t n_constraints);
+
+        // Previous solution advanced by one step. The predicted x, y, theta
+        // are moved so that they start at the new initial pose, since every
+        // cycle is solved in a new vehicle frame. False if nothing is stored
+        // for this horizon.
+        bool Shift(int steps, double x, double y, double theta,
+                   std::vector<double> &vars, std::vector<double> &zl,
+                   std::vector<double> &zu, std::vector<double> &lambda) const;
+
+        // Stored solution carried over to another horizon, e.g. from the
+        // solver of another parameter profile: every block cut to its first
+        // entries or padded with its last one. Nothing if none is stored.
+        void Resize(int steps);
+
+        // Stored solution, for a snapshot (solver_snapshot.h); steps 0 if none
+        int Steps() const { return _steps; }
+        const std::vector<double> &X() const { return _x; }
+        const std::vector<double> &Zl() const { return _zl; }
+        const std::vector<double> &Zu() const { return _zu; }
+        const std::vector<double> &Lambda() const { return _lambda; }
+
+    private:
+        int _steps;
+        std::vector<double> _x, _zl, _zu, _lambda;
+};
+
+#endif /* WARM_START_H */
@@ -0,0 +1,80 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef WHEEL_DYNAMICS_H
+#define WHEEL_DYNAMICS_H
+
+#include <map>
+#include <string>
+
+// Torque-level model of the differential drive (DYNAMIC):
+//
+//   m dv/dt = (tr + tl) / r - b v
+//   I dw/dt = (tr - tl) L / (2 r) - bw w
+//
+// with the wheel torques tr, tl as inputs. The speed v and the turn rate
+// angvel of the kinematic model stay where they are in the layout of
+// FG_eval and become states of these equations: the torques follow the
+// inputs as two blocks of steps - 1 entries (right, then left), and
+// 2 steps - 1 constraints follow the rows of the kinematic model,
+//
+//   a(i) = Accel(v(i), tr(i), tl(i))                          steps - 1 rows
+//   angvel(0) = measured turn rate (state[6] of MPC::Solve)
+//   angvel(i + 1) = angvel(i) + AngAccel(angvel(i), ..) dt(i)   steps - 1 rows
+//
+// where the last transition holds the turn rate after the horizon
+// (angvel(steps - 1) = angvel(steps - 2)). The rows are linear in the
+// variables, so they add a few tape operations per step and nothing to the
+// Hessian; no atomic step function is needed for them.
+class WheelDynamics
+{
+    public:
+        WheelDynamics();
+
+        // DYNAMIC, MASS [kg], INERTIA [kg m^2], WHEEL_RADIUS [m],
+        // TRACK_WIDTH [m], DAMPING [N s/m], ANG_DAMPING [N m s/rad],
+        // MAXTORQUE [N m]
+        void LoadParams(const std::map<std::string, double> &params);
+
+        bool Enabled() const { return _enabled; }
+        double MaxTorque() const { return _max_torque; }
+
+        // dv/dt and dw/dt of the torques
+        template <class Scalar>
+        Scalar Accel(const Scalar &v, const Scalar &right, const Scalar &left) const
+        {
+            return ((right + left) / _radius - _damping * v) / _mass;
+        }
+        template <class Scalar>
+        Scalar AngAccel(const Scalar &w, const Scalar &right, const Scalar &left) const
+        {
+            return ((right - left) * (0.5 * _track / _radius) - _ang_damping * w) / _inertia;
+        }
+
+        // Torques of accel a at speed v and of the turn rate going from w0
+        // to w1 over dt, e.g. to start the torques from a kinematic plan
+        void Torques(double v, double a, double w0, double w1, double dt, double &right, double &left) const;
+
+        // The constants, for the name of a generated model
+        std::string Describe() const;
+
+    private:
+        bool _enabled;
+        double _mass, _inertia, _radius, _track, _damping, _ang_damping, _max_torque;
+};
+
+#endif /* WHEEL_DYNAMICS_H */
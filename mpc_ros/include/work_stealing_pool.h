@@ -0,0 +1,81 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads with one task deque each.
+//
+// Submit() queues a task on the deque of its home worker. A worker runs its
+// own tasks from the front and, once it has none left, steals from the back
+// of the longest other deque. Pinned tasks are never stolen, for state that
+// has to stay on one thread (CppAD memory, see cppad_parallel.h). The deques
+// share one mutex: the tasks are solves of milliseconds, the lock is not
+// where the time goes.
+//
+// Workers can be put in groups, e.g. one per NUMA node (numa_topology.h):
+// an idle worker then steals from its own group first and crosses to another
+// one only when the longest deques of its group have nothing stealable.
+class WorkStealingPool
+{
+    public:
+        typedef std::function<void()> Task;
+        // Run by every worker before its first task, with its index
+        typedef std::function<void(int)> Init;
+
+        // groups: group of every worker, empty for a single group
+        explicit WorkStealingPool(int threads, const Init &init = Init(),
+                                  const std::vector<int> &groups = std::vector<int>());
+        ~WorkStealingPool();
+
+        int Size() const { return int(_queues.size()); }
+
+        // home is taken modulo Size()
+        void Submit(int home, const Task &task, bool pinned = false);
+
+    private:
+        struct Entry
+        {
+            Task task;
+            bool pinned;
+        };
+
+        // Next task of worker index, false if there is none
+        bool take(int index, Task &task);
+        // Longest other deque with a stealable task, in the group of index
+        // only if same_group, -1 for none
+        int victim(int index, bool same_group) const;
+        void run(int index);
+
+        std::vector<std::deque<Entry> > _queues;
+        std::vector<int> _groups;
+        std::vector<std::thread> _threads;
+        Init _init;
+        std::mutex _mutex;
+        std::condition_variable _cond;
+        size_t _stealable;
+        bool _stop;
+};
+
+#endif /* WORK_STEALING_POOL_H */
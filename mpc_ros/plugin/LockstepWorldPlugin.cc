@@ -0,0 +1,140 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include <cmath>
+
+#include "gazebo/common/Assert.hh"
+#include "LockstepWorldPlugin.hh"
+
+using namespace gazebo;
+
+GZ_REGISTER_WORLD_PLUGIN(LockstepWorldPlugin)
+
+/////////////////////////////////////////////////
+LockstepWorldPlugin::LockstepWorldPlugin()
+  : period(0.1), timeout(1.0), release(0.0), commands(0), released(0),
+    stalls(0)
+{
+}
+
+/////////////////////////////////////////////////
+LockstepWorldPlugin::~LockstepWorldPlugin()
+{
+  this->updateConnection.reset();
+  this->sub.shutdown();
+  this->queue.clear();
+}
+
+/////////////////////////////////////////////////
+void LockstepWorldPlugin::Load(physics::WorldPtr _world, sdf::ElementPtr _sdf)
+{
+  this->world = _world;
+  GZ_ASSERT(_world, "LockstepWorldPlugin _world pointer is NULL");
+
+  if (!ros::isInitialized())
+  {
+    gzerr << "LockstepWorldPlugin needs ROS, load gazebo through gazebo_ros"
+          << std::endl;
+    return;
+  }
+
+  std::string topic = "/cmd_vel";
+  bool unthrottled = true;
+  if (_sdf->HasElement("period"))
+    this->period = _sdf->Get<double>("period");
+  if (_sdf->HasElement("command_topic"))
+    topic = _sdf->Get<std::string>("command_topic");
+  if (_sdf->HasElement("timeout"))
+    this->timeout = _sdf->Get<double>("timeout");
+  if (_sdf->HasElement("unthrottled"))
+    unthrottled = _sdf->Get<bool>("unthrottled");
+
+  physics::PhysicsEnginePtr physics = this->world->Physics();
+  GZ_ASSERT(physics, "LockstepWorldPlugin physics pointer is NULL");
+  const double step = physics->GetMaxStepSize();
+  if (this->period < step)
+  {
+    gzwarn << "LockstepWorldPlugin period " << this->period
+           << " is below max_step_size, one step per period" << std::endl;
+    this->period = step;
+  }
+  if (unthrottled)
+    physics->SetRealTimeUpdateRate(0.0);
+
+  this->node.reset(new ros::NodeHandle());
+  this->node->setCallbackQueue(&this->queue);
+  this->sub = this->node->subscribe(topic, 10, &LockstepWorldPlugin::OnCommand,
+                                    this, ros::TransportHints().tcpNoDelay());
+
+  this->Reset();
+  this->updateConnection = event::Events::ConnectWorldUpdateBegin(
+      std::bind(&LockstepWorldPlugin::OnUpdate, this, std::placeholders::_1));
+
+  gzmsg << "LockstepWorldPlugin: " << this->period << " s periods on "
+        << topic << std::endl;
+}
+
+/////////////////////////////////////////////////
+void LockstepWorldPlugin::Reset()
+{
+  this->release = this->world->SimTime().Double() + this->period;
+  this->queue.callAvailable();
+  this->released = this->commands;
+}
+
+/////////////////////////////////////////////////
+void LockstepWorldPlugin::OnCommand(
+    const topic_tools::ShapeShifter::ConstPtr &/*_msg*/)
+{
+  this->commands++;
+}
+
+/////////////////////////////////////////////////
+void LockstepWorldPlugin::OnUpdate(const common::UpdateInfo &_info)
+{
+  const double now = _info.simTime.Double();
+  // Half a step early, against the rounding of the sim time
+  const double eps = 0.5 * this->world->Physics()->GetMaxStepSize();
+  if (now < this->release - eps)
+  {
+    // Commands of the period are counted as they come
+    this->queue.callAvailable();
+    return;
+  }
+
+  // A command newer than the last release, or the timeout
+  const ros::WallTime start = ros::WallTime::now();
+  while (this->commands == this->released && ros::ok())
+  {
+    this->queue.callAvailable(ros::WallDuration(0.001));
+    if (this->timeout > 0.0 &&
+        (ros::WallTime::now() - start).toSec() >= this->timeout)
+    {
+      if (this->stalls++ % 100 == 0)
+        gzwarn << "LockstepWorldPlugin: no command within " << this->timeout
+               << " s at " << now << " s sim time, " << this->stalls
+               << " periods released without one" << std::endl;
+      break;
+    }
+  }
+  this->released = this->commands;
+
+  // The next period ends one period later, periods skipped by a reset of
+  // the world or a long step are not replayed
+  this->release += this->period;
+  if (this->release <= now)
+    this->release = now + this->period;
+}
@@ -0,0 +1,102 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef MPC_ROS_LOCKSTEP_WORLD_PLUGIN_HH_
+#define MPC_ROS_LOCKSTEP_WORLD_PLUGIN_HH_
+
+#include <memory>
+#include <string>
+#include <sdf/sdf.hh>
+
+#include "gazebo/common/Plugin.hh"
+#include "gazebo/physics/physics.hh"
+
+#include <ros/ros.h>
+#include <ros/callback_queue.h>
+#include <topic_tools/shape_shifter.h>
+
+namespace gazebo
+{
+  /// \brief Steps the world in lockstep with a controller: physics runs
+  /// one control period, then waits until the controller has published a
+  /// command on command_topic, then runs the next period. With
+  /// unthrottled (default) the world runs as fast as the physics and the
+  /// controller allow instead of at real time, so a run depends on the
+  /// commands and not on how long the solver took.
+  ///
+  /// The controller must run on sim time: gazebo_ros publishes /clock in
+  /// its own world update callback, which is connected before this one,
+  /// so the clock of the period has been published when the wait starts.
+  /// Set /gazebo/pub_clock_frequency to at least 1 / max_step_size for
+  /// every step to reach the clock.
+  ///
+  /// <plugin name="lockstep" filename="libmpc_lockstep_plugin.so">
+  ///   <period>0.1</period>              control period [s] of sim time
+  ///   <command_topic>/cmd_vel</command_topic>  of any message type
+  ///   <timeout>1.0</timeout>            wall time until a missing command
+  ///                                     releases the period, 0: forever [s]
+  ///   <unthrottled>true</unthrottled>   real_time_update_rate 0
+  /// </plugin>
+  class LockstepWorldPlugin : public WorldPlugin
+  {
+    /// \brief Constructor.
+    public: LockstepWorldPlugin();
+
+    /// \brief Destructor.
+    public: ~LockstepWorldPlugin();
+
+    // Documentation Inherited.
+    public: virtual void Load(physics::WorldPtr _world, sdf::ElementPtr _sdf);
+
+    // Documentation Inherited.
+    public: virtual void Reset();
+
+    /// \brief Callback for World Update Begin events, blocks the physics
+    /// thread at the end of every period until the command.
+    private: void OnUpdate(const common::UpdateInfo &_info);
+
+    /// \brief Counts the commands of command_topic.
+    private: void OnCommand(const topic_tools::ShapeShifter::ConstPtr &_msg);
+
+    /// \brief Pointer to the world.
+    private: physics::WorldPtr world;
+
+    /// \brief Connection to World Update events.
+    private: event::ConnectionPtr updateConnection;
+
+    /// \brief Control period [s].
+    private: double period;
+
+    /// \brief Wall time a period waits for its command, 0: forever [s].
+    private: double timeout;
+
+    /// \brief Sim time the next period ends at [s].
+    private: double release;
+
+    /// \brief Commands received, and at the last release.
+    private: unsigned long commands, released;
+
+    /// \brief Periods released by the timeout instead of a command.
+    private: unsigned long stalls;
+
+    /// \brief ROS node of the subscription, with its own queue serviced
+    /// by the physics thread while it waits.
+    private: std::unique_ptr<ros::NodeHandle> node;
+    private: ros::CallbackQueue queue;
+    private: ros::Subscriber sub;
+  };
+}
+#endif
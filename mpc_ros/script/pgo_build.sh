@@ -0,0 +1,55 @@
+#!/bin/bash
+# Profile guided build of mpc_ros: instrumented build, training on the
+# offline solve benchmark and the replay suite, then the build with the
+# profile, LTO and -march of the target board. Run it on the board itself
+# (or one of the same CPU), e.g.
+#   script/pgo_build.sh ~/catkin_ws assets/mpc.csv square.bag epitrochoid.bag
+# MARCH (default native) is passed as BUILD_MARCH, PGO_DIR is where the
+# profiles go, BENCH_ARGS the options of mpc_solve_bench.
+set -e
+
+if [ $# -lt 3 ]; then
+    echo "usage: $0 <catkin workspace> <solve bench log> <bag>..." >&2
+    exit 2
+fi
+WS=$(cd "$1" && pwd)
+BENCH_LOG=$(readlink -f "$2")
+shift 2
+BAGS=()
+for bag in "$@"; do
+    BAGS+=("$(readlink -f "$bag")")
+done
+MARCH=${MARCH:-native}
+PGO_DIR=${PGO_DIR:-$WS/build/mpc_ros_pgo}
+BENCH_ARGS=${BENCH_ARGS:-STEPS=20 TAPE=1}
+
+build() {
+    (cd "$WS" && catkin_make --pkg mpc_ros -DBUILD_MARCH="$MARCH" -DBUILD_PGO_DIR="$PGO_DIR" "$@")
+}
+
+# 1. Instrumented binaries
+rm -rf "$PGO_DIR"
+mkdir -p "$PGO_DIR"
+build -DBUILD_PGO=GENERATE -DBUILD_LTO=OFF
+source "$WS/devel/setup.bash"
+
+# 2. Training: the solver kernels through the benchmark, the nodes and the
+# planner plugin through the replay suite. A regression of the instrumented
+# build (exit 1) still trains, a setup error (2) does not.
+rosrun mpc_ros mpc_solve_bench "$BENCH_LOG" $BENCH_ARGS > /dev/null
+rosrun mpc_ros mpc_solve_bench_planner "$BENCH_LOG" $BENCH_ARGS > /dev/null
+for bag in "${BAGS[@]}"; do
+    for node in tracking_reference_trajectory nav_mpc MPC_Node; do
+        roslaunch mpc_ros mpc_replay.launch bag:="$bag" node:="$node" || [ $? -eq 1 ]
+    done
+    roslaunch mpc_ros mpc_replay.launch bag:="$bag" target:=planner || [ $? -eq 1 ]
+done
+
+# clang writes raw profiles, to be merged
+if ls "$PGO_DIR"/*.profraw > /dev/null 2>&1; then
+    llvm-profdata merge -o "$PGO_DIR/mpc.profdata" "$PGO_DIR"/*.profraw
+fi
+
+# 3. Optimized build, in the same build tree
+build -DBUILD_PGO=USE -DBUILD_LTO=ON
+echo "Profile guided build done, profiles in $PGO_DIR"
@@ -16,10 +16,42 @@
 # limitations under the License.
 */
 
+// Before cppad/cppad.hpp, see simd_double.h
+#include "simd_double.h"
 #include "MPC.h"
+#include "mpc_fg_eval.h"
 //#include <cppad/cppad.hpp>
+#include "cppad_instance.h"
 #include <cppad/ipopt/solve.hpp>
+#include "tape_solver.h"
+#include "stage_hessian.h"
+#include "work_stealing_pool.h"
+#include "executor.h"
+#include "sparsity_patterns.h"
+#include "linear_solver.h"
+#include "cppad_parallel.h"
+#include "poly_ref_atomic.h"
+#include "move_blocks.h"
+#include "input_spline.h"
+#include "reduced_state.h"
+#include "integrator.h"
+#include "time_grid.h"
+#include "terminal_cost.h"
+#include "wheel_dynamics.h"
+#include "trace_span.h"
+#include "remote_solve.h"
+#include "solver_snapshot.h"
+#include "step_model.h"
+#ifdef MPC_CODEGEN
+#include "codegen_model.h"
+#endif
 #include <Eigen/Core>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <mutex>
+#include <sstream>
 
 // The program use fragments of code from
 // https://github.com/udacity/CarND-MPC-Quizzes
@@ -32,18 +64,109 @@ using CppAD::AD;
 class FG_eval 
 {
     public:
-        // Fitted polynomial coefficients
+        // Fitted polynomial coefficients, or the reference poses when _reference is set
         Eigen::VectorXd coeffs;
+        // Errors against one reference pose per step, coeffs = [x(0..N-1),
+        // y(0..N-1), theta(0..N-1)], instead of the path polynomial
+        bool _reference;
+        // etheta of the path model: heading against the path at x0
+        // (theta0 - atan(f'(x0))), or integrated from the turn rate alone
+        bool _path_heading;
 
         double _dt, _ref_cte, _ref_etheta, _ref_vel; 
         double  _w_cte, _w_etheta, _w_vel, _w_angvel, _w_accel, _w_angvel_d, _w_accel_d;
         int _mpc_steps, _x_start, _y_start, _theta_start, _v_start, _cte_start, _etheta_start, _angvel_start, _a_start;
+        // Index of coeffs in vars when recording for TapeSolver, -1 to use coeffs
+        int _coeff_start;
+        // Integration of x, y, theta and v over a step, see integrator.h
+        int _integrator;
+        // dt of each step on a non-uniform grid, see time_grid.h. Empty: _dt.
+        std::vector<double> _step_dt;
+        // Input block of each step, see move_blocks.h. Empty: one input per step.
+        std::vector<int> _block_of;
+        // Control points of the B-spline inputs (INPUT_SPLINE), 0 none, see
+        // input_spline.h. They take the place of the blocks.
+        int _spline_points;
+        InputSpline _spline;
+        // Reduced state, see reduced_state.h: cte and etheta are computed
+        // from the initial errors _cte0 and _etheta0 (the two entries of
+        // vars after coeffs when recording for TapeSolver)
+        bool _reduced;
+        double _cte0, _etheta0;
+        // Torque-level model (DYNAMIC), see wheel_dynamics.h: the right and
+        // left torque blocks start at _torque_start, behind the inputs
+        WheelDynamics _wheels;
+        int _torque_start;
+        // Soft bounds (SOFT) of the torque model, where angvel and a are
+        // states and a measured turn rate can start outside ANGVEL: exact
+        // L1 penalty W_SLACK on one slack per angvel and a step, behind the
+        // torques, with the rows angvel + s >= -ANGVEL, angvel - s <= ANGVEL
+        // (two per slack, the same for a and MAXTHR)
+        bool _soft;
+        double _w_slack;
+        int _slack_start;
+        // Terminal cost (TERMINAL), see terminal_cost.h: P of the LQR on
+        // the errors of the last step
+        bool _terminal;
+        double _p_cte, _p_cte_etheta, _p_etheta, _p_vel;
+        // Index of the ModelParams values in vars when recording, -1 to use
+        // the members: weights and dt are tape parameters, see model_params.h
+        int _value_start;
+
+        // Obstacle distance linearized per step, see MPC::SetObstacleModel.
+        // Read from vars at _obs_start when recording, else from obstacles.
+        const std::vector<double> *obstacles;
+        int _obs_steps, _obs_start;
+        double _w_obs, _clearance;
+
+        // Corridor half-planes per step, see MPC::SetCorridorModel. Read
+        // from vars at _cor_start when recording, else from corridor. Their
+        // rows follow those of the torque model, _cor_faces per step from
+        // step 1 on.
+        const std::vector<double> *corridor;
+        int _cor_steps, _cor_faces, _cor_start;
+
+        // Reference speed per step, see MPC::SetSpeedReference. Read from
+        // vars at _speed_start when recording, else from speeds; REF_V for
+        // the steps past _speed_steps.
+        const std::vector<double> *speeds;
+        int _speed_steps, _speed_start;
+
+        // Dynamics as one atomic operation per step (CHECKPOINT), NULL to
+        // record them operation by operation, see step_model.h
+        StepModel *_step;
 
-        AD<double> cost_cte, cost_etheta, cost_vel;
         // Constructor
         FG_eval(Eigen::VectorXd coeffs) 
         { 
             this->coeffs = coeffs; 
+            _coeff_start = -1;
+            _integrator = integrator::EULER;
+            _reference = false;
+            _path_heading = true;
+            _reduced = false;
+            _cte0 = 0;
+            _etheta0 = 0;
+            _soft = false;
+            _w_slack = 1.0e4;
+            _spline_points = 0;
+            _terminal = false;
+            _p_cte = 0;
+            _p_cte_etheta = 0;
+            _p_etheta = 0;
+            _p_vel = 0;
+            _value_start = -1;
+            obstacles = NULL;
+            _obs_steps = 0;
+            _obs_start = -1;
+            corridor = NULL;
+            _cor_steps = 0;
+            _cor_faces = 0;
+            _cor_start = -1;
+            speeds = NULL;
+            _speed_steps = 0;
+            _speed_start = -1;
+            _step = NULL;
 
             // Set default value    
             _dt = 0.1;  // in sec
@@ -57,6 +180,8 @@ class FG_eval
             _w_accel   = 50;
             _w_angvel_d = 0;
             _w_accel_d = 0;
+            _w_obs = 1000;
+            _clearance = 0.3; // m
 
             _mpc_steps   = 40;
             _x_start     = 0;
@@ -67,6 +192,8 @@ class FG_eval
             _etheta_start  = _cte_start + _mpc_steps;
             _angvel_start = _etheta_start + _mpc_steps;
             _a_start     = _angvel_start + _mpc_steps - 1;
+            _torque_start = _a_start + _mpc_steps - 1;
+            _slack_start = _torque_start;
         }
 
         // Load parameters for constraints
@@ -85,6 +212,16 @@ class FG_eval
             _w_accel = params.find("W_A") != params.end()     ? params.at("W_A") : _w_accel;
             _w_angvel_d = params.find("W_DANGVEL") != params.end() ? params.at("W_DANGVEL") : _w_angvel_d;
             _w_accel_d = params.find("W_DA") != params.end()     ? params.at("W_DA") : _w_accel_d;
+            _w_obs = params.find("W_OBS") != params.end() ? params.at("W_OBS") : _w_obs;
+            _clearance = params.find("CLEARANCE") != params.end() ? params.at("CLEARANCE") : _clearance;
+            _integrator = params.find("INTEGRATOR") != params.end() ? params.at("INTEGRATOR") : _integrator;
+            _path_heading = params.find("PATH_HEADING") != params.end() ? params.at("PATH_HEADING") : _path_heading;
+            _step_dt = TimeGridSteps(params, _mpc_steps);
+            _wheels.LoadParams(params);
+            _soft = params.find("SOFT") != params.end() ? params.at("SOFT") : _soft;
+            _w_slack = params.find("W_SLACK") != params.end() ? params.at("W_SLACK") : _w_slack;
+            _spline_points = params.find("INPUT_SPLINE") != params.end() ? params.at("INPUT_SPLINE") : _spline_points;
+            _terminal = ::TerminalCost(params, _p_cte, _p_cte_etheta, _p_etheta, _p_vel);
 
             _x_start     = 0;
             _y_start     = _x_start + _mpc_steps;
@@ -94,20 +231,535 @@ class FG_eval
             _etheta_start  = _cte_start + _mpc_steps;
             _angvel_start = _etheta_start + _mpc_steps;
             _a_start     = _angvel_start + _mpc_steps - 1;
+            _torque_start = _a_start + _mpc_steps - 1;
+            _slack_start = _torque_start + NumTorques();
             
             //cout << "\n!! FG_eval Obj parameters updated !! " << _mpc_steps << endl; 
         }
 
+        // Hold the inputs over blocks of steps, or take them from the spline
+        // of INPUT_SPLINE, after LoadParams. The torque model keeps one
+        // input per step.
+        void SetMoveBlocks(const std::vector<int> &blocks)
+        {
+            _spline.Clear();
+            if (_spline_points > 0 && !_wheels.Enabled())
+            {
+                _spline.Set(_spline_points, _mpc_steps, _step_dt);
+            }
+            _block_of = _wheels.Enabled() || _spline.Enabled() ? std::vector<int>() : MoveBlockIndex(blocks, _mpc_steps);
+            _a_start = _angvel_start + NumInputs();
+            _torque_start = _a_start + NumInputs();
+            _slack_start = _torque_start + NumTorques();
+        }
+        int NumInputs() const
+        {
+            return _spline.Enabled() ? _spline.Points() : (_block_of.empty() ? _mpc_steps - 1 : _block_of.back() + 1);
+        }
+        // Torque variables and their constraint rows, see wheel_dynamics.h
+        int NumTorques() const { return _wheels.Enabled() ? 2 * (_mpc_steps - 1) : 0; }
+        int NumTorqueRows() const { return _wheels.Enabled() ? 2 * _mpc_steps - 1 : 0; }
+        // Slack variables and their rows of the soft bounds
+        int NumSlacks() const { return _soft && _wheels.Enabled() ? 2 * (_mpc_steps - 1) : 0; }
+        int NumSlackRows() const { return 2 * NumSlacks(); }
+        // Rows of the corridor, behind the slack rows
+        int NumCorridorRows() const { return _cor_steps > 0 ? _cor_faces * (_mpc_steps - 1) : 0; }
+        int input(int i) const { return _block_of.empty() ? i : _block_of[i]; }
+        // Input of step i from the input variables at start (the angvel or
+        // the a ones): its block, or the spline of the points there
+        template <class Vector>
+        typename Vector::value_type Input(const Vector &vars, int start, int i) const
+        {
+            return _spline.Enabled() ? _spline.Value(vars, start, i) : vars[start + input(i)];
+        }
+        double dt(int i) const { return _step_dt.empty() ? _dt : _step_dt[i]; }
+        // dt of step i when the uniform one is dt, a parameter of the tape
+        template <class Scalar>
+        Scalar stepDt(const Scalar &dt, int i) const { return _step_dt.empty() ? dt : Scalar(_step_dt[i]); }
+
+        // Values of the ModelParams in the order of ModelParams::Value
+        void Values(double *values) const
+        {
+            values[ModelParams::DT] = _dt;
+            values[ModelParams::REF_CTE] = _ref_cte;
+            values[ModelParams::REF_ETHETA] = _ref_etheta;
+            values[ModelParams::REF_V] = _ref_vel;
+            values[ModelParams::W_CTE] = _w_cte;
+            values[ModelParams::W_EPSI] = _w_etheta;
+            values[ModelParams::W_V] = _w_vel;
+            values[ModelParams::W_ANGVEL] = _w_angvel;
+            values[ModelParams::W_A] = _w_accel;
+            values[ModelParams::W_DANGVEL] = _w_angvel_d;
+            values[ModelParams::W_DA] = _w_accel_d;
+            values[ModelParams::W_OBS] = _w_obs;
+            values[ModelParams::CLEARANCE] = _clearance;
+        }
+        // The same values in a sweep over vars: constants, or the
+        // parameters of the tape at _value_start
+        template <class Vector>
+        void Params(const Vector &vars, typename Vector::value_type *p) const
+        {
+            typedef typename Vector::value_type Scalar;
+            double constants[ModelParams::NUM_VALUES];
+            Values(constants);
+            for (int k = 0; k < ModelParams::NUM_VALUES; k++)
+            {
+                p[k] = _value_start < 0 ? Scalar(constants[k]) : vars[_value_start + k];
+            }
+        }
+        // Reference speed of step i, p from Params()
+        template <class Vector>
+        typename Vector::value_type refSpeed(const Vector &vars, const typename Vector::value_type *p, int i) const
+        {
+            typedef typename Vector::value_type Scalar;
+            if (i >= _speed_steps)
+            {
+                return p[ModelParams::REF_V];
+            }
+            return _speed_start < 0 ? Scalar((*speeds)[i]) : vars[_speed_start + i];
+        }
+
+        // The dynamics go through _step: the rows of StepModel::Residuals()
+        bool Checkpointable() const { return _integrator == integrator::EULER && !_reference && !_reduced; }
+
+        // Cost added to the last step by the terminal cost: P in place of
+        // the stage weights of its cte, etheta and v, p from Params()
+        template <class Scalar>
+        Scalar TerminalCost(const Scalar *p, const Scalar &cte, const Scalar &etheta, const Scalar &v) const
+        {
+            Scalar e_cte = cte - p[ModelParams::REF_CTE], e_etheta = etheta - p[ModelParams::REF_ETHETA];
+            Scalar e_vel = v - p[ModelParams::REF_V];
+            return (_p_cte - p[ModelParams::W_CTE]) * e_cte * e_cte + 2 * _p_cte_etheta * e_cte * e_etheta
+                   + (_p_etheta - p[ModelParams::W_EPSI]) * e_etheta * e_etheta
+                   + (_p_vel - p[ModelParams::W_V]) * e_vel * e_vel;
+        }
+
+        // Drop the cte and etheta variables, after SetMoveBlocks. The
+        // inputs follow v, _cte_start and _etheta_start stay the indices
+        // of the full layout (CostTerms).
+        void SetReduced(double cte0, double etheta0)
+        {
+            _reduced = true;
+            _cte0 = cte0;
+            _etheta0 = etheta0;
+            _angvel_start = _v_start + _mpc_steps;
+            _a_start = _angvel_start + NumInputs();
+        }
+
+        // cte and etheta of the reduced state along the horizon, by the
+        // model rows of the full layout, dt the uniform step
+        template <class Vector>
+        void Errors(const Vector &vars, const Vector &c, const typename Vector::value_type &dt,
+                    Vector &cte, Vector &etheta) const
+        {
+            typedef typename Vector::value_type Scalar;
+            cte.resize(_mpc_steps);
+            etheta.resize(_mpc_steps);
+            cte[0] = _coeff_start < 0 ? Scalar(_cte0) : vars[_coeff_start + c.size()];
+            etheta[0] = _coeff_start < 0 ? Scalar(_etheta0) : vars[_coeff_start + c.size() + 1];
+            for (int i = 0; i < _mpc_steps - 1; i++)
+            {
+                errorStep(c, i, stepDt(dt, i), vars[_x_start + i], vars[_y_start + i], vars[_theta_start + i],
+                          vars[_v_start + i], Input(vars, _angvel_start, i), vars[_x_start + i + 1],
+                          vars[_y_start + i + 1], vars[_theta_start + i + 1], etheta[i], cte[i + 1], etheta[i + 1]);
+            }
+        }
+
+        // cte and etheta of step i + 1 from the step x0 .. -> x1 .. of
+        // length dt: by the path model, or against the reference pose of
+        // step i + 1 (lateral offset along its left normal and heading
+        // difference)
+        template <class Vector, class Scalar>
+        void errorStep(const Vector &c, int i, const Scalar &dt, const Scalar &x0, const Scalar &y0, const Scalar &theta0,
+                       const Scalar &v0, const Scalar &w0, const Scalar &x1, const Scalar &y1, const Scalar &theta1,
+                       const Scalar &etheta0, Scalar &cte1, Scalar &etheta1) const
+        {
+            if (_reference)
+            {
+                Scalar xr1 = c[i + 1];
+                Scalar yr1 = c[_mpc_steps + i + 1];
+                Scalar thetar1 = c[2 * _mpc_steps + i + 1];
+                Scalar sinr1, cosr1;
+                CppAD::sincos(thetar1, sinr1, cosr1);
+                cte1 = (yr1 - y1) * cosr1 - (xr1 - x1) * sinr1;
+                etheta1 = theta1 - thetar1;
+                return;
+            }
+
+            // f(x0) and the path heading atan(f'(x0)), see poly_ref_atomic.h
+            Scalar f0, trj_grad0;
+            PolyRef(c, x0, f0, trj_grad0);
+
+            cte1 = (f0 - y0) + (v0 * CppAD::sin(etheta0) * dt);
+            etheta1 = _path_heading ? (theta0 - trj_grad0) + w0 * dt : etheta0 + w0 * dt;
+        }
+
+        // Pure pursuit rollout over the horizon from the initial state in
+        // vars: the turn rate of the arc through a lookahead point on the
+        // path (or the first reference pose at least that far) and the
+        // throttle to _ref_vel, clamped to the bounds and held over the
+        // input blocks. The states follow the model rows, so the seed is
+        // feasible. With fixed_angvel the first turn rate is kept (measured
+        // one of the torque model), whose torques are derived last.
+        void PursuitSeed(CPPAD_TESTVECTOR(double) &vars, double max_angvel, double max_throttle,
+                         bool fixed_angvel) const
+        {
+            CPPAD_TESTVECTOR(double) c(coeffs.size());
+            for (int i = 0; i < coeffs.size(); i++)
+            {
+                c[i] = coeffs[i];
+            }
+            double horizon = 0;
+            for (int i = 0; i < _mpc_steps - 1; i++)
+            {
+                horizon += dt(i);
+            }
+            // Half of the distance covered over the horizon at _ref_vel
+            const double lookahead = std::max(0.3, 0.5 * std::fabs(_ref_vel) * horizon);
+
+            if (_spline.Enabled())
+            {
+                // Pursuit with one input per step, each point takes the
+                // input of its step and the states follow the spline
+                FG_eval per_step(*this);
+                per_step._spline.Clear();
+                per_step._a_start = _angvel_start + _mpc_steps - 1;
+                CPPAD_TESTVECTOR(double) full(per_step._a_start + _mpc_steps - 1);
+                for (int i = 0; i < _angvel_start; i++)
+                {
+                    full[i] = vars[i];
+                }
+                per_step.PursuitSeed(full, max_angvel, max_throttle, fixed_angvel);
+                for (int k = 0; k < _spline.Points(); k++)
+                {
+                    vars[_angvel_start + k] = full[_angvel_start + _spline.Sample(k)];
+                    vars[_a_start + k] = full[per_step._a_start + _spline.Sample(k)];
+                }
+                Rollout(vars);
+                return;
+            }
+
+            for (int i = 0; i < _mpc_steps - 1; i++)
+            {
+                const double x0 = vars[_x_start + i], y0 = vars[_y_start + i];
+                const double theta0 = vars[_theta_start + i], v0 = vars[_v_start + i];
+                const double etheta0 = vars[_etheta_start + i];
+                if (i == 0 || input(i - 1) != input(i))
+                {
+                    double gx = x0 + lookahead, gy = 0;
+                    if (_reference)
+                    {
+                        int k = i + 1;
+                        while (k < _mpc_steps - 1
+                               && std::hypot(c[k] - x0, c[_mpc_steps + k] - y0) < lookahead)
+                        {
+                            k++;
+                        }
+                        gx = c[k];
+                        gy = c[_mpc_steps + k];
+                    }
+                    else
+                    {
+                        double grad;
+                        PolyRef(c, gx, gy, grad);
+                    }
+                    const double alpha = atan2(gy - y0, gx - x0) - theta0;
+                    const double dist = std::max(1e-3, std::hypot(gx - x0, gy - y0));
+                    const double w = v0 * 2.0 * sin(alpha) / dist;
+                    const double a = (_ref_vel - v0) / dt(i);
+                    if (!(i == 0 && fixed_angvel))
+                    {
+                        vars[_angvel_start + input(i)] = std::min(max_angvel, std::max(-max_angvel, w));
+                    }
+                    vars[_a_start + input(i)] = std::min(max_throttle, std::max(-max_throttle, a));
+                }
+
+                const double w0 = vars[_angvel_start + input(i)], a0 = vars[_a_start + input(i)];
+                integrator::Step(_integrator, dt(i), x0, y0, theta0, v0, w0, a0, vars[_x_start + i + 1],
+                                 vars[_y_start + i + 1], vars[_theta_start + i + 1], vars[_v_start + i + 1]);
+                errorStep(c, i, dt(i), x0, y0, theta0, v0, w0, vars[_x_start + i + 1], vars[_y_start + i + 1],
+                          vars[_theta_start + i + 1], etheta0, vars[_cte_start + i + 1], vars[_etheta_start + i + 1]);
+            }
+            seedTorques(vars);
+        }
+
+        // States of the inputs already in vars (a SeedProvider's), rolled
+        // out over the horizon from the initial state as in PursuitSeed()
+        void Rollout(CPPAD_TESTVECTOR(double) &vars) const
+        {
+            CPPAD_TESTVECTOR(double) c(coeffs.size());
+            for (int i = 0; i < coeffs.size(); i++)
+            {
+                c[i] = coeffs[i];
+            }
+            for (int i = 0; i < _mpc_steps - 1; i++)
+            {
+                const double x0 = vars[_x_start + i], y0 = vars[_y_start + i];
+                const double theta0 = vars[_theta_start + i], v0 = vars[_v_start + i];
+                const double w0 = Input(vars, _angvel_start, i), a0 = Input(vars, _a_start, i);
+                integrator::Step(_integrator, dt(i), x0, y0, theta0, v0, w0, a0, vars[_x_start + i + 1],
+                                 vars[_y_start + i + 1], vars[_theta_start + i + 1], vars[_v_start + i + 1]);
+                errorStep(c, i, dt(i), x0, y0, theta0, v0, w0, vars[_x_start + i + 1], vars[_y_start + i + 1],
+                          vars[_theta_start + i + 1], vars[_etheta_start + i], vars[_cte_start + i + 1],
+                          vars[_etheta_start + i + 1]);
+            }
+            seedTorques(vars);
+        }
+
+        // Torques of the seeded angvel and a, DYNAMIC only
+        void seedTorques(CPPAD_TESTVECTOR(double) &vars) const
+        {
+            const int n = NumTorques() / 2;
+            for (int i = 0; i < n; i++)
+            {
+                const double w0 = vars[_angvel_start + i];
+                const double w1 = i + 1 < n ? vars[_angvel_start + i + 1] : w0;
+                _wheels.Torques(vars[_v_start + i], vars[_a_start + i], w0, w1, dt(i),
+                                vars[_torque_start + i], vars[_torque_start + n + i]);
+            }
+        }
+
+        // Name of the generated model for these constants and n_coeffs path
+        // coefficients: FNV-1a hash of everything that ends up as a literal
+        std::string ModelName(int n_coeffs) const
+        {
+            std::ostringstream constants;
+            constants.precision(17);
+            constants << _mpc_steps << ' ' << n_coeffs << ' ' << _dt << ' ' << _ref_cte << ' '
+                      << _ref_etheta << ' ' << _ref_vel << ' ' << _w_cte << ' ' << _w_etheta << ' '
+                      << _w_vel << ' ' << _w_angvel << ' ' << _w_accel << ' ' << _w_angvel_d << ' ' << _w_accel_d;
+            for (size_t i = 0; i < _block_of.size(); i++)
+            {
+                constants << (i == 0 ? " blocks " : " ") << _block_of[i];
+            }
+            if (_spline.Enabled())
+            {
+                constants << " spline " << _spline.Points();
+            }
+            if (_reduced)
+            {
+                constants << " reduced";
+            }
+            if (_reference)
+            {
+                constants << " reference";
+            }
+            if (!_path_heading)
+            {
+                constants << " heading_rate";
+            }
+            if (_integrator != integrator::EULER)
+            {
+                constants << " integrator " << _integrator;
+            }
+            for (size_t i = 0; i < _step_dt.size(); i++)
+            {
+                constants << (i == 0 ? " grid " : " ") << _step_dt[i];
+            }
+            if (_wheels.Enabled())
+            {
+                constants << " dynamic " << _wheels.Describe();
+            }
+            if (NumSlacks() > 0)
+            {
+                constants << " soft " << _w_slack;
+            }
+            if (_terminal)
+            {
+                constants << " terminal " << _p_cte << ' ' << _p_cte_etheta << ' ' << _p_etheta << ' ' << _p_vel;
+            }
+            const std::string text = constants.str();
+            unsigned long long hash = 14695981039346656037ULL;
+            for (size_t i = 0; i < text.size(); i++)
+            {
+                hash ^= (unsigned char)text[i];
+                hash *= 1099511628211ULL;
+            }
+            char name[32];
+            std::snprintf(name, sizeof(name), "mpc_%016llx", hash);
+            return name;
+        }
+
+        // Tracking cost terms of a solution, evaluated in double after the solve
+        void CostTerms(const CPPAD_TESTVECTOR(double) &x, double &cost_cte, double &cost_etheta, double &cost_vel) const
+        {
+            cost_cte = 0;
+            cost_etheta = 0;
+            cost_vel = 0;
+            for (int i = 0; i < _mpc_steps; i++) 
+            {
+                cost_cte += _w_cte * pow(x[_cte_start + i] - _ref_cte, 2);
+                cost_etheta += _w_etheta * pow(x[_etheta_start + i] - _ref_etheta, 2);
+                const double ref_v = i < _speed_steps && speeds ? (*speeds)[i] : _ref_vel;
+                cost_vel += _w_vel * pow(x[_v_start + i] - ref_v, 2);
+            }
+        }
+
+        // Step i of the full layout for StageHessian (HESSIAN_STAGES), not
+        // with the reduced state or the torque model: z = [x0 y0 theta0 v0
+        // cte0 etheta0 w0 a0 x1 y1 theta1 v1 cte1 etheta1 w1 a1 | coeffs,
+        // or the reference pose of step i + 1 | the ModelParams values when
+        // they are tape parameters], w1 and a1 the next inputs, see
+        // StageSources(). h = [cost, the model rows of step i]; the cost
+        // has the terms of step i, those of the input change to the next
+        // step, and on the last step the state terms of step i + 1, so the
+        // stages add up to operator().
+        template <class Vector>
+        void Stage(Vector &h, const Vector &z, int i) const
+        {
+            typedef typename Vector::value_type Scalar;
+            const bool last = i == _mpc_steps - 2;
+            const size_t n_values = _value_start < 0 ? 0 : ModelParams::NUM_VALUES;
+            Vector c(_reference ? 3 * _mpc_steps : z.size() - 16 - n_values);
+            for (size_t k = 0; k < c.size(); k++)
+            {
+                c[k] = _reference ? Scalar(0) : z[16 + k];
+            }
+            Scalar p[ModelParams::NUM_VALUES];
+            double constants[ModelParams::NUM_VALUES];
+            Values(constants);
+            for (int k = 0; k < ModelParams::NUM_VALUES; k++)
+            {
+                p[k] = n_values > 0 ? z[z.size() - n_values + k] : Scalar(constants[k]);
+            }
+            const Scalar dt = stepDt(p[ModelParams::DT], i);
+            if (_reference)
+            {
+                c[i + 1] = z[16];
+                c[_mpc_steps + i + 1] = z[17];
+                c[2 * _mpc_steps + i + 1] = z[18];
+            }
+
+            h[0] = p[ModelParams::W_CTE] * CppAD::pow(z[4] - p[ModelParams::REF_CTE], 2);
+            h[0] += p[ModelParams::W_EPSI] * CppAD::pow(z[5] - p[ModelParams::REF_ETHETA], 2);
+            h[0] += p[ModelParams::W_V] * CppAD::pow(z[3] - p[ModelParams::REF_V], 2);
+            h[0] += p[ModelParams::W_ANGVEL] * CppAD::pow(z[6], 2);
+            h[0] += p[ModelParams::W_A] * CppAD::pow(z[7], 2);
+            if (last)
+            {
+                h[0] += p[ModelParams::W_CTE] * CppAD::pow(z[12] - p[ModelParams::REF_CTE], 2);
+                h[0] += p[ModelParams::W_EPSI] * CppAD::pow(z[13] - p[ModelParams::REF_ETHETA], 2);
+                h[0] += p[ModelParams::W_V] * CppAD::pow(z[11] - p[ModelParams::REF_V], 2);
+                if (_terminal)
+                {
+                    h[0] += TerminalCost(p, z[12], z[13], z[11]);
+                }
+            }
+            else
+            {
+                h[0] += p[ModelParams::W_DANGVEL] * CppAD::pow(z[14] - z[6], 2);
+                h[0] += p[ModelParams::W_DA] * CppAD::pow(z[15] - z[7], 2);
+            }
+
+            Scalar xp, yp, thetap, vp;
+            integrator::Step(_integrator, dt, z[0], z[1], z[2], z[3], z[6], z[7], xp, yp, thetap, vp);
+            h[1] = z[8] - xp;
+            h[2] = z[9] - yp;
+            h[3] = z[10] - thetap;
+            h[4] = z[11] - vp;
+            Scalar cte1, etheta1;
+            errorStep(c, i, dt, z[0], z[1], z[2], z[3], z[6], z[8], z[9], z[10], z[5], cte1, etheta1);
+            h[5] = z[12] - cte1;
+            h[6] = z[13] - etheta1;
+        }
+
+        // Entries of the tape domain [vars | coeffs | values] behind z of
+        // Stage(i), after _coeff_start and _value_start are set
+        std::vector<size_t> StageSources(int i, int n_coeffs) const
+        {
+            const int next = i + 1 < _mpc_steps - 1 ? input(i + 1) : input(i);
+            const int source[16] = {_x_start + i, _y_start + i, _theta_start + i, _v_start + i,
+                                    _cte_start + i, _etheta_start + i,
+                                    _angvel_start + input(i), _a_start + input(i),
+                                    _x_start + i + 1, _y_start + i + 1, _theta_start + i + 1, _v_start + i + 1,
+                                    _cte_start + i + 1, _etheta_start + i + 1,
+                                    _angvel_start + next, _a_start + next};
+            std::vector<size_t> sources(source, source + 16);
+            if (_reference)
+            {
+                sources.push_back(_coeff_start + i + 1);
+                sources.push_back(_coeff_start + _mpc_steps + i + 1);
+                sources.push_back(_coeff_start + 2 * _mpc_steps + i + 1);
+            }
+            else
+            {
+                for (int k = 0; k < n_coeffs; k++)
+                {
+                    sources.push_back(_coeff_start + k);
+                }
+            }
+            for (int k = 0; _value_start >= 0 && k < ModelParams::NUM_VALUES; k++)
+            {
+                sources.push_back(_value_start + k);
+            }
+            return sources;
+        }
+
+        // Rows of fg behind h of Stage(i)
+        std::vector<size_t> StageRows(int i) const
+        {
+            const int row[7] = {0, 2 + _x_start + i, 2 + _y_start + i, 2 + _theta_start + i, 2 + _v_start + i,
+                                2 + _cte_start + i, 2 + _etheta_start + i};
+            return std::vector<size_t>(row, row + 7);
+        }
+
         // MPC implementation (cost func & constraints)
         typedef CPPAD_TESTVECTOR(AD<double>) ADvector; 
+
+        // Model rows of the steps through _step (CHECKPOINT), false to
+        // record them operation by operation. Only on the AD<double> tapes,
+        // the float and generated models take the rows below.
+        bool checkpointDynamics(ADvector &fg, const ADvector &vars, const ADvector &c, const AD<double> &dt) const
+        {
+            if (!_step || !Checkpointable())
+            {
+                return false;
+            }
+            ADvector in(StepModel::COEFFS + c.size()), out(StepModel::NUM_RESIDUALS);
+            for (size_t k = 0; k < c.size(); k++)
+            {
+                in[StepModel::COEFFS + k] = c[k];
+            }
+            const int starts[] = { _x_start, _y_start, _theta_start, _v_start, _cte_start, _etheta_start };
+            for (int i = 0; i < _mpc_steps - 1; i++)
+            {
+                // The state at time t and t+1
+                for (int k = 0; k < 6; k++)
+                {
+                    in[StepModel::X0 + k] = vars[starts[k] + i];
+                    in[StepModel::X1 + k] = vars[starts[k] + i + 1];
+                }
+                // Only consider the actuation at time t.
+                in[StepModel::ANGVEL] = Input(vars, _angvel_start, i);
+                in[StepModel::ACCEL] = Input(vars, _a_start, i);
+                in[StepModel::DT] = stepDt(dt, i);
+                (*_step)(in, out);
+                for (int k = 0; k < 6; k++)
+                {
+                    fg[2 + starts[k] + i] = out[StepModel::R_X + k];
+                }
+            }
+            return true;
+        }
+        template <class Vector, class Scalar>
+        bool checkpointDynamics(Vector &, const Vector &, const Vector &, const Scalar &) const
+        {
+            return false;
+        }
+
         // fg: function that evaluates the objective and constraints using the syntax       
-        void operator()(ADvector& fg, const ADvector& vars) 
+        // (templated on the vector so that CodegenModel can record it on AD<CG<double>>)
+        template <class Vector>
+        void operator()(Vector& fg, const Vector& vars) 
         {
+            typedef typename Vector::value_type Scalar;
+
+            // Weights, references and dt: constants, or parameters of the tape
+            Scalar p[ModelParams::NUM_VALUES];
+            Params(vars, p);
+
             // fg[0] for cost function
             fg[0] = 0;
-            cost_cte =  0;
-            cost_etheta = 0;
-            cost_vel = 0;
 
             /*
             for (int i = 0; i < _mpc_steps; i++) 
@@ -121,33 +773,62 @@ class FG_eval
                 cout << "_etheta_start" << vars[_etheta_start + i] <<endl;
             }*/
 
-            for (int i = 0; i < _mpc_steps; i++) 
+            // Fitted polynomial coefficients
+            Vector c(coeffs.size());
+            for (int i = 0; i < coeffs.size(); i++)
             {
-              fg[0] += _w_cte * CppAD::pow(vars[_cte_start + i] - _ref_cte, 2); // cross deviation error
-              fg[0] += _w_etheta * CppAD::pow(vars[_etheta_start + i] - _ref_etheta, 2); // heading error
-              fg[0] += _w_vel * CppAD::pow(vars[_v_start + i] - _ref_vel, 2); // speed error
+                c[i] = _coeff_start < 0 ? Scalar(coeffs[i]) : vars[_coeff_start + i];
+            }
 
-              cost_cte +=  _w_cte * CppAD::pow(vars[_cte_start + i] - _ref_cte, 2);
-              cost_etheta +=  (_w_etheta * CppAD::pow(vars[_etheta_start + i] - _ref_etheta, 2)); 
-              cost_vel +=  (_w_vel * CppAD::pow(vars[_v_start + i] - _ref_vel, 2)); 
+            // Tracking errors, variables unless the state is reduced
+            Vector cte(_mpc_steps), etheta(_mpc_steps);
+            if (_reduced)
+            {
+                Errors(vars, c, p[ModelParams::DT], cte, etheta);
+            }
+            else
+            {
+                for (int i = 0; i < _mpc_steps; i++)
+                {
+                    cte[i] = vars[_cte_start + i];
+                    etheta[i] = vars[_etheta_start + i];
+                }
+            }
+
+            for (int i = 0; i < _mpc_steps; i++) 
+            {
+              fg[0] += p[ModelParams::W_CTE] * CppAD::pow(cte[i] - p[ModelParams::REF_CTE], 2); // cross deviation error
+              fg[0] += p[ModelParams::W_EPSI] * CppAD::pow(etheta[i] - p[ModelParams::REF_ETHETA], 2); // heading error
+              fg[0] += p[ModelParams::W_V] * CppAD::pow(vars[_v_start + i] - refSpeed(vars, p, i), 2); // speed error
+            }
+            if (_terminal)
+            {
+                const int last = _mpc_steps - 1;
+                fg[0] += TerminalCost(p, cte[last], etheta[last], vars[_v_start + last]);
             }
-            cout << "-----------------------------------------------" <<endl;
-            cout << "cost_cte, etheta, velocity: " << cost_cte << ", " << cost_etheta  << ", " << cost_vel << endl;
-            
 
             // Minimize the use of actuators.
             for (int i = 0; i < _mpc_steps - 1; i++) {
-              fg[0] += _w_angvel * CppAD::pow(vars[_angvel_start + i], 2);
-              fg[0] += _w_accel * CppAD::pow(vars[_a_start + i], 2);
+              fg[0] += p[ModelParams::W_ANGVEL] * CppAD::pow(Input(vars, _angvel_start, i), 2);
+              fg[0] += p[ModelParams::W_A] * CppAD::pow(Input(vars, _a_start, i), 2);
             }
-            cout << "cost of actuators: " << fg[0] << endl; 
 
             // Minimize the value gap between sequential actuations.
             for (int i = 0; i < _mpc_steps - 2; i++) {
-              fg[0] += _w_angvel_d * CppAD::pow(vars[_angvel_start + i + 1] - vars[_angvel_start + i], 2);
-              fg[0] += _w_accel_d * CppAD::pow(vars[_a_start + i + 1] - vars[_a_start + i], 2);
+              fg[0] += p[ModelParams::W_DANGVEL] * CppAD::pow(Input(vars, _angvel_start, i + 1) - Input(vars, _angvel_start, i), 2);
+              fg[0] += p[ModelParams::W_DA] * CppAD::pow(Input(vars, _a_start, i + 1) - Input(vars, _a_start, i), 2);
+            }
+
+            // Keep the clearance: d is the obstacle distance of the step,
+            // linear in x, y, and only steps closer than CLEARANCE cost.
+            for (int i = 1; i < _obs_steps; i++)
+            {
+                Scalar d0 = _obs_start < 0 ? Scalar((*obstacles)[3 * i]) : vars[_obs_start + 3 * i];
+                Scalar dx = _obs_start < 0 ? Scalar((*obstacles)[3 * i + 1]) : vars[_obs_start + 3 * i + 1];
+                Scalar dy = _obs_start < 0 ? Scalar((*obstacles)[3 * i + 2]) : vars[_obs_start + 3 * i + 2];
+                Scalar gap = p[ModelParams::CLEARANCE] - (d0 + dx * vars[_x_start + i] + dy * vars[_y_start + i]);
+                fg[0] += p[ModelParams::W_OBS] * CppAD::CondExpGt(gap, Scalar(0), gap * gap, Scalar(0));
             }
-            cout << "cost of gap: " << fg[0] << endl; 
             
 
             // fg[x] for constraints
@@ -156,48 +837,33 @@ class FG_eval
             fg[1 + _y_start] = vars[_y_start];
             fg[1 + _theta_start] = vars[_theta_start];
             fg[1 + _v_start] = vars[_v_start];
-            fg[1 + _cte_start] = vars[_cte_start];
-            fg[1 + _etheta_start] = vars[_etheta_start];
+            if (!_reduced)
+            {
+                fg[1 + _cte_start] = cte[0];
+                fg[1 + _etheta_start] = etheta[0];
+            }
 
-            // Add system dynamic model constraint
-            for (int i = 0; i < _mpc_steps - 1; i++)
+            // Add system dynamic model constraint, as atomic steps or
+            // operation by operation
+            const bool checkpoint = checkpointDynamics(fg, vars, c, p[ModelParams::DT]);
+            for (int i = 0; i < _mpc_steps - 1 && !checkpoint; i++)
             {
                 // The state at time t+1 .
-                AD<double> x1 = vars[_x_start + i + 1];
-                AD<double> y1 = vars[_y_start + i + 1];
-                AD<double> theta1 = vars[_theta_start + i + 1];
-                AD<double> v1 = vars[_v_start + i + 1];
-                AD<double> cte1 = vars[_cte_start + i + 1];
-                AD<double> etheta1 = vars[_etheta_start + i + 1];
+                Scalar x1 = vars[_x_start + i + 1];
+                Scalar y1 = vars[_y_start + i + 1];
+                Scalar theta1 = vars[_theta_start + i + 1];
+                Scalar v1 = vars[_v_start + i + 1];
 
                 // The state at time t.
-                AD<double> x0 = vars[_x_start + i];
-                AD<double> y0 = vars[_y_start + i];
-                AD<double> theta0 = vars[_theta_start + i];
-                AD<double> v0 = vars[_v_start + i];
-                AD<double> cte0 = vars[_cte_start + i];
-                AD<double> etheta0 = vars[_etheta_start + i];
+                Scalar x0 = vars[_x_start + i];
+                Scalar y0 = vars[_y_start + i];
+                Scalar theta0 = vars[_theta_start + i];
+                Scalar v0 = vars[_v_start + i];
 
                 // Only consider the actuation at time t.
                 //AD<double> angvel0 = vars[_angvel_start + i];
-                AD<double> w0 = vars[_angvel_start + i];
-                AD<double> a0 = vars[_a_start + i];
-
-
-                //AD<double> f0 = coeffs[0] + coeffs[1] * x0 + coeffs[2] * CppAD::pow(x0, 2) + coeffs[3] * CppAD::pow(x0, 3);
-                AD<double> f0 = 0.0;
-                for (int i = 0; i < coeffs.size(); i++) 
-                {
-                    f0 += coeffs[i] * CppAD::pow(x0, i);
-                }
-
-                //AD<double> trj_grad0 = CppAD::atan(coeffs[1] + 2 * coeffs[2] * x0 + 3 * coeffs[3] * CppAD::pow(x0, 2));
-                AD<double> trj_grad0 = 0.0;
-                for (int i = 1; i < coeffs.size(); i++) 
-                {
-                    trj_grad0 += i*coeffs[i] * CppAD::pow(x0, i-1); // f'(x0)
-                }
-                trj_grad0 = CppAD::atan(trj_grad0);
+                Scalar w0 = Input(vars, _angvel_start, i);
+                Scalar a0 = Input(vars, _a_start, i);
 
 
                 // Here's `x` to get you started.
@@ -207,66 +873,1351 @@ class FG_eval
                 // This is also CppAD can compute derivatives and pass
                 // these to the solver.
                 // TODO: Setup the rest of the model constraints
-                fg[2 + _x_start + i] = x1 - (x0 + v0 * CppAD::cos(theta0) * _dt);
-                fg[2 + _y_start + i] = y1 - (y0 + v0 * CppAD::sin(theta0) * _dt);
-                fg[2 + _theta_start + i] = theta1 - (theta0 +  w0 * _dt);
-                fg[2 + _v_start + i] = v1 - (v0 + a0 * _dt);
-                
-                fg[2 + _cte_start + i] = cte1 - ((f0 - y0) + (v0 * CppAD::sin(etheta0) * _dt));
-                fg[2 + _etheta_start + i] = etheta1 - ((theta0 - trj_grad0) + w0 * _dt);
+                Scalar dt = stepDt(p[ModelParams::DT], i);
+                Scalar xp, yp, thetap, vp;
+                integrator::Step(_integrator, dt, x0, y0, theta0, v0, w0, a0, xp, yp, thetap, vp);
+                fg[2 + _x_start + i] = x1 - xp;
+                fg[2 + _y_start + i] = y1 - yp;
+                fg[2 + _theta_start + i] = theta1 - thetap;
+                fg[2 + _v_start + i] = v1 - vp;
+                if (_reduced)
+                {
+                    continue;
+                }
+
+                Scalar cte1, etheta1;
+                errorStep(c, i, dt, x0, y0, theta0, v0, w0, x1, y1, theta1, etheta[i], cte1, etheta1);
+                fg[2 + _cte_start + i] = cte[i + 1] - cte1;
+                fg[2 + _etheta_start + i] = etheta[i + 1] - etheta1;
             }
-        }
-};
 
-// ====================================
-// MPC class definition implementation.
-// ====================================
-MPC::MPC() 
-{
-    // Set default value    
-    _mpc_steps = 20;
-    _max_angvel = 3.0; // Maximal angvel radian (~30 deg)
-    _max_throttle = 1.0; // Maximal throttle accel
-    _bound_value  = 1.0e3; // Bound value for other variables
+            // Wheel torques driving a and angvel, see wheel_dynamics.h
+            if (_wheels.Enabled())
+            {
+                const int row = 1 + 6 * _mpc_steps, n = _mpc_steps - 1;
+                fg[row + n] = vars[_angvel_start];
+                for (int i = 0; i < n; i++)
+                {
+                    Scalar right = vars[_torque_start + i];
+                    Scalar left = vars[_torque_start + n + i];
+                    Scalar w0 = vars[_angvel_start + i];
+                    Scalar w1 = i + 1 < n ? vars[_angvel_start + i + 1] : w0;
+                    fg[row + i] = vars[_a_start + i] - _wheels.Accel(vars[_v_start + i], right, left);
+                    fg[row + n + 1 + i] = w1 - (w0 + _wheels.AngAccel(w0, right, left) * stepDt(p[ModelParams::DT], i));
+                }
+            }
 
-    _x_start     = 0;
-    _y_start     = _x_start + _mpc_steps;
-    _theta_start   = _y_start + _mpc_steps;
-    _v_start     = _theta_start + _mpc_steps;
-    _cte_start   = _v_start + _mpc_steps;
-    _etheta_start  = _cte_start + _mpc_steps;
-    _angvel_start = _etheta_start + _mpc_steps;
-    _a_start     = _angvel_start + _mpc_steps - 1;
+            // Soft bounds, see _soft. The torque model keeps one input per
+            // step, so the a blocks follow the angvel blocks like the slacks.
+            const int n_slacks = NumSlacks();
+            if (n_slacks > 0)
+            {
+                const int row = 1 + 6 * _mpc_steps + NumTorqueRows();
+                for (int i = 0; i < n_slacks; i++)
+                {
+                    Scalar u = vars[_angvel_start + i];
+                    Scalar slack = vars[_slack_start + i];
+                    fg[0] += _w_slack * slack;
+                    fg[row + 2 * i] = u + slack;
+                    fg[row + 2 * i + 1] = u - slack;
+                }
+            }
 
-}
+            // Corridor rows, a_x * x + a_y * y - b <= 0
+            const int cor_row = 1 + 6 * _mpc_steps + NumTorqueRows() + NumSlackRows();
+            const int n_faces = 3 * _cor_faces;
+            for (int i = 1; i < _cor_steps; i++)
+            {
+                for (int k = 0; k < _cor_faces; k++)
+                {
+                    const int j = n_faces * i + 3 * k;
+                    Scalar ax = _cor_start < 0 ? Scalar((*corridor)[j]) : vars[_cor_start + j];
+                    Scalar ay = _cor_start < 0 ? Scalar((*corridor)[j + 1]) : vars[_cor_start + j + 1];
+                    Scalar b = _cor_start < 0 ? Scalar((*corridor)[j + 2]) : vars[_cor_start + j + 2];
+                    fg[cor_row + _cor_faces * (i - 1) + k] = ax * vars[_x_start + i] + ay * vars[_y_start + i] - b;
+                }
+            }
+        }
+};
 
-void MPC::LoadParams(const std::map<string, double> &params)
+// Condensed (single shooting) form of FG_eval: only the inputs are
+// variables, vars = [angvel blocks | a blocks], and the states are rolled
+// out from the initial state, so there are no constraints. The cost is the
+// one of FG_eval at the rolled out states.
+class CondensedFG_eval : public FG_eval
 {
-    _params = params;
-    //Init parameters for MPC object
-    _mpc_steps = _params.find("STEPS") != _params.end() ? _params.at("STEPS") : _mpc_steps;
-    _max_angvel = _params.find("ANGVEL") != _params.end() ? _params.at("ANGVEL") : _max_angvel;
-    _max_throttle = _params.find("MAXTHR") != _params.end() ? _params.at("MAXTHR") : _max_throttle;
-    _bound_value  = _params.find("BOUND") != _params.end()  ? _params.at("BOUND") : _bound_value;
-    
-    _x_start     = 0;
-    _y_start     = _x_start + _mpc_steps;
-    _theta_start   = _y_start + _mpc_steps;
-    _v_start     = _theta_start + _mpc_steps;
-    _cte_start   = _v_start + _mpc_steps;
-    _etheta_start  = _cte_start + _mpc_steps;
-    _angvel_start = _etheta_start + _mpc_steps;
-    _a_start     = _angvel_start + _mpc_steps - 1;
+    public:
+        // Initial state x, y, theta, v, cte, etheta
+        Eigen::VectorXd state;
+        // Index of the state and then coeffs in vars when recording for
+        // TapeSolver, -1 to use state and coeffs (the values follow them
+        // at _value_start)
+        int _state_start;
 
-    cout << "\n!! MPC Obj parameters updated !! " << endl; 
-}
+        CondensedFG_eval(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs)
+            : FG_eval(coeffs), state(state), _state_start(-1)
+        {
+        }
 
+        std::string ModelName(int n_coeffs) const
+        {
+            return "mpc_condensed" + FG_eval::ModelName(n_coeffs).substr(3);
+        }
 
-vector<double> MPC::Solve(Eigen::VectorXd state, Eigen::VectorXd coeffs) 
-{
-    bool ok = true;
-    size_t i;
-    typedef CPPAD_TESTVECTOR(double) Dvector;
+        // States of the inputs in the layout of FG_eval (s[_x_start + i], ...)
+        template <class Vector>
+        void Rollout(const Vector &vars, Vector &s) const
+        {
+            typedef typename Vector::value_type Scalar;
+            const int n_inputs = NumInputs();
+            s.resize(_mpc_steps * 6);
+            const int start[6] = {_x_start, _y_start, _theta_start, _v_start, _cte_start, _etheta_start};
+            for (int k = 0; k < 6; k++)
+            {
+                s[start[k]] = _state_start < 0 ? Scalar(state[k]) : vars[_state_start + k];
+            }
+            Vector c(coeffs.size());
+            for (int i = 0; i < coeffs.size(); i++)
+            {
+                c[i] = _state_start < 0 ? Scalar(coeffs[i]) : vars[_state_start + 6 + i];
+            }
+            Scalar p[ModelParams::NUM_VALUES];
+            Params(vars, p);
+
+            // Same model as the constraints of FG_eval
+            for (int i = 0; i < _mpc_steps - 1; i++)
+            {
+                Scalar x0 = s[_x_start + i];
+                Scalar y0 = s[_y_start + i];
+                Scalar theta0 = s[_theta_start + i];
+                Scalar v0 = s[_v_start + i];
+                Scalar etheta0 = s[_etheta_start + i];
+                Scalar w0 = Input(vars, 0, i);
+                Scalar a0 = Input(vars, n_inputs, i);
+                Scalar dt = stepDt(p[ModelParams::DT], i);
+
+                integrator::Step(_integrator, dt, x0, y0, theta0, v0, w0, a0, s[_x_start + i + 1], s[_y_start + i + 1],
+                                 s[_theta_start + i + 1], s[_v_start + i + 1]);
+                errorStep(c, i, dt, x0, y0, theta0, v0, w0, s[_x_start + i + 1], s[_y_start + i + 1],
+                          s[_theta_start + i + 1], etheta0, s[_cte_start + i + 1], s[_etheta_start + i + 1]);
+            }
+        }
+
+        template <class Vector>
+        void operator()(Vector& fg, const Vector& vars)
+        {
+            typedef typename Vector::value_type Scalar;
+            const int n_inputs = NumInputs();
+            Vector s;
+            Rollout(vars, s);
+            Scalar p[ModelParams::NUM_VALUES];
+            Params(vars, p);
+
+            fg[0] = 0;
+            for (int i = 0; i < _mpc_steps; i++)
+            {
+                fg[0] += p[ModelParams::W_CTE] * CppAD::pow(s[_cte_start + i] - p[ModelParams::REF_CTE], 2);
+                fg[0] += p[ModelParams::W_EPSI] * CppAD::pow(s[_etheta_start + i] - p[ModelParams::REF_ETHETA], 2);
+                fg[0] += p[ModelParams::W_V] * CppAD::pow(s[_v_start + i] - p[ModelParams::REF_V], 2);
+            }
+            if (_terminal)
+            {
+                const int last = _mpc_steps - 1;
+                fg[0] += TerminalCost(p, s[_cte_start + last], s[_etheta_start + last], s[_v_start + last]);
+            }
+            for (int i = 0; i < _mpc_steps - 1; i++)
+            {
+                fg[0] += p[ModelParams::W_ANGVEL] * CppAD::pow(Input(vars, 0, i), 2);
+                fg[0] += p[ModelParams::W_A] * CppAD::pow(Input(vars, n_inputs, i), 2);
+            }
+            for (int i = 0; i < _mpc_steps - 2; i++)
+            {
+                fg[0] += p[ModelParams::W_DANGVEL] * CppAD::pow(Input(vars, 0, i + 1) - Input(vars, 0, i), 2);
+                fg[0] += p[ModelParams::W_DA] * CppAD::pow(Input(vars, n_inputs, i + 1) - Input(vars, n_inputs, i), 2);
+            }
+        }
+};
+
+// FG_eval recorded on N lanes, domain [vars | coeffs], see MPC::EvaluateFG()
+template <size_t N>
+class BatchTape
+{
+    public:
+        // Before a second thread may record on simd_double, as
+        // cppad_parallel::Setup() does for double
+        static void Setup()
+        {
+            static std::once_flag once;
+            std::call_once(once, [] { CppAD::parallel_ad<simd_double<N> >(); });
+        }
+
+        void Evaluate(FG_eval &fg_eval, size_t n_vars, size_t n_fg, const Eigen::VectorXd &coeffs,
+                      const std::vector<std::vector<double> > &points, std::vector<std::vector<double> > &fg)
+        {
+            const std::string name = fg_eval.ModelName(coeffs.size());
+            if (name != _name)
+            {
+                record(fg_eval, n_vars + coeffs.size(), n_fg);
+                _name = name;
+            }
+            for (int k = 0; k < coeffs.size(); k++)
+            {
+                _x[n_vars + k] = coeffs[k];
+            }
+            // The lanes past the last point repeat it
+            for (size_t begin = 0; begin < points.size(); begin += N)
+            {
+                for (size_t l = 0; l < N; l++)
+                {
+                    const std::vector<double> &point = points[std::min(begin + l, points.size() - 1)];
+                    for (size_t i = 0; i < n_vars; i++)
+                    {
+                        _x[i][l] = point[i];
+                    }
+                }
+                _fg = _fun.Forward(0, _x);
+                for (size_t l = 0; l < N && begin + l < points.size(); l++)
+                {
+                    std::vector<double> &out = fg[begin + l];
+                    out.resize(n_fg);
+                    for (size_t i = 0; i < n_fg; i++)
+                    {
+                        out[i] = _fg[i][l];
+                    }
+                }
+            }
+        }
+
+    private:
+        std::string _name; // FG_eval::ModelName() of the recording
+        CppAD::ADFun<simd_double<N> > _fun;
+        CPPAD_TESTVECTOR(simd_double<N>) _x, _fg;
+
+        void record(FG_eval &fg_eval, size_t n, size_t n_fg)
+        {
+            typedef CPPAD_TESTVECTOR(AD<simd_double<N> >) ADvector;
+            ADvector x(n), fg(n_fg);
+            for (size_t i = 0; i < n; i++)
+            {
+                x[i] = 0.0;
+            }
+            // Another horizon or weights, usually of similar size
+            CppAD::RecordReserve<simd_double<N> >(_fun.size_op(), _fun.size_op_arg(), _fun.size_par());
+            CppAD::Independent(x);
+            fg_eval(fg, x);
+            _fun.Dependent(x, fg);
+            _x.resize(n);
+        }
+};
+
+struct MPC::BatchTapes
+{
+    BatchTape<1> one;
+    BatchTape<4> four;
+    BatchTape<8> eight;
+};
+
+// ====================================
+// MPC class definition implementation.
+// ====================================
+// Everything a recording reads, copied on the thread of the solves so that
+// the TapeBuilder threads leave the MPC alone, see MPC::tapeRecipe()
+struct TapeRecipe
+{
+    std::map<string, double> params;
+    std::vector<int> blocks;
+    TapeLayout layout;
+    bool gauss_newton, const_jacobian, single_precision, split, hessian_stages;
+    int optimize, jacobian_method;
+    std::shared_ptr<WorkStealingPool> pool;
+    std::string codegen_library;
+    StepModel *step; // CHECKPOINT, NULL to record the dynamics operation by operation
+};
+
+// Float copy of a recorded tape when PRECISION=1
+template <class Eval>
+static void recordSingle(TapeSolver &tape_solver, const TapeRecipe &recipe, Eval &eval)
+{
+    if (recipe.single_precision && !tape_solver.RecordSingle(eval))
+    {
+        cout << "MPC: the float tape does not match the model, derivatives stay double" << endl;
+    }
+}
+
+// Cost and constraint tapes when SPLIT_TAPE=1
+template <class Eval>
+static void recordSplit(TapeSolver &tape_solver, const TapeRecipe &recipe, Eval &eval)
+{
+    // Only the reverse Jacobian on the double tape sweeps them
+    if (!recipe.split || tape_solver.IsSingle() || recipe.jacobian_method != 0)
+    {
+        return;
+    }
+    if (!tape_solver.RecordSplit(eval))
+    {
+        cout << "MPC: the split tapes do not match the model, using the whole tape" << endl;
+    }
+}
+
+// One StageHessian kind per step length, the last step has a kind of its
+// own for its cost terms. The workers of pool record their copies later, so
+// the kinds keep a copy of eval.
+static void recordStages(TapeSolver &tape_solver, const FG_eval &eval, int n_coeffs,
+                         const std::shared_ptr<WorkStealingPool> &pool)
+{
+    typedef StageHessian::ADvector ADvector;
+    std::shared_ptr<StageHessian> stages = std::make_shared<StageHessian>();
+    std::map<std::pair<double, bool>, size_t> kinds;
+    size_t n_z = 16 + (eval._reference ? 3 : n_coeffs);
+    n_z += eval._value_start >= 0 ? ModelParams::NUM_VALUES : 0;
+    const int last = eval._mpc_steps - 2;
+    for (int i = 0; i <= last; i++)
+    {
+        const std::pair<double, bool> key(eval.dt(i), i == last);
+        if (kinds.find(key) == kinds.end())
+        {
+            kinds[key] = stages->AddKind(n_z, 16, 7, [eval, i](ADvector &h, const ADvector &z) { eval.Stage(h, z, i); });
+        }
+        stages->AddStage(kinds[key], eval.StageSources(i, n_coeffs), eval.StageRows(i));
+    }
+    stages->SetThreads(pool);
+    if (!tape_solver.SetStages(stages))
+    {
+        cout << "MPC: the stage Hessian does not match the tape, using the whole tape" << endl;
+    }
+}
+
+// Record the model of recipe into tape_solver, on any thread. The
+// parameters of each layout are listed in MPC::numParams().
+static double recordRecipe(TapeSolver &tape_solver, const TapeRecipe &recipe)
+{
+    const TapeLayout &layout = recipe.layout;
+    const int n_coeffs = layout.n_coeffs;
+    const size_t n_values = layout.values ? ModelParams::NUM_VALUES : 0;
+    // The obstacle term is not a sum of squares
+    tape_solver.SetGaussNewton(recipe.gauss_newton && !layout.obstacles);
+    tape_solver.SetOptimize(recipe.optimize);
+    tape_solver.SetConstantJacobian(recipe.const_jacobian);
+    if (layout.condensed)
+    {
+        // Domain [inputs | state | coeffs | values], no constraints
+        CondensedFG_eval condensed_eval(Eigen::VectorXd::Zero(6), Eigen::VectorXd::Zero(n_coeffs));
+        condensed_eval.LoadParams(recipe.params);
+        condensed_eval.SetMoveBlocks(recipe.blocks);
+        condensed_eval._reference = layout.reference;
+        const size_t n_inputs = condensed_eval.NumInputs() * 2;
+        condensed_eval._state_start = n_inputs;
+        if (layout.values)
+        {
+            condensed_eval._value_start = n_inputs + 6 + n_coeffs;
+        }
+
+        const std::chrono::steady_clock::time_point record_begin = std::chrono::steady_clock::now();
+        tape_solver.Record(n_inputs, 0, 6 + n_coeffs + n_values, condensed_eval);
+        recordSingle(tape_solver, recipe, condensed_eval);
+        recordSplit(tape_solver, recipe, condensed_eval);
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - record_begin).count();
+    }
+    if (layout.reduced)
+    {
+        // Domain [reduced vars | coeffs | cte | etheta | values]
+        FG_eval reduced_eval(Eigen::VectorXd::Zero(n_coeffs));
+        reduced_eval.LoadParams(recipe.params);
+        reduced_eval.SetMoveBlocks(recipe.blocks);
+        reduced_eval.SetReduced(0, 0);
+        reduced_eval._reference = layout.reference;
+        const size_t n_vars = reduced_eval._mpc_steps * 4 + reduced_eval.NumInputs() * 2;
+        reduced_eval._coeff_start = n_vars;
+        if (layout.values)
+        {
+            reduced_eval._value_start = n_vars + n_coeffs + 2;
+        }
+
+        const std::chrono::steady_clock::time_point record_begin = std::chrono::steady_clock::now();
+        tape_solver.Record(n_vars, reduced_eval._mpc_steps * 4, n_coeffs + 2 + n_values, reduced_eval);
+        recordSingle(tape_solver, recipe, reduced_eval);
+        recordSplit(tape_solver, recipe, reduced_eval);
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - record_begin).count();
+    }
+
+    // Domain [vars | coeffs | values | obstacles | corridor | speeds]
+    FG_eval tape_eval(Eigen::VectorXd::Zero(n_coeffs));
+    tape_eval.LoadParams(recipe.params);
+    tape_eval.SetMoveBlocks(recipe.blocks);
+    tape_eval._reference = layout.reference;
+    const int steps = tape_eval._mpc_steps;
+    const size_t n_vars = steps * 6 + tape_eval.NumInputs() * 2 + tape_eval.NumTorques() + tape_eval.NumSlacks();
+    size_t n_params = n_coeffs;
+    tape_eval._coeff_start = n_vars;
+    if (layout.values)
+    {
+        tape_eval._value_start = n_vars + n_params;
+        n_params += n_values;
+    }
+    if (layout.obstacles)
+    {
+        tape_eval._obs_steps = steps;
+        tape_eval._obs_start = n_vars + n_params;
+        n_params += 3 * steps;
+    }
+    if (layout.corridor_faces > 0)
+    {
+        tape_eval._cor_steps = steps;
+        tape_eval._cor_faces = layout.corridor_faces;
+        tape_eval._cor_start = n_vars + n_params;
+        n_params += 3 * layout.corridor_faces * steps;
+    }
+    if (layout.speeds)
+    {
+        tape_eval._speed_steps = steps;
+        tape_eval._speed_start = n_vars + n_params;
+        n_params += steps;
+    }
+    const size_t n_constraints = steps * 6 + tape_eval.NumTorqueRows() + tape_eval.NumSlackRows()
+                                 + tape_eval.NumCorridorRows();
+    // The StepModel of these coefficients, prepared on the recording thread
+    if (recipe.step && tape_eval.Checkpointable() && recipe.step->NumInputs() == StepModel::COEFFS + (size_t)n_coeffs)
+    {
+        recipe.step->Prepare();
+        tape_eval._step = recipe.step;
+    }
+
+    const std::chrono::steady_clock::time_point record_begin = std::chrono::steady_clock::now();
+    // The generated models take the coefficients alone
+    const bool generated = !recipe.codegen_library.empty() && n_params == (size_t)n_coeffs;
+    if (!generated
+        || !tape_solver.LoadGenerated(recipe.codegen_library, tape_eval.ModelName(n_coeffs),
+                                      n_vars, n_constraints, n_coeffs))
+    {
+        if (generated)
+        {
+            cout << "MPC: no " << tape_eval.ModelName(n_coeffs) << " in " << recipe.codegen_library
+                 << ", recording the CppAD tape" << endl;
+        }
+        tape_solver.Record(n_vars, n_constraints, n_params, tape_eval);
+        recordSingle(tape_solver, recipe, tape_eval);
+        recordSplit(tape_solver, recipe, tape_eval);
+        // The stages have neither the obstacle term nor the speed reference
+        if (recipe.hessian_stages && !tape_eval._wheels.Enabled() && !tape_eval._spline.Enabled()
+            && !layout.obstacles && !layout.speeds)
+        {
+            recordStages(tape_solver, tape_eval, n_coeffs, recipe.pool);
+        }
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - record_begin).count();
+}
+
+MPC::MPC() 
+{
+    // Other solvers of the process may run on other threads
+    cppad_parallel::Setup();
+    // Before a second thread may use CppAD, see PolyRefAtomic::Get()
+    PolyRefAtomic::Get(4);
+    StepModel::Get(4, true);
+    StepModel::Get(4, false);
+    BatchTape<1>::Setup();
+    BatchTape<4>::Setup();
+    BatchTape<8>::Setup();
+
+    // Set default value    
+    _mpc_steps = 20;
+    _max_angvel = 3.0; // Maximal angvel radian (~30 deg)
+    _max_throttle = 1.0; // Maximal throttle accel
+    _bound_value  = 1.0e3; // Bound value for other variables
+    _persistent_tape = false; // Record FG_eval once and reuse the tape
+    _tape_stale = false;
+    _warm_start = false; // Seed Ipopt with the shifted previous solution
+    _pursuit_seed = false; // Zero inputs when there is no previous solution
+    _rti = false; // One SQP step per cycle instead of a full Ipopt solve
+    _sensitivity = false; // No input gains along the solution
+    _analytic = false; // Hand-written derivatives instead of CppAD
+    _hessian_mode = 0; // 0 exact, 1 Gauss-Newton, 2 limited-memory
+    _tape_optimize = tape_optimize::STRAIGHT_LINE;
+    _taylor_capacity = -1;
+    _sparsity = sparsity_patterns::AUTO;
+    _input_stop = 0;
+    _input_stop_tol = 1e-3;
+    _input_stop_iters = 2;
+    _scaling = false;
+    _scaling_stale = true;
+    _jacobian_method = 0;
+    _hessian_coloring = 0;
+    _hessian_reuse = 0;
+    _hessian_reuse_step = 0.05;
+    _hessian_reuse_lambda = 0.1;
+    _linear_solver = linear_solver::DEFAULT;
+    _linear_order = -1;
+    _single_precision = false;
+    _split_tape = false;
+    _const_jacobian = false;
+    _hessian_stages = false;
+    _hessian_threads = 1;
+    _spline_points = 0; // One input per step, or per block
+    _condensed = false; // Multiple shooting, states are variables
+    _newton = false; // Ipopt, or the backend of the flags above
+    _reduced = false; // cte and etheta are variables too
+    _soft = false; // angvel and a bounds of the torque model are hard
+    _terminal = false; // The last step has the stage weights
+    _terminal_cte = 0;
+    _terminal_etheta = 0;
+    _tape_reference = false;
+    _tape_layout = tapeLayout(4, false, false, 0, false);
+    _vehicle_model = vehicle_model::NONE; // The unicycle and torque models of FG_eval
+    _remote_timeout = 0.03;
+    _path_heading = true; // etheta against the path heading
+    _analytic_solver.SetPathHeading(_path_heading);
+    _multi_start.SetPathHeading(_path_heading);
+    _checkpoint = false; // The dynamics operation by operation
+    _w_obs = 1000;
+    _corridor_faces = 0;
+
+    _mpc_totalcost = 0;
+    _mpc_ctecost = 0;
+    _mpc_ethetacost = 0;
+    _mpc_velcost = 0;
+    _mpc_status = CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)>::unknown;
+    _mpc_iterations = -1;
+    _mpc_predicted_ms = 0.0;
+    _mpc_params_version = 0;
+    _mpc_tape_ms = 0;
+    _mpc_fallback = false;
+    _mpc_feasible = false;
+    _mpc_slack = 0;
+    _deadline = 0;
+    _tol_scale = 1.0;
+    _fallbacks = 0;
+    _horizon_index = -1;
+    _mpc_dt = 0.1;
+    _mpc_phase = -1;
+    _mpc_remote = false;
+    _mpc_remote_rtt_ms = 0;
+    _mpc_cancelled = false;
+    _cancel.store(false);
+
+    updateIndices();
+
+}
+
+void MPC::LoadParams(const std::map<string, double> &params)
+{
+    _params = params;
+    _mpc_params_version++;
+    // Horizon and candidate of the current tapes
+    const int steps = _mpc_steps;
+    const int horizon_index = _horizon_index;
+    //Init parameters for MPC object
+    _mpc_steps = _params.find("STEPS") != _params.end() ? _params.at("STEPS") : _mpc_steps;
+    _max_angvel = _params.find("ANGVEL") != _params.end() ? _params.at("ANGVEL") : _max_angvel;
+    _max_throttle = _params.find("MAXTHR") != _params.end() ? _params.at("MAXTHR") : _max_throttle;
+    _bound_value  = _params.find("BOUND") != _params.end()  ? _params.at("BOUND") : _bound_value;
+    _persistent_tape = _params.find("TAPE") != _params.end()  ? _params.at("TAPE") : _persistent_tape;
+    _warm_start = _params.find("WARM") != _params.end()  ? _params.at("WARM") : _warm_start;
+    _pursuit_seed = _params.find("PURSUIT_SEED") != _params.end()  ? _params.at("PURSUIT_SEED") : _pursuit_seed;
+    _rti = _params.find("RTI") != _params.end()  ? _params.at("RTI") : _rti;
+    _rti_solver.LoadParams(_params);
+    _rti = _rti || _rti_solver.Sparse(); // LTV solves the rti linearization as a sparse QP
+    _sensitivity = _params.find("SENSITIVITY") != _params.end()  ? _params.at("SENSITIVITY") : _sensitivity;
+    _analytic = _params.find("ANALYTIC") != _params.end()  ? _params.at("ANALYTIC") : _analytic;
+    _analytic_solver.LoadParams(_params);
+    _hessian_mode = _params.find("HESSIAN") != _params.end()  ? _params.at("HESSIAN") : _hessian_mode;
+    _tape_optimize = _params.find("OPTIMIZE") != _params.end()  ? _params.at("OPTIMIZE") : _tape_optimize;
+    _taylor_capacity = _params.find("TAYLOR_CAPACITY") != _params.end()  ? _params.at("TAYLOR_CAPACITY") : _taylor_capacity;
+    _sparsity = _params.find("SPARSITY") != _params.end()  ? _params.at("SPARSITY") : _sparsity;
+    _input_stop = _params.find("INPUT_STOP") != _params.end()  ? _params.at("INPUT_STOP") : _input_stop;
+    _input_stop_tol = _params.find("INPUT_STOP_TOL") != _params.end()  ? _params.at("INPUT_STOP_TOL") : _input_stop_tol;
+    _input_stop_iters = _params.find("INPUT_STOP_ITERS") != _params.end()  ? _params.at("INPUT_STOP_ITERS") : _input_stop_iters;
+    _scaling = _params.find("SCALING") != _params.end()  ? _params.at("SCALING") : _scaling;
+    _jacobian_method = _params.find("JACOBIAN") != _params.end()  ? _params.at("JACOBIAN") : _jacobian_method;
+    _hessian_coloring = _params.find("HESSIAN_COLORING") != _params.end()  ? _params.at("HESSIAN_COLORING") : _hessian_coloring;
+    _hessian_reuse = _params.find("HESSIAN_REUSE") != _params.end()  ? _params.at("HESSIAN_REUSE") : _hessian_reuse;
+    _hessian_reuse_step = _params.find("HESSIAN_REUSE_STEP") != _params.end()  ? _params.at("HESSIAN_REUSE_STEP") : _hessian_reuse_step;
+    _hessian_reuse_lambda = _params.find("HESSIAN_REUSE_LAMBDA") != _params.end()  ? _params.at("HESSIAN_REUSE_LAMBDA") : _hessian_reuse_lambda;
+    _linear_solver = _params.find("LINEAR_SOLVER") != _params.end()  ? _params.at("LINEAR_SOLVER") : _linear_solver;
+    _linear_order = _params.find("LINEAR_ORDER") != _params.end()  ? _params.at("LINEAR_ORDER") : _linear_order;
+    _single_precision = _params.find("PRECISION") != _params.end()  ? _params.at("PRECISION") == 1 : _single_precision;
+    _split_tape = _params.find("SPLIT_TAPE") != _params.end()  ? _params.at("SPLIT_TAPE") : _split_tape;
+    _const_jacobian = _params.find("CONST_JACOBIAN") != _params.end()  ? _params.at("CONST_JACOBIAN") : _const_jacobian;
+    _hessian_stages = _params.find("HESSIAN_STAGES") != _params.end()  ? _params.at("HESSIAN_STAGES") : _hessian_stages;
+    _hessian_threads = _params.find("HESSIAN_THREADS") != _params.end()  ? _params.at("HESSIAN_THREADS") : _hessian_threads;
+    if (_hessian_threads <= 1)
+    {
+        _stage_pool.reset();
+    }
+    else if (_control_pool)
+    {
+        _stage_pool = _control_pool;
+    }
+    else if (!_stage_pool || _stage_pool->Size() != _hessian_threads - 1)
+    {
+        _stage_pool = std::make_shared<WorkStealingPool>(_hessian_threads - 1);
+    }
+    if (_params.find("LINEAR_THREADS") != _params.end())
+    {
+        linear_solver::SetThreads(_params.at("LINEAR_THREADS"));
+    }
+    _condensed = _params.find("CONDENSED") != _params.end()  ? _params.at("CONDENSED") : _condensed;
+    _newton = _params.find("NEWTON_KRYLOV") != _params.end()  ? _params.at("NEWTON_KRYLOV") : _newton;
+    _newton_solver.LoadParams(_params);
+    _reduced = _params.find("REDUCED") != _params.end()  ? _params.at("REDUCED") : _reduced;
+    _path_heading = _params.find("PATH_HEADING") != _params.end()  ? _params.at("PATH_HEADING") : _path_heading;
+    _checkpoint = _params.find("CHECKPOINT") != _params.end()  ? _params.at("CHECKPOINT") : _checkpoint;
+    _w_obs = _params.find("W_OBS") != _params.end()  ? _params.at("W_OBS") : _w_obs;
+    // The cost Hessian of the Gauss-Newton mode depends on the weights
+    if (_model.Load(_params))
+    {
+        resetGaussNewton();
+    }
+    _analytic_solver.SetGaussNewton(_hessian_mode == 1);
+    _analytic_solver.SetPathHeading(_path_heading);
+    _multi_start.LoadParams(_params);
+    _multi_start.SetPathHeading(_path_heading);
+    _wheels.LoadParams(_params);
+    _soft = _params.find("SOFT") != _params.end()  ? _params.at("SOFT") : _soft;
+    _spline_points = _params.find("INPUT_SPLINE") != _params.end()  ? _params.at("INPUT_SPLINE") : _spline_points;
+    _terminal = _params.find("TERMINAL") != _params.end()  ? _params.at("TERMINAL") : _terminal;
+    _terminal_cte = _params.find("TERMINAL_CTE") != _params.end()  ? _params.at("TERMINAL_CTE") : _terminal_cte;
+    _terminal_etheta = _params.find("TERMINAL_ETHETA") != _params.end()  ? _params.at("TERMINAL_ETHETA") : _terminal_etheta;
+    _remote_timeout = _params.find("REMOTE_TIMEOUT") != _params.end()  ? _params.at("REMOTE_TIMEOUT") : _remote_timeout;
+    const int vehicle = _params.find("VEHICLE_MODEL") != _params.end() ? _params.at("VEHICLE_MODEL") : _vehicle_model;
+    if (vehicle != _vehicle_model || (vehicle != vehicle_model::NONE && !_vehicle))
+    {
+        _vehicle = VehicleSolver::Create(vehicle);
+        _vehicle_model = _vehicle ? vehicle : vehicle_model::NONE;
+        if (_vehicle)
+        {
+            cout << "MPC: VEHICLE_MODEL " << _vehicle->Name() << " on its own tape, only STEPS, DT, the references,"
+                 << " the weights, the bounds and INTEGRATOR apply" << endl;
+        }
+        else if (vehicle != vehicle_model::NONE)
+        {
+            cout << "MPC: unknown VEHICLE_MODEL " << vehicle << ", using the unicycle model" << endl;
+        }
+    }
+    if (_vehicle)
+    {
+        _vehicle->LoadParams(_params);
+    }
+    if (_wheels.Enabled() && (_condensed || _reduced || _newton))
+    {
+        cout << "MPC: the torque model runs on the full layout, CONDENSED, REDUCED and NEWTON_KRYLOV are ignored" << endl;
+        _condensed = false;
+        _reduced = false;
+        _newton = false;
+    }
+    if (_checkpoint && ((_params.find("INTEGRATOR") != _params.end() && _params.at("INTEGRATOR") != integrator::EULER) || _condensed || _reduced))
+    {
+        cout << "MPC: CHECKPOINT records the Euler steps of the full layout, the dynamics are recorded"
+             << " operation by operation" << endl;
+    }
+
+    // Adaptive horizon: every candidate has its own tape, kept across
+    // LoadParams like the single one
+    if (horizon_index >= 0)
+    {
+        _horizon_tapes[horizon_index] = _tape_solver;
+        _horizon_stale[horizon_index] = _tape_stale;
+    }
+    _horizon.LoadParams(_params);
+    _policy.LoadParams(_params);
+    _predictor.LoadParams(_params);
+    _horizon.SetPredictor(_predictor.Enabled() ? &_predictor : NULL);
+    if (_horizon.Enabled() && !TimeGridSteps(_params, 2).empty())
+    {
+        cout << "MPC: the adaptive horizon picks a uniform dt, the time grid is ignored" << endl;
+        EraseTimeGrid(_params);
+    }
+    _mpc_dt = _params.find("DT") != _params.end() ? _params.at("DT") : _mpc_dt;
+    _horizon_index = -1;
+
+    updateIndices();
+    if (!_step_dt.empty() && (_rti || _analytic || _multi_start.Hypotheses() > 1))
+    {
+        cout << "MPC: the time grid runs on the CppAD model, rti, analytic and hypotheses are ignored" << endl;
+    }
+    if (_spline_points > 0 && !_spline.Enabled() && !_wheels.Enabled())
+    {
+        cout << "MPC: INPUT_SPLINE needs 4 to STEPS - 1 control points, one input per step" << endl;
+    }
+    else if (_spline.Enabled() && (_rti || _analytic || _newton || _multi_start.Hypotheses() > 1))
+    {
+        cout << "MPC: the input spline runs on the CppAD model, rti, analytic, newton and hypotheses are ignored" << endl;
+    }
+    if (_spline_points > 0 && _wheels.Enabled())
+    {
+        cout << "MPC: the torque model keeps one input per step, INPUT_SPLINE is ignored" << endl;
+    }
+
+    // P of the terminal cost, once per parameter change; the candidates of
+    // the adaptive horizon get theirs for their dt in horizonParams()
+    if (!_terminal)
+    {
+        EraseTerminalCost(_params);
+    }
+    else if (!SetTerminalCost(_params))
+    {
+        cout << "MPC: the LQR of the terminal cost does not converge for these weights and REF_V, TERMINAL is ignored" << endl;
+        _terminal = false;
+    }
+    else if (_rti || _analytic || _multi_start.Hypotheses() > 1)
+    {
+        cout << "MPC: the terminal cost runs on the CppAD model, rti, analytic and hypotheses are ignored" << endl;
+    }
+
+    // The values are parameters of the tapes (see model_params.h), the
+    // tapes stay unless something else changed. They are recorded again
+    // on the next solve, into the same TapeSolver so that the patterns and
+    // the Ipopt state survive unless the horizon changed.
+    const std::map<string, double> structure = tapeStructure(_params);
+    std::map<string, double> resized = _tape_structure;
+    resized["STEPS"] = _mpc_steps;
+    if (structure == _tape_structure)
+    {
+        // Drop a switch to another horizon, a tape of this one from
+        // Prepare() stays
+        if (_tape_builder.Busy() && _tape_builder.Id() != (unsigned long)_mpc_steps)
+        {
+            _tape_builder.Cancel();
+        }
+        if (_horizon.Enabled() && horizon_index >= 0)
+        {
+            // Same candidates, the solvers stay on the current one
+            _horizon_index = horizon_index;
+            _params = horizonParams(horizon_index);
+            _mpc_steps = _horizon.Candidates()[horizon_index].steps;
+            _mpc_dt = _horizon.Candidates()[horizon_index].dt;
+            _rti_solver.LoadParams(_params);
+            _analytic_solver.LoadParams(_params);
+            _newton_solver.LoadParams(_params);
+            _multi_start.LoadParams(_params);
+            updateIndices();
+        }
+    }
+    else if (resized == structure && !_horizon.Enabled() && tapeBackend() && _tape_solver
+             && _tape_solver->IsRecorded() && !_tape_stale && !_tape_reference && _tape_layout.values)
+    {
+        // A new horizon is recorded on the side, the solves go on with the
+        // current tape until it is ready, see takeTape()
+        startTapeBuild();
+        applySteps(steps);
+    }
+    else
+    {
+        cancelTapeBuilds();
+        _tape_stale = true;
+        _order_tapes.clear();
+        _horizon_tapes.resize(_horizon.Enabled() ? _horizon.Candidates().size() : 0);
+        _horizon_stale.assign(_horizon_tapes.size(), true);
+        _tape_structure = structure;
+    }
+
+    cout << "\n!! MPC Obj parameters updated !! " << endl; 
+}
+
+bool MPC::tapeBackend() const
+{
+    // The generated and compiled models are loaded on the thread of the solves
+    return _persistent_tape && !_rti && !_analytic && _multi_start.Hypotheses() <= 1 && !_newton && !_vehicle
+           && _codegen_library.empty() && !_jit;
+}
+
+void MPC::resetGaussNewton()
+{
+    if (_tape_solver)
+    {
+        _tape_solver->ResetGaussNewton();
+    }
+    for (size_t k = 0; k < _horizon_tapes.size(); k++)
+    {
+        if (_horizon_tapes[k])
+        {
+            _horizon_tapes[k]->ResetGaussNewton();
+        }
+    }
+}
+
+std::map<string, double> MPC::tapeStructure(const std::map<string, double> &params) const
+{
+    std::map<string, double> structure = params;
+    if (_codegen_library.empty() && !_jit)
+    {
+        for (int k = 0; k < ModelParams::NUM_VALUES; k++)
+        {
+            structure.erase(ModelParams::KEYS[k]);
+        }
+    }
+    return structure;
+}
+
+void MPC::applySteps(int steps)
+{
+    _params["STEPS"] = steps;
+    _mpc_steps = steps;
+    _rti_solver.LoadParams(_params);
+    _analytic_solver.LoadParams(_params);
+    _newton_solver.LoadParams(_params);
+    _multi_start.LoadParams(_params);
+    updateIndices();
+}
+
+void MPC::startTapeBuild()
+{
+    if (_tape_builder.Busy() && _tape_builder.Id() == (unsigned long)_mpc_steps)
+    {
+        return;
+    }
+    // Copies only, the builder thread must not read members of the solves
+    const TapeRecipe recipe = tapeRecipe(_params, _tape_layout);
+    _tape_builder.Start([recipe](TapeSolver &tape_solver) { recordRecipe(tape_solver, recipe); }, _mpc_steps);
+}
+
+void MPC::Prepare(int n_coeffs, bool obstacles, int corridor_faces, bool speeds)
+{
+    if (!tapeBackend())
+    {
+        return;
+    }
+    const TapeLayout layout = tapeLayout(n_coeffs, false, obstacles, corridor_faces, speeds);
+    if (!_horizon.Enabled())
+    {
+        if (!_tape_solver)
+        {
+            _tape_solver = std::make_shared<TapeSolver>();
+        }
+        if (!_tape_solver->IsRecorded() || _tape_stale)
+        {
+            _tape_layout = layout;
+            startTapeBuild();
+        }
+        return;
+    }
+
+    // One builder per candidate, they record in parallel
+    for (size_t k = _horizon_builders.size(); k < _horizon_tapes.size(); k++)
+    {
+        _horizon_builders.emplace_back(new TapeBuilder());
+    }
+    for (size_t k = 0; k < _horizon_tapes.size(); k++)
+    {
+        if (!_horizon_stale[k] || _horizon_builders[k]->Busy())
+        {
+            continue;
+        }
+        if (!_horizon_tapes[k])
+        {
+            _horizon_tapes[k] = std::make_shared<TapeSolver>();
+        }
+        const TapeRecipe recipe = tapeRecipe(horizonParams(k), layout);
+        _horizon_builders[k]->Start([recipe](TapeSolver &tape_solver) { recordRecipe(tape_solver, recipe); },
+                                    _horizon.Candidates()[k].steps);
+    }
+}
+
+bool MPC::takeHorizonTape(size_t index)
+{
+    double record_ms = 0;
+    if (index >= _horizon_builders.size() || !_horizon_builders[index]->Busy() || !_horizon_tapes[index])
+    {
+        return false;
+    }
+    _horizon_builders[index]->Wait();
+    if (!_horizon_builders[index]->Take(*_horizon_tapes[index], record_ms))
+    {
+        return false;
+    }
+    _horizon_stale[index] = false;
+    if ((int)index == _horizon_index)
+    {
+        _tape_stale = false;
+    }
+    return true;
+}
+
+void MPC::cancelTapeBuilds()
+{
+    _tape_builder.Cancel();
+    for (size_t k = 0; k < _horizon_builders.size(); k++)
+    {
+        _horizon_builders[k]->Cancel();
+    }
+}
+
+bool MPC::takeTape()
+{
+    double record_ms = 0;
+    if (!_tape_builder.Busy() || !_tape_solver || !_tape_builder.Take(*_tape_solver, record_ms))
+    {
+        return false;
+    }
+    applySteps(_tape_builder.Id());
+    _tape_structure = tapeStructure(_params);
+    _tape_stale = false;
+    _tape_reference = _tape_layout.reference;
+    _order_tapes.clear();
+    // The previous plan has the other horizon
+    _warm.Reset();
+    _fallbacks = 0;
+    cout << "MPC: " << _mpc_steps << " steps from the next solve, recorded in " << record_ms << " ms" << endl;
+    return true;
+}
+
+void MPC::AdoptWarmStart(const MPC &other)
+{
+    _warm = other._warm;
+    _warm.Resize(_mpc_steps);
+}
+
+void MPC::updateIndices()
+{
+    _x_start     = 0;
+    _y_start     = _x_start + _mpc_steps;
+    _theta_start   = _y_start + _mpc_steps;
+    _v_start     = _theta_start + _mpc_steps;
+    _cte_start   = _v_start + _mpc_steps;
+    _etheta_start  = _cte_start + _mpc_steps;
+    _angvel_start = _etheta_start + _mpc_steps;
+    _step_dt = TimeGridSteps(_params, _mpc_steps);
+    // As FG_eval::SetMoveBlocks()
+    _spline.Clear();
+    if (_spline_points > 0 && !_wheels.Enabled())
+    {
+        _spline.Set(_spline_points, _mpc_steps, _step_dt);
+    }
+    _block_of = _wheels.Enabled() || _spline.Enabled() ? std::vector<int>() : MoveBlockIndex(_move_blocks, _mpc_steps);
+    _n_inputs = _spline.Enabled() ? _spline.Points() : (_block_of.empty() ? _mpc_steps - 1 : _block_of.back() + 1);
+    _a_start     = _angvel_start + _n_inputs;
+    _scaling_stale = true;
+}
+
+void MPC::SetMoveBlocks(const std::vector<int> &blocks)
+{
+    if (blocks == _move_blocks)
+    {
+        return;
+    }
+    _move_blocks = blocks;
+    if (!_move_blocks.empty() && (_rti || _analytic || _newton || _multi_start.Hypotheses() > 1))
+    {
+        cout << "MPC: move blocking runs on the CppAD model, rti, analytic, newton and hypotheses are ignored" << endl;
+    }
+    if (!_move_blocks.empty() && _wheels.Enabled())
+    {
+        cout << "MPC: the torque model keeps one input per step, the blocks are ignored" << endl;
+    }
+    if (!_move_blocks.empty() && _spline.Enabled())
+    {
+        cout << "MPC: the inputs are the spline of INPUT_SPLINE, the blocks are ignored" << endl;
+    }
+    // A new layout of the variables, for the tapes and the stored plan. The
+    // STEPS of a background recording are recorded with it.
+    if (_tape_builder.Busy())
+    {
+        applySteps(_tape_builder.Id());
+        _tape_structure = tapeStructure(_params);
+    }
+    cancelTapeBuilds();
+    _tape_stale = true;
+    _order_tapes.clear();
+    _horizon_stale.assign(_horizon_stale.size(), true);
+    _warm.Reset();
+    updateIndices();
+}
+
+void MPC::expandInputs(const CPPAD_TESTVECTOR(double) &blocked, std::vector<double> &full) const
+{
+    const int angvel_start = _angvel_start, a_start = _angvel_start + _mpc_steps - 1;
+    full.resize(_mpc_steps * 6 + (_mpc_steps - 1) * 2);
+    if (blocked.size() != size_t(_mpc_steps * 6 + _n_inputs * 2))
+    {
+        return;
+    }
+    for (int i = 0; i < angvel_start; i++)
+    {
+        full[i] = blocked[i];
+    }
+    for (int i = 0; i < _mpc_steps - 1; i++)
+    {
+        full[angvel_start + i] = inputAt(blocked, _angvel_start, i);
+        full[a_start + i] = inputAt(blocked, _a_start, i);
+    }
+}
+
+void MPC::extendTorques(std::vector<double> &vars, std::vector<double> &zl, std::vector<double> &zu,
+                        std::vector<double> &lambda) const
+{
+    // The torques of the shifted accel and angvel, multipliers at zero
+    const int n = _mpc_steps - 1, torque_start = _a_start + n;
+    vars.resize(torque_start + 2 * n);
+    zl.resize(vars.size(), 0.0);
+    zu.resize(vars.size(), 0.0);
+    lambda.resize(_mpc_steps * 6 + 2 * _mpc_steps - 1, 0.0);
+    for (int i = 0; i < n; i++)
+    {
+        const double dt = _step_dt.empty() ? _mpc_dt : _step_dt[i];
+        const double w0 = vars[_angvel_start + i];
+        const double w1 = i + 1 < n ? vars[_angvel_start + i + 1] : w0;
+        _wheels.Torques(vars[_v_start + i], vars[_a_start + i], w0, w1, dt,
+                        vars[torque_start + i], vars[torque_start + n + i]);
+    }
+}
+
+void MPC::extendSlacks(std::vector<double> &vars, std::vector<double> &zl, std::vector<double> &zu,
+                       std::vector<double> &lambda) const
+{
+    // After extendTorques(), solve() sets the values from the inputs
+    vars.resize(vars.size() + numSlacks(), 0.0);
+    zl.resize(vars.size(), 0.0);
+    zu.resize(vars.size(), 0.0);
+    lambda.resize(lambda.size() + 2 * numSlacks(), 0.0);
+}
+
+void MPC::compressInputs(std::vector<double> &full) const
+{
+    const int a_start = _angvel_start + _mpc_steps - 1;
+    if (_spline.Enabled())
+    {
+        // Each point from the input of its step
+        const std::vector<double> per_step(full.begin() + _angvel_start, full.end());
+        for (int k = 0; k < _n_inputs; k++)
+        {
+            full[_angvel_start + k] = per_step[_spline.Sample(k)];
+            full[_a_start + k] = per_step[a_start - _angvel_start + _spline.Sample(k)];
+        }
+        full.resize(_mpc_steps * 6 + _n_inputs * 2);
+        return;
+    }
+    // In place: block b is written at or before the step it is read from
+    for (int i = 0; i < _mpc_steps - 1; i++)
+    {
+        if (i == 0 || input(i - 1) != input(i))
+        {
+            full[_angvel_start + input(i)] = full[_angvel_start + i];
+        }
+    }
+    for (int i = 0; i < _mpc_steps - 1; i++)
+    {
+        if (i == 0 || input(i - 1) != input(i))
+        {
+            full[_a_start + input(i)] = full[a_start + i];
+        }
+    }
+    full.resize(_mpc_steps * 6 + _n_inputs * 2);
+}
+
+std::map<string, double> MPC::horizonParams(int index) const
+{
+    std::map<string, double> params = _params;
+    params["STEPS"] = _horizon.Candidates()[index].steps;
+    params["DT"] = _horizon.Candidates()[index].dt;
+    if (_terminal)
+    {
+        SetTerminalCost(params);
+    }
+    return params;
+}
+
+void MPC::applyHorizon(int index)
+{
+    if (_horizon_index >= 0)
+    {
+        _horizon_tapes[_horizon_index] = _tape_solver;
+        _horizon_stale[_horizon_index] = _tape_stale;
+    }
+    _horizon_index = index;
+    _tape_solver = _horizon_tapes[index];
+    _tape_stale = _horizon_stale[index];
+
+    _params = horizonParams(index);
+    _mpc_steps = _horizon.Candidates()[index].steps;
+    _mpc_dt = _horizon.Candidates()[index].dt;
+    _rti_solver.LoadParams(_params);
+    _analytic_solver.LoadParams(_params);
+    _newton_solver.LoadParams(_params);
+    _multi_start.LoadParams(_params);
+    updateIndices();
+
+    // The previous plan is on another time grid
+    _warm.Reset();
+    _fallbacks = 0;
+}
+
+double MPC::horizonBudget() const
+{
+    return _deadline > 0 ? _deadline : 0.5 * _horizon.Candidates().front().dt;
+}
+
+TapeMemory MPC::Memory() const
+{
+    TapeMemory memory;
+    if (_tape_solver)
+    {
+        memory += _tape_solver->Memory();
+    }
+    for (size_t k = 0; k < _horizon_tapes.size(); k++)
+    {
+        // _tape_solver is one of them
+        if (_horizon_tapes[k] && _horizon_tapes[k] != _tape_solver)
+        {
+            memory += _horizon_tapes[k]->Memory();
+        }
+    }
+    for (size_t k = 0; k < _order_tapes.size(); k++)
+    {
+        memory += _order_tapes[k]->Memory();
+    }
+    return memory;
+}
+
+void MPC::useOrderTape(size_t n_vars, size_t n_params, bool reference)
+{
+    // Only a tape that is up to date is worth parking. The adaptive horizon
+    // keeps a tape per candidate already, and the JIT model follows the
+    // tape it was compiled for.
+    if (!_tape_solver || _tape_stale || _horizon.Enabled() || _jit)
+    {
+        return;
+    }
+    if (_tape_reference != reference)
+    {
+        // The parked tapes are of the other model
+        _order_tapes.clear();
+        return;
+    }
+    if (_tape_solver->NumVars() != n_vars || _tape_solver->NumParams() == n_params)
+    {
+        return;
+    }
+    for (size_t k = 0; k < _order_tapes.size(); k++)
+    {
+        if (_order_tapes[k]->NumParams() == n_params)
+        {
+            std::swap(_tape_solver, _order_tapes[k]);
+            return;
+        }
+    }
+    // First solve of this order: it is recorded into a TapeSolver of its own
+    _order_tapes.push_back(_tape_solver);
+    _tape_solver = std::make_shared<TapeSolver>();
+}
+
+std::shared_ptr<const SharedTape> MPC::ShareTape()
+{
+    if (!_tape_solver || _tape_stale)
+    {
+        return std::shared_ptr<const SharedTape>();
+    }
+    return _tape_solver->Share(_tape_reference ? 1 : 0);
+}
+
+bool MPC::UseSharedTape(const std::shared_ptr<const SharedTape> &tape)
+{
+    if (!tape || _horizon.Enabled())
+    {
+        return false;
+    }
+    if (!_tape_solver)
+    {
+        _tape_solver = std::make_shared<TapeSolver>();
+    }
+    _tape_solver->ShareFrom(tape);
+    _tape_solver->SetGaussNewton(_hessian_mode == 1);
+    _tape_stale = false;
+    _tape_reference = tape->Id() != 0;
+    return true;
+}
+
+bool MPC::WriteSnapshot(const std::string &path) const
+{
+    SolverSnapshot snapshot;
+    snapshot.params_hash = SolverSnapshot::HashParams(_params);
+    snapshot.params_version = _mpc_params_version;
+    snapshot.Capture(_tape_solver && !_tape_stale && !_horizon.Enabled() ? _tape_solver.get() : NULL, _warm);
+    return snapshot.Write(path);
+}
+
+bool MPC::ReadSnapshot(const std::string &path, double max_age)
+{
+    SolverSnapshot snapshot;
+    if (_horizon.Enabled() || !snapshot.Read(path) || snapshot.params_hash != SolverSnapshot::HashParams(_params))
+    {
+        return false;
+    }
+    if (snapshot.structure && _persistent_tape)
+    {
+        if (!_tape_solver)
+        {
+            _tape_solver = std::make_shared<TapeSolver>();
+        }
+        _tape_solver->AdoptStructure(snapshot.structure, snapshot.n_vars, snapshot.n_constraints, snapshot.n_params,
+                                     snapshot.size_var, snapshot.size_op, snapshot.hes_density);
+    }
+    if (snapshot.steps == _mpc_steps && SolverSnapshot::Now() - snapshot.stamp <= max_age)
+    {
+        _warm.Store(snapshot.steps, snapshot.x, snapshot.zl, snapshot.zu, snapshot.lambda);
+    }
+    return true;
+}
+
+void MPC::PlannedHorizon(double v, const Eigen::VectorXd &coeffs, int &steps, double &dt) const
+{
+    if (!_horizon.Enabled())
+    {
+        steps = _mpc_steps;
+        dt = _mpc_dt;
+        return;
+    }
+    const HorizonSelector::Horizon &horizon = _horizon.Candidates()[_horizon.Choose(v, coeffs, horizonBudget())];
+    steps = horizon.steps;
+    dt = horizon.dt;
+}
+
+void MPC::EvaluateFG(const Eigen::VectorXd &coeffs, const std::vector<std::vector<double> > &points,
+                     std::vector<std::vector<double> > &fg, int width)
+{
+    FG_eval fg_eval(Eigen::VectorXd::Zero(coeffs.size()));
+    fg_eval.LoadParams(_params);
+    fg_eval.SetMoveBlocks(_move_blocks);
+    const size_t n_vars = fg_eval._mpc_steps * 6 + fg_eval.NumInputs() * 2 + fg_eval.NumTorques() + fg_eval.NumSlacks();
+    const size_t n_fg = 1 + fg_eval._mpc_steps * 6 + fg_eval.NumTorqueRows() + fg_eval.NumSlackRows();
+    fg_eval._coeff_start = n_vars;
+
+    if (!_batch_tapes)
+    {
+        _batch_tapes = std::make_shared<BatchTapes>();
+    }
+    fg.resize(points.size());
+    if (width >= 8)
+    {
+        _batch_tapes->eight.Evaluate(fg_eval, n_vars, n_fg, coeffs, points, fg);
+    }
+    else if (width >= 4)
+    {
+        _batch_tapes->four.Evaluate(fg_eval, n_vars, n_fg, coeffs, points, fg);
+    }
+    else
+    {
+        _batch_tapes->one.Evaluate(fg_eval, n_vars, n_fg, coeffs, points, fg);
+    }
+}
+
+TapeLayout MPC::tapeLayout(int n_coeffs, bool reference, bool obstacles, int corridor_faces, bool speeds) const
+{
+    // The corridor rows are on the full layout only, a corridor that is
+    // set keeps it even while it is of another horizon
+    const bool full = corridor_faces > 0 || corridorSet();
+    TapeLayout layout;
+    layout.n_coeffs = n_coeffs;
+    layout.reference = reference;
+    layout.condensed = _condensed && !full;
+    layout.reduced = _reduced && !layout.condensed && !full;
+    // The generated and compiled models have the values as literals, see
+    // FG_eval::ModelName()
+    layout.values = _codegen_library.empty() && !_jit;
+    const bool features = !layout.condensed && !layout.reduced;
+    layout.obstacles = obstacles && features;
+    layout.corridor_faces = features ? corridor_faces : 0;
+    layout.speeds = speeds && features;
+    return layout;
+}
+
+size_t MPC::numParams(const TapeLayout &layout, int steps)
+{
+    // Full: [coeffs | values | obstacles | corridor | speeds], reduced:
+    // [coeffs | cte | etheta | values], condensed: [state | coeffs | values]
+    size_t n_params = layout.n_coeffs;
+    n_params += layout.condensed ? 6 : 0;
+    n_params += layout.reduced ? 2 : 0;
+    n_params += layout.values ? ModelParams::NUM_VALUES : 0;
+    n_params += layout.obstacles ? 3 * steps : 0;
+    n_params += 3 * layout.corridor_faces * steps;
+    n_params += layout.speeds ? steps : 0;
+    return n_params;
+}
+
+TapeRecipe MPC::tapeRecipe(const std::map<string, double> &params, const TapeLayout &layout) const
+{
+    TapeRecipe recipe;
+    recipe.params = params;
+    recipe.blocks = _move_blocks;
+    recipe.layout = layout;
+    recipe.gauss_newton = _hessian_mode == 1;
+    recipe.const_jacobian = _const_jacobian;
+    recipe.single_precision = _single_precision;
+    recipe.split = _split_tape;
+    recipe.hessian_stages = _hessian_stages;
+    recipe.optimize = _tape_optimize;
+    recipe.jacobian_method = _jacobian_method;
+    recipe.pool = _stage_pool;
+    recipe.codegen_library = _codegen_library;
+    // The atomic functions are created on this thread, see StepModel::Get()
+    const bool checkpoint = _checkpoint && !layout.reference && !layout.condensed && !layout.reduced;
+    recipe.step = checkpoint ? StepModel::Get(layout.n_coeffs, _path_heading) : NULL;
+    return recipe;
+}
+
+double MPC::recordTape(TapeSolver &tape_solver, const std::map<string, double> &params, const TapeLayout &layout)
+{
+    if (&tape_solver == _tape_solver.get())
+    {
+        _tape_layout = layout;
+    }
+    return recordRecipe(tape_solver, tapeRecipe(params, layout));
+}
+
+
+vector<double> MPC::Solve(Eigen::VectorXd state, Eigen::VectorXd coeffs) 
+{
+    return solve(state, coeffs, false);
+}
+
+vector<double> MPC::SolveReference(Eigen::VectorXd state, Eigen::VectorXd ref) 
+{
+    if (ref.size() != 3 * _mpc_steps)
+    {
+        cout << "SolveReference: expected " << 3 * _mpc_steps << " reference entries, got " << ref.size() << endl;
+        this->mpc_x.clear();
+        this->mpc_y.clear();
+        this->mpc_theta.clear();
+        this->mpc_angvel.clear();
+        this->mpc_accel.clear();
+        this->mpc_sensitivity.Clear();
+        return vector<double>(2, 0.0);
+    }
+    return solve(state, ref, true);
+}
+
+vector<double> MPC::solve(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, bool reference) 
+{
+    MPC_TRACE_SPAN("mpc_solve");
+    _mpc_remote = false;
+    _mpc_cancelled = false;
+    _cancel.store(false, std::memory_order_relaxed);
+    if (_remote && !reference && !_vehicle && state.size() == 6 && !_wheels.Enabled())
+    {
+        vector<double> result;
+        if (solveRemote(state, coeffs, result))
+        {
+            return result;
+        }
+    }
+    if (_vehicle)
+    {
+        if (!reference)
+        {
+            return solveVehicle(state, coeffs);
+        }
+        cout << "MPC: the reference poses are not written for VEHICLE_MODEL " << _vehicle->Name() << endl;
+        this->mpc_x.clear();
+        this->mpc_y.clear();
+        this->mpc_theta.clear();
+        this->mpc_angvel.clear();
+        this->mpc_accel.clear();
+        this->mpc_lateral.clear();
+        this->mpc_sensitivity.Clear();
+        return vector<double>(2, 0.0);
+    }
+    bool ok = true;
+    size_t i;
+    typedef CPPAD_TESTVECTOR(double) Dvector;
     const double x = state[0];
     const double y = state[1];
     const double theta = state[2];
@@ -274,125 +2225,1442 @@ vector<double> MPC::Solve(Eigen::VectorXd state, Eigen::VectorXd coeffs)
     const double cte = state[4];
     const double etheta = state[5];
 
-    // Set the number of model variables (includes both states and inputs).
-    // For example: If the state is a 4 element vector, the actuators is a 2
-    // element vector and there are 10 timesteps. The number of variables is:
-    // 4 * 10 + 2 * 9
-    size_t n_vars = _mpc_steps * 6 + (_mpc_steps - 1) * 2;
-    
-    // Set the number of constraints
-    size_t n_constraints = _mpc_steps * 6;
+    // Move blocking (or the input spline) changes the layout of the inputs
+    // and the time grid (or the terminal cost) the model, only the CppAD
+    // model (plain or taped) is written for them, as for the reference
+    // poses. The corridor rows are on its full layout only.
+    const bool blocked = !_block_of.empty() || _spline.Enabled();
+    const bool corridor_set = corridorSet();
+    const bool uniform = !blocked && _step_dt.empty() && !reference && !_wheels.Enabled() && !_terminal && !corridor_set;
+    const bool rti = _rti && uniform;
+    const bool analytic = _analytic && uniform;
+    // Multi-start solve, on the analytic derivatives
+    const bool multi = _multi_start.Hypotheses() > 1 && !rti && uniform;
+    // Matrix-free Newton on the condensed problem, also for the reference poses
+    const bool newton = _newton && !blocked && !_wheels.Enabled() && !corridor_set && !rti && !analytic && !multi;
+    const bool condensed = _condensed && !corridor_set;
+    const bool reduced = _reduced && !corridor_set;
+    // FG_eval on the multiple shooting layout, the only one of the
+    // obstacle term, the corridor and the speed reference
+    const bool full = !rti && !multi && !analytic && !newton && !condensed && !reduced;
+
+    // Adaptive horizon, see horizon_selector.h. The tapes of all candidates
+    // are recorded on the first solve so that switching costs nothing later.
+    // The reference poses are sampled for the current horizon.
+    _mpc_tape_ms = 0;
+    _mpc_tape_profile.Clear();
+    // Inputs of the solve time prediction, before the horizon is chosen on it
+    if (_predictor.Enabled())
+    {
+        _predictor.Features(v, coeffs, _warm_start && _warm.Steps() > 0);
+    }
+    const bool adaptive = _horizon.Enabled() && !reference;
+    if (adaptive)
+    {
+        const bool first = _horizon_index < 0;
+        const int horizon = _horizon.Next(v, coeffs, horizonBudget());
+        if (horizon != _horizon_index)
+        {
+            applyHorizon(horizon);
+        }
+        if (first && _persistent_tape && !rti && !analytic && !multi && !newton)
+        {
+            const TapeLayout layout = tapeLayout(coeffs.size(), false, _w_obs > 0 && !_obstacle_model.empty(),
+                                                 corridor_set ? _corridor_faces : 0, !_speed_reference.empty());
+            for (size_t k = 0; k < _horizon_tapes.size(); k++)
+            {
+                // Tapes from Prepare(), started before and recorded in parallel
+                if (takeHorizonTape(k) || (int)k == _horizon_index || !_horizon_stale[k])
+                {
+                    continue;
+                }
+                if (!_horizon_tapes[k])
+                {
+                    _horizon_tapes[k] = std::make_shared<TapeSolver>();
+                }
+                _mpc_tape_ms += recordTape(*_horizon_tapes[k], horizonParams(k), layout);
+                _horizon_stale[k] = false;
+            }
+        }
+    }
+    else if (_persistent_tape && _tape_builder.Busy() && _tape_builder.Id() == (unsigned long)_mpc_steps
+             && (!_tape_solver || !_tape_solver->IsRecorded() || _tape_stale))
+    {
+        // The tape of this horizon from Prepare(), waiting for it is
+        // cheaper than recording it again
+        _tape_builder.Wait();
+        takeTape();
+    }
+    const double record_ms = _mpc_tape_ms;
+    const std::chrono::steady_clock::time_point solve_begin = std::chrono::steady_clock::now();
+
+    // Set the number of model variables (includes both states and inputs).
+    // For example: If the state is a 4 element vector, the actuators is a 2
+    // element vector and there are 10 timesteps. The number of variables is:
+    // 4 * 10 + 2 * 9 (fewer inputs with move blocking, plus the torques
+    // of the DYNAMIC model and the slacks of its soft bounds)
+    const size_t n_torques = numTorques();
+    const size_t n_slacks = numSlacks();
+    size_t n_vars = _mpc_steps * 6 + _n_inputs * 2 + n_torques + n_slacks;
+
+    // Obstacle term, corridor and speed reference, only while their model
+    // matches the horizon
+    const bool obstacles = full && _w_obs > 0 && _obstacle_model.size() == 3 * (size_t)_mpc_steps;
+    const int corridor_faces = full && corridor_set && _corridor_model.size() == 3 * (size_t)(_corridor_faces * _mpc_steps)
+                               ? _corridor_faces : 0;
+    const bool speeds = full && _speed_reference.size() == (size_t)_mpc_steps;
+    
+    // Set the number of constraints, the corridor rows after the slack rows
+    const size_t n_model_constraints = _mpc_steps * 6 + numTorqueRows() + 2 * n_slacks;
+    size_t n_constraints = n_model_constraints + (_mpc_steps - 1) * corridor_faces;
+
+    // Parameters of the tape, see numParams()
+    const TapeLayout layout = tapeLayout(coeffs.size(), reference, obstacles, corridor_faces, speeds);
+    const size_t n_params = numParams(layout, _mpc_steps);
+
+    // Initial value of the independent variables.
+    // SHOULD BE 0 besides initial state.
+    _buffers.Resize(n_vars, n_constraints, n_params);
+    Dvector &vars = _buffers.vars;
+    for (int i = 0; i < n_vars; i++) 
+    {
+        vars[i] = 0;
+    }
+
+    // Previous solution shifted by one step, used as warm start and as
+    // the deadline mode fallback
+    Dvector &vars_zl = _buffers.vars_zl, &vars_zu = _buffers.vars_zu, &lambda = _buffers.lambda;
+    std::vector<double> &w_vars = _buffers.w_vars, &w_zl = _buffers.w_zl, &w_zu = _buffers.w_zu, &w_lambda = _buffers.w_lambda;
+    const bool shifted = (_warm_start || _deadline > 0 || rti)
+                         && _warm.Shift(_mpc_steps, x, y, theta, w_vars, w_zl, w_zu, w_lambda);
+    if (shifted && blocked)
+    {
+        // WarmStart keeps one input per step, each block starts from its first step
+        compressInputs(w_vars);
+        compressInputs(w_zl);
+        compressInputs(w_zu);
+    }
+    if (shifted && n_torques > 0)
+    {
+        extendTorques(w_vars, w_zl, w_zu, w_lambda);
+    }
+    if (shifted && n_slacks > 0)
+    {
+        extendSlacks(w_vars, w_zl, w_zu, w_lambda);
+    }
+    const bool warm = _warm_start && shifted;
+    if (warm)
+    {
+        for (int i = 0; warm && i < n_vars; i++)
+        {
+            vars[i] = w_vars[i];
+            vars_zl[i] = w_zl[i];
+            vars_zu[i] = w_zu[i];
+        }
+        // The corridor slides with the reference, its multipliers start over
+        for (int i = 0; warm && i < n_constraints; i++)
+        {
+            lambda[i] = i < n_model_constraints && i < w_lambda.size() ? w_lambda[i] : 0.0;
+        }
+    }
+
+    // Set the initial variable values
+    vars[_x_start] = x;
+    vars[_y_start] = y;
+    vars[_theta_start] = theta;
+    vars[_v_start] = v;
+    vars[_cte_start] = cte;
+    vars[_etheta_start] = etheta;
+    const bool measured_angvel = n_torques > 0 && state.size() > 6;
+    if (measured_angvel)
+    {
+        vars[_angvel_start] = state[6];
+    }
+
+    // object that computes objective and constraints
+    FG_eval fg_eval(coeffs);
+    fg_eval.LoadParams(_params);
+    fg_eval.SetMoveBlocks(_move_blocks);
+    fg_eval._reference = reference;
+    if (obstacles)
+    {
+        fg_eval.obstacles = &_obstacle_model;
+        fg_eval._obs_steps = _mpc_steps;
+    }
+    if (corridor_faces > 0)
+    {
+        fg_eval.corridor = &_corridor_model;
+        fg_eval._cor_steps = _mpc_steps;
+        fg_eval._cor_faces = corridor_faces;
+    }
+    if (speeds)
+    {
+        fg_eval.speeds = &_speed_reference;
+        fg_eval._speed_steps = _mpc_steps;
+    }
+
+    // Without a previous solution (new plan, tracking reacquired) start
+    // from the inputs of the seed provider or a pure pursuit rollout
+    // instead of zero inputs
+    const bool learned = _seed && !warm && !reference
+                         && _seed->Seed(state, coeffs, _mpc_steps, _seed_angvel, _seed_accel);
+    if (learned && _spline.Enabled())
+    {
+        for (int k = 0; k < _n_inputs; k++)
+        {
+            vars[_angvel_start + k] = std::min(_max_angvel, std::max(-_max_angvel, _seed_angvel[_spline.Sample(k)]));
+            vars[_a_start + k] = std::min(_max_throttle, std::max(-_max_throttle, _seed_accel[_spline.Sample(k)]));
+        }
+        fg_eval.Rollout(vars);
+    }
+    else if (learned)
+    {
+        // Each block starts from its first step
+        for (int i = _mpc_steps - 2; i >= 0; i--)
+        {
+            if (!(i == 0 && measured_angvel))
+            {
+                vars[_angvel_start + input(i)] = std::min(_max_angvel, std::max(-_max_angvel, _seed_angvel[i]));
+            }
+            vars[_a_start + input(i)] = std::min(_max_throttle, std::max(-_max_throttle, _seed_accel[i]));
+        }
+        fg_eval.Rollout(vars);
+    }
+    const bool seeded = _pursuit_seed && !warm && !learned;
+    if (seeded)
+    {
+        fg_eval.PursuitSeed(vars, _max_angvel, _max_throttle, measured_angvel);
+    }
+    // Slacks of the start, by how far angvel and a exceed the bounds
+    const int slack_start = _a_start + _n_inputs + n_torques;
+    for (int i = 0; i < n_slacks; i++)
+    {
+        const double bound = i < (int)n_slacks / 2 ? _max_angvel : _max_throttle;
+        vars[slack_start + i] = std::max(0.0, std::fabs(vars[_angvel_start + i]) - bound);
+    }
+
+    // Set lower and upper limits for variables.
+    Dvector &vars_lowerbound = _buffers.vars_lowerbound;
+    Dvector &vars_upperbound = _buffers.vars_upperbound;
+    
+    // Set all non-actuators upper and lowerlimits
+    // to the max negative and positive values.
+    for (int i = 0; i < _angvel_start; i++) 
+    {
+        vars_lowerbound[i] = -_bound_value;
+        vars_upperbound[i] = _bound_value;
+    }
+
+    // The upper and lower limits of angvel are set to -25 and 25
+    // degrees (values in radians). With soft bounds angvel and a are
+    // free like the other states, their rows below hold the limits.
+    const double max_angvel = n_slacks > 0 ? _bound_value : _max_angvel;
+    const double max_throttle = n_slacks > 0 ? _bound_value : _max_throttle;
+    for (int i = _angvel_start; i < _a_start; i++) 
+    {
+        vars_lowerbound[i] = -max_angvel;
+        vars_upperbound[i] = max_angvel;
+    }
+    // Acceleration/decceleration upper and lower limits
+    const int torque_start = _a_start + _n_inputs;
+    for (int i = _a_start; i < torque_start; i++)  
+    {
+        vars_lowerbound[i] = -max_throttle;
+        vars_upperbound[i] = max_throttle;
+    }
+    // Wheel torques of the DYNAMIC model
+    for (int i = torque_start; i < slack_start; i++)
+    {
+        vars_lowerbound[i] = -_wheels.MaxTorque();
+        vars_upperbound[i] = _wheels.MaxTorque();
+    }
+    for (int i = slack_start; i < n_vars; i++)
+    {
+        vars_lowerbound[i] = 0;
+        vars_upperbound[i] = _bound_value;
+    }
+
+
+    // Lower and upper limits for the constraints
+    // Should be 0 besides initial state.
+    Dvector &constraints_lowerbound = _buffers.constraints_lowerbound;
+    Dvector &constraints_upperbound = _buffers.constraints_upperbound;
+    for (int i = 0; i < n_constraints; i++)
+    {
+        constraints_lowerbound[i] = 0;
+        constraints_upperbound[i] = 0;
+    }
+    if (n_torques > 0)
+    {
+        // Initial turn rate row of the torque model, see wheel_dynamics.h
+        const int row = _mpc_steps * 6 + _mpc_steps - 1;
+        constraints_lowerbound[row] = measured_angvel ? state[6] : -_max_angvel;
+        constraints_upperbound[row] = measured_angvel ? state[6] : _max_angvel;
+    }
+    if (n_slacks > 0)
+    {
+        // angvel + s >= -bound and angvel - s <= bound, one sided (1e19
+        // is infinite to Ipopt)
+        const int row = _mpc_steps * 6 + numTorqueRows();
+        for (int i = 0; i < n_slacks; i++)
+        {
+            const double bound = i < (int)n_slacks / 2 ? _max_angvel : _max_throttle;
+            constraints_lowerbound[row + 2 * i] = -bound;
+            constraints_upperbound[row + 2 * i] = 1e19;
+            constraints_lowerbound[row + 2 * i + 1] = -1e19;
+            constraints_upperbound[row + 2 * i + 1] = bound;
+        }
+    }
+    // Corridor half-planes a_x * x + a_y * y - b <= 0
+    for (size_t i = n_model_constraints; i < n_constraints; i++)
+    {
+        constraints_lowerbound[i] = -1e19;
+        constraints_upperbound[i] = 0;
+    }
+    if (_terminal)
+    {
+        // Terminal set, CONDENSED and REDUCED have no cte and etheta variables
+        const int last = _mpc_steps - 1;
+        const double ref_cte = _params.find("REF_CTE") != _params.end() ? _params.at("REF_CTE") : 0.0;
+        const double ref_etheta = _params.find("REF_ETHETA") != _params.end() ? _params.at("REF_ETHETA") : 0.0;
+        if (_terminal_cte > 0)
+        {
+            vars_lowerbound[_cte_start + last] = ref_cte - _terminal_cte;
+            vars_upperbound[_cte_start + last] = ref_cte + _terminal_cte;
+        }
+        if (_terminal_etheta > 0)
+        {
+            vars_lowerbound[_etheta_start + last] = ref_etheta - _terminal_etheta;
+            vars_upperbound[_etheta_start + last] = ref_etheta + _terminal_etheta;
+        }
+    }
+    constraints_lowerbound[_x_start] = x;
+    constraints_lowerbound[_y_start] = y;
+    constraints_lowerbound[_theta_start] = theta;
+    constraints_lowerbound[_v_start] = v;
+    constraints_lowerbound[_cte_start] = cte;
+    constraints_lowerbound[_etheta_start] = etheta;
+    constraints_upperbound[_x_start] = x;
+    constraints_upperbound[_y_start] = y;
+    constraints_upperbound[_theta_start] = theta;
+    constraints_upperbound[_v_start] = v;
+    constraints_upperbound[_cte_start] = cte;
+    constraints_upperbound[_etheta_start] = etheta;
+
+
+    // options for IPOPT solver
+    std::string options;
+    // Uncomment this if you'd like more print information
+    options += "Integer print_level  0\n";
+    // NOTE: Setting sparse to true allows the solver to take advantage
+    // of sparse routines, this makes the computation MUCH FASTER. If you
+    // can uncomment 1 of these and see if it makes a difference or not but
+    // if you uncomment both the computation time should go up in orders of
+    // magnitude.
+    options += "Sparse  true        forward\n";
+    options += "Sparse  true        reverse\n";
+    // JACOBIAN, the last Sparse line counts
+    if (_jacobian_method == 1)
+    {
+        options += "Sparse  true        forward\n";
+    }
+    else if (_jacobian_method == 2)
+    {
+        options += "Sparse  true        subgraph\n";
+    }
+    // HESSIAN_COLORING
+    options += std::string("Coloring    ") + TapeSolver::HessianColoring(_hessian_coloring) + "\n";
+    // OPTIMIZE for the tape of CppAD::ipopt::solve, TapeSolver takes it when recording
+    options += tape_optimize::SolveOptions(_tape_optimize);
+    // LINEAR_SOLVER, LINEAR_ORDER
+    options += linear_solver::SolveOptions(_linear_solver, _linear_order);
+    // SCALING, only TapeSolver hands the factors to Ipopt
+    if (_scaling && _persistent_tape && !rti && !multi && !analytic && !newton)
+    {
+        options += "String  nlp_scaling_method user-scaling\n";
+    }
+    // NOTE: Currently the solver has a maximum time limit of 0.5 seconds.
+    // Change this as you see fit. In deadline mode the tape and analytic
+    // solvers stop on wall time, the CppAD solver can only be bounded in cpu time.
+    std::ostringstream cpu_time;
+    cpu_time << ((_deadline > 0 && !_persistent_tape && !analytic && !multi) ? std::min(_deadline, 0.5) : 0.5);
+    options += "Numeric max_cpu_time          " + cpu_time.str() + "\n";
+    // Quasi-Newton Hessian, Ipopt then never calls eval_h
+    if (_hessian_mode == 2)
+    {
+        options += "String  hessian_approximation limited-memory\n";
+    }
+    // Only TapeSolver and AnalyticSolver hand the multipliers to Ipopt,
+    // MultiStart adds these to its warm started hypothesis
+    if (warm && (_persistent_tape || analytic) && !multi)
+    {
+        options += "String  warm_start_init_point      yes\n";
+        options += "Numeric warm_start_bound_push      1e-6\n";
+        options += "Numeric warm_start_mult_bound_push 1e-6\n";
+        options += "Numeric mu_init                    1e-4\n";
+    }
+    // SetIpoptOptions(), Ipopt takes the last value of an option
+    options += _ipopt_options;
+    // SetToleranceScale() of Ipopt's defaults, the policy scales its own
+    if (_tol_scale > 1.0 && !_policy.Enabled())
+    {
+        std::ostringstream tol;
+        tol << "Numeric tol            " << 1e-8 * _tol_scale << "\n"
+            << "Numeric acceptable_tol " << 1e-6 * _tol_scale << "\n";
+        options += tol.str();
+    }
+    // Termination settings of the phase and the deadline (POLICY), the
+    // persistent applications change them in place, see ipopt_util.h
+    _mpc_phase = -1;
+    if (_policy.Enabled() && !rti)
+    {
+        // The previous plan is lost (or there is none yet)
+        if ((_warm_start || _deadline > 0) && !shifted)
+        {
+            _policy.Restart();
+        }
+        std::string tuning;
+        if (_predictor.Ready())
+        {
+            _policy.Predict(_predictor.Iterations(_mpc_steps), _predictor.IterationMs(_mpc_steps));
+        }
+        _mpc_phase = _policy.Next(_deadline, tuning);
+        options += tuning;
+    }
+
+    // place to return solution
+    CppAD::ipopt::solve_result<Dvector> &solution = _buffers.solution;
+
+    // solve the problem
+    if (rti)
+    {
+        // One Gauss-Newton step around the shifted previous solution
+        std::vector<double> rti_vars;
+        if (shifted)
+        {
+            rti_vars = w_vars;
+        }
+        else if (seeded || learned)
+        {
+            rti_vars.assign(vars.data(), vars.data() + n_vars);
+        }
+        const bool rti_ok = _rti_solver.Step(state, coeffs, rti_vars);
+        rti_vars.resize(n_vars, 0.0);
+        solution.status = rti_ok ? CppAD::ipopt::solve_result<Dvector>::success
+                                 : CppAD::ipopt::solve_result<Dvector>::unknown;
+        solution.x.resize(n_vars);
+        solution.zl.resize(n_vars);
+        solution.zu.resize(n_vars);
+        for (int i = 0; i < n_vars; i++)
+        {
+            solution.x[i] = rti_vars[i];
+            solution.zl[i] = 0;
+            solution.zu[i] = 0;
+        }
+        solution.g.resize(0);
+        solution.lambda.resize(n_constraints);
+        for (int i = 0; i < n_constraints; i++)
+        {
+            solution.lambda[i] = 0;
+        }
+        solution.obj_value = _rti_solver.Cost(rti_vars);
+    }
+    else if (multi)
+    {
+        _multi_start.SetTimeLimit(_deadline);
+        _multi_start.SetCancel(&_cancel);
+        _multi_start.Solve(options, coeffs, vars, vars_lowerbound, vars_upperbound,
+                           constraints_lowerbound, constraints_upperbound, solution,
+                           warm ? &vars_zl : NULL, warm ? &vars_zu : NULL, warm ? &lambda : NULL);
+    }
+    else if (analytic)
+    {
+        _analytic_solver.SetTimeLimit(_deadline);
+        _analytic_solver.SetCancel(&_cancel);
+        _analytic_solver.Solve(options, coeffs, vars, vars_lowerbound, vars_upperbound,
+                               constraints_lowerbound, constraints_upperbound, solution,
+                               warm ? &vars_zl : NULL, warm ? &vars_zu : NULL, warm ? &lambda : NULL);
+    }
+    else if (newton)
+    {
+        solveNewton(state, coeffs, reference, solution);
+    }
+    else if (condensed)
+    {
+        solveCondensed(options, state, coeffs, reference, warm, solution);
+    }
+    else if (reduced)
+    {
+        solveReduced(options, state, coeffs, reference, warm, solution);
+    }
+    else if (_persistent_tape)
+    {
+        // Record once per configuration, the coefficients, the values and
+        // the models of the features are passed in as the trailing entries
+        // of the tape domain on every solve.
+        useOrderTape(n_vars, n_params, reference);
+        if (!_tape_solver || _tape_stale || _tape_solver->NumVars() != n_vars
+            || _tape_solver->NumParams() != n_params || _tape_solver->NumConstraints() != n_constraints
+            || _tape_reference != reference)
+        {
+            if (!_tape_solver)
+            {
+                _tape_solver = std::make_shared<TapeSolver>();
+            }
+            _tape_stale = false;
+            _tape_reference = reference;
+            _mpc_tape_ms += recordTape(*_tape_solver, _params, layout);
+            _jit_model.clear();
+            if (_jit && !reference && !_tape_solver->IsGenerated() && n_params == (size_t)coeffs.size())
+            {
+                prepareJit(coeffs.size());
+            }
+        }
+        if (!_jit_model.empty())
+        {
+            pollJit();
+        }
+
+        // [coeffs | values | obstacle model | corridor | speeds]
+        Dvector &params = _buffers.params;
+        size_t n_fixed = 0;
+        for (int i = 0; i < coeffs.size(); i++)
+        {
+            params[n_fixed++] = coeffs[i];
+        }
+        if (layout.values)
+        {
+            fg_eval.Values(&params[n_fixed]);
+            n_fixed += ModelParams::NUM_VALUES;
+        }
+        for (size_t i = 0; obstacles && i < _obstacle_model.size(); i++)
+        {
+            params[n_fixed++] = _obstacle_model[i];
+        }
+        for (size_t i = 0; corridor_faces > 0 && i < _corridor_model.size(); i++)
+        {
+            params[n_fixed++] = _corridor_model[i];
+        }
+        for (size_t i = 0; speeds && i < _speed_reference.size(); i++)
+        {
+            params[n_fixed++] = _speed_reference[i];
+        }
+        _tape_solver->SetHessianColoring(_hessian_coloring);
+        _tape_solver->SetHessianReuse(_hessian_reuse, _hessian_reuse_step, _hessian_reuse_lambda);
+        _tape_solver->SetTaylorCapacity(_taylor_capacity);
+        _tape_solver->SetSparsity(_sparsity);
+        _tape_solver->SetTimeLimit(_deadline);
+        _tape_solver->SetCancel(&_cancel);
+        setInputStop(0);
+        setScaling(_scaling_full);
+        _tape_solver->Solve(options, params, vars, vars_lowerbound, vars_upperbound,
+                            constraints_lowerbound, constraints_upperbound, solution,
+                            warm ? &vars_zl : NULL, warm ? &vars_zu : NULL, warm ? &lambda : NULL);
+        _mpc_tape_profile = _tape_solver->Profile();
+    }
+    else
+    {
+        // CHECKPOINT, the tape of CppAD::ipopt::solve is recorded here
+        StepModel *step = _checkpoint && fg_eval.Checkpointable() ? StepModel::Get(coeffs.size(), _path_heading) : NULL;
+        if (step)
+        {
+            step->Prepare();
+            fg_eval._step = step;
+        }
+        CppAD::ipopt::solve<Dvector, FG_eval>(
+          options, vars, vars_lowerbound, vars_upperbound, constraints_lowerbound,
+          constraints_upperbound, fg_eval, solution);
+    }
+    // A cancelled solve ran on an old reference, it does not measure the
+    // horizon or the policy
+    _mpc_cancelled = _cancel.load(std::memory_order_relaxed);
+
+    if (adaptive && !_mpc_cancelled)
+    {
+        const double solve_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - solve_begin).count();
+        _horizon.Measure(_horizon_index, (solve_ms - (_mpc_tape_ms - record_ms)) / 1000.0);
+    }
+
+    // Check some of the solution values
+    ok &= solution.status == CppAD::ipopt::solve_result<Dvector>::success;
+    _mpc_status = solution.status;
+    _mpc_iterations = rti ? _rti_solver.QpIterations()
+                      : multi ? _multi_start.Iterations()
+                      : analytic ? _analytic_solver.Iterations()
+                      : newton ? _newton_solver.Iterations()
+                      : _persistent_tape ? _tape_solver->Iterations() : -1;
+    if (_persistent_tape && !rti && !multi && !analytic && !newton)
+        _mpc_journal = _tape_solver->Journal();
+    else
+        _mpc_journal.Clear();
+    // An INPUT_STOP cut converged as far as the applied inputs go
+    const bool input_stop = _persistent_tape && !rti && !multi && !analytic && !newton && _tape_solver->InputStopHit();
+    _mpc_predicted_ms = _predictor.Ready() ? _predictor.SolveMs(_mpc_steps) : 0.0;
+    if (_predictor.Enabled() && !_mpc_cancelled)
+    {
+        const double solve_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - solve_begin).count();
+        _predictor.Observe(_mpc_steps, _mpc_iterations, solve_ms - (_mpc_tape_ms - record_ms));
+    }
+    if (_mpc_phase >= 0 && !_mpc_cancelled)
+    {
+        const double solve_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - solve_begin).count();
+        _policy.Observe(ok || input_stop || solution.status == CppAD::ipopt::solve_result<Dvector>::stop_at_acceptable_point,
+                        solve_ms - (_mpc_tape_ms - record_ms), _mpc_iterations);
+    }
+
+    // A solve that did not converge (cut off by the deadline or the cpu
+    // time, restoration failed, ...) is kept if its iterate satisfies the
+    // model. Otherwise in deadline mode the shifted previous plan is
+    // followed instead.
+    bool usable = ok || solution.status == CppAD::ipopt::solve_result<Dvector>::stop_at_acceptable_point;
+    if (!usable && solution.x.size() == n_vars && solution.g.size() == n_constraints)
+    {
+        usable = TapeSolver::MaxViolation(solution.g, constraints_lowerbound, constraints_upperbound) < 1e-4;
+    }
+    _mpc_fallback = false;
+    if (!usable && _deadline > 0 && shifted && _fallbacks < _mpc_steps - 1)
+    {
+        solution.x.resize(n_vars);
+        solution.zl.resize(n_vars);
+        solution.zu.resize(n_vars);
+        solution.lambda.resize(n_constraints);
+        for (int i = 0; i < n_vars; i++)
+        {
+            solution.x[i] = w_vars[i];
+            solution.zl[i] = w_zl[i];
+            solution.zu[i] = w_zu[i];
+        }
+        for (int i = 0; i < n_constraints; i++)
+        {
+            solution.lambda[i] = i < w_lambda.size() ? w_lambda[i] : 0.0;
+        }
+        _mpc_fallback = true;
+        _fallbacks++;
+        usable = true;
+    }
+    else if (usable)
+    {
+        _fallbacks = 0;
+    }
+    _mpc_feasible = usable;
+    _mpc_slack = 0;
+    for (int i = 0; i < n_slacks && solution.x.size() == n_vars; i++)
+    {
+        _mpc_slack = std::max(_mpc_slack, solution.x[slack_start + i]);
+    }
+
+    // Keep usable solutions for the next warm start / fallback, without
+    // the torques and slacks (extendTorques() derives them from the
+    // shifted plan)
+    const size_t n_plan = solution.x.size() == n_vars ? n_vars - n_torques - n_slacks : solution.x.size();
+    const size_t n_plan_rows = std::min(solution.lambda.size(), size_t(_mpc_steps * 6));
+    if ((_warm_start || _deadline > 0 || rti) && usable && blocked)
+    {
+        // Expanded to one input per step, the shifted buffers are free by now
+        expandInputs(solution.x, w_vars);
+        expandInputs(solution.zl, w_zl);
+        expandInputs(solution.zu, w_zu);
+        _warm.Store(_mpc_steps, w_vars.data(), w_zl.data(), w_zu.data(),
+                    (solution.zl.size() == solution.x.size() && solution.zu.size() == solution.x.size())
+                        ? w_vars.size() : 0,
+                    solution.lambda.data(), solution.lambda.size());
+    }
+    else if ((_warm_start || _deadline > 0 || rti) && usable)
+    {
+        _warm.Store(_mpc_steps, solution.x.data(), solution.zl.data(), solution.zu.data(),
+                    (solution.zl.size() == solution.x.size() && solution.zu.size() == solution.x.size())
+                        ? n_plan : 0,
+                    solution.lambda.data(), n_plan_rows);
+    }
+    else
+    {
+        _warm.Reset();
+        _fallbacks = 0;
+    }
+
+    // Cost breakdown of the solution, for the diagnostics topics
+    _mpc_totalcost = solution.obj_value;
+    if (solution.x.size() == n_vars)
+    {
+        fg_eval.CostTerms(solution.x, _mpc_ctecost, _mpc_ethetacost, _mpc_velcost);
+    }
+
+    this->mpc_x.clear();
+    this->mpc_y.clear();
+    this->mpc_theta.clear();
+    for (int i = 0; i < _mpc_steps; i++) 
+    {
+        this->mpc_x.push_back(solution.x[_x_start + i]);
+        this->mpc_y.push_back(solution.x[_y_start + i]);
+        this->mpc_theta.push_back(solution.x[_theta_start + i]);
+    }
+    this->mpc_angvel.clear();
+    this->mpc_accel.clear();
+    for (int i = 0; i < _mpc_steps - 1; i++) 
+    {
+        this->mpc_angvel.push_back(inputAt(solution.x, _angvel_start, i));
+        this->mpc_accel.push_back(inputAt(solution.x, _a_start, i));
+    }
+    this->mpc_step_dt = _step_dt;
+    this->mpc_torque_right.clear();
+    this->mpc_torque_left.clear();
+    for (int i = 0; i < int(n_torques) / 2; i++)
+    {
+        this->mpc_torque_right.push_back(solution.x[torque_start + i]);
+        this->mpc_torque_left.push_back(solution.x[torque_start + _mpc_steps - 1 + i]);
+    }
+    this->mpc_lateral.clear();
+
+    // Gains of the Ipopt solution for the updates between solves, on the
+    // kinematic model of the rti linearization
+    this->mpc_sensitivity.Clear();
+    if (_sensitivity && uniform && !rti && _path_heading && usable && solution.x.size() == n_vars)
+    {
+        MPC_TRACE_SPAN("sensitivity");
+        _rti_solver.Sensitivity(coeffs, solution.x.data(), n_vars, this->mpc_sensitivity);
+    }
 
-    // Initial value of the independent variables.
-    // SHOULD BE 0 besides initial state.
-    Dvector vars(n_vars);
-    for (int i = 0; i < n_vars; i++) 
+    vector<double> result;
+    result.push_back(solution.x[_angvel_start]);
+    result.push_back(solution.x[_a_start]);
+
+    // A tape recorded on the side for a new horizon takes over from the
+    // next solve, the caller sizes the obstacle model by PlannedHorizon()
+    takeTape();
+    return result;
+}
+
+// The reply of the batch server in place of a solve. The local warm start
+// is dropped, it is older than the server's plan; the next local solve
+// starts from PURSUIT_SEED or the seed provider.
+bool MPC::solveRemote(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, vector<double> &result)
+{
+    MPC_TRACE_SPAN("remote_solve");
+    remote_solve::Reply reply;
+    if (!_remote->Solve(state, coeffs, _params, _mpc_params_version, _remote_timeout, reply))
     {
-        vars[i] = 0;
+        return false;
     }
+    _mpc_remote = true;
+    _mpc_remote_rtt_ms = _remote->LastRtt();
+    _mpc_tape_ms = 0;
+    _mpc_tape_profile.Clear();
+    _mpc_status = reply.status;
+    _mpc_iterations = reply.iterations;
+    _mpc_journal.Clear();
+    _mpc_fallback = reply.result == remote_solve::FALLBACK;
+    _mpc_feasible = true;
+    _mpc_slack = 0;
+    _mpc_phase = -1;
+    _mpc_totalcost = reply.objective;
+    _mpc_ctecost = _mpc_ethetacost = _mpc_velcost = 0;
 
-    // Set the initial variable values
-    vars[_x_start] = x;
-    vars[_y_start] = y;
-    vars[_theta_start] = theta;
-    vars[_v_start] = v;
-    vars[_cte_start] = cte;
-    vars[_etheta_start] = etheta;
+    const int steps = std::min<uint32_t>(reply.steps, remote_solve::MAX_STEPS);
+    this->mpc_x.assign(reply.x, reply.x + steps);
+    this->mpc_y.assign(reply.y, reply.y + steps);
+    this->mpc_theta.assign(reply.theta, reply.theta + steps);
+    this->mpc_angvel.assign(reply.angvel_seq, reply.angvel_seq + std::max(steps - 1, 0));
+    this->mpc_accel.assign(reply.accel_seq, reply.accel_seq + std::max(steps - 1, 0));
+    this->mpc_lateral.clear();
+    this->mpc_step_dt.clear();
+    this->mpc_torque_right.clear();
+    this->mpc_torque_left.clear();
+    this->mpc_sensitivity.Clear();
+    _warm.Reset();
+    _fallbacks = 0;
 
-    // Set lower and upper limits for variables.
-    Dvector vars_lowerbound(n_vars);
-    Dvector vars_upperbound(n_vars);
-    
-    // Set all non-actuators upper and lowerlimits
-    // to the max negative and positive values.
-    for (int i = 0; i < _angvel_start; i++) 
+    result.assign(1, reply.angvel);
+    result.push_back(reply.accel);
+    return true;
+}
+
+// Solve on the motion model policy of VEHICLE_MODEL. The results are those
+// of solve(): the turn rate and acceleration of the first step, plus its
+// lateral speed on the holonomic model.
+vector<double> MPC::solveVehicle(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs)
+{
+    const bool ok = _vehicle->Solve(state, coeffs, _vehicle_plan);
+    const VehiclePlan &plan = _vehicle_plan;
+    _mpc_tape_ms = plan.tape_ms;
+    _mpc_tape_profile.Clear();
+    _mpc_status = plan.status;
+    _mpc_iterations = plan.iterations;
+    _mpc_journal.Clear();
+    _mpc_fallback = false;
+    _mpc_feasible = ok || plan.status == CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)>::stop_at_acceptable_point;
+    _mpc_slack = 0;
+    _mpc_phase = -1;
+    _mpc_totalcost = plan.cost;
+    _mpc_ctecost = plan.cte_cost;
+    _mpc_ethetacost = plan.etheta_cost;
+    _mpc_velcost = plan.vel_cost;
+
+    this->mpc_x = plan.x;
+    this->mpc_y = plan.y;
+    this->mpc_theta = plan.theta;
+    this->mpc_angvel = plan.angvel;
+    this->mpc_accel = plan.accel;
+    this->mpc_lateral.clear();
+    if (_vehicle_model == vehicle_model::HOLONOMIC)
     {
-        vars_lowerbound[i] = -_bound_value;
-        vars_upperbound[i] = _bound_value;
+        this->mpc_lateral = plan.lateral;
     }
+    this->mpc_step_dt.clear();
+    this->mpc_torque_right.clear();
+    this->mpc_torque_left.clear();
+    this->mpc_sensitivity.Clear();
 
-    // The upper and lower limits of angvel are set to -25 and 25
-    // degrees (values in radians).
-    for (int i = _angvel_start; i < _a_start; i++) 
+    vector<double> result;
+    result.push_back(plan.angvel[0]);
+    result.push_back(plan.accel[0]);
+    if (!this->mpc_lateral.empty())
     {
-        vars_lowerbound[i] = -_max_angvel;
-        vars_upperbound[i] = _max_angvel;
+        result.push_back(this->mpc_lateral[0]);
     }
-    // Acceleration/decceleration upper and lower limits
-    for (int i = _a_start; i < n_vars; i++)  
+    return result;
+}
+
+void MPC::solveCondensed(const std::string &options, const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs,
+                         bool reference, bool warm, CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> &solution)
+{
+    typedef CPPAD_TESTVECTOR(double) Dvector;
+    typedef CppAD::ipopt::solve_result<Dvector> SolveResult;
+    const size_t n_inputs = _n_inputs * 2;
+
+    // The inputs are the trailing _angvel_start.. entries of the multiple
+    // shooting layout, so are their start, bounds and bound multipliers
+    Dvector &vars = _buffers.condensed_vars, &vars_zl = _buffers.condensed_zl, &vars_zu = _buffers.condensed_zu;
+    Dvector &lowerbound = _buffers.condensed_lowerbound, &upperbound = _buffers.condensed_upperbound;
+    vars.resize(n_inputs);
+    vars_zl.resize(n_inputs);
+    vars_zu.resize(n_inputs);
+    lowerbound.resize(n_inputs);
+    upperbound.resize(n_inputs);
+    for (size_t i = 0; i < n_inputs; i++)
     {
-        vars_lowerbound[i] = -_max_throttle;
-        vars_upperbound[i] = _max_throttle;
+        vars[i] = _buffers.vars[_angvel_start + i];
+        vars_zl[i] = _buffers.vars_zl[_angvel_start + i];
+        vars_zu[i] = _buffers.vars_zu[_angvel_start + i];
+        lowerbound[i] = _buffers.vars_lowerbound[_angvel_start + i];
+        upperbound[i] = _buffers.vars_upperbound[_angvel_start + i];
     }
+    Dvector &no_constraints = _buffers.condensed_constraints;
+    no_constraints.resize(0);
 
+    SolveResult &condensed = _buffers.condensed_solution;
+    CondensedFG_eval fg_eval(state, coeffs);
+    fg_eval.LoadParams(_params);
+    fg_eval.SetMoveBlocks(_move_blocks);
+    fg_eval._reference = reference;
+    if (_persistent_tape)
+    {
+        // [state | coeffs | values]
+        const TapeLayout layout = tapeLayout(coeffs.size(), reference, false, 0, false);
+        const size_t n_params = numParams(layout, _mpc_steps);
+        useOrderTape(n_inputs, n_params, reference);
+        if (!_tape_solver || _tape_stale || _tape_solver->NumVars() != n_inputs
+            || _tape_solver->NumParams() != n_params || _tape_reference != reference)
+        {
+            if (!_tape_solver)
+            {
+                _tape_solver = std::make_shared<TapeSolver>();
+            }
+            _tape_stale = false;
+            _tape_reference = reference;
+            _mpc_tape_ms += recordTape(*_tape_solver, _params, layout);
+        }
 
-    // Lower and upper limits for the constraints
-    // Should be 0 besides initial state.
-    Dvector constraints_lowerbound(n_constraints);
-    Dvector constraints_upperbound(n_constraints);
-    for (int i = 0; i < n_constraints; i++)
+        Dvector &params = _buffers.params;
+        params.resize(n_params);
+        for (int i = 0; i < 6; i++)
+        {
+            params[i] = state[i];
+        }
+        for (int i = 0; i < coeffs.size(); i++)
+        {
+            params[6 + i] = coeffs[i];
+        }
+        if (layout.values)
+        {
+            fg_eval.Values(&params[6 + coeffs.size()]);
+        }
+        _tape_solver->SetHessianColoring(_hessian_coloring);
+        _tape_solver->SetHessianReuse(_hessian_reuse, _hessian_reuse_step, _hessian_reuse_lambda);
+        _tape_solver->SetTaylorCapacity(_taylor_capacity);
+        _tape_solver->SetSparsity(_sparsity);
+        _tape_solver->SetTimeLimit(_deadline);
+        _tape_solver->SetCancel(&_cancel);
+        setInputStop(_angvel_start);
+        setScaling(_scaling_condensed);
+        _tape_solver->Solve(options, params, vars, lowerbound, upperbound, no_constraints, no_constraints,
+                            condensed, warm ? &vars_zl : NULL, warm ? &vars_zu : NULL,
+                            warm ? &no_constraints : NULL);
+        _mpc_tape_profile = _tape_solver->Profile();
+    }
+    else
     {
-        constraints_lowerbound[i] = 0;
-        constraints_upperbound[i] = 0;
+        CppAD::ipopt::solve<Dvector, CondensedFG_eval>(
+          options, vars, lowerbound, upperbound, no_constraints, no_constraints, fg_eval, condensed);
     }
-    constraints_lowerbound[_x_start] = x;
-    constraints_lowerbound[_y_start] = y;
-    constraints_lowerbound[_theta_start] = theta;
-    constraints_lowerbound[_v_start] = v;
-    constraints_lowerbound[_cte_start] = cte;
-    constraints_lowerbound[_etheta_start] = etheta;
-    constraints_upperbound[_x_start] = x;
-    constraints_upperbound[_y_start] = y;
-    constraints_upperbound[_theta_start] = theta;
-    constraints_upperbound[_v_start] = v;
-    constraints_upperbound[_cte_start] = cte;
-    constraints_upperbound[_etheta_start] = etheta;
 
-    // object that computes objective and constraints
+    expandCondensed(fg_eval, state, condensed, solution);
+}
+
+void MPC::solveNewton(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, bool reference,
+                      CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> &solution)
+{
+    typedef CPPAD_TESTVECTOR(double) Dvector;
+    typedef CppAD::ipopt::solve_result<Dvector> SolveResult;
+    typedef NewtonKrylov::Preconditioner::Stage Stage;
+    const size_t n_inputs = _n_inputs * 2;
+
+    // The inputs-only problem of solveCondensed(), one input per step
+    Dvector &vars = _buffers.condensed_vars;
+    Dvector &lowerbound = _buffers.condensed_lowerbound, &upperbound = _buffers.condensed_upperbound;
+    vars.resize(n_inputs);
+    lowerbound.resize(n_inputs);
+    upperbound.resize(n_inputs);
+    for (size_t i = 0; i < n_inputs; i++)
+    {
+        vars[i] = _buffers.vars[_angvel_start + i];
+        lowerbound[i] = _buffers.vars_lowerbound[_angvel_start + i];
+        upperbound[i] = _buffers.vars_upperbound[_angvel_start + i];
+    }
+
+    CondensedFG_eval fg_eval(state, coeffs);
+    fg_eval.LoadParams(_params);
+    fg_eval.SetMoveBlocks(_move_blocks);
+    fg_eval._reference = reference;
+    const std::string name = fg_eval.ModelName(coeffs.size());
+    if (!_newton_solver.IsRecorded(name))
+    {
+        // Domain [inputs | state | coeffs], as the condensed tape of recordRecipe() with
+        // the values as constants: ModelName() tells the values apart
+        CondensedFG_eval tape_eval(fg_eval);
+        tape_eval._state_start = n_inputs;
+        const std::chrono::steady_clock::time_point record_begin = std::chrono::steady_clock::now();
+        _newton_solver.Record(n_inputs, 6 + coeffs.size(), name, tape_eval);
+        _mpc_tape_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - record_begin).count();
+    }
+
+    // Preconditioner: the Hessian of the cost on the lateral error model
+    // along the iterate, cte' = cte + v cos(etheta) dt etheta, etheta' =
+    // etheta + angvel dt, v' = v + a dt, and the previous inputs for the
+    // rate terms. It leaves out the curvature of the path and of the
+    // kinematics, which the Hessian products of the tape have.
+    const int N = _mpc_steps;
+    Dvector states;
+    NewtonKrylov::StageFunction stages = [&](const Dvector &x, NewtonKrylov::Preconditioner::Stages &stage)
+    {
+        fg_eval.Rollout(x, states);
+        stage.resize(N);
+        for (int k = 0; k < N; k++)
+        {
+            Stage &st = stage[k];
+            const double dt = fg_eval.dt(std::min(k, N - 2));
+            st.A.setIdentity();
+            st.A(0, 1) = states[_v_start + k] * cos(states[_etheta_start + k]) * dt;
+            st.A(3, 3) = 0;
+            st.A(4, 4) = 0;
+            st.B.setZero();
+            st.B(1, 0) = dt;
+            st.B(2, 1) = dt;
+            st.B(3, 0) = 1;
+            st.B(4, 1) = 1;
+            st.Q.setZero();
+            st.Q(0, 0) = 2 * fg_eval._w_cte;
+            st.Q(1, 1) = 2 * fg_eval._w_etheta;
+            st.Q(2, 2) = 2 * fg_eval._w_vel;
+            st.R.setZero();
+            st.R(0, 0) = 2 * fg_eval._w_angvel;
+            st.R(1, 1) = 2 * fg_eval._w_accel;
+            st.S.setZero();
+            if (k > 0 && k < N - 1)
+            {
+                st.Q(3, 3) = 2 * fg_eval._w_angvel_d;
+                st.Q(4, 4) = 2 * fg_eval._w_accel_d;
+                st.R(0, 0) += 2 * fg_eval._w_angvel_d;
+                st.R(1, 1) += 2 * fg_eval._w_accel_d;
+                st.S(0, 3) = -2 * fg_eval._w_angvel_d;
+                st.S(1, 4) = -2 * fg_eval._w_accel_d;
+            }
+        }
+        if (fg_eval._terminal)
+        {
+            Stage &st = stage[N - 1];
+            st.Q(0, 0) = 2 * fg_eval._p_cte;
+            st.Q(0, 1) = st.Q(1, 0) = 2 * fg_eval._p_cte_etheta;
+            st.Q(1, 1) = 2 * fg_eval._p_etheta;
+            st.Q(2, 2) = 2 * fg_eval._p_vel;
+        }
+    };
+    _newton_solver.SetPreconditioner(stages);
+
+    Dvector &params = _buffers.params;
+    params.resize(6 + coeffs.size());
+    for (int i = 0; i < 6; i++)
+    {
+        params[i] = state[i];
+    }
+    for (int i = 0; i < coeffs.size(); i++)
+    {
+        params[6 + i] = coeffs[i];
+    }
+    _newton_solver.SetTimeLimit(_deadline);
+    _newton_solver.SetCancel(&_cancel);
+    const NewtonKrylov::Status status = _newton_solver.Solve(params, lowerbound, upperbound, vars);
+    _newton_solver.SetPreconditioner(NewtonKrylov::StageFunction());
+
+    // An iterate that did not converge is still a feasible plan, see expandCondensed()
+    SolveResult &condensed = _buffers.condensed_solution;
+    condensed.status = status == NewtonKrylov::CONVERGED ? SolveResult::success
+                       : status == NewtonKrylov::MAX_ITER ? SolveResult::maxiter_exceeded
+                       : status == NewtonKrylov::LINE_SEARCH ? SolveResult::stop_at_tiny_step
+                       : SolveResult::unknown;
+    condensed.obj_value = _newton_solver.Cost();
+    condensed.x.resize(0);
+    condensed.zl.resize(0);
+    condensed.zu.resize(0);
+    if (status != NewtonKrylov::INVALID)
+    {
+        condensed.x.resize(n_inputs);
+        condensed.x = vars;
+    }
+    expandCondensed(fg_eval, state, condensed, solution);
+}
+
+void MPC::expandCondensed(const CondensedFG_eval &fg_eval, const Eigen::VectorXd &state,
+                          const CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> &condensed,
+                          CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> &solution) const
+{
+    const size_t n_vars = _mpc_steps * 6 + _n_inputs * 2;
+    const size_t n_constraints = _mpc_steps * 6;
+    const size_t n_inputs = _n_inputs * 2;
+
+    // Back to the multiple shooting layout: the rolled out states satisfy
+    // the model constraints exactly, their multipliers are left at zero
+    solution.status = condensed.status;
+    solution.obj_value = condensed.obj_value;
+    solution.x.resize(0);
+    solution.zl.resize(0);
+    solution.zu.resize(0);
+    solution.g.resize(0);
+    solution.lambda.resize(0);
+    if (condensed.x.size() != n_inputs)
+    {
+        return;
+    }
+    CPPAD_TESTVECTOR(double) states;
+    fg_eval.Rollout(condensed.x, states);
+    solution.x.resize(n_vars);
+    solution.zl.resize(n_vars);
+    solution.zu.resize(n_vars);
+    for (int i = 0; i < _angvel_start; i++)
+    {
+        solution.x[i] = states[i];
+        solution.zl[i] = 0;
+        solution.zu[i] = 0;
+    }
+    const bool multipliers = condensed.zl.size() == n_inputs && condensed.zu.size() == n_inputs;
+    for (size_t i = 0; i < n_inputs; i++)
+    {
+        solution.x[_angvel_start + i] = condensed.x[i];
+        solution.zl[_angvel_start + i] = multipliers ? condensed.zl[i] : 0;
+        solution.zu[_angvel_start + i] = multipliers ? condensed.zu[i] : 0;
+    }
+    solution.g.resize(n_constraints);
+    solution.lambda.resize(n_constraints);
+    for (size_t i = 0; i < n_constraints; i++)
+    {
+        solution.g[i] = 0;
+        solution.lambda[i] = 0;
+    }
+    const int start[6] = {_x_start, _y_start, _theta_start, _v_start, _cte_start, _etheta_start};
+    for (int k = 0; k < 6; k++)
+    {
+        solution.g[start[k]] = state[k];
+    }
+}
+
+void MPC::solveReduced(const std::string &options, const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs,
+                       bool reference, bool warm, CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> &solution)
+{
+    typedef CPPAD_TESTVECTOR(double) Dvector;
+    typedef CppAD::ipopt::solve_result<Dvector> SolveResult;
+    const size_t n_vars = _mpc_steps * 4 + _n_inputs * 2;
+
+    // The problem of Solve() without the cte and etheta entries
+    Dvector &vars = _buffers.reduced_vars, &vars_zl = _buffers.reduced_zl, &vars_zu = _buffers.reduced_zu;
+    Dvector &lowerbound = _buffers.reduced_lowerbound, &upperbound = _buffers.reduced_upperbound;
+    Dvector &constraints_lowerbound = _buffers.reduced_constraints_lowerbound;
+    Dvector &constraints_upperbound = _buffers.reduced_constraints_upperbound;
+    Dvector &lambda = _buffers.reduced_lambda;
+    reduced_state::ReduceVars(_mpc_steps, _buffers.vars, vars);
+    reduced_state::ReduceVars(_mpc_steps, _buffers.vars_zl, vars_zl);
+    reduced_state::ReduceVars(_mpc_steps, _buffers.vars_zu, vars_zu);
+    reduced_state::ReduceVars(_mpc_steps, _buffers.vars_lowerbound, lowerbound);
+    reduced_state::ReduceVars(_mpc_steps, _buffers.vars_upperbound, upperbound);
+    reduced_state::ReduceRows(_mpc_steps, _buffers.constraints_lowerbound, constraints_lowerbound);
+    reduced_state::ReduceRows(_mpc_steps, _buffers.constraints_upperbound, constraints_upperbound);
+    reduced_state::ReduceRows(_mpc_steps, _buffers.lambda, lambda);
+
+    SolveResult &reduced = _buffers.reduced_solution;
     FG_eval fg_eval(coeffs);
     fg_eval.LoadParams(_params);
+    fg_eval.SetMoveBlocks(_move_blocks);
+    fg_eval.SetReduced(state[4], state[5]);
+    fg_eval._reference = reference;
+    if (_persistent_tape)
+    {
+        // [coeffs | cte | etheta | values]
+        const TapeLayout layout = tapeLayout(coeffs.size(), reference, false, 0, false);
+        const size_t n_params = numParams(layout, _mpc_steps);
+        useOrderTape(n_vars, n_params, reference);
+        if (!_tape_solver || _tape_stale || _tape_solver->NumVars() != n_vars
+            || _tape_solver->NumParams() != n_params || _tape_reference != reference)
+        {
+            if (!_tape_solver)
+            {
+                _tape_solver = std::make_shared<TapeSolver>();
+            }
+            _tape_stale = false;
+            _tape_reference = reference;
+            _mpc_tape_ms += recordTape(*_tape_solver, _params, layout);
+        }
 
+        Dvector &params = _buffers.params;
+        params.resize(n_params);
+        for (int i = 0; i < coeffs.size(); i++)
+        {
+            params[i] = coeffs[i];
+        }
+        params[coeffs.size()] = state[4];
+        params[coeffs.size() + 1] = state[5];
+        if (layout.values)
+        {
+            fg_eval.Values(&params[coeffs.size() + 2]);
+        }
+        _tape_solver->SetHessianColoring(_hessian_coloring);
+        _tape_solver->SetHessianReuse(_hessian_reuse, _hessian_reuse_step, _hessian_reuse_lambda);
+        _tape_solver->SetTaylorCapacity(_taylor_capacity);
+        _tape_solver->SetSparsity(_sparsity);
+        _tape_solver->SetTimeLimit(_deadline);
+        _tape_solver->SetCancel(&_cancel);
+        setInputStop(2 * _mpc_steps);
+        setScaling(_scaling_reduced);
+        _tape_solver->Solve(options, params, vars, lowerbound, upperbound, constraints_lowerbound,
+                            constraints_upperbound, reduced, warm ? &vars_zl : NULL, warm ? &vars_zu : NULL,
+                            warm ? &lambda : NULL);
+        _mpc_tape_profile = _tape_solver->Profile();
+    }
+    else
+    {
+        CppAD::ipopt::solve<Dvector, FG_eval>(
+          options, vars, lowerbound, upperbound, constraints_lowerbound, constraints_upperbound, fg_eval, reduced);
+    }
 
-    // options for IPOPT solver
-    std::string options;
-    // Uncomment this if you'd like more print information
-    options += "Integer print_level  0\n";
-    // NOTE: Setting sparse to true allows the solver to take advantage
-    // of sparse routines, this makes the computation MUCH FASTER. If you
-    // can uncomment 1 of these and see if it makes a difference or not but
-    // if you uncomment both the computation time should go up in orders of
-    // magnitude.
-    options += "Sparse  true        forward\n";
-    options += "Sparse  true        reverse\n";
-    // NOTE: Currently the solver has a maximum time limit of 0.5 seconds.
-    // Change this as you see fit.
-    options += "Numeric max_cpu_time          0.5\n";
+    // Back to the full layout, with the errors of the solution
+    Dvector c(coeffs.size()), cte, etheta;
+    for (int i = 0; i < coeffs.size(); i++)
+    {
+        c[i] = coeffs[i];
+    }
+    if (reduced.x.size() == n_vars)
+    {
+        fg_eval.Errors(reduced.x, c, fg_eval._dt, cte, etheta);
+    }
+    reduced_state::ExpandSolution(_mpc_steps, reduced, cte, etheta, solution);
+}
 
-    // place to return solution
-    CppAD::ipopt::solve_result<Dvector> solution;
+void MPC::setInputStop(size_t offset)
+{
+    // The torque model has no plain inputs to watch
+    std::vector<size_t> &watch = _buffers.input_stop;
+    watch.clear();
+    const int steps = std::min(_input_stop, _mpc_steps - 1);
+    for (int i = 0; i < steps && !_wheels.Enabled(); i++)
+    {
+        const int first = _spline.Enabled() ? _spline.First(i) : input(i);
+        const int last = _spline.Enabled() ? first + 3 : first;
+        for (int k = first; k <= last; k++)
+        {
+            // a spline point or block is shared by the steps after it
+            if (!watch.empty() && _angvel_start + k - offset <= watch[watch.size() - 2])
+                continue;
+            watch.push_back(_angvel_start + k - offset);
+            watch.push_back(_a_start + k - offset);
+        }
+    }
+    // Accepted like the iterate of a deadline cut, see solve()
+    _tape_solver->SetInputStop(watch, _input_stop_tol, _input_stop_iters, 1e-4);
+}
 
-    // solve the problem
-    CppAD::ipopt::solve<Dvector, FG_eval>(
-      options, vars, vars_lowerbound, vars_upperbound, constraints_lowerbound,
-      constraints_upperbound, fg_eval, solution);
+void MPC::setScaling(const NlpScaling &layout)
+{
+    if (!_scaling)
+    {
+        return;
+    }
+    updateScaling();
+    _tape_solver->SetScaling(layout.Objective(), layout.X(), layout.G());
+}
 
-    // Check some of the solution values
-    ok &= solution.status == CppAD::ipopt::solve_result<Dvector>::success;
+void MPC::updateScaling()
+{
+    if (!_scaling_stale)
+    {
+        return;
+    }
+    FG_eval eval(Eigen::VectorXd::Zero(1));
+    eval.LoadParams(_params);
+    double horizon = 0.0;
+    for (int i = 0; i < _mpc_steps - 1; i++)
+    {
+        horizon += _step_dt.empty() ? _mpc_dt : _step_dt[i];
+    }
+    NlpScaling::Magnitudes size;
+    size.speed = std::fabs(eval._ref_vel);
+    size.position = size.speed * horizon;
+    size.angvel = _max_angvel;
+    size.accel = _max_throttle;
+    // W_SLACK is an exact penalty, meant to dominate
+    const double weights[] = { eval._w_cte, eval._w_etheta, eval._w_vel, eval._w_angvel, eval._w_accel,
+                               eval._w_angvel_d, eval._w_accel_d, eval._p_cte, eval._p_cte_etheta,
+                               eval._p_etheta, eval._p_vel };
+    size.weight = 0.0;
+    for (double w : weights)
+    {
+        size.weight = std::max(size.weight, std::fabs(w));
+    }
+    _scaling_full.Set(_mpc_steps, _n_inputs, numTorques() + numSlacks(), numTorqueRows() + 2 * numSlacks(), size);
+    _scaling_full.Reduce(_mpc_steps, _scaling_reduced);
+    _scaling_full.Condense(_mpc_steps, _scaling_condensed);
+    _scaling_stale = false;
+}
+
+void MPC::SetToleranceScale(double scale)
+{
+    _tol_scale = std::max(1.0, scale);
+    _policy.SetToleranceScale(_tol_scale);
+}
+
+void MPC::SetIpoptOptions(const std::string &options)
+{
+    _ipopt_options = options;
+}
 
-    // Cost
-    auto cost = solution.obj_value;
-    std::cout << "------------ Total Cost(solution): " << cost << "------------" << std::endl;
-    cout << "-----------------------------------------------" <<endl;
+void MPC::SetGeneratedModel(const std::string &library)
+{
+    _codegen_library = library;
+    cancelTapeBuilds();
+    _tape_solver.reset();
+}
 
-    this->mpc_x = {};
-    this->mpc_y = {};
-    for (int i = 0; i < _mpc_steps; i++) 
+std::function<bool(const std::string &)> MPC::modelGenerator(int n_coeffs, std::string &model) const
+{
+#ifdef MPC_CODEGEN
+    const size_t n_vars = _mpc_steps * 6 + _n_inputs * 2 + numTorques() + numSlacks();
+    const size_t n_constraints = _mpc_steps * 6 + numTorqueRows() + 2 * numSlacks();
+
+    // Same domain as the persistent tape: [vars | coeffs]
+    FG_eval gen_eval(Eigen::VectorXd::Zero(n_coeffs));
+    gen_eval.LoadParams(_params);
+    gen_eval.SetMoveBlocks(_move_blocks);
+    gen_eval._coeff_start = n_vars;
+    model = gen_eval.ModelName(n_coeffs);
+    const std::string name = model;
+    return [gen_eval, name, n_vars, n_constraints, n_coeffs](const std::string &library)
     {
-        this->mpc_x.push_back(solution.x[_x_start + i]);
-        this->mpc_y.push_back(solution.x[_y_start + i]);
+        cout << "MPC: generating " << name << " (" << n_vars << " vars, " << n_constraints
+             << " constraints) into " << library << endl;
+        return CodegenModel::Generate(library, name, n_vars, n_constraints, n_coeffs, gen_eval);
+    };
+#else
+    model.clear();
+    return std::function<bool(const std::string &)>();
+#endif
+}
+
+bool MPC::GenerateModel(const std::string &library, int n_coeffs)
+{
+    std::string model;
+    std::function<bool(const std::string &)> generate = modelGenerator(n_coeffs, model);
+    if (!generate)
+    {
+        cout << "MPC: built without BUILD_CODEGEN, cannot generate " << library << endl;
+        return false;
     }
-    vector<double> result;
-    result.push_back(solution.x[_angvel_start]);
-    result.push_back(solution.x[_a_start]);
-    return result;
+    return generate(library);
+}
+
+// One library per model, the name holds the weights
+static std::string jitLibrary(const std::string &directory, const std::string &model)
+{
+    std::ostringstream library;
+    library << directory << "/mpc_jit_" << std::hex << std::hash<std::string>()(model);
+    return library.str();
+}
+
+void MPC::SetExecutor(const Executor &executor)
+{
+    _control_pool = executor.Pool(Executor::CONTROL);
+    _background_pool = executor.Pool(Executor::BACKGROUND);
+    if (_hessian_threads > 1 && _control_pool && _stage_pool != _control_pool)
+    {
+        // The recorded stages keep the pool they were split for
+        _stage_pool = _control_pool;
+        _tape_stale = true;
+    }
+    if (_jit)
+    {
+        SetJit(_jit_dir);
+    }
+}
+
+void MPC::SetJit(const std::string &directory)
+{
+    _jit_dir = directory;
+    _jit_model.clear();
+    _jit_job = ModelJit::Job();
+    _jit.reset();
+    // The compiled models take the values as literals, see tapeLayout()
+    cancelTapeBuilds();
+    _tape_stale = true;
+    _order_tapes.clear();
+    _horizon_stale.assign(_horizon_stale.size(), true);
+#ifdef MPC_CODEGEN
+    if (!_jit_dir.empty())
+    {
+        _jit = std::make_shared<ModelJit>(_background_pool);
+    }
+#else
+    if (!_jit_dir.empty())
+    {
+        cout << "MPC: built without BUILD_CODEGEN, solving on the CppAD tape only" << endl;
+    }
+#endif
+}
+
+void MPC::prepareJit(int n_coeffs)
+{
+    const std::function<bool(const std::string &)> generate = modelGenerator(n_coeffs, _jit_model);
+    if (!generate)
+    {
+        return;
+    }
+    _jit_job = std::bind(generate, jitLibrary(_jit_dir, _jit_model));
+}
+
+void MPC::pollJit()
+{
+    if (_jit->Ready(_jit_model))
+    {
+        // A new solver, so that the tape stays if the library does not load
+        std::shared_ptr<TapeSolver> compiled = std::make_shared<TapeSolver>();
+        compiled->SetGaussNewton(_hessian_mode == 1);
+        compiled->SetOptimize(_tape_optimize);
+        if (compiled->LoadGenerated(jitLibrary(_jit_dir, _jit_model), _jit_model, _tape_solver->NumVars(),
+                                    _tape_solver->NumConstraints(), _tape_solver->NumParams()))
+        {
+            _tape_solver = compiled;
+        }
+        _jit_model.clear();
+        _jit_job = ModelJit::Job();
+    }
+    else if (_jit_job && _jit->Request(_jit_model, _jit_job))
+    {
+        _jit_job = ModelJit::Job();
+    }
+}
+
+int MPC::CalibrateLinearSolver(const std::map<string, double> &params, std::string &report, int solves)
+{
+    typedef CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> Result;
+    const double v = params.find("REF_V") != params.end() ? 0.5 * params.at("REF_V") : 0.5;
+    std::ostringstream text;
+    int best = linear_solver::DEFAULT, best_failures = solves + 1;
+    double best_ms = 0.0;
+    for (int backend = linear_solver::MUMPS; backend < linear_solver::NUM_BACKENDS; backend++)
+    {
+        std::map<string, double> backend_params = params;
+        backend_params["LINEAR_SOLVER"] = backend;
+        MPC mpc;
+        mpc.LoadParams(backend_params);
+
+        // Offsets and curvatures of a path ahead, the first solve also
+        // records the tapes and loads the backend and is not timed
+        int failures = 0;
+        double total_ms = 0.0;
+        for (int i = 0; i <= solves; i++)
+        {
+            const double phase = 2.0 * M_PI * i / std::max(solves, 1);
+            const double cte = 0.3 * std::sin(phase), etheta = 0.3 * std::cos(phase);
+            Eigen::VectorXd coeffs(4), state(6);
+            coeffs << cte, std::tan(etheta), 0.2 * std::sin(2.0 * phase), 0.0;
+            state << 0.0, 0.0, 0.0, v, cte, -etheta;
+            const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+            mpc.Solve(state, coeffs);
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+            const bool ok = mpc._mpc_status == Result::success || mpc._mpc_status == Result::stop_at_acceptable_point;
+            if (i == 0 && !ok)
+            {
+                failures = -1;
+                break;
+            }
+            if (i > 0)
+            {
+                total_ms += ms;
+                failures += ok ? 0 : 1;
+            }
+        }
+
+        text << (backend > linear_solver::MUMPS ? ", " : "") << linear_solver::Name(backend);
+        if (failures < 0)
+        {
+            text << " unavailable";
+            continue;
+        }
+        const double mean_ms = total_ms / std::max(solves, 1);
+        text << " " << mean_ms << " ms";
+        if (failures > 0)
+        {
+            text << " (" << failures << " failed)";
+        }
+        if (failures < best_failures || (failures == best_failures && mean_ms < best_ms))
+        {
+            best = backend;
+            best_failures = failures;
+            best_ms = mean_ms;
+        }
+    }
+    report = text.str();
+    return best;
+}
+
+// ====================================
+// Speed kernel, see mpc_fg_eval.h
+// ====================================
+void mpc_fg_eval_size(const std::map<string, double> &params, size_t &n, size_t &m)
+{
+    FG_eval fg_eval(Eigen::VectorXd::Zero(4));
+    fg_eval.LoadParams(params);
+    n = fg_eval._mpc_steps * 6 + fg_eval.NumInputs() * 2 + fg_eval.NumTorques() + fg_eval.NumSlacks();
+    m = 1 + fg_eval._mpc_steps * 6 + fg_eval.NumTorqueRows() + fg_eval.NumSlackRows();
+}
+
+template <class Scalar>
+void mpc_fg_eval(const std::map<string, double> &params, const Eigen::VectorXd &coeffs,
+                 const CPPAD_TESTVECTOR(Scalar) &x, CPPAD_TESTVECTOR(Scalar) &fg)
+{
+    FG_eval fg_eval(coeffs);
+    fg_eval.LoadParams(params);
+    size_t n, m;
+    mpc_fg_eval_size(params, n, m);
+    fg.resize(m);
+    fg_eval(fg, x);
 }
+
+template void mpc_fg_eval<double>(const std::map<string, double> &, const Eigen::VectorXd &,
+                                  const CPPAD_TESTVECTOR(double) &, CPPAD_TESTVECTOR(double) &);
+template void mpc_fg_eval<AD<double> >(const std::map<string, double> &, const Eigen::VectorXd &,
+                                       const CPPAD_TESTVECTOR(AD<double>) &, CPPAD_TESTVECTOR(AD<double>) &);
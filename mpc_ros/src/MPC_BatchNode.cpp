@@ -0,0 +1,581 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "ros/ros.h"
+#include <mpc_ros/SolveBatch.h>
+
+#include "MPC.h"
+#include "tape_solver.h"
+#include "work_stealing_pool.h"
+#include "numa_topology.h"
+#include "remote_solve.h"
+#include <Eigen/Core>
+
+using namespace std;
+
+/********************/
+/* CLASS DEFINITION */
+/********************/
+// Solves the MPC of many robots in one process, e.g. on an edge server for
+// robots that offload their control. Each robot keeps its own MPC (tape,
+// warm start, Ipopt application), created on its first request, and is
+// solved on the worker pool. Requests of one robot are solved one at a time.
+// Robots with the same parameters solve on one shared read-only tape (see
+// MPC::ShareTape()), recorded by the first of them.
+// With udp_port set the same solves are served to RemoteSolveClient (see
+// remote_solve.h) one datagram per request, without the service round trip.
+// With numa the workers are spread over the NUMA nodes and kept on them
+// (numa_topology.h). A robot belongs to the node of its home worker: its MPC
+// is created there, on its first solve, idle workers of that node steal its
+// solves first, and the robots of one node share a tape of their own.
+class MPCBatchNode
+{
+    public:
+        MPCBatchNode(ros::NodeHandle nh = ros::NodeHandle(), ros::NodeHandle pn = ros::NodeHandle("~"));
+        ~MPCBatchNode();
+        int get_thread_numbers();
+
+    private:
+        struct Robot
+        {
+            std::mutex mutex; // one solve at a time
+            std::unique_ptr<MPC> mpc; // created by the first solve, on a worker of node
+            int node;         // NUMA node of home
+            map<string, double> params;
+            bool loaded;
+            bool pinned;      // keeps CppAD memory across solves, stays on its home worker
+            int home;         // worker of the robot
+            bool sharing;     // uses or provides the shared tape of params
+            ros::WallTime last_seen;
+        };
+
+        // Tape shared by the robots of one parameter set
+        struct SharedModel
+        {
+            std::shared_ptr<const SharedTape> tape;
+            string owner; // robot that recorded it
+            int home;     // its worker, where the tape has to be released
+        };
+
+        ros::NodeHandle _nh;
+        ros::ServiceServer _srv_batch;
+
+        map<string, double> _mpc_params; // defaults of every robot
+        map<string, std::shared_ptr<Robot> > _robots;
+        std::mutex _robots_mutex;
+        std::unique_ptr<WorkStealingPool> _pool;
+        int _thread_numbers, _next_home;
+        NumaTopology _numa;
+        std::vector<int> _worker_node; // of every worker, all 0 without numa
+        double _robot_timeout;
+        bool _share_tapes;
+        // by NUMA node (0 without numa) and parameters
+        typedef std::pair<int, map<string, double> > SharedKey;
+        map<SharedKey, SharedModel> _shared_tapes;
+        std::mutex _shared_mutex;
+
+        // Parameters the UDP clients sent last, by robot
+        struct RemoteParams
+        {
+            uint32_t version;
+            map<string, double> params; // over _mpc_params
+        };
+        int _udp_socket;
+        std::thread _udp_thread;
+        map<string, RemoteParams> _remote_params; // _udp_thread only
+
+        bool solveBatchCB(mpc_ros::SolveBatch::Request &req, mpc_ros::SolveBatch::Response &res);
+        std::shared_ptr<Robot> getRobot(const string &robot_id, const ros::WallTime &now, bool pin, bool &pinned);
+        void solve(Robot &robot, const string &robot_id, const mpc_ros::RobotSolveRequest &req,
+                   const map<string, double> &params, const ros::WallTime &received,
+                   mpc_ros::RobotSolveResult &result);
+        bool openUdp(int port);
+        void udpLoop();
+        void udpRequest(const remote_solve::Request &packet, const sockaddr_storage &from, socklen_t from_len);
+        void udpReply(const remote_solve::Header &request, uint32_t code, const mpc_ros::RobotSolveResult *result,
+                      const sockaddr_storage &from, socklen_t from_len);
+};
+
+MPCBatchNode::MPCBatchNode(ros::NodeHandle nh, ros::NodeHandle pn) : _nh(nh)
+{
+    int workers, controller_freq, udp_port;
+    double mpc_steps, ref_cte, ref_vel, ref_etheta, w_cte, w_etheta, w_vel, w_angvel, w_angvel_d, w_accel, w_accel_d;
+    double max_angvel, max_throttle, bound_value;
+    bool persistent_tape, warm_start, pursuit_seed, rti, ltv, analytic, numa;
+    int hessian;
+
+    pn.param("thread_numbers", _thread_numbers, 2); // service callbacks, several batches can be in flight
+    pn.param("workers", workers, int(std::max(1u, std::thread::hardware_concurrency())));
+    pn.param("robot_timeout", _robot_timeout, 60.0); // drop the solver state of robots silent this long [s]
+    pn.param("share_tapes", _share_tapes, true); // one persistent tape per parameter set instead of per robot
+    pn.param("controller_freq", controller_freq, 10);
+    pn.param("udp_port", udp_port, 0); // requests of RemoteSolveClient (remote_solve_address of MPC_Node), 0 disables
+    pn.param("numa", numa, false); // keep the workers and the memory of each robot on one NUMA node
+
+    //Default parameters of the robots, the request params override them
+    pn.param("mpc_steps", mpc_steps, 40.0);
+    pn.param("mpc_ref_cte", ref_cte, 0.0);
+    pn.param("mpc_ref_vel", ref_vel, 1.0);
+    pn.param("mpc_ref_etheta", ref_etheta, 0.0);
+    pn.param("mpc_w_cte", w_cte, 5000.0);
+    pn.param("mpc_w_etheta", w_etheta, 5000.0);
+    pn.param("mpc_w_vel", w_vel, 1.0);
+    pn.param("mpc_w_angvel", w_angvel, 100.0);
+    pn.param("mpc_w_angvel_d", w_angvel_d, 10.0);
+    pn.param("mpc_w_accel", w_accel, 50.0);
+    pn.param("mpc_w_accel_d", w_accel_d, 10.0);
+    pn.param("mpc_max_angvel", max_angvel, 3.0);
+    pn.param("mpc_max_throttle", max_throttle, 1.0);
+    pn.param("mpc_bound_value", bound_value, 1.0e3);
+    pn.param("mpc_persistent_tape", persistent_tape, false); // pins the robot to one worker, see below
+    pn.param("mpc_warm_start", warm_start, true);
+    pn.param("mpc_pursuit_seed", pursuit_seed, true);
+    pn.param("mpc_rti", rti, false);
+    pn.param("mpc_ltv", ltv, false);
+    pn.param("mpc_analytic", analytic, true);
+    pn.param("mpc_hessian", hessian, 0);
+
+    _mpc_params["DT"] = 1.0 / controller_freq;
+    _mpc_params["STEPS"]    = mpc_steps;
+    _mpc_params["REF_CTE"]  = ref_cte;
+    _mpc_params["REF_ETHETA"] = ref_etheta;
+    _mpc_params["REF_V"]    = ref_vel;
+    _mpc_params["W_CTE"]    = w_cte;
+    _mpc_params["W_EPSI"]   = w_etheta;
+    _mpc_params["W_V"]      = w_vel;
+    _mpc_params["W_ANGVEL"]  = w_angvel;
+    _mpc_params["W_A"]      = w_accel;
+    _mpc_params["W_DANGVEL"] = w_angvel_d;
+    _mpc_params["W_DA"]     = w_accel_d;
+    _mpc_params["ANGVEL"]   = max_angvel;
+    _mpc_params["MAXTHR"]   = max_throttle;
+    _mpc_params["BOUND"]    = bound_value;
+    _mpc_params["TAPE"]     = persistent_tape;
+    _mpc_params["WARM"]     = warm_start;
+    _mpc_params["PURSUIT_SEED"] = pursuit_seed;
+    _mpc_params["RTI"]      = rti;
+    _mpc_params["LTV"]      = ltv;
+    _mpc_params["ANALYTIC"] = analytic;
+    _mpc_params["HESSIAN"]  = hessian;
+    _mpc_params["HYPOTHESES"] = 1;
+
+    cout << "\n===== Parameters =====" << endl;
+    cout << "workers: " << workers << endl;
+    cout << "robot_timeout: " << _robot_timeout << endl;
+    cout << "share_tapes: " << _share_tapes << endl;
+    cout << "mpc_steps: " << mpc_steps << endl;
+
+    cout << "numa: " << numa << " (" << _numa.Nodes() << " nodes)" << endl;
+
+    _next_home = 0;
+    workers = max(1, workers);
+    _worker_node = numa ? _numa.Spread(workers) : vector<int>(workers, 0);
+    WorkStealingPool::Init init;
+    if (numa && _numa.Nodes() > 1)
+    {
+        // Before its first solve, so all it allocates comes from its node
+        const NumaTopology *topology = &_numa;
+        const vector<int> nodes = _worker_node;
+        init = [topology, nodes](int index)
+        {
+            std::string report;
+            if (!topology->BindThread(nodes[index], report))
+                ROS_WARN("Worker %d is not kept on NUMA node %d: %s", index, topology->Id(nodes[index]), report.c_str());
+        };
+    }
+    _pool.reset(new WorkStealingPool(workers, init, _worker_node));
+    _srv_batch = _nh.advertiseService("solve_batch", &MPCBatchNode::solveBatchCB, this);
+    _udp_socket = -1;
+    if (udp_port > 0 && openUdp(udp_port))
+    {
+        cout << "udp_port: " << udp_port << endl;
+        _udp_thread = std::thread(&MPCBatchNode::udpLoop, this);
+    }
+}
+
+MPCBatchNode::~MPCBatchNode()
+{
+    if (_udp_thread.joinable())
+        _udp_thread.join();
+    // Solves in flight reply on the socket
+    _pool.reset();
+    if (_udp_socket >= 0)
+        close(_udp_socket);
+}
+
+// Public: return _thread_numbers
+int MPCBatchNode::get_thread_numbers()
+{
+    return _thread_numbers;
+}
+
+std::shared_ptr<MPCBatchNode::Robot> MPCBatchNode::getRobot(const string &robot_id, const ros::WallTime &now,
+                                                             bool pin, bool &pinned)
+{
+    std::lock_guard<std::mutex> lock(_robots_mutex);
+
+    // Robots gone silent. A pinned one is released on its home worker, where
+    // its CppAD memory was allocated.
+    for (map<string, std::shared_ptr<Robot> >::iterator it = _robots.begin(); it != _robots.end();)
+    {
+        if (_robot_timeout > 0 && it->first != robot_id && (now - it->second->last_seen).toSec() > _robot_timeout)
+        {
+            ROS_INFO("Dropping the solver of robot %s", it->first.c_str());
+            std::shared_ptr<Robot> robot = it->second;
+            _pool->Submit(robot->home, [robot]() mutable { robot.reset(); }, true);
+            it = _robots.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    // Shared tapes nobody uses any more once their owner is gone, released
+    // on its worker as well
+    {
+        std::lock_guard<std::mutex> shared_lock(_shared_mutex);
+        for (map<SharedKey, SharedModel>::iterator it = _shared_tapes.begin(); it != _shared_tapes.end();)
+        {
+            if (it->second.tape.use_count() == 1 && !_robots.count(it->second.owner))
+            {
+                std::shared_ptr<const SharedTape> tape = it->second.tape;
+                _pool->Submit(it->second.home, [tape]() mutable { tape.reset(); }, true);
+                it = _shared_tapes.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
+    std::shared_ptr<Robot> &robot = _robots[robot_id];
+    if (!robot)
+    {
+        robot = std::make_shared<Robot>();
+        robot->loaded = false;
+        robot->pinned = false;
+        robot->home = _next_home++ % _pool->Size();
+        robot->node = _worker_node[robot->home];
+        robot->sharing = false;
+    }
+    robot->last_seen = now;
+    // Once pinned always pinned, the memory outlives a change of parameters
+    robot->pinned = robot->pinned || pin;
+    pinned = robot->pinned;
+    return robot;
+}
+
+bool MPCBatchNode::solveBatchCB(mpc_ros::SolveBatch::Request &req, mpc_ros::SolveBatch::Response &res)
+{
+    const ros::WallTime received = ros::WallTime::now();
+    res.results.resize(req.requests.size());
+
+    std::mutex done_mutex;
+    std::condition_variable done_cond;
+    size_t left = req.requests.size();
+    vector<map<string, double> > params(req.requests.size(), _mpc_params);
+
+    for (size_t i = 0; i < req.requests.size(); i++)
+    {
+        const mpc_ros::RobotSolveRequest &request = req.requests[i];
+        mpc_ros::RobotSolveResult &result = res.results[i];
+        result.robot_id = request.robot_id;
+        if (request.robot_id.empty() || request.coeffs.empty() || request.param_keys.size() != request.param_values.size())
+        {
+            result.result = mpc_ros::RobotSolveResult::INVALID;
+            std::lock_guard<std::mutex> lock(done_mutex);
+            left--;
+            continue;
+        }
+
+        for (size_t k = 0; k < request.param_keys.size(); k++)
+            params[i][request.param_keys[k]] = request.param_values[k];
+
+        // The persistent tape and the multi-start results live in CppAD
+        // memory, which has to be freed by the thread that allocated it.
+        const bool pin = params[i]["TAPE"] != 0 || params[i]["HYPOTHESES"] > 1;
+        bool pinned;
+        std::shared_ptr<Robot> robot = getRobot(request.robot_id, received, pin, pinned);
+        const map<string, double> &robot_params = params[i];
+        _pool->Submit(robot->home, [this, robot, &request, &robot_params, &result, &received, &done_mutex, &done_cond, &left]
+        {
+            solve(*robot, request.robot_id, request, robot_params, received, result);
+            std::lock_guard<std::mutex> lock(done_mutex);
+            if (--left == 0)
+                done_cond.notify_one();
+        }, pinned);
+    }
+
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_cond.wait(lock, [&left] { return left == 0; });
+    return true;
+}
+
+void MPCBatchNode::solve(Robot &robot, const string &robot_id, const mpc_ros::RobotSolveRequest &req,
+                         const map<string, double> &params, const ros::WallTime &received,
+                         mpc_ros::RobotSolveResult &result)
+{
+    std::lock_guard<std::mutex> lock(robot.mutex);
+    const ros::WallTime begin = ros::WallTime::now();
+    result.queue_ms = (begin - received).toSec() * 1e3;
+
+    const double remaining = req.deadline - (begin - received).toSec();
+    if (req.deadline > 0 && remaining <= 0)
+    {
+        result.result = mpc_ros::RobotSolveResult::EXPIRED;
+        return;
+    }
+
+    // On a worker of its node, as everything it allocates later
+    if (!robot.mpc)
+        robot.mpc.reset(new MPC());
+    MPC &mpc = *robot.mpc;
+
+    // Reload only on a change, it re-records the tape
+    if (!robot.loaded || params != robot.params)
+    {
+        mpc.LoadParams(params);
+        robot.params = params;
+        robot.loaded = true;
+        robot.sharing = false;
+    }
+
+    // Solve on the tape of another robot with these parameters if there is one
+    const bool share = _share_tapes && params.at("TAPE") != 0;
+    if (share && !robot.sharing)
+    {
+        std::lock_guard<std::mutex> shared_lock(_shared_mutex);
+        map<SharedKey, SharedModel>::iterator it = _shared_tapes.find(SharedKey(robot.node, params));
+        if (it != _shared_tapes.end())
+        {
+            mpc.UseSharedTape(it->second.tape);
+            robot.sharing = true;
+        }
+    }
+
+    Eigen::VectorXd state(6);
+    for (int i = 0; i < 6; i++)
+        state[i] = req.state[i];
+    Eigen::VectorXd coeffs = Eigen::Map<const Eigen::VectorXd>(req.coeffs.data(), req.coeffs.size());
+
+    mpc.SetDeadline(req.deadline > 0 ? remaining : 0.0);
+    const vector<double> cmd = mpc.Solve(state, coeffs);
+
+    // or else offer the tape just recorded to the next ones
+    if (share && !robot.sharing)
+    {
+        std::shared_ptr<const SharedTape> tape = mpc.ShareTape();
+        if (tape)
+        {
+            std::lock_guard<std::mutex> shared_lock(_shared_mutex);
+            const SharedKey key(robot.node, params);
+            if (!_shared_tapes.count(key))
+            {
+                SharedModel &model = _shared_tapes[key];
+                model.tape = tape;
+                model.owner = robot_id;
+                model.home = robot.home;
+            }
+        }
+        robot.sharing = true;
+    }
+
+    result.status = mpc._mpc_status;
+    result.iterations = mpc._mpc_iterations;
+    result.objective = mpc._mpc_totalcost;
+    if (mpc._mpc_fallback)
+        result.result = mpc_ros::RobotSolveResult::FALLBACK;
+    else if (result.status == CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)>::success
+             || result.status == CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)>::stop_at_acceptable_point)
+        result.result = mpc_ros::RobotSolveResult::SOLVED;
+    else
+        result.result = mpc_ros::RobotSolveResult::FAILED;
+    result.angvel = cmd[0];
+    result.accel = cmd[1];
+    result.mpc_x = mpc.mpc_x;
+    result.mpc_y = mpc.mpc_y;
+    result.mpc_theta = mpc.mpc_theta;
+    result.mpc_angvel = mpc.mpc_angvel;
+    result.mpc_accel = mpc.mpc_accel;
+    result.solve_ms = (ros::WallTime::now() - begin).toSec() * 1e3;
+}
+
+// IPv6 socket that takes IPv4 clients as well
+bool MPCBatchNode::openUdp(int port)
+{
+    _udp_socket = socket(AF_INET6, SOCK_DGRAM, 0);
+    const int off = 0;
+    sockaddr_in6 addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin6_family = AF_INET6;
+    addr.sin6_addr = in6addr_any;
+    addr.sin6_port = htons(port);
+    if (_udp_socket < 0 || setsockopt(_udp_socket, IPPROTO_IPV6, IPV6_V6ONLY, &off, sizeof(off)) != 0
+        || bind(_udp_socket, (const sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        ROS_WARN("No remote solves, cannot bind udp_port %d: %s", port, strerror(errno));
+        if (_udp_socket >= 0)
+            close(_udp_socket);
+        _udp_socket = -1;
+        return false;
+    }
+    return true;
+}
+
+void MPCBatchNode::udpLoop()
+{
+    union
+    {
+        remote_solve::Header header;
+        remote_solve::Request request;
+        remote_solve::Params params;
+    } packet;
+
+    while (ros::ok())
+    {
+        pollfd fd;
+        fd.fd = _udp_socket;
+        fd.events = POLLIN;
+        if (poll(&fd, 1, 100) <= 0)
+            continue;
+        sockaddr_storage from;
+        socklen_t from_len = sizeof(from);
+        const ssize_t length = recvfrom(_udp_socket, &packet, sizeof(packet), 0, (sockaddr *)&from, &from_len);
+        if (length < ssize_t(sizeof(remote_solve::Header)))
+            continue;
+
+        if (remote_solve::Valid(packet.header, remote_solve::PARAMS))
+        {
+            map<string, double> params;
+            if (!remote_solve::DecodeParams(packet.params, length, params))
+            {
+                ROS_WARN("Malformed parameters of robot %s", packet.header.robot_id);
+                continue;
+            }
+            RemoteParams &remote = _remote_params[packet.header.robot_id];
+            remote.version = packet.header.params_version;
+            remote.params = _mpc_params;
+            for (map<string, double>::const_iterator it = params.begin(); it != params.end(); ++it)
+            {
+                // Threads are the server's business
+                if (it->first != "LINEAR_THREADS" && it->first != "HESSIAN_THREADS" && it->first != "REMOTE_TIMEOUT")
+                    remote.params[it->first] = it->second;
+            }
+        }
+        else if (length == ssize_t(sizeof(remote_solve::Request)) && remote_solve::Valid(packet.header, remote_solve::REQUEST))
+        {
+            udpRequest(packet.request, from, from_len);
+        }
+    }
+}
+
+void MPCBatchNode::udpRequest(const remote_solve::Request &packet, const sockaddr_storage &from, socklen_t from_len)
+{
+    const ros::WallTime received = ros::WallTime::now();
+    const string robot_id = packet.header.robot_id;
+    map<string, RemoteParams>::const_iterator remote = _remote_params.find(robot_id);
+    if (remote == _remote_params.end() || remote->second.version != packet.header.params_version)
+    {
+        udpReply(packet.header, remote_solve::UNKNOWN_PARAMS, NULL, from, from_len);
+        return;
+    }
+    if (packet.n_coeffs == 0 || packet.n_coeffs > uint32_t(remote_solve::MAX_COEFFS))
+    {
+        udpReply(packet.header, remote_solve::INVALID, NULL, from, from_len);
+        return;
+    }
+
+    std::shared_ptr<mpc_ros::RobotSolveRequest> request = std::make_shared<mpc_ros::RobotSolveRequest>();
+    request->robot_id = robot_id;
+    for (int i = 0; i < 6; i++)
+        request->state[i] = packet.state[i];
+    request->coeffs.assign(packet.coeffs, packet.coeffs + packet.n_coeffs);
+    request->deadline = packet.deadline;
+    const map<string, double> &params = remote->second.params;
+    const bool pin = params.at("TAPE") != 0 || params.at("HYPOTHESES") > 1;
+    bool pinned;
+    std::shared_ptr<Robot> robot = getRobot(robot_id, received, pin, pinned);
+    const remote_solve::Header header = packet.header;
+    _pool->Submit(robot->home, [this, robot, request, params, received, header, from, from_len]
+    {
+        mpc_ros::RobotSolveResult result;
+        result.robot_id = request->robot_id;
+        solve(*robot, request->robot_id, *request, params, received, result);
+        udpReply(header, result.result, &result, from, from_len);
+    }, pinned);
+}
+
+void MPCBatchNode::udpReply(const remote_solve::Header &request, uint32_t code, const mpc_ros::RobotSolveResult *result,
+                            const sockaddr_storage &from, socklen_t from_len)
+{
+    remote_solve::Reply reply;
+    memset(&reply, 0, sizeof(reply));
+    reply.header = request;
+    reply.header.type = remote_solve::REPLY;
+    reply.result = code;
+    reply.iterations = -1;
+    if (result)
+    {
+        reply.status = result->status;
+        reply.iterations = result->iterations;
+        reply.objective = result->objective;
+        reply.angvel = result->angvel;
+        reply.accel = result->accel;
+        reply.solve_ms = result->solve_ms;
+        const mpc_ros::RobotSolveResult &r = *result;
+        reply.steps = std::min<size_t>(r.mpc_x.size(), remote_solve::MAX_STEPS);
+        for (uint32_t i = 0; i < reply.steps; i++)
+        {
+            reply.x[i] = r.mpc_x[i];
+            reply.y[i] = r.mpc_y[i];
+            reply.theta[i] = r.mpc_theta[i];
+        }
+        for (uint32_t i = 0; i + 1 < reply.steps && i < r.mpc_angvel.size(); i++)
+        {
+            reply.angvel_seq[i] = r.mpc_angvel[i];
+            reply.accel_seq[i] = r.mpc_accel[i];
+        }
+    }
+    sendto(_udp_socket, &reply, sizeof(reply), 0, (const sockaddr *)&from, from_len);
+}
+
+/*****************/
+/* MAIN FUNCTION */
+/*****************/
+int main(int argc, char **argv)
+{
+    //Initiate ROS
+    ros::init(argc, argv, "mpc_batch_server");
+    MPCBatchNode batch_node;
+
+    ROS_INFO("Waiting for solve_batch requests ~");
+    ros::AsyncSpinner spinner(batch_node.get_thread_numbers()); // Use multi threads
+    spinner.start();
+    ros::waitForShutdown();
+    return 0;
+}
@@ -29,13 +29,18 @@
 #include <nav_msgs/Odometry.h>
 #include <ackermann_msgs/AckermannDriveStamped.h>
 #include <visualization_msgs/Marker.h>
+#include <boost/make_shared.hpp>
 
 #include <Eigen/Core>
 #include <Eigen/QR>
 #include <vector>
 
 #include <string>
-#include <fstream>
+#include "trajectory_log.h"
+#include "transform_cache.h"
+#include "path_transform.h"
+#include "compact_path_msg.h"
+#include "lookahead_path.h"
 
 using namespace std;
 using std::string;
@@ -46,7 +51,7 @@ using std::string;
 class PurePursuit
 {
     public:
-        PurePursuit();
+        PurePursuit(ros::NodeHandle nh = ros::NodeHandle(), ros::NodeHandle pn = ros::NodeHandle("~"));
         void initMarker();
         bool isForwardWayPt(const geometry_msgs::Point& wayPt, const geometry_msgs::Pose& carPose);
         bool isWayPtAwayFromLfwDist(const geometry_msgs::Point& wayPt, const geometry_msgs::Point& car_pos);
@@ -69,6 +74,9 @@ class PurePursuit
         ros::Publisher ackermann_pub, cmdvel_pub, marker_pub;
         ros::Timer timer1, timer2;
         tf::TransformListener tf_listener;
+        TransformCache _tf_cache; // see transform_cache.h
+        PathTransform _path_transform; // path callback buffers, see path_transform.h
+        LookaheadPath _lookahead; // _odom_path for get_alpha, see lookahead_path.h
 
         ros::Time tracking_stime;
         ros::Time tracking_etime;
@@ -80,7 +88,11 @@ class PurePursuit
         bool start_timef = false;
         bool end_timef = false;
 
-        std::ofstream file;
+        // Binary trajectory log, see trajectory_log.h
+        TrajectoryLog _log;
+        string _log_path;
+        double _log_max_mb;
+        int _log_max_files;
     
         double _waypointsDist = -1.0;
         double _pathLength = 8.0;
@@ -88,14 +100,14 @@ class PurePursuit
 
         string _map_frame, _odom_frame, _car_frame;
        
-        unsigned int idx = 0;
 
         visualization_msgs::Marker points, line_strip, goal_circle;
         geometry_msgs::Point odom_goal_pos, goal_pos;
         geometry_msgs::Twist cmd_vel;
         ackermann_msgs::AckermannDriveStamped ackermann_cmd;
         nav_msgs::Odometry odom;
-        nav_msgs::Path map_path, odom_path, odom_path_w, _odom_path;
+        CompactPath map_path;
+        CompactPath::ConstPtr _odom_path;
 
         int _downSampling;
 
@@ -106,7 +118,7 @@ class PurePursuit
         bool foundForwardPt, goal_received, goal_reached, cmd_vel_mode, debug_mode, smooth_accel;
 
         void odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg);
-        void pathCB(const nav_msgs::Path::ConstPtr& pathMsg);
+        void pathCB(const CompactPath::ConstPtr& pathMsg);
         void goalCB(const geometry_msgs::PoseStamped::ConstPtr& goalMsg);
         void amclCB(const geometry_msgs::PoseWithCovarianceStamped::ConstPtr& amclMsg);
         void controlLoopCB(const ros::TimerEvent&);
@@ -114,11 +126,8 @@ class PurePursuit
 }; // end of class
 
 
-PurePursuit::PurePursuit()
+PurePursuit::PurePursuit(ros::NodeHandle nh, ros::NodeHandle pn) : n_(nh)
 {
-    //Private parameters handler
-    ros::NodeHandle pn("~");
-
     //Car parameter
     pn.param("L", L, 0.26); // length of car
     pn.param("Vcmd", Vcmd, 1.0);// reference speed (m/s)
@@ -136,10 +145,19 @@ PurePursuit::PurePursuit()
     pn.param("smooth_accel", smooth_accel, true); // smooth the acceleration of car
     pn.param("speed_incremental", speed_incremental, 0.5); // speed incremental value (discrete acceleraton), unit: m/s
 
+    //Parameter for the trajectory log
+    pn.param<std::string>("log_path", _log_path, ""); // binary log file, empty disables it
+    pn.param("log_max_mb", _log_max_mb, 64.0); // rotate above this size
+    pn.param("log_max_files", _log_max_files, 4); // rotated files kept
+
     //Parameter for topics & Frame name
     pn.param<std::string>("map_frame", _map_frame, "map" ); //*****for mpc, "odom"
     pn.param<std::string>("odom_frame", _odom_frame, "odom");
     pn.param<std::string>("car_frame", _car_frame, "base_footprint" );
+    double tf_max_age;
+    pn.param("tf_max_age", tf_max_age, 0.5); // reuse the last transform this long when TF drops out [s]
+    _tf_cache.SetMaxAge(tf_max_age);
+    _tf_cache.AdvertiseDiagnostics(n_, pn.getNamespace());
 
     //Publishers and Subscribers
     odom_sub = n_.subscribe("/odom", 1, &PurePursuit::odomCB, this);
@@ -164,8 +182,8 @@ PurePursuit::PurePursuit()
     w = 0.0;
     steering = base_angle;
 
-    idx = 0;
-    file.open("/home/nscl1016/catkin_ws/src/mpc_ros/pure_pursuit.csv");
+    if(!_log_path.empty() && !_log.Open(_log_path, _log_max_mb * 1e6, _log_max_files))
+        ROS_WARN("Cannot open the trajectory log %s", _log_path.c_str());
 
 
     //Show info
@@ -229,67 +247,64 @@ void PurePursuit::odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg)
 
 
 
-void PurePursuit::pathCB(const nav_msgs::Path::ConstPtr& pathMsg) //jaewan
+void PurePursuit::pathCB(const CompactPath::ConstPtr& pathMsg) //jaewan
 {
     this->map_path = *pathMsg;
 
     if(goal_received && !goal_reached)
     {    
-        nav_msgs::Path odom_path = nav_msgs::Path();
-        try
+        boost::shared_ptr<CompactPath> odom_path = boost::make_shared<CompactPath>();
+        // map -> odom once for the whole path, without waiting on TF
+        tf::Transform map_to_odom;
+        const std::string &path_frame = pathMsg->Frame().empty() ? _map_frame : pathMsg->Frame();
+        if(!_tf_cache.Lookup(tf_listener, _odom_frame, path_frame, map_to_odom))
+            return; // keep the previous path, the next message retries
+
+        double total_length = 0.0;
+        int sampling = _downSampling;
+
+        //find waypoints distance
+        if(_waypointsDist <=0.0)
+        {        
+            double dx = pathMsg->X(1) - pathMsg->X(0);
+            double dy = pathMsg->Y(1) - pathMsg->Y(0);
+            _waypointsDist = sqrt(dx*dx + dy*dy);
+            _downSampling = int(_pathLength/10.0/_waypointsDist);
+        }            
+
+        // Whole path at once, no messages for the waypoints
+        _path_transform.Transform(map_to_odom, *pathMsg);
+
+        // Cut and downsampling the path
+        for(int i =0; i< pathMsg->Size(); i++)
         {
-            double total_length = 0.0;
-            int sampling = _downSampling;
-
-            //find waypoints distance
-            if(_waypointsDist <=0.0)
-            {        
-                double dx = pathMsg->poses[1].pose.position.x - pathMsg->poses[0].pose.position.x;
-                double dy = pathMsg->poses[1].pose.position.y - pathMsg->poses[0].pose.position.y;
-                _waypointsDist = sqrt(dx*dx + dy*dy);
-                _downSampling = int(_pathLength/10.0/_waypointsDist);
-            }            
-
-            // Cut and downsampling the path
-            for(int i =0; i< pathMsg->poses.size(); i++)
-            {
-                if(total_length > _pathLength)
-                    break;
-
-                if(sampling == _downSampling)
-                {   
-                    geometry_msgs::PoseStamped tempPose;
-                    tf_listener.transformPose(_odom_frame, ros::Time(0) , pathMsg->poses[i], _map_frame, tempPose);                     
-                    odom_path.poses.push_back(tempPose);  
-                    sampling = 0;
-                }
-                total_length = total_length + _waypointsDist; 
-                sampling = sampling + 1;  
-            }
-           
-            if(odom_path.poses.size() >= 6 )
-            {
-                _odom_path = odom_path; // Path waypoints in odom frame
-                _path_computed = true;
-                // publish odom path
-                odom_path.header.frame_id = _odom_frame;
-                odom_path.header.stamp = ros::Time::now();
-            }
-            else
-            {
-                cout << "Failed to path generation" << endl;
-                _waypointsDist = -1;
+            if(total_length > _pathLength)
+                break;
+
+            if(sampling == _downSampling)
+            {   
+                odom_path->PushBack(_path_transform.X(i), _path_transform.Y(i), _path_transform.Yaw(i));
+                sampling = 0;
             }
-            //DEBUG            
-            //cout << endl << "N: " << odom_path.poses.size() << endl 
-            //<<  "Car path[0]: " << odom_path.poses[0];
-            // << ", path[N]: " << _odom_path.poses[_odom_path.poses.size()-1] << endl;
+            total_length = total_length + _waypointsDist; 
+            sampling = sampling + 1;  
         }
-        catch(tf::TransformException &ex)
+       
+        if(odom_path->Size() >= 6 )
+        {
+            odom_path->SetFrame(_odom_frame);
+            odom_path->SetStamp(ros::Time::now());
+            _odom_path = odom_path; // Path waypoints in odom frame
+            _lookahead.Set(_odom_path);
+            _path_computed = true;
+        }
+        else
         {
-            ROS_ERROR("%s",ex.what());
-            ros::Duration(1.0).sleep();
+            cout << "Failed to path generation" << endl;
+            _waypointsDist = -1;
         }
+        //DEBUG            
+        //cout << endl << "N: " << odom_path->Size() << endl;
     }
     
 }
@@ -298,38 +313,27 @@ void PurePursuit::pathCB(const nav_msgs::Path::ConstPtr& pathMsg) //jaewan
 void PurePursuit::goalCB(const geometry_msgs::PoseStamped::ConstPtr& goalMsg)
 {
     this->goal_pos = goalMsg->pose.position;    
-    try
-    {
-        geometry_msgs::PoseStamped odom_goal;
-        tf_listener.transformPose("odom", ros::Time(0) , *goalMsg, "map" ,odom_goal);
-        odom_goal_pos = odom_goal.pose.position;
-        goal_received = true;
-        goal_reached = false;
-
-        /*Draw Goal on RVIZ*/
-        goal_circle.pose = odom_goal.pose;
-        marker_pub.publish(goal_circle);
-    }
-    catch(tf::TransformException &ex)
-    {
-        ROS_ERROR("%s",ex.what());
-        ros::Duration(1.0).sleep();
-    }
+    tf::Transform map_to_odom;
+    const std::string &goal_frame = goalMsg->header.frame_id.empty() ? _map_frame : goalMsg->header.frame_id;
+    if(!_tf_cache.Lookup(tf_listener, "odom", goal_frame, map_to_odom))
+        return; // the goal is dropped, as before when TF failed
+
+    geometry_msgs::PoseStamped odom_goal;
+    TransformCache::Apply(map_to_odom, *goalMsg, "odom", odom_goal);
+    odom_goal_pos = odom_goal.pose.position;
+    goal_received = true;
+    goal_reached = false;
+
+    /*Draw Goal on RVIZ*/
+    goal_circle.pose = odom_goal.pose;
+    marker_pub.publish(goal_circle);
 }
 
 double PurePursuit::getYawFromPose(const geometry_msgs::Pose& carPose)
 {
-    float x = carPose.orientation.x;
-    float y = carPose.orientation.y;
-    float z = carPose.orientation.z;
-    float w = carPose.orientation.w;
-
-    double tmp,yaw;
-    tf::Quaternion q(x,y,z,w);
-    tf::Matrix3x3 quaternion(q);
-    quaternion.getRPY(tmp,tmp, yaw);
-
-    return yaw;
+    // yaw of the RPY angles, without building the rotation matrix
+    const geometry_msgs::Quaternion &q = carPose.orientation;
+    return atan2(2.0 * (q.w * q.z + q.x * q.y), 1.0 - 2.0 * (q.y * q.y + q.z * q.z));
 }
 
 bool PurePursuit::isForwardWayPt(const geometry_msgs::Point& wayPt, const geometry_msgs::Pose& carPose)
@@ -369,37 +373,27 @@ double PurePursuit::get_alpha(const geometry_msgs::Pose& carPose)
     geometry_msgs::Point odom_car2WayPtVec;
     foundForwardPt = false;
 
-    if(!goal_reached){
-
-        for(int i =0; i< _odom_path.poses.size(); i++)
-        {
-            geometry_msgs::PoseStamped map_path_pose = _odom_path.poses[i];
-            geometry_msgs::PoseStamped odom_path_pose;
-
-            try
-            {
-                tf_listener.transformPose("odom", ros::Time(0) , map_path_pose, "map" ,odom_path_pose);
-                odom_path_wayPt = odom_path_pose.pose.position;
-                bool _isForwardWayPt = isForwardWayPt(odom_path_wayPt,carPose);
-
-                if(_isForwardWayPt)
-                {
-                    bool _isWayPtAwayFromLfwDist = isWayPtAwayFromLfwDist(odom_path_wayPt,carPose_pos);
-                    if(_isWayPtAwayFromLfwDist)
-                    {
-                        forwardPt = odom_path_wayPt;
-                        foundForwardPt = true;
-                        break;
-                    }
-                }
-            }
-            catch(tf::TransformException &ex)
-            {
-                ROS_ERROR("%s",ex.what());
-                ros::Duration(1.0).sleep();
-            }
-        }
-        
+    // pathCB already keeps the path in odom, TF is only asked when the odom
+    // frame has another name; without a transform no waypoint is found and
+    // the car waits for the next cycle
+    tf::Transform path_to_odom = tf::Transform::getIdentity();
+    const bool has_transform = !_lookahead.Empty() &&
+        (_lookahead.Frame() == "odom" ||
+         _tf_cache.Lookup(tf_listener, "odom", _lookahead.Frame(), path_to_odom));
+
+    if(!goal_reached && has_transform){
+
+        // car into the frame of the path, the waypoint found back to odom
+        const tf::Vector3 car = path_to_odom.inverse() * tf::Vector3(carPose_pos.x, carPose_pos.y, carPose_pos.z);
+        const double car_yaw = carPose_yaw - tf::getYaw(path_to_odom.getRotation());
+        double px, py;
+        foundForwardPt = _lookahead.Find(car.x(), car.y(), car_yaw, Lfw, px, py);
+        const tf::Vector3 wayPt = path_to_odom * tf::Vector3(px, py, 0.0);
+        odom_path_wayPt.x = wayPt.x();
+        odom_path_wayPt.y = wayPt.y();
+        odom_path_wayPt.z = wayPt.z();
+        if(foundForwardPt)
+            forwardPt = odom_path_wayPt;
     }
     else if(goal_reached)
     {
@@ -487,10 +481,7 @@ void PurePursuit::amclCB(const geometry_msgs::PoseWithCovarianceStamped::ConstPt
                 tracking_etime = ros::Time::now();
                 tracking_time_sec = tracking_etime.sec - tracking_stime.sec; 
                 tracking_time_nsec = tracking_etime.nsec - tracking_stime.nsec; 
-                
-                file << "tracking time"<< "," << tracking_time_sec << "," <<  tracking_time_nsec << "\n";
-
-                file.close();
+                ROS_INFO("tracking time: %d s %d ns", tracking_time_sec, tracking_time_nsec);
 
                 start_timef = false;
             }
@@ -541,7 +532,7 @@ void PurePursuit::controlLoopCB(const ros::TimerEvent&)
         }
 
         nav_msgs::Odometry odom_w = odom; 
-        nav_msgs::Path odom_path_w = _odom_path;   
+        CompactPath::ConstPtr odom_path_w = _odom_path;   
 
         // Update system states: X=[x, y, theta, v]
         const double px = odom_w.pose.pose.position.x; //pose: odom frame
@@ -551,7 +542,7 @@ void PurePursuit::controlLoopCB(const ros::TimerEvent&)
         const double theta = tf::getYaw(pose.getRotation());
 
         // Waypoints related parameters
-        const int N = odom_path_w.poses.size(); // Number of waypoints
+        const int N = odom_path_w ? odom_path_w->Size() : 0; // Number of waypoints
         const double costheta = cos(theta);
         const double sintheta = sin(theta);
 
@@ -560,8 +551,8 @@ void PurePursuit::controlLoopCB(const ros::TimerEvent&)
         Eigen::VectorXd y_veh(N);
         for(int i = 0; i < N; i++) 
         {
-            const double dx = odom_path_w.poses[i].pose.position.x - px;
-            const double dy = odom_path_w.poses[i].pose.position.y - py;
+            const double dx = odom_path_w->X(i) - px;
+            const double dy = odom_path_w->Y(i) - py;
             x_veh[i] = dx * costheta + dy * sintheta;
             y_veh[i] = dy * costheta - dx * sintheta;
         }
@@ -577,8 +568,16 @@ void PurePursuit::controlLoopCB(const ros::TimerEvent&)
         cout << "v : " << cmd_vel.linear.x  << endl;
         cout << "w : " << cmd_vel.angular.z  << endl;
         
-        idx++;
-        file << idx<< "," << cte << "," <<  etheta << "," << cmd_vel.linear.x << "," << cmd_vel.angular.z << "\n";
+        TrajectoryRecord record;
+        record.stamp = ros::Time::now().toSec();
+        record.state[3] = odom_w.twist.twist.linear.x;
+        record.state[4] = cte;
+        record.state[5] = etheta;
+        for(int i = 0; i < 4 && i < coeffs.size(); i++)
+            record.coeffs[i] = coeffs[i];
+        record.speed = cmd_vel.linear.x;
+        record.angvel = cmd_vel.angular.z;
+        _log.Push(record);
         
             /*Estimate Gas Input*/
         if(!this->goal_reached)
@@ -603,11 +602,23 @@ void PurePursuit::controlLoopCB(const ros::TimerEvent&)
     {
         this->cmd_vel.linear.x = this->velocity;
         this->cmd_vel.angular.z = this->w;
-	    this->cmdvel_pub.publish(this->cmd_vel);
+	    this->cmdvel_pub.publish(boost::make_shared<geometry_msgs::Twist>(this->cmd_vel));
     }   
 }
 
 
+#ifdef MPC_NODELET
+#include <pluginlib/class_list_macros.h>
+#include "controller_nodelet.h"
+
+namespace mpc_ros
+{
+    class PurePursuitNodelet : public ControllerNodelet<PurePursuit> {};
+}
+PLUGINLIB_EXPORT_CLASS(mpc_ros::PurePursuitNodelet, nodelet::Nodelet)
+
+#else
+
 /*****************/
 /* MAIN FUNCTION */
 /*****************/
@@ -621,3 +632,4 @@ int main(int argc, char **argv)
     ros::waitForShutdown();
     return 0;
 }
+#endif /* MPC_NODELET */
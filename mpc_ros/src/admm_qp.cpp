@@ -0,0 +1,198 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "admm_qp.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Bounds at or beyond this are infinite
+    const double INFINITE_BOUND = 1e20;
+    const double RHO_MIN = 1e-6, RHO_MAX = 1e6, RHO_EQ = 1e3;
+}
+
+AdmmQp::AdmmQp()
+    : _n(0), _m(0), _rho_bar(0.1), _stale(false), _iterations(0), _factorizations(0)
+{
+}
+
+void AdmmQp::SetSettings(const Settings &settings)
+{
+    _settings = settings;
+    _settings.check_every = std::max(1, _settings.check_every);
+    _rho_bar = std::min(std::max(_settings.rho, RHO_MIN), RHO_MAX);
+    _row_type.assign(_m, -1); // rho of every row again
+}
+
+bool AdmmQp::Setup(const Matrix &P, const Matrix &A)
+{
+    _n = P.cols();
+    _m = A.rows();
+    _P = P.triangularView<Eigen::Lower>();
+    _A = A;
+
+    // Lower triangle of the KKT matrix, with every diagonal entry present
+    std::vector<Eigen::Triplet<double> > entries;
+    entries.reserve(_n + _P.nonZeros() + _A.nonZeros() + _m);
+    for (int j = 0; j < _n; j++)
+        entries.push_back(Eigen::Triplet<double>(j, j, _settings.sigma));
+    for (int j = 0; j < _n; j++)
+        for (Matrix::InnerIterator it(_P, j); it; ++it)
+            entries.push_back(Eigen::Triplet<double>(it.row(), j, it.value()));
+    for (int j = 0; j < _n; j++)
+        for (Matrix::InnerIterator it(_A, j); it; ++it)
+            entries.push_back(Eigen::Triplet<double>(_n + it.row(), j, it.value()));
+    for (int i = 0; i < _m; i++)
+        entries.push_back(Eigen::Triplet<double>(_n + i, _n + i, -1.0 / _rho_bar));
+    _K.resize(_n + _m, _n + _m);
+    _K.setFromTriplets(entries.begin(), entries.end());
+    _K.makeCompressed();
+
+    const double *values = _K.valuePtr();
+    _diag_in_k.resize(_n);
+    for (int j = 0; j < _n; j++)
+        _diag_in_k[j] = &_K.coeffRef(j, j) - values;
+    _a_in_k.clear();
+    _a_in_k.reserve(_A.nonZeros());
+    for (int j = 0; j < _n; j++)
+        for (Matrix::InnerIterator it(_A, j); it; ++it)
+            _a_in_k.push_back(&_K.coeffRef(_n + it.row(), j) - values);
+    _rho_in_k.resize(_m);
+    for (int i = 0; i < _m; i++)
+        _rho_in_k[i] = &_K.coeffRef(_n + i, _n + i) - values;
+
+    _rho = Eigen::VectorXd::Constant(_m, _rho_bar);
+    _rho_inv = Eigen::VectorXd::Constant(_m, 1.0 / _rho_bar);
+    _row_type.assign(_m, 1);
+
+    _x.setZero(_n);
+    _z.setZero(_m);
+    _y.setZero(_m);
+    _rhs.resize(_n + _m);
+    _sol.resize(_n + _m);
+    _zt.resize(_m);
+    _Ax.resize(_m);
+    _Px.resize(_n);
+    _Aty.resize(_n);
+
+    _factorizations = 0;
+    _ldlt.analyzePattern(_K);
+    _stale = true;
+    return factor();
+}
+
+void AdmmQp::UpdateA(const Matrix &A)
+{
+    std::copy(A.valuePtr(), A.valuePtr() + _A.nonZeros(), _A.valuePtr());
+    double *values = _K.valuePtr();
+    for (size_t e = 0; e < _a_in_k.size(); e++)
+        values[_a_in_k[e]] = _A.valuePtr()[e];
+    _stale = true;
+}
+
+void AdmmQp::WarmStart(const Eigen::VectorXd &x, const Eigen::VectorXd &y)
+{
+    _x = x;
+    _y = y;
+    _z.noalias() = _A * _x;
+}
+
+void AdmmQp::updateRho(const Eigen::VectorXd &l, const Eigen::VectorXd &u)
+{
+    double *values = _K.valuePtr();
+    for (int i = 0; i < _m; i++)
+    {
+        const char type = (l[i] <= -INFINITE_BOUND && u[i] >= INFINITE_BOUND) ? 0
+                          : u[i] - l[i] < 1e-9 ? 2 : 1;
+        if (type == _row_type[i])
+            continue;
+        _row_type[i] = type;
+        _rho[i] = type == 0 ? RHO_MIN : type == 2 ? RHO_EQ * _rho_bar : _rho_bar;
+        _rho_inv[i] = 1.0 / _rho[i];
+        values[_rho_in_k[i]] = -_rho_inv[i];
+        _stale = true;
+    }
+}
+
+bool AdmmQp::factor()
+{
+    if (!_stale)
+        return true;
+    _ldlt.factorize(_K);
+    _stale = false;
+    _factorizations++;
+    return _ldlt.info() == Eigen::Success;
+}
+
+bool AdmmQp::Solve(const Eigen::VectorXd &q, const Eigen::VectorXd &l, const Eigen::VectorXd &u)
+{
+    _iterations = 0;
+    if (q.size() != _n || l.size() != _m || u.size() != _m)
+        return false;
+    updateRho(l, u);
+    if (!factor())
+        return false;
+
+    const double alpha = _settings.alpha, sigma = _settings.sigma;
+    for (_iterations = 1; _iterations <= _settings.max_iter; _iterations++)
+    {
+        _rhs.head(_n) = sigma * _x - q;
+        _rhs.tail(_m) = _z - _y.cwiseProduct(_rho_inv);
+        _sol = _ldlt.solve(_rhs);
+
+        // z~ from nu, then the relaxed x, z and y updates
+        _zt = _z + (_sol.tail(_m) - _y).cwiseProduct(_rho_inv);
+        _x = alpha * _sol.head(_n) + (1 - alpha) * _x;
+        _zt = alpha * _zt + (1 - alpha) * _z;
+        _z = (_zt + _y.cwiseProduct(_rho_inv)).cwiseMax(l).cwiseMin(u);
+        _y += _rho.cwiseProduct(_zt - _z);
+
+        if (_iterations % _settings.check_every != 0 && _iterations != _settings.max_iter)
+            continue;
+
+        _Ax.noalias() = _A * _x;
+        _Px.noalias() = _P.selfadjointView<Eigen::Lower>() * _x;
+        _Aty.noalias() = _A.transpose() * _y;
+        const double ax = _Ax.lpNorm<Eigen::Infinity>(), z = _z.lpNorm<Eigen::Infinity>();
+        const double px = _Px.lpNorm<Eigen::Infinity>(), aty = _Aty.lpNorm<Eigen::Infinity>();
+        const double qn = q.lpNorm<Eigen::Infinity>();
+        const double prim = (_Ax - _z).lpNorm<Eigen::Infinity>();
+        const double dual = (_Px + q + _Aty).lpNorm<Eigen::Infinity>();
+        const double prim_scale = std::max(ax, z), dual_scale = std::max(px, std::max(aty, qn));
+        if (prim <= _settings.eps_abs + _settings.eps_rel * prim_scale &&
+            dual <= _settings.eps_abs + _settings.eps_rel * dual_scale)
+            return true;
+
+        // Primal and dual residuals of the same relative size
+        if (_settings.adaptive_rho)
+        {
+            const double ratio = std::sqrt((prim / std::max(prim_scale, 1e-10)) /
+                                           std::max(dual / std::max(dual_scale, 1e-10), 1e-10));
+            const double rho = std::min(std::max(_rho_bar * ratio, RHO_MIN), RHO_MAX);
+            if (rho > 5 * _rho_bar || rho < 0.2 * _rho_bar)
+            {
+                _rho_bar = rho;
+                _row_type.assign(_m, -1);
+                updateRho(l, u);
+                if (!factor())
+                    return false;
+            }
+        }
+    }
+    _iterations = _settings.max_iter;
+    return false;
+}
@@ -0,0 +1,81 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "alloc_counter.h"
+#include "cppad_instance.h"
+#include <dlfcn.h>
+
+// Exported by libmpc_alloc_hook, see alloc_hook.cpp
+typedef const alloc_counter::Counts *(*ThreadCounts)();
+
+static ThreadCounts hook()
+{
+    // Looked up once: the hook is preloaded or not there at all
+    static const ThreadCounts counts = (ThreadCounts)dlsym(RTLD_DEFAULT, "mpc_alloc_thread_counts");
+    return counts;
+}
+
+namespace alloc_counter
+{
+    bool Active()
+    {
+        return hook() != NULL;
+    }
+
+    Counts Thread()
+    {
+        const ThreadCounts counts = hook();
+        if (!counts)
+        {
+            const Counts none = {0, 0, 0};
+            return none;
+        }
+        return *counts();
+    }
+
+    size_t CppadBytes()
+    {
+        const size_t thread = CppAD::thread_alloc::thread_num();
+        return CppAD::thread_alloc::inuse(thread) + CppAD::thread_alloc::available(thread);
+    }
+}
+
+void AllocClock::Start()
+{
+    _last = _start = alloc_counter::Thread();
+    _cppad_start = alloc_counter::CppadBytes();
+}
+
+unsigned long long AllocClock::Lap(unsigned long long &bytes)
+{
+    const alloc_counter::Counts now = alloc_counter::Thread();
+    const unsigned long long allocs = now.allocs - _last.allocs;
+    bytes = now.bytes - _last.bytes;
+    _last = now;
+    return allocs;
+}
+
+alloc_counter::Counts AllocClock::Total() const
+{
+    const alloc_counter::Counts now = alloc_counter::Thread();
+    const alloc_counter::Counts total = {now.allocs - _start.allocs, now.frees - _start.frees, now.bytes - _start.bytes};
+    return total;
+}
+
+long long AllocClock::CppadBytes() const
+{
+    return (long long)alloc_counter::CppadBytes() - (long long)_cppad_start;
+}
@@ -0,0 +1,95 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+// Counting operator new/delete for libmpc_alloc_hook, see alloc_counter.h.
+// Preloaded, they replace the ones of libstdc++ in the whole process. Each
+// thread counts into its own block, there is no lock or atomic on the path.
+#include "alloc_counter.h"
+#include <cstdlib>
+#include <new>
+
+static thread_local alloc_counter::Counts counts = {0, 0, 0};
+
+extern "C" __attribute__((visibility("default"))) const alloc_counter::Counts *mpc_alloc_thread_counts()
+{
+    return &counts;
+}
+
+static void *allocate(size_t size)
+{
+    void *p = std::malloc(size ? size : 1);
+    if (p)
+    {
+        counts.allocs++;
+        counts.bytes += size;
+    }
+    return p;
+}
+
+static void release(void *p)
+{
+    if (p)
+    {
+        counts.frees++;
+        std::free(p);
+    }
+}
+
+void *operator new(size_t size)
+{
+    void *p = allocate(size);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new[](size_t size)
+{
+    void *p = allocate(size);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    return allocate(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    release(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    release(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept
+{
+    release(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept
+{
+    release(p);
+}
@@ -0,0 +1,679 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "analytic_solver.h"
+#include "ipopt_util.h"
+#include <cmath>
+#include <map>
+
+typedef AnalyticSolver::Dvector Dvector;
+typedef ipopt_util::SolveResult SolveResult;
+
+// =========================================
+// Ipopt interface over the AnalyticSolver model
+// =========================================
+// Kept for one horizon length so that Ipopt can re-optimize it, the data
+// of each solve is attached with Bind().
+class AnalyticNLP : public Ipopt::TNLP
+{
+    public:
+        typedef Ipopt::Index Index;
+        typedef Ipopt::Number Number;
+
+        AnalyticNLP(AnalyticSolver &solver)
+            : _solver(solver), _xi(NULL), _xl(NULL), _xu(NULL), _gl(NULL), _gu(NULL), _solution(NULL),
+              _zl(NULL), _zu(NULL), _lambda(NULL)
+        {
+            _nx = solver.NumVars();
+            _ng = solver.NumConstraints();
+        }
+
+        // Problem data of the next solve, must outlive it
+        void Bind(const Dvector &xi, const Dvector &xl, const Dvector &xu,
+                  const Dvector &gl, const Dvector &gu, SolveResult &solution,
+                  const Dvector *zl, const Dvector *zu, const Dvector *lambda)
+        {
+            _xi = &xi;
+            _xl = &xl;
+            _xu = &xu;
+            _gl = &gl;
+            _gu = &gu;
+            _solution = &solution;
+            _zl = zl;
+            _zu = zu;
+            _lambda = lambda;
+        }
+
+        virtual bool get_nlp_info(Index& n, Index& m, Index& nnz_jac_g, Index& nnz_h_lag, IndexStyleEnum& index_style)
+        {
+            n = static_cast<Index>(_nx);
+            m = static_cast<Index>(_ng);
+            nnz_jac_g = static_cast<Index>(_solver._row_jac.size());
+            nnz_h_lag = static_cast<Index>(_solver._row_hes.size());
+            index_style = C_STYLE;
+            return true;
+        }
+
+        virtual bool get_bounds_info(Index n, Number* x_l, Number* x_u, Index m, Number* g_l, Number* g_u)
+        {
+            for (size_t j = 0; j < _nx; j++)
+            {
+                x_l[j] = (*_xl)[j];
+                x_u[j] = (*_xu)[j];
+            }
+            for (size_t i = 0; i < _ng; i++)
+            {
+                g_l[i] = (*_gl)[i];
+                g_u[i] = (*_gu)[i];
+            }
+            return true;
+        }
+
+        virtual bool get_starting_point(Index n, bool init_x, Number* x, bool init_z, Number* z_L, Number* z_U,
+                                        Index m, bool init_lambda, Number* lambda)
+        {
+            if (init_x)
+            {
+                for (size_t j = 0; j < _nx; j++)
+                    x[j] = (*_xi)[j];
+            }
+            if (init_z)
+            {
+                for (size_t j = 0; j < _nx; j++)
+                {
+                    z_L[j] = _zl ? (*_zl)[j] : 0.0;
+                    z_U[j] = _zu ? (*_zu)[j] : 0.0;
+                }
+            }
+            if (init_lambda)
+            {
+                for (size_t i = 0; i < _ng; i++)
+                    lambda[i] = _lambda ? (*_lambda)[i] : 0.0;
+            }
+            return true;
+        }
+
+        virtual bool eval_f(Index n, const Number* x, bool new_x, Number& obj_value)
+        {
+            obj_value = _solver.Cost(x);
+            return true;
+        }
+
+        virtual bool eval_grad_f(Index n, const Number* x, bool new_x, Number* grad_f)
+        {
+            _solver.Gradient(x, grad_f);
+            return true;
+        }
+
+        virtual bool eval_g(Index n, const Number* x, bool new_x, Index m, Number* g)
+        {
+            _solver.Constraints(x, g);
+            return true;
+        }
+
+        virtual bool eval_jac_g(Index n, const Number* x, bool new_x, Index m, Index nele_jac,
+                                Index* iRow, Index* jCol, Number* values)
+        {
+            if (values == NULL)
+            {
+                for (size_t k = 0; k < _solver._row_jac.size(); k++)
+                {
+                    iRow[k] = static_cast<Index>(_solver._row_jac[k]);
+                    jCol[k] = static_cast<Index>(_solver._col_jac[k]);
+                }
+                return true;
+            }
+            _solver.Jacobian(x, values);
+            return true;
+        }
+
+        virtual bool eval_h(Index n, const Number* x, bool new_x, Number obj_factor, Index m,
+                            const Number* lambda, bool new_lambda, Index nele_hess,
+                            Index* iRow, Index* jCol, Number* values)
+        {
+            if (values == NULL)
+            {
+                for (size_t k = 0; k < _solver._row_hes.size(); k++)
+                {
+                    iRow[k] = static_cast<Index>(_solver._row_hes[k]);
+                    jCol[k] = static_cast<Index>(_solver._col_hes[k]);
+                }
+                return true;
+            }
+            _solver.Hessian(x, obj_factor, lambda, values);
+            return true;
+        }
+
+        // Stop at the current iterate once the solve is cancelled or the
+        // wall-time budget is used up
+        virtual bool intermediate_callback(Ipopt::AlgorithmMode mode, Index iter, Number obj_value,
+                                           Number inf_pr, Number inf_du, Number mu, Number d_norm,
+                                           Number regularization_size, Number alpha_du, Number alpha_pr,
+                                           Index ls_trials, const Ipopt::IpoptData* ip_data,
+                                           Ipopt::IpoptCalculatedQuantities* ip_cq)
+        {
+            if (_solver._cancel && _solver._cancel->load(std::memory_order_relaxed))
+            {
+                _solver._cancel_hit = true;
+                return false;
+            }
+            if (_solver._time_limit <= 0)
+                return true;
+            const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                                                 - _solver._solve_begin).count();
+            if (elapsed < _solver._time_limit)
+                return true;
+            _solver._time_limit_hit = true;
+            return false;
+        }
+
+        virtual void finalize_solution(Ipopt::SolverReturn status, Index n, const Number* x,
+                                       const Number* z_L, const Number* z_U, Index m, const Number* g,
+                                       const Number* lambda, Number obj_value,
+                                       const Ipopt::IpoptData* ip_data, Ipopt::IpoptCalculatedQuantities* ip_cq)
+        {
+            ipopt_util::StoreSolution(status, _nx, x, z_L, z_U, _ng, g, lambda, obj_value, *_solution);
+        }
+
+    private:
+        AnalyticSolver &_solver;
+        size_t _nx, _ng;
+        const Dvector *_xi, *_xl, *_xu, *_gl, *_gu;
+        SolveResult *_solution;
+        const Dvector *_zl, *_zu, *_lambda;
+};
+
+namespace
+{
+    // s[i] = sin(angle[i]), c[i] = cos(angle[i]). The fast_math kernel has
+    // no branches once the range is tested, so the loop vectorizes; libm is
+    // called angle by angle.
+    void sinCos(const double *angle, double *s, double *c, int n)
+    {
+#if CPPAD_FAST_MATH
+        int outside = 0;
+        for (int i = 0; i < n; i++)
+            outside += !(std::fabs(angle[i]) < CPPAD_FAST_MATH_MAX_REDUCE);
+        if (outside == 0)
+        {
+            for (int i = 0; i < n; i++)
+                CppAD::fast_math::sincos_reduced(angle[i], s[i], c[i]);
+            return;
+        }
+        for (int i = 0; i < n; i++)
+            CppAD::fast_math::sincos(angle[i], s[i], c[i]);
+#else
+        for (int i = 0; i < n; i++)
+        {
+            // One sincos() call
+            const double a = angle[i];
+            s[i] = std::sin(a);
+            c[i] = std::cos(a);
+        }
+#endif
+    }
+
+    // a[i] = atan(t[i]); the fast_math kernel selects its interval per
+    // lane, which vectorizes where the divisions can be masked (AVX-512)
+    void arcTan(const double *t, double *a, int n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+#if CPPAD_FAST_MATH
+            a[i] = CppAD::fast_math::atan(t[i]);
+#else
+            a[i] = std::atan(t[i]);
+#endif
+        }
+    }
+}
+
+// ====================================
+// AnalyticSolver class definition implementation.
+// ====================================
+AnalyticSolver::AnalyticSolver()
+{
+    // Same defaults as FG_eval
+    _dt = 0.1;
+    _ref_cte = 0;
+    _ref_etheta = 0;
+    _ref_vel = 0.5;
+    _w_cte = 100;
+    _w_etheta = 100;
+    _w_vel = 1;
+    _w_angvel = 100;
+    _w_accel = 50;
+    _w_angvel_d = 0;
+    _w_accel_d = 0;
+    _mpc_steps = 40;
+    _path_heading = true;
+    _gauss_newton = false;
+
+    _pattern_steps = -1;
+    _nlp = NULL;
+    _iterations = -1;
+    _time_limit = 0;
+    _time_limit_hit = false;
+    _cancel = NULL;
+    _cancel_hit = false;
+}
+
+void AnalyticSolver::LoadParams(const std::map<std::string, double> &params)
+{
+    _dt = params.find("DT") != params.end() ? params.at("DT") : _dt;
+    _mpc_steps = params.find("STEPS") != params.end() ? params.at("STEPS") : _mpc_steps;
+    _ref_cte = params.find("REF_CTE") != params.end() ? params.at("REF_CTE") : _ref_cte;
+    _ref_etheta = params.find("REF_ETHETA") != params.end() ? params.at("REF_ETHETA") : _ref_etheta;
+    _ref_vel = params.find("REF_V") != params.end() ? params.at("REF_V") : _ref_vel;
+    _w_cte = params.find("W_CTE") != params.end() ? params.at("W_CTE") : _w_cte;
+    _w_etheta = params.find("W_EPSI") != params.end() ? params.at("W_EPSI") : _w_etheta;
+    _w_vel = params.find("W_V") != params.end() ? params.at("W_V") : _w_vel;
+    _w_angvel = params.find("W_ANGVEL") != params.end() ? params.at("W_ANGVEL") : _w_angvel;
+    _w_accel = params.find("W_A") != params.end() ? params.at("W_A") : _w_accel;
+    _w_angvel_d = params.find("W_DANGVEL") != params.end() ? params.at("W_DANGVEL") : _w_angvel_d;
+    _w_accel_d = params.find("W_DA") != params.end() ? params.at("W_DA") : _w_accel_d;
+}
+
+void AnalyticSolver::SetPathHeading(bool path_heading)
+{
+    if (path_heading != _path_heading)
+        _pattern_steps = -1;
+    _path_heading = path_heading;
+}
+
+void AnalyticSolver::SetGaussNewton(bool enable)
+{
+    _gauss_newton = enable;
+}
+
+void AnalyticSolver::Prepare(const Eigen::VectorXd &coeffs)
+{
+    if (_pattern_steps != _mpc_steps)
+        buildPattern();
+    _coeffs.resize(coeffs.size());
+    for (int k = 0; k < coeffs.size(); k++)
+        _coeffs[k] = coeffs[k];
+}
+
+void AnalyticSolver::stageTerms(const double *x, bool curvature) const
+{
+    const int N = _mpc_steps, M = N - 1;
+    const double *x0 = x, *theta0 = x + 2 * N, *etheta0 = x + 5 * N;
+    sinCos(theta0, _terms.s.data(), _terms.c.data(), M);
+    sinCos(etheta0, _terms.se.data(), _terms.ce.data(), M);
+
+    // Horner form of the polynomial and its first three derivatives, each
+    // coefficient over all the steps
+    double *f = _terms.f.data(), *df = _terms.df.data(), *ddf = _terms.ddf.data(), *dddf = _terms.dddf.data();
+    for (int i = 0; i < M; i++)
+    {
+        f[i] = 0;
+        df[i] = 0;
+        ddf[i] = 0;
+        dddf[i] = 0;
+    }
+    for (int k = (int)_coeffs.size() - 1; k >= 0; k--)
+    {
+        const double a = _coeffs[k];
+        if (curvature)
+        {
+            for (int i = 0; i < M; i++)
+                dddf[i] = dddf[i] * x0[i] + 3 * ddf[i];
+        }
+        for (int i = 0; i < M; i++)
+        {
+            ddf[i] = ddf[i] * x0[i] + 2 * df[i];
+            df[i] = df[i] * x0[i] + f[i];
+            f[i] = f[i] * x0[i] + a;
+        }
+    }
+}
+
+double AnalyticSolver::Cost(const double *x) const
+{
+    const int N = _mpc_steps;
+    const int v_start = 3 * N, cte_start = 4 * N, etheta_start = 5 * N;
+    const int angvel_start = 6 * N, a_start = 7 * N - 1;
+
+    double cost = 0;
+    for (int i = 0; i < N; i++)
+    {
+        cost += _w_cte * pow(x[cte_start + i] - _ref_cte, 2);
+        cost += _w_etheta * pow(x[etheta_start + i] - _ref_etheta, 2);
+        cost += _w_vel * pow(x[v_start + i] - _ref_vel, 2);
+    }
+    for (int i = 0; i < N - 1; i++)
+    {
+        cost += _w_angvel * pow(x[angvel_start + i], 2);
+        cost += _w_accel * pow(x[a_start + i], 2);
+    }
+    for (int i = 0; i < N - 2; i++)
+    {
+        cost += _w_angvel_d * pow(x[angvel_start + i + 1] - x[angvel_start + i], 2);
+        cost += _w_accel_d * pow(x[a_start + i + 1] - x[a_start + i], 2);
+    }
+    return cost;
+}
+
+void AnalyticSolver::Gradient(const double *x, double *grad) const
+{
+    const int N = _mpc_steps;
+    const int v_start = 3 * N, cte_start = 4 * N, etheta_start = 5 * N;
+    const int angvel_start = 6 * N, a_start = 7 * N - 1;
+
+    for (int j = 0; j < v_start; j++)
+        grad[j] = 0;
+    for (int i = 0; i < N; i++)
+    {
+        grad[v_start + i] = 2 * _w_vel * (x[v_start + i] - _ref_vel);
+        grad[cte_start + i] = 2 * _w_cte * (x[cte_start + i] - _ref_cte);
+        grad[etheta_start + i] = 2 * _w_etheta * (x[etheta_start + i] - _ref_etheta);
+    }
+    for (int i = 0; i < N - 1; i++)
+    {
+        grad[angvel_start + i] = 2 * _w_angvel * x[angvel_start + i];
+        grad[a_start + i] = 2 * _w_accel * x[a_start + i];
+    }
+    for (int i = 0; i < N - 2; i++)
+    {
+        const double dw = 2 * _w_angvel_d * (x[angvel_start + i + 1] - x[angvel_start + i]);
+        const double da = 2 * _w_accel_d * (x[a_start + i + 1] - x[a_start + i]);
+        grad[angvel_start + i + 1] += dw;
+        grad[angvel_start + i] -= dw;
+        grad[a_start + i + 1] += da;
+        grad[a_start + i] -= da;
+    }
+}
+
+void AnalyticSolver::Constraints(const double *x, double *g) const
+{
+    const int N = _mpc_steps, M = N - 1;
+    const int x_start = 0, y_start = N, theta_start = 2 * N, v_start = 3 * N;
+    const int cte_start = 4 * N, etheta_start = 5 * N, angvel_start = 6 * N, a_start = 7 * N - 1;
+    const double dt = _dt;
+
+    // Initial state rows
+    for (int b = 0; b < 6; b++)
+        g[b * N] = x[b * N];
+
+    // Each row over all the steps, step i + 1 of block b is b * N + 1 + i
+    stageTerms(x, false);
+    const double *c = _terms.c.data(), *s = _terms.s.data(), *se = _terms.se.data(), *f = _terms.f.data();
+    for (int i = 0; i < M; i++)
+        g[x_start + 1 + i] = x[x_start + 1 + i] - (x[x_start + i] + x[v_start + i] * c[i] * dt);
+    for (int i = 0; i < M; i++)
+        g[y_start + 1 + i] = x[y_start + 1 + i] - (x[y_start + i] + x[v_start + i] * s[i] * dt);
+    for (int i = 0; i < M; i++)
+        g[theta_start + 1 + i] = x[theta_start + 1 + i] - (x[theta_start + i] + x[angvel_start + i] * dt);
+    for (int i = 0; i < M; i++)
+        g[v_start + 1 + i] = x[v_start + 1 + i] - (x[v_start + i] + x[a_start + i] * dt);
+    for (int i = 0; i < M; i++)
+        g[cte_start + 1 + i] = x[cte_start + 1 + i] - ((f[i] - x[y_start + i]) + (x[v_start + i] * se[i] * dt));
+    if (_path_heading)
+    {
+        double *heading = _terms.heading.data();
+        arcTan(_terms.df.data(), heading, M);
+        for (int i = 0; i < M; i++)
+            g[etheta_start + 1 + i] = x[etheta_start + 1 + i] - ((x[theta_start + i] - heading[i]) + x[angvel_start + i] * dt);
+    }
+    else
+    {
+        for (int i = 0; i < M; i++)
+            g[etheta_start + 1 + i] = x[etheta_start + 1 + i] - (x[etheta_start + i] + x[angvel_start + i] * dt);
+    }
+}
+
+void AnalyticSolver::jacobian(const double *x, double *values, std::vector<int> *rows, std::vector<int> *cols) const
+{
+    const int N = _mpc_steps, M = N - 1;
+    const int x_start = 0, y_start = N, theta_start = 2 * N, v_start = 3 * N;
+    const int cte_start = 4 * N, etheta_start = 5 * N, angvel_start = 6 * N, a_start = 7 * N - 1;
+    const double dt = _dt;
+    size_t k = 0;
+
+    for (int b = 0; b < 6; b++)
+    {
+        if (rows)
+        {
+            rows->push_back(b * N);
+            cols->push_back(b * N);
+        }
+        else
+            values[k] = 1.0;
+        k++;
+    }
+
+    // One entry of the model rows for all the steps: (row + i, col + i) of
+    // step i are M consecutive values, written by one loop
+#define ANALYTIC_JAC(row, col, value)                               \
+    {                                                               \
+        if (rows)                                                   \
+        {                                                           \
+            for (int i = 0; i < M; i++)                             \
+            {                                                       \
+                rows->push_back((row) + i);                         \
+                cols->push_back((col) + i);                         \
+            }                                                       \
+        }                                                           \
+        else                                                        \
+        {                                                           \
+            double *out = values + k;                               \
+            for (int i = 0; i < M; i++)                             \
+                out[i] = (value);                                   \
+        }                                                           \
+        k += M;                                                     \
+    }
+
+    if (!rows)
+        stageTerms(x, false);
+    const double *c = _terms.c.data(), *s = _terms.s.data(), *ce = _terms.ce.data(), *se = _terms.se.data();
+    const double *df = _terms.df.data(), *ddf = _terms.ddf.data();
+    const double *v0 = x + v_start;
+
+    ANALYTIC_JAC(x_start + 1, x_start + 1, 1.0);
+    ANALYTIC_JAC(x_start + 1, x_start, -1.0);
+    ANALYTIC_JAC(x_start + 1, theta_start, v0[i] * s[i] * dt);
+    ANALYTIC_JAC(x_start + 1, v_start, -c[i] * dt);
+
+    ANALYTIC_JAC(y_start + 1, y_start + 1, 1.0);
+    ANALYTIC_JAC(y_start + 1, y_start, -1.0);
+    ANALYTIC_JAC(y_start + 1, theta_start, -v0[i] * c[i] * dt);
+    ANALYTIC_JAC(y_start + 1, v_start, -s[i] * dt);
+
+    ANALYTIC_JAC(theta_start + 1, theta_start + 1, 1.0);
+    ANALYTIC_JAC(theta_start + 1, theta_start, -1.0);
+    ANALYTIC_JAC(theta_start + 1, angvel_start, -dt);
+
+    ANALYTIC_JAC(v_start + 1, v_start + 1, 1.0);
+    ANALYTIC_JAC(v_start + 1, v_start, -1.0);
+    ANALYTIC_JAC(v_start + 1, a_start, -dt);
+
+    ANALYTIC_JAC(cte_start + 1, cte_start + 1, 1.0);
+    ANALYTIC_JAC(cte_start + 1, x_start, -df[i]);
+    ANALYTIC_JAC(cte_start + 1, y_start, 1.0);
+    ANALYTIC_JAC(cte_start + 1, v_start, -se[i] * dt);
+    ANALYTIC_JAC(cte_start + 1, etheta_start, -v0[i] * ce[i] * dt);
+
+    ANALYTIC_JAC(etheta_start + 1, etheta_start + 1, 1.0);
+    if (_path_heading)
+    {
+        ANALYTIC_JAC(etheta_start + 1, theta_start, -1.0);
+        ANALYTIC_JAC(etheta_start + 1, x_start, ddf[i] / (1 + df[i] * df[i]));
+    }
+    else
+    {
+        ANALYTIC_JAC(etheta_start + 1, etheta_start, -1.0);
+    }
+    ANALYTIC_JAC(etheta_start + 1, angvel_start, -dt);
+#undef ANALYTIC_JAC
+}
+
+void AnalyticSolver::hessian(const double *x, double obj_factor, const double *lambda, double *values,
+                             std::vector<int> *rows, std::vector<int> *cols) const
+{
+    const int N = _mpc_steps;
+    const int x_start = 0, theta_start = 2 * N, v_start = 3 * N;
+    const int cte_start = 4 * N, etheta_start = 5 * N, angvel_start = 6 * N, a_start = 7 * N - 1;
+    size_t k = 0;
+    // row >= col, lower triangle
+#define ANALYTIC_HES(row, col, value) \
+    if (rows) { rows->push_back(row); cols->push_back(col); } else { values[_hes_slot[k++]] += (value); }
+
+    // Quadratic cost, constant curvature
+    for (int i = 0; i < N; i++)
+    {
+        ANALYTIC_HES(v_start + i, v_start + i, 2 * _w_vel * obj_factor);
+        ANALYTIC_HES(cte_start + i, cte_start + i, 2 * _w_cte * obj_factor);
+        ANALYTIC_HES(etheta_start + i, etheta_start + i, 2 * _w_etheta * obj_factor);
+    }
+    for (int i = 0; i < N - 1; i++)
+    {
+        ANALYTIC_HES(angvel_start + i, angvel_start + i, 2 * _w_angvel * obj_factor);
+        ANALYTIC_HES(a_start + i, a_start + i, 2 * _w_accel * obj_factor);
+    }
+    for (int i = 0; i < N - 2; i++)
+    {
+        const double dw = 2 * _w_angvel_d * obj_factor, da = 2 * _w_accel_d * obj_factor;
+        ANALYTIC_HES(angvel_start + i, angvel_start + i, dw);
+        ANALYTIC_HES(angvel_start + i + 1, angvel_start + i + 1, dw);
+        ANALYTIC_HES(angvel_start + i + 1, angvel_start + i, -dw);
+        ANALYTIC_HES(a_start + i, a_start + i, da);
+        ANALYTIC_HES(a_start + i + 1, a_start + i + 1, da);
+        ANALYTIC_HES(a_start + i + 1, a_start + i, -da);
+    }
+
+    // Without multipliers (Gauss-Newton) the cost is all there is. The
+    // entries below stay in the pattern, and at zero, so the mode can be
+    // switched without rebuilding it.
+    if (!rows && !lambda)
+        return;
+
+    // Curvature of the dynamics rows, the theta, v, etheta and x of each step
+    if (!rows)
+        stageTerms(x, true);
+    for (int i = 0; i < N - 1; i++)
+    {
+        const double v0 = x[v_start + i];
+        const double df0 = _terms.df[i], ddf0 = _terms.ddf[i], dddf0 = _terms.dddf[i];
+        const double c = _terms.c[i], s = _terms.s[i];
+        const double ce = _terms.ce[i], se = _terms.se[i];
+        const double l_x = rows ? 0 : lambda[x_start + i + 1];
+        const double l_y = rows ? 0 : lambda[N + i + 1];
+        const double l_cte = rows ? 0 : lambda[cte_start + i + 1];
+        const double l_etheta = rows ? 0 : lambda[etheta_start + i + 1];
+
+        ANALYTIC_HES(theta_start + i, theta_start + i, (l_x * c + l_y * s) * v0 * _dt);
+        ANALYTIC_HES(v_start + i, theta_start + i, (l_x * s - l_y * c) * _dt);
+        ANALYTIC_HES(etheta_start + i, etheta_start + i, l_cte * v0 * se * _dt);
+        ANALYTIC_HES(etheta_start + i, v_start + i, -l_cte * ce * _dt);
+
+        // d2/dx2 of -f(x0) in the cte row and of atan(f'(x0)) in the etheta row
+        double d2x = -l_cte * ddf0;
+        if (_path_heading)
+        {
+            const double q = 1 + df0 * df0;
+            d2x += l_etheta * (dddf0 / q - 2 * df0 * ddf0 * ddf0 / (q * q));
+        }
+        ANALYTIC_HES(x_start + i, x_start + i, d2x);
+    }
+#undef ANALYTIC_HES
+}
+
+void AnalyticSolver::Jacobian(const double *x, double *values) const
+{
+    jacobian(x, values, NULL, NULL);
+}
+
+void AnalyticSolver::Hessian(const double *x, double obj_factor, const double *lambda, double *values) const
+{
+    for (size_t k = 0; k < _row_hes.size(); k++)
+        values[k] = 0;
+    hessian(x, obj_factor, _gauss_newton ? NULL : lambda, values, NULL, NULL);
+}
+
+void AnalyticSolver::buildPattern()
+{
+    std::vector<double> *terms[] = {&_terms.c, &_terms.s, &_terms.ce, &_terms.se, &_terms.f,
+                                    &_terms.df, &_terms.ddf, &_terms.dddf, &_terms.heading};
+    for (size_t t = 0; t < sizeof(terms) / sizeof(terms[0]); t++)
+        terms[t]->assign(_mpc_steps - 1, 0.0);
+
+    _x0.assign(NumVars(), 0.0);
+    _row_jac.clear();
+    _col_jac.clear();
+    jacobian(_x0.data(), NULL, &_row_jac, &_col_jac);
+
+    // Terms falling on the same entry share a slot
+    std::vector<int> rows, cols;
+    hessian(_x0.data(), 0.0, NULL, NULL, &rows, &cols);
+    std::map<std::pair<int, int>, int> slots;
+    _row_hes.clear();
+    _col_hes.clear();
+    _hes_slot.resize(rows.size());
+    for (size_t t = 0; t < rows.size(); t++)
+    {
+        const std::pair<int, int> entry(rows[t], cols[t]);
+        std::map<std::pair<int, int>, int>::const_iterator it = slots.find(entry);
+        if (it == slots.end())
+        {
+            it = slots.insert(std::make_pair(entry, (int)_row_hes.size())).first;
+            _row_hes.push_back(rows[t]);
+            _col_hes.push_back(cols[t]);
+        }
+        _hes_slot[t] = it->second;
+    }
+    _pattern_steps = _mpc_steps;
+
+    // New structure, Ipopt has to start over
+    _nlp = NULL;
+    if (_ipopt)
+        _ipopt->SetProblem(NULL);
+}
+
+void AnalyticSolver::Solve(const std::string &options, const Eigen::VectorXd &coeffs,
+                           const Dvector &xi, const Dvector &xl, const Dvector &xu,
+                           const Dvector &gl, const Dvector &gu, SolveResult &solution,
+                           const Dvector *zl, const Dvector *zu, const Dvector *lambda)
+{
+    solution.status = SolveResult::unknown;
+    _iterations = -1;
+    _time_limit_hit = false;
+    _cancel_hit = false;
+    _solve_begin = std::chrono::steady_clock::now();
+    const size_t nx = NumVars(), ng = NumConstraints();
+    if (_mpc_steps < 2 || xi.size() != nx || gl.size() != ng)
+        return;
+    if ((zl && zl->size() != nx) || (zu && zu->size() != nx) || (lambda && lambda->size() != ng))
+        return;
+
+    Prepare(coeffs);
+
+    // The application and the TNLP are kept between solves, options are
+    // only applied again when they change
+    if (!_ipopt)
+        _ipopt = std::make_shared<ipopt_util::PersistentIpopt>();
+    if (!_ipopt->SetOptions(options))
+        return;
+    if (!_nlp)
+    {
+        _nlp = new AnalyticNLP(*this);
+        _ipopt->SetProblem(_nlp);
+    }
+    _nlp->Bind(xi, xl, xu, gl, gu, solution, zl, zu, lambda);
+    _ipopt->Solve();
+    _iterations = _ipopt->Iterations();
+}
@@ -0,0 +1,158 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "arc_path.h"
+#include <cmath>
+#include <algorithm>
+
+// Segments around the hint checked by Project
+static const int PROJECT_WINDOW = 20;
+
+ArcPath::ArcPath()
+{
+}
+
+bool ArcPath::Set(const CompactPath &path)
+{
+    _s.clear();
+    _x.clear();
+    _y.clear();
+    for (size_t i = 0; i < path.Size(); i++)
+    {
+        const double x = path.X(i);
+        const double y = path.Y(i);
+        if (!_x.empty())
+        {
+            const double ds = std::hypot(x - _x.back(), y - _y.back());
+            if (ds < 1e-6)
+                continue;
+            _s.push_back(_s.back() + ds);
+        }
+        else
+        {
+            _s.push_back(0.0);
+        }
+        _x.push_back(x);
+        _y.push_back(y);
+    }
+
+    const int n = _s.size();
+    if (n < 2)
+    {
+        _s.clear();
+        _x.clear();
+        _y.clear();
+        return false;
+    }
+
+    // Catmull-Rom tangents, one sided at both ends
+    _tx.resize(n);
+    _ty.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        const int i0 = std::max(i - 1, 0);
+        const int i1 = std::min(i + 1, n - 1);
+        const double ds = _s[i1] - _s[i0];
+        _tx[i] = (_x[i1] - _x[i0]) / ds;
+        _ty[i] = (_y[i1] - _y[i0]) / ds;
+    }
+    return true;
+}
+
+bool ArcPath::Empty() const
+{
+    return _s.empty();
+}
+
+double ArcPath::Length() const
+{
+    return _s.empty() ? 0.0 : _s.back();
+}
+
+int ArcPath::locate(double s, int hint) const
+{
+    const int last = _s.size() - 2;
+    int i = std::min(std::max(hint, 0), last);
+    while (i < last && s > _s[i + 1])
+        i++;
+    while (i > 0 && s < _s[i])
+        i--;
+    return i;
+}
+
+double ArcPath::Project(double x, double y, int &hint) const
+{
+    if (_s.empty())
+        return 0.0;
+
+    const int last = _s.size() - 2;
+    int begin = 0, end = last;
+    if (hint >= 0)
+    {
+        begin = std::max(hint - PROJECT_WINDOW, 0);
+        end = std::min(hint + PROJECT_WINDOW, last);
+    }
+
+    // Closest point on the chords
+    double best_d2 = -1.0, best_s = 0.0;
+    for (int i = begin; i <= end; i++)
+    {
+        const double ex = _x[i + 1] - _x[i];
+        const double ey = _y[i + 1] - _y[i];
+        const double h = _s[i + 1] - _s[i];
+        double u = ((x - _x[i]) * ex + (y - _y[i]) * ey) / (h * h);
+        u = std::min(std::max(u, 0.0), 1.0);
+        const double dx = _x[i] + u * ex - x;
+        const double dy = _y[i] + u * ey - y;
+        const double d2 = dx * dx + dy * dy;
+        if (best_d2 < 0.0 || d2 < best_d2)
+        {
+            best_d2 = d2;
+            best_s = _s[i] + u * h;
+            hint = i;
+        }
+    }
+    return best_s;
+}
+
+void ArcPath::Sample(double s, int &hint, double &x, double &y, double &theta) const
+{
+    if (_s.empty())
+    {
+        x = y = theta = 0.0;
+        return;
+    }
+
+    s = std::min(std::max(s, 0.0), _s.back());
+    const int i = locate(s, hint);
+    hint = i;
+
+    // Cubic Hermite basis on the segment
+    const double h = _s[i + 1] - _s[i];
+    const double u = (s - _s[i]) / h;
+    const double u2 = u * u, u3 = u2 * u;
+    const double h00 = 2 * u3 - 3 * u2 + 1, h10 = u3 - 2 * u2 + u;
+    const double h01 = -2 * u3 + 3 * u2, h11 = u3 - u2;
+    x = h00 * _x[i] + h10 * h * _tx[i] + h01 * _x[i + 1] + h11 * h * _tx[i + 1];
+    y = h00 * _y[i] + h10 * h * _ty[i] + h01 * _y[i + 1] + h11 * h * _ty[i + 1];
+
+    // Derivatives of the basis, divided by h for d/ds
+    const double d00 = (6 * u2 - 6 * u) / h, d10 = 3 * u2 - 4 * u + 1;
+    const double d01 = (-6 * u2 + 6 * u) / h, d11 = 3 * u2 - 2 * u;
+    const double dx = d00 * _x[i] + d10 * _tx[i] + d01 * _x[i + 1] + d11 * _tx[i + 1];
+    const double dy = d00 * _y[i] + d10 * _ty[i] + d01 * _y[i + 1] + d11 * _ty[i + 1];
+    theta = atan2(dy, dx);
+}
@@ -0,0 +1,145 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "atomic_pattern.h"
+
+PatternAtomic::PatternAtomic(const std::string &name, size_t n_in, size_t n_out)
+    : CppAD::atomic_base<double>(name, bool_sparsity_enum), _n_in(n_in), _n_out(n_out)
+{
+}
+
+void PatternAtomic::SetPattern(const std::vector<bool> &jac, const std::vector<bool> &hes)
+{
+    const size_t n = _n_in, m = _n_out;
+    _jac_row.assign(m, std::vector<size_t>());
+    _jac_col.assign(n, std::vector<size_t>());
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            if (jac[i * n + j])
+            {
+                _jac_row[i].push_back(j);
+                _jac_col[j].push_back(i);
+            }
+        }
+    }
+    _hes.assign(m, std::vector<std::vector<size_t> >(n));
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            for (size_t l = 0; l < n; l++)
+            {
+                if (hes[(i * n + j) * n + l])
+                {
+                    _hes[i][j].push_back(l);
+                }
+            }
+        }
+    }
+}
+
+void PatternAtomic::Variables(const CppAD::vector<bool> &vx, CppAD::vector<bool> &vy) const
+{
+    for (size_t i = 0; i < _n_out; i++)
+    {
+        vy[i] = false;
+        for (size_t j : _jac_row[i])
+        {
+            vy[i] = vy[i] || vx[j];
+        }
+    }
+}
+
+bool PatternAtomic::for_sparse_jac(size_t q, const CppAD::vector<bool> &r, CppAD::vector<bool> &s,
+                                   const CppAD::vector<double> &x)
+{
+    // s = J r
+    for (size_t i = 0; i < _n_out; i++)
+    {
+        for (size_t k = 0; k < q; k++)
+        {
+            s[i * q + k] = false;
+        }
+        for (size_t j : _jac_row[i])
+        {
+            for (size_t k = 0; k < q; k++)
+            {
+                s[i * q + k] = s[i * q + k] || r[j * q + k];
+            }
+        }
+    }
+    return true;
+}
+
+bool PatternAtomic::rev_sparse_jac(size_t q, const CppAD::vector<bool> &rt, CppAD::vector<bool> &st,
+                                   const CppAD::vector<double> &x)
+{
+    // st = J^T rt
+    for (size_t j = 0; j < _n_in; j++)
+    {
+        for (size_t k = 0; k < q; k++)
+        {
+            st[j * q + k] = false;
+        }
+        for (size_t i : _jac_col[j])
+        {
+            for (size_t k = 0; k < q; k++)
+            {
+                st[j * q + k] = st[j * q + k] || rt[i * q + k];
+            }
+        }
+    }
+    return true;
+}
+
+bool PatternAtomic::rev_sparse_hes(const CppAD::vector<bool> &vx, const CppAD::vector<bool> &s,
+                                   CppAD::vector<bool> &t, size_t q, const CppAD::vector<bool> &r,
+                                   const CppAD::vector<bool> &u, CppAD::vector<bool> &v,
+                                   const CppAD::vector<double> &x)
+{
+    // t = J^T s, v = J^T u + (sum of s_i H_i) r. A nonzero Hessian row
+    // of an output implies a nonzero Jacobian entry.
+    for (size_t j = 0; j < _n_in; j++)
+    {
+        t[j] = false;
+        for (size_t k = 0; k < q; k++)
+        {
+            v[j * q + k] = false;
+        }
+        for (size_t i : _jac_col[j])
+        {
+            t[j] = t[j] || s[i];
+            for (size_t k = 0; k < q; k++)
+            {
+                v[j * q + k] = v[j * q + k] || u[i * q + k];
+            }
+            if (!s[i])
+            {
+                continue;
+            }
+            for (size_t l : _hes[i][j])
+            {
+                for (size_t k = 0; k < q; k++)
+                {
+                    v[j * q + k] = v[j * q + k] || r[l * q + k];
+                }
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,69 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "batch_solver.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <Eigen/Core>
+#include "MPC.h"
+#include "cppad_parallel.h"
+
+BatchSolver::BatchSolver(const std::map<std::string, double> &params, int threads)
+    : _params(params), _threads(threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency()))
+{
+}
+
+void BatchSolver::Solve(const double *states, const double *coeffs, size_t n, int n_coeffs, Result *results,
+                        size_t min_chunk) const
+{
+    if (n == 0)
+        return;
+    const size_t chunks = std::max<size_t>(1, std::min<size_t>(_threads, n / std::max<size_t>(min_chunk, 1)));
+    const size_t chunk = (n + chunks - 1) / chunks;
+    // Before a second thread touches CppAD, see cppad_parallel.h
+    cppad_parallel::Setup();
+
+    std::vector<std::thread> pool;
+    for (size_t c = 0; c < chunks; c++)
+    {
+        const size_t begin = c * chunk, end = std::min(n, begin + chunk);
+        pool.emplace_back([this, states, coeffs, n_coeffs, results, begin, end]
+        {
+            MPC mpc;
+            mpc.LoadParams(_params);
+            Eigen::VectorXd state(6), poly(n_coeffs);
+            for (size_t i = begin; i < end; i++)
+            {
+                state = Eigen::Map<const Eigen::VectorXd>(states + 6 * i, 6);
+                poly = Eigen::Map<const Eigen::VectorXd>(coeffs + n_coeffs * i, n_coeffs);
+                const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                const std::vector<double> inputs = mpc.Solve(state, poly);
+                Result &result = results[i];
+                result.solve_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                result.angvel = inputs.size() > 0 ? inputs[0] : 0.0;
+                result.accel = inputs.size() > 1 ? inputs[1] : 0.0;
+                result.cost = mpc._mpc_totalcost;
+                result.status = mpc._mpc_status;
+                result.iterations = mpc._mpc_iterations;
+                result.feasible = mpc._mpc_feasible ? 1 : 0;
+            }
+        });
+    }
+    for (size_t t = 0; t < pool.size(); t++)
+        pool[t].join();
+}
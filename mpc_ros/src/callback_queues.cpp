@@ -0,0 +1,94 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "callback_queues.h"
+#include "trace_span.h"
+#include <algorithm>
+
+// Longest wait of the control thread for a callback, bounds how late Stop()
+// is noticed
+static const double CONTROL_WAIT = 0.05; // [s]
+
+CallbackQueues::CallbackQueues()
+    : _running(false), _started(false)
+{
+}
+
+CallbackQueues::~CallbackQueues()
+{
+    Stop();
+}
+
+ros::NodeHandle CallbackQueues::Control(const ros::NodeHandle &nh)
+{
+    ros::NodeHandle control(nh);
+    control.setCallbackQueue(&_control);
+    return control;
+}
+
+ros::NodeHandle CallbackQueues::Bulk(const ros::NodeHandle &nh)
+{
+    ros::NodeHandle bulk(nh);
+    bulk.setCallbackQueue(&_bulk);
+    return bulk;
+}
+
+void CallbackQueues::Start(const RealtimeSettings &realtime, int bulk_threads)
+{
+    if (_running)
+        return;
+    _running = true;
+    _started = false;
+    _control_thread = std::thread(&CallbackQueues::Run, this, realtime);
+    {
+        // The report is complete once the thread has applied the settings
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [this] { return _started; });
+    }
+    _bulk_spinner.reset(new ros::AsyncSpinner(std::max(bulk_threads, 1), &_bulk));
+    _bulk_spinner->start();
+}
+
+void CallbackQueues::Stop()
+{
+    if (!_running)
+        return;
+    _running = false;
+    if (_bulk_spinner)
+    {
+        _bulk_spinner->stop();
+        _bulk_spinner.reset();
+    }
+    if (_control_thread.joinable())
+        _control_thread.join();
+}
+
+void CallbackQueues::Run(const RealtimeSettings &realtime)
+{
+    MPC_TRACE_THREAD("mpc_control_queue");
+    std::string report;
+    if (realtime.Enabled())
+        realtime.Apply(report);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _realtime_report = report;
+        _started = true;
+    }
+    _cond.notify_all();
+
+    while (_running && ros::ok())
+        _control.callAvailable(ros::WallDuration(CONTROL_WAIT));
+}
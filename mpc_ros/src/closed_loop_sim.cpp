@@ -0,0 +1,370 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "closed_loop_sim.h"
+#include "cppad_parallel.h"
+#include "alloc_counter.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <random>
+#include <thread>
+#include <time.h>
+
+namespace
+{
+    // Spacing of the reference poses [m], as the reference generator
+    const double SPACING = 0.05;
+
+    double param(const std::map<std::string, double> &params, const std::string &key, double value)
+    {
+        std::map<std::string, double>::const_iterator it = params.find(key);
+        return it != params.end() ? it->second : value;
+    }
+
+    double wrap(double a)
+    {
+        return std::atan2(std::sin(a), std::cos(a));
+    }
+
+    // Wheel speed v, limited and lagged
+    double wheel(double current, double target, const PlantConfig &plant, double dt)
+    {
+        if (plant.max_wheel_speed > 0.0)
+            target = std::max(-plant.max_wheel_speed, std::min(target, plant.max_wheel_speed));
+        if (plant.wheel_tau <= 0.0)
+            return target;
+        return current + (target - current) * (1.0 - std::exp(-dt / plant.wheel_tau));
+    }
+
+    // Pose of the closed loop nearest to (x, y), looking around hint first.
+    // PathIndex stops at the end of the table, the loop goes on.
+    size_t nearest(const ReferenceTrajectory &traj, double x, double y, size_t hint)
+    {
+        const long n = traj.Size();
+        size_t best = hint;
+        double best_sq = 1e300;
+        for (long k = -20; k <= 60; k++)
+        {
+            const size_t i = ((long(hint) + k) % n + n) % n;
+            const double sq = (traj.X(i) - x) * (traj.X(i) - x) + (traj.Y(i) - y) * (traj.Y(i) - y);
+            if (sq < best_sq)
+            {
+                best_sq = sq;
+                best = i;
+            }
+        }
+        if (best_sq <= 1.0)
+            return best;
+        for (long i = 0; i < n; i++)
+        {
+            const double sq = (traj.X(i) - x) * (traj.X(i) - x) + (traj.Y(i) - y) * (traj.Y(i) - y);
+            if (sq < best_sq)
+            {
+                best_sq = sq;
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    struct Command
+    {
+        double time, speed, angvel;
+    };
+
+    double threadCpuMs()
+    {
+        timespec ts;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return ts.tv_sec * 1e3 + ts.tv_nsec * 1e-6;
+    }
+}
+
+PlantConfig::PlantConfig()
+    : model(UNICYCLE), substep(0.01), latency(0.0), pos_noise(0.0), yaw_noise(0.0), vel_noise(0.0),
+      track_width(0.5), wheel_radius(0.1), max_wheel_speed(0.0), wheel_tau(0.0)
+{
+}
+
+EpisodeConfig::EpisodeConfig()
+    : trajectory("circle"), scale(1.0), duration(30.0), start(0.0), offset(0.0), heading(0.0), seed(0)
+{
+}
+
+EpisodeResult::EpisodeResult()
+    : cte_rms(0.0), cte_max(0.0), etheta_rms(0.0), distance(0.0), mean_speed(0.0), cycles(0), infeasible(0),
+      solve_ms_mean(0.0), solve_ms_max(0.0), cpu_ms_mean(0.0), allocs(0), alloc_bytes(0), diverged(false)
+{
+}
+
+ClosedLoopSim::ClosedLoopSim(const std::map<std::string, double> &params, const PlantConfig &plant)
+    : _params(params), _plant(plant)
+{
+    _controller = TrackingController::Create((int)param(_params, "CONTROLLER", 0.0), _params);
+    if (!_controller)
+        _controller = TrackingController::Create(TrackingController::MPC_TRACKING, _params);
+    _dt = param(_params, "DT", 0.1);
+    _divergence = param(_params, "DIVERGENCE", 2.0);
+}
+
+const ReferenceTrajectory *ClosedLoopSim::reference(const std::string &type, double scale)
+{
+    const std::pair<std::string, double> key(type, scale);
+    std::shared_ptr<ReferenceTrajectory> &ref = _references[key];
+    if (!ref)
+    {
+        ref.reset(new ReferenceTrajectory);
+        ref->Generate(type, SPACING, scale);
+    }
+    return ref->Empty() ? NULL : ref.get();
+}
+
+EpisodeResult ClosedLoopSim::Run(const EpisodeConfig &episode)
+{
+    EpisodeResult result;
+    const ReferenceTrajectory *ref = reference(episode.trajectory, episode.scale);
+    if (!ref)
+    {
+        result.diverged = true;
+        return result;
+    }
+    const ReferenceTrajectory &traj = *ref;
+
+    // Plant on the reference, moved sideways and turned
+    const size_t i0 = size_t(std::max(0.0, episode.start - std::floor(episode.start)) * traj.Size()) % traj.Size();
+    double x = traj.X(i0) - episode.offset * std::sin(traj.Theta(i0));
+    double y = traj.Y(i0) + episode.offset * std::cos(traj.Theta(i0));
+    double theta = traj.Theta(i0) + episode.heading;
+    double v = 0.0, w = 0.0;
+    double wheel_l = 0.0, wheel_r = 0.0;
+    // Progress along the loop: the controller follows the measured pose,
+    // the error is taken at the true one
+    size_t control_index = i0, error_index = i0;
+
+    std::mt19937 rng(episode.seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::deque<Command> pending;
+    Command applied = {0.0, 0.0, 0.0};
+    CompactPath window;
+    _controller->Reset();
+    const double path_length = _controller->PathLength();
+    result.solve_ms.reserve(size_t(std::ceil(episode.duration / _dt)));
+
+    double sq_cte = 0.0, sq_etheta = 0.0, solve_ms = 0.0, cpu_ms = 0.0;
+    const int substeps = std::max(1, int(std::round(_dt / std::max(1e-4, _plant.substep))));
+    const double h = _dt / substeps;
+    const int cycles = int(std::ceil(episode.duration / _dt));
+    for (int k = 0; k < cycles; k++)
+    {
+        const double t = k * _dt;
+
+        // Measurement and the window ahead of it
+        const double mx = x + _plant.pos_noise * normal(rng);
+        const double my = y + _plant.pos_noise * normal(rng);
+        const double mtheta = theta + _plant.yaw_noise * normal(rng);
+        const double mv = v + _plant.vel_noise * normal(rng);
+        control_index = nearest(traj, mx, my, control_index);
+        traj.Window(control_index, path_length, "odom", ros::Time(), window);
+
+        double speed, angvel;
+        AllocClock allocs;
+        const double cpu0 = threadCpuMs();
+        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        const bool commanded = _controller->Command(window, mx, my, mtheta, mv, speed, angvel);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        cpu_ms += threadCpuMs() - cpu0;
+        unsigned long long bytes;
+        result.allocs += allocs.Lap(bytes);
+        result.alloc_bytes += bytes;
+        solve_ms += ms;
+        result.solve_ms.push_back(ms);
+        result.solve_ms_max = std::max(result.solve_ms_max, ms);
+        if (commanded)
+        {
+            if (!_controller->Feasible())
+                result.infeasible++;
+            Command cmd = {t + _plant.latency, speed, angvel};
+            pending.push_back(cmd);
+        }
+        else
+            result.infeasible++;
+        result.cycles++;
+
+        // Plant over the control period
+        for (int s = 0; s < substeps; s++)
+        {
+            const double ts = t + s * h;
+            while (!pending.empty() && pending.front().time <= ts + 1e-9)
+            {
+                applied = pending.front();
+                pending.pop_front();
+            }
+            if (_plant.model == PlantConfig::DIFF_DRIVE)
+            {
+                const double half = 0.5 * _plant.track_width;
+                wheel_l = wheel(wheel_l, (applied.speed - applied.angvel * half) / _plant.wheel_radius, _plant, h);
+                wheel_r = wheel(wheel_r, (applied.speed + applied.angvel * half) / _plant.wheel_radius, _plant, h);
+                v = 0.5 * (wheel_r + wheel_l) * _plant.wheel_radius;
+                w = (wheel_r - wheel_l) * _plant.wheel_radius / _plant.track_width;
+            }
+            else
+            {
+                v = applied.speed;
+                w = applied.angvel;
+            }
+            // Exact arc of the step
+            if (std::fabs(w) > 1e-9)
+            {
+                x += v / w * (std::sin(theta + w * h) - std::sin(theta));
+                y -= v / w * (std::cos(theta + w * h) - std::cos(theta));
+            }
+            else
+            {
+                x += v * std::cos(theta) * h;
+                y += v * std::sin(theta) * h;
+            }
+            theta = wrap(theta + w * h);
+            result.distance += std::fabs(v) * h;
+        }
+
+        // Error at the true pose: distance to the nearest reference pose,
+        // signed left of it. Not the lateral offset, which vanishes for a
+        // robot leaving the loop along the tangent of a corner.
+        const size_t i = error_index = nearest(traj, x, y, error_index);
+        const double dx = x - traj.X(i), dy = y - traj.Y(i);
+        const double lateral = dy * std::cos(traj.Theta(i)) - dx * std::sin(traj.Theta(i));
+        const double cte = lateral < 0.0 ? -std::hypot(dx, dy) : std::hypot(dx, dy);
+        const double etheta = wrap(theta - traj.Theta(i));
+        sq_cte += cte * cte;
+        sq_etheta += etheta * etheta;
+        result.cte_max = std::max(result.cte_max, std::fabs(cte));
+        if (std::fabs(cte) > _divergence)
+        {
+            result.diverged = true;
+            break;
+        }
+    }
+    if (result.cycles > 0)
+    {
+        result.cte_rms = std::sqrt(sq_cte / result.cycles);
+        result.etheta_rms = std::sqrt(sq_etheta / result.cycles);
+        result.mean_speed = result.distance / (result.cycles * _dt);
+        result.solve_ms_mean = solve_ms / result.cycles;
+        result.cpu_ms_mean = cpu_ms / result.cycles;
+    }
+    return result;
+}
+
+void ClosedLoopSim::RunAll(const std::map<std::string, double> &params, const PlantConfig &plant,
+                           const std::vector<EpisodeConfig> &episodes, int threads,
+                           std::vector<EpisodeResult> &results)
+{
+    results.assign(episodes.size(), EpisodeResult());
+    threads = std::max(1, std::min(threads, int(episodes.size())));
+    // Before a second thread touches CppAD, see cppad_parallel.h
+    cppad_parallel::Setup();
+
+    // Episodes are handed out one at a time, the long ones do not hold
+    // up a thread with a fixed share
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++)
+    {
+        pool.emplace_back([&]
+        {
+            ClosedLoopSim sim(params, plant);
+            for (size_t i = next++; i < episodes.size(); i = next++)
+                results[i] = sim.Run(episodes[i]);
+        });
+    }
+    for (size_t t = 0; t < pool.size(); t++)
+        pool[t].join();
+}
+
+std::map<std::string, double> ClosedLoopSim::DefaultParams()
+{
+    std::map<std::string, double> params;
+    params["DT"]        = 0.1;
+    params["STEPS"]     = 20.0;
+    params["REF_CTE"]   = 0.0;
+    params["REF_ETHETA"] = 0.0;
+    params["REF_V"]     = 1.0;
+    params["W_CTE"]     = 5000.0;
+    params["W_EPSI"]    = 5000.0;
+    params["W_V"]       = 1.0;
+    params["W_ANGVEL"]  = 100.0;
+    params["W_A"]       = 50.0;
+    params["W_DANGVEL"] = 10.0;
+    params["W_DA"]      = 10.0;
+    params["ANGVEL"]    = 3.0;
+    params["MAXTHR"]    = 1.0;
+    params["BOUND"]     = 1.0e3;
+    params["TAPE"]      = 1.0;
+    params["WARM"]      = 1.0;
+    return params;
+}
+
+bool ClosedLoopSim::SetPlant(const std::string &key, double value, PlantConfig &plant)
+{
+    if (key == "PLANT")
+        plant.model = (int)value;
+    else if (key == "LATENCY")
+        plant.latency = value;
+    else if (key == "POS_NOISE")
+        plant.pos_noise = value;
+    else if (key == "YAW_NOISE")
+        plant.yaw_noise = value;
+    else if (key == "VEL_NOISE")
+        plant.vel_noise = value;
+    else if (key == "SUBSTEP")
+        plant.substep = value;
+    else if (key == "TRACK_WIDTH")
+        plant.track_width = value;
+    else if (key == "WHEEL_RADIUS")
+        plant.wheel_radius = value;
+    else if (key == "MAX_WHEEL_SPEED")
+        plant.max_wheel_speed = value;
+    else if (key == "WHEEL_TAU")
+        plant.wheel_tau = value;
+    else
+        return false;
+    return true;
+}
+
+std::vector<EpisodeConfig> ClosedLoopSim::RandomEpisodes(int count, const std::string &trajectory, double scale,
+                                                         double duration, double offset, double heading,
+                                                         unsigned seed)
+{
+    static const char *types[] = {"circle", "epitrochoid", "square", "infinite"};
+    std::vector<EpisodeConfig> runs(std::max(0, count));
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        std::mt19937 rng(seed + i);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        EpisodeConfig &run = runs[i];
+        run.trajectory = trajectory == "all" ? types[i % 4] : trajectory;
+        run.scale = scale;
+        run.duration = duration;
+        run.start = unit(rng);
+        run.offset = offset * (2.0 * unit(rng) - 1.0);
+        run.heading = heading * (2.0 * unit(rng) - 1.0);
+        run.seed = seed + i;
+    }
+    return runs;
+}
@@ -0,0 +1,149 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "coarse_guide.h"
+#include <chrono>
+#include <cmath>
+#include "trace_span.h"
+
+GuideRequest::GuideRequest()
+{
+    stamp = 0.0;
+    px = py = theta = 0.0;
+}
+
+GuidePlan::GuidePlan()
+{
+    stamp = 0.0;
+}
+
+bool GuidePlan::Sample(double time, double &xs, double &ys, double &thetas, double &vs) const
+{
+    const double s = time - stamp;
+    if (t.size() < 2 || s < t.front() || s > t.back())
+        return false;
+    size_t i = 0;
+    while (i + 2 < t.size() && s > t[i + 1])
+        i++;
+    const double span = t[i + 1] - t[i];
+    const double a = span > 0.0 ? (s - t[i]) / span : 0.0;
+    xs = x[i] + a * (x[i + 1] - x[i]);
+    ys = y[i] + a * (y[i + 1] - y[i]);
+    thetas = theta[i] + a * (theta[i + 1] - theta[i]);
+    vs = v[i] + a * (v[i + 1] - v[i]);
+    return true;
+}
+
+CoarseGuide::CoarseGuide()
+{
+    _period = 1.0;
+    _running = false;
+}
+
+CoarseGuide::~CoarseGuide()
+{
+    Stop();
+}
+
+void CoarseGuide::Start(const std::map<std::string, double> &params, int steps, double dt, double rate)
+{
+    Stop();
+    std::map<std::string, double> coarse = params;
+    coarse["STEPS"] = steps;
+    coarse["DT"] = dt;
+    _mpc.LoadParams(coarse);
+    _period = rate > 0.0 ? 1.0 / rate : 1.0;
+    _running = true;
+    _thread = std::thread(&CoarseGuide::Run, this);
+}
+
+void CoarseGuide::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _running = false;
+    }
+    _cond.notify_all();
+    if (_thread.joinable())
+        _thread.join();
+}
+
+bool CoarseGuide::IsRunning() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _running;
+}
+
+void CoarseGuide::Run()
+{
+    MPC_TRACE_THREAD("mpc_guide");
+    const std::chrono::duration<double> period(_period);
+    std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+    double solved = -1.0; // stamp of the last request solved
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_running)
+    {
+        lock.unlock();
+        const GuideRequest *request = _requests.Take();
+        if (request && request->stamp != solved)
+        {
+            MPC_TRACE_SPAN("guide_solve");
+            solved = request->stamp;
+            if (solve(*request, _plans.Back()))
+                _plans.Publish();
+        }
+        lock.lock();
+
+        // Fixed rate; a solve longer than the period starts the next one at once
+        next += std::chrono::duration_cast<std::chrono::steady_clock::duration>(period);
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (next < now)
+            next = now;
+        _cond.wait_until(lock, next, [this] { return !_running; });
+    }
+}
+
+bool CoarseGuide::solve(const GuideRequest &request, GuidePlan &plan)
+{
+    _mpc.SolveReference(request.state, request.ref);
+    if (!_mpc._mpc_feasible || _mpc.mpc_x.size() < 2)
+        return false;
+
+    // Back to the odom frame, speeds integrated from the accelerations
+    const size_t n = _mpc.mpc_x.size();
+    const double c = std::cos(request.theta), s = std::sin(request.theta);
+    plan.stamp = request.stamp;
+    plan.t.resize(n);
+    plan.x.resize(n);
+    plan.y.resize(n);
+    plan.theta.resize(n);
+    plan.v.resize(n);
+    plan.t[0] = 0.0;
+    plan.v[0] = request.state[3];
+    for (size_t i = 0; i < n; i++)
+    {
+        plan.x[i] = request.px + _mpc.mpc_x[i] * c - _mpc.mpc_y[i] * s;
+        plan.y[i] = request.py + _mpc.mpc_x[i] * s + _mpc.mpc_y[i] * c;
+        plan.theta[i] = request.theta + _mpc.mpc_theta[i];
+        if (i == 0)
+            continue;
+        const double dt = i - 1 < _mpc.mpc_step_dt.size() ? _mpc.mpc_step_dt[i - 1] : _mpc._mpc_dt;
+        const double a = i - 1 < _mpc.mpc_accel.size() ? _mpc.mpc_accel[i - 1] : 0.0;
+        plan.t[i] = plan.t[i - 1] + dt;
+        plan.v[i] = plan.v[i - 1] + a * dt;
+    }
+    return true;
+}
@@ -0,0 +1,113 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "codegen_model.h"
+#include <iostream>
+
+using CppAD::AD;
+using namespace CppAD::cg;
+
+bool CodegenModel::Generate(const std::string &library, const std::string &model,
+                            size_t n_vars, size_t n_constraints, size_t n_params,
+                            const FgFunction &fg_eval)
+{
+    size_t n = n_vars + n_params;
+    size_t m = 1 + n_constraints;
+
+    try
+    {
+        // The MPC model has no value dependent branches, so any point will do.
+        ADvector a_x(n), a_fg(m);
+        for (size_t j = 0; j < n; j++)
+            a_x[j] = 0.0;
+        CppAD::Independent(a_x);
+        fg_eval(a_fg, a_x);
+        CppAD::ADFun<CGD> fun(a_x, a_fg);
+        fun.optimize();
+
+        ModelCSourceGen<double> cgen(fun, model);
+        cgen.setCreateForwardZero(true);
+        cgen.setCreateSparseJacobian(true);
+        cgen.setCreateSparseHessian(true);
+        ModelLibraryCSourceGen<double> libcgen(cgen);
+
+        GccCompiler<double> compiler;
+        compiler.setSourcesFolder(library + "_sources");
+        compiler.setSaveToDiskFirst(true);
+        DynamicModelLibraryProcessor<double> processor(libcgen, library);
+        processor.createDynamicLibrary(compiler, false);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "CodegenModel: generating " << model << " failed: " << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool CodegenModel::Load(const std::string &library, const std::string &model,
+                        size_t n_vars, size_t n_constraints, size_t n_params)
+{
+    _model.reset();
+    _lib.reset();
+    try
+    {
+        _lib.reset(new LinuxDynamicLib<double>(library + system::SystemInfo<>::DYNAMIC_LIB_EXTENSION));
+        if (_lib->getModelNames().count(model) == 0)
+        {
+            _lib.reset();
+            return false;
+        }
+        _model = _lib->model(model);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "CodegenModel: loading " << library << " failed: " << e.what() << std::endl;
+        _model.reset();
+        _lib.reset();
+        return false;
+    }
+
+    if (!_model || _model->Domain() != n_vars + n_params || _model->Range() != 1 + n_constraints
+        || !_model->isForwardZeroAvailable() || !_model->isSparseJacobianAvailable()
+        || !_model->isSparseHessianAvailable())
+    {
+        _model.reset();
+        _lib.reset();
+        return false;
+    }
+
+    _model->JacobianSparsity(_row_jac, _col_jac);
+    _model->HessianSparsity(_row_hes, _col_hes);
+    return true;
+}
+
+void CodegenModel::ForwardZero(const std::vector<double> &x, std::vector<double> &fg)
+{
+    _model->ForwardZero(x, fg);
+}
+
+void CodegenModel::SparseJacobian(const std::vector<double> &x, std::vector<double> &jac)
+{
+    _model->SparseJacobian(x, jac, _row_tmp, _col_tmp);
+}
+
+void CodegenModel::SparseHessian(const std::vector<double> &x, const std::vector<double> &w,
+                                 std::vector<double> &hes)
+{
+    _model->SparseHessian(x, w, hes, _row_tmp, _col_tmp);
+}
@@ -0,0 +1,118 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "compact_path.h"
+#include <algorithm>
+#include <cmath>
+#include <Eigen/Core>
+
+CompactPath::CompactPath()
+{
+}
+
+void CompactPath::Set(const nav_msgs::Path &path)
+{
+    Clear();
+    Reserve(path.poses.size());
+    for (size_t i = 0; i < path.poses.size(); i++)
+        PushBack(path.poses[i].pose);
+    _frame = path.header.frame_id.empty() && !path.poses.empty() ? path.poses[0].header.frame_id
+                                                                  : path.header.frame_id;
+    _stamp = path.header.stamp;
+}
+
+void CompactPath::ToMsg(nav_msgs::Path &path) const
+{
+    path.header.frame_id = _frame;
+    path.header.stamp = _stamp;
+    path.poses.resize(_x.size());
+    for (size_t i = 0; i < _x.size(); i++)
+    {
+        geometry_msgs::PoseStamped &pose = path.poses[i];
+        pose.header.frame_id = _frame;
+        pose.header.stamp = _stamp;
+        pose.pose.position.x = _x[i];
+        pose.pose.position.y = _y[i];
+        pose.pose.position.z = 0.0;
+        pose.pose.orientation.x = 0.0;
+        pose.pose.orientation.y = 0.0;
+        pose.pose.orientation.z = sin(0.5 * _yaw[i]);
+        pose.pose.orientation.w = cos(0.5 * _yaw[i]);
+    }
+}
+
+void CompactPath::Clear()
+{
+    _x.clear();
+    _y.clear();
+    _yaw.clear();
+    _s.clear();
+}
+
+void CompactPath::Reserve(size_t n)
+{
+    _x.reserve(n);
+    _y.reserve(n);
+    _yaw.reserve(n);
+    _s.reserve(n);
+}
+
+void CompactPath::PushBack(double x, double y, double yaw)
+{
+    _s.push_back(_x.empty() ? 0.0 : _s.back() + std::hypot(x - _x.back(), y - _y.back()));
+    _x.push_back(x);
+    _y.push_back(y);
+    _yaw.push_back(yaw);
+}
+
+void CompactPath::Transform(double x, double y, double yaw)
+{
+    const Eigen::Index n = _x.size();
+    Eigen::Map<Eigen::ArrayXd> px(_x.data(), n), py(_y.data(), n), pyaw(_yaw.data(), n);
+    const double c = std::cos(yaw), s = std::sin(yaw);
+    const Eigen::ArrayXd rx = c * px - s * py + x;
+    py = s * px + c * py + y;
+    px = rx;
+    // yaw + yaw in (-pi, pi], without a trigonometric call per waypoint
+    pyaw += yaw;
+    pyaw = (pyaw > M_PI).select(pyaw - 2.0 * M_PI, (pyaw <= -M_PI).select(pyaw + 2.0 * M_PI, pyaw));
+}
+
+void CompactPath::PushBack(const geometry_msgs::Pose &pose)
+{
+    const geometry_msgs::Quaternion &q = pose.orientation;
+    PushBack(pose.position.x, pose.position.y, QuaternionYaw(q.x, q.y, q.z, q.w));
+}
+
+void CompactPath::EraseFront(size_t n)
+{
+    n = std::min(n, _x.size());
+    _x.erase(_x.begin(), _x.begin() + n);
+    _y.erase(_y.begin(), _y.begin() + n);
+    _yaw.erase(_yaw.begin(), _yaw.begin() + n);
+    _s.erase(_s.begin(), _s.begin() + n);
+    if (!_s.empty())
+    {
+        const double s0 = _s[0];
+        for (size_t i = 0; i < _s.size(); i++)
+            _s[i] -= s0;
+    }
+}
+
+double CompactPath::QuaternionYaw(double qx, double qy, double qz, double qw)
+{
+    return atan2(2.0 * (qw * qz + qx * qy), 1.0 - 2.0 * (qy * qy + qz * qz));
+}
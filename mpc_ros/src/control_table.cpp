@@ -0,0 +1,263 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "control_table.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdint.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    const char MAGIC[8] = { 'M', 'P', 'C', 'T', 'B', 'L', '1', '\0' };
+
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t dims, reserved;
+        uint64_t params_hash;
+        double min[ControlTable::DIMS], max[ControlTable::DIMS];
+        int32_t n[ControlTable::DIMS];
+        int32_t pad;
+    };
+
+    // Keys of MPC::LoadParams the optimal control depends on
+    const char *MODEL_KEYS[] = { "DT", "STEPS", "REF_CTE", "REF_ETHETA", "REF_V", "W_CTE", "W_EPSI",
+                                 "W_V", "W_ANGVEL", "W_A", "W_DANGVEL", "W_DA", "ANGVEL", "MAXTHR",
+                                 "BOUND", "ADAPTIVE", "MIN_STEPS", "HORIZON_PREVIEW" };
+}
+
+ControlTable::ControlTable()
+    : _size(0), _params_hash(0), _values(NULL), _map(NULL), _map_size(0)
+{
+    for (int d = 0; d < DIMS; d++)
+    {
+        _axes[d].min = _axes[d].max = 0.0;
+        _axes[d].n = 0;
+        _stride[d] = 0;
+    }
+}
+
+ControlTable::~ControlTable()
+{
+    Close();
+}
+
+void ControlTable::Create(const Axis axes[DIMS], unsigned long long params_hash)
+{
+    Close();
+    _size = 1;
+    for (int d = DIMS - 1; d >= 0; d--)
+    {
+        _axes[d] = axes[d];
+        _axes[d].n = std::max(2, _axes[d].n);
+        _stride[d] = _size;
+        _size *= _axes[d].n;
+    }
+    _params_hash = params_hash;
+    _data.assign(2 * _size, std::numeric_limits<float>::quiet_NaN());
+    _values = _data.data();
+}
+
+void ControlTable::Point(size_t index, double query[DIMS]) const
+{
+    for (int d = 0; d < DIMS; d++)
+    {
+        const int i = (index / _stride[d]) % _axes[d].n;
+        query[d] = _axes[d].min + (_axes[d].max - _axes[d].min) * i / (_axes[d].n - 1);
+    }
+}
+
+void ControlTable::Set(size_t index, double angvel, double accel)
+{
+    _data[2 * index] = angvel;
+    _data[2 * index + 1] = accel;
+}
+
+bool ControlTable::Write(const std::string &path) const
+{
+    if (!Valid())
+    {
+        return false;
+    }
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.dims = DIMS;
+    header.params_hash = _params_hash;
+    for (int d = 0; d < DIMS; d++)
+    {
+        header.min[d] = _axes[d].min;
+        header.max[d] = _axes[d].max;
+        header.n[d] = _axes[d].n;
+    }
+    std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(_values), 2 * _size * sizeof(float));
+    return file.good();
+}
+
+bool ControlTable::Open(const std::string &path)
+{
+    Close();
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    void *map = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(FileHeader))
+    {
+        map = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (map == MAP_FAILED)
+    {
+        return false;
+    }
+    _map = map;
+    _map_size = info.st_size;
+
+    // Check the header and that the data fills the rest of the file
+    const FileHeader *header = static_cast<const FileHeader *>(map);
+    bool ok = std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) == 0 && header->dims == DIMS;
+    _size = 1;
+    for (int d = DIMS - 1; ok && d >= 0; d--)
+    {
+        _axes[d].min = header->min[d];
+        _axes[d].max = header->max[d];
+        _axes[d].n = header->n[d];
+        ok = _axes[d].n >= 2 && _axes[d].max > _axes[d].min;
+        _stride[d] = _size;
+        _size *= ok ? _axes[d].n : 1;
+    }
+    if (!ok || _map_size != sizeof(FileHeader) + 2 * _size * sizeof(float))
+    {
+        Close();
+        return false;
+    }
+    _params_hash = header->params_hash;
+    _values = reinterpret_cast<const float *>(static_cast<const char *>(map) + sizeof(FileHeader));
+    return true;
+}
+
+void ControlTable::Close()
+{
+    if (_map)
+    {
+        munmap(_map, _map_size);
+    }
+    _map = NULL;
+    _map_size = 0;
+    _data.clear();
+    _values = NULL;
+    _size = 0;
+}
+
+bool ControlTable::Lookup(const double query[DIMS], double &angvel, double &accel) const
+{
+    if (!Valid())
+    {
+        return false;
+    }
+    size_t base = 0;
+    double frac[DIMS];
+    for (int d = 0; d < DIMS; d++)
+    {
+        const double t = (query[d] - _axes[d].min) / (_axes[d].max - _axes[d].min) * (_axes[d].n - 1);
+        if (!(t >= 0.0 && t <= _axes[d].n - 1))
+        {
+            return false;
+        }
+        const int i = std::min((int)t, _axes[d].n - 2);
+        frac[d] = t - i;
+        base += i * _stride[d];
+    }
+
+    // 2^DIMS corners, those of zero weight may be failed points
+    angvel = 0.0;
+    accel = 0.0;
+    for (int corner = 0; corner < (1 << DIMS); corner++)
+    {
+        double weight = 1.0;
+        size_t index = base;
+        for (int d = 0; d < DIMS; d++)
+        {
+            const bool upper = corner & (1 << d);
+            weight *= upper ? frac[d] : 1.0 - frac[d];
+            index += upper ? _stride[d] : 0;
+        }
+        if (weight == 0.0)
+        {
+            continue;
+        }
+        const float w = _values[2 * index], a = _values[2 * index + 1];
+        if (std::isnan(w) || std::isnan(a))
+        {
+            return false;
+        }
+        angvel += weight * w;
+        accel += weight * a;
+    }
+    return true;
+}
+
+bool ControlTable::Query(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, double query[DIMS])
+{
+    if (state.size() != 6 || coeffs.size() != 4 || state[0] != 0.0 || state[1] != 0.0 || state[2] != 0.0)
+    {
+        return false;
+    }
+    query[0] = state[3];
+    query[1] = state[4];
+    query[2] = state[5];
+    query[3] = coeffs[2];
+    query[4] = coeffs[3];
+    // cte and etheta are the path at the vehicle, as MPC_Node computes them
+    return std::fabs(coeffs[0] - state[4]) < 1e-6 && std::fabs(std::atan(coeffs[1]) - state[5]) < 1e-6;
+}
+
+void ControlTable::Problem(const double query[DIMS], Eigen::VectorXd &state, Eigen::VectorXd &coeffs)
+{
+    state.resize(6);
+    state << 0, 0, 0, query[0], query[1], query[2];
+    coeffs.resize(4);
+    coeffs << query[1], std::tan(query[2]), query[3], query[4];
+}
+
+unsigned long long ControlTable::HashParams(const std::map<std::string, double> &params)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    for (size_t k = 0; k < sizeof(MODEL_KEYS) / sizeof(MODEL_KEYS[0]); k++)
+    {
+        std::map<std::string, double>::const_iterator it = params.find(MODEL_KEYS[k]);
+        double value = it != params.end() ? it->second : std::numeric_limits<double>::quiet_NaN();
+        const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&value);
+        for (size_t i = 0; i < sizeof(value); i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
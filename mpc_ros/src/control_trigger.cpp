@@ -0,0 +1,63 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "control_trigger.h"
+#include <algorithm>
+#include <cmath>
+
+ControlTrigger::ControlTrigger()
+{
+    _enabled = false;
+    _base_every = 1;
+    _every = 1;
+    _count = 0;
+    _offset = 0.0;
+    _watchdog = 1.5;
+    _last = 0.0;
+    _watchdog_cycles = 0;
+}
+
+void ControlTrigger::Configure(bool enabled, int every, double offset, double watchdog)
+{
+    _enabled = enabled;
+    _base_every = std::max(1, every);
+    _every = _base_every;
+    _count = 0;
+    _offset = std::max(0.0, offset);
+    _watchdog = std::max(1.0, watchdog);
+    _last = 0.0;
+    _watchdog_cycles = 0;
+}
+
+void ControlTrigger::Scale(double factor)
+{
+    _every = std::max(1, (int)std::lround(_base_every * factor));
+}
+
+bool ControlTrigger::Odometry()
+{
+    if (!_enabled || ++_count < _every)
+        return false;
+    _count = 0;
+    return true;
+}
+
+bool ControlTrigger::Overdue(double t, double period) const
+{
+    // Before the first message the timer runs the cycles
+    return !_enabled || t - _last > _watchdog * period * _every / _base_every;
+}
@@ -0,0 +1,282 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "controller_metrics.h"
+#include "tape_optimize.h"
+#include <cmath>
+#include <sstream>
+
+namespace
+{
+    const double LATENCY_EDGES_MS[] = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000};
+    const double ITERATION_EDGES[] = {1, 2, 5, 10, 20, 50, 100, 200, 500};
+    const double CTE_EDGES[] = {0.01, 0.02, 0.05, 0.1, 0.2, 0.5, 1.0, 2.0};
+    const double ETHETA_EDGES[] = {0.01, 0.02, 0.05, 0.1, 0.2, 0.5, 1.0, 2.0};
+    const double COMMAND_EDGES[] = {0.001, 0.002, 0.005, 0.01, 0.02, 0.05, 0.1, 0.2, 0.5, 1.0};
+
+    template <int N>
+    std::vector<double> edges(const double (&values)[N])
+    {
+        return std::vector<double>(values, values + N);
+    }
+
+    std::string withLabels(const std::string &labels, const std::string &extra)
+    {
+        if (labels.empty() && extra.empty())
+            return "";
+        if (labels.empty() || extra.empty())
+            return "{" + labels + extra + "}";
+        return "{" + labels + "," + extra + "}";
+    }
+
+    void renderCounter(const std::string &name, const std::string &help, const std::string &labels,
+                       uint64_t value, std::string &out)
+    {
+        std::ostringstream os;
+        os << "# HELP " << name << " " << help << "\n"
+           << "# TYPE " << name << " counter\n"
+           << name << withLabels(labels, "") << " " << value << "\n";
+        out += os.str();
+    }
+
+    void renderGauge(const std::string &name, const std::string &help, const std::string &labels,
+                     double value, std::string &out)
+    {
+        std::ostringstream os;
+        os << "# HELP " << name << " " << help << "\n"
+           << "# TYPE " << name << " gauge\n"
+           << name << withLabels(labels, "") << " " << value << "\n";
+        out += os.str();
+    }
+}
+
+MetricHistogram::MetricHistogram(const std::vector<double> &edges)
+    : _edges(edges), _buckets(edges.size() + 1)
+{
+    for (size_t i = 0; i < _buckets.size(); i++)
+        _buckets[i].store(0, std::memory_order_relaxed);
+    _count.store(0, std::memory_order_relaxed);
+    _sum.store(0.0, std::memory_order_relaxed);
+}
+
+void MetricHistogram::Observe(double value)
+{
+    if (!std::isfinite(value))
+        return;
+    size_t i = 0;
+    while (i < _edges.size() && value > _edges[i])
+        i++;
+    _buckets[i].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+
+    // No fetch_add for double before C++20
+    double sum = _sum.load(std::memory_order_relaxed);
+    while (!_sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed))
+        ;
+}
+
+void MetricHistogram::Render(const std::string &name, const std::string &help, const std::string &labels,
+                             double scale, std::string &out, bool header) const
+{
+    std::ostringstream os;
+    if (header)
+        os << "# HELP " << name << " " << help << "\n"
+           << "# TYPE " << name << " histogram\n";
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < _buckets.size(); i++)
+    {
+        cumulative += Bucket(i);
+        std::ostringstream le;
+        if (i < _edges.size())
+            le << "le=\"" << _edges[i] * scale << "\"";
+        else
+            le << "le=\"+Inf\"";
+        os << name << "_bucket" << withLabels(labels, le.str()) << " " << cumulative << "\n";
+    }
+    os << name << "_sum" << withLabels(labels, "") << " " << Sum() * scale << "\n"
+       << name << "_count" << withLabels(labels, "") << " " << cumulative << "\n";
+    out += os.str();
+}
+
+ShadowMetrics::ShadowMetrics(const std::string &backend)
+    : _backend(backend), _solve_ms(edges(LATENCY_EDGES_MS)), _iterations(edges(ITERATION_EDGES)),
+      _angvel_diff(edges(COMMAND_EDGES)), _accel_diff(edges(COMMAND_EDGES))
+{
+    _faster.store(0, std::memory_order_relaxed);
+    _dropped.store(0, std::memory_order_relaxed);
+    _infeasible.store(0, std::memory_order_relaxed);
+}
+
+void ShadowMetrics::ObserveSolve(double solve_ms, int iterations, double primary_ms, double angvel_diff, double accel_diff)
+{
+    _solve_ms.Observe(solve_ms);
+    if (iterations >= 0)
+        _iterations.Observe(iterations);
+    _angvel_diff.Observe(angvel_diff);
+    _accel_diff.Observe(accel_diff);
+    if (solve_ms < primary_ms)
+        _faster.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ShadowMetrics::Prometheus(const std::vector<std::unique_ptr<ShadowMetrics> > &shadows,
+                               const std::string &labels, std::string &out)
+{
+    if (shadows.empty())
+        return;
+    std::vector<std::string> backend_labels;
+    for (size_t i = 0; i < shadows.size(); i++)
+    {
+        const std::string backend = "backend=\"" + shadows[i]->Backend() + "\"";
+        backend_labels.push_back(labels.empty() ? backend : labels + "," + backend);
+    }
+
+    for (size_t i = 0; i < shadows.size(); i++)
+        shadows[i]->_solve_ms.Render("mpc_shadow_solve_duration_seconds", "Duration of a shadow solve.",
+                                     backend_labels[i], 1e-3, out, i == 0);
+    for (size_t i = 0; i < shadows.size(); i++)
+        shadows[i]->_iterations.Render("mpc_shadow_solver_iterations", "Solver iterations of a shadow solve.",
+                                       backend_labels[i], 1.0, out, i == 0);
+    for (size_t i = 0; i < shadows.size(); i++)
+        shadows[i]->_angvel_diff.Render("mpc_shadow_angvel_difference",
+                                        "Absolute difference of the first angular velocity to the primary solve [rad/s].",
+                                        backend_labels[i], 1.0, out, i == 0);
+    for (size_t i = 0; i < shadows.size(); i++)
+        shadows[i]->_accel_diff.Render("mpc_shadow_accel_difference",
+                                       "Absolute difference of the first acceleration to the primary solve [m/s^2].",
+                                       backend_labels[i], 1.0, out, i == 0);
+
+    std::ostringstream os;
+    os << "# HELP mpc_shadow_faster_total Shadow solves faster than the primary solve of the same inputs.\n"
+       << "# TYPE mpc_shadow_faster_total counter\n";
+    for (size_t i = 0; i < shadows.size(); i++)
+        os << "mpc_shadow_faster_total{" << backend_labels[i] << "} " << shadows[i]->Faster() << "\n";
+    os << "# HELP mpc_shadow_dropped_total Inputs replaced by newer ones before the shadow backend solved them.\n"
+       << "# TYPE mpc_shadow_dropped_total counter\n";
+    for (size_t i = 0; i < shadows.size(); i++)
+        os << "mpc_shadow_dropped_total{" << backend_labels[i] << "} " << shadows[i]->Dropped() << "\n";
+    os << "# HELP mpc_shadow_infeasible_total Shadow solves whose solution would not have been applied.\n"
+       << "# TYPE mpc_shadow_infeasible_total counter\n";
+    for (size_t i = 0; i < shadows.size(); i++)
+        os << "mpc_shadow_infeasible_total{" << backend_labels[i] << "} " << shadows[i]->Infeasible() << "\n";
+    out += os.str();
+}
+
+ControllerMetrics::ControllerMetrics()
+    : _cycle_ms(edges(LATENCY_EDGES_MS)), _solve_ms(edges(LATENCY_EDGES_MS)), _iterations(edges(ITERATION_EDGES)),
+      _cte(edges(CTE_EDGES)), _etheta(edges(ETHETA_EDGES))
+{
+    for (int i = 0; i < NUM_STATUS; i++)
+        _status[i].store(0, std::memory_order_relaxed);
+    _deadline_misses.store(0, std::memory_order_relaxed);
+    _fallbacks.store(0, std::memory_order_relaxed);
+    _infeasible.store(0, std::memory_order_relaxed);
+    _tf_stale.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < NUM_MEMORY_STORES; i++)
+        _memory[i].store(0, std::memory_order_relaxed);
+    _governor_level.store(0, std::memory_order_relaxed);
+    _cpu_share.store(0.0, std::memory_order_relaxed);
+}
+
+void ControllerMetrics::ObserveCycle(double total_ms)
+{
+    _cycle_ms.Observe(total_ms);
+}
+
+void ControllerMetrics::ObserveSolve(double solve_ms, int iterations, int status)
+{
+    _solve_ms.Observe(solve_ms);
+    if (iterations >= 0)
+        _iterations.Observe(iterations);
+    _status[statusIndex(status)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void ControllerMetrics::ObserveTracking(double cte, double etheta)
+{
+    _cte.Observe(std::fabs(cte));
+    _etheta.Observe(std::fabs(etheta));
+}
+
+const char *ControllerMetrics::StatusName(int status)
+{
+    static const char *NAMES[NUM_STATUS] = {
+        "not_defined", "success", "maxiter_exceeded", "stop_at_tiny_step", "stop_at_acceptable_point",
+        "local_infeasibility", "user_requested_stop", "feasible_point_found", "diverging_iterates",
+        "restoration_failure", "error_in_step_computation", "invalid_number_detected",
+        "too_few_degrees_of_freedom", "internal_error", "unknown"};
+    return NAMES[statusIndex(status)];
+}
+
+void ControllerMetrics::SetMemory(const TapeMemory &memory)
+{
+    SetMemory(MEMORY_TAPE, memory.tape);
+    SetMemory(MEMORY_TAYLOR, memory.taylor);
+    SetMemory(MEMORY_SPARSITY, memory.sparsity);
+    SetMemory(MEMORY_IPOPT, memory.ipopt);
+}
+
+const char *ControllerMetrics::MemoryStoreName(int store)
+{
+    static const char *NAMES[NUM_MEMORY_STORES] = {"tape", "taylor", "sparsity", "ipopt"};
+    return NAMES[store];
+}
+
+std::string ControllerMetrics::Prometheus(const std::string &labels) const
+{
+    std::string out;
+    _cycle_ms.Render("mpc_cycle_duration_seconds", "Duration of a control cycle.", labels, 1e-3, out);
+    _solve_ms.Render("mpc_solve_duration_seconds", "Duration of a solve.", labels, 1e-3, out);
+    _iterations.Render("mpc_solver_iterations", "Solver iterations of a solve.", labels, 1.0, out);
+    _cte.Render("mpc_cross_track_error_meters", "Absolute cross track error at the start of a cycle.", labels, 1.0, out);
+    _etheta.Render("mpc_heading_error_radians", "Absolute heading error at the start of a cycle.", labels, 1.0, out);
+
+    std::ostringstream os;
+    os << "# HELP mpc_solver_status_total Solves per solver status.\n"
+       << "# TYPE mpc_solver_status_total counter\n";
+    for (int i = 0; i < NUM_STATUS; i++)
+    {
+        const uint64_t count = Status(i);
+        if (count > 0)
+            os << "mpc_solver_status_total" << withLabels(labels, std::string("status=\"") + StatusName(i) + "\"")
+               << " " << count << "\n";
+    }
+    out += os.str();
+
+    renderCounter("mpc_deadline_misses_total", "Solves that exceeded their time budget.", labels, DeadlineMisses(), out);
+    renderCounter("mpc_fallbacks_total", "Cycles that followed a fallback instead of a new solution.", labels, Fallbacks(), out);
+    renderCounter("mpc_infeasible_total", "Solves whose solution was not applied.", labels, Infeasible(), out);
+    renderCounter("mpc_tf_stale_total", "Transform lookups answered from the cache.", labels, TfStale(), out);
+
+    std::ostringstream memory;
+    memory << "# HELP mpc_solver_memory_bytes Memory the solver holds between solves.\n"
+           << "# TYPE mpc_solver_memory_bytes gauge\n";
+    for (int i = 0; i < NUM_MEMORY_STORES; i++)
+        memory << "mpc_solver_memory_bytes" << withLabels(labels, std::string("store=\"") + MemoryStoreName(i) + "\"")
+               << " " << Memory(MemoryStore(i)) << "\n";
+    out += memory.str();
+
+    renderGauge("mpc_governor_level", "Degradation level of the CPU governor, 0 the configured controller.", labels,
+                GovernorLevel(), out);
+    renderGauge("mpc_cpu_share", "CPU seconds per second of the controller process in the last governor window.",
+                labels, CpuShare(), out);
+    ShadowMetrics::Prometheus(_shadows, labels, out);
+    return out;
+}
+
+ShadowMetrics &ControllerMetrics::AddShadow(const std::string &backend)
+{
+    _shadows.emplace_back(new ShadowMetrics(backend));
+    return *_shadows.back();
+}
@@ -0,0 +1,82 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "costmap_snapshot.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+CostmapSnapshot::CostmapSnapshot()
+    : _valid(false), _buffer(ALIGN), _offset(0), _size_x(0), _size_y(0), _resolution(0.0),
+      _origin_x(0.0), _origin_y(0.0), _x0(0), _y0(0), _map_x(0), _map_y(0), _map_origin_x(0.0), _map_origin_y(0.0)
+{
+}
+
+void CostmapSnapshot::Take(const unsigned char *costs, unsigned int size_x, unsigned int size_y,
+                           double resolution, double origin_x, double origin_y,
+                           double x, double y, double radius)
+{
+    _valid = false;
+    if (!costs || size_x == 0 || size_y == 0 || resolution <= 0.0)
+        return;
+
+    // Window of 2 * half + 1 cells around the cell of (x, y), moved inside
+    // the costmap at its borders
+    const int half = std::max(0, (int)std::ceil(radius / resolution));
+    const int n_x = std::min((int)size_x, 2 * half + 1), n_y = std::min((int)size_y, 2 * half + 1);
+    const int cx = (int)std::floor((x - origin_x) / resolution), cy = (int)std::floor((y - origin_y) / resolution);
+    _x0 = std::max(0, std::min((int)size_x - n_x, cx - half));
+    _y0 = std::max(0, std::min((int)size_y - n_y, cy - half));
+
+    // Grow only, the start of the window on a cache line
+    const size_t cells = (size_t)n_x * n_y;
+    if (_buffer.size() < cells + ALIGN)
+        _buffer.resize(cells + ALIGN);
+    const uintptr_t base = reinterpret_cast<uintptr_t>(_buffer.data());
+    _offset = (ALIGN - base % ALIGN) % ALIGN;
+
+    unsigned char *out = &_buffer[_offset];
+    for (int row = 0; row < n_y; row++)
+        std::memcpy(out + (size_t)row * n_x, costs + (size_t)(_y0 + row) * size_x + _x0, n_x);
+
+    _size_x = n_x;
+    _size_y = n_y;
+    _resolution = resolution;
+    _origin_x = origin_x + _x0 * resolution;
+    _origin_y = origin_y + _y0 * resolution;
+    _map_x = size_x;
+    _map_y = size_y;
+    _map_origin_x = origin_x;
+    _map_origin_y = origin_y;
+    _valid = true;
+}
+
+bool CostmapSnapshot::Covers(const double *x, const double *y, size_t n, double margin) const
+{
+    if (!_valid)
+        return false;
+    // Cells of the window, extended to the costmap border where it ends there
+    const double x_min = _x0 == 0 ? -1e300 : _origin_x, y_min = _y0 == 0 ? -1e300 : _origin_y;
+    const double x_max = _x0 + _size_x == _map_x ? 1e300 : _origin_x + _size_x * _resolution;
+    const double y_max = _y0 + _size_y == _map_y ? 1e300 : _origin_y + _size_y * _resolution;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (x[i] - margin < x_min || x[i] + margin > x_max || y[i] - margin < y_min || y[i] + margin > y_max)
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,80 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+// ColPack side of CppAD's colpack.* coloring methods, which the vendored
+// CppAD only declares (cppad/local/cppad_colpack.hpp); built with
+// BUILD_COLPACK. In a translation unit of its own since ColPackHeaders.h
+// has a using namespace std at global scope.
+#include <cppad/configure.hpp>
+#if CPPAD_HAS_COLPACK
+#include <cppad/utility/vector.hpp>
+#include <cppad/local/cppad_colpack.hpp>
+#include <ColPack/ColPackHeaders.h>
+
+namespace
+{
+    // Color of every row from the seed matrix (rows x colors), n_rows
+    // for a row without nonzeros
+    void seedColors(double **seed, int n_seed_rows, int n_seed_cols, size_t n_rows, CppAD::vector<size_t> &color)
+    {
+        color.resize(n_rows);
+        for (size_t i = 0; i < n_rows; i++)
+            color[i] = n_rows;
+        for (int i = 0; i < n_seed_rows && (size_t)i < n_rows; i++)
+            for (int k = 0; k < n_seed_cols; k++)
+                if (seed[i][k] != 0.0)
+                    color[i] = k;
+    }
+}
+
+namespace CppAD { namespace local {
+
+void cppad_colpack_general(CppAD::vector<size_t> &color, size_t m, size_t n,
+                           const CppAD::vector<unsigned int*> &adolc_pattern)
+{
+    // Rows that share no column get the same color
+    ColPack::BipartiteGraphPartialColoringInterface graph(
+        SRC_MEM_ADOLC, const_cast<unsigned int**>(adolc_pattern.data()), (int)m, (int)n);
+    graph.PartialDistanceTwoColoring("SMALLEST_LAST", "ROW_PARTIAL_DISTANCE_TWO");
+
+    // The seed is colors x rows for a row coloring
+    int n_seed_rows = 0, n_seed_cols = 0;
+    double **seed = graph.GetSeedMatrix(&n_seed_rows, &n_seed_cols);
+    color.resize(m);
+    for (size_t i = 0; i < m; i++)
+        color[i] = m;
+    for (int k = 0; k < n_seed_rows; k++)
+        for (int i = 0; i < n_seed_cols && (size_t)i < m; i++)
+            if (seed[k][i] != 0.0)
+                color[i] = k;
+}
+
+void cppad_colpack_symmetric(CppAD::vector<size_t> &color, size_t n,
+                             const CppAD::vector<unsigned int*> &adolc_pattern)
+{
+    // Star coloring: the Hessian can be read off the compressed one
+    // directly, which is the recovery CppAD's SparseHessian does
+    ColPack::GraphColoringInterface graph(
+        SRC_MEM_ADOLC, const_cast<unsigned int**>(adolc_pattern.data()), (int)n);
+    graph.Coloring("SMALLEST_LAST", "STAR");
+
+    int n_seed_rows = 0, n_seed_cols = 0;
+    double **seed = graph.GetSeedMatrix(&n_seed_rows, &n_seed_cols);
+    seedColors(seed, n_seed_rows, n_seed_cols, n, color);
+}
+
+} } // namespace CppAD::local
+#endif
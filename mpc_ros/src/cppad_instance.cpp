@@ -0,0 +1,33 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "cppad_instance.h"
+
+// Definitions for the extern template declarations of cppad_instance.h
+namespace CppAD
+{
+    template class AD<double>;
+    template class ADFun<double>;
+
+    template void ADFun<double>::Dependent(
+        const CPPAD_TESTVECTOR(AD<double>) &x,
+        const CPPAD_TESTVECTOR(AD<double>) &y);
+    template CPPAD_TESTVECTOR(double) ADFun<double>::Forward(
+        size_t q, const CPPAD_TESTVECTOR(double) &xq, std::ostream &s);
+    template CPPAD_TESTVECTOR(double) ADFun<double>::Reverse(
+        size_t p, const CPPAD_TESTVECTOR(double) &w);
+}
@@ -0,0 +1,109 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "cppad_parallel.h"
+#include "cppad_instance.h"
+#ifdef MPC_CODEGEN
+#include <cppad/cg.hpp>
+#endif
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    std::mutex g_mutex;
+    std::vector<size_t> g_free; // numbers of the threads that exited
+    size_t g_next = 0;
+    size_t g_active = 0;
+
+    struct ThreadSlot
+    {
+        ThreadSlot() : num(0), valid(false) {}
+        ~ThreadSlot()
+        {
+            if (!valid)
+                return;
+            CppAD::thread_alloc::free_available(num);
+            std::lock_guard<std::mutex> lock(g_mutex);
+            g_free.push_back(num);
+            g_active--;
+        }
+
+        size_t num;
+        bool valid;
+    };
+    thread_local ThreadSlot t_slot;
+
+    size_t acquire()
+    {
+        if (!t_slot.valid)
+        {
+            std::lock_guard<std::mutex> lock(g_mutex);
+            if (g_free.empty())
+            {
+                t_slot.num = g_next++;
+            }
+            else
+            {
+                t_slot.num = g_free.back();
+                g_free.pop_back();
+            }
+            t_slot.valid = true;
+            g_active++;
+        }
+        return t_slot.num;
+    }
+
+    // A thread is numbered before CppAD asks anything else about it
+    bool inParallel()
+    {
+        acquire();
+        std::lock_guard<std::mutex> lock(g_mutex);
+        return g_active > 1;
+    }
+}
+
+namespace cppad_parallel
+{
+    void Setup()
+    {
+        static std::once_flag once;
+        std::call_once(once, []
+        {
+            // The setup thread is number 0
+            acquire();
+            CppAD::thread_alloc::parallel_setup(CPPAD_MAX_NUM_THREADS, inParallel, ThreadNum);
+            CppAD::thread_alloc::hold_memory(true);
+            CppAD::parallel_ad<double>();
+            CppAD::parallel_ad<float>(); // TapeSolver::RecordSingle()
+#ifdef MPC_CODEGEN
+            CppAD::parallel_ad< CppAD::cg::CG<double> >(); // worker of MPC::SetJit()
+#endif
+        });
+    }
+
+    size_t ThreadNum()
+    {
+        return acquire();
+    }
+
+    size_t ActiveThreads()
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        return g_active;
+    }
+}
@@ -0,0 +1,142 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "cpu_governor.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <time.h>
+
+CpuGovernor::Config::Config()
+    : share(0.0), min_slack(0.2), window(1.0), up_windows(2), down_windows(10), release(0.7),
+      max_viz_every(8), max_tol_scale(100.0), gauss_newton(true), min_steps(10), max_dt(0.25), min_freq(5.0)
+{
+}
+
+CpuGovernor::CpuGovernor()
+    : _index(0), _window_start(-1.0), _cpu_start(0.0), _slack_sum(0.0), _slack_count(0), _over(0), _under(0),
+      _share(0.0), _slack(1.0)
+{
+    const Level base = { 0, 0.0, 0, 1.0, 1, 0.0 };
+    _ladder.assign(1, base);
+}
+
+void CpuGovernor::Configure(const Config &config, const Level &base)
+{
+    _config = config;
+    _ladder.assign(1, base);
+    _index = 0;
+    _window_start = -1.0;
+    _over = _under = 0;
+
+    // One step of each knob in turn, until none can move
+    Level level = base;
+    for (bool moved = true; moved;)
+    {
+        moved = false;
+        if (level.viz_every * 2 <= _config.max_viz_every)
+        {
+            level.viz_every *= 2;
+            _ladder.push_back(level);
+            moved = true;
+        }
+        if (level.tol_scale * 10.0 <= _config.max_tol_scale * (1.0 + 1e-9))
+        {
+            level.tol_scale *= 10.0;
+            _ladder.push_back(level);
+            moved = true;
+        }
+        if (_config.gauss_newton && level.hessian == 0)
+        {
+            level.hessian = 1;
+            _ladder.push_back(level);
+            moved = true;
+        }
+        const int steps = std::max(_config.min_steps, (int)std::floor(0.75 * level.steps));
+        const double dt = std::min(_config.max_dt, level.dt * (level.steps - 1) / std::max(1, steps - 1));
+        if (steps < level.steps)
+        {
+            level.steps = steps;
+            level.dt = std::max(level.dt, dt);
+            _ladder.push_back(level);
+            moved = true;
+        }
+        const double freq = std::max(_config.min_freq, 0.8 * level.freq);
+        if (freq < level.freq - 1e-9)
+        {
+            level.freq = freq;
+            _ladder.push_back(level);
+            moved = true;
+        }
+    }
+}
+
+bool CpuGovernor::Cycle(double cycle_ms, double period)
+{
+    if (!Enabled())
+        return false;
+    const double now = Now();
+    if (_window_start < 0.0)
+    {
+        _window_start = now;
+        _cpu_start = ProcessCpu();
+    }
+    if (period > 0.0)
+    {
+        _slack_sum += 1.0 - cycle_ms / (1000.0 * period);
+        _slack_count++;
+    }
+    if (now - _window_start < _config.window)
+        return false;
+
+    const double cpu = ProcessCpu();
+    _share = (cpu - _cpu_start) / (now - _window_start);
+    _slack = _slack_count > 0 ? _slack_sum / _slack_count : 1.0;
+    _window_start = now;
+    _cpu_start = cpu;
+    _slack_sum = 0.0;
+    _slack_count = 0;
+
+    const bool over = _share > _config.share || _slack < _config.min_slack;
+    const bool under = _share < _config.release * _config.share && _slack >= _config.min_slack;
+    _over = over ? _over + 1 : 0;
+    _under = under ? _under + 1 : 0;
+    if (_over >= _config.up_windows && _index + 1 < (int)_ladder.size())
+    {
+        _index++;
+        _over = 0;
+        return true;
+    }
+    if (_under >= _config.down_windows && _index > 0)
+    {
+        _index--;
+        _under = 0;
+        return true;
+    }
+    return false;
+}
+
+double CpuGovernor::ProcessCpu()
+{
+    timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+double CpuGovernor::Now()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,277 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "distance_field.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+namespace
+{
+    const int INF_DIST = INT_MAX;
+    const int NEIGHBORS[8][2] = { {-1, -1}, {0, -1}, {1, -1}, {-1, 0}, {1, 0}, {-1, 1}, {0, 1}, {1, 1} };
+}
+
+DistanceField::DistanceField(double max_distance)
+    : _max_distance(max_distance > 0.0 ? max_distance : 2.0), _size_x(0), _size_y(0),
+      _resolution(0.0), _origin_x(0.0), _origin_y(0.0), _updated(0)
+{
+}
+
+void DistanceField::SetMaxDistance(double max_distance)
+{
+    if (max_distance <= 0.0 || max_distance == _max_distance)
+        return;
+    _max_distance = max_distance;
+    for (size_t i = 0; i < _sq_dist.size(); i++)
+    {
+        _distance[i] = _site[i] == NO_SITE ? _max_distance
+                     : std::min(std::sqrt((double)_sq_dist[i]) * _resolution, _max_distance);
+    }
+}
+
+void DistanceField::Update(const unsigned char *costs, unsigned int size_x, unsigned int size_y,
+                           double resolution, double origin_x, double origin_y,
+                           unsigned char threshold, unsigned char unknown)
+{
+    _updated = 0;
+    if ((int)size_x != _size_x || (int)size_y != _size_y || resolution != _resolution)
+    {
+        _resolution = resolution;
+        rebuild(size_x, size_y);
+    }
+    else if (origin_x != _origin_x || origin_y != _origin_y)
+    {
+        // A rolling window moves by whole cells, anything else starts over
+        const double fx = (origin_x - _origin_x) / _resolution, fy = (origin_y - _origin_y) / _resolution;
+        const int dx = (int)std::floor(fx + 0.5), dy = (int)std::floor(fy + 0.5);
+        if (std::fabs(fx - dx) > 1e-3 || std::fabs(fy - dy) > 1e-3 || !shift(dx, dy))
+            rebuild(size_x, size_y);
+    }
+    _origin_x = origin_x;
+    _origin_y = origin_y;
+
+    // Only the cells that changed since the last call start a wave
+    const int n = _size_x * _size_y;
+    for (int i = 0; i < n; i++)
+    {
+        const unsigned char occupied = costs[i] >= threshold && costs[i] < unknown;
+        if (occupied == _occupied[i])
+            continue;
+        _occupied[i] = occupied;
+        if (occupied)
+            setObstacle(i);
+        else
+            removeObstacle(i);
+    }
+    propagate();
+}
+
+bool DistanceField::Distance(double x, double y, double &distance, double &grad_x, double &grad_y) const
+{
+    if (Empty())
+        return false;
+
+    // Bilinear between the centers of the four cells around (x, y)
+    const double u = (x - _origin_x) / _resolution - 0.5, v = (y - _origin_y) / _resolution - 0.5;
+    const int cx = (int)std::floor(u), cy = (int)std::floor(v);
+    const double fx = u - cx, fy = v - cy;
+    const double d00 = at(cx, cy), d10 = at(cx + 1, cy), d01 = at(cx, cy + 1), d11 = at(cx + 1, cy + 1);
+
+    distance = (d00 * (1 - fx) + d10 * fx) * (1 - fy) + (d01 * (1 - fx) + d11 * fx) * fy;
+    grad_x = ((d10 - d00) * (1 - fy) + (d11 - d01) * fy) / _resolution;
+    grad_y = ((d01 - d00) * (1 - fx) + (d11 - d10) * fx) / _resolution;
+    return true;
+}
+
+void DistanceField::rebuild(unsigned int size_x, unsigned int size_y)
+{
+    _size_x = size_x;
+    _size_y = size_y;
+    const size_t n = (size_t)size_x * size_y;
+    _occupied.assign(n, 0);
+    _site.assign(n, NO_SITE);
+    _sq_dist.assign(n, INF_DIST);
+    _to_raise.assign(n, 0);
+    _distance.assign(n, (float)_max_distance);
+    _open = std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> >();
+    _updated += n;
+}
+
+bool DistanceField::shift(int dx, int dy)
+{
+    if (std::abs(dx) >= _size_x || std::abs(dy) >= _size_y)
+        return false;
+
+    // New cell (x, y) is old cell (x + dx, y + dy)
+    std::vector<unsigned char> occupied(_occupied.size(), 0);
+    std::vector<int> site(_site.size(), NO_SITE), sq_dist(_sq_dist.size(), INF_DIST);
+    std::vector<float> distance(_distance.size(), (float)_max_distance);
+    std::vector<int> lost; // cells whose obstacle left the grid
+    for (int y = 0; y < _size_y; y++)
+    {
+        const int oy = y + dy;
+        if (oy < 0 || oy >= _size_y)
+            continue;
+        for (int x = 0; x < _size_x; x++)
+        {
+            const int ox = x + dx;
+            if (ox < 0 || ox >= _size_x)
+                continue;
+            const int cell = y * _size_x + x, old = oy * _size_x + ox;
+            occupied[cell] = _occupied[old];
+            sq_dist[cell] = _sq_dist[old];
+            distance[cell] = _distance[old];
+            if (_site[old] == NO_SITE)
+                continue;
+            const int sx = _site[old] % _size_x - dx, sy = _site[old] / _size_x - dy;
+            if (sx < 0 || sx >= _size_x || sy < 0 || sy >= _size_y)
+                lost.push_back(cell);
+            else
+                site[cell] = sy * _size_x + sx;
+        }
+    }
+    _occupied.swap(occupied);
+    _site.swap(site);
+    _sq_dist.swap(sq_dist);
+    _distance.swap(distance);
+
+    for (size_t i = 0; i < lost.size(); i++)
+    {
+        const int key = _sq_dist[lost[i]];
+        setSite(lost[i], NO_SITE, INF_DIST);
+        _to_raise[lost[i]] = 1;
+        _open.push(Entry(key, lost[i]));
+    }
+    // The cells that came in are filled from their neighbors
+    for (int y = 0; y < _size_y; y++)
+    {
+        for (int x = 0; x < _size_x; x++)
+        {
+            const int cell = y * _size_x + x;
+            if (_site[cell] == NO_SITE)
+                continue;
+            for (int k = 0; k < 8; k++)
+            {
+                const int nx = x + NEIGHBORS[k][0], ny = y + NEIGHBORS[k][1];
+                if (nx >= 0 && nx < _size_x && ny >= 0 && ny < _size_y
+                    && _site[ny * _size_x + nx] == NO_SITE && !_to_raise[ny * _size_x + nx])
+                {
+                    _open.push(Entry(_sq_dist[cell], cell));
+                    break;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void DistanceField::setObstacle(int cell)
+{
+    setSite(cell, cell, 0);
+    _to_raise[cell] = 0;
+    _open.push(Entry(0, cell));
+}
+
+void DistanceField::removeObstacle(int cell)
+{
+    setSite(cell, NO_SITE, INF_DIST);
+    _to_raise[cell] = 1;
+    _open.push(Entry(0, cell));
+}
+
+void DistanceField::propagate()
+{
+    while (!_open.empty())
+    {
+        const Entry top = _open.top();
+        _open.pop();
+        const int cell = top.second;
+        if (_to_raise[cell])
+            raise(cell);
+        else if (_site[cell] != NO_SITE && top.first == _sq_dist[cell])
+            lower(cell);
+    }
+}
+
+void DistanceField::raise(int cell)
+{
+    // Clear the neighbors that were closest to a removed obstacle, and let
+    // the others spread their obstacle into the cleared cells
+    const int x = cell % _size_x, y = cell / _size_x;
+    for (int k = 0; k < 8; k++)
+    {
+        const int nx = x + NEIGHBORS[k][0], ny = y + NEIGHBORS[k][1];
+        if (nx < 0 || nx >= _size_x || ny < 0 || ny >= _size_y)
+            continue;
+        const int n = ny * _size_x + nx;
+        if (_site[n] == NO_SITE || _to_raise[n])
+            continue;
+        const int key = _sq_dist[n];
+        if (!_occupied[_site[n]])
+        {
+            setSite(n, NO_SITE, INF_DIST);
+            _to_raise[n] = 1;
+        }
+        _open.push(Entry(key, n));
+    }
+    _to_raise[cell] = 0;
+}
+
+void DistanceField::lower(int cell)
+{
+    const int site = _site[cell];
+    if (!_occupied[site])
+        return; // cleared by the raise wave of that obstacle
+    const int x = cell % _size_x, y = cell / _size_x;
+    for (int k = 0; k < 8; k++)
+    {
+        const int nx = x + NEIGHBORS[k][0], ny = y + NEIGHBORS[k][1];
+        if (nx < 0 || nx >= _size_x || ny < 0 || ny >= _size_y)
+            continue;
+        const int n = ny * _size_x + nx;
+        if (_to_raise[n])
+            continue;
+        const int d = sqDist(n, site);
+        if (d < _sq_dist[n])
+        {
+            setSite(n, site, d);
+            _open.push(Entry(d, n));
+        }
+    }
+}
+
+void DistanceField::setSite(int cell, int site, int sq_dist)
+{
+    _site[cell] = site;
+    _sq_dist[cell] = sq_dist;
+    _distance[cell] = site == NO_SITE ? _max_distance
+                    : std::min(std::sqrt((double)sq_dist) * _resolution, _max_distance);
+    _updated++;
+}
+
+int DistanceField::sqDist(int cell, int site) const
+{
+    const int dx = cell % _size_x - site % _size_x, dy = cell / _size_x - site / _size_x;
+    return dx * dx + dy * dy;
+}
+
+double DistanceField::at(int cx, int cy) const
+{
+    cx = std::min(std::max(cx, 0), _size_x - 1);
+    cy = std::min(std::max(cy, 0), _size_y - 1);
+    return _distance[cy * _size_x + cx];
+}
@@ -0,0 +1,296 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "energy_meter.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <vector>
+#if defined(__linux__)
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    enum Kind { NONE, RAPL, PERF, HWMON };
+
+    // Counter of one zone, rail or package, in its own unit
+    struct Zone
+    {
+        Zone() : fd(-1), power(false), last(0), range(0) {}
+
+        int fd;
+        bool power;    // instantaneous uW instead of a cumulative count
+        uint64_t last; // previous reading
+        uint64_t range; // the counter wraps past this, 0 never
+    };
+
+    struct Meter
+    {
+        Meter() : kind(NONE), scale(1e-6), joules(0.0) {}
+
+        std::mutex mutex;
+        Kind kind;
+        std::vector<Zone> zones;
+        double scale; // joules per count, watts per count for a power source
+        double joules;
+        std::chrono::steady_clock::time_point stamp; // of the last read, for power
+    };
+
+    std::atomic<bool> g_enabled(false);
+
+    Meter &meter()
+    {
+        static Meter meter;
+        return meter;
+    }
+
+#if defined(__linux__)
+    bool readFile(const std::string &path, std::string &text)
+    {
+        FILE *file = std::fopen(path.c_str(), "r");
+        if (!file)
+            return false;
+        char buffer[128];
+        const size_t n = std::fread(buffer, 1, sizeof(buffer) - 1, file);
+        std::fclose(file);
+        buffer[n] = '\0';
+        text = buffer;
+        return n > 0;
+    }
+
+    // A sysfs counter from its descriptor, seeked back for the next read
+    bool readCounter(int fd, uint64_t &value)
+    {
+        char buffer[32];
+        const ssize_t n = pread(fd, buffer, sizeof(buffer) - 1, 0);
+        if (n <= 0)
+            return false;
+        buffer[n] = '\0';
+        value = std::strtoull(buffer, NULL, 10);
+        return true;
+    }
+
+    bool openCounter(const std::string &path, bool power, Zone &zone)
+    {
+        zone.fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        zone.power = power;
+        if (zone.fd < 0)
+            return false;
+        if (!readCounter(zone.fd, zone.last))
+        {
+            close(zone.fd);
+            zone.fd = -1;
+            return false;
+        }
+        return true;
+    }
+
+    // Packages are intel-rapl:<n>, their core and dram subzones
+    // intel-rapl:<n>:<m> are part of them
+    bool openRapl(Meter &m)
+    {
+        for (int n = 0; n < 64; n++)
+        {
+            char dir[64];
+            std::snprintf(dir, sizeof(dir), "/sys/class/powercap/intel-rapl:%d/", n);
+            Zone zone;
+            if (!openCounter(std::string(dir) + "energy_uj", false, zone))
+                break;
+            std::string range;
+            if (readFile(std::string(dir) + "max_energy_range_uj", range))
+                zone.range = std::strtoull(range.c_str(), NULL, 10);
+            m.zones.push_back(zone);
+        }
+        m.scale = 1e-6;
+        return !m.zones.empty();
+    }
+
+    // "event=0x02" of the PMU's events/energy-pkg
+    bool perfConfig(const std::string &text, uint64_t &config)
+    {
+        const size_t at = text.find("event=");
+        if (at == std::string::npos)
+            return false;
+        config = std::strtoull(text.c_str() + at + 6, NULL, 0);
+        return true;
+    }
+
+    bool openPerf(Meter &m)
+    {
+        const std::string pmu = "/sys/bus/event_source/devices/power/";
+        std::string type, event, scale;
+        uint64_t config;
+        if (!readFile(pmu + "type", type) || !readFile(pmu + "events/energy-pkg", event) ||
+            !perfConfig(event, config) || !readFile(pmu + "events/energy-pkg.scale", scale))
+            return false;
+        // The event counts a package, opened on the first CPU of each
+        std::set<int> packages;
+        for (int cpu = 0; cpu < 4096; cpu++)
+        {
+            char path[96];
+            std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+            std::string package;
+            if (!readFile(path, package))
+                break;
+            if (!packages.insert(std::atoi(package.c_str())).second)
+                continue;
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = std::atoi(type.c_str());
+            attr.config = config;
+            Zone zone;
+            zone.fd = syscall(__NR_perf_event_open, &attr, -1, cpu, -1, 0);
+            if (zone.fd < 0)
+                continue;
+            if (read(zone.fd, &zone.last, sizeof(zone.last)) != (ssize_t)sizeof(zone.last))
+            {
+                close(zone.fd);
+                continue;
+            }
+            m.zones.push_back(zone);
+        }
+        m.scale = std::atof(scale.c_str());
+        return !m.zones.empty();
+    }
+
+    // The file names tell the unit: energy<n>_input in uJ, power<n>_input in uW
+    bool openHwmonFile(Meter &m, const std::string &path)
+    {
+        const size_t slash = path.rfind('/');
+        const bool power = path.find("power", slash == std::string::npos ? 0 : slash) != std::string::npos;
+        Zone zone;
+        if (!openCounter(path, power, zone))
+            return false;
+        m.zones.push_back(zone);
+        m.scale = 1e-6;
+        m.stamp = std::chrono::steady_clock::now();
+        return true;
+    }
+
+    bool openHwmon(Meter &m)
+    {
+        static const char *const names[] = { "energy1_input", "power1_input" };
+        for (int k = 0; k < 2; k++)
+            for (int n = 0; n < 32; n++)
+            {
+                char path[64];
+                std::snprintf(path, sizeof(path), "/sys/class/hwmon/hwmon%d/%s", n, names[k]);
+                if (openHwmonFile(m, path))
+                    return true;
+            }
+        return false;
+    }
+
+    // Joules since the previous reading of the zones, m.mutex held
+    double advance(Meter &m)
+    {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        const double seconds = std::chrono::duration<double>(now - m.stamp).count();
+        m.stamp = now;
+        double joules = 0.0;
+        for (size_t i = 0; i < m.zones.size(); i++)
+        {
+            Zone &zone = m.zones[i];
+            uint64_t value;
+            const bool ok = m.kind == PERF ? read(zone.fd, &value, sizeof(value)) == (ssize_t)sizeof(value)
+                                           : readCounter(zone.fd, value);
+            if (!ok)
+                continue;
+            if (zone.power)
+            {
+                // The rail's draw now, held since the previous read
+                joules += m.scale * value * seconds;
+                continue;
+            }
+            uint64_t delta = value - zone.last;
+            if (value < zone.last)
+                delta = zone.range > 0 ? zone.range - zone.last + value : 0;
+            zone.last = value;
+            joules += m.scale * delta;
+        }
+        return joules;
+    }
+#endif
+}
+
+namespace energy_meter
+{
+    bool Enable(const std::string &path)
+    {
+#if defined(__linux__)
+        Meter &m = meter();
+        std::lock_guard<std::mutex> lock(m.mutex);
+        if (m.kind != NONE)
+            return true;
+        if (!path.empty())
+        {
+            if (openHwmonFile(m, path))
+                m.kind = HWMON;
+        }
+        else if (openRapl(m))
+            m.kind = RAPL;
+        else if (openPerf(m))
+            m.kind = PERF;
+        else if (openHwmon(m))
+            m.kind = HWMON;
+        if (m.kind == NONE)
+            return false;
+        m.stamp = std::chrono::steady_clock::now();
+        m.joules = 0.0;
+        g_enabled.store(true);
+        return true;
+#else
+        (void)path;
+        return false;
+#endif
+    }
+
+    bool Enabled()
+    {
+        return g_enabled.load(std::memory_order_relaxed);
+    }
+
+    double Read()
+    {
+        if (!Enabled())
+            return 0.0;
+#if defined(__linux__)
+        Meter &m = meter();
+        std::lock_guard<std::mutex> lock(m.mutex);
+        m.joules += advance(m);
+        return m.joules;
+#else
+        return 0.0;
+#endif
+    }
+
+    const char *Name()
+    {
+        static const char *const names[] = { "", "rapl", "perf", "hwmon" };
+        return Enabled() ? names[meter().kind] : "";
+    }
+}
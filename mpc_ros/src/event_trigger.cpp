@@ -0,0 +1,101 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "event_trigger.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    double angleDiff(double a, double b)
+    {
+        return std::atan2(std::sin(a - b), std::cos(a - b));
+    }
+}
+
+EventTrigger::EventTrigger()
+{
+    _enabled = false;
+    _max_position = 0.03;
+    _max_heading = 0.05;
+    _max_age = 0.5;
+    _stale = true;
+    _stamp = 0.0;
+    _skipped = 0;
+}
+
+void EventTrigger::Configure(bool enabled, double max_position, double max_heading, double max_age)
+{
+    _enabled = enabled;
+    _max_position = max_position;
+    _max_heading = max_heading;
+    _max_age = max_age;
+    _stale = true;
+}
+
+void EventTrigger::Store(double stamp, double ox, double oy, double otheta, const std::vector<double> &x,
+                         const std::vector<double> &y, const std::vector<double> &theta, double offset, double dt,
+                         const std::vector<double> &step_dt)
+{
+    const size_t n = std::min(x.size(), std::min(y.size(), theta.size()));
+    const double c = std::cos(otheta), s = std::sin(otheta);
+    _t.clear();
+    _x.clear();
+    _y.clear();
+    _theta.clear();
+    // The robot moves from the origin to the first predicted pose meanwhile
+    if (offset > 0 && n > 0)
+    {
+        _t.push_back(stamp);
+        _x.push_back(ox);
+        _y.push_back(oy);
+        _theta.push_back(otheta);
+    }
+    double t = stamp + offset;
+    for (size_t i = 0; i < n; i++)
+    {
+        _t.push_back(t);
+        _x.push_back(ox + c * x[i] - s * y[i]);
+        _y.push_back(oy + s * x[i] + c * y[i]);
+        _theta.push_back(otheta + theta[i]);
+        t += (i < step_dt.size()) ? step_dt[i] : dt;
+    }
+    _stamp = stamp;
+    _skipped = 0;
+    _stale = _t.size() < 2;
+}
+
+bool EventTrigger::Holds(double t, double x, double y, double theta)
+{
+    if (!_enabled || _stale || t - _stamp > _max_age || t < _t.front() || t >= _t.back())
+        return false;
+
+    // Predicted pose at t, linear between the steps
+    size_t k = 0;
+    while (k + 2 < _t.size() && t >= _t[k + 1])
+        k++;
+    const double span = _t[k + 1] - _t[k];
+    const double a = span > 0 ? (t - _t[k]) / span : 0.0;
+    const double px = _x[k] + a * (_x[k + 1] - _x[k]);
+    const double py = _y[k] + a * (_y[k + 1] - _y[k]);
+    const double ptheta = _theta[k] + a * angleDiff(_theta[k + 1], _theta[k]);
+
+    if (std::hypot(x - px, y - py) > _max_position || std::fabs(angleDiff(theta, ptheta)) > _max_heading)
+        return false;
+    _skipped++;
+    return true;
+}
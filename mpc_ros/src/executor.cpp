@@ -0,0 +1,64 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "executor.h"
+#include "realtime.h"
+
+namespace
+{
+    const char *const NAMES[Executor::NUM_QUEUES] = { "control", "background" };
+}
+
+Executor::Executor() : _report(std::make_shared<Reports>()) {}
+
+void Executor::Configure(const QueueConfig config[NUM_QUEUES])
+{
+    for (int q = 0; q < NUM_QUEUES; q++)
+    {
+        _pools[q].reset();
+        if (config[q].threads <= 0)
+            continue;
+        RealtimeSettings realtime;
+        realtime.Configure(config[q].priority, config[q].cpus, 0);
+        if (!realtime.Enabled())
+        {
+            _pools[q] = std::make_shared<WorkStealingPool>(config[q].threads);
+            continue;
+        }
+        const std::string name = Name(q);
+        const std::shared_ptr<Reports> shared = _report;
+        _pools[q] = std::make_shared<WorkStealingPool>(config[q].threads, [shared, realtime, name](int index)
+        {
+            std::string report;
+            if (!realtime.Apply(report))
+            {
+                std::lock_guard<std::mutex> lock(shared->mutex);
+                shared->text += name + " worker " + std::to_string(index) + ": " + report + "; ";
+            }
+        });
+    }
+}
+
+std::string Executor::Report() const
+{
+    std::lock_guard<std::mutex> lock(_report->mutex);
+    return _report->text;
+}
+
+const char *Executor::Name(int queue)
+{
+    return queue >= 0 && queue < NUM_QUEUES ? NAMES[queue] : "unknown";
+}
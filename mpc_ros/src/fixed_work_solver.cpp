@@ -0,0 +1,76 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "fixed_work_solver.h"
+#include <algorithm>
+#include "alloc_counter.h"
+
+FixedWorkSolver::FixedWorkSolver() : _steps(0), _sqp_iterations(1), _qp_iterations(0) {}
+
+void FixedWorkSolver::Init(const std::map<std::string, double> &params, int n_coeffs)
+{
+    std::map<std::string, double> rti_params = params;
+    rti_params["LTV"] = 0.0;
+    _rti.LoadParams(rti_params);
+    _steps = params.find("STEPS") != params.end() ? (int)params.at("STEPS") : 10;
+    _sqp_iterations = params.find("SQP_ITERATIONS") != params.end() ? std::max(1, (int)params.at("SQP_ITERATIONS")) : 1;
+
+    // A solve from rest and one from its plan size the work vectors of
+    // RtiSolver and the plan
+    _vars.reserve(RtiSolver::NX * _steps + RtiSolver::NU * (_steps - 1));
+    const Eigen::VectorXd state = Eigen::VectorXd::Zero(RtiSolver::NX);
+    const Eigen::VectorXd coeffs = Eigen::VectorXd::Zero(std::max(1, n_coeffs));
+    double angvel, accel;
+    Reset();
+    Solve(state, coeffs, angvel, accel);
+    Solve(state, coeffs, angvel, accel);
+    Reset();
+}
+
+void FixedWorkSolver::shift()
+{
+    const int N = _steps;
+    for (int j = 0; j < RtiSolver::NX; j++)
+    {
+        double *block = &_vars[j * N];
+        std::copy(block + 1, block + N, block);
+    }
+    for (int j = 0; j < RtiSolver::NU; j++)
+    {
+        double *block = &_vars[RtiSolver::NX * N + j * (N - 1)];
+        std::copy(block + 1, block + N - 1, block);
+    }
+}
+
+bool FixedWorkSolver::Solve(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, double &angvel, double &accel)
+{
+    EigenNoMalloc no_malloc;
+    const int N = _steps;
+    const size_t n_vars = RtiSolver::NX * N + RtiSolver::NU * (N - 1);
+    if (_vars.size() == n_vars)
+        shift();
+
+    bool ok = true;
+    _qp_iterations = 0;
+    for (int i = 0; i < _sqp_iterations; i++)
+    {
+        ok = _rti.Step(state, coeffs, _vars) && ok;
+        _qp_iterations += _rti.QpIterations();
+    }
+    angvel = _vars.size() == n_vars ? _vars[RtiSolver::NX * N] : 0.0;
+    accel = _vars.size() == n_vars ? _vars[RtiSolver::NX * N + N - 1] : 0.0;
+    return ok;
+}
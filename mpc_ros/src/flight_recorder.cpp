@@ -0,0 +1,222 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "flight_recorder.h"
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace
+{
+    // CppAD::ipopt::solve_result::status_type, without the CppAD headers
+    const char *const STATUS_NAMES[] = {
+        "not_defined", "success", "maxiter_exceeded", "stop_at_tiny_step",
+        "stop_at_acceptable_point", "local_infeasibility", "user_requested_stop",
+        "feasible_point_found", "diverging_iterates", "restoration_failure",
+        "error_in_step_computation", "invalid_number_detected",
+        "too_few_degrees_of_freedom", "internal_error", "unknown"
+    };
+    const int SUCCESS = 1;
+    const int NUM_STATUS = sizeof(STATUS_NAMES) / sizeof(STATUS_NAMES[0]);
+
+    std::string reasons(int reason)
+    {
+        std::string text;
+        if (reason & FlightRecorder::DEADLINE_MISS)
+            text += " deadline_miss";
+        if (reason & FlightRecorder::STATUS)
+            text += " status";
+        if (reason & FlightRecorder::REQUEST)
+            text += " request";
+        return text.empty() ? text : text.substr(1);
+    }
+}
+
+FlightRecorder::FlightRecorder()
+{
+    _min_interval = 5.0;
+    _last_stamp = -std::numeric_limits<double>::infinity();
+    _seq = 0;
+    _next = 0;
+    _count = 0;
+    _snapshot_size = 0;
+    _reason = 0;
+    _pending = false;
+    _running.store(false);
+    _requested.store(false);
+    _dumps.store(0);
+    _skipped.store(0);
+}
+
+FlightRecorder::~FlightRecorder()
+{
+    Close();
+}
+
+bool FlightRecorder::Open(const std::string &directory, size_t cycles, double min_interval)
+{
+    Close();
+    if (cycles == 0)
+        return false;
+    _directory = directory.empty() ? std::string(".") : directory;
+    _min_interval = min_interval;
+    _last_stamp = -std::numeric_limits<double>::infinity();
+    _frames.assign(cycles, FlightFrame());
+    _snapshot.assign(cycles, FlightFrame());
+    _next = 0;
+    _count = 0;
+    _pending = false;
+    _requested.store(false);
+    _running.store(true);
+    _writer = std::thread(&FlightRecorder::run, this);
+    return true;
+}
+
+void FlightRecorder::Close()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_running.exchange(false))
+            return;
+    }
+    _wake.notify_one();
+    _writer.join();
+}
+
+void FlightRecorder::Record(const FlightFrame &frame)
+{
+    if (!_running.load(std::memory_order_relaxed))
+        return;
+    const size_t size = _frames.size();
+    FlightFrame &slot = _frames[_next];
+    slot = frame;
+    slot.record.seq = _seq++;
+    _next = (_next + 1) % size;
+    if (_count < size)
+        _count++;
+
+    int reason = Anomaly(slot);
+    if (reason && slot.record.stamp - _last_stamp < _min_interval)
+        reason = 0;
+    if (_requested.exchange(false))
+        reason |= REQUEST;
+    if (!reason)
+        return;
+
+    // The writer only holds the lock to pick up or hand back the snapshot
+    std::unique_lock<std::mutex> lock(_mutex, std::try_to_lock);
+    if (!lock.owns_lock() || _pending)
+    {
+        _skipped.fetch_add(1, std::memory_order_relaxed);
+        if (reason & REQUEST)
+            _requested.store(true);
+        return;
+    }
+    for (size_t i = 0; i < _count; i++)
+        _snapshot[i] = _frames[(_next + size - _count + i) % size];
+    _snapshot_size = _count;
+    _reason = reason;
+    _pending = true;
+    if (reason & (DEADLINE_MISS | STATUS))
+        _last_stamp = slot.record.stamp;
+    lock.unlock();
+    _wake.notify_one();
+}
+
+std::string FlightRecorder::LastDump()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _last_dump;
+}
+
+int FlightRecorder::Anomaly(const FlightFrame &frame)
+{
+    int reason = 0;
+    if (frame.deadline_ms > 0 && frame.record.solve_ms > frame.deadline_ms)
+        reason |= DEADLINE_MISS;
+    if (frame.record.status >= 0 && frame.record.status != SUCCESS)
+        reason |= STATUS;
+    return reason;
+}
+
+void FlightRecorder::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _wake.wait(lock, [this] { return _pending || !_running.load(); });
+        // A dump handed over before Close() is still written
+        if (!_pending)
+            break;
+        const int reason = _reason;
+        lock.unlock();
+
+        char stamp[32];
+        const std::time_t now = std::time(NULL);
+        std::strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", std::localtime(&now));
+        std::ostringstream path;
+        path << _directory << "/flight_" << stamp << "_" << _dumps.load();
+        write(path.str(), reason);
+
+        lock.lock();
+        _last_dump = path.str();
+        _pending = false;
+        _dumps.fetch_add(1);
+    }
+}
+
+void FlightRecorder::write(const std::string &path, int reason)
+{
+    std::vector<TrajectoryRecord> records(_snapshot_size);
+    for (size_t i = 0; i < _snapshot_size; i++)
+        records[i] = _snapshot[i].record;
+    TrajectoryLog::Write(path + ".lg", records);
+
+    std::ofstream text((path + ".txt").c_str());
+    text << "# flight recorder dump: " << reasons(reason) << ", " << _snapshot_size << " cycles\n"
+         << "# seq stamp params_version status iterations solve_ms deadline_ms flags cost"
+            " speed angvel | state | coeffs\n"
+         << "#   iter obj inf_pr inf_du mu d_norm alpha_pr ls_trials\n";
+    text << std::setprecision(9);
+    for (size_t i = 0; i < _snapshot_size; i++)
+    {
+        const FlightFrame &frame = _snapshot[i];
+        const TrajectoryRecord &r = frame.record;
+        const int status = r.status;
+        text << r.seq << " " << r.stamp << " " << frame.params_version << " "
+             << (status >= 0 && status < NUM_STATUS ? STATUS_NAMES[status] : "none") << " "
+             << r.iterations << " " << r.solve_ms << " " << frame.deadline_ms << " "
+             << r.flags << " " << r.cost << " " << r.speed << " " << r.angvel << " |";
+        for (int k = 0; k < 6; k++)
+            text << " " << r.state[k];
+        text << " |";
+        for (int k = 0; k < 4; k++)
+            text << " " << r.coeffs[k];
+        text << "\n";
+
+        const IpoptJournal &journal = frame.journal;
+        if (journal.count > journal.Size())
+            text << "  # " << journal.count - journal.Size() << " earlier iterates\n";
+        for (size_t k = 0; k < journal.Size(); k++)
+        {
+            const IpoptIterate &it = journal.At(k);
+            text << "  " << it.iter << " " << it.obj << " " << it.inf_pr << " " << it.inf_du << " "
+                 << it.mu << " " << it.d_norm << " " << it.alpha_pr << " " << it.ls_trials << "\n";
+        }
+    }
+}
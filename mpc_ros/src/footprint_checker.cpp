@@ -0,0 +1,141 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "footprint_checker.h"
+#include <algorithm>
+#include <cmath>
+
+FootprintChecker::FootprintChecker(int headings)
+    : _headings(std::max(headings, 1)), _resolution(0.0)
+{
+}
+
+void FootprintChecker::SetFootprint(const std::vector<std::pair<double, double> > &polygon, double resolution)
+{
+    if (resolution <= 0.0 || (resolution == _resolution && polygon == _polygon && !_masks.empty()))
+        return;
+    _polygon = polygon;
+    _resolution = resolution;
+    build();
+}
+
+void FootprintChecker::build()
+{
+    // In cells. A polygon point q falls into the cell offset floor(q + u)
+    // for some u in [0, 1)^2, the position of the center in its cell, and
+    // the heading of a pose is up to half a bin off the one of its mask.
+    double radius = 0.0;
+    for (size_t i = 0; i < _polygon.size(); i++)
+        radius = std::max(radius, std::hypot(_polygon[i].first, _polygon[i].second) / _resolution);
+    const double pad = radius * M_PI / _headings;
+
+    _masks.assign(_headings, std::vector<Span>());
+    std::vector<double> px(_polygon.size()), py(_polygon.size());
+    for (int k = 0; k < _headings; k++)
+    {
+        const double yaw = 2.0 * M_PI * k / _headings, c = std::cos(yaw), s = std::sin(yaw);
+        double min_y = 0.0, max_y = 0.0;
+        for (size_t i = 0; i < _polygon.size(); i++)
+        {
+            px[i] = (c * _polygon[i].first - s * _polygon[i].second) / _resolution;
+            py[i] = (s * _polygon[i].first + c * _polygon[i].second) / _resolution;
+            min_y = std::min(min_y, py[i]);
+            max_y = std::max(max_y, py[i]);
+        }
+
+        std::vector<Span> &mask = _masks[k];
+        if (px.size() < 3)
+        {
+            // No area, the cell of the center only
+            const Span center = { 0, 0, 0 };
+            mask.push_back(center);
+            continue;
+        }
+        for (int dy = (int)std::floor(min_y - pad); dy <= (int)std::floor(max_y + pad) + 1; dy++)
+        {
+            // x extent of the polygon within the band of rows that can
+            // reach row dy: vertices in the band and edge crossings of its
+            // borders
+            const double lo = dy - 1 - pad, hi = dy + 1 + pad;
+            double x_min = HUGE_VAL, x_max = -HUGE_VAL;
+            for (size_t i = 0; i < px.size(); i++)
+            {
+                const size_t j = (i + 1) % px.size();
+                if (py[i] >= lo && py[i] <= hi)
+                {
+                    x_min = std::min(x_min, px[i]);
+                    x_max = std::max(x_max, px[i]);
+                }
+                const double border[2] = { lo, hi };
+                for (int b = 0; b < 2; b++)
+                {
+                    if ((py[i] - border[b]) * (py[j] - border[b]) < 0.0)
+                    {
+                        const double x = px[i] + (px[j] - px[i]) * (border[b] - py[i]) / (py[j] - py[i]);
+                        x_min = std::min(x_min, x);
+                        x_max = std::max(x_max, x);
+                    }
+                }
+            }
+            if (x_min > x_max)
+                continue;
+            const Span span = { dy, (int)std::floor(x_min - pad), (int)std::floor(x_max + pad) + 1 };
+            mask.push_back(span);
+        }
+    }
+}
+
+int FootprintChecker::TrajectoryCost(const unsigned char *costs, unsigned int size_x, unsigned int size_y,
+                                     double origin_x, double origin_y,
+                                     const double *x, const double *y, const double *theta, size_t n, size_t begin,
+                                     unsigned char lethal, unsigned char unknown, int &first_lethal) const
+{
+    first_lethal = -1;
+    if (_masks.empty())
+        return 0;
+
+    int worst = 0;
+    for (size_t p = begin; p < n; p++)
+    {
+        const int cx = (int)std::floor((x[p] - origin_x) / _resolution);
+        const int cy = (int)std::floor((y[p] - origin_y) / _resolution);
+        int k = (int)std::floor(theta[p] / (2.0 * M_PI) * _headings + 0.5) % _headings;
+        if (k < 0)
+            k += _headings;
+
+        // Highest cost of each contiguous run, unknown read as free. The
+        // loop has no early exit so that it vectorizes.
+        unsigned char pose_max = 0;
+        const std::vector<Span> &mask = _masks[k];
+        for (size_t s = 0; s < mask.size(); s++)
+        {
+            const int row = cy + mask[s].dy;
+            const int x0 = std::max(cx + mask[s].dx0, 0), x1 = std::min(cx + mask[s].dx1, (int)size_x - 1);
+            if (row < 0 || row >= (int)size_y || x0 > x1)
+                continue;
+            const unsigned char *run = costs + (size_t)row * size_x;
+            for (int i = x0; i <= x1; i++)
+            {
+                const unsigned char cost = run[i] == unknown ? 0 : run[i];
+                pose_max = cost > pose_max ? cost : pose_max;
+            }
+        }
+        worst = std::max(worst, (int)pose_max);
+        if (pose_max >= lethal && first_lethal < 0)
+            first_lethal = p;
+    }
+    return worst;
+}
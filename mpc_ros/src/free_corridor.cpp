@@ -0,0 +1,208 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "free_corridor.h"
+
+#include <algorithm>
+#include <cmath>
+
+FreeCorridor::FreeCorridor() : _faces(6), _range(1.5), _margin(0.05), _reused(0) {}
+
+void FreeCorridor::Configure(int faces, double range, double margin)
+{
+    _faces = std::max(3, std::min((int)MAX_FACES, faces));
+    _range = std::max(0.0, range);
+    _margin = std::max(0.0, margin);
+    _seeds.clear();
+    _polygons.clear();
+}
+
+void FreeCorridor::Update(const double *x, const double *y, size_t n, const unsigned char *costs, unsigned int size_x,
+                          unsigned int size_y, double resolution, double origin_x, double origin_y,
+                          unsigned char threshold, unsigned char unknown)
+{
+    _prev_seeds.swap(_seeds);
+    _prev_polygons.swap(_polygons);
+    _seeds.assign(2 * n, 0.0);
+    _polygons.assign(3 * _faces * n, 0.0);
+    _reused = 0;
+    if (n == 0)
+    {
+        return;
+    }
+
+    // Obstacle cells of the box around every seed, read once
+    double min_x = x[0], max_x = x[0], min_y = y[0], max_y = y[0];
+    for (size_t i = 1; i < n; i++)
+    {
+        min_x = std::min(min_x, x[i]);
+        max_x = std::max(max_x, x[i]);
+        min_y = std::min(min_y, y[i]);
+        max_y = std::max(max_y, y[i]);
+    }
+    _points.clear();
+    if (costs && resolution > 0)
+    {
+        const int cx0 = std::max(0, (int)std::floor((min_x - _range - origin_x) / resolution));
+        const int cy0 = std::max(0, (int)std::floor((min_y - _range - origin_y) / resolution));
+        const int cx1 = std::min((int)size_x - 1, (int)std::floor((max_x + _range - origin_x) / resolution));
+        const int cy1 = std::min((int)size_y - 1, (int)std::floor((max_y + _range - origin_y) / resolution));
+        for (int cy = cy0; cy <= cy1; cy++)
+        {
+            const unsigned char *row = costs + (size_t)cy * size_x;
+            for (int cx = cx0; cx <= cx1; cx++)
+            {
+                if (row[cx] >= threshold && row[cx] < unknown)
+                {
+                    _points.push_back(origin_x + (cx + 0.5) * resolution);
+                    _points.push_back(origin_y + (cy + 0.5) * resolution);
+                }
+            }
+        }
+    }
+
+    const size_t prev = _prev_seeds.size() / 2;
+    for (size_t i = 0; i < n; i++)
+    {
+        _seeds[2 * i] = x[i];
+        _seeds[2 * i + 1] = y[i];
+
+        // Points of this seed
+        _local.clear();
+        for (size_t k = 0; k < _points.size(); k += 2)
+        {
+            if (std::fabs(_points[k] - x[i]) <= _range && std::fabs(_points[k + 1] - y[i]) <= _range)
+            {
+                _local.push_back(_points[k]);
+                _local.push_back(_points[k + 1]);
+            }
+        }
+
+        // The window moved by about one step: the polygon of the next step
+        // of the last cycle first, then those around it. A kept polygon
+        // keeps its seed, it drifts at most half the range from it.
+        static const size_t order[] = { 1, 0, 2 };
+        bool kept = false;
+        for (size_t d = 0; d < 3 && !kept; d++)
+        {
+            const size_t j = i + order[d];
+            if (j >= prev || std::hypot(_prev_seeds[2 * j] - x[i], _prev_seeds[2 * j + 1] - y[i]) > 0.5 * _range)
+            {
+                continue;
+            }
+            const double *from = &_prev_polygons[3 * _faces * j];
+            std::copy(from, from + 3 * _faces, _polygons.begin() + 3 * _faces * i);
+            kept = inside(i, x[i], y[i], _margin) && free(i);
+            if (kept)
+            {
+                _seeds[2 * i] = _prev_seeds[2 * j];
+                _seeds[2 * i + 1] = _prev_seeds[2 * j + 1];
+                _reused++;
+            }
+        }
+        if (!kept)
+        {
+            grow(i, x[i], y[i]);
+        }
+    }
+}
+
+bool FreeCorridor::inside(size_t polygon, double x, double y, double slack) const
+{
+    const double *f = &_polygons[3 * _faces * polygon];
+    for (int k = 0; k < _faces; k++, f += 3)
+    {
+        if (f[0] * x + f[1] * y > f[2] - slack)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FreeCorridor::free(size_t polygon) const
+{
+    for (size_t k = 0; k < _local.size(); k += 2)
+    {
+        if (inside(polygon, _local[k], _local[k + 1], 0.0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FreeCorridor::grow(size_t polygon, double sx, double sy)
+{
+    double *f = &_polygons[3 * _faces * polygon];
+    for (int k = 0; k < _faces; k++)
+    {
+        f[3 * k] = 0.0;
+        f[3 * k + 1] = 0.0;
+        f[3 * k + 2] = 1.0;
+    }
+    _open = _local;
+    for (int k = 0; k < _faces && !_open.empty(); k++)
+    {
+        // Nearest point still inside
+        size_t nearest = 0;
+        double best = HUGE_VAL;
+        for (size_t j = 0; j < _open.size(); j += 2)
+        {
+            const double d = (_open[j] - sx) * (_open[j] - sx) + (_open[j + 1] - sy) * (_open[j + 1] - sy);
+            if (d < best)
+            {
+                best = d;
+                nearest = j;
+            }
+        }
+        // A seed on an obstacle point keeps its direction of travel open
+        const double dist = std::sqrt(best);
+        const double nx = dist > 1e-9 ? (_open[nearest] - sx) / dist : 1.0;
+        const double ny = dist > 1e-9 ? (_open[nearest + 1] - sy) / dist : 0.0;
+        // Backed off by the margin, never past the seed
+        const double b = nx * sx + ny * sy + std::max(0.0, dist - _margin);
+        f[3 * k] = nx;
+        f[3 * k + 1] = ny;
+        f[3 * k + 2] = b;
+
+        // Points behind the face are outside for good, the nearest one
+        // always goes
+        size_t kept = 0;
+        for (size_t j = 0; j < _open.size(); j += 2)
+        {
+            if (j != nearest && nx * _open[j] + ny * _open[j + 1] <= b)
+            {
+                _open[kept++] = _open[j];
+                _open[kept++] = _open[j + 1];
+            }
+        }
+        _open.resize(kept);
+    }
+}
+
+void FreeCorridor::Faces(size_t i, double ox, double oy, double yaw, double *model) const
+{
+    // n . (o + R p) <= b  <=>  (R^T n) . p <= b - n . o
+    const double c = std::cos(yaw), s = std::sin(yaw);
+    const double *f = &_polygons[3 * _faces * i];
+    for (int k = 0; k < _faces; k++, f += 3, model += 3)
+    {
+        model[0] = c * f[0] + s * f[1];
+        model[1] = -s * f[0] + c * f[1];
+        model[2] = f[2] - f[0] * ox - f[1] * oy;
+    }
+}
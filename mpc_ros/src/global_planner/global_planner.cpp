@@ -7,6 +7,13 @@
 
  using namespace std;
 
+ static bool samePose(const geometry_msgs::PoseStamped &a, const geometry_msgs::PoseStamped &b)
+ {
+   return a.header.frame_id == b.header.frame_id &&
+          a.pose.position.x == b.pose.position.x && a.pose.position.y == b.pose.position.y &&
+          a.pose.orientation.z == b.pose.orientation.z && a.pose.orientation.w == b.pose.orientation.w;
+ }
+
  //Default Constructor
  namespace global_planner 
  {
@@ -18,12 +25,15 @@
       _sub_odom   = _nh.subscribe("/odom", 1, &GeonPlanner::odomCB, this);
       _sub_get_path   = _nh.subscribe( "desired_path", 1, &GeonPlanner::desiredPathCB, this);   
       _sub_goal   = _nh.subscribe( "/move_base_simple/goal", 1, &GeonPlanner::goalCB, this); 
-      _sub_cmd   = _nh.subscribe("/cmd_vel", 5, &GeonPlanner::getCmdCB, this);
     
       _pub_globalpath  = _nh.advertise<nav_msgs::Path>("/move_base/GlobalPlanner/plan", 1); // reference path for MPC ///mpc_reference 
               
       // Nearst point
       min_idx = 0;
+      _route_hint = 0;
+      _costmap_ros = NULL;
+      _planner = "replay";
+      _cache_start = -1;
 
       // A part of reference trajtory
       // epitrochoid,square:
@@ -39,18 +49,15 @@
 
       // Starting time
       _goal_received = false;
-
-      //Save the csv file
-      idx = 0;
-      file.open("/home/nscl1016/catkin_ws/src/mpc_ros/pure_pursuit.csv");
-
-      //Timer
-      _errtimer = _nh.createTimer(ros::Duration((1.0)/_controller_freq), &GeonPlanner::CalError, this); // 10Hz //*****mpc
-
+      _linear_vel = 0.0;
+      _angular_vel = 0.0;
     }
     GeonPlanner::~GeonPlanner()
     {
-      file.close();
+      if(_analytics_spinner)
+        _analytics_spinner->stop();
+      _metrics.Stop();
+      _log.Close();
     };
 
     GeonPlanner::GeonPlanner(std::string name, costmap_2d::Costmap2DROS* costmap_ros)
@@ -61,7 +68,84 @@
 
     void GeonPlanner::initialize(std::string name, costmap_2d::Costmap2DROS* costmap_ros)
     {
+      // Trajectory log, see trajectory_log.h. An empty path disables it.
+      ros::NodeHandle pn("~/" + name);
+      std::string log_path;
+      double log_max_mb;
+      int log_max_files;
+      pn.param<std::string>("log_path", log_path, "");
+      pn.param("log_max_mb", log_max_mb, 64.0);
+      pn.param("log_max_files", log_max_files, 4);
+      if(!log_path.empty() && !_log.Open(log_path, log_max_mb * 1e6, log_max_files))
+        ROS_WARN("Cannot open the trajectory log %s", log_path.c_str());
+
+      // Tracking error of every odometry message against the last plan, on
+      // the analytics thread. The errors go to the controller metrics (see
+      // metrics_exporter.h) and the trajectory log, a summary to the log
+      // every analytics_period.
+      int analytics_window, metrics_port;
+      double analytics_period, metrics_period;
+      pn.param("analytics_window", analytics_window, 200);
+      pn.param("analytics_period", analytics_period, 5.0);
+      pn.param("metrics_period", metrics_period, 1.0);
+      pn.param("metrics_port", metrics_port, 0);
+      _analytics = TrackingAnalytics(analytics_window);
+      ros::NodeHandle analytics_nh;
+      analytics_nh.setCallbackQueue(&_analytics_queue);
+      _sub_analytics_odom = analytics_nh.subscribe("/odom", 10, &GeonPlanner::analyticsOdomCB, this);
+      _sub_cmd = analytics_nh.subscribe("/cmd_vel", 5, &GeonPlanner::getCmdCB, this);
+      if(analytics_period > 0.0)
+        _analytics_timer = analytics_nh.createTimer(ros::Duration(analytics_period), &GeonPlanner::analyticsReport, this);
+      _metrics.Start(analytics_nh, pn.getNamespace(), metrics_period, metrics_port);
+      _analytics_spinner.reset(new ros::AsyncSpinner(1, &_analytics_queue));
+      _analytics_spinner->start();
+
+      // Last good transform is reused this long when TF drops out [s]
+      double tf_max_age;
+      pn.param("tf_max_age", tf_max_age, 0.5);
+      _tf_cache.SetMaxAge(tf_max_age);
+      _tf_cache.AdvertiseDiagnostics(_nh, pn.getNamespace());
+
+      // Route file of mpc_route, see route_store.h. Mapped once, makePlan
+      // then slices it instead of transforming the whole desired_path.
+      std::string route_file;
+      pn.param<std::string>("route_file", route_file, "");
+      pn.param<std::string>("route_frame", _route_frame, "map");
+      if(!route_file.empty())
+      {
+        if(_route.Open(route_file))
+          ROS_INFO("Route %s: %zu poses, %.1f m", route_file.c_str(), _route.Size(), _route.Length());
+        else
+          ROS_WARN("Cannot open the route file %s, using desired_path", route_file.c_str());
+      }
 
+      // Planning engine: replay (desired_path or the route), grid (D* Lite
+      // on the global costmap, repaired where the costmap changed) or hybrid
+      // (hybrid A* guided by the grid search)
+      _costmap_ros = costmap_ros;
+      double cost_factor, min_turning_radius, heuristic_weight;
+      bool allow_unknown;
+      int heading_bins, max_expansions;
+      pn.param<std::string>("planner", _planner, "replay");
+      pn.param("cost_factor", cost_factor, 3.0);
+      pn.param("allow_unknown", allow_unknown, false);
+      pn.param("min_turning_radius", min_turning_radius, 0.5);
+      pn.param("heading_bins", heading_bins, 72);
+      pn.param("max_expansions", max_expansions, 100000);
+      pn.param("heuristic_weight", heuristic_weight, 2.0);
+      _grid.SetCostFactor(cost_factor);
+      _grid.SetAllowUnknown(allow_unknown);
+      _hybrid.Configure(min_turning_radius, heading_bins, max_expansions, heuristic_weight);
+      if(_planner != "replay" && _planner != "grid" && _planner != "hybrid")
+      {
+        ROS_ERROR("Unknown planner %s, replaying desired_path", _planner.c_str());
+        _planner = "replay";
+      }
+      if(_planner != "replay" && !_costmap_ros)
+      {
+        ROS_ERROR("Planner %s needs the global costmap, replaying desired_path", _planner.c_str());
+        _planner = "replay";
+      }
     }
 
     bool GeonPlanner::makePlan(const geometry_msgs::PoseStamped& start, const geometry_msgs::PoseStamped& goal,  std::vector<geometry_msgs::PoseStamped>& plan )
@@ -70,105 +154,94 @@
       // Start point
       //plan.push_back(start);
       cout << " start: " <<  start.pose.position.x << endl; 
+      if(_planner != "replay")
+        return costmapPlan(start, goal, plan);
       
-      nav_msgs::Path global_path = nav_msgs::Path();   // For generating mpc reference path  
-      geometry_msgs::PoseStamped tempPose;
+      CompactPath global_path;   // For generating mpc reference path  
       nav_msgs::Odometry odom = _odom; 
+      if(_route.Valid())
+        return routePlan(odom, goal, plan);
 
-      // middle points
-      try
+      CompactPath::ConstPtr desired_path = _desired_path.Get();
+      if(!desired_path || desired_path->Size() < 2)
       {
-        double total_length = 0.0;
-        //find waypoints distance
-              
-        double gap_x = _desired_path.poses[1].pose.position.x - _desired_path.poses[0].pose.position.x;
-        double gap_y = _desired_path.poses[1].pose.position.y - _desired_path.poses[0].pose.position.y;
-        _waypointsDist = sqrt(gap_x*gap_x + gap_y*gap_y); 
+        ROS_WARN("No desired path received yet.");
+        return false;
+      }
 
-        // Find the nearst point for robot position
-        
-        int min_val = 100; // why double is wrong?        
-        int N = _desired_path.poses.size(); // Number of waypoints        
-        const double px = odom.pose.pose.position.x; //pose: odom frame
-        const double py = odom.pose.pose.position.y;
-        const double ptheta = odom.pose.pose.position.y;
-        
-        double dx, dy; // difference distance
-        double pre_yaw = 0;
-        double roll, pitch, yaw = 0;
+      // desired path -> map once for the whole path, without waiting on TF
+      tf::Transform path_to_map;
+      const std::string &path_frame = desired_path->Frame().empty() ? std::string("map") : desired_path->Frame();
+      if(!_tf_cache.Lookup(_tf_listener, "map", path_frame, path_to_map))
+        return false; // move_base asks again on its next planning cycle
 
-        for(int i = min_idx; i < N; i++) 
+      // middle points
+      double total_length = 0.0;
+      //find waypoints distance
+            
+      double gap_x = desired_path->X(1) - desired_path->X(0);
+      double gap_y = desired_path->Y(1) - desired_path->Y(0);
+      _waypointsDist = sqrt(gap_x*gap_x + gap_y*gap_y); 
+
+      // Find the nearst point for robot position, see path_index.h
+      int N = desired_path->Size(); // Number of waypoints        
+      _path_index.Set(desired_path);
+      min_idx = _path_index.Nearest(odom.pose.pose.position.x, odom.pose.pose.position.y);
+      if(cachedPlan(desired_path, path_to_map, goal, min_idx, plan))
+        return true;
+
+      // Whole path at once, once per path and transform
+      if(desired_path != _cache_path || !(path_to_map == _cache_transform))
+      {
+        _path_transform.Transform(path_to_map, *desired_path);
+        _cache_poses.resize(N);
+        _cache_map_path.Clear();
+        _cache_map_path.Reserve(N);
+        for(int i = 0; i < N; i++)
         {
-            dx = _desired_path.poses[i].pose.position.x - px;
-            dy = _desired_path.poses[i].pose.position.y - py;
-                    
-            tf::Quaternion q(
-                _desired_path.poses[i].pose.orientation.x,
-                _desired_path.poses[i].pose.orientation.y,
-                _desired_path.poses[i].pose.orientation.z,
-                _desired_path.poses[i].pose.orientation.w);
-            tf::Matrix3x3 m(q);
-            m.getRPY(roll, pitch, yaw);
-
-            if(abs(pre_yaw - yaw) > 5)
-                pre_yaw = yaw;
-       
-            if(min_val > sqrt(dx*dx + dy*dy) && abs(i - min_idx) < 50) 
-            {
-                min_val = sqrt(dx*dx + dy*dy);
-                min_idx = i;
-            }
+          _path_transform.Pose(i, "map", _cache_poses[i]);
+          _cache_map_path.PushBack(_path_transform.X(i), _path_transform.Y(i), _path_transform.Yaw(i));
         }
-        for(int i = min_idx; i < N ; i++)
-        {
-            if(total_length > _pathLength)
+      }
+      const size_t first = plan.size();
+
+      for(int i = min_idx; i < N ; i++)
+      {
+          if(total_length > _pathLength)
+            break;
+
+          global_path.PushBack(_cache_map_path.X(i), _cache_map_path.Y(i), _cache_map_path.Yaw(i));
+          total_length = total_length + _waypointsDist; 
+          
+          plan.push_back(_cache_poses[i]);          
+      }        
+      //cout << " total_length: " <<  total_length << endl;    
+      
+      // Connect the end of path to the front
+      if(total_length < _pathLength )
+      {
+          for(int i = 0; i < N ; i++)
+          {
+            if(total_length > _pathLength)                
               break;
+            global_path.PushBack(_cache_map_path.X(i), _cache_map_path.Y(i), _cache_map_path.Yaw(i));
+            total_length = total_length + _waypointsDist;  
 
-            _tf_listener.transformPose("map", ros::Time(0) , 
-                                            _desired_path.poses[i], "map", tempPose);                     
-            global_path.poses.push_back(tempPose);                          
-            total_length = total_length + _waypointsDist; 
-            
-            //cout << " tempPose: " <<  tempPose.pose.position.x << ", " <<  tempPose.pose.position.y << endl; 
-            plan.push_back(tempPose);          
-        }        
-        //cout << " total_length: " <<  total_length << endl;    
-        
-        // Connect the end of path to the front
-        if(total_length < _pathLength )
-        {
-            for(int i = 0; i < N ; i++)
-            {
-              if(total_length > _pathLength)                
-                break;
-              _tf_listener.transformPose("map", ros::Time(0) , 
-                                                _desired_path.poses[i], "map", tempPose);                     
-              global_path.poses.push_back(tempPose);                          
-              total_length = total_length + _waypointsDist;  
-
-              //cout << " tempPose: " <<  tempPose.pose.position.x << ", " <<  tempPose.pose.position.y << endl; 
-              plan.push_back(tempPose);     
-            }
-        }  
-
-        cout << "global_path.poses.size(): " << global_path.poses.size() << endl;
-        if(global_path.poses.size() >= _pathLength )
-        {
-            _odom_path = global_path; // Path waypoints in odom frame
-            // publish global path
-            global_path.header.frame_id = "odom";
-            global_path.header.stamp = ros::Time::now();
-            //_pub_globalpath.publish(global_path);        
-        }
-        else
-          cout << "Failed to path generation" << endl;
+            plan.push_back(_cache_poses[i]);     
+          }
+      }  
 
-      }
-      catch(tf::TransformException &ex)
+      cout << "global_path.Size(): " << global_path.Size() << endl;
+      if(global_path.Size() >= _pathLength )
       {
-        ROS_ERROR("%s",ex.what());
-        ros::Duration(1.0).sleep();
-      }     
+          global_path.SetFrame("odom");
+          global_path.SetStamp(ros::Time::now());
+          trackPath(global_path); // Path waypoints in odom frame
+      }
+      else
+        cout << "Failed to path generation" << endl;
+      storePlan(desired_path, path_to_map, goal, min_idx, plan, first);
+
 
       // Goal point
       //plan.push_back(goal);
@@ -176,91 +249,189 @@
 
       return true;
     }
-    void GeonPlanner::CalError(const ros::TimerEvent&)
-    {    
-      if(_goal_received) //received goal & goal not reached    
-      {   
-          nav_msgs::Odometry odom = _odom; 
-          nav_msgs::Path odom_path = _odom_path;   
-
-          // Update system states: X=[x, y, theta, v]
-          const double px = odom.pose.pose.position.x; //pose: odom frame
-          const double py = odom.pose.pose.position.y;
-          tf::Pose pose;
-          tf::poseMsgToTF(odom.pose.pose, pose);
-          const double theta = tf::getYaw(pose.getRotation());
-
-          // Waypoints related parameters
-          const int N = odom_path.poses.size(); // Number of waypoints
-          const double costheta = cos(theta);
-          const double sintheta = sin(theta);
-
-          // Convert to the vehicle coordinate system
-          Eigen::VectorXd x_veh(N);
-          Eigen::VectorXd y_veh(N);
-          for(int i = 0; i < N; i++) 
-          {
-              const double dx = odom_path.poses[i].pose.position.x - px;
-              const double dy = odom_path.poses[i].pose.position.y - py;
-              x_veh[i] = dx * costheta + dy * sintheta;
-              y_veh[i] = dy * costheta - dx * sintheta;
-          }
-          
-          // Fit waypoints
-          auto coeffs = polyfit(x_veh, y_veh, 3); 
-
-          const double cte  = polyeval(coeffs, 0.0);
-          const double etheta = atan(coeffs[1]);
-            
-          cout << "cte: " << cte << endl;
-          cout << "etheta: " << etheta << endl;
-          cout << "linear_vel: " << _linear_vel << endl;
-          cout << "_angular_vel: " << _angular_vel << endl;
-              //writefile
-          idx++;
-          file << idx<< "," << cte << "," <<  etheta << "," << _linear_vel << "," << _angular_vel << ",";
+    bool GeonPlanner::routePlan(const nav_msgs::Odometry &odom, const geometry_msgs::PoseStamped& goal,
+                                std::vector<geometry_msgs::PoseStamped>& plan)
+    {
+      tf::Transform route_to_map;
+      if(!_tf_cache.Lookup(_tf_listener, "map", _route_frame, route_to_map))
+        return false; // move_base asks again on its next planning cycle
+
+      // Nearest pose from the last one on, then only the slice is transformed
+      const size_t start = _route.Nearest(odom.pose.pose.position.x, odom.pose.pose.position.y, _route_hint);
+      min_idx = start;
+      if(cachedPlan(CompactPath::ConstPtr(), route_to_map, goal, start, plan))
+        return true;
+      const size_t count = _route.Slice(start, _pathLength);
+      const size_t first = plan.size();
+
+      const double yaw_to_map = tf::getYaw(route_to_map.getRotation());
+      CompactPath global_path;
+      global_path.Reserve(count);
+      plan.reserve(plan.size() + count);
+      geometry_msgs::PoseStamped tempPose;
+      tempPose.header.frame_id = "map";
+      tempPose.header.stamp = ros::Time::now();
+      for(size_t k = 0; k < count; k++)
+      {
+        const size_t i = (start + k) % _route.Size();
+        const tf::Vector3 p = route_to_map * tf::Vector3(_route.X(i), _route.Y(i), 0.0);
+        tempPose.pose.position.x = p.x();
+        tempPose.pose.position.y = p.y();
+        tempPose.pose.position.z = 0.0;
+        tempPose.pose.orientation = tf::createQuaternionMsgFromYaw(_route.Yaw(i) + yaw_to_map);
+        global_path.PushBack(p.x(), p.y(), _route.Yaw(i) + yaw_to_map);
+        plan.push_back(tempPose);
       }
+      trackPath(global_path);
+      if(count > 0)
+        storePlan(CompactPath::ConstPtr(), route_to_map, goal, start, plan, first);
+      return count > 0;
     }
-    // CallBack: Update odometry
-    void GeonPlanner::odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg)
+    // The cached plan when path, transform, goal and progress are unchanged
+    bool GeonPlanner::cachedPlan(const CompactPath::ConstPtr &path, const tf::Transform &transform,
+                                 const geometry_msgs::PoseStamped& goal, int start, std::vector<geometry_msgs::PoseStamped>& plan) const
     {
-      _odom = *odomMsg;        
+      if(_cache_start < 0 || start != _cache_start || path != _cache_path ||
+         !(transform == _cache_transform) || !samePose(goal, _cache_goal))
+        return false;
+      plan.insert(plan.end(), _cache_plan.begin(), _cache_plan.end());
+      return true;
     }
-    void GeonPlanner::desiredPathCB(const nav_msgs::Path::ConstPtr& totalPathMsg)
+    void GeonPlanner::storePlan(const CompactPath::ConstPtr &path, const tf::Transform &transform,
+                                const geometry_msgs::PoseStamped& goal, int start, const std::vector<geometry_msgs::PoseStamped>& plan, size_t first)
     {
-      _desired_path = *totalPathMsg;
+      _cache_path = path;
+      _cache_transform = transform;
+      _cache_goal = goal;
+      _cache_start = start;
+      _cache_plan.assign(plan.begin() + first, plan.end());
     }
-    // Evaluate a polynomial.
-    double GeonPlanner::polyeval(Eigen::VectorXd coeffs, double x) 
+    bool GeonPlanner::costmapPlan(const geometry_msgs::PoseStamped& start, const geometry_msgs::PoseStamped& goal,
+                                  std::vector<geometry_msgs::PoseStamped>& plan)
     {
-        double result = 0.0;
-        for (int i = 0; i < coeffs.size(); i++) 
+      costmap_2d::Costmap2D *costmap = _costmap_ros->getCostmap();
+      unsigned int sx, sy, gx, gy, size_x, size_y;
+      double resolution, origin_x, origin_y;
+      {
+        // Copied under the lock, the search runs without it
+        boost::unique_lock<costmap_2d::Costmap2D::mutex_t> lock(*(costmap->getMutex()));
+        if(!costmap->worldToMap(start.pose.position.x, start.pose.position.y, sx, sy) ||
+           !costmap->worldToMap(goal.pose.position.x, goal.pose.position.y, gx, gy))
         {
-            result += coeffs[i] * pow(x, i);
+          ROS_WARN("Start or goal outside the global costmap");
+          return false;
         }
-        return result;
-    }    
-    // Fit a polynomial.
-    // Adapted from
-    // https://github.com/JuliaMath/Polynomials.jl/blob/master/src/Polynomials.jl#L676-L716
-    Eigen::VectorXd GeonPlanner::polyfit(Eigen::VectorXd xvals, Eigen::VectorXd yvals, int order) 
-    {
-        assert(xvals.size() == yvals.size());
-        assert(order >= 1 && order <= xvals.size() - 1);
-        Eigen::MatrixXd A(xvals.size(), order + 1);
-
-        for (int i = 0; i < xvals.size(); i++)
-            A(i, 0) = 1.0;
+        size_x = costmap->getSizeInCellsX();
+        size_y = costmap->getSizeInCellsY();
+        resolution = costmap->getResolution();
+        origin_x = costmap->getOriginX();
+        origin_y = costmap->getOriginY();
+        const unsigned char *costs = costmap->getCharMap();
+        _grid_costs.assign(costs, costs + (size_t)size_x * size_y);
+      }
+      // The robot stands in its own cell even when it is inscribed
+      _grid_costs[(size_t)sy * size_x + sx] = costmap_2d::FREE_SPACE;
+      _grid.Update(&_grid_costs[0], size_x, size_y, resolution, origin_x, origin_y);
+      if(!_grid.Plan(sx, sy, gx, gy, _grid_cells))
+      {
+        ROS_WARN("No path to the goal on the global costmap");
+        return false;
+      }
+      ROS_DEBUG("Grid plan: %zu cells, %zu changed, %zu expanded", _grid_cells.size(), _grid.ChangedCells(), _grid.Expanded());
 
-        for (int j = 0; j < xvals.size(); j++) 
+      // Poses of the plan: the hybrid path, or the cell centers headed to
+      // the next one
+      _hybrid_path.clear();
+      if(_planner == "hybrid")
+      {
+        const HybridAStar::Pose2 from = { start.pose.position.x, start.pose.position.y, tf::getYaw(start.pose.orientation) };
+        const HybridAStar::Pose2 to = { goal.pose.position.x, goal.pose.position.y, tf::getYaw(goal.pose.orientation) };
+        if(!_hybrid.Plan(_grid, from, to, _hybrid_path))
+          ROS_WARN("Hybrid A* gave up after %zu expansions, using the grid path", _hybrid.Expanded());
+      }
+      if(_hybrid_path.empty())
+      {
+        for(size_t k = 0; k < _grid_cells.size(); k++)
         {
-            for (int i = 0; i < order; i++) 
-                A(j, i + 1) = A(j, i) * xvals(j);
+          const int cell = _grid_cells[k];
+          HybridAStar::Pose2 pose;
+          pose.x = origin_x + (cell % size_x + 0.5) * resolution;
+          pose.y = origin_y + (cell / size_x + 0.5) * resolution;
+          pose.yaw = 0.0;
+          if(k > 0)
+            _hybrid_path.back().yaw = atan2(pose.y - _hybrid_path.back().y, pose.x - _hybrid_path.back().x);
+          _hybrid_path.push_back(pose);
         }
+        _hybrid_path.back().x = goal.pose.position.x;
+        _hybrid_path.back().y = goal.pose.position.y;
+      }
+      _hybrid_path.back().yaw = tf::getYaw(goal.pose.orientation);
 
-        auto Q = A.householderQr();
-        auto result = Q.solve(yvals);
-        return result;
+      CompactPath global_path;
+      geometry_msgs::PoseStamped tempPose;
+      tempPose.header.frame_id = _costmap_ros->getGlobalFrameID();
+      tempPose.header.stamp = ros::Time::now();
+      plan.reserve(plan.size() + _hybrid_path.size());
+      for(size_t k = 0; k < _hybrid_path.size(); k++)
+      {
+        const HybridAStar::Pose2 &pose = _hybrid_path[k];
+        tempPose.pose.position.x = pose.x;
+        tempPose.pose.position.y = pose.y;
+        tempPose.pose.position.z = 0.0;
+        tempPose.pose.orientation = tf::createQuaternionMsgFromYaw(pose.yaw);
+        plan.push_back(tempPose);
+        if(global_path.Length() <= _pathLength)
+          global_path.PushBack(pose.x, pose.y, pose.yaw);
+      }
+      trackPath(global_path); // the part ahead, for the tracking error
+      return true;
+    }
+    // Hand the plan over to the analytics thread
+    void GeonPlanner::trackPath(const CompactPath &path)
+    {
+      _tracked_path.Set(CompactPath::ConstPtr(new CompactPath(path)));
+    }
+    // Analytics thread: tracking error of the new pose
+    void GeonPlanner::analyticsOdomCB(const nav_msgs::Odometry::ConstPtr& odomMsg)
+    {
+      if(!_goal_received) //received goal & goal not reached
+        return;
+      _analytics.SetPath(_tracked_path.Get());
+
+      const double px = odomMsg->pose.pose.position.x;
+      const double py = odomMsg->pose.pose.position.y;
+      const double theta = tf::getYaw(odomMsg->pose.pose.orientation);
+      double cte, etheta;
+      if(!_analytics.Observe(px, py, theta, cte, etheta))
+        return;
+      _metrics.Metrics().ObserveTracking(cte, etheta);
+
+      TrajectoryRecord record;
+      record.stamp = odomMsg->header.stamp.toSec();
+      record.state[0] = px;
+      record.state[1] = py;
+      record.state[2] = theta;
+      record.state[3] = odomMsg->twist.twist.linear.x;
+      record.state[4] = cte;
+      record.state[5] = etheta;
+      record.speed = _linear_vel;
+      record.angvel = _angular_vel;
+      _log.Push(record);
+    }
+    // Analytics thread: mean, p95 and max since the start
+    void GeonPlanner::analyticsReport(const ros::TimerEvent&)
+    {
+      if(_analytics.Samples() > 0)
+        ROS_INFO("Tracking error: %s", _analytics.Summary().c_str());
+    }
+    // CallBack: Update odometry
+    void GeonPlanner::odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg)
+    {
+      _odom = *odomMsg;        
+    }
+    void GeonPlanner::desiredPathCB(const CompactPath::ConstPtr& totalPathMsg)
+    {
+      _desired_path.Set(totalPathMsg);
     }
     // CallBack: Update goal status
     void GeonPlanner::goalCB(const geometry_msgs::PoseStamped::ConstPtr& goalMsg)
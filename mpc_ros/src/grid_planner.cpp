@@ -0,0 +1,293 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "grid_planner.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+namespace
+{
+    const float INF = std::numeric_limits<float>::infinity();
+    const int NEIGHBORS[8][2] = { {-1, -1}, {0, -1}, {1, -1}, {-1, 0}, {1, 0}, {-1, 1}, {0, 1}, {1, 1} };
+    // Costs are whole numbers, so sums are exact and the key ties of D*
+    // Lite break the same way however a cost was reached: steps of 5 and 7
+    // (diagonal), times the sum of the multipliers of the two cells in
+    // hundredths
+    const double STRAIGHT = 5.0, DIAGONAL = 7.0, UNIT = 100.0;
+    const double STEP[8] = { DIAGONAL, STRAIGHT, DIAGONAL, STRAIGHT, STRAIGHT, DIAGONAL, STRAIGHT, DIAGONAL };
+    const unsigned char INSCRIBED = 253, UNKNOWN = 255;
+}
+
+GridPlanner::GridPlanner(double cost_factor, bool allow_unknown)
+    : _cost_factor(cost_factor >= 0.0 ? cost_factor : 3.0), _allow_unknown(allow_unknown),
+      _size_x(0), _size_y(0), _resolution(0.0), _origin_x(0.0), _origin_y(0.0),
+      _start(-1), _last_start(-1), _goal(-1), _km(0.0), _changed_cells(0), _expanded(0)
+{
+}
+
+void GridPlanner::SetCostFactor(double cost_factor)
+{
+    if (cost_factor < 0.0 || cost_factor == _cost_factor)
+        return;
+    _cost_factor = cost_factor;
+    for (size_t i = 0; i < _costs.size(); i++)
+        setTraversal(i, _costs[i]);
+    Reset();
+}
+
+void GridPlanner::SetAllowUnknown(bool allow_unknown)
+{
+    if (allow_unknown == _allow_unknown)
+        return;
+    _allow_unknown = allow_unknown;
+    for (size_t i = 0; i < _costs.size(); i++)
+        setTraversal(i, _costs[i]);
+    Reset();
+}
+
+void GridPlanner::Reset()
+{
+    _goal = -1;
+    _changed.clear();
+}
+
+void GridPlanner::Update(const unsigned char *costs, unsigned int size_x, unsigned int size_y,
+                         double resolution, double origin_x, double origin_y)
+{
+    if ((int)size_x != _size_x || (int)size_y != _size_y || resolution != _resolution ||
+        origin_x != _origin_x || origin_y != _origin_y)
+    {
+        _resolution = resolution;
+        _origin_x = origin_x;
+        _origin_y = origin_y;
+        rebuild(size_x, size_y);
+    }
+
+    // Only the cells that changed since the last call are repaired
+    const int n = _size_x * _size_y;
+    for (int i = 0; i < n; i++)
+    {
+        if (costs[i] == _costs[i])
+            continue;
+        _costs[i] = costs[i];
+        setTraversal(i, costs[i]);
+        if (_goal >= 0)
+            _changed.push_back(i);
+    }
+}
+
+bool GridPlanner::Plan(int start_x, int start_y, int goal_x, int goal_y, std::vector<int> &cells)
+{
+    cells.clear();
+    _changed_cells = 0;
+    _expanded = 0;
+    if (!Inside(start_x, start_y) || !Inside(goal_x, goal_y))
+        return false;
+    const int start = Index(start_x, start_y), goal = Index(goal_x, goal_y);
+    if (_traversal[start] == INF || _traversal[goal] == INF)
+        return false;
+
+    _start = start;
+    if (goal != _goal)
+        restart(goal);
+    else
+    {
+        // The robot moved: keys of the old start are too low by the
+        // distance it moved, raise the new ones instead of the queue
+        _km += heuristic(_last_start, _start);
+        _last_start = _start;
+        _changed_cells = _changed.size();
+        for (size_t k = 0; k < _changed.size(); k++)
+        {
+            const int c = _changed[k];
+            const int cx = c % _size_x, cy = c / _size_x;
+            updateCell(c);
+            for (int n = 0; n < 8; n++)
+            {
+                const int nx = cx + NEIGHBORS[n][0], ny = cy + NEIGHBORS[n][1];
+                if (Inside(nx, ny))
+                    updateCell(Index(nx, ny));
+            }
+        }
+        _changed.clear();
+    }
+    computePath();
+    if (_g[_start] == INF)
+        return false;
+
+    // Down the cost to the goal
+    const size_t max_cells = (size_t)_size_x * _size_y;
+    int cur = _start;
+    cells.push_back(cur);
+    while (cur != _goal)
+    {
+        const int cx = cur % _size_x, cy = cur / _size_x;
+        int best = -1;
+        double best_cost = INF;
+        for (int n = 0; n < 8; n++)
+        {
+            const int nx = cx + NEIGHBORS[n][0], ny = cy + NEIGHBORS[n][1];
+            if (!Inside(nx, ny))
+                continue;
+            const int next = Index(nx, ny);
+            const double c = edge(cur, next, n) + _g[next];
+            if (c < best_cost)
+            {
+                best_cost = c;
+                best = next;
+            }
+        }
+        if (best < 0 || cells.size() > max_cells)
+        {
+            cells.clear();
+            return false;
+        }
+        cur = best;
+        cells.push_back(cur);
+    }
+    return true;
+}
+
+double GridPlanner::CostToGoal(int cell) const
+{
+    if (_goal < 0)
+        return 0.0;
+    double cost = _g[cell];
+    if (cost == INF)
+    {
+        // Not expanded, so the way through cell is no shorter than the
+        // start's: g(cell) >= g(start) - h(start, cell)
+        cost = heuristic(cell, _goal);
+        if (_g[_start] != INF)
+            cost = std::max(cost, _g[_start] - heuristic(_start, cell));
+    }
+    return cost / (2.0 * UNIT * STRAIGHT);
+}
+
+void GridPlanner::rebuild(unsigned int size_x, unsigned int size_y)
+{
+    _size_x = size_x;
+    _size_y = size_y;
+    const size_t n = (size_t)size_x * size_y;
+    _costs.assign(n, 0);
+    _traversal.assign(n, (float)UNIT);
+    _g.clear();
+    _rhs.clear();
+    Reset();
+}
+
+void GridPlanner::setTraversal(int cell, unsigned char cost)
+{
+    if (cost == UNKNOWN)
+        _traversal[cell] = _allow_unknown ? (float)UNIT : INF;
+    else if (cost >= INSCRIBED)
+        _traversal[cell] = INF;
+    else
+        _traversal[cell] = (float)std::floor(UNIT * (1.0 + _cost_factor * cost / 252.0) + 0.5);
+}
+
+void GridPlanner::restart(int goal)
+{
+    const size_t n = (size_t)_size_x * _size_y;
+    _goal = goal;
+    _g.assign(n, INF);
+    _rhs.assign(n, INF);
+    _rhs[goal] = 0.0;
+    _changed.clear();
+    _open = std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> >();
+    _km = 0.0;
+    _last_start = _start;
+    _open.push(Entry(key(goal), goal));
+}
+
+GridPlanner::Key GridPlanner::key(int cell) const
+{
+    const double m = std::min(_g[cell], _rhs[cell]);
+    return Key(m + heuristic(_start, cell) + _km, m);
+}
+
+void GridPlanner::updateCell(int cell)
+{
+    if (cell != _goal)
+    {
+        const int cx = cell % _size_x, cy = cell / _size_x;
+        double rhs = INF;
+        for (int n = 0; n < 8; n++)
+        {
+            const int nx = cx + NEIGHBORS[n][0], ny = cy + NEIGHBORS[n][1];
+            if (Inside(nx, ny))
+            {
+                const int next = Index(nx, ny);
+                rhs = std::min(rhs, edge(cell, next, n) + _g[next]);
+            }
+        }
+        _rhs[cell] = rhs;
+    }
+    if (_g[cell] != _rhs[cell])
+        _open.push(Entry(key(cell), cell));
+}
+
+void GridPlanner::computePath()
+{
+    while (!_open.empty())
+    {
+        const Entry top = _open.top();
+        if (!(top.first < key(_start)) && _g[_start] == _rhs[_start])
+            break;
+        _open.pop();
+        const int u = top.second;
+        if (_g[u] == _rhs[u])
+            continue;
+        const Key k = key(u);
+        if (top.first < k)
+        {
+            _open.push(Entry(k, u));
+            continue;
+        }
+
+        _expanded++;
+        if (_g[u] > _rhs[u])
+            _g[u] = _rhs[u];
+        else
+        {
+            _g[u] = INF;
+            updateCell(u);
+        }
+        const int cx = u % _size_x, cy = u / _size_x;
+        for (int n = 0; n < 8; n++)
+        {
+            const int nx = cx + NEIGHBORS[n][0], ny = cy + NEIGHBORS[n][1];
+            if (Inside(nx, ny))
+                updateCell(Index(nx, ny));
+        }
+    }
+}
+
+double GridPlanner::edge(int from, int to, int n) const
+{
+    const float a = _traversal[from], b = _traversal[to];
+    if (a == INF || b == INF)
+        return INF;
+    return STEP[n] * ((double)a + b);
+}
+
+double GridPlanner::heuristic(int a, int b) const
+{
+    const int dx = std::abs(a % _size_x - b % _size_x), dy = std::abs(a / _size_x - b / _size_x);
+    return 2.0 * UNIT * (STRAIGHT * std::max(dx, dy) + (DIAGONAL - STRAIGHT) * std::min(dx, dy));
+}
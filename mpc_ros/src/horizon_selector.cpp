@@ -0,0 +1,158 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "horizon_selector.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    double param(const std::map<std::string, double> &params, const char *key, double value)
+    {
+        std::map<std::string, double>::const_iterator it = params.find(key);
+        return it != params.end() ? it->second : value;
+    }
+
+    // Largest curvature of the path polynomial over [0, length]
+    double maxCurvature(const Eigen::VectorXd &coeffs, double length)
+    {
+        double result = 0.0;
+        for (int k = 0; k <= 4; k++)
+        {
+            const double x = length * k / 4;
+            double df = 0.0, ddf = 0.0;
+            for (int i = coeffs.size() - 1; i >= 1; i--)
+            {
+                df = df * x + i * coeffs[i];
+                if (i >= 2)
+                    ddf = ddf * x + i * (i - 1) * coeffs[i];
+            }
+            result = std::max(result, std::fabs(ddf) / std::pow(1.0 + df * df, 1.5));
+        }
+        return result;
+    }
+}
+
+HorizonSelector::HorizonSelector()
+    : _enabled(false), _fine(0), _preview(1.0), _max_throttle(1.0), _hold(10),
+      _current(-1), _shorter_cycles(0), _step_time(0.0), _model(NULL)
+{
+}
+
+void HorizonSelector::LoadParams(const std::map<std::string, double> &params)
+{
+    _enabled = param(params, "ADAPTIVE", 0.0) != 0.0;
+    const int max_steps = std::max(2, (int)param(params, "STEPS", 40.0));
+    const int min_steps = std::min(max_steps, std::max(2, (int)param(params, "MIN_STEPS", std::max(5, max_steps / 4))));
+    const int step = std::max(1, (int)param(params, "HORIZON_STEP", 5.0));
+    const double dt = param(params, "DT", 0.1);
+    _preview = param(params, "HORIZON_PREVIEW", 1.0);
+    _max_throttle = std::max(0.1, param(params, "MAXTHR", 1.0));
+    _hold = std::max(0, (int)param(params, "HOLD", 10.0));
+
+    _candidates.clear();
+    for (int coarse = 0; coarse < 2; coarse++)
+    {
+        for (int n = min_steps; ; n = std::min(n + step, max_steps))
+        {
+            const Horizon horizon = { n, coarse ? 2 * dt : dt };
+            _candidates.push_back(horizon);
+            if (n == max_steps)
+                break;
+        }
+        if (!coarse)
+            _fine = _candidates.size();
+    }
+    _current = -1;
+    _shorter_cycles = 0;
+}
+
+int HorizonSelector::desired(double v, const Eigen::VectorXd &coeffs, double budget) const
+{
+    const double speed = std::fabs(v);
+    const double preview = _preview + speed / _max_throttle;
+
+    // Shortest fine candidate that looks far enough, else a coarse one if
+    // the path is straight enough for it, else the longest fine one
+    int index = _fine - 1;
+    for (int i = 0; i < _fine; i++)
+    {
+        if (_candidates[i].steps * _candidates[i].dt >= preview)
+        {
+            index = i;
+            break;
+        }
+    }
+    if (_candidates[index].steps * _candidates[index].dt < preview)
+    {
+        const double coarse_dt = _candidates[_fine].dt;
+        if (coeffs.size() < 3 || maxCurvature(coeffs, speed * preview) * speed * coarse_dt < 0.05)
+        {
+            index = _candidates.size() - 1;
+            for (int i = _fine; i < (int)_candidates.size(); i++)
+            {
+                if (_candidates[i].steps * _candidates[i].dt >= preview)
+                {
+                    index = i;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Within the solve time budget, as far as MIN_STEPS
+    const int first = index < _fine ? 0 : _fine;
+    if (_model && _model->Ready())
+    {
+        while (budget > 0.0 && index > first && _model->SolveMs(_candidates[index].steps) > 1000.0 * budget)
+            index--;
+        return index;
+    }
+    while (budget > 0.0 && _step_time > 0.0 && index > first && _candidates[index].steps * _step_time > budget)
+        index--;
+    return index;
+}
+
+int HorizonSelector::Choose(double v, const Eigen::VectorXd &coeffs, double budget) const
+{
+    if (_candidates.empty())
+        return -1;
+    const int index = desired(v, coeffs, budget);
+    if (_current < 0 || index == _current)
+        return index;
+    const Horizon &want = _candidates[index], &now = _candidates[_current];
+    const bool shorter = want.steps * want.dt < now.steps * now.dt;
+    // A solve that does not fit the budget is left at once as well
+    const bool too_slow = budget > 0.0 && now.steps * _step_time > budget;
+    return (!shorter || too_slow || _shorter_cycles + 1 >= _hold) ? index : _current;
+}
+
+int HorizonSelector::Next(double v, const Eigen::VectorXd &coeffs, double budget)
+{
+    const int index = Choose(v, coeffs, budget);
+    const int wanted = _candidates.empty() ? -1 : desired(v, coeffs, budget);
+    _shorter_cycles = (index == _current && wanted != _current) ? _shorter_cycles + 1 : 0;
+    _current = index;
+    return index;
+}
+
+void HorizonSelector::Measure(int index, double seconds)
+{
+    if (index < 0 || index >= (int)_candidates.size())
+        return;
+    const double per_step = seconds / _candidates[index].steps;
+    _step_time = _step_time > 0.0 ? 0.8 * _step_time + 0.2 * per_step : per_step;
+}
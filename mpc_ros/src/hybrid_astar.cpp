@@ -0,0 +1,162 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "hybrid_astar.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    const double TURN_PENALTY = 1.05;
+
+    double normalize(double a)
+    {
+        return std::atan2(std::sin(a), std::cos(a));
+    }
+}
+
+HybridAStar::HybridAStar(double min_turning_radius, int heading_bins, int max_expansions, double heuristic_weight)
+    : _expanded(0)
+{
+    Configure(min_turning_radius, heading_bins, max_expansions, heuristic_weight);
+}
+
+void HybridAStar::Configure(double min_turning_radius, int heading_bins, int max_expansions, double heuristic_weight)
+{
+    _min_turning_radius = min_turning_radius > 0.0 ? min_turning_radius : 0.5;
+    _heading_bins = std::max(heading_bins, 8);
+    _max_expansions = std::max(max_expansions, 1);
+    _heuristic_weight = std::max(heuristic_weight, 1.0);
+}
+
+bool HybridAStar::Plan(const GridPlanner &grid, const Pose2 &start, const Pose2 &goal, std::vector<Pose2> &path)
+{
+    path.clear();
+    _expanded = 0;
+    const double res = grid.Resolution();
+    if (grid.SizeX() == 0 || res <= 0.0)
+        return false;
+
+    _best.clear();
+    _nodes.clear();
+    _closed.clear();
+    _open = std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> >();
+
+    int cell;
+    const long long start_bin = bin(grid, start, cell);
+    if (start_bin < 0)
+        return false;
+    const Node first = { start, 0.0, -1 };
+    _nodes.push_back(first);
+    _closed.push_back(0);
+    _best[start_bin] = 0;
+    const double h_scale = _heuristic_weight * res;
+    _open.push(Entry(grid.CostToGoal(cell) * h_scale, 0));
+
+    // One cell diagonal per expansion, so every node leaves its cell
+    const double step = 1.5 * res;
+    const double curvatures[3] = { 0.0, 1.0 / _min_turning_radius, -1.0 / _min_turning_radius };
+    int reached = -1;
+    while (!_open.empty() && _expanded < (size_t)_max_expansions)
+    {
+        const int i = _open.top().second;
+        _open.pop();
+        if (_closed[i])
+            continue;
+        _closed[i] = 1;
+        _expanded++;
+
+        const Pose2 pose = _nodes[i].pose;
+        if (std::hypot(pose.x - goal.x, pose.y - goal.y) <= step)
+        {
+            reached = i;
+            break;
+        }
+
+        for (int k = 0; k < 3; k++)
+        {
+            Pose2 next;
+            if (collides(grid, pose, curvatures[k], step, next))
+                continue;
+            int next_cell;
+            const long long b = bin(grid, next, next_cell);
+            if (b < 0)
+                continue;
+            const double g = _nodes[i].g + step * grid.Traversal(next_cell) * (k == 0 ? 1.0 : TURN_PENALTY);
+            std::unordered_map<long long, int>::iterator old = _best.find(b);
+            if (old != _best.end() && (_closed[old->second] || _nodes[old->second].g <= g))
+                continue;
+            const Node node = { next, g, i };
+            _best[b] = _nodes.size();
+            _nodes.push_back(node);
+            _closed.push_back(0);
+            _open.push(Entry(g + grid.CostToGoal(next_cell) * h_scale, _nodes.size() - 1));
+        }
+    }
+    if (reached < 0)
+        return false;
+
+    for (int i = reached; i >= 0; i = _nodes[i].parent)
+        path.push_back(_nodes[i].pose);
+    std::reverse(path.begin(), path.end());
+    path.push_back(goal);
+    return true;
+}
+
+// Arc of curvature and length from from, checked every half cell
+bool HybridAStar::collides(const GridPlanner &grid, const Pose2 &from, double curvature, double length, Pose2 &to) const
+{
+    const double res = grid.Resolution();
+    const int checks = std::max(1, (int)std::ceil(length / (0.5 * res)));
+    const double ds = length / checks;
+    to = from;
+    for (int k = 0; k < checks; k++)
+    {
+        const double dyaw = curvature * ds;
+        if (dyaw == 0.0)
+        {
+            to.x += ds * std::cos(to.yaw);
+            to.y += ds * std::sin(to.yaw);
+        }
+        else
+        {
+            // Exact arc: chord of length 2 sin(dyaw / 2) / curvature
+            const double chord = 2.0 * std::sin(0.5 * dyaw) / curvature;
+            to.x += chord * std::cos(to.yaw + 0.5 * dyaw);
+            to.y += chord * std::sin(to.yaw + 0.5 * dyaw);
+        }
+        to.yaw = normalize(to.yaw + dyaw);
+
+        const int cx = (int)std::floor((to.x - grid.OriginX()) / res), cy = (int)std::floor((to.y - grid.OriginY()) / res);
+        if (!grid.Inside(cx, cy) || grid.Traversal(grid.Index(cx, cy)) == std::numeric_limits<float>::infinity())
+            return true;
+    }
+    return false;
+}
+
+// State index of pose, -1 outside the grid
+long long HybridAStar::bin(const GridPlanner &grid, const Pose2 &pose, int &cell) const
+{
+    const double res = grid.Resolution();
+    const int cx = (int)std::floor((pose.x - grid.OriginX()) / res), cy = (int)std::floor((pose.y - grid.OriginY()) / res);
+    if (!grid.Inside(cx, cy))
+        return -1;
+    cell = grid.Index(cx, cy);
+    int h = (int)std::floor((normalize(pose.yaw) + M_PI) / (2.0 * M_PI) * _heading_bins);
+    h = std::min(std::max(h, 0), _heading_bins - 1);
+    return (long long)cell * _heading_bins + h;
+}
@@ -0,0 +1,103 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "input_spline.h"
+#include <cmath>
+
+bool InputSpline::Set(int points, int steps, const std::vector<double> &step_dt)
+{
+    Clear();
+    const int n = steps - 1;
+    if (points < 4 || points > n)
+    {
+        return false;
+    }
+
+    // Start time of each input, scaled to [0, 1]
+    std::vector<double> u(n, 0.0);
+    for (int i = 1; i < n; i++)
+    {
+        u[i] = u[i - 1] + (step_dt.empty() ? 1.0 : step_dt[i - 1]);
+    }
+    for (int i = 1; i < n; i++)
+    {
+        u[i] /= u[n - 1];
+    }
+
+    // Clamped uniform knots, points + 4 of them
+    std::vector<double> knot(points + 4);
+    for (int k = 0; k < points + 4; k++)
+    {
+        knot[k] = k < 4 ? 0.0 : (k >= points ? 1.0 : double(k - 3) / (points - 3));
+    }
+
+    _first.resize(n);
+    _weight.resize(4 * n);
+    for (int i = 0; i < n; i++)
+    {
+        // Span [knot[span], knot[span + 1]) of u, the last one closed
+        int span = 3;
+        while (span < points - 1 && u[i] >= knot[span + 1])
+        {
+            span++;
+        }
+        // Cox-de Boor from degree 0 up, the nonzero basis functions only
+        double basis[4] = {1.0, 0.0, 0.0, 0.0}, left[4], right[4];
+        for (int degree = 1; degree <= 3; degree++)
+        {
+            left[degree] = u[i] - knot[span + 1 - degree];
+            right[degree] = knot[span + degree] - u[i];
+            double saved = 0.0;
+            for (int r = 0; r < degree; r++)
+            {
+                const double term = basis[r] / (right[r + 1] + left[degree - r]);
+                basis[r] = saved + right[r + 1] * term;
+                saved = left[degree - r] * term;
+            }
+            basis[degree] = saved;
+        }
+        _first[i] = span - 3;
+        for (int k = 0; k < 4; k++)
+        {
+            _weight[4 * i + k] = basis[k];
+        }
+    }
+
+    _sample.resize(points);
+    for (int k = 0; k < points; k++)
+    {
+        const double greville = (knot[k + 1] + knot[k + 2] + knot[k + 3]) / 3.0;
+        int best = 0;
+        for (int i = 1; i < n; i++)
+        {
+            if (std::fabs(u[i] - greville) < std::fabs(u[best] - greville))
+            {
+                best = i;
+            }
+        }
+        _sample[k] = best;
+    }
+    _points = points;
+    return true;
+}
+
+void InputSpline::Clear()
+{
+    _points = 0;
+    _first.clear();
+    _weight.clear();
+    _sample.clear();
+}
@@ -0,0 +1,93 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "ipopt_options.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace ipopt_options
+{
+    bool Parse(const std::string &text, std::string &options, std::string &error)
+    {
+        options.clear();
+        std::istringstream lines(text);
+        std::string line;
+        int number = 0;
+        while (std::getline(lines, line))
+        {
+            number++;
+            const size_t hash = line.find('#');
+            if (hash != std::string::npos)
+                line.erase(hash);
+            std::istringstream tokens(line);
+            std::string type, name, value, extra;
+            if (!(tokens >> type))
+                continue;
+            std::ostringstream where;
+            where << "line " << number << ": ";
+            if (!(tokens >> name >> value) || (tokens >> extra))
+            {
+                error = where.str() + "expected \"type name value\"";
+                return false;
+            }
+            if (type == "Numeric" || type == "Integer")
+            {
+                char *end = NULL;
+                if (type == "Numeric")
+                    std::strtod(value.c_str(), &end);
+                else
+                    std::strtol(value.c_str(), &end, 10);
+                if (*end != '\0')
+                {
+                    error = where.str() + value + " is not a" + (type == "Integer" ? "n integer" : " number");
+                    return false;
+                }
+            }
+            else if (type != "String")
+            {
+                error = where.str() + "type " + type + " is not String, Numeric or Integer";
+                return false;
+            }
+            options += type + " " + name + " " + value + "\n";
+        }
+        return true;
+    }
+
+    bool Load(const std::string &path, std::string &options, std::string &error)
+    {
+        std::ifstream file(path.c_str());
+        if (!file)
+        {
+            error = "cannot open " + path;
+            return false;
+        }
+        std::ostringstream text;
+        text << file.rdbuf();
+        return Parse(text.str(), options, error);
+    }
+
+    bool Write(const std::string &path, const std::string &options, const std::string &header)
+    {
+        std::ofstream file(path.c_str());
+        std::istringstream lines(header);
+        std::string line;
+        while (std::getline(lines, line))
+            file << "# " << line << "\n";
+        file << options;
+        return (bool)file;
+    }
+}
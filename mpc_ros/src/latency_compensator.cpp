@@ -0,0 +1,46 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "latency_compensator.h"
+#include "integrator.h"
+#include <algorithm>
+
+LatencyCompensator::LatencyCompensator() : _cycles(50)
+{
+    _percentile = 0.5;
+    _actuation = 0.0;
+    _max_latency = 0.5;
+}
+
+void LatencyCompensator::Configure(double percentile, double actuation, double max_latency)
+{
+    _percentile = std::min(std::max(percentile, 0.0), 1.0);
+    _actuation = std::max(actuation, 0.0);
+    _max_latency = std::max(max_latency, 0.0);
+}
+
+double LatencyCompensator::Latency(double now, double odom_stamp) const
+{
+    const double age = odom_stamp > 0.0 ? std::max(now - odom_stamp, 0.0) : 0.0;
+    return std::min(age + _cycles.Percentile(_percentile) + _actuation, _max_latency);
+}
+
+void LatencyCompensator::Predict(double latency, double v, double w, double a,
+                                 double &x, double &y, double &theta, double &v_out)
+{
+    integrator::Step<double>(integrator::ARC, latency, 0.0, 0.0, 0.0, v, w, a, x, y, theta, v_out);
+}
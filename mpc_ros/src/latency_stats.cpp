@@ -0,0 +1,72 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "latency_stats.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+RollingStats::RollingStats(int window)
+{
+    _window = std::max(1, window);
+    _next = 0;
+    _values.reserve(_window);
+}
+
+void RollingStats::Add(double value)
+{
+    if ((int)_values.size() < _window)
+        _values.push_back(value);
+    else
+        _values[_next] = value;
+    _next = (_next + 1) % _window;
+}
+
+double RollingStats::Percentile(double p) const
+{
+    if (_values.empty())
+        return 0.0;
+    std::vector<double> sorted(_values);
+    const int k = std::min(std::max((int)std::ceil(p * sorted.size()) - 1, 0), (int)sorted.size() - 1);
+    std::nth_element(sorted.begin(), sorted.begin() + k, sorted.end());
+    return sorted[k];
+}
+
+double RollingStats::Max() const
+{
+    if (_values.empty())
+        return 0.0;
+    return *std::max_element(_values.begin(), _values.end());
+}
+
+std::vector<unsigned int> RollingStats::Histogram(const std::vector<double> &edges) const
+{
+    std::vector<unsigned int> counts(edges.size() + 1, 0);
+    for (size_t i = 0; i < _values.size(); i++)
+    {
+        const size_t bin = std::upper_bound(edges.begin(), edges.end(), _values[i]) - edges.begin();
+        counts[bin]++;
+    }
+    return counts;
+}
+
+std::string RollingStats::Summary() const
+{
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "%7.2f %7.2f %7.2f", Percentile(0.5), Percentile(0.95), Max());
+    return buf;
+}
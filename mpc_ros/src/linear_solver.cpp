@@ -0,0 +1,115 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "linear_solver.h"
+#include <cstdlib>
+#include <sstream>
+
+namespace
+{
+    const char *NAMES[linear_solver::NUM_BACKENDS] = {
+        "default", "mumps", "ma27", "ma57", "ma77", "ma86", "ma97", "pardiso" };
+
+    // Ordering names of the backends with a String option, see the Ipopt options reference
+    const char *MA77_ORDERS[] = { "amd", "metis" };
+    const char *MA86_ORDERS[] = { "auto", "amd", "metis" };
+    const char *MA97_ORDERS[] = { "auto", "best", "amd", "metis", "matched-auto", "matched-amd", "matched-metis" };
+    const char *PARDISO_ORDERS[] = { "amd", "one_nd", "metis", "pmetis" };
+
+    template <size_t N>
+    std::string orderLine(const char *option, const char *(&orders)[N], int order)
+    {
+        if (order >= (int)N)
+        {
+            return "";
+        }
+        return std::string("String  ") + option + " " + orders[order] + "\n";
+    }
+}
+
+namespace linear_solver
+{
+    const char *Name(int backend)
+    {
+        return backend > DEFAULT && backend < NUM_BACKENDS ? NAMES[backend] : NAMES[DEFAULT];
+    }
+
+    int Parse(const std::string &name)
+    {
+        if (name.empty())
+        {
+            return DEFAULT;
+        }
+        for (int k = 0; k < NUM_BACKENDS; k++)
+        {
+            if (name == NAMES[k])
+            {
+                return k;
+            }
+        }
+        return -1;
+    }
+
+    std::string SolveOptions(int backend, int order)
+    {
+        if (backend <= DEFAULT || backend >= NUM_BACKENDS)
+        {
+            return "";
+        }
+        std::string options = std::string("String  linear_solver ") + NAMES[backend] + "\n";
+        if (order < 0)
+        {
+            return options;
+        }
+        std::ostringstream number;
+        number << order;
+        switch (backend)
+        {
+        case MUMPS:
+            options += "Integer mumps_pivot_order " + number.str() + "\n";
+            break;
+        case MA57:
+            options += "Integer ma57_pivot_order " + number.str() + "\n";
+            break;
+        case MA77:
+            options += orderLine("ma77_order", MA77_ORDERS, order);
+            break;
+        case MA86:
+            options += orderLine("ma86_order", MA86_ORDERS, order);
+            break;
+        case MA97:
+            options += orderLine("ma97_order", MA97_ORDERS, order);
+            break;
+        case PARDISO:
+            options += orderLine("pardiso_order", PARDISO_ORDERS, order);
+            break;
+        default:
+            break;
+        }
+        return options;
+    }
+
+    void SetThreads(int threads)
+    {
+        if (threads <= 0)
+        {
+            return;
+        }
+        std::ostringstream value;
+        value << threads;
+        setenv("OMP_NUM_THREADS", value.str().c_str(), 1);
+    }
+}
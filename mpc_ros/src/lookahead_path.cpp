@@ -0,0 +1,105 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "lookahead_path.h"
+#include <algorithm>
+#include <cmath>
+
+LookaheadPath::LookaheadPath()
+    : _current(0)
+{
+}
+
+void LookaheadPath::Set(const CompactPath::ConstPtr &path)
+{
+    _path = path;
+    _current = 0;
+}
+
+bool LookaheadPath::Find(double x, double y, double yaw, double lfw, double &px, double &py)
+{
+    const size_t n = Size();
+    if (n == 0)
+        return false;
+    const std::vector<double> &arc = _path->Ss();
+
+    const double c = cos(yaw), s = sin(yaw);
+    const double sq_lfw = lfw * lfw;
+    px = _path->X(n - 1);
+    py = _path->Y(n - 1);
+
+    // First waypoint ahead, from the one of the last call: back while the
+    // previous waypoint is ahead again, forward past the ones behind
+    size_t i = std::min(_current, n - 1);
+    while (i > 0 && Ahead(i - 1, x, y, c, s))
+        i--;
+    while (i < n && !Ahead(i, x, y, c, s))
+        i++;
+    if (i == n)
+        return false;
+    _current = i;
+
+    // No waypoint before arc length s_i + lfw - |car, i| is lfw away
+    const double d = std::sqrt(SqDist(i, x, y));
+    size_t lo = i;
+    if (d < lfw)
+        lo = std::lower_bound(arc.begin() + i, arc.end(), arc[i] + lfw - d) - arc.begin();
+
+    size_t found = n;
+    if (lo < n && SqDist(n - 1, x, y) >= sq_lfw)
+    {
+        size_t a = lo, b = n - 1;
+        while (a < b)
+        {
+            const size_t mid = a + (b - a) / 2;
+            if (SqDist(mid, x, y) >= sq_lfw)
+                b = mid;
+            else
+                a = mid + 1;
+        }
+        if (Ahead(a, x, y, c, s))
+            found = a;
+    }
+    if (found == n)
+    {
+        for (size_t j = lo; j < n; j++)
+        {
+            if (Ahead(j, x, y, c, s) && SqDist(j, x, y) >= sq_lfw)
+            {
+                found = j;
+                break;
+            }
+        }
+    }
+    if (found == n)
+        return false;
+
+    px = _path->X(found);
+    py = _path->Y(found);
+    return true;
+}
+
+bool LookaheadPath::Ahead(size_t i, double x, double y, double c, double s) const
+{
+    return c * (_path->X(i) - x) + s * (_path->Y(i) - y) > 0.0;
+}
+
+double LookaheadPath::SqDist(size_t i, double x, double y) const
+{
+    const double dx = _path->X(i) - x, dy = _path->Y(i) - y;
+    return dx * dx + dy * dy;
+}
@@ -0,0 +1,210 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "metrics_exporter.h"
+#include <diagnostic_msgs/DiagnosticArray.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+    void addValue(diagnostic_msgs::DiagnosticStatus &status, const std::string &key, double value)
+    {
+        diagnostic_msgs::KeyValue kv;
+        kv.key = key;
+        std::ostringstream os;
+        os << value;
+        kv.value = os.str();
+        status.values.push_back(kv);
+    }
+}
+
+MetricsExporter::MetricsExporter()
+{
+    _last_cycles = _last_solves = _last_misses = _last_fallbacks = _last_infeasible = _last_stale = _last_tracking = 0;
+    _last_solve_ms = _last_iterations = _last_cte = _last_etheta = 0.0;
+    _listen_fd = -1;
+    _serving = false;
+}
+
+MetricsExporter::~MetricsExporter()
+{
+    Stop();
+}
+
+void MetricsExporter::Start(ros::NodeHandle &nh, const std::string &name, double period, int port)
+{
+    Stop();
+    _name = name;
+    _labels = "controller=\"" + name + "\"";
+    _pub_diag = nh.advertise<diagnostic_msgs::DiagnosticArray>("/diagnostics", 1);
+    _timer = nh.createTimer(ros::Duration(period > 0.0 ? period : 1.0), &MetricsExporter::publishDiagnostics, this);
+
+    if (port > 0)
+    {
+        if (listen(port))
+        {
+            _serving = true;
+            _http = std::thread(&MetricsExporter::serve, this);
+            ROS_INFO("Controller metrics on http://0.0.0.0:%d/metrics", port);
+        }
+        else
+            ROS_WARN("Cannot serve the controller metrics on port %d: %s", port, std::strerror(errno));
+    }
+}
+
+void MetricsExporter::Stop()
+{
+    _timer.stop();
+    _serving = false;
+    if (_http.joinable())
+        _http.join();
+    if (_listen_fd >= 0)
+    {
+        close(_listen_fd);
+        _listen_fd = -1;
+    }
+}
+
+void MetricsExporter::publishDiagnostics(const ros::TimerEvent&)
+{
+    const uint64_t cycles = _metrics.Cycles(), solves = _metrics.Solves();
+    const uint64_t misses = _metrics.DeadlineMisses(), fallbacks = _metrics.Fallbacks();
+    const uint64_t infeasible = _metrics.Infeasible(), stale = _metrics.TfStale();
+    const uint64_t tracking = _metrics.TrackingCount();
+    const double solve_ms = _metrics.SolveMsSum(), iterations = _metrics.IterationSum();
+    const double cte = _metrics.CteSum(), etheta = _metrics.EthetaSum();
+
+    const double n_solves = double(solves - _last_solves), n_tracking = double(tracking - _last_tracking);
+    diagnostic_msgs::DiagnosticStatus status;
+    status.name = _name + ": controller";
+    status.hardware_id = _name;
+    if (misses > _last_misses || fallbacks > _last_fallbacks || infeasible > _last_infeasible)
+    {
+        status.level = diagnostic_msgs::DiagnosticStatus::WARN;
+        status.message = "deadline misses, fallbacks or rejected solves";
+    }
+    else
+    {
+        status.level = diagnostic_msgs::DiagnosticStatus::OK;
+        status.message = (cycles > _last_cycles) ? "running" : "idle";
+    }
+    addValue(status, "cycles", cycles - _last_cycles);
+    addValue(status, "solves", solves - _last_solves);
+    addValue(status, "mean solve ms", n_solves > 0 ? (solve_ms - _last_solve_ms) / n_solves : 0.0);
+    addValue(status, "mean iterations", n_solves > 0 ? (iterations - _last_iterations) / n_solves : 0.0);
+    addValue(status, "deadline misses", misses - _last_misses);
+    addValue(status, "fallbacks", fallbacks - _last_fallbacks);
+    addValue(status, "rejected solves", infeasible - _last_infeasible);
+    addValue(status, "stale transforms", stale - _last_stale);
+    addValue(status, "mean |cte| m", n_tracking > 0 ? (cte - _last_cte) / n_tracking : 0.0);
+    addValue(status, "mean |etheta| rad", n_tracking > 0 ? (etheta - _last_etheta) / n_tracking : 0.0);
+    addValue(status, "solver successes", _metrics.Status(1));
+    for (int i = 0; i < ControllerMetrics::NUM_MEMORY_STORES; i++)
+        addValue(status, std::string(ControllerMetrics::MemoryStoreName(i)) + " bytes",
+                 _metrics.Memory(ControllerMetrics::MemoryStore(i)));
+
+    _last_cycles = cycles;
+    _last_solves = solves;
+    _last_misses = misses;
+    _last_fallbacks = fallbacks;
+    _last_infeasible = infeasible;
+    _last_stale = stale;
+    _last_tracking = tracking;
+    _last_solve_ms = solve_ms;
+    _last_iterations = iterations;
+    _last_cte = cte;
+    _last_etheta = etheta;
+
+    diagnostic_msgs::DiagnosticArray array;
+    array.header.stamp = ros::Time::now();
+    array.status.push_back(status);
+    _pub_diag.publish(array);
+}
+
+bool MetricsExporter::listen(int port)
+{
+    _listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (_listen_fd < 0)
+        return false;
+    const int reuse = 1;
+    setsockopt(_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(_listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(_listen_fd, 4) != 0)
+    {
+        const int err = errno;
+        close(_listen_fd);
+        _listen_fd = -1;
+        errno = err;
+        return false;
+    }
+    return true;
+}
+
+// One request at a time, every path answers with the metrics. Polls so
+// Stop() does not wait on a client.
+void MetricsExporter::serve()
+{
+    while (_serving)
+    {
+        pollfd fd;
+        fd.fd = _listen_fd;
+        fd.events = POLLIN;
+        if (poll(&fd, 1, 200) <= 0)
+            continue;
+        const int client = accept(_listen_fd, nullptr, nullptr);
+        if (client < 0)
+            continue;
+
+        timeval timeout;
+        timeout.tv_sec = 1;
+        timeout.tv_usec = 0;
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        char request[1024];
+        if (recv(client, request, sizeof(request), 0) > 0)
+        {
+            const std::string body = _metrics.Prometheus(_labels);
+            std::ostringstream os;
+            os << "HTTP/1.0 200 OK\r\n"
+               << "Content-Type: text/plain; version=0.0.4\r\n"
+               << "Content-Length: " << body.size() << "\r\n"
+               << "Connection: close\r\n\r\n"
+               << body;
+            const std::string response = os.str();
+            size_t sent = 0;
+            while (sent < response.size())
+            {
+                const ssize_t n = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+                if (n <= 0)
+                    break;
+                sent += n;
+            }
+        }
+        close(client);
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "mode_arbiter.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    const char *const NAMES[ModeArbiter::NUM_MODES] = { "mpc", "approach", "rotate", "standstill" };
+}
+
+ModeArbiter::Config::Config()
+    : approach_dist(0.5), hysteresis(0.2), min_cycles(5), lookahead(0.3), approach_accel(0.5)
+{
+}
+
+ModeArbiter::ModeArbiter() : _mode(MPC_TRACKING), _cycles(0), _changed(false) {}
+
+void ModeArbiter::Configure(const Config &config)
+{
+    _config = config;
+    Reset();
+}
+
+void ModeArbiter::Reset()
+{
+    _mode = MPC_TRACKING;
+    _cycles = 0;
+    _changed = false;
+}
+
+const char *ModeArbiter::Name(int mode)
+{
+    return mode >= 0 && mode < NUM_MODES ? NAMES[mode] : "unknown";
+}
+
+void ModeArbiter::set(Mode mode)
+{
+    _changed = mode != _mode;
+    if (_changed)
+    {
+        _mode = mode;
+        _cycles = 0;
+    }
+}
+
+ModeArbiter::Mode ModeArbiter::Update(double goal_dist, bool position_reached, bool goal_reached)
+{
+    _cycles++;
+    // The goal checks latch, they are followed right away
+    if (goal_reached)
+        set(STANDSTILL);
+    else if (position_reached)
+        set(ROTATE);
+    else if (_cycles < _config.min_cycles)
+        set(_mode == MPC_TRACKING ? MPC_TRACKING : APPROACH);
+    else if (_mode == MPC_TRACKING)
+        set(goal_dist < _config.approach_dist ? APPROACH : MPC_TRACKING);
+    else
+        set(goal_dist > _config.approach_dist + _config.hysteresis ? MPC_TRACKING : APPROACH);
+    return _mode;
+}
+
+double ModeArbiter::GoalDistance(const CompactPath &path, size_t start, double x, double y)
+{
+    if (start >= path.Size())
+        return 0.0;
+    return path.Length() - path.S(start) + std::hypot(path.X(start) - x, path.Y(start) - y);
+}
+
+void ModeArbiter::ApproachCommand(const CompactPath &path, size_t start, double x, double y, double theta, double v,
+                                  double dt, double max_speed, double max_angvel, double &speed, double &angvel) const
+{
+    speed = angvel = 0.0;
+    if (start >= path.Size())
+        return;
+    // First waypoint from start at least lookahead away, the goal when none
+    // is. Not by the heading: a robot facing away turns to the plan.
+    size_t target = path.Size() - 1;
+    for (size_t i = start; i < path.Size(); i++)
+    {
+        const double dx = path.X(i) - x, dy = path.Y(i) - y;
+        if (dx * dx + dy * dy >= _config.lookahead * _config.lookahead)
+        {
+            target = i;
+            break;
+        }
+    }
+    const double dx = path.X(target) - x, dy = path.Y(target) - y;
+    const double ld = std::hypot(dx, dy);
+    const double alpha = std::remainder(std::atan2(dy, dx) - theta, 2.0 * M_PI);
+    if (ld < 1e-6)
+        return;
+    if (std::fabs(alpha) > 0.5 * M_PI)
+    {
+        // Behind: stop and turn towards it
+        angvel = std::max(-max_angvel, std::min(alpha, max_angvel));
+        return;
+    }
+    // Speed that still stops at the goal, reached from v at approach_accel
+    const double goal_dist = GoalDistance(path, start, x, y);
+    const double stop_speed = std::sqrt(2.0 * _config.approach_accel * goal_dist);
+    speed = std::max(0.0, std::min(std::min(max_speed, stop_speed), v + _config.approach_accel * dt));
+    // Pure pursuit curvature 2 sin(alpha) / ld
+    angvel = std::max(-max_angvel, std::min(2.0 * std::sin(alpha) / ld * speed, max_angvel));
+}
@@ -0,0 +1,69 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "model_jit.h"
+#include "work_stealing_pool.h"
+
+ModelJit::~ModelJit()
+{
+    if (_worker.joinable())
+        _worker.join();
+    // A job on the pool still refers to this
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done.wait(lock, [this] { return !_busy; });
+}
+
+bool ModelJit::Wants(const std::string &key)
+{
+    if (_busy)
+        return false;
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _requested.count(key) == 0;
+}
+
+bool ModelJit::Request(const std::string &key, const Job &job)
+{
+    if (!Wants(key))
+        return false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _requested.insert(key);
+    }
+    // The last job is done, its thread only has to be joined
+    if (_worker.joinable())
+        _worker.join();
+    _busy = true;
+    const std::function<void()> run = [this, key, job]
+    {
+        const bool ok = job();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (ok)
+            _compiled.insert(key);
+        _busy = false;
+        _done.notify_all();
+    };
+    if (_pool)
+        _pool->Submit(0, run);
+    else
+        _worker = std::thread(run);
+    return true;
+}
+
+bool ModelJit::Ready(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _compiled.count(key) != 0;
+}
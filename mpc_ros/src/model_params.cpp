@@ -0,0 +1,64 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "model_params.h"
+
+const char *const ModelParams::KEYS[ModelParams::NUM_VALUES] = {
+    "DT", "REF_CTE", "REF_ETHETA", "REF_V", "W_CTE", "W_EPSI", "W_V", "W_ANGVEL", "W_A",
+    "W_DANGVEL", "W_DA", "W_OBS", "CLEARANCE"
+};
+
+ModelParams::ModelParams()
+{
+    steps = 40;
+    values[DT] = 0.1; // in sec
+    values[REF_CTE] = 0;
+    values[REF_ETHETA] = 0;
+    values[REF_V] = 0.5; // m/s
+    values[W_CTE] = 100;
+    values[W_EPSI] = 100;
+    values[W_V] = 1;
+    values[W_ANGVEL] = 100;
+    values[W_A] = 50;
+    values[W_DANGVEL] = 0;
+    values[W_DA] = 0;
+    values[W_OBS] = 1000;
+    values[CLEARANCE] = 0.3; // m
+    version = 0;
+}
+
+bool ModelParams::Load(const std::map<std::string, double> &params)
+{
+    bool changed = false;
+    std::map<std::string, double>::const_iterator it = params.find("STEPS");
+    if (it != params.end() && (int)it->second != steps)
+    {
+        steps = it->second;
+        changed = true;
+    }
+    for (int k = 0; k < NUM_VALUES; k++)
+    {
+        it = params.find(KEYS[k]);
+        if (it != params.end() && it->second != values[k])
+        {
+            values[k] = it->second;
+            changed = true;
+        }
+    }
+    if (changed)
+        version++;
+    return changed;
+}
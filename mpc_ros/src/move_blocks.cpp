@@ -0,0 +1,63 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "move_blocks.h"
+#include <cstdlib>
+
+std::vector<int> ParseMoveBlocks(const std::string &text)
+{
+    std::vector<int> blocks;
+    size_t begin = 0;
+    while (begin < text.size())
+    {
+        const size_t end = text.find_first_of(", ", begin);
+        const std::string item = text.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+        if (!item.empty())
+        {
+            char *rest = NULL;
+            const long length = std::strtol(item.c_str(), &rest, 10);
+            if (*rest != '\0' || length < 1)
+            {
+                return std::vector<int>();
+            }
+            blocks.push_back(length);
+        }
+        if (end == std::string::npos)
+        {
+            break;
+        }
+        begin = end + 1;
+    }
+    return blocks;
+}
+
+std::vector<int> MoveBlockIndex(const std::vector<int> &blocks, int steps)
+{
+    std::vector<int> index;
+    if (blocks.empty())
+    {
+        return index;
+    }
+    for (int block = 0; (int)index.size() < steps - 1; block++)
+    {
+        const int length = blocks[block < (int)blocks.size() ? block : blocks.size() - 1];
+        for (int k = 0; k < length && (int)index.size() < steps - 1; k++)
+        {
+            index.push_back(block);
+        }
+    }
+    return index;
+}
@@ -0,0 +1,148 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "moving_obstacles.h"
+#include <cmath>
+#include <algorithm>
+
+// Cells one track may enter per slice, a track far faster than its cells
+// are big would fill the hash. Its prediction beyond them is not indexed.
+static const long long MAX_CELLS = 256;
+
+MovingObstacles::Track::Track()
+{
+    id = 0;
+    x = y = vx = vy = 0.0;
+    radius = 0.0;
+}
+
+MovingObstacles::Snapshot::Snapshot()
+{
+    _stamp = 0.0;
+    _cell = 2.0;
+    _slice = 0.5;
+    _horizon = 5.0;
+}
+
+long long MovingObstacles::Snapshot::key(double x, double y, long long slice) const
+{
+    // 21 bits of each, the few cells around the robot never collide
+    const unsigned long long ix = (unsigned long long)(long long)std::floor(x / _cell) & 0x1fffffULL;
+    const unsigned long long iy = (unsigned long long)(long long)std::floor(y / _cell) & 0x1fffffULL;
+    return (long long)((ix << 42) | (iy << 21) | ((unsigned long long)slice & 0x1fffffULL));
+}
+
+bool MovingObstacles::Snapshot::Closest(double x, double y, double t, double &qx, double &qy, double &radius) const
+{
+    const double dt = std::min(std::max(t - _stamp, 0.0), _horizon);
+    const long long slice = std::min((long long)(dt / _slice), (long long)std::ceil(_horizon / _slice) - 1);
+    double best = INFINITY;
+    for (int dx = -1; dx <= 1; dx++)
+    {
+        for (int dy = -1; dy <= 1; dy++)
+        {
+            std::unordered_map<long long, std::vector<unsigned int> >::const_iterator it
+                = _cells.find(key(x + dx * _cell, y + dy * _cell, std::max(slice, 0LL)));
+            if (it == _cells.end())
+                continue;
+            for (size_t k = 0; k < it->second.size(); k++)
+            {
+                const Track &track = _tracks[it->second[k]];
+                const double tx = track.x + track.vx * dt, ty = track.y + track.vy * dt;
+                const double d = std::hypot(x - tx, y - ty) - track.radius;
+                if (d < best)
+                {
+                    best = d;
+                    qx = tx;
+                    qy = ty;
+                    radius = track.radius;
+                }
+            }
+        }
+    }
+    return best < INFINITY;
+}
+
+MovingObstacles::MovingObstacles()
+{
+    _cell = 2.0;
+    _slice = 0.5;
+    _horizon = 5.0;
+    _max_age = 0.5;
+}
+
+void MovingObstacles::Configure(double cell, double slice, double horizon, double max_age)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cell = cell > 0.0 ? cell : 2.0;
+    _slice = slice > 0.0 ? slice : 0.5;
+    _horizon = std::max(horizon, _slice);
+    _max_age = max_age;
+    _latest.reset();
+}
+
+void MovingObstacles::Set(double stamp, const std::vector<Track> &tracks)
+{
+    double cell, slice, horizon;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        cell = _cell;
+        slice = _slice;
+        horizon = _horizon;
+    }
+    std::shared_ptr<Snapshot> snapshot = std::make_shared<Snapshot>();
+    snapshot->_stamp = stamp;
+    snapshot->_cell = cell;
+    snapshot->_slice = slice;
+    snapshot->_horizon = horizon;
+    snapshot->_tracks = tracks;
+
+    // Per slice the box swept by the track, grown by its radius
+    const long long slices = (long long)std::ceil(horizon / slice);
+    for (unsigned int i = 0; i < tracks.size(); i++)
+    {
+        const Track &track = tracks[i];
+        for (long long k = 0; k < slices; k++)
+        {
+            const double t0 = k * slice, t1 = std::min((k + 1) * slice, horizon);
+            const double x0 = track.x + track.vx * t0, x1 = track.x + track.vx * t1;
+            const double y0 = track.y + track.vy * t0, y1 = track.y + track.vy * t1;
+            const long long ix0 = (long long)std::floor((std::min(x0, x1) - track.radius) / cell);
+            const long long ix1 = (long long)std::floor((std::max(x0, x1) + track.radius) / cell);
+            const long long iy0 = (long long)std::floor((std::min(y0, y1) - track.radius) / cell);
+            const long long iy1 = (long long)std::floor((std::max(y0, y1) + track.radius) / cell);
+            if ((ix1 - ix0 + 1) * (iy1 - iy0 + 1) > MAX_CELLS)
+                break;
+            for (long long ix = ix0; ix <= ix1; ix++)
+            {
+                for (long long iy = iy0; iy <= iy1; iy++)
+                    snapshot->_cells[snapshot->key((ix + 0.5) * cell, (iy + 0.5) * cell, k)].push_back(i);
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _latest = snapshot;
+}
+
+MovingObstacles::ConstPtr MovingObstacles::Latest(double now) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_latest || now - _latest->Stamp() > _max_age)
+        return ConstPtr();
+    return _latest;
+}
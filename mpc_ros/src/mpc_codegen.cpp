@@ -0,0 +1,82 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+// Generates the C derivatives of the MPC model with CppADCodeGen.
+//
+// Writes <library>.so (and the C sources in <library>_sources) for the given
+// parameters. MPC_Node loads it through the mpc_codegen_library parameter;
+// the model name encodes dt, the horizon and the weights, so the library is
+// only used when they match the node configuration, otherwise the CppAD tape
+// is recorded as before.
+//
+// Usage: mpc_codegen <library> [KEY=value ...] [COEFFS=n]
+// KEY is any MPC::LoadParams key (STEPS, DT, W_CTE, ...), COEFFS the number
+// of path polynomial coefficients (4 for the cubic fit of MPC_Node).
+
+#include "MPC.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " <library> [KEY=value ...] [COEFFS=n]" << std::endl;
+        return 1;
+    }
+
+    // Same defaults as the MPC_Node parameters
+    std::map<std::string, double> params;
+    params["DT"]        = 0.1;
+    params["STEPS"]     = 40.0;
+    params["REF_CTE"]   = 0.0;
+    params["REF_ETHETA"] = 0.0;
+    params["REF_V"]     = 1.0;
+    params["W_CTE"]     = 5000.0;
+    params["W_EPSI"]    = 5000.0;
+    params["W_V"]       = 1.0;
+    params["W_ANGVEL"]  = 100.0;
+    params["W_A"]       = 50.0;
+    params["W_DANGVEL"] = 10.0;
+    params["W_DA"]      = 10.0;
+    params["TAPE"]      = 1.0;
+    int n_coeffs = 4;
+
+    for (int i = 2; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        const size_t eq = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            std::cerr << "ignoring argument " << arg << std::endl;
+            continue;
+        }
+        const std::string key = arg.substr(0, eq);
+        const double value = std::atof(arg.substr(eq + 1).c_str());
+        if (key == "COEFFS")
+            n_coeffs = std::max(1, (int)value);
+        else
+            params[key] = value;
+    }
+
+    MPC mpc;
+    mpc.LoadParams(params);
+    return mpc.GenerateModel(argv[1], n_coeffs) ? 0 : 1;
+}
@@ -0,0 +1,342 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+// Side by side benchmark of the tracking controllers, see
+// tracking_controller.h: the MPC of the tracking node, Pure Pursuit and
+// DWA on identical inputs.
+//
+// Usage: mpc_compare [KEY=value ...]
+// By default every controller runs the same closed-loop episodes of
+// mpc_sim (EPISODES=n, 20, and TRAJ, SCALE, SECONDS, OFFSET, HEADING, SEED
+// and the plant keys as there). REPLAY=file instead hands each controller
+// the samples of a trajectory log or CSV (solve_corpus.h, e.g. the
+// assets/*.csv logs) in open loop: the robot at the origin of its frame on
+// the path polynomial of the sample, so there is no tracking error then.
+// KEY is any MPC::LoadParams key or one of the controllers (REF_V is the
+// speed of all three), and
+//
+//   CONTROLLERS=a,b   mpc, pure_pursuit, dwa (all of them)
+//   THREADS=n         episodes side by side (1, the latencies are only
+//                     comparable on an idle core)
+//   CSV=file          one line per controller
+//
+// Each controller runs in a process of its own, so that its peak resident
+// memory can be told apart: the table has it above the one of an idle
+// process. Per control cycle (tick) it has the CPU time of the thread, the
+// wall time percentiles and, with libmpc_alloc_hook preloaded (see
+// alloc_counter.h), the heap allocations.
+//
+// e.g. rosrun mpc_ros mpc_compare EPISODES=40 REF_V=0.5 LATENCY=0.1
+//      rosrun mpc_ros mpc_compare REPLAY=assets/mpc.csv
+
+#include "closed_loop_sim.h"
+#include "solve_corpus.h"
+#include "alloc_counter.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+// What a child process hands back through its pipe
+struct Summary
+{
+    int ticks, episodes, diverged, infeasible;
+    double cpu_ms, wall_p50, wall_p95, wall_p99, wall_max;
+    double cte_rms_p50, cte_rms_p90, cte_max, etheta_rms, speed;
+    double allocs, alloc_bytes; // per tick
+};
+
+static double percentile(std::vector<double> values, double p)
+{
+    if (values.empty())
+        return 0.0;
+    std::sort(values.begin(), values.end());
+    const size_t i = std::min(values.size() - 1, size_t(p * (values.size() - 1) + 0.5));
+    return values[i];
+}
+
+static double threadCpuMs()
+{
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec * 1e-6;
+}
+
+static void closedLoop(const std::map<std::string, double> &params, const PlantConfig &plant,
+                       const std::vector<EpisodeConfig> &runs, int threads, Summary &summary)
+{
+    std::vector<EpisodeResult> results;
+    ClosedLoopSim::RunAll(params, plant, runs, threads, results);
+
+    std::vector<double> wall, cte_rms, etheta_rms, speed;
+    double cpu = 0.0, allocs = 0.0, bytes = 0.0;
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const EpisodeResult &r = results[i];
+        wall.insert(wall.end(), r.solve_ms.begin(), r.solve_ms.end());
+        cte_rms.push_back(r.cte_rms);
+        etheta_rms.push_back(r.etheta_rms);
+        speed.push_back(r.mean_speed);
+        summary.cte_max = std::max(summary.cte_max, r.cte_max);
+        summary.diverged += r.diverged;
+        summary.infeasible += r.infeasible;
+        summary.ticks += r.cycles;
+        cpu += r.cpu_ms_mean * r.cycles;
+        allocs += r.allocs;
+        bytes += r.alloc_bytes;
+    }
+    summary.episodes = (int)results.size();
+    summary.cpu_ms = cpu / std::max(1, summary.ticks);
+    summary.allocs = allocs / std::max(1, summary.ticks);
+    summary.alloc_bytes = bytes / std::max(1, summary.ticks);
+    summary.wall_p50 = percentile(wall, 0.5);
+    summary.wall_p95 = percentile(wall, 0.95);
+    summary.wall_p99 = percentile(wall, 0.99);
+    summary.wall_max = percentile(wall, 1.0);
+    summary.cte_rms_p50 = percentile(cte_rms, 0.5);
+    summary.cte_rms_p90 = percentile(cte_rms, 0.9);
+    summary.etheta_rms = percentile(etheta_rms, 0.5);
+    summary.speed = percentile(speed, 0.5);
+}
+
+// The open loop of REPLAY: the path of a sample as waypoints of its
+// polynomial every 5 cm, the robot at the origin
+static void replay(const std::map<std::string, double> &params, int type, const std::vector<SolveSample> &samples,
+                   Summary &summary)
+{
+    std::unique_ptr<TrackingController> controller = TrackingController::Create(type, params);
+    const double length = controller->PathLength();
+    CompactPath window;
+    std::vector<double> wall;
+    double cpu = 0.0, allocs = 0.0, bytes = 0.0;
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        const Eigen::VectorXd &c = samples[i].coeffs;
+        window.Clear();
+        for (double x = 0.0; x <= length; x += 0.05)
+            window.PushBack(x, PathFit::Eval(c, x), std::atan(c[1] + 2.0 * c[2] * x + 3.0 * c[3] * x * x));
+
+        double speed, angvel;
+        AllocClock alloc;
+        const double cpu0 = threadCpuMs();
+        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        const bool commanded = controller->Command(window, 0.0, 0.0, 0.0, samples[i].state[3], speed, angvel);
+        wall.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+        cpu += threadCpuMs() - cpu0;
+        unsigned long long n;
+        allocs += alloc.Lap(n);
+        bytes += n;
+        if (!commanded || !controller->Feasible())
+            summary.infeasible++;
+    }
+    summary.ticks = (int)samples.size();
+    summary.cpu_ms = cpu / summary.ticks;
+    summary.allocs = allocs / summary.ticks;
+    summary.alloc_bytes = bytes / summary.ticks;
+    summary.wall_p50 = percentile(wall, 0.5);
+    summary.wall_p95 = percentile(wall, 0.95);
+    summary.wall_p99 = percentile(wall, 0.99);
+    summary.wall_max = percentile(wall, 1.0);
+}
+
+// Runs work in a child process, its summary and peak RSS [kB] back
+template <class Work>
+static bool inChild(Work work, Summary &summary, long &max_rss)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+        return false;
+    std::fflush(stdout);
+    const pid_t pid = fork();
+    if (pid < 0)
+        return false;
+    if (pid == 0)
+    {
+        close(fds[0]);
+        Summary s = Summary();
+        work(s);
+        const bool sent = write(fds[1], &s, sizeof(s)) == (ssize_t)sizeof(s);
+        _exit(sent ? 0 : 1);
+    }
+    close(fds[1]);
+    const bool received = read(fds[0], &summary, sizeof(summary)) == (ssize_t)sizeof(summary);
+    close(fds[0]);
+    int status;
+    rusage usage;
+    if (wait4(pid, &status, 0, &usage) != pid)
+        return false;
+    max_rss = usage.ru_maxrss;
+    return received && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+int main(int argc, char **argv)
+{
+    std::map<std::string, double> params = ClosedLoopSim::DefaultParams();
+    PlantConfig plant;
+    int episodes = 20, threads = 1;
+    std::string traj = "all", csv, replay_path, names = "mpc,pure_pursuit,dwa";
+    double scale = 1.0, seconds = 30.0, offset = 0.3, heading = 0.2;
+    unsigned seed = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        const size_t eq = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            std::cerr << "ignoring argument " << arg << std::endl;
+            continue;
+        }
+        const std::string key = arg.substr(0, eq);
+        const std::string text = arg.substr(eq + 1);
+        const double value = std::atof(text.c_str());
+        if (key == "EPISODES")
+            episodes = std::max(1, (int)value);
+        else if (key == "THREADS")
+            threads = std::max(1, (int)value);
+        else if (key == "TRAJ")
+            traj = text;
+        else if (key == "CSV")
+            csv = text;
+        else if (key == "REPLAY")
+            replay_path = text;
+        else if (key == "CONTROLLERS")
+            names = text;
+        else if (key == "SCALE")
+            scale = value;
+        else if (key == "SECONDS")
+            seconds = value;
+        else if (key == "OFFSET")
+            offset = value;
+        else if (key == "HEADING")
+            heading = value;
+        else if (key == "SEED")
+            seed = (unsigned)value;
+        else if (!ClosedLoopSim::SetPlant(key, value, plant))
+            params[key] = value;
+    }
+
+    std::vector<int> types;
+    std::istringstream list(names);
+    std::string name;
+    while (std::getline(list, name, ','))
+    {
+        const int type = TrackingController::Parse(name);
+        if (type < 0)
+        {
+            std::cerr << "unknown controller " << name << std::endl;
+            return 1;
+        }
+        types.push_back(type);
+    }
+
+    std::vector<SolveSample> samples;
+    if (!replay_path.empty())
+    {
+        std::string error;
+        if (!LoadSolveCorpus(replay_path, samples, error))
+        {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+    }
+    const std::vector<EpisodeConfig> runs = ClosedLoopSim::RandomEpisodes(episodes, traj, scale, seconds, offset,
+                                                                           heading, seed);
+
+    Summary idle;
+    long idle_rss = 0;
+    inChild([](Summary &) {}, idle, idle_rss);
+    std::vector<Summary> summaries(types.size());
+    std::vector<long> rss(types.size(), 0);
+    for (size_t k = 0; k < types.size(); k++)
+    {
+        std::map<std::string, double> controller_params = params;
+        controller_params["CONTROLLER"] = types[k];
+        const bool ok = inChild([&](Summary &s) {
+            if (samples.empty())
+                closedLoop(controller_params, plant, runs, threads, s);
+            else
+                replay(controller_params, types[k], samples, s);
+        }, summaries[k], rss[k]);
+        if (!ok)
+        {
+            std::cerr << TrackingController::Name(types[k]) << " failed" << std::endl;
+            return 1;
+        }
+    }
+
+    if (samples.empty())
+        std::printf("%d episodes of %.0f s on %s, REF_V %g, LATENCY %g\n", episodes, seconds, traj.c_str(),
+                    params["REF_V"], plant.latency);
+    else
+        std::printf("%zu samples of %s in open loop\n", samples.size(), replay_path.c_str());
+    std::printf("%-22s", "");
+    for (size_t k = 0; k < types.size(); k++)
+        std::printf("%14s", TrackingController::Name(types[k]));
+    std::printf("\n");
+    const auto row = [&](const char *label, const char *format, double (*field)(const Summary &, long)) {
+        std::printf("%-22s", label);
+        for (size_t k = 0; k < types.size(); k++)
+            std::printf(format, field(summaries[k], rss[k] - idle_rss));
+        std::printf("\n");
+    };
+    row("ticks", "%14.0f", [](const Summary &s, long) { return (double)s.ticks; });
+    row("cpu/tick [ms]", "%14.3f", [](const Summary &s, long) { return s.cpu_ms; });
+    row("latency p50 [ms]", "%14.3f", [](const Summary &s, long) { return s.wall_p50; });
+    row("latency p95 [ms]", "%14.3f", [](const Summary &s, long) { return s.wall_p95; });
+    row("latency p99 [ms]", "%14.3f", [](const Summary &s, long) { return s.wall_p99; });
+    row("latency max [ms]", "%14.3f", [](const Summary &s, long) { return s.wall_max; });
+    row("peak rss [MB]", "%14.1f", [](const Summary &, long kb) { return kb / 1024.0; });
+    if (alloc_counter::Active())
+    {
+        row("allocs/tick", "%14.1f", [](const Summary &s, long) { return s.allocs; });
+        row("alloc kB/tick", "%14.2f", [](const Summary &s, long) { return s.alloc_bytes / 1024.0; });
+    }
+    row("no command", "%14.0f", [](const Summary &s, long) { return (double)s.infeasible; });
+    if (samples.empty())
+    {
+        row("cte rms p50 [m]", "%14.4f", [](const Summary &s, long) { return s.cte_rms_p50; });
+        row("cte rms p90 [m]", "%14.4f", [](const Summary &s, long) { return s.cte_rms_p90; });
+        row("cte max [m]", "%14.4f", [](const Summary &s, long) { return s.cte_max; });
+        row("etheta rms p50 [rad]", "%14.4f", [](const Summary &s, long) { return s.etheta_rms; });
+        row("speed p50 [m/s]", "%14.3f", [](const Summary &s, long) { return s.speed; });
+        row("diverged", "%14.0f", [](const Summary &s, long) { return (double)s.diverged; });
+    }
+
+    if (!csv.empty())
+    {
+        std::ofstream out(csv.c_str());
+        out << "controller,ticks,cpu_ms,latency_p50,latency_p95,latency_p99,latency_max,rss_mb,allocs,alloc_bytes,"
+               "no_command,cte_rms_p50,cte_rms_p90,cte_max,etheta_rms,speed,diverged\n";
+        for (size_t k = 0; k < types.size(); k++)
+        {
+            const Summary &s = summaries[k];
+            out << TrackingController::Name(types[k]) << "," << s.ticks << "," << s.cpu_ms << "," << s.wall_p50
+                << "," << s.wall_p95 << "," << s.wall_p99 << "," << s.wall_max << ","
+                << (rss[k] - idle_rss) / 1024.0 << "," << s.allocs << "," << s.alloc_bytes << "," << s.infeasible
+                << "," << s.cte_rms_p50 << "," << s.cte_rms_p90 << "," << s.cte_max << "," << s.etheta_rms << ","
+                << s.speed << "," << s.diverged << "\n";
+        }
+    }
+    return 0;
+}
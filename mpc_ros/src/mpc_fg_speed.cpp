@@ -0,0 +1,261 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+// Microbenchmark of the MPC derivative kernels, cppad/speed style.
+//
+// Times the operations Ipopt asks of the MPC tape on the mpc_fg_eval
+// kernel (include/mpc_fg_eval.h) for several horizons:
+//
+//   record           CppAD::Independent, FG_eval, Dependent
+//   forward0         zero order Forward(0, x)
+//   sparse_jacobian  SparseJacobianReverse of all rows (TapeSolver's default)
+//   sparse_hessian   SparseHessian of the sum of all rows
+//   analytic_g       the rows by AnalyticSolver's step-vectorized evaluator
+//   analytic_jacobian  its Jacobian, written in the order of its pattern
+//
+// The analytic kernels are the unicycle with Euler steps, so they are only
+// timed where the keys keep the layout of that model (n = 8 steps - 2).
+// Each time is CppAD::time_test's: repeated until TIME_MIN seconds have
+// passed, then divided by the repetitions. The sparsity patterns are
+// computed once per horizon outside the timing, the work vectors keep
+// their colorings over the repetitions as in TapeSolver. The point is
+// drawn with CppAD::uniform_01 from SEED, the path is a fixed cubic.
+//
+// Output is CSV on stdout, one line per kernel and horizon: n variables,
+// m rows, size (tape variables of record and forward0, nonzeros of the
+// derivatives), seconds per call and calls per second. '#' lines before it
+// name the compiler, CppAD, the CPU and LABEL, so that runs of different
+// commits or machines can be concatenated and compared.
+//
+// Usage: mpc_fg_speed [SIZES=10,20,40,80] [TIME_MIN=0.5] [SEED=1]
+//                     [LABEL=name] [KEY=value ...]
+// KEY is any MPC::LoadParams key (DT, INTEGRATOR, PATH_HEADING, ...),
+// OPTIMIZE the tape_optimize level of the derivative kernels (default 1,
+// see tape_optimize.h).
+
+#include "analytic_solver.h"
+#include "mpc_fg_eval.h"
+#include "tape_optimize.h"
+#include <cppad/speed/uniform_01.hpp>
+#include <cppad/utility/time_test.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+typedef CPPAD_TESTVECTOR(double) Dvector;
+typedef CPPAD_TESTVECTOR(CppAD::AD<double>) ADvector;
+
+namespace
+{
+    std::string cpuName()
+    {
+        std::ifstream cpuinfo("/proc/cpuinfo");
+        std::string line;
+        while (std::getline(cpuinfo, line))
+        {
+            if (line.compare(0, 10, "model name") == 0 && line.find(':') != std::string::npos)
+                return line.substr(line.find(':') + 2);
+        }
+        return "unknown";
+    }
+
+    void record(const std::map<std::string, double> &params, const Eigen::VectorXd &coeffs,
+                const Dvector &x, CppAD::ADFun<double> &fun)
+    {
+        ADvector a_x(x.size()), a_fg;
+        for (size_t i = 0; i < x.size(); i++)
+            a_x[i] = x[i];
+        CppAD::Independent(a_x);
+        mpc_fg_eval(params, coeffs, a_x, a_fg);
+        fun.Dependent(a_x, a_fg);
+    }
+
+    void report(const char *kernel, int steps, size_t n, size_t m, size_t size, double seconds)
+    {
+        std::printf("%s,%d,%zu,%zu,%zu,%.9g,%.6g\n", kernel, steps, n, m, size, seconds,
+                    seconds > 0 ? 1.0 / seconds : 0.0);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::map<std::string, double> params;
+    std::vector<int> sizes;
+    sizes.push_back(10);
+    sizes.push_back(20);
+    sizes.push_back(40);
+    sizes.push_back(80);
+    double time_min = 0.5;
+    size_t seed = 1;
+    std::string label;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        const size_t eq = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            std::fprintf(stderr, "usage: %s [SIZES=10,20,40,80] [TIME_MIN=0.5] [SEED=1] [LABEL=name] [KEY=value ...]\n", argv[0]);
+            return 1;
+        }
+        const std::string key = arg.substr(0, eq), value = arg.substr(eq + 1);
+        if (key == "SIZES")
+        {
+            sizes.clear();
+            std::stringstream ss(value);
+            std::string item;
+            while (std::getline(ss, item, ','))
+                sizes.push_back(std::atoi(item.c_str()));
+        }
+        else if (key == "TIME_MIN")
+            time_min = std::atof(value.c_str());
+        else if (key == "SEED")
+            seed = std::strtoul(value.c_str(), NULL, 10);
+        else if (key == "LABEL")
+            label = value;
+        else
+            params[key] = std::atof(value.c_str());
+    }
+    const int optimize = params.count("OPTIMIZE") ? int(params["OPTIMIZE"]) : tape_optimize::STRAIGHT_LINE;
+
+    std::printf("# mpc_fg_speed\n");
+    if (!label.empty())
+        std::printf("# label: %s\n", label.c_str());
+    std::printf("# compiler: %s\n", __VERSION__);
+    std::printf("# cppad: %s\n", CPPAD_PACKAGE_STRING);
+    std::printf("# cpu: %s\n", cpuName().c_str());
+    std::printf("# time_min: %g optimize: %s\n", time_min, tape_optimize::Options(optimize));
+    for (std::map<std::string, double>::const_iterator it = params.begin(); it != params.end(); ++it)
+        std::printf("# %s: %g\n", it->first.c_str(), it->second);
+    std::printf("kernel,steps,n,m,size,seconds,rate\n");
+
+    Eigen::VectorXd coeffs(4);
+    coeffs << 0.1, 0.2, -0.05, 0.01;
+    for (size_t s = 0; s < sizes.size(); s++)
+    {
+        const int steps = sizes[s];
+        if (steps < 2)
+            continue;
+        params["STEPS"] = steps;
+        size_t n, m;
+        mpc_fg_eval_size(params, n, m);
+
+        // Point in [-0.5, 0.5)^n
+        Dvector x(n);
+        CppAD::uniform_01(seed);
+        CppAD::uniform_01(n, x);
+        for (size_t i = 0; i < n; i++)
+            x[i] -= 0.5;
+
+        CppAD::ADFun<double> fun;
+        record(params, coeffs, x, fun);
+        const size_t recorded_var = fun.size_var();
+        double seconds = CppAD::time_test([&](size_t repeat)
+        {
+            CppAD::ADFun<double> f;
+            for (size_t r = 0; r < repeat; r++)
+                record(params, coeffs, x, f);
+        }, time_min);
+        report("record", steps, n, m, recorded_var, seconds);
+
+        tape_optimize::Apply(fun, optimize);
+        seconds = CppAD::time_test([&](size_t repeat)
+        {
+            for (size_t r = 0; r < repeat; r++)
+                fun.Forward(0, x);
+        }, time_min);
+        report("forward0", steps, n, m, fun.size_var(), seconds);
+
+        // Patterns as TapeSolver::Record computes them
+        CppAD::vectorBool r(m * m);
+        for (size_t i = 0; i < m; i++)
+            for (size_t k = 0; k < m; k++)
+                r[i * m + k] = (i == k);
+        const CppAD::vectorBool pattern_jac = fun.RevSparseJac(m, r);
+        CppAD::vectorBool id(n * n), all(m);
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++)
+                id[i * n + j] = (i == j);
+        fun.ForSparseJac(n, id);
+        for (size_t i = 0; i < m; i++)
+            all[i] = true;
+        const CppAD::vectorBool pattern_hes = fun.RevSparseHes(n, all);
+        fun.capacity_order(0);
+
+        CppAD::vector<size_t> row_jac, col_jac, row_hes, col_hes;
+        for (size_t i = 0; i < m; i++)
+            for (size_t j = 0; j < n; j++)
+                if (pattern_jac[i * n + j])
+                {
+                    row_jac.push_back(i);
+                    col_jac.push_back(j);
+                }
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j <= i; j++)
+                if (pattern_hes[i * n + j])
+                {
+                    row_hes.push_back(i);
+                    col_hes.push_back(j);
+                }
+
+        Dvector jac(row_jac.size());
+        CppAD::sparse_jacobian_work work_jac;
+        seconds = CppAD::time_test([&](size_t repeat)
+        {
+            for (size_t r = 0; r < repeat; r++)
+                fun.SparseJacobianReverse(x, pattern_jac, row_jac, col_jac, jac, work_jac);
+        }, time_min);
+        report("sparse_jacobian", steps, n, m, row_jac.size(), seconds);
+
+        Dvector w(m), hes(row_hes.size());
+        for (size_t i = 0; i < m; i++)
+            w[i] = 1.0;
+        CppAD::sparse_hessian_work work_hes;
+        seconds = CppAD::time_test([&](size_t repeat)
+        {
+            for (size_t r = 0; r < repeat; r++)
+                fun.SparseHessian(x, w, pattern_hes, row_hes, col_hes, hes, work_hes);
+        }, time_min);
+        report("sparse_hessian", steps, n, m, row_hes.size(), seconds);
+
+        AnalyticSolver analytic;
+        analytic.LoadParams(params);
+        analytic.Prepare(coeffs);
+        if (analytic.NumVars() == n)
+        {
+            Dvector g(analytic.NumConstraints()), values(analytic.JacobianRows().size());
+            seconds = CppAD::time_test([&](size_t repeat)
+            {
+                for (size_t r = 0; r < repeat; r++)
+                    analytic.Constraints(x.data(), g.data());
+            }, time_min);
+            report("analytic_g", steps, n, g.size(), g.size(), seconds);
+            seconds = CppAD::time_test([&](size_t repeat)
+            {
+                for (size_t r = 0; r < repeat; r++)
+                    analytic.Jacobian(x.data(), values.data());
+            }, time_min);
+            report("analytic_jacobian", steps, n, g.size(), values.size(), seconds);
+        }
+        std::fflush(stdout);
+    }
+    return 0;
+}
@@ -0,0 +1,389 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+// Offline search of the Ipopt options over a recorded solve corpus.
+//
+// Replays the samples of a log or CSV file (see solve_corpus.h) through
+// MPC::Solve under candidate sets of Ipopt options and picks the one with
+// the lowest p99 latency among those whose share of usable solves (success
+// or acceptable point) stays at MIN_SUCCESS or above. The pick goes to an
+// options file that the nodes load with mpc_ipopt_options and apply over
+// their own options on the persistent Ipopt application, see
+// ipopt_options.h.
+//
+// Usage: mpc_ipopt_tune <corpus> [KEY=value ...]
+// KEY is any MPC::LoadParams key (STEPS, DT, TAPE, WARM, LINEAR_SOLVER, ...)
+// as in mpc_solve_bench; use those of the node the file is for.
+//
+//   MODE=halving     successive halving (default): every candidate on the
+//                    first samples, the best 1/ETA of them (ETA=3) on ETA
+//                    times more, ... until the last round runs the corpus
+//   MODE=random      every candidate on the whole corpus
+//   CANDIDATES=n     random candidates (64) besides the defaults
+//   MIN_SUCCESS=f    share of usable solves a candidate has to keep (0.99)
+//   THREADS=n        candidates evaluated side by side (one per core)
+//   SEED=n           of the candidates
+//   OUT=file         options file of the pick, written when it beats the
+//                    defaults
+//
+// The search space is mu_strategy, mu_oracle, nlp_scaling_method (not with
+// SCALING=1, that sets user-scaling), bound_push, bound_frac, mu_init, the
+// warm start pushes (with WARM=1) and the pivot tolerance of the linear
+// solver (MUMPS for LINEAR_SOLVER=default). Each dimension may also stay at
+// the value Solve sets. Candidates running side by side share the memory
+// bandwidth, so the pick and the defaults are measured again alone on the
+// whole corpus for the report and the decision.
+//
+// e.g. rosrun mpc_ros mpc_ipopt_tune /tmp/flight.lg STEPS=20 LINEAR_SOLVER=ma27 OUT=/tmp/ipopt.opt
+
+#include "MPC.h"
+#include "solve_corpus.h"
+#include "ipopt_options.h"
+#include "linear_solver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> Result;
+
+// An option and the values tried, "type name value" lines
+struct Dimension
+{
+    std::string type, name;
+    std::vector<std::string> values;
+};
+
+struct Candidate
+{
+    std::vector<int> choice; // per dimension, -1 leaves the option to Solve
+    std::string options;
+    double p99, mean, success, cost;
+};
+
+static Dimension dimension(const std::string &type, const std::string &name, const std::string &values)
+{
+    Dimension d;
+    d.type = type;
+    d.name = name;
+    std::istringstream list(values);
+    std::string value;
+    while (list >> value)
+        d.values.push_back(value);
+    return d;
+}
+
+static std::vector<Dimension> searchSpace(const std::map<std::string, double> &params)
+{
+    std::vector<Dimension> space;
+    space.push_back(dimension("String", "mu_strategy", "monotone adaptive"));
+    space.push_back(dimension("String", "mu_oracle", "quality-function probing loqo"));
+    if (params.at("SCALING") == 0.0)
+        space.push_back(dimension("String", "nlp_scaling_method", "gradient-based none"));
+    space.push_back(dimension("Numeric", "bound_push", "1e-2 1e-4 1e-6 1e-8"));
+    space.push_back(dimension("Numeric", "bound_frac", "1e-2 1e-4 1e-6"));
+    space.push_back(dimension("Numeric", "mu_init", "1e-1 1e-2 1e-4 1e-6"));
+    if (params.at("WARM") != 0.0)
+    {
+        space.push_back(dimension("Numeric", "warm_start_bound_push", "1e-3 1e-6 1e-9"));
+        space.push_back(dimension("Numeric", "warm_start_mult_bound_push", "1e-3 1e-6 1e-9"));
+        space.push_back(dimension("Numeric", "warm_start_slack_bound_push", "1e-3 1e-6 1e-9"));
+    }
+    switch ((int)params.at("LINEAR_SOLVER"))
+    {
+    case linear_solver::DEFAULT:
+    case linear_solver::MUMPS:
+        space.push_back(dimension("Numeric", "mumps_pivtol", "1e-8 1e-6 1e-4 1e-2"));
+        break;
+    case linear_solver::MA27:
+        space.push_back(dimension("Numeric", "ma27_pivtol", "1e-10 1e-8 1e-6 1e-4"));
+        break;
+    case linear_solver::MA57:
+        space.push_back(dimension("Numeric", "ma57_pivtol", "1e-10 1e-8 1e-6 1e-4"));
+        break;
+    case linear_solver::MA86:
+        space.push_back(dimension("Numeric", "ma86_u", "1e-10 1e-8 1e-6 1e-4"));
+        break;
+    case linear_solver::MA97:
+        space.push_back(dimension("Numeric", "ma97_u", "1e-10 1e-8 1e-6 1e-4"));
+        break;
+    default:
+        break;
+    }
+    return space;
+}
+
+static std::string optionLines(const std::vector<Dimension> &space, const std::vector<int> &choice)
+{
+    std::string options;
+    for (size_t d = 0; d < space.size(); d++)
+    {
+        if (choice[d] >= 0)
+            options += space[d].type + " " + space[d].name + " " + space[d].values[choice[d]] + "\n";
+    }
+    return options;
+}
+
+static double percentile(const std::vector<double> &sorted, double p)
+{
+    if (sorted.empty())
+        return 0.0;
+    // Nearest rank
+    const int k = (int)std::ceil(p * sorted.size()) - 1;
+    return sorted[std::min(std::max(k, 0), (int)sorted.size() - 1)];
+}
+
+// Replays the first n samples in order (warm starts carry over as in a
+// run), the first solve records the tape and is not counted
+static void evaluate(const std::map<std::string, double> &params, const std::vector<SolveSample> &samples,
+                     size_t n, Candidate &c)
+{
+    MPC mpc;
+    mpc.LoadParams(params);
+    mpc.SetIpoptOptions(c.options);
+    mpc.Solve(samples[0].state, samples[0].coeffs);
+
+    std::vector<double> latency;
+    int usable = 0;
+    double cost = 0.0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        mpc.Solve(samples[i].state, samples[i].coeffs);
+        const std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+        latency.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+        if (mpc._mpc_status == Result::success || mpc._mpc_status == Result::stop_at_acceptable_point)
+            usable++;
+        cost += mpc._mpc_totalcost;
+    }
+    std::sort(latency.begin(), latency.end());
+    double sum = 0.0;
+    for (size_t i = 0; i < latency.size(); i++)
+        sum += latency[i];
+    c.p99 = percentile(latency, 0.99);
+    c.mean = sum / n;
+    c.success = (double)usable / n;
+    c.cost = cost / n;
+}
+
+// Feasible ones first, by p99 and then the mean latency
+static bool better(const Candidate &a, const Candidate &b, double min_success)
+{
+    const bool fa = a.success >= min_success, fb = b.success >= min_success;
+    if (fa != fb)
+        return fa;
+    if (!fa)
+        return a.success > b.success;
+    return a.p99 != b.p99 ? a.p99 < b.p99 : a.mean < b.mean;
+}
+
+static void evaluateAll(const std::map<std::string, double> &params, const std::vector<SolveSample> &samples,
+                        size_t n, int threads, std::vector<Candidate> &candidates)
+{
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.push_back(std::thread([&]() {
+            for (size_t i = next++; i < candidates.size(); i = next++)
+                evaluate(params, samples, n, candidates[i]);
+        }));
+    }
+    for (size_t t = 0; t < workers.size(); t++)
+        workers[t].join();
+}
+
+static void printCandidate(const char *label, const Candidate &c)
+{
+    std::printf("%-9s p99 %.3f ms  mean %.3f ms  usable %.4f  cost %.4f\n", label, c.p99, c.mean, c.success, c.cost);
+    std::istringstream lines(c.options);
+    std::string line;
+    while (std::getline(lines, line))
+        std::printf("          %s\n", line.c_str());
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " <corpus> [KEY=value ...] [MODE=halving|random] [CANDIDATES=n] "
+                  << "[MIN_SUCCESS=f] [THREADS=n] [OUT=file]" << std::endl;
+        return 1;
+    }
+
+    // Same defaults as mpc_solve_bench
+    std::map<std::string, double> params;
+    params["DT"]        = 0.1;
+    params["STEPS"]     = 40.0;
+    params["REF_CTE"]   = 0.0;
+    params["REF_ETHETA"] = 0.0;
+    params["REF_V"]     = 1.0;
+    params["W_CTE"]     = 5000.0;
+    params["W_EPSI"]    = 5000.0;
+    params["W_V"]       = 1.0;
+    params["W_ANGVEL"]  = 100.0;
+    params["W_A"]       = 50.0;
+    params["W_DANGVEL"] = 10.0;
+    params["W_DA"]      = 10.0;
+    params["ANGVEL"]    = 3.0;
+    params["MAXTHR"]    = 1.0;
+    params["BOUND"]     = 1.0e3;
+    params["TAPE"]      = 1.0;
+    params["WARM"]      = 1.0;
+    params["SCALING"]   = 0.0;
+    params["LINEAR_SOLVER"] = linear_solver::DEFAULT;
+    std::string mode = "halving", out;
+    int n_candidates = 64, eta = 3;
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    double min_success = 0.99;
+    unsigned seed = 0;
+    std::string args;
+    for (int i = 2; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        const size_t eq = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            std::cerr << "ignoring argument " << arg << std::endl;
+            continue;
+        }
+        const std::string key = arg.substr(0, eq);
+        const std::string text = arg.substr(eq + 1);
+        const double value = std::atof(text.c_str());
+        if (key == "MODE")
+            mode = text;
+        else if (key == "CANDIDATES")
+            n_candidates = std::max(1, (int)value);
+        else if (key == "ETA")
+            eta = std::max(2, (int)value);
+        else if (key == "MIN_SUCCESS")
+            min_success = value;
+        else if (key == "THREADS")
+            threads = std::max(1, (int)value);
+        else if (key == "SEED")
+            seed = (unsigned)value;
+        else if (key == "OUT")
+            out = text;
+        else
+        {
+            if (key == "LINEAR_SOLVER" && linear_solver::Parse(text) >= 0)
+                params[key] = linear_solver::Parse(text);
+            else
+                params[key] = value;
+            args += " " + arg;
+        }
+    }
+    if (mode != "halving" && mode != "random")
+    {
+        std::cerr << "unknown MODE " << mode << std::endl;
+        return 1;
+    }
+
+    std::vector<SolveSample> samples;
+    std::string error;
+    if (!LoadSolveCorpus(argv[1], samples, error))
+    {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+
+    // The defaults of Solve and distinct random points, each dimension
+    // left at its default as often as at any one value
+    const std::vector<Dimension> space = searchSpace(params);
+    std::mt19937 rng(seed);
+    std::vector<Candidate> candidates(1);
+    candidates[0].choice.assign(space.size(), -1);
+    std::map<std::string, bool> seen;
+    seen[""] = true;
+    for (int tries = 0; (int)candidates.size() <= n_candidates && tries < 100 * n_candidates; tries++)
+    {
+        Candidate c;
+        for (size_t d = 0; d < space.size(); d++)
+            c.choice.push_back(std::uniform_int_distribution<int>(-1, (int)space[d].values.size() - 1)(rng));
+        c.options = optionLines(space, c.choice);
+        if (!seen[c.options])
+        {
+            seen[c.options] = true;
+            candidates.push_back(c);
+        }
+    }
+
+    // Rounds of successive halving, the first one on at least 20 samples
+    size_t n = samples.size();
+    int rounds = 1;
+    if (mode == "halving")
+    {
+        for (size_t left = candidates.size(); left > 1 && n / eta >= 20; left = (left + eta - 1) / eta)
+        {
+            n /= eta;
+            rounds++;
+        }
+    }
+    std::printf("%zu samples, %zu candidates over %zu options, %d round(s), %d thread(s)\n",
+                samples.size(), candidates.size(), space.size(), rounds, threads);
+    for (int r = 0; r < rounds; r++)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        evaluateAll(params, samples, n, threads, candidates);
+        std::sort(candidates.begin(), candidates.end(),
+                  [min_success](const Candidate &a, const Candidate &b) { return better(a, b, min_success); });
+        std::printf("round %d: %zu on %zu samples, best p99 %.3f ms usable %.4f (%.1f s)\n", r, candidates.size(), n,
+                    candidates[0].p99, candidates[0].success,
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count());
+        if (r + 1 < rounds)
+        {
+            candidates.resize((candidates.size() + eta - 1) / eta);
+            n = r + 2 == rounds ? samples.size() : n * eta;
+        }
+    }
+
+    // The pick and the defaults again, alone
+    Candidate pick = candidates[0], defaults;
+    defaults.choice.assign(space.size(), -1);
+    evaluate(params, samples, samples.size(), pick);
+    evaluate(params, samples, samples.size(), defaults);
+    printCandidate("defaults", defaults);
+    printCandidate("pick", pick);
+    if (pick.options.empty() || pick.success < min_success || !better(pick, defaults, min_success))
+    {
+        std::printf("no candidate beats the defaults, keep them\n");
+        return 2;
+    }
+    if (!out.empty())
+    {
+        std::ostringstream header;
+        header << "mpc_ipopt_tune " << argv[1] << args << "\n"
+               << "p99 " << pick.p99 << " ms (defaults " << defaults.p99 << "), usable " << pick.success
+               << " of " << samples.size() << " solves";
+        if (!ipopt_options::Write(out, pick.options, header.str()))
+        {
+            std::cerr << "cannot write " << out << std::endl;
+            return 1;
+        }
+        std::printf("wrote %s\n", out.c_str());
+    }
+    return 0;
+}
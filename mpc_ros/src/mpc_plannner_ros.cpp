@@ -15,7 +15,15 @@
  */
 
 #include "mpc_plannner_ros.h"
+#include "linear_solver.h"
+#include "alloc_counter.h"
+#include "perf_counters.h"
+#include "energy_meter.h"
+#include "trace_span.h"
+#include <costmap_2d/footprint.h>
 #include <pluginlib/class_list_macros.h>
+#include <condition_variable>
+#include <mutex>
 
 using namespace std;
 using namespace Eigen;
@@ -24,9 +32,103 @@ PLUGINLIB_EXPORT_CLASS(mpc_ros::MPCPlannerROS, nav_core::BaseLocalPlanner)
 
 namespace mpc_ros{
 
-    MPCPlannerROS::MPCPlannerROS() : costmap_ros_(NULL), tf_(NULL), initialized_(false) {}
+    // Allocations of the stage that just ended into stats, see alloc_counter.h
+    static void lapAllocs(AllocClock &allocs, mpc_ros::MPCStats &stats, size_t stage)
+    {
+        if(stage >= stats.stage_allocs.size())
+            return;
+        unsigned long long bytes;
+        stats.stage_allocs[stage] = allocs.Lap(bytes);
+        stats.stage_alloc_bytes[stage] = bytes;
+    }
+
+    // Hardware counters of the stage that just ended into stats, see perf_counters.h
+    static perf_counters::Counts lapPerf(PerfClock &perf, mpc_ros::MPCStats &stats, size_t stage)
+    {
+        const perf_counters::Counts lap = perf.Lap();
+        if(stage < stats.stage_cycles.size())
+        {
+            stats.stage_cycles[stage] = lap.value[perf_counters::CYCLES];
+            stats.stage_instructions[stage] = lap.value[perf_counters::INSTRUCTIONS];
+            stats.stage_cache_misses[stage] = lap.value[perf_counters::CACHE_MISSES];
+            stats.stage_branch_misses[stage] = lap.value[perf_counters::BRANCH_MISSES];
+        }
+        return lap;
+    }
+
+    // Energy of the stage that just ended into stats, see energy_meter.h
+    static double lapEnergy(EnergyClock &energy, mpc_ros::MPCStats &stats, size_t stage)
+    {
+        const double lap = energy.Lap();
+        if(stage < stats.stage_energy_j.size())
+        {
+            stats.stage_energy_j[stage] = lap;
+            stats.energy_j += lap;
+        }
+        return lap;
+    }
+
+    // The energy of the solve stage split like splitSolvePerf, by the time
+    // of the callbacks: the meter updates too seldom to read it per callback
+    static void splitSolveEnergy(double solve, double solve_ms, const TapeProfile &profile, mpc_ros::MPCStats &stats)
+    {
+        if(solve_ms <= 0.0)
+            return;
+        const double parts[3] = {
+            profile.callback_ms[TapeProfile::EVAL_F] + profile.callback_ms[TapeProfile::EVAL_G],
+            profile.callback_ms[TapeProfile::EVAL_GRAD_F] + profile.callback_ms[TapeProfile::EVAL_JAC_G],
+            profile.callback_ms[TapeProfile::EVAL_H] };
+        double rest = solve;
+        for(int k = 0; k < 3; k++)
+        {
+            stats.solve_energy_j[k] = solve * std::min(1.0, parts[k] / solve_ms);
+            rest -= stats.solve_energy_j[k];
+        }
+        stats.solve_energy_j[3] = std::max(0.0, rest);
+    }
+
+    // The solve stage split into the callbacks of the tape backend and the rest
+    static void splitSolvePerf(const perf_counters::Counts &solve, const TapeProfile &profile, mpc_ros::MPCStats &stats)
+    {
+        perf_counters::Counts parts[4];
+        parts[0] = profile.callback_perf[TapeProfile::EVAL_F];
+        parts[0] += profile.callback_perf[TapeProfile::EVAL_G];
+        parts[1] = profile.callback_perf[TapeProfile::EVAL_GRAD_F];
+        parts[1] += profile.callback_perf[TapeProfile::EVAL_JAC_G];
+        parts[2] = profile.callback_perf[TapeProfile::EVAL_H];
+        parts[3] = solve - parts[0] - parts[1] - parts[2];
+        for(int k = 0; k < 4; k++)
+        {
+            stats.solve_cycles[k] = parts[k].value[perf_counters::CYCLES];
+            stats.solve_instructions[k] = parts[k].value[perf_counters::INSTRUCTIONS];
+            stats.solve_cache_misses[k] = parts[k].value[perf_counters::CACHE_MISSES];
+            stats.solve_branch_misses[k] = parts[k].value[perf_counters::BRANCH_MISSES];
+        }
+    }
+
+    // Inputs a cycle follows for the solver thread: its command first, then
+    // the rest of angvels/accels after begin, or only the command without them
+    static void fillCommand(MPCCommand &cmd, double stamp, double step, double speed, double angvel, double max_speed,
+                            const std::vector<double> *angvels, const std::vector<double> *accels, size_t begin)
+    {
+        cmd.stamp = stamp;
+        cmd.dt = step;
+        cmd.step_dt.clear();
+        cmd.speed.assign(1, speed);
+        cmd.angvel.assign(1, angvel);
+        if(!angvels || !accels)
+            return;
+        for(size_t i = begin + 1; i < angvels->size() && i < accels->size(); i++)
+        {
+            speed += (*accels)[i] * step;
+            cmd.speed.push_back(max(0.0, min(speed, max_speed)));
+            cmd.angvel.push_back((*angvels)[i]);
+        }
+    }
+
+    MPCPlannerROS::MPCPlannerROS() : costmap_ros_(NULL), tf_(NULL), initialized_(false), _mpc(NULL), _active_profile(0), _requested_profile(0) {}
 	MPCPlannerROS::MPCPlannerROS(std::string name, tf2_ros::Buffer* tf, costmap_2d::Costmap2DROS* costmap_ros)
-    : costmap_ros_(NULL), tf_(NULL), initialized_(false)
+    : costmap_ros_(NULL), tf_(NULL), initialized_(false), _mpc(NULL), _active_profile(0), _requested_profile(0)
     {
         // initialize planner
         initialize(name, tf, costmap_ros);
@@ -36,8 +138,8 @@ namespace mpc_ros{
 	void MPCPlannerROS::initialize(std::string name, tf2_ros::Buffer* tf, costmap_2d::Costmap2DROS* costmap_ros){
 
         ros::NodeHandle private_nh("~/" + name);
-        g_plan_pub_ = private_nh.advertise<nav_msgs::Path>("global_plan", 1);
-        l_plan_pub_ = private_nh.advertise<nav_msgs::Path>("local_plan", 1);
+        g_plan_pub_.Advertise(private_nh, "global_plan");
+        l_plan_pub_.Advertise(private_nh, "local_plan");
 
 		tf_ = tf;
 		costmap_ros_ = costmap_ros;
@@ -49,10 +151,8 @@ namespace mpc_ros{
         
         planner_util_.initialize(tf, costmap_, costmap_ros_->getGlobalFrameID());
         
-        if( private_nh.getParam( "odom_frame", _odom_frame ))
-        {
-            odom_helper_.setOdomTopic( _odom_frame );
-        }
+        // odom_helper_ gets the messages of _sub_odom, see odomCB, instead of
+        // a second subscription to the same stream
 
         //Assuming this planner is being run within the navigation stack, we can
         //just do an upward search for the frequency at which its being run. This
@@ -78,11 +178,208 @@ namespace mpc_ros{
         private_nh.param<std::string>("odom_frame", _odom_frame, "odom");
         private_nh.param<std::string>("base_frame", _base_frame, "base_footprint");
 
+        // setPlan reuses the last transform this long when TF drops out [s]
+        double tf_max_age;
+        private_nh.param("tf_max_age", tf_max_age, 0.5);
+        _tf_cache.SetMaxAge(tf_max_age);
+        _tf_cache.AdvertiseDiagnostics(private_nh, private_nh.getNamespace());
+        _tf_cache.SetMetrics(&_metrics.Metrics());
+
+        // Controller health on /diagnostics, Prometheus metrics on HTTP if metrics_port > 0
+        double metrics_period;
+        int metrics_port;
+        private_nh.param("metrics_period", metrics_period, 1.0);
+        private_nh.param("metrics_port", metrics_port, 0);
+        _metrics.Start(private_nh, private_nh.getNamespace(), metrics_period, metrics_port);
+
+        // Spans of the cycle, the odometry callback and the solver callbacks
+        // as Chrome trace JSON, relative to the working directory of move_base
+        private_nh.param<std::string>("trace_path", _trace_path, "mpc_trace.json");
+        if(trace_span::Enabled())
+            _srv_trace = private_nh.advertiseService("write_trace", &MPCPlannerROS::writeTraceCB, this);
+
+        // Ipopt linear solver, mpc_solve_bench_planner LINEAR_SWEEP=1 compares them offline
+        std::string linear_solver_name;
+        int linear_threads;
+        private_nh.param<std::string>("linear_solver", linear_solver_name, "");
+        private_nh.param("linear_order", _linear_order, -1);
+        private_nh.param("linear_threads", linear_threads, 0);
+        _linear_solver = linear_solver::Parse(linear_solver_name);
+        if(_linear_solver < 0)
+        {
+            ROS_WARN_NAMED("mpc_ros", "Unknown linear_solver %s, using Ipopt's default.", linear_solver_name.c_str());
+            _linear_solver = linear_solver::DEFAULT;
+        }
+        linear_solver::SetThreads(linear_threads);
+
+        // 0 frees the Taylor coefficients of the tapes after every solve, for
+        // robots short of memory, at the price of allocating them again
+        private_nh.param("taylor_capacity", _taylor_capacity, -1);
+        private_nh.param("sparsity", _sparsity, -1);
+
+        // Exact Hessians kept over a few Ipopt iterations while the iterate
+        // and the multipliers hardly move, see TapeSolver::SetHessianReuse()
+        private_nh.param("hessian_reuse", _hessian_reuse, 0);
+        private_nh.param("hessian_reuse_step", _hessian_reuse_step, 0.05);
+        private_nh.param("hessian_reuse_lambda", _hessian_reuse_lambda, 0.1);
+
+        // Cycles, instructions, cache and branch misses per stage in ~mpc_stats
+        bool perf;
+        private_nh.param("perf_counters", perf, false);
+        if(perf && !perf_counters::Enable())
+            ROS_WARN_NAMED("mpc_ros", "Cannot open the hardware counters, check kernel.perf_event_paranoid.");
+
+        // Joules per cycle and per stage in ~mpc_stats, from RAPL, the perf
+        // power PMU or a hwmon rail, or from energy_source if set
+        bool energy;
+        std::string energy_source;
+        private_nh.param("energy_meter", energy, false);
+        private_nh.param<std::string>("energy_source", energy_source, "");
+        if(energy && !energy_meter::Enable(energy_source))
+            ROS_WARN_NAMED("mpc_ros", "No readable energy counter (RAPL needs root since Linux 5.10).");
+        else if(energy)
+            ROS_INFO_NAMED("mpc_ros", "Energy metering from %s.", energy_meter::Name());
+
+        // Solve on a thread of the plugin, computeVelocityCommands() only
+        // samples the last plan and fails once it is older than async_max_age [s]
+        private_nh.param("async_solve", _async_solve, false);
+        private_nh.param("async_max_age", _async_max_age, 0.5);
+        // setPlan stops the solve running on the old plan
+        private_nh.param("cancel_on_replan", _cancel_on_replan, true);
+        // Solver state kept across restarts of move_base, empty for none;
+        // a warm start older than snapshot_max_age [s] is dropped
+        private_nh.param<std::string>("snapshot_file", _snapshot_file, "");
+        private_nh.param("snapshot_every", _snapshot_every, 10);
+        private_nh.param("snapshot_max_age", _snapshot_max_age, 2.0);
+        _snapshot_cycle = 0;
+        // Horizon and Ipopt tolerance from the solve time predicted by a
+        // model fitted online to the past solves
+        private_nh.param("predict_solve_time", _predict_solve_time, false);
+        private_nh.param("predict_forget", _predict_forget, 0.98);
+        _snapshot_read = _snapshot_file.empty();
+        _request_params = false;
+        _request_new_plan = false;
+
+        // Fleet mode: publish the prediction for the other robots of the
+        // fleet and keep the separation from theirs, see neighbor_plans.h
+        int fleet_id;
+        double fleet_range, fleet_max_age;
+        std::string fleet_topic;
+        private_nh.param("fleet", _fleet, false);
+        private_nh.param<std::string>("fleet_topic", fleet_topic, "/mpc_fleet");
+        private_nh.param<std::string>("fleet_frame", _fleet_frame, _map_frame); // shared by the fleet
+        private_nh.param("fleet_id", fleet_id, -1); // unique in the fleet, -1 hashes the namespace
+        private_nh.param("fleet_radius", _fleet_radius, -1.0); // -1 takes the circumscribed radius of the footprint [m]
+        private_nh.param("fleet_margin", _fleet_margin, 0.2); // between two footprints [m]
+        private_nh.param("fleet_range", fleet_range, 4.0); // robots farther away are not looked at [m]
+        private_nh.param("fleet_max_age", fleet_max_age, 1.0); // oldest plan of another robot that is kept [s]
+        _fleet_id = fleet_id >= 0 ? (unsigned int)fleet_id : (unsigned int)std::hash<std::string>()(private_nh.getNamespace());
+        if(_fleet_radius < 0)
+        {
+            double inscribed;
+            costmap_2d::calculateMinAndMaxDistances(footprint_spec_, inscribed, _fleet_radius);
+        }
+        _neighbors.Configure(fleet_range, fleet_max_age);
+        _fleet_valid = false;
+        _fleet_c = 1.0;
+        _fleet_s = _fleet_tx = _fleet_ty = 0.0;
+        _fleet_stamp = 0.0;
+        if(_fleet)
+        {
+            _pub_fleet = _nh.advertise<mpc_ros::FleetTrajectory>(fleet_topic, 10);
+            _sub_fleet = _nh.subscribe(fleet_topic, 50, &MPCPlannerROS::fleetCB, this);
+        }
+
+        // People and forklifts of a tracker, at constant velocity over the
+        // horizon, see moving_obstacles.h
+        std::string moving_topic;
+        double moving_cell, moving_slice, moving_horizon, moving_max_age;
+        private_nh.param("moving_obstacles", _moving_obstacles, false);
+        private_nh.param<std::string>("moving_obstacles_topic", moving_topic, "tracked_obstacles");
+        private_nh.param<std::string>("moving_frame", _moving_frame, _map_frame); // of the tracks
+        private_nh.param("moving_margin", _moving_margin, 0.3); // kept from a track besides its radius [m]
+        private_nh.param("moving_cell", moving_cell, 2.0); // hash cells, and so the reach of a step [m]
+        private_nh.param("moving_slice", moving_slice, 0.5); // time of one hash layer [s]
+        private_nh.param("moving_horizon", moving_horizon, 5.0); // tracks are predicted this far [s]
+        private_nh.param("moving_max_age", moving_max_age, 0.5); // oldest set of tracks that is used [s]
+        _moving.Configure(moving_cell, moving_slice, moving_horizon, moving_max_age);
+        _moving_c = 1.0;
+        _moving_s = _moving_tx = _moving_ty = 0.0;
+        _moving_stamp = 0.0;
+        if(_moving_obstacles)
+            _sub_moving = _nh.subscribe(moving_topic, 1, &MPCPlannerROS::movingCB, this);
+
+        // Obstacles from the laser scan itself, a costmap update earlier,
+        // see scan_circles.h
+        std::string scan_topic;
+        double scan_max_gap, scan_max_radius, scan_max_range;
+        int scan_max_circles;
+        private_nh.param("scan_obstacles", _scan_obstacles, false);
+        private_nh.param<std::string>("scan_topic", scan_topic, "scan");
+        private_nh.param("scan_max_gap", scan_max_gap, 0.2); // between the points of one obstacle [m]
+        private_nh.param("scan_max_radius", scan_max_radius, 0.5); // longer runs are split [m]
+        private_nh.param("scan_max_range", scan_max_range, 4.0); // [m]
+        private_nh.param("scan_max_circles", scan_max_circles, 16); // the closest ones are kept
+        private_nh.param("scan_max_age", _scan_max_age, 0.3); // older scans are ignored [s]
+        _scan_circles.Configure(scan_max_gap, scan_max_radius, scan_max_range, scan_max_circles);
+        _scan_valid = false;
+        if(_scan_obstacles)
+            _sub_scan = _nh.subscribe(scan_topic, 1, &MPCPlannerROS::scanCB, this);
+
+        // Corridor constraints: a convex polygon of free space per step of
+        // the horizon, grown in the local costmap, see free_corridor.h
+        int corridor_faces;
+        double corridor_margin;
+        private_nh.param("corridor", _corridor, false);
+        private_nh.param("corridor_faces", corridor_faces, 6); // half-planes per step, 3 to 8
+        private_nh.param("corridor_range", _corridor_range, 1.5); // obstacles around each step [m]
+        private_nh.param("corridor_margin", corridor_margin, 0.05); // kept from the inscribed cells [m]
+        _free_corridor.Configure(corridor_faces, _corridor_range, corridor_margin);
+
+        // Window of the costmap copied once per cycle for the solver thread
+        private_nh.param("costmap_roi_radius", _roi_radius, 0.0); // half size, 0 takes the reach of the horizon [m]
+
+        // Reference speed of every step from the curvature of the plan and
+        // the limits of the robot instead of ref_vel, see speed_profile.h
+        private_nh.param("speed_profile", _curvature_speed, false);
+        private_nh.param("speed_profile_lat_accel", _profile_lat_accel, 0.5); // [m/s^2]
+        private_nh.param("speed_profile_accel", _profile_accel, -1.0); // -1 takes max_throttle [m/s^2]
+        private_nh.param("speed_profile_window", _profile_window, 0.3); // of the curvature [m]
+        private_nh.param("speed_profile_end_speed", _profile_end_speed, 0.0); // at the goal [m/s]
+        // A mission executive may publish the plan of the next goal on
+        // ~next_plan ahead of time, its profile is then computed meanwhile
+        private_nh.param("prefetch_next_plan", _prefetch_plans, false);
+        if(_curvature_speed && _prefetch_plans)
+        {
+            _plan_prefetch.Start();
+            _sub_next_plan = private_nh.subscribe("next_plan", 1, &MPCPlannerROS::nextPlanCB, this);
+        }
+
+        // Near the goal the MPC hands over to analytic laws and the solver
+        // is suspended: pure pursuit for the approach, stop-rotate, standstill
+        ModeArbiter::Config arbiter;
+        private_nh.param("mode_arbiter", _arbitrate_modes, false);
+        private_nh.param("approach_dist", arbiter.approach_dist, 0.5); // plan length left to the goal, <= 0 keeps the MPC to the goal position [m]
+        private_nh.param("approach_hysteresis", arbiter.hysteresis, 0.2); // the MPC takes over again beyond approach_dist + this [m]
+        private_nh.param("approach_min_cycles", arbiter.min_cycles, 5); // shortest stay in a mode
+        private_nh.param("approach_lookahead", arbiter.lookahead, 0.3); // of the approach pure pursuit [m]
+        private_nh.param("approach_accel", arbiter.approach_accel, 0.5); // braking to the goal [m/s^2]
+        _mode_arbiter.Configure(arbiter);
+
+        // Worker threads the fallback scoring runs on instead of a pool of
+        // its own, see executor.h
+        Executor::QueueConfig executor[Executor::NUM_QUEUES];
+        private_nh.param("executor_control_threads", executor[Executor::CONTROL].threads, 0); // 0: hybrid_threads of its own
+        private_nh.param("executor_control_priority", executor[Executor::CONTROL].priority, 0); // SCHED_FIFO priority of its workers
+        private_nh.param("executor_control_cpus", executor[Executor::CONTROL].cpus, std::string("")); // CPUs of its workers, e.g. "2,3"
+        _executor.Configure(executor);
+
 
         //Publishers and Subscribers
         _sub_odom   = _nh.subscribe("odom", 1, &MPCPlannerROS::odomCB, this);
-        _pub_mpctraj   = _nh.advertise<nav_msgs::Path>("mpc_trajectory", 1);// MPC trajectory output
-        _pub_odompath  = _nh.advertise<nav_msgs::Path>("mpc_reference", 1); // reference path for MPC ///mpc_reference 
+        _pub_mpctraj.Advertise(_nh, "mpc_trajectory");// MPC trajectory output
+        _pub_odompath.Advertise(_nh, "mpc_reference"); // reference path for MPC ///mpc_reference 
+        _pub_stats     = private_nh.advertise<mpc_ros::MPCStats>("mpc_stats", 1); // per-stage timing and solver statistics
         
 
         //Init variables
@@ -92,16 +389,179 @@ namespace mpc_ros{
 
         //_ackermann_msg = ackermann_msgs::AckermannDriveStamped();
         _twist_msg = geometry_msgs::Twist();
-        _mpc_traj = nav_msgs::Path();
 
+        _publish_stats = false;
+        _deadline_mode = false;
+        _adaptive_horizon = false;
+        _min_steps = 10;
+        _horizon_preview = 1.0;
+        _prev_plan_dt = 0.0;
+        _cycle_overhead = 0.0;
+        _latency_compensation = false;
+        _obstacle_avoidance = false;
+        _obstacle_clearance = 0.3;
+        _w_obstacle = 1000.0;
+        _check_footprint = false;
+        _safe_step = 0;
+        _event_stamp = 0.0;
+        _event_dt = _dt;
+        _hybrid_fallback = false;
+        _hybrid_v_samples = 5;
+        _hybrid_w_samples = 11;
+        _hybrid_threads = 0;
+        _hybrid_v_range = 0.2;
+        _hybrid_w_range = 0.8;
+        _hybrid_sim_time = 1.5;
+
+        // Critics of the hybrid mode, scored together by scored_sampling_planner_
+        _hybrid_obstacle_costs.reset(new base_local_planner::ObstacleCostFunction(costmap_));
+        _hybrid_path_costs.reset(new base_local_planner::MapGridCostFunction(costmap_, 0.0, 0.0, false));
+        _hybrid_goal_costs.reset(new base_local_planner::MapGridCostFunction(costmap_, 0.0, 0.0, true));
+        std::vector<base_local_planner::TrajectoryCostFunction*> critics;
+        critics.push_back(_hybrid_obstacle_costs.get());
+        critics.push_back(_hybrid_path_costs.get());
+        critics.push_back(_hybrid_goal_costs.get());
+        std::vector<base_local_planner::TrajectorySampleGenerator*> generators(1, &generator_);
+        scored_sampling_planner_ = base_local_planner::SimpleScoredSamplingPlanner(generators, critics);
         
+        loadProfiles(private_nh);
         dsrv_ = new dynamic_reconfigure::Server<MPCPlannerConfig>(private_nh);
         dynamic_reconfigure::Server<MPCPlannerConfig>::CallbackType cb = boost::bind(&MPCPlannerROS::reconfigureCB, this, _1, _2);
         dsrv_->setCallback(cb);
 
+        // Record the tapes while move_base waits for the first plan, the
+        // first control cycle is then as fast as the next ones. Every
+        // profile is prepared, the configured parameters last.
+        for(size_t k = _profiles.size(); k-- > 0; )
+        {
+            _active_profile = k;
+            _mpc = _profiles[k].mpc.get();
+            applyMpcParams();
+            _mpc->Prepare(4, obstacleTerm(), _corridor ? _free_corridor.Faces() : 0, _curvature_speed);
+        }
+        if(_async_solve)
+            _solver_thread.Start(std::bind(&MPCPlannerROS::solveAsync, this, std::placeholders::_1));
+
         initialized_ = true;
     }
 
+    void MPCPlannerROS::applyMpcParams()
+    {
+        //Init parameters for MPC object
+        const map<string, double> previous = _mpc_params;
+        _mpc_params["DT"] = _dt;
+        //_mpc_params["LF"] = _Lf;
+        _mpc_params["STEPS"]    = _mpc_steps;
+        _mpc_params["REF_CTE"]  = _ref_cte;
+        _mpc_params["REF_ETHETA"] = _ref_etheta;
+        _mpc_params["REF_V"]    = _ref_vel;
+        _mpc_params["W_CTE"]    = _w_cte;
+        _mpc_params["W_EPSI"]   = _w_etheta;
+        _mpc_params["W_V"]      = _w_vel;
+        _mpc_params["W_ANGVEL"]  = _w_angvel;
+        _mpc_params["W_A"]      = _w_accel;
+        _mpc_params["W_DANGVEL"] = _w_angvel_d;
+        _mpc_params["W_DA"]     = _w_accel_d;
+        _mpc_params["ANGVEL"]   = _max_angvel;
+        _mpc_params["MAXTHR"]   = _max_throttle;
+        _mpc_params["BOUND"]    = _bound_value;
+        _mpc_params["TAPE"]     = _persistent_tape;
+        _mpc_params["WARM"]     = _warm_start;
+        // etheta integrated from the turn rate, the model of this planner
+        _mpc_params["PATH_HEADING"] = 0;
+        // The obstacle term and the corridor are only part of the CppAD
+        // model, the fleet separation and the scan are more obstacles
+        const bool obstacles = obstacleTerm() || _corridor;
+        if(obstacles && (_rti || _analytic || _hypotheses > 1))
+            ROS_WARN_NAMED("mpc_ros", "obstacle_avoidance, fleet, scan_obstacles and corridor run on the CppAD model, rti, analytic and hypotheses are ignored.");
+        _mpc_params["RTI"]      = _rti && !obstacles;
+        _mpc_params["ANALYTIC"] = _analytic && !obstacles;
+        _mpc_params["HESSIAN"]  = _hessian;
+        _mpc_params["HYPOTHESES"] = obstacles ? 1 : _hypotheses;
+        _mpc_params["LINEAR_SOLVER"] = _linear_solver;
+        _mpc_params["LINEAR_ORDER"] = _linear_order;
+        _mpc_params["TAYLOR_CAPACITY"] = _taylor_capacity;
+        _mpc_params["HESSIAN_REUSE"] = _hessian_reuse;
+        _mpc_params["HESSIAN_REUSE_STEP"] = _hessian_reuse_step;
+        _mpc_params["HESSIAN_REUSE_LAMBDA"] = _hessian_reuse_lambda;
+        _speed_profile.Configure(_ref_vel, _max_angvel, _profile_lat_accel,
+                                 _profile_accel > 0 ? _profile_accel : _max_throttle, _profile_window, _profile_end_speed);
+        _plan_prefetch.Configure(_ref_vel, _max_angvel, _profile_lat_accel,
+                                 _profile_accel > 0 ? _profile_accel : _max_throttle, _profile_window, _profile_end_speed);
+        _mpc_params["SPARSITY"] = _sparsity;
+        _mpc_params["W_OBS"]    = _w_obstacle;
+        _mpc_params["CLEARANCE"] = _obstacle_clearance;
+        _mpc_params["ADAPTIVE"] = _adaptive_horizon;
+        _mpc_params["MIN_STEPS"] = _min_steps;
+        _mpc_params["HORIZON_PREVIEW"] = _horizon_preview;
+        _mpc_params["PREDICT"] = _predict_solve_time;
+        _mpc_params["PREDICT_FORGET"] = _predict_forget;
+        const map<string, double> &profile = _profiles[_active_profile].params;
+        for(map<string, double>::const_iterator it = profile.begin(); it != profile.end(); ++it)
+            _mpc_params[it->first] = it->second;
+        _mpc->LoadParams(_mpc_params);
+        _mpc->SetMoveBlocks(ParseMoveBlocks(_move_blocks));
+        if(_mpc_params != previous || _move_blocks != _cached_move_blocks)
+            _solution_cache.Invalidate();
+        _cached_move_blocks = _move_blocks;
+    }
+
+    // ~profiles maps a name to MPC::LoadParams keys and their values, e.g.
+    //   profiles: {docking: {STEPS: 10, W_CTE: 8000, REF_V: 0.2}}
+    void MPCPlannerROS::loadProfiles(ros::NodeHandle &private_nh)
+    {
+        _profiles.clear();
+        _profiles.push_back(SolverProfile());
+        _profiles[0].name = "default";
+        XmlRpc::XmlRpcValue profiles;
+        if(private_nh.getParam("profiles", profiles) && profiles.getType() == XmlRpc::XmlRpcValue::TypeStruct)
+        {
+            for(XmlRpc::XmlRpcValue::iterator it = profiles.begin(); it != profiles.end(); ++it)
+            {
+                if(it->second.getType() != XmlRpc::XmlRpcValue::TypeStruct)
+                {
+                    ROS_WARN_NAMED("mpc_ros", "Profile %s is not a map of parameters, skipped.", it->first.c_str());
+                    continue;
+                }
+                SolverProfile profile;
+                profile.name = it->first;
+                for(XmlRpc::XmlRpcValue::iterator p = it->second.begin(); p != it->second.end(); ++p)
+                {
+                    XmlRpc::XmlRpcValue &value = p->second;
+                    if(value.getType() == XmlRpc::XmlRpcValue::TypeDouble)
+                        profile.params[p->first] = static_cast<double>(value);
+                    else if(value.getType() == XmlRpc::XmlRpcValue::TypeInt)
+                        profile.params[p->first] = static_cast<int>(value);
+                    else if(value.getType() == XmlRpc::XmlRpcValue::TypeBoolean)
+                        profile.params[p->first] = static_cast<bool>(value);
+                    else
+                        ROS_WARN_NAMED("mpc_ros", "Profile %s: %s is not a number, skipped.", it->first.c_str(), p->first.c_str());
+                }
+                _profiles.push_back(std::move(profile));
+            }
+        }
+        for(size_t k = 0; k < _profiles.size(); k++)
+            _profiles[k].mpc.reset(new MPC());
+        _active_profile = 0;
+        _requested_profile = 0;
+        _mpc = _profiles[0].mpc.get();
+    }
+
+    // On the thread that solves, between two solves: the solver of the
+    // requested profile is already prepared, it only takes the warm start
+    void MPCPlannerROS::switchProfile()
+    {
+        const int next = _requested_profile.load();
+        if(next == _active_profile)
+            return;
+        const MPC *previous = _mpc;
+        _active_profile = next;
+        _mpc = _profiles[next].mpc.get();
+        applyMpcParams();
+        _mpc->AdoptWarmStart(*previous);
+        ROS_INFO_NAMED("mpc_ros", "Parameter profile %s.", _profiles[next].name.c_str());
+    }
+
   void MPCPlannerROS::reconfigureCB(MPCPlannerConfig &config, uint32_t level) {
       // update generic local planner params
       base_local_planner::LocalPlannerLimits limits;
@@ -126,9 +586,13 @@ namespace mpc_ros{
       //Parameter for MPC solver
       _debug_info = config.debug_info;
       _delay_mode = config.delay_mode;
+      _latency_compensation = config.latency_compensation;
+      _latency.Configure(config.latency_percentile, config.actuation_latency, config.max_latency);
       _max_speed = config.max_speed;
       _waypointsDist = config.waypoints_dist;
       _pathLength = config.path_length;
+      if(_waypointsDist > 0.0) // otherwise measured on the plan
+          _downSampling = int(_pathLength/10.0/_waypointsDist);
       _mpc_steps = config.steps;
       _ref_cte = config.ref_cte;
       _ref_vel = config.ref_vel;
@@ -143,6 +607,55 @@ namespace mpc_ros{
       _max_angvel = config.max_angvel;
       _max_throttle = config.max_throttle;
       _bound_value = config.bound_value;
+      _persistent_tape = config.persistent_tape;
+      _warm_start = config.warm_start;
+      _rti = config.rti;
+      _analytic = config.analytic;
+      _hessian = config.hessian;
+      _hypotheses = config.hypotheses;
+      _publish_stats = config.publish_stats;
+      _deadline_mode = config.deadline_mode;
+      _event_trigger.Configure(config.event_trigger, config.event_max_position, config.event_max_heading, config.event_max_age);
+      _solution_cache.Configure(config.solution_cache, config.cache_resolution);
+      _obstacle_avoidance = config.obstacle_avoidance;
+      _obstacle_clearance = config.obstacle_clearance;
+      _w_obstacle = config.w_obstacle;
+      _check_footprint = config.check_footprint;
+      _hybrid_fallback = config.hybrid_fallback;
+      _hybrid_v_samples = config.hybrid_v_samples;
+      _hybrid_w_samples = config.hybrid_w_samples;
+      _hybrid_v_range = config.hybrid_v_range;
+      _hybrid_w_range = config.hybrid_w_range;
+      _hybrid_sim_time = config.hybrid_sim_time;
+      _hybrid_threads = config.hybrid_threads > 0 ? config.hybrid_threads : max(1, int(std::thread::hardware_concurrency()));
+      _hybrid_obstacle_costs->setParams(config.max_vel_trans, 0.2, 0.25);
+      _hybrid_obstacle_costs->setScale(config.hybrid_occdist_scale);
+      _hybrid_path_costs->setScale(config.hybrid_path_bias);
+      _hybrid_goal_costs->setScale(config.hybrid_goal_bias);
+      if(!_hybrid_fallback)
+          _hybrid_pool.reset();
+      else if(_executor.Pool(Executor::CONTROL))
+          _hybrid_pool = _executor.Pool(Executor::CONTROL);
+      else if(!_hybrid_pool || _hybrid_pool->Size() != _hybrid_threads)
+          _hybrid_pool = std::make_shared<WorkStealingPool>(_hybrid_threads);
+      _adaptive_horizon = config.adaptive_horizon;
+      _min_steps = config.min_steps;
+      _horizon_preview = config.horizon_preview;
+      _move_blocks = config.move_blocks;
+      // Switched to by the next cycle, see switchProfile()
+      const std::string profile = config.profile.empty() ? "default" : config.profile;
+      size_t index = 0;
+      while(index < _profiles.size() && _profiles[index].name != profile)
+          index++;
+      if(index < _profiles.size())
+          _requested_profile = index;
+      else
+          ROS_WARN_NAMED("mpc_ros", "No parameter profile %s.", profile.c_str());
+      _viz_rate = config.viz_rate;
+      g_plan_pub_.SetRate(_viz_rate);
+      l_plan_pub_.SetRate(_viz_rate);
+      _pub_mpctraj.SetRate(_viz_rate);
+      _pub_odompath.SetRate(_viz_rate);
 
 
       planner_util_.reconfigureCB(limits, false);
@@ -150,37 +663,64 @@ namespace mpc_ros{
   }
 
     void MPCPlannerROS::publishLocalPlan(std::vector<geometry_msgs::PoseStamped>& path) {
-        base_local_planner::publishPlan(path, l_plan_pub_);
+        const ros::Time now = ros::Time::now();
+        if(!l_plan_pub_.Due(now))
+            return;
+        nav_msgs::Path &msg = l_plan_pub_.Reset(global_frame_, now, 0);
+        msg.poses.assign(path.begin(), path.end());
+        l_plan_pub_.Publish(now);
     }
 
     void MPCPlannerROS::publishGlobalPlan(std::vector<geometry_msgs::PoseStamped>& path) {
-        base_local_planner::publishPlan(path, g_plan_pub_);
+        const ros::Time now = ros::Time::now();
+        if(!g_plan_pub_.Due(now))
+            return;
+        nav_msgs::Path &msg = g_plan_pub_.Reset(path.empty() ? global_frame_ : path[0].header.frame_id, now, 0);
+        msg.poses.assign(path.begin(), path.end());
+        g_plan_pub_.Publish(now);
+    }
+
+    void MPCPlannerROS::publishGlobalPlan(const PlanWindow& plan) {
+        // Only the remaining poses are sent, and only if someone is looking
+        const ros::Time now = ros::Time::now();
+        if(plan.Empty() || !g_plan_pub_.Due(now))
+            return;
+        nav_msgs::Path &msg = g_plan_pub_.Reset(plan[0].header.frame_id, now, 0);
+        msg.poses.assign(plan.Plan()->begin() + plan.Start(), plan.Plan()->end());
+        g_plan_pub_.Publish(now);
     }
   
+    // Plan of the next goal of a mission, prepared before its setPlan()
+    void MPCPlannerROS::nextPlanCB(const nav_msgs::Path::ConstPtr& msg)
+    {
+        _plan_prefetch.Request(msg->poses);
+    }
+
 	bool MPCPlannerROS::setPlan(const std::vector<geometry_msgs::PoseStamped>& orig_global_plan){
+        MPC_TRACE_SPAN("set_plan");
         if( ! isInitialized()) {
             ROS_ERROR("This planner has not been initialized, please call initialize() before using this planner");
             return false;
         }
 
-        //Init parameters for MPC object
-        _mpc_params["DT"] = _dt;
-        //_mpc_params["LF"] = _Lf;
-        _mpc_params["STEPS"]    = _mpc_steps;
-        _mpc_params["REF_CTE"]  = _ref_cte;
-        _mpc_params["REF_ETHETA"] = _ref_etheta;
-        _mpc_params["REF_V"]    = _ref_vel;
-        _mpc_params["W_CTE"]    = _w_cte;
-        _mpc_params["W_EPSI"]   = _w_etheta;
-        _mpc_params["W_V"]      = _w_vel;
-        _mpc_params["W_ANGVEL"]  = _w_angvel;
-        _mpc_params["W_A"]      = _w_accel;
-        _mpc_params["W_DANGVEL"] = _w_angvel_d;
-        _mpc_params["W_DA"]     = _w_accel_d;
-        _mpc_params["ANGVEL"]   = _max_angvel;
-        _mpc_params["MAXTHR"]   = _max_throttle;
-        _mpc_params["BOUND"]    = _bound_value;
-        _mpc.LoadParams(_mpc_params);
+        if(_async_solve)
+        {
+            // Applied by the solver thread before its next cycle. A solve
+            // still running on the old plan stops at its next iterate, the
+            // next cycle solves on this one.
+            std::lock_guard<std::mutex> lock(_request_mutex);
+            _request_params = true;
+            _request_new_plan = true;
+            if(_cancel_on_replan)
+                for(size_t k = 0; k < _profiles.size(); k++)
+                    _profiles[k].mpc->Cancel();
+        }
+        else
+        {
+            applyMpcParams();
+            // Farther than this the term is flat anyway
+            _distance_field.SetMaxDistance(_obstacle_clearance + 0.5);
+        }
         //Display the parameters
         cout << "\n===== Parameters =====" << endl;
         cout << "debug_info: "  << _debug_info << endl;
@@ -194,19 +734,37 @@ namespace mpc_ros{
         cout << "mpc_max_angvel: "  << _max_angvel << endl;
 
         latchedStopRotateController_.resetLatching();
-        planner_util_.setPlan(orig_global_plan);
-        
+        _mode_arbiter.Reset();
+        if(!planner_util_.setPlan(orig_global_plan))
+            return false;
+        // The next leg was published ahead, its profile is ready
+        if(_prefetch_plans && _plan_prefetch.Match(orig_global_plan))
+            ROS_DEBUG_NAMED("mpc_ros", "Speed profile of the new plan prefetched");
+        if(!_async_solve)
+            _event_trigger.Reset(); // new plan, solve again
+
+        // Transform the plan to the odom frame once, the control cycles only
+        // move along it from here on
+        if(orig_global_plan.empty())
+        {
+            global_plan_.Clear();
+            return true;
+        }
+        const std::string &plan_frame = orig_global_plan[0].header.frame_id.empty() ? _map_frame : orig_global_plan[0].header.frame_id;
+        tf2::Transform plan_to_odom;
+        if(!_tf_cache.Lookup(*tf_, _odom_frame, plan_frame, plan_to_odom))
+        {
+            global_plan_.Clear();
+            return false;
+        }
+        global_plan_.Set(orig_global_plan, plan_to_odom, _odom_frame);
+        return true;
     }
 
     void MPCPlannerROS::updatePlanAndLocalCosts(
         const geometry_msgs::PoseStamped& global_pose,
-        const std::vector<geometry_msgs::PoseStamped>& new_plan,
+        const PlanWindow& plan,
         const std::vector<geometry_msgs::Point>& footprint_spec) {
-        
-        global_plan_.resize(new_plan.size());
-        for (unsigned int i = 0; i < new_plan.size(); ++i) {
-            global_plan_[i] = new_plan[i];
-        }
 
         /*
         obstacle_costs_.setFootprint(footprint_spec);
@@ -251,32 +809,85 @@ namespace mpc_ros{
         */
     }
 
-	bool MPCPlannerROS::computeVelocityCommands(geometry_msgs::Twist& cmd_vel){
-        // dispatches to either dwa sampling control or stop and rotate control, depending on whether we have been close enough to goal
-        if ( ! costmap_ros_->getRobotPose(current_pose_)) {
+    bool MPCPlannerROS::beginCycle()
+    {
+        // isGoalReached() of this tick already captured it
+        if(_cycle.open && (ros::Time::now() - _cycle.stamp).toSec() < 0.5 * _dt)
+            return true;
+        _cycle.open = false;
+        if ( ! costmap_ros_->getRobotPose(_cycle.pose)) {
             ROS_ERROR("Could not get robot pose");
             return false;
         }
-        std::vector<geometry_msgs::PoseStamped> transformed_plan;
-        if ( ! planner_util_.getLocalPlan(current_pose_, transformed_plan)) {
-            ROS_ERROR("Could not get local plan");
+        _cycle.odom = _odom.Get();
+        odom_helper_.getRobotVel(_cycle.robot_vel);
+        _cycle.limits = planner_util_.getCurrentLimits();
+        _cycle.footprint = costmap_ros_->getRobotFootprint();
+        _cycle.stamp = ros::Time::now();
+        _cycle.open = true;
+        return true;
+    }
+
+	bool MPCPlannerROS::computeVelocityCommands(geometry_msgs::Twist& cmd_vel){
+        MPC_TRACE_SPAN("compute_velocity_commands");
+        // dispatches to either dwa sampling control or stop and rotate control, depending on whether we have been close enough to goal
+        if ( ! beginCycle())
             return false;
-        }
+        // The next tick captures again
+        _cycle.open = false;
+        //skip the poses already passed, the plan and the odometry are both in the odom frame
+        const nav_msgs::Odometry::ConstPtr &odom_msg = _cycle.odom;
+        if(odom_msg)
+            global_plan_.Advance(odom_msg->pose.pose.position.x, odom_msg->pose.pose.position.y, _pathLength);
         //if the global plan passed in is empty... we won't do anything
-        if(transformed_plan.empty()) {
+        if(global_plan_.Size() < 2) {
             ROS_WARN_NAMED("mpc_planner", "Received an empty transformed plan.");
             return false;
         }
-        ROS_DEBUG_NAMED("mpc_planner", "Received a transformed plan with %zu points.", transformed_plan.size());
-        updatePlanAndLocalCosts(current_pose_, transformed_plan, costmap_ros_->getRobotFootprint());
+        ROS_DEBUG_NAMED("mpc_planner", "Following the plan from pose %zu, %zu points left.", global_plan_.Start(), global_plan_.Size());
+        updatePlanAndLocalCosts(_cycle.pose, global_plan_, _cycle.footprint);
 
-        if (latchedStopRotateController_.isPositionReached(&planner_util_, current_pose_)){
-            //publish an empty plan because we've reached our goal position
+        // Mode arbiter: no solve while an analytic law serves the phase
+        if(_arbitrate_modes && odom_msg)
+        {
+            const double goal_dist = ModeArbiter::GoalDistance(*global_plan_.Path(), global_plan_.Start(),
+                                                               odom_msg->pose.pose.position.x, odom_msg->pose.pose.position.y);
+            const ModeArbiter::Mode mode = _mode_arbiter.Update(
+                goal_dist, latchedStopRotateController_.isPositionReached(&planner_util_, _cycle.pose),
+                latchedStopRotateController_.isGoalReached(&planner_util_, odom_helper_, _cycle.pose));
+            if(_mode_arbiter.Changed())
+            {
+                ROS_INFO_NAMED("mpc_ros", "Mode %s, %.2f m to the goal.", ModeArbiter::Name(mode), goal_dist);
+                if(mode == ModeArbiter::MPC_TRACKING)
+                {
+                    // Back from an analytic law, the last plan is stale
+                    if(_async_solve)
+                    {
+                        std::lock_guard<std::mutex> lock(_request_mutex);
+                        _request_new_plan = true;
+                    }
+                    else
+                        _event_trigger.Reset();
+                }
+                else if(_async_solve)
+                    _solver_thread.Clear();
+            }
+            if(mode != ModeArbiter::MPC_TRACKING)
+                return analyticVelocityCommands(mode, cmd_vel);
+        }
+
+        if (latchedStopRotateController_.isPositionReached(&planner_util_, _cycle.pose)){
+            //publish an empty plan because we've reached our goal position,
+            //the solver thread publishes the plans with async_solve
             std::vector<geometry_msgs::PoseStamped> local_plan;
             std::vector<geometry_msgs::PoseStamped> transformed_plan;
-            publishGlobalPlan(transformed_plan);
-            publishLocalPlan(local_plan);
-            base_local_planner::LocalPlannerLimits limits = planner_util_.getCurrentLimits();
+            if(_async_solve)
+                _solver_thread.Clear();
+            else
+            {
+                publishGlobalPlan(transformed_plan);
+                publishLocalPlan(local_plan);
+            }
             ROS_WARN_NAMED("mpc_ros", "Reached the goal!!!.");
             return true;
             /*return latchedStopRotateController_.computeVelocityCommandsStopRotate(
@@ -306,9 +917,14 @@ namespace mpc_ros{
                 current_pose_,
                 boost::bind(&DWAPlanner::checkTrajectory, dp_, _1, _2, _3));
         } else */{
-            bool isOk = mpcComputeVelocityCommands(current_pose_, cmd_vel);
+            if(_async_solve)
+                return asyncVelocityCommands(cmd_vel);
+            _solve_cycle = _cycle;
+            _solve_plan = global_plan_;
+            switchProfile();
+            bool isOk = mpcComputeVelocityCommands(_solve_cycle.pose, cmd_vel);
             if (isOk) {
-                publishGlobalPlan(transformed_plan);
+                publishGlobalPlan(global_plan_);
             } else {
                 ROS_WARN_NAMED("mpc_ros", "MPC Planner failed to produce path.");
                 std::vector<geometry_msgs::PoseStamped> empty_plan;
@@ -318,25 +934,158 @@ namespace mpc_ros{
         }
     }
 
+    // Command of an analytic mode of the arbiter, the solver thread is not notified
+    bool MPCPlannerROS::analyticVelocityCommands(ModeArbiter::Mode mode, geometry_msgs::Twist& cmd_vel)
+    {
+        MPC_TRACE_SPAN("analytic_mode");
+        cmd_vel = geometry_msgs::Twist();
+        if(!_async_solve)
+        {
+            std::vector<geometry_msgs::PoseStamped> local_plan;
+            publishLocalPlan(local_plan);
+        }
+        if(mode == ModeArbiter::STANDSTILL)
+            return true;
+        if(mode == ModeArbiter::ROTATE)
+        {
+            // The footprint of this cycle for checkRotation
+            _rotate_footprint.resize(_cycle.footprint.size());
+            for(size_t i = 0; i < _cycle.footprint.size(); i++)
+                _rotate_footprint[i] = std::make_pair(_cycle.footprint[i].x, _cycle.footprint[i].y);
+            return latchedStopRotateController_.computeVelocityCommandsStopRotate(
+                cmd_vel, _cycle.limits.getAccLimits(), _dt, &planner_util_, odom_helper_, _cycle.pose,
+                boost::bind(&MPCPlannerROS::checkRotation, this, _1, _2, _3));
+        }
+
+        // APPROACH in the odom frame of the plan
+        const nav_msgs::Odometry &odom = *_cycle.odom;
+        double speed, angvel;
+        _mode_arbiter.ApproachCommand(*global_plan_.Path(), global_plan_.Start(), odom.pose.pose.position.x,
+                                      odom.pose.pose.position.y, tf2::getYaw(odom.pose.pose.orientation),
+                                      odom.twist.twist.linear.x, _dt, _max_speed, _max_angvel, speed, angvel);
+        cmd_vel.linear.x = speed;
+        cmd_vel.angular.z = angvel;
+        // What the MPC starts from when it takes over again
+        _speed = speed;
+        _w = angvel;
+        _throttle = 0.0;
+        if(!_async_solve)
+            publishGlobalPlan(global_plan_);
+        return true;
+    }
+
+    bool MPCPlannerROS::checkRotation(Eigen::Vector3f pos, Eigen::Vector3f, Eigen::Vector3f vel_samples)
+    {
+        // Poses of one period at the sampled velocity from pos
+        const int poses = 5;
+        double x[poses], y[poses], theta[poses];
+        for(int k = 0; k < poses; k++)
+        {
+            const double t = _dt * (k + 1) / poses;
+            theta[k] = pos[2] + vel_samples[2] * t;
+            x[k] = pos[0] + vel_samples[0] * t * cos(pos[2]) - vel_samples[1] * t * sin(pos[2]);
+            y[k] = pos[1] + vel_samples[0] * t * sin(pos[2]) + vel_samples[1] * t * cos(pos[2]);
+        }
+        int first_lethal;
+        boost::unique_lock<costmap_2d::Costmap2D::mutex_t> lock(*(costmap_->getMutex()));
+        _rotate_checker.SetFootprint(_rotate_footprint, costmap_->getResolution());
+        _rotate_checker.TrajectoryCost(costmap_->getCharMap(), costmap_->getSizeInCellsX(), costmap_->getSizeInCellsY(),
+                                       costmap_->getOriginX(), costmap_->getOriginY(), x, y, theta, poses, 0,
+                                       costmap_2d::LETHAL_OBSTACLE, costmap_2d::NO_INFORMATION, first_lethal);
+        return first_lethal < 0;
+    }
+
+    // async_solve: hand this cycle to the solver thread and follow the last
+    // finished command sequence, sampled at the current time
+    bool MPCPlannerROS::asyncVelocityCommands(geometry_msgs::Twist& cmd_vel)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_request_mutex);
+            _request_cycle = _cycle;
+            _request_plan = global_plan_;
+        }
+        _solver_thread.Notify();
+
+        const double now = ros::Time::now().toSec();
+        double speed, angvel;
+        if(!_solver_thread.Latest(_async_cmd) || now - _async_cmd.stamp > _async_max_age
+           || !_async_cmd.Sample(now, speed, angvel))
+        {
+            ROS_WARN_THROTTLE_NAMED(1.0, "mpc_ros", "No MPC plan younger than %.2f s to follow.", _async_max_age);
+            cmd_vel = geometry_msgs::Twist();
+            return false;
+        }
+        cmd_vel.linear.x = speed;
+        cmd_vel.linear.y = 0.0;
+        cmd_vel.angular.z = angvel;
+        return true;
+    }
+
+    // Solver thread of async_solve: one cycle on the newest request. A cycle
+    // that fails leaves an empty sequence, so computeVelocityCommands() fails
+    // too instead of following an older plan.
+    bool MPCPlannerROS::solveAsync(MPCCommand &cmd)
+    {
+        bool params, new_plan;
+        {
+            std::lock_guard<std::mutex> lock(_request_mutex);
+            _solve_cycle = _request_cycle;
+            _solve_plan = _request_plan;
+            params = _request_params;
+            new_plan = _request_new_plan;
+            _request_params = false;
+            _request_new_plan = false;
+        }
+        if(params)
+        {
+            applyMpcParams();
+            // Farther than this the term is flat anyway
+            _distance_field.SetMaxDistance(_obstacle_clearance + 0.5);
+        }
+        if(new_plan)
+            _event_trigger.Reset(); // new plan, solve again
+        if(_solve_plan.Size() < 2)
+            return false;
+
+        _cycle_cmd.speed.clear();
+        _cycle_cmd.angvel.clear();
+        switchProfile();
+        _mpc->_mpc_cancelled = false;
+        geometry_msgs::Twist cmd_vel;
+        if(mpcComputeVelocityCommands(_solve_cycle.pose, cmd_vel))
+            publishGlobalPlan(_solve_plan);
+        else if(_mpc->_mpc_cancelled)
+            return false; // keep following the last plan until the next cycle
+        else
+        {
+            ROS_WARN_NAMED("mpc_ros", "MPC Planner failed to produce path.");
+            std::vector<geometry_msgs::PoseStamped> empty_plan;
+            publishGlobalPlan(empty_plan);
+            _cycle_cmd.speed.clear();
+            _cycle_cmd.angvel.clear();
+        }
+        cmd = _cycle_cmd;
+        cmd.stamp = _cycle_cmd.speed.empty() ? ros::Time::now().toSec() : cmd.stamp;
+        return true;
+    }
+
     // Timer: Control Loop (closed loop nonlinear MPC)
     bool MPCPlannerROS::mpcComputeVelocityCommands(geometry_msgs::PoseStamped global_pose, geometry_msgs::Twist& cmd_vel)
     {         
+        MPC_TRACE_SPAN("mpc_cycle");
         // dynamic window sampling approach to get useful velocity commands
         if(! isInitialized()){
             ROS_ERROR("This planner has not been initialized, please call initialize() before using this planner");
             return false;
         }
 
-        geometry_msgs::PoseStamped robot_vel;
-        odom_helper_.getRobotVel(robot_vel);
-
         //compute what trajectory to drive along
         geometry_msgs::PoseStamped drive_cmds;
-        drive_cmds.header.frame_id = costmap_ros_->getBaseFrameID();
+        drive_cmds.header.frame_id = robot_base_frame_;
 
 
         // call with updated footprint
-        base_local_planner::Trajectory path = findBestPath(global_pose, robot_vel, drive_cmds);
+        base_local_planner::Trajectory path = findBestPath(global_pose, _solve_cycle.robot_vel, drive_cmds);
         //base_local_planner::Trajectory path = dp_->findBestPath(global_pose, robot_vel, drive_cmds);
         //ROS_ERROR("Best: %.2f, %.2f, %.2f, %.2f", path.xv_, path.yv_, path.thetav_, path.cost_);
 
@@ -358,26 +1107,18 @@ namespace mpc_ros{
         ROS_DEBUG_NAMED("mpc_ros", "A valid velocity command of (%.2f, %.2f, %.2f) was found for this cycle.", 
                         cmd_vel.linear.x, cmd_vel.linear.y, cmd_vel.angular.z);
 
-        // Fill out the local plan
-        for(unsigned int i = 0; i < path.getPointsSize(); ++i) {
-            double p_x, p_y, p_th;
-            path.getPoint(i, p_x, p_y, p_th);
-
-            geometry_msgs::PoseStamped p;
-            p.header.frame_id = costmap_ros_->getGlobalFrameID();
-            p.header.stamp = ros::Time::now();
-            p.pose.position.x = p_x;
-            p.pose.position.y = p_y;
-            p.pose.position.z = 0.0;
-            tf2::Quaternion q;
-            q.setRPY(0, 0, p_th);
-            tf2::convert(q, p.pose.orientation);
-            local_plan.push_back(p);
+        // Fill out the local plan and publish information to the visualizer,
+        // only when somebody will see it
+        const ros::Time now = ros::Time::now();
+        if(l_plan_pub_.Due(now)) {
+            nav_msgs::Path &msg = l_plan_pub_.Reset(costmap_ros_->getGlobalFrameID(), now, path.getPointsSize());
+            for(unsigned int i = 0; i < path.getPointsSize(); ++i) {
+                double p_x, p_y, p_th;
+                path.getPoint(i, p_x, p_y, p_th);
+                PathVisualizer::SetPose(msg.poses[i], p_x, p_y, p_th);
+            }
+            l_plan_pub_.Publish(now);
         }
-
-        //publish information to the visualizer
-
-        publishLocalPlan(local_plan);
         return true;
     }
 
@@ -387,12 +1128,38 @@ namespace mpc_ros{
       geometry_msgs::PoseStamped& drive_velocities){
 
         base_local_planner::Trajectory result_traj_;
+        mpc_ros::MPCStats stats;
+        // Sized before counting starts, empty without the hook library
+        if(alloc_counter::Active())
+        {
+            stats.stage_allocs.resize(5);
+            stats.stage_alloc_bytes.resize(5);
+        }
+        if(perf_counters::Enabled())
+        {
+            stats.stage_cycles.resize(5);
+            stats.stage_instructions.resize(5);
+            stats.stage_cache_misses.resize(5);
+            stats.stage_branch_misses.resize(5);
+            stats.solve_cycles.resize(4);
+            stats.solve_instructions.resize(4);
+            stats.solve_cache_misses.resize(4);
+            stats.solve_branch_misses.resize(4);
+        }
+        if(energy_meter::Enabled())
+        {
+            stats.stage_energy_j.resize(5);
+            stats.solve_energy_j.resize(4);
+        }
+        StageClock clock;
+        AllocClock allocs;
+        PerfClock perf;
+        EnergyClock energy;
 
         Eigen::Vector3f pos(global_pose.pose.position.x, global_pose.pose.position.y, tf2::getYaw(global_pose.pose.orientation));
         Eigen::Vector3f vel(global_vel.pose.position.x, global_vel.pose.position.y, tf2::getYaw(global_vel.pose.orientation));
-        geometry_msgs::PoseStamped goal_pose = global_plan_.back();
+        const geometry_msgs::PoseStamped &goal_pose = _solve_plan.Back();
         Eigen::Vector3f goal(goal_pose.pose.position.x, goal_pose.pose.position.y, tf2::getYaw(goal_pose.pose.orientation));
-        base_local_planner::LocalPlannerLimits limits = planner_util_.getCurrentLimits();
         result_traj_.cost_ = 1;
 
         /*
@@ -400,8 +1167,15 @@ namespace mpc_ros{
         *  MPC Control Loop
         * 
         */
-        //copy over the odometry information
-        nav_msgs::Odometry base_odom = _odom;
+        //the odometry of this cycle, the message computeVelocityCommands advanced the plan with
+        const nav_msgs::Odometry::ConstPtr &odom_msg = _solve_cycle.odom;
+        if(!odom_msg)
+        {
+            ROS_WARN_THROTTLE_NAMED(1.0, "mpc_ros", "No odometry received yet.");
+            result_traj_.cost_ = -1;
+            return result_traj_;
+        }
+        const nav_msgs::Odometry &base_odom = *odom_msg;
 
         // Update system states: X=[x, y, theta, v]
         const double px = base_odom.pose.pose.position.x; //pose: odom frame
@@ -415,91 +1189,104 @@ namespace mpc_ros{
         //const double steering = _steering;  // radian
         const double throttle = _throttle; // accel: >0; brake: <0
         const double dt = _dt;
+        const double stamp = ros::Time::now().toSec();
 
-        //Update path waypoints (conversion to odom frame)
-        nav_msgs::Path odom_path = nav_msgs::Path();
-        try
-        {
-            double total_length = 0.0;
-            int sampling = _downSampling;
-
-            //find waypoints distance
-            if(_waypointsDist <=0.0)
-            {        
-                double dx = global_plan_[1].pose.position.x - global_plan_[0].pose.position.x;
-                double dy = global_plan_[1].pose.position.y - global_plan_[0].pose.position.y;
-                _waypointsDist = sqrt(dx*dx + dy*dy);
-                _downSampling = int(_pathLength/10.0/_waypointsDist);
-            }            
-
-            // Cut and downsampling the path
-            for(int i =0; i< global_plan_.size(); i++)
-            {
-                if(total_length > _pathLength)
-                    break;
-
-                if(sampling == _downSampling)
-                {   
-                    geometry_msgs::PoseStamped tempPose;
-                    tf2_ros::TransformListener tfListener(*tf_);
-                    geometry_msgs::TransformStamped odom_transform;
-                    odom_transform = tf_->lookupTransform(_odom_frame, _map_frame, ros::Time(0), ros::Duration(1.0) );
-                    tf2::doTransform(global_plan_[i], tempPose, odom_transform); // robot_pose is the PoseStamp                     
-                    odom_path.poses.push_back(tempPose);  
-                    sampling = 0;
-                }
-                total_length = total_length + _waypointsDist; 
-                sampling = sampling + 1;  
-            }
-           
-            if(odom_path.poses.size() > 3)
-            {
-                // publish odom path
-                odom_path.header.frame_id = "odom";
-                odom_path.header.stamp = ros::Time::now();
-                _pub_odompath.publish(odom_path);
-            }
-            else
+        takeCostmapSnapshot(global_pose);
+
+        // Still on the last prediction, and clear of the costmap when the
+        // footprint is checked: follow its inputs without solving
+        if(_event_trigger.Enabled() && _event_trigger.Holds(stamp, px, py, theta))
+        {
+            int first_lethal = -1;
+            if(_check_footprint)
+                footprintCost(_prev_plan_x, _prev_plan_y, _prev_plan_theta, 1, first_lethal);
+            if(first_lethal < 0)
             {
-                ROS_DEBUG_NAMED("mpc_ros", "Failed to path generation since small down-sampling path.");
-                _waypointsDist = -1;
-                result_traj_.cost_ = -1;
+                const size_t k = min(_event_angvel.size() - 1, size_t(max(0.0, (stamp - _event_stamp) / _event_dt)));
+                _w = _event_angvel[k];
+                _throttle = _event_accel[k];
+                _speed = max(0.0, min(v + _throttle * dt, _max_speed));
+                drive_velocities.pose.position.x = _speed;
+                drive_velocities.pose.position.y = 0;
+                drive_velocities.pose.position.z = 0;
+                tf2::Quaternion q;
+                q.setRPY(0, 0, _w);
+                tf2::convert(q, drive_velocities.pose.orientation);
+                if(_async_solve)
+                    fillCommand(_cycle_cmd, _event_stamp + k * _event_dt, _event_dt, _speed, _w, _max_speed,
+                                &_event_angvel, &_event_accel, k);
                 return result_traj_;
             }
-            //DEBUG      
-            if(_debug_info){
-                cout << endl << "odom_path: " << odom_path.poses.size()
-                << ", path[0]: " << odom_path.poses[0]
-                << ", path[N]: " << odom_path.poses[odom_path.poses.size()-1] << endl;
-            }  
+            _event_trigger.Reset();
         }
-        catch(tf::TransformException &ex)
+
+        //Update path waypoints (conversion to odom frame)
+        //find waypoints distance
+        if(_waypointsDist <=0.0)
+        {        
+            double dx = _solve_plan[1].pose.position.x - _solve_plan[0].pose.position.x;
+            double dy = _solve_plan[1].pose.position.y - _solve_plan[0].pose.position.y;
+            _waypointsDist = sqrt(dx*dx + dy*dy);
+            _downSampling = int(_pathLength/10.0/_waypointsDist);
+        }            
+
+        // The plan is transformed to odom once in setPlan, nothing to look up per cycle
+        clock.Lap();
+        lapAllocs(allocs, stats, 0);
+        lapPerf(perf, stats, 0);
+        lapEnergy(energy, stats, 0);
+        stats.tf_ms = 0.0;
+
+        // Cut and downsampling the path, only the samples gained since the
+        // last cycle are copied, see plan_window.h
+        CompactPath &odom_path = _plan_samples.Update(_solve_plan, std::max(_downSampling, 1),
+                                                         size_t(_pathLength/_waypointsDist));
+        stats.path_ms = clock.Lap();
+        lapAllocs(allocs, stats, 1);
+        lapPerf(perf, stats, 1);
+        lapEnergy(energy, stats, 1);
+       
+        if(odom_path.Size() > 3)
+        {
+            // publish odom path
+            odom_path.SetFrame("odom");
+            odom_path.SetStamp(ros::Time::now());
+            if(_pub_odompath.Due(odom_path.Stamp()))
+                _pub_odompath.Publish(odom_path, odom_path.Stamp());
+        }
+        else
         {
-            ROS_ERROR("%s",ex.what());
-            ros::Duration(1.0).sleep();
+            ROS_DEBUG_NAMED("mpc_ros", "Failed to path generation since small down-sampling path.");
+            _waypointsDist = -1;
+            result_traj_.cost_ = -1;
+            return result_traj_;
         }
+        //DEBUG      
+        if(_debug_info){
+            const size_t last = odom_path.Size() - 1;
+            cout << endl << "odom_path: " << odom_path.Size()
+            << ", path[0]: " << odom_path.X(0) << ", " << odom_path.Y(0)
+            << ", path[N]: " << odom_path.X(last) << ", " << odom_path.Y(last) << endl;
+        }  
 
         // Waypoints related parameters
-        const int N = odom_path.poses.size(); // Number of waypoints
-        const double costheta = cos(theta);
-        const double sintheta = sin(theta);
-        
+        const int N = odom_path.Size(); // Number of waypoints
         cout << "px, py : " << px << ", "<< py << ", theta: " << theta << " , N: " << N << endl;
-        // Convert to the vehicle coordinate system
-        VectorXd x_veh(N);
-        VectorXd y_veh(N);
-        for(int i = 0; i < N; i++) 
+
+        // Fit waypoints in the vehicle coordinate system
+        bool fitted;
+        {
+            EigenNoMalloc no_malloc;
+            fitted = _path_fit.Fit(odom_path, px, py, theta);
+        }
+        if(!fitted)
         {
-            const double dx = odom_path.poses[i].pose.position.x - px;
-            const double dy = odom_path.poses[i].pose.position.y - py;
-            x_veh[i] = dx * costheta + dy * sintheta;
-            y_veh[i] = dy * costheta - dx * sintheta;
-            //cout << "x_veh : " << x_veh[i]<< ", y_veh: " << y_veh[i] << endl;
+            result_traj_.cost_ = -1;
+            return result_traj_;
         }
+        const VectorXd &coeffs = _path_fit.Coeffs();
 
-        // Fit waypoints
-        auto coeffs = polyfit(x_veh, y_veh, 3); 
-        const double cte  = polyeval(coeffs, 0.0);
+        const double cte  = _path_fit.Eval(0.0);
         cout << "coeffs : " << coeffs[0] << endl;
         cout << "pow : " << pow(0.0 ,0) << endl;
         cout << "cte : " << cte << endl;
@@ -511,8 +1298,8 @@ namespace mpc_ros{
         int N_sample = N * 0.3;
         for(int i = 1; i < N_sample; i++) 
         {
-            gx += odom_path.poses[i].pose.position.x - odom_path.poses[i-1].pose.position.x;
-            gy += odom_path.poses[i].pose.position.y - odom_path.poses[i-1].pose.position.y;
+            gx += odom_path.X(i) - odom_path.X(i-1);
+            gy += odom_path.Y(i) - odom_path.Y(i-1);
         }   
 
         double temp_theta = theta;
@@ -529,6 +1316,7 @@ namespace mpc_ros{
         else
             etheta = 0;  
         cout << "etheta: "<< etheta << ", atan2(gy,gx): " << atan2(gy,gx) << ", temp_theta:" << traj_deg << endl;
+        _metrics.Metrics().ObserveTracking(cte, etheta);
 
         // Difference bewteen current position and goal position
         const double x_err = goal_pose.pose.position.x -  base_odom.pose.pose.position.x;
@@ -538,7 +1326,22 @@ namespace mpc_ros{
         cout << "x_err:"<< x_err << ", y_err:"<< y_err  << endl;
 
         VectorXd state(6);
-        if(_delay_mode)
+        // Time from the odometry to the actual moment of control
+        const double delay = !_delay_mode ? 0.0
+                             : _latency_compensation ? _latency.Latency(stamp, base_odom.header.stamp.toSec()) : dt;
+        if(_delay_mode && _latency_compensation)
+        {
+            // Unicycle model over the measured latency, the inputs of the
+            // last cycle are applied meanwhile
+            double px_act, py_act, theta_act, v_act;
+            LatencyCompensator::Predict(delay, v, w, throttle, px_act, py_act, theta_act, v_act);
+
+            const double cte_act = cte + v * sin(etheta) * delay;
+            const double etheta_act = etheta - theta_act;
+
+            state << px_act, py_act, theta_act, v_act, cte_act, etheta_act;
+        }
+        else if(_delay_mode)
         {
             // Kinematic model is used to predict vehicle state at the actual moment of control (current time + delay dt)
             const double px_act = v * dt;
@@ -556,21 +1359,209 @@ namespace mpc_ros{
             state << 0, 0, 0, v, cte, etheta;
         }
 
+        // Obstacle distances and free space along the horizon of this
+        // solve, linearized for it
+        int steps = 0;
+        double step_dt = 0.0;
+        if(obstacleTerm() || _corridor || _curvature_speed)
+            _mpc->PlannedHorizon(state[3], coeffs, steps, step_dt);
+        if(obstacleTerm() || _corridor)
+            linearizationPoints(global_pose, v, steps, step_dt);
+        if(obstacleTerm())
+        {
+            updateNeighbors(global_pose, _delay_mode ? stamp + dt : stamp);
+            updateMovingObstacles(_delay_mode ? stamp + dt : stamp);
+            updateScanCircles(global_pose, stamp);
+            updateObstacleModel(global_pose, steps);
+        }
+        else
+            _obstacle_model.clear();
+        if(_corridor)
+            updateCorridor(global_pose, steps);
+        else
+            _corridor_model.clear();
+        _mpc->SetObstacleModel(_obstacle_model);
+        _mpc->SetCorridorModel(_corridor_model, _free_corridor.Faces());
+
+        // Profile of a new plan once, then only read from the robot on
+        if(_curvature_speed && _solve_plan.Path())
+        {
+            if(_prefetch_plans)
+                _plan_prefetch.Adopt(_solve_plan.Path(), _speed_profile);
+            _speed_profile.Update(_solve_plan.Path());
+            _speed_reference.resize(steps);
+            _speed_profile.Reference(_solve_plan.Path()->S(_solve_plan.Start()), state[3], step_dt, steps,
+                                     _speed_reference.data());
+        }
+        else
+            _speed_reference.clear();
+        _mpc->SetSpeedReference(_speed_reference);
+
         // Solve MPC Problem
-        ros::Time begin = ros::Time::now();
-        vector<double> mpc_results = _mpc.Solve(state, coeffs);    
-        ros::Time end = ros::Time::now();
-        cout << "Duration: " << end.sec << "." << end.nsec << endl << begin.sec<< "."  << begin.nsec << endl;
+        // Deadline mode: the solve gets the controller period minus the rest of the cycle
+        const double deadline = _deadline_mode ? max(0.2 * _dt, _dt - _cycle_overhead) : 0.0;
+        _mpc->SetDeadline(deadline);
+        stats.fit_ms = clock.Lap();
+        lapAllocs(allocs, stats, 2);
+        lapPerf(perf, stats, 2);
+        lapEnergy(energy, stats, 2);
+        // Same inputs as a recent cycle, e.g. move_base asking again during
+        // a recovery: its solution instead of a solve
+        const SolutionCache::Solution *cached = _solution_cache.Enabled()
+                                                ? _solution_cache.Find(state, coeffs, _obstacle_model, _corridor_model, _speed_reference) : 0;
+        vector<double> mpc_results(2);
+        if(cached)
+        {
+            restoreSolution(*cached);
+            mpc_results[0] = cached->w;
+            mpc_results[1] = cached->throttle;
+        }
+        else
+        {
+            if(!_snapshot_read)
+            {
+                _snapshot_read = true;
+                if(_mpc->ReadSnapshot(_snapshot_file, _snapshot_max_age))
+                    ROS_INFO_NAMED("mpc_ros", "Solver state restored from %s", _snapshot_file.c_str());
+            }
+            EigenNoMalloc no_malloc;
+            mpc_results = _mpc->Solve(state, coeffs);
+            // Cancelled by setPlan: nothing of the old plan is applied or kept
+            if(_mpc->_mpc_cancelled)
+                return false;
+            // A shifted fallback depends on the cycles before, not on the
+            // inputs, and a failed solve is not to be replayed
+            typedef CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> Result;
+            const bool solved = _mpc->_mpc_status == Result::success
+                                || _mpc->_mpc_status == Result::stop_at_acceptable_point;
+            if(_solution_cache.Enabled() && !_mpc->_mpc_fallback && solved)
+            {
+                SolutionCache::Solution solution;
+                storeSolution(solution);
+                solution.w = mpc_results[0];
+                solution.throttle = mpc_results[1];
+                _solution_cache.Insert(solution);
+            }
+        }
+        stats.solve_ms = clock.Lap();
+        lapAllocs(allocs, stats, 3);
+        const perf_counters::Counts solve_perf = lapPerf(perf, stats, 3);
+        const double solve_energy = lapEnergy(energy, stats, 3);
+        stats.tape_ms = _mpc->_mpc_tape_ms;
+        if(!cached)
+        {
+            ControllerMetrics &metrics = _metrics.Metrics();
+            metrics.ObserveSolve(stats.solve_ms, _mpc->_mpc_iterations, _mpc->_mpc_status);
+            metrics.SetMemory(_mpc->Memory());
+            if(deadline > 0 && stats.solve_ms > 1000.0 * deadline)
+                metrics.CountDeadlineMiss();
+            if(_mpc->_mpc_fallback)
+                metrics.CountFallback();
+            if(!stats.solve_cycles.empty())
+                splitSolvePerf(solve_perf, _mpc->_mpc_tape_profile, stats);
+            if(!stats.solve_energy_j.empty())
+                splitSolveEnergy(solve_energy, stats.solve_ms, _mpc->_mpc_tape_profile, stats);
+            if(!_mpc->_mpc_fallback && !_snapshot_file.empty() && ++_snapshot_cycle >= (unsigned)std::max(1, _snapshot_every))
+            {
+                _snapshot_cycle = 0;
+                _mpc->WriteSnapshot(_snapshot_file);
+            }
+        }
+        if(_fleet)
+            publishFleetPlan(global_pose);
+        if(obstacleTerm() || _corridor || _check_footprint)
+            keepPrediction(global_pose);
+        else
+        {
+            _prev_plan_x.clear();
+            _prev_plan_y.clear();
+            _prev_plan_theta.clear();
+        }
             
         // MPC result (all described in car frame), output = (acceleration, w)        
         _w = mpc_results[0]; // radian/sec, angular velocity
         _throttle = mpc_results[1]; // acceleration
 
+        // Inputs this cycle follows after its command, for the solver thread
+        const std::vector<double> *follow_angvel = &_mpc->mpc_angvel, *follow_accel = &_mpc->mpc_accel;
+        size_t follow_step = 0;
+
+        // Sweep the footprint over the predicted poses
+        if(_check_footprint)
+        {
+            int first_lethal;
+            const int cost = footprintCost(_prev_plan_x, _prev_plan_y, _prev_plan_theta, 1, first_lethal);
+            if(first_lethal < 0)
+            {
+                result_traj_.cost_ = cost;
+                _safe_x = _prev_plan_x;
+                _safe_y = _prev_plan_y;
+                _safe_theta = _prev_plan_theta;
+                _safe_angvel = _mpc->mpc_angvel;
+                _safe_accel = _mpc->mpc_accel;
+                _safe_step = 0;
+            }
+            else
+            {
+                // Fall back to the rest of the last collision-free plan
+                _safe_step++;
+                int safe_lethal = 0;
+                if(_safe_step < _safe_angvel.size())
+                    footprintCost(_safe_x, _safe_y, _safe_theta, _safe_step, safe_lethal);
+                if(_safe_step < _safe_angvel.size() && safe_lethal < 0)
+                {
+                    _w = _safe_angvel[_safe_step];
+                    _throttle = _safe_accel[_safe_step];
+                    follow_angvel = &_safe_angvel;
+                    follow_accel = &_safe_accel;
+                    follow_step = _safe_step;
+                    _metrics.Metrics().CountFallback();
+                    ROS_WARN_THROTTLE_NAMED(1.0, "mpc_ros", "MPC prediction collides at step %d, following the previous plan.", first_lethal);
+                }
+                else if(_hybrid_fallback && sampledFallback(pos, vel, goal, max(0.0, min(v + _throttle * dt, _max_speed)), _w, result_traj_))
+                {
+                    // _speed below comes out as the speed of the sample
+                    _w = result_traj_.thetav_;
+                    _throttle = (result_traj_.xv_ - v) / dt;
+                    follow_angvel = follow_accel = NULL;
+                    _metrics.Metrics().CountFallback();
+                    ROS_WARN_THROTTLE_NAMED(1.0, "mpc_ros", "MPC prediction collides at step %d, following the best sampled trajectory.", first_lethal);
+                }
+                else
+                {
+                    ROS_WARN_THROTTLE_NAMED(1.0, "mpc_ros", "MPC prediction collides at step %d, stopping.", first_lethal);
+                    _metrics.Metrics().CountInfeasible();
+                    result_traj_.cost_ = -1;
+                }
+            }
+        }
+
+        // Prediction of a solved, collision-free plan for the event trigger,
+        // the first pose is at the control moment in delay mode
+        if(_event_trigger.Enabled())
+        {
+            if(_mpc->_mpc_fallback || result_traj_.cost_ < 0 || _safe_step > 0 || _mpc->mpc_angvel.empty())
+                _event_trigger.Reset();
+            else
+            {
+                _event_trigger.Store(stamp, px, py, theta, _mpc->mpc_x, _mpc->mpc_y, _mpc->mpc_theta,
+                                     delay, _mpc->_mpc_dt, std::vector<double>());
+                _event_angvel = _mpc->mpc_angvel;
+                _event_accel = _mpc->mpc_accel;
+                _event_stamp = stamp;
+                _event_dt = _mpc->_mpc_dt;
+            }
+        }
+
         _speed = v + _throttle * dt;  // speed
         if (_speed >= _max_speed)
             _speed = _max_speed;
         if(_speed <= 0.0)
             _speed = 0.0;
+        // A sampled command alone is held until it is too old
+        if(_async_solve && result_traj_.cost_ >= 0)
+            fillCommand(_cycle_cmd, stamp, follow_angvel ? _mpc->_mpc_dt : _async_max_age, _speed, _w, _max_speed,
+                        follow_angvel, follow_accel, follow_step);
 
         if(_debug_info)
         {
@@ -585,29 +1576,6 @@ namespace mpc_ros{
             cout << "_throttle: \n" << _throttle << endl;
             cout << "_speed: \n" << _speed << endl;
         }
-        // Display the MPC predicted trajectory
-        _mpc_traj = nav_msgs::Path();
-        _mpc_traj.header.frame_id = _base_frame; // points in car coordinate        
-        _mpc_traj.header.stamp = ros::Time::now();
-
-        geometry_msgs::PoseStamped tempPose;
-        tf2::Quaternion myQuaternion;
-
-        for(int i=0; i<_mpc.mpc_x.size(); i++)
-        {
-            tempPose.header = _mpc_traj.header;
-            tempPose.pose.position.x = _mpc.mpc_x[i];
-            tempPose.pose.position.y = _mpc.mpc_y[i];
-
-            myQuaternion.setRPY( 0, 0, _mpc.mpc_theta[i] );  
-            tempPose.pose.orientation.x = myQuaternion[0];
-            tempPose.pose.orientation.y = myQuaternion[1];
-            tempPose.pose.orientation.z = myQuaternion[2];
-            tempPose.pose.orientation.w = myQuaternion[3];
-                
-            _mpc_traj.poses.push_back(tempPose); 
-        }     
-
         if(result_traj_.cost_ < 0){
             drive_velocities.pose.position.x = 0;
             drive_velocities.pose.position.y = 0;
@@ -626,8 +1594,29 @@ namespace mpc_ros{
             tf2::convert(q, drive_velocities.pose.orientation);
         }
         
-        // publish the mpc trajectory
-        _pub_mpctraj.publish(_mpc_traj);
+        // Display the MPC predicted trajectory, points in car coordinate
+        const ros::Time now = ros::Time::now();
+        if(_pub_mpctraj.Due(now))
+        {
+            MPC_TRACE_SPAN("publish_trajectory");
+            nav_msgs::Path &mpc_traj = _pub_mpctraj.Reset(_base_frame, now, _mpc->mpc_x.size());
+            for(size_t i = 0; i < _mpc->mpc_x.size(); i++)
+                PathVisualizer::SetPose(mpc_traj.poses[i], _mpc->mpc_x[i], _mpc->mpc_y[i], _mpc->mpc_theta[i]);
+            _pub_mpctraj.Publish(now);
+        }
+        stats.publish_ms = clock.Lap();
+        stats.total_ms = clock.Total();
+        lapAllocs(allocs, stats, 4);
+        lapPerf(perf, stats, 4);
+        lapEnergy(energy, stats, 4);
+        const alloc_counter::Counts cycle_allocs = allocs.Total();
+        stats.allocs = cycle_allocs.allocs;
+        stats.alloc_bytes = cycle_allocs.bytes;
+        stats.cppad_bytes = allocs.CppadBytes();
+        _latency.AddCycle(stats.total_ms / 1000.0);
+        _cycle_overhead = 0.9 * _cycle_overhead + 0.1 * (stats.total_ms - stats.solve_ms) / 1000.0;
+        _metrics.Metrics().ObserveCycle(stats.total_ms);
+        publishStats(stats);
 
         // http://docs.ros.org/en/jade/api/base_local_planner/html/classbase__local__planner_1_1SimpleTrajectoryGenerator.html#a0810ac35a39d3d7ccc1c19a862e97fbf
         // prepare cost functions and generators for this run
@@ -667,12 +1656,11 @@ namespace mpc_ros{
             return false;
         }
 
-        if ( ! costmap_ros_->getRobotPose(current_pose_)) {
-            ROS_ERROR("Could not get robot pose");
+        // move_base asks before computeVelocityCommands, which reuses this capture
+        if ( ! beginCycle())
             return false;
-        }
 
-        if(latchedStopRotateController_.isGoalReached(&planner_util_, odom_helper_, current_pose_)) {
+        if(latchedStopRotateController_.isGoalReached(&planner_util_, odom_helper_, _cycle.pose)) {
             ROS_INFO("Goal reached");
             return true;
         } else {
@@ -680,42 +1668,486 @@ namespace mpc_ros{
         }
     }
 
-    // Evaluate a polynomial.
-    double MPCPlannerROS::polyeval(Eigen::VectorXd coeffs, double x) 
+    // CallBack: Update odometry
+    void MPCPlannerROS::publishStats(mpc_ros::MPCStats &stats)
+    {
+        _stage_stats.Add(stats);
+        if(_debug_info)
+            ROS_INFO_THROTTLE_NAMED(10.0, "mpc_ros", "Cycle latency [ms] p50 p95 max over %d cycles:%s",
+                                    _stage_stats.Size(), _stage_stats.Table().c_str());
+        if(!_publish_stats)
+            return;
+
+        stats.header.stamp = ros::Time::now();
+        stats.iterations = _mpc->_mpc_iterations;
+        stats.status = _mpc->_mpc_status;
+        stats.objective = _mpc->_mpc_totalcost;
+        stats.cte_cost = _mpc->_mpc_ctecost;
+        stats.etheta_cost = _mpc->_mpc_ethetacost;
+        stats.vel_cost = _mpc->_mpc_velcost;
+        _stage_stats.FillHistogram(stats);
+        _pub_stats.publish(stats);
+    }
+
+    // Points of the horizon in the costmap frame the obstacle model and the
+    // corridor are built around: the previous prediction one step on, or the
+    // fitted path driven at the reference speed
+    void MPCPlannerROS::linearizationPoints(const geometry_msgs::PoseStamped& global_pose, double v, int steps, double dt)
+    {
+        const double ox = global_pose.pose.position.x, oy = global_pose.pose.position.y;
+        const double yaw = tf2::getYaw(global_pose.pose.orientation);
+        const double c = cos(yaw), s = sin(yaw);
+        const bool shifted = _prev_plan_x.size() == (size_t)steps && _prev_plan_dt == dt;
+        const double speed = max(fabs(v), _ref_vel);
+        _lin_x.resize(steps);
+        _lin_y.resize(steps);
+        for(int i = 0; i < steps; i++)
+        {
+            if(shifted)
+            {
+                _lin_x[i] = _prev_plan_x[min(i + 1, steps - 1)];
+                _lin_y[i] = _prev_plan_y[min(i + 1, steps - 1)];
+            }
+            else
+            {
+                const double ax = i * dt * speed, ay = _path_fit.Eval(ax);
+                _lin_x[i] = ox + c * ax - s * ay;
+                _lin_y[i] = oy + s * ax + c * ay;
+            }
+        }
+    }
+
+    void MPCPlannerROS::updateObstacleModel(const geometry_msgs::PoseStamped& global_pose, int steps)
+    {
+        if(_obstacle_avoidance && _costmap_snapshot.Valid())
+        {
+            const CostmapSnapshot &map = _costmap_snapshot;
+            _distance_field.Update(map.Costs(), map.SizeX(), map.SizeY(), map.Resolution(), map.OriginX(), map.OriginY());
+        }
+
+        // The vehicle frame of the solve is the robot pose in the costmap frame
+        const double ox = global_pose.pose.position.x, oy = global_pose.pose.position.y;
+        const double yaw = tf2::getYaw(global_pose.pose.orientation);
+        const double c = cos(yaw), s = sin(yaw);
+        _obstacle_model.resize(3 * steps);
+        for(int i = 0; i < steps; i++)
+        {
+            const double wx = _lin_x[i], wy = _lin_y[i];
+            // Flat beyond the clearance without the costmap term
+            double d = _obstacle_clearance + 1.0, ddx = 0.0, ddy = 0.0;
+            if(_obstacle_avoidance)
+                _distance_field.Distance(wx, wy, d, ddx, ddy);
+            // Another robot or a scan obstacle closer than the costmap
+            // obstacles takes their place
+            double dn, dnx, dny;
+            if(neighborDistance(i, dt, wx, wy, dn, dnx, dny) && dn < d)
+            {
+                d = dn;
+                ddx = dnx;
+                ddy = dny;
+            }
+            if(movingDistance(i, dt, wx, wy, dn, dnx, dny) && dn < d)
+            {
+                d = dn;
+                ddx = dnx;
+                ddy = dny;
+            }
+            if(_scan_valid && _scan_circles.Distance(wx, wy, dn, dnx, dny) && dn < d)
+            {
+                d = dn;
+                ddx = dnx;
+                ddy = dny;
+            }
+
+            const double px = c * (wx - ox) + s * (wy - oy), py = -s * (wx - ox) + c * (wy - oy);
+            const double gx = c * ddx + s * ddy, gy = -s * ddx + c * ddy;
+            _obstacle_model[3 * i] = d - gx * px - gy * py;
+            _obstacle_model[3 * i + 1] = gx;
+            _obstacle_model[3 * i + 2] = gy;
+        }
+    }
+
+    // Free-space polygon of every step around the points of the horizon, in
+    // the vehicle frame of the solve
+    void MPCPlannerROS::updateCorridor(const geometry_msgs::PoseStamped& global_pose, int steps)
+    {
+        const CostmapSnapshot &map = _costmap_snapshot;
+        if(map.Valid())
+            _free_corridor.Update(_lin_x.data(), _lin_y.data(), steps, map.Costs(), map.SizeX(), map.SizeY(),
+                                  map.Resolution(), map.OriginX(), map.OriginY());
+        const int faces = _free_corridor.Faces();
+        const double ox = global_pose.pose.position.x, oy = global_pose.pose.position.y;
+        const double yaw = tf2::getYaw(global_pose.pose.orientation);
+        _corridor_model.resize(3 * faces * steps);
+        for(int i = 0; i < steps; i++)
+            _free_corridor.Faces(i, ox, oy, yaw, &_corridor_model[3 * faces * i]);
+    }
+
+    // The window of the costmap the horizon can reach this cycle: the
+    // distance at max_speed over the horizon, the footprint and the range
+    // of the obstacle term or the corridor around it
+    void MPCPlannerROS::takeCostmapSnapshot(const geometry_msgs::PoseStamped& global_pose)
+    {
+        _costmap_snapshot.Invalidate();
+        if(!_check_footprint && !_obstacle_avoidance && !_corridor)
+            return;
+        double radius = _roi_radius;
+        if(radius <= 0)
+            radius = _max_speed * (_mpc_steps + 1) * _dt + _fleet_radius
+                   + std::max(_obstacle_clearance + 0.5, _corridor ? _corridor_range : 0.0);
+
+        boost::unique_lock<costmap_2d::Costmap2D::mutex_t> lock(*(costmap_->getMutex()));
+        _costmap_snapshot.Take(costmap_->getCharMap(), costmap_->getSizeInCellsX(), costmap_->getSizeInCellsY(),
+                               costmap_->getResolution(), costmap_->getOriginX(), costmap_->getOriginY(),
+                               global_pose.pose.position.x, global_pose.pose.position.y, radius);
+    }
+
+    // Plans of the other robots around this one at this cycle, and the costmap
+    // to fleet frame transform of both directions of the exchange
+    void MPCPlannerROS::updateNeighbors(const geometry_msgs::PoseStamped& global_pose, double stamp)
+    {
+        _fleet_stamp = stamp;
+        _fleet_valid = false;
+        _near.clear();
+        if(!_fleet)
+            return;
+        tf2::Transform transform;
+        transform.setIdentity();
+        if(_fleet_frame != global_frame_ && !_tf_cache.Lookup(*tf_, _fleet_frame, global_frame_, transform))
+            return;
+        const double yaw = tf2::getYaw(transform.getRotation());
+        _fleet_c = cos(yaw);
+        _fleet_s = sin(yaw);
+        _fleet_tx = transform.getOrigin().x();
+        _fleet_ty = transform.getOrigin().y();
+        _fleet_valid = true;
+
+        const double x = global_pose.pose.position.x, y = global_pose.pose.position.y;
+        _neighbors.Near(_fleet_id, _fleet_c * x - _fleet_s * y + _fleet_tx, _fleet_s * x + _fleet_c * y + _fleet_ty, stamp, _near);
+    }
+
+    // Distance of step i at wx, wy (costmap frame) to the closest other robot
+    // at the time of the step, shifted so that it reads the clearance at the
+    // separation of the two footprints, and its gradient. False if there is
+    // no robot around.
+    bool MPCPlannerROS::neighborDistance(int i, double dt, double wx, double wy, double &d, double &ddx, double &ddy) const
+    {
+        if(!_fleet_valid || _near.empty())
+            return false;
+        const double fx = _fleet_c * wx - _fleet_s * wy + _fleet_tx, fy = _fleet_s * wx + _fleet_c * wy + _fleet_ty;
+        double qx, qy, radius;
+        if(!NeighborPlans::Closest(_near, _fleet_stamp + i * dt, fx, fy, qx, qy, radius))
+            return false;
+        const double dist = hypot(fx - qx, fy - qy);
+        if(dist < 1e-6)
+            return false;
+        d = dist - (radius + _fleet_radius + _fleet_margin) + _obstacle_clearance;
+        const double gx = (fx - qx) / dist, gy = (fy - qy) / dist;
+        ddx = _fleet_c * gx + _fleet_s * gy;
+        ddy = -_fleet_s * gx + _fleet_c * gy;
+        return true;
+    }
+
+    // The tracks of this cycle and the costmap to track frame transform
+    void MPCPlannerROS::updateMovingObstacles(double stamp)
+    {
+        _moving_stamp = stamp;
+        _moving_near.reset();
+        if(!_moving_obstacles)
+            return;
+        tf2::Transform transform;
+        transform.setIdentity();
+        if(_moving_frame != global_frame_ && !_tf_cache.Lookup(*tf_, _moving_frame, global_frame_, transform))
+            return;
+        const double yaw = tf2::getYaw(transform.getRotation());
+        _moving_c = cos(yaw);
+        _moving_s = sin(yaw);
+        _moving_tx = transform.getOrigin().x();
+        _moving_ty = transform.getOrigin().y();
+        _moving_near = _moving.Latest(stamp);
+    }
+
+    // Distance of step i at wx, wy (costmap frame) to the closest track at
+    // the time of the step, shifted like neighborDistance(), and its
+    // gradient. False if no track is near.
+    bool MPCPlannerROS::movingDistance(int i, double dt, double wx, double wy, double &d, double &ddx, double &ddy) const
+    {
+        if(!_moving_near)
+            return false;
+        const double fx = _moving_c * wx - _moving_s * wy + _moving_tx, fy = _moving_s * wx + _moving_c * wy + _moving_ty;
+        double qx, qy, radius;
+        if(!_moving_near->Closest(fx, fy, _moving_stamp + i * dt, qx, qy, radius))
+            return false;
+        const double dist = hypot(fx - qx, fy - qy);
+        if(dist < 1e-6)
+            return false;
+        d = dist - (radius + _fleet_radius + _moving_margin) + _obstacle_clearance;
+        const double gx = (fx - qx) / dist, gy = (fy - qy) / dist;
+        ddx = _moving_c * gx + _moving_s * gy;
+        ddy = -_moving_s * gx + _moving_c * gy;
+        return true;
+    }
+
+    // The prediction of this cycle for the other robots, in the fleet frame
+    void MPCPlannerROS::publishFleetPlan(const geometry_msgs::PoseStamped& global_pose)
+    {
+        const size_t n = _mpc->mpc_x.size();
+        if(!_fleet_valid || n == 0)
+            return;
+        const double ox = global_pose.pose.position.x, oy = global_pose.pose.position.y;
+        const double yaw = tf2::getYaw(global_pose.pose.orientation);
+        const double c = cos(yaw), s = sin(yaw);
+        // Every stride-th step when the horizon is longer than the message
+        const size_t max_steps = mpc_ros::FleetTrajectory::MAX_STEPS;
+        const size_t stride = (n + max_steps - 1) / max_steps;
+
+        mpc_ros::FleetTrajectory &msg = _fleet_msg;
+        msg.header.stamp.fromSec(_fleet_stamp);
+        msg.header.frame_id = _fleet_frame;
+        msg.robot = _fleet_id;
+        msg.radius = _fleet_radius;
+        msg.dt = stride * _mpc->_mpc_dt;
+        msg.steps = 0;
+        for(size_t i = 0; i < n; i += stride)
+        {
+            const double wx = ox + c * _mpc->mpc_x[i] - s * _mpc->mpc_y[i];
+            const double wy = oy + s * _mpc->mpc_x[i] + c * _mpc->mpc_y[i];
+            msg.xy[2 * msg.steps] = _fleet_c * wx - _fleet_s * wy + _fleet_tx;
+            msg.xy[2 * msg.steps + 1] = _fleet_s * wx + _fleet_c * wy + _fleet_ty;
+            msg.steps++;
+        }
+        _pub_fleet.publish(msg);
+    }
+
+    // Circles of the newest scan in the costmap frame, none if the scan is
+    // older than scan_max_age or its frame is not in TF
+    void MPCPlannerROS::updateScanCircles(const geometry_msgs::PoseStamped& global_pose, double stamp)
+    {
+        _scan_valid = false;
+        sensor_msgs::LaserScan::ConstPtr scan = _scan.Get();
+        if(!_scan_obstacles || !scan || stamp - scan->header.stamp.toSec() > _scan_max_age)
+            return;
+        tf2::Transform sensor;
+        if(!_tf_cache.Lookup(*tf_, global_frame_, scan->header.frame_id, sensor))
+            return;
+        _scan_circles.Update(scan->ranges.data(), scan->ranges.size(), scan->angle_min, scan->angle_increment,
+                             scan->range_min, scan->range_max, sensor.getOrigin().x(), sensor.getOrigin().y(),
+                             tf2::getYaw(sensor.getRotation()), global_pose.pose.position.x, global_pose.pose.position.y);
+        _scan_valid = true;
+    }
+
+    // CallBack: newest laser scan, clustered by the next cycle
+    void MPCPlannerROS::scanCB(const sensor_msgs::LaserScan::ConstPtr& msg)
     {
-        double result = 0.0;
-        for (int i = 0; i < coeffs.size(); i++) 
+        _scan.Set(msg);
+    }
+
+    // CallBack: prediction of another robot of the fleet
+    void MPCPlannerROS::fleetCB(const mpc_ros::FleetTrajectory::ConstPtr& msg)
+    {
+        if(msg->robot == _fleet_id || msg->header.frame_id != _fleet_frame)
+            return;
+        const int steps = min(int(msg->steps), int(mpc_ros::FleetTrajectory::MAX_STEPS));
+        _neighbors.Set(msg->robot, msg->header.stamp.toSec(), msg->radius, msg->dt, msg->xy.data(), steps);
+    }
+
+    // Hashed here, off the control cycle
+    void MPCPlannerROS::movingCB(const mpc_ros::TrackedObstacles::ConstPtr& msg)
+    {
+        if(msg->header.frame_id != _moving_frame)
+            return;
+        const size_t n = min(msg->x.size(), min(msg->y.size(), min(msg->vx.size(), min(msg->vy.size(), msg->radius.size()))));
+        _moving_tracks.resize(n);
+        for(size_t i = 0; i < n; i++)
+        {
+            MovingObstacles::Track &track = _moving_tracks[i];
+            track.id = i < msg->id.size() ? msg->id[i] : (unsigned int)i;
+            track.x = msg->x[i];
+            track.y = msg->y[i];
+            track.vx = msg->vx[i];
+            track.vy = msg->vy[i];
+            track.radius = msg->radius[i];
+        }
+        _moving.Set(msg->header.stamp.toSec(), _moving_tracks);
+    }
+
+    void MPCPlannerROS::keepPrediction(const geometry_msgs::PoseStamped& global_pose)
+    {
+        const double ox = global_pose.pose.position.x, oy = global_pose.pose.position.y;
+        const double yaw = tf2::getYaw(global_pose.pose.orientation);
+        const double c = cos(yaw), s = sin(yaw);
+        _prev_plan_x.resize(_mpc->mpc_x.size());
+        _prev_plan_y.resize(_mpc->mpc_x.size());
+        _prev_plan_theta.resize(_mpc->mpc_x.size());
+        _prev_plan_dt = _mpc->_mpc_dt;
+        for(size_t i = 0; i < _mpc->mpc_x.size(); i++)
         {
-            result += coeffs[i] * pow(x, i);
+            _prev_plan_x[i] = ox + c * _mpc->mpc_x[i] - s * _mpc->mpc_y[i];
+            _prev_plan_y[i] = oy + s * _mpc->mpc_x[i] + c * _mpc->mpc_y[i];
+            _prev_plan_theta[i] = yaw + _mpc->mpc_theta[i];
         }
-        return result;
     }
 
-    // Fit a polynomial.
-    // Adapted from
-    // https://github.com/JuliaMath/Polynomials.jl/blob/master/src/Polynomials.jl#L676-L716
-    Eigen::VectorXd MPCPlannerROS::polyfit(Eigen::VectorXd xvals, Eigen::VectorXd yvals, int order) 
+    void MPCPlannerROS::storeSolution(SolutionCache::Solution &solution) const
+    {
+        solution.dt = _mpc->_mpc_dt;
+        solution.x = _mpc->mpc_x;
+        solution.y = _mpc->mpc_y;
+        solution.theta = _mpc->mpc_theta;
+        solution.angvel = _mpc->mpc_angvel;
+        solution.accel = _mpc->mpc_accel;
+        solution.total_cost = _mpc->_mpc_totalcost;
+        solution.cte_cost = _mpc->_mpc_ctecost;
+        solution.etheta_cost = _mpc->_mpc_ethetacost;
+        solution.vel_cost = _mpc->_mpc_velcost;
+        solution.status = _mpc->_mpc_status;
+    }
+
+    void MPCPlannerROS::restoreSolution(const SolutionCache::Solution &solution)
+    {
+        // The rest of the cycle reads the outputs of _mpc as after a solve
+        _mpc->_mpc_dt = solution.dt;
+        _mpc->mpc_x = solution.x;
+        _mpc->mpc_y = solution.y;
+        _mpc->mpc_theta = solution.theta;
+        _mpc->mpc_angvel = solution.angvel;
+        _mpc->mpc_accel = solution.accel;
+        _mpc->_mpc_totalcost = solution.total_cost;
+        _mpc->_mpc_ctecost = solution.cte_cost;
+        _mpc->_mpc_ethetacost = solution.etheta_cost;
+        _mpc->_mpc_velcost = solution.vel_cost;
+        _mpc->_mpc_status = solution.status;
+        _mpc->_mpc_iterations = 0;
+        _mpc->_mpc_tape_ms = 0;
+        _mpc->_mpc_fallback = false;
+    }
+
+    bool MPCPlannerROS::sampledFallback(const Eigen::Vector3f &pos, const Eigen::Vector3f &vel, const Eigen::Vector3f &goal,
+                                        double v_mpc, double w_mpc, base_local_planner::Trajectory &best)
     {
-        assert(xvals.size() == yvals.size());
-        assert(order >= 1 && order <= xvals.size() - 1);
-        Eigen::MatrixXd A(xvals.size(), order + 1);
+        if(!_hybrid_pool)
+            return false;
 
-        for (int i = 0; i < xvals.size(); i++)
-            A(i, 0) = 1.0;
+        // The path and goal costs want the plan in the costmap frame
+        const std::string &frame = costmap_ros_->getGlobalFrameID();
+        tf2::Transform odom_to_costmap;
+        if(!_tf_cache.Lookup(*tf_, frame, _odom_frame, odom_to_costmap))
+            return false;
+        _hybrid_plan.resize(_solve_plan.Size());
+        for(size_t i = 0; i < _solve_plan.Size(); i++)
+        {
+            tf2::Transform pose;
+            tf2::fromMsg(_solve_plan[i].pose, pose);
+            tf2::toMsg(odom_to_costmap * pose, _hybrid_plan[i].pose);
+            _hybrid_plan[i].header.frame_id = frame;
+        }
 
-        for (int j = 0; j < xvals.size(); j++) 
+        // Lattice of constant (v, w) around the MPC command, within the
+        // limits of the generator
+        generator_.initialise(pos, vel, goal, &_solve_cycle.limits, Eigen::Vector3f(_hybrid_v_samples, 1, _hybrid_w_samples));
+        generator_.setParameters(_hybrid_sim_time, costmap_->getResolution(), 0.1, true, _dt);
+        std::vector<base_local_planner::Trajectory> candidates;
+        candidates.reserve(_hybrid_v_samples * _hybrid_w_samples);
+        for(int i = 0; i < _hybrid_v_samples; i++)
         {
-            for (int i = 0; i < order; i++) 
-                A(j, i + 1) = A(j, i) * xvals(j);
+            const double fv = _hybrid_v_samples > 1 ? 2.0 * i / (_hybrid_v_samples - 1) - 1.0 : 0.0;
+            for(int j = 0; j < _hybrid_w_samples; j++)
+            {
+                const double fw = _hybrid_w_samples > 1 ? 2.0 * j / (_hybrid_w_samples - 1) - 1.0 : 0.0;
+                const Eigen::Vector3f target(max(0.0, min(v_mpc + fv * _hybrid_v_range, _max_speed)), 0.0f,
+                                             max(-_max_angvel, min(w_mpc + fw * _hybrid_w_range, _max_angvel)));
+                base_local_planner::Trajectory traj;
+                if(generator_.generateTrajectory(pos, vel, target, traj))
+                    candidates.push_back(traj);
+            }
         }
-        auto Q = A.householderQr();
-        auto result = Q.solve(yvals);
-        return result;
+        if(candidates.empty())
+            return false;
+
+        // The costmap stays locked while the workers read it
+        boost::unique_lock<costmap_2d::Costmap2D::mutex_t> lock(*(costmap_->getMutex()));
+        _hybrid_obstacle_costs->setFootprint(_solve_cycle.footprint);
+        _hybrid_path_costs->setTargetPoses(_hybrid_plan);
+        _hybrid_goal_costs->setTargetPoses(_hybrid_plan);
+        if(!_hybrid_obstacle_costs->prepare() || !_hybrid_path_costs->prepare() || !_hybrid_goal_costs->prepare())
+            return false;
+
+        // Every critic only reads its prepared grid, the candidates are
+        // split over the workers in strides
+        std::vector<double> scores(candidates.size(), -1.0);
+        const int workers = min(_hybrid_pool->Size(), int(candidates.size()));
+        std::mutex mutex;
+        std::condition_variable done;
+        int pending = workers;
+        for(int t = 0; t < workers; t++)
+        {
+            _hybrid_pool->Submit(t, [this, t, workers, &candidates, &scores, &mutex, &done, &pending]()
+            {
+                for(size_t k = t; k < candidates.size(); k += workers)
+                    scores[k] = scored_sampling_planner_.scoreTrajectory(candidates[k], -1.0);
+                std::lock_guard<std::mutex> guard(mutex);
+                if(--pending == 0)
+                    done.notify_one();
+            });
+        }
+        {
+            std::unique_lock<std::mutex> wait(mutex);
+            done.wait(wait, [&pending] { return pending == 0; });
+        }
+
+        // Cheapest candidate that no critic rejected
+        int winner = -1;
+        for(size_t k = 0; k < candidates.size(); k++)
+        {
+            if(scores[k] >= 0.0 && (winner < 0 || scores[k] < scores[winner]))
+                winner = int(k);
+        }
+        if(winner < 0)
+            return false;
+        best = candidates[winner];
+        best.cost_ = scores[winner];
+        return true;
+    }
+
+    int MPCPlannerROS::footprintCost(const std::vector<double> &x, const std::vector<double> &y,
+                                     const std::vector<double> &theta, size_t begin, int &first_lethal)
+    {
+        // The padded footprint of the costmap, masks are only rebuilt when it changes
+        const std::vector<geometry_msgs::Point> &footprint = _solve_cycle.footprint;
+        _footprint.resize(footprint.size());
+        for(size_t i = 0; i < footprint.size(); i++)
+            _footprint[i] = std::make_pair(footprint[i].x, footprint[i].y);
+
+        // Cells off the window would read as free, poses beyond it are
+        // checked in the costmap itself
+        const CostmapSnapshot &map = _costmap_snapshot;
+        if(map.Covers(x.data() + begin, y.data() + begin, x.size() > begin ? x.size() - begin : 0, _fleet_radius))
+        {
+            _footprint_checker.SetFootprint(_footprint, map.Resolution());
+            return _footprint_checker.TrajectoryCost(map.Costs(), map.SizeX(), map.SizeY(), map.OriginX(), map.OriginY(),
+                                                     x.data(), y.data(), theta.data(), x.size(), begin,
+                                                     costmap_2d::LETHAL_OBSTACLE, costmap_2d::NO_INFORMATION, first_lethal);
+        }
+
+        boost::unique_lock<costmap_2d::Costmap2D::mutex_t> lock(*(costmap_->getMutex()));
+        _footprint_checker.SetFootprint(_footprint, costmap_->getResolution());
+        return _footprint_checker.TrajectoryCost(costmap_->getCharMap(), costmap_->getSizeInCellsX(), costmap_->getSizeInCellsY(),
+                                                 costmap_->getOriginX(), costmap_->getOriginY(),
+                                                 x.data(), y.data(), theta.data(), x.size(), begin,
+                                                 costmap_2d::LETHAL_OBSTACLE, costmap_2d::NO_INFORMATION, first_lethal);
     }
 
-    // CallBack: Update odometry
     void MPCPlannerROS::odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg)
     {
-        _odom = *odomMsg;
+        MPC_TRACE_SPAN("odom_cb");
+        _odom.Set(odomMsg);
+        odom_helper_.odomCallback(odomMsg);
+    }
+
+    bool MPCPlannerROS::writeTraceCB(std_srvs::Trigger::Request &req, std_srvs::Trigger::Response &res)
+    {
+        res.success = trace_span::WriteChrome(_trace_path);
+        res.message = res.success ? _trace_path : "cannot write " + _trace_path;
+        return true;
     }
 }
\ No newline at end of file
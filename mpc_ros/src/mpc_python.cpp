@@ -0,0 +1,227 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+#include "batch_solver.h"
+#include "closed_loop_sim.h"
+#include "path_fit.h"
+#include "solve_corpus.h"
+
+namespace py = pybind11;
+
+// Python module mpc_py: the solver core, the path fit and the headless
+// simulator for offline analysis, without ROS topics. The solves run with
+// the GIL released, so other Python threads go on meanwhile.
+//
+//   import mpc_py
+//   params = mpc_py.default_params()
+//   states, coeffs = mpc_py.load_corpus("assets/mpc.csv")
+//   out = mpc_py.BatchSolver(params, threads=8).solve(states, coeffs)
+//   out["angvel"], out["accel"], out["feasible"], ...
+namespace
+{
+    typedef py::array_t<double, py::array::c_style | py::array::forcecast> Array;
+
+    std::map<std::string, double> defaults(const std::map<std::string, double> &params)
+    {
+        std::map<std::string, double> merged = ClosedLoopSim::DefaultParams();
+        for (std::map<std::string, double>::const_iterator it = params.begin(); it != params.end(); ++it)
+            merged[it->first] = it->second;
+        return merged;
+    }
+
+    py::dict solveBatch(const BatchSolver &solver, const Array &states, const Array &coeffs, size_t min_chunk)
+    {
+        if (states.ndim() != 2 || states.shape(1) != 6)
+            throw std::invalid_argument("states is n x 6: x, y, theta, v, cte, etheta");
+        if (coeffs.ndim() != 2 || coeffs.shape(0) != states.shape(0) || coeffs.shape(1) < 1)
+            throw std::invalid_argument("coeffs is n x k, a row per state");
+        const size_t n = states.shape(0);
+        const int n_coeffs = coeffs.shape(1);
+        std::vector<BatchSolver::Result> results(n);
+        {
+            py::gil_scoped_release release;
+            solver.Solve(states.data(), coeffs.data(), n, n_coeffs, results.data(), min_chunk);
+        }
+
+        py::array_t<double> angvel(n), accel(n), cost(n), solve_ms(n);
+        py::array_t<int> status(n), iterations(n);
+        py::array_t<bool> feasible(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            angvel.mutable_at(i) = results[i].angvel;
+            accel.mutable_at(i) = results[i].accel;
+            cost.mutable_at(i) = results[i].cost;
+            solve_ms.mutable_at(i) = results[i].solve_ms;
+            status.mutable_at(i) = results[i].status;
+            iterations.mutable_at(i) = results[i].iterations;
+            feasible.mutable_at(i) = results[i].feasible != 0;
+        }
+        py::dict out;
+        out["angvel"] = angvel;
+        out["accel"] = accel;
+        out["cost"] = cost;
+        out["solve_ms"] = solve_ms;
+        out["status"] = status;
+        out["iterations"] = iterations;
+        out["feasible"] = feasible;
+        return out;
+    }
+
+    // PathFit of the waypoints seen from (px, py, theta), None if they do
+    // not define a polynomial
+    py::object fitPath(const Array &xs, const Array &ys, double px, double py, double theta, int max_order,
+                       double tolerance, double min_window)
+    {
+        if (xs.ndim() != 1 || ys.ndim() != 1 || xs.shape(0) != ys.shape(0))
+            throw std::invalid_argument("xs and ys are arrays of the same length");
+        PathFit fit;
+        fit.SetAdaptive(max_order, tolerance, min_window);
+        if (!fit.Fit(xs.data(), ys.data(), (int)xs.shape(0), px, py, theta))
+            return py::none();
+        const Eigen::VectorXd &c = fit.Coeffs();
+        py::array_t<double> coeffs(c.size());
+        std::copy(c.data(), c.data() + c.size(), coeffs.mutable_data());
+        return coeffs;
+    }
+
+    // Waypoints and the odometry pose to the (state, coeffs) of a solve,
+    // as prepareReference() of MPC_Node without the delay prediction
+    py::object prepare(const Array &xs, const Array &ys, double px, double py, double theta, double v)
+    {
+        py::object coeffs = fitPath(xs, ys, px, py, theta, 0, 0.01, 0.5);
+        if (coeffs.is_none())
+            return py::none();
+        const py::array_t<double> c = coeffs.cast<py::array_t<double> >();
+        py::array_t<double> state(6);
+        double *s = state.mutable_data();
+        s[0] = s[1] = s[2] = 0.0;
+        s[3] = v;
+        s[4] = c.at(0);
+        s[5] = std::atan(c.at(1));
+        return py::make_tuple(state, coeffs);
+    }
+
+    // The samples of a corpus (CSV or TrajectoryLog), coeffs padded with
+    // zeros to the longest polynomial
+    py::tuple loadCorpus(const std::string &path)
+    {
+        std::vector<SolveSample> samples;
+        std::string error;
+        if (!LoadSolveCorpus(path, samples, error))
+            throw std::runtime_error(error);
+        size_t k = 1;
+        for (size_t i = 0; i < samples.size(); i++)
+            k = std::max<size_t>(k, samples[i].coeffs.size());
+        py::array_t<double> states(std::vector<size_t>{samples.size(), 6}), coeffs(std::vector<size_t>{samples.size(), k});
+        std::fill(coeffs.mutable_data(), coeffs.mutable_data() + coeffs.size(), 0.0);
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            std::copy(samples[i].state.data(), samples[i].state.data() + 6, states.mutable_data(i, 0));
+            std::copy(samples[i].coeffs.data(), samples[i].coeffs.data() + samples[i].coeffs.size(), coeffs.mutable_data(i, 0));
+        }
+        return py::make_tuple(states, coeffs);
+    }
+
+    // RandomEpisodes of ClosedLoopSim on threads, a dict of result arrays
+    py::dict simulate(const std::map<std::string, double> &params, const std::map<std::string, double> &plant_keys,
+                      int episodes, const std::string &trajectory, double scale, double duration, double offset,
+                      double heading, unsigned seed, int threads)
+    {
+        PlantConfig plant;
+        for (std::map<std::string, double>::const_iterator it = plant_keys.begin(); it != plant_keys.end(); ++it)
+            if (!ClosedLoopSim::SetPlant(it->first, it->second, plant))
+                throw std::invalid_argument("unknown plant key " + it->first);
+        const std::vector<EpisodeConfig> configs = ClosedLoopSim::RandomEpisodes(episodes, trajectory, scale, duration,
+                                                                                 offset, heading, seed);
+        std::vector<EpisodeResult> results;
+        {
+            py::gil_scoped_release release;
+            ClosedLoopSim::RunAll(defaults(params), plant, configs, threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency()),
+                                  results);
+        }
+
+        const size_t n = results.size();
+        py::array_t<double> cte_rms(n), cte_max(n), etheta_rms(n), distance(n), mean_speed(n), solve_ms_mean(n),
+                            solve_ms_max(n);
+        py::array_t<int> cycles(n), infeasible(n);
+        py::array_t<bool> diverged(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            cte_rms.mutable_at(i) = results[i].cte_rms;
+            cte_max.mutable_at(i) = results[i].cte_max;
+            etheta_rms.mutable_at(i) = results[i].etheta_rms;
+            distance.mutable_at(i) = results[i].distance;
+            mean_speed.mutable_at(i) = results[i].mean_speed;
+            solve_ms_mean.mutable_at(i) = results[i].solve_ms_mean;
+            solve_ms_max.mutable_at(i) = results[i].solve_ms_max;
+            cycles.mutable_at(i) = results[i].cycles;
+            infeasible.mutable_at(i) = results[i].infeasible;
+            diverged.mutable_at(i) = results[i].diverged;
+        }
+        py::dict out;
+        out["cte_rms"] = cte_rms;
+        out["cte_max"] = cte_max;
+        out["etheta_rms"] = etheta_rms;
+        out["distance"] = distance;
+        out["mean_speed"] = mean_speed;
+        out["solve_ms_mean"] = solve_ms_mean;
+        out["solve_ms_max"] = solve_ms_max;
+        out["cycles"] = cycles;
+        out["infeasible"] = infeasible;
+        out["diverged"] = diverged;
+        return out;
+    }
+}
+
+PYBIND11_MODULE(mpc_py, m)
+{
+    m.doc() = "MPC solver core, path fit and headless simulator of mpc_ros";
+
+    m.def("default_params", &ClosedLoopSim::DefaultParams, "MPC::LoadParams keys with the defaults of the tracking node");
+
+    py::class_<BatchSolver>(m, "BatchSolver")
+        .def(py::init([](const std::map<std::string, double> &params, int threads)
+             {
+                 return new BatchSolver(defaults(params), threads);
+             }), py::arg("params") = std::map<std::string, double>(), py::arg("threads") = 0)
+        .def("solve", &solveBatch, py::arg("states"), py::arg("coeffs"), py::arg("min_chunk") = 64,
+             "Solve every row of states (n x 6) with the path of its row of coeffs (n x k), GIL released")
+        .def_property_readonly("threads", &BatchSolver::Threads)
+        .def_property_readonly("params", &BatchSolver::Params);
+
+    m.def("fit_path", &fitPath, py::arg("xs"), py::arg("ys"), py::arg("px"), py::arg("py"), py::arg("theta"),
+          py::arg("max_order") = 0, py::arg("tolerance") = 0.01, py::arg("min_window") = 0.5,
+          "Polynomial of the waypoints in the frame of the pose (px, py, theta), lowest order first, or None");
+    m.def("prepare", &prepare, py::arg("xs"), py::arg("ys"), py::arg("px"), py::arg("py"), py::arg("theta"), py::arg("v"),
+          "(state, coeffs) of a solve from the waypoints and the odometry pose, or None");
+    m.def("load_corpus", &loadCorpus, py::arg("path"),
+          "(states, coeffs) of a solve corpus: a CSV or a trajectory log of the nodes");
+    m.def("simulate", &simulate, py::arg("params") = std::map<std::string, double>(),
+          py::arg("plant") = std::map<std::string, double>(), py::arg("episodes") = 100,
+          py::arg("trajectory") = "all", py::arg("scale") = 1.0, py::arg("duration") = 30.0, py::arg("offset") = 0.3,
+          py::arg("heading") = 0.2, py::arg("seed") = 0u, py::arg("threads") = 0,
+          "Closed-loop episodes of the headless simulator (plant keys as mpc_sim: LATENCY, POS_NOISE, ...), GIL released");
+}
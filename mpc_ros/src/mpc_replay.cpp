@@ -0,0 +1,501 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+// Replay regression run of the controllers, without Gazebo.
+//
+// Feeds a bag of /odom, /tf (/tf_static), the path and whatever else the
+// controller listens to (goal, scans) through one of the controllers in
+// lockstep with the recording: the bag is cut into ticks of 1 / rate
+// seconds, every tick hands all messages up to it to the controller, sets
+// the simulated time and waits for its command. Per tick it records the
+// latency of the command, its difference to the command of the recording
+// and the tracking error of the robot against the path, see
+// include/replay_metrics.h.
+//
+// target "planner": MPCPlannerROS in this process, on a local costmap
+//   (~local_costmap) and a tf2 buffer filled from the bag. The costmap is
+//   updated once per tick (give it update_frequency 0) and
+//   computeVelocityCommands() is timed.
+// target "node": a standalone node (MPC_Node, nav_mpc,
+//   tracking_reference_trajectory) started next to this one with
+//   use_sim_time and controller_freq = rate. Every tick publishes the bag
+//   messages and /clock, the latency is the wall time until the node
+//   publishes on cmd_topic (reply_timeout at most, then the tick is missed).
+//
+// With closed_loop the recorded odometry only gives the start pose: the
+// robot is then moved by the commands (unicycle), published as odom_topic
+// and odom_frame -> base_frame, and the tracking error is the controller's.
+// Open loop it is the one of the recording.
+//
+// The summary is compared with the baseline file; with write_baseline it
+// is stored there instead. Exit status 0 pass, 1 regression, 2 setup error.
+// See launch/mpc_replay.launch.
+
+#include "mpc_plannner_ros.h"
+#include "path_index.h"
+#include "replay_metrics.h"
+
+#include <ros/ros.h>
+#include <rosbag/bag.h>
+#include <rosbag/view.h>
+#include <topic_tools/shape_shifter.h>
+#include <rosgraph_msgs/Clock.h>
+#include <tf2_msgs/TFMessage.h>
+#include <tf2_ros/buffer.h>
+#include <tf2/utils.h>
+#include <tf2_geometry_msgs/tf2_geometry_msgs.h>
+#include <costmap_2d/costmap_2d_ros.h>
+#include <geometry_msgs/Twist.h>
+#include <nav_msgs/Odometry.h>
+#include <nav_msgs/Path.h>
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const double NaN = std::numeric_limits<double>::quiet_NaN();
+
+    std::string stripSlash(const std::string &frame)
+    {
+        return (!frame.empty() && frame[0] == '/') ? frame.substr(1) : frame;
+    }
+
+    // Distance of (x, y) to the path segments around its nearest pose
+    double pathDistance(PathIndex &index, double x, double y)
+    {
+        const CompactPath &path = *index.Path();
+        if (path.Empty())
+            return NaN;
+        const size_t i = index.Nearest(x, y);
+        double best = std::hypot(path.X(i) - x, path.Y(i) - y);
+        for (size_t k = (i > 0 ? i - 1 : 0); k < i + 1 && k + 1 < path.Size(); k++)
+        {
+            const double ax = path.X(k), ay = path.Y(k);
+            const double dx = path.X(k + 1) - ax, dy = path.Y(k + 1) - ay;
+            const double len2 = dx * dx + dy * dy;
+            const double s = len2 > 0 ? std::min(1.0, std::max(0.0, ((x - ax) * dx + (y - ay) * dy) / len2)) : 0.0;
+            best = std::min(best, std::hypot(ax + s * dx - x, ay + s * dy - y));
+        }
+        return best;
+    }
+
+    // Commands of the node under test
+    struct CommandReply
+    {
+        CommandReply() : count(0) {}
+        void callback(const geometry_msgs::Twist::ConstPtr &msg)
+        {
+            twist = *msg;
+            stamp = std::chrono::steady_clock::now();
+            count++;
+        }
+        geometry_msgs::Twist twist;
+        std::chrono::steady_clock::time_point stamp;
+        unsigned int count;
+    };
+}
+
+int main(int argc, char **argv)
+{
+    ros::init(argc, argv, "mpc_replay");
+    ros::NodeHandle nh, pn("~");
+
+    std::string bag_path, target, odom_topic, path_topic, recorded_cmd_topic, cmd_topic;
+    std::string odom_frame, base_frame, baseline_path, csv_path;
+    double rate, reply_timeout, connect_timeout;
+    bool closed_loop, write_baseline;
+    pn.param<std::string>("bag", bag_path, "");
+    pn.param<std::string>("target", target, "node"); // node or planner
+    pn.param("rate", rate, 10.0); // ticks per bag second
+    pn.param<std::string>("odom_topic", odom_topic, "/odom");
+    pn.param<std::string>("path_topic", path_topic, "/move_base/TrajectoryPlannerROS/global_plan");
+    pn.param<std::string>("recorded_cmd_topic", recorded_cmd_topic, "/cmd_vel"); // in the bag
+    pn.param<std::string>("cmd_topic", cmd_topic, "/cmd_vel"); // of the node under test
+    pn.param<std::string>("odom_frame", odom_frame, "odom");
+    pn.param<std::string>("base_frame", base_frame, "base_footprint");
+    pn.param("closed_loop", closed_loop, false);
+    pn.param("reply_timeout", reply_timeout, 0.5); // wall time [s]
+    pn.param("connect_timeout", connect_timeout, 10.0); // until the node subscribes to odom_topic [s]
+    pn.param<std::string>("baseline", baseline_path, "");
+    pn.param("write_baseline", write_baseline, false);
+    pn.param<std::string>("csv", csv_path, ""); // per tick measurements
+
+    // Allowed increase over the baseline, see CompareBaseline()
+    std::map<std::string, ReplayTolerance> tolerances;
+    pn.param("latency_tolerance", tolerances["latency"].relative, 0.25);
+    pn.param("latency_slack_ms", tolerances["latency"].absolute, 2.0);
+    pn.param("cmd_tolerance", tolerances["cmd"].absolute, 0.05); // [m/s], [rad/s]
+    tolerances["cmd"].relative = 0.0;
+    pn.param("tracking_tolerance", tolerances["tracking_error"].absolute, 0.05); // [m]
+    tolerances["tracking_error"].relative = 0.0;
+    pn.param("missed_tolerance", tolerances["missed"].absolute, 0.0); // ticks
+    tolerances["missed"].relative = 0.0;
+    tolerances["default"].relative = 0.1;
+    tolerances["default"].absolute = 0.0;
+
+    const bool planner_target = target == "planner";
+    if (!planner_target && target != "node")
+    {
+        ROS_ERROR("mpc_replay: unknown target %s (node or planner)", target.c_str());
+        return 2;
+    }
+    if (!ros::Time::isSimTime())
+    {
+        ROS_ERROR("mpc_replay: needs /use_sim_time, the ticks set the time");
+        return 2;
+    }
+    if (rate <= 0)
+    {
+        ROS_ERROR("mpc_replay: rate has to be positive");
+        return 2;
+    }
+
+    rosbag::Bag bag;
+    try
+    {
+        bag.open(bag_path, rosbag::bagmode::Read);
+    }
+    catch (const rosbag::BagException &e)
+    {
+        ROS_ERROR("mpc_replay: cannot open bag '%s': %s", bag_path.c_str(), e.what());
+        return 2;
+    }
+    rosbag::View view(bag);
+    if (view.size() == 0)
+    {
+        ROS_ERROR("mpc_replay: bag '%s' is empty", bag_path.c_str());
+        return 2;
+    }
+    const ros::Time begin = view.getBeginTime(), end = view.getEndTime();
+    ros::Time::setNow(begin);
+
+    // Everything the controller may listen to goes out unchanged, latched
+    // so that a path sent before the node subscribed still reaches it.
+    // TF, odometry, the recorded command and /clock are handled below.
+    std::map<std::string, ros::Publisher> passthrough;
+    const std::vector<const rosbag::ConnectionInfo *> connections = view.getConnections();
+    for (size_t i = 0; i < connections.size(); i++)
+    {
+        const rosbag::ConnectionInfo &c = *connections[i];
+        if (c.topic == "/tf" || c.topic == "/tf_static" || c.topic == "/clock" || c.topic == odom_topic
+            || c.topic == recorded_cmd_topic || passthrough.count(c.topic))
+            continue;
+        if (planner_target && c.topic == path_topic)
+            continue; // setPlan() instead
+        ros::AdvertiseOptions options(c.topic, 10, c.md5sum, c.datatype, c.msg_def);
+        options.latch = true;
+        passthrough[c.topic] = nh.advertise(options);
+    }
+    ros::Publisher odom_pub = nh.advertise<nav_msgs::Odometry>(odom_topic, 1);
+    ros::Publisher tf_pub, clock_pub;
+    CommandReply reply;
+    ros::Subscriber cmd_sub;
+    if (!planner_target)
+    {
+        tf_pub = nh.advertise<tf2_msgs::TFMessage>("/tf", 100);
+        clock_pub = nh.advertise<rosgraph_msgs::Clock>("/clock", 1);
+        cmd_sub = nh.subscribe(cmd_topic, 10, &CommandReply::callback, &reply);
+    }
+    ros::Publisher tf_static_pub = nh.advertise<tf2_msgs::TFMessage>("/tf_static", 100, true);
+
+    // Bag messages in time order, fed tick by tick
+    tf2_ros::Buffer buffer(ros::Duration(std::max(10.0, (end - begin).toSec() + 1.0)));
+    PathIndex path_index;
+    nav_msgs::Odometry recorded_odom;
+    bool has_odom = false;
+    geometry_msgs::Twist recorded_cmd;
+    bool has_recorded_cmd = false;
+    std::unique_ptr<costmap_2d::Costmap2DROS> costmap;
+    std::unique_ptr<mpc_ros::MPCPlannerROS> planner;
+    std::vector<geometry_msgs::PoseStamped> pending_plan;
+    bool plan_pending = false;
+
+    rosbag::View::iterator next = view.begin();
+    const auto feed = [&](const ros::Time &until)
+    {
+        for (; next != view.end() && next->getTime() <= until; ++next)
+        {
+            const rosbag::MessageInstance &m = *next;
+            const std::string &topic = m.getTopic();
+            if (topic == "/tf" || topic == "/tf_static")
+            {
+                tf2_msgs::TFMessage::ConstPtr tf = m.instantiate<tf2_msgs::TFMessage>();
+                if (!tf)
+                    continue;
+                const bool is_static = topic == "/tf_static";
+                tf2_msgs::TFMessage kept;
+                for (size_t i = 0; i < tf->transforms.size(); i++)
+                {
+                    // The simulated robot replaces the recorded one
+                    if (closed_loop && stripSlash(tf->transforms[i].child_frame_id) == base_frame)
+                        continue;
+                    buffer.setTransform(tf->transforms[i], "bag", is_static);
+                    kept.transforms.push_back(tf->transforms[i]);
+                }
+                if (is_static)
+                    tf_static_pub.publish(kept);
+                else if (!planner_target)
+                    tf_pub.publish(kept);
+            }
+            else if (topic == odom_topic)
+            {
+                nav_msgs::Odometry::ConstPtr odom = m.instantiate<nav_msgs::Odometry>();
+                if (odom && !(closed_loop && has_odom))
+                {
+                    recorded_odom = *odom;
+                    has_odom = true;
+                }
+            }
+            else if (topic == recorded_cmd_topic)
+            {
+                geometry_msgs::Twist::ConstPtr cmd = m.instantiate<geometry_msgs::Twist>();
+                if (cmd)
+                {
+                    recorded_cmd = *cmd;
+                    has_recorded_cmd = true;
+                }
+            }
+            else if (topic == path_topic)
+            {
+                nav_msgs::Path::ConstPtr path = m.instantiate<nav_msgs::Path>();
+                if (!path)
+                    continue;
+                boost::shared_ptr<CompactPath> indexed = boost::make_shared<CompactPath>();
+                indexed->Set(*path);
+                path_index.Set(indexed);
+                if (planner_target)
+                {
+                    pending_plan = path->poses;
+                    plan_pending = true;
+                }
+                else
+                {
+                    passthrough[topic].publish(m);
+                }
+            }
+            else if (passthrough.count(topic))
+            {
+                passthrough[topic].publish(m);
+            }
+        }
+    };
+
+    // Robot pose of the tick in odom_frame, moved by the commands in closed loop
+    double sim_x = 0, sim_y = 0, sim_yaw = 0, sim_v = 0, sim_w = 0;
+    bool sim_started = false;
+    const double dt = 1.0 / rate;
+
+    if (planner_target)
+    {
+        // The costmap waits for the robot pose, which the first second of the bag has
+        feed(begin + ros::Duration(1.0));
+        costmap.reset(new costmap_2d::Costmap2DROS("local_costmap", buffer));
+        costmap->start();
+        planner.reset(new mpc_ros::MPCPlannerROS());
+        planner->initialize("MPCPlannerROS", &buffer, costmap.get());
+    }
+    else
+    {
+        // The node has to be listening before the first tick
+        const ros::WallTime give_up = ros::WallTime::now() + ros::WallDuration(connect_timeout);
+        while (ros::ok() && odom_pub.getNumSubscribers() == 0 && ros::WallTime::now() < give_up)
+        {
+            ros::WallDuration(0.01).sleep();
+        }
+        if (odom_pub.getNumSubscribers() == 0)
+        {
+            ROS_ERROR("mpc_replay: nobody subscribed to %s within %.1f s", odom_topic.c_str(), connect_timeout);
+            return 2;
+        }
+    }
+
+    ReplayMetrics metrics;
+    for (int k = 0; ros::ok(); k++)
+    {
+        const ros::Time tick = begin + ros::Duration(k * dt);
+        if (tick > end)
+            break;
+        feed(tick);
+        ros::Time::setNow(tick);
+        if (!has_odom)
+            continue;
+
+        nav_msgs::Odometry odom = recorded_odom;
+        if (closed_loop)
+        {
+            if (!sim_started)
+            {
+                sim_x = recorded_odom.pose.pose.position.x;
+                sim_y = recorded_odom.pose.pose.position.y;
+                sim_yaw = tf2::getYaw(recorded_odom.pose.pose.orientation);
+                sim_started = true;
+            }
+            else
+            {
+                sim_x += sim_v * std::cos(sim_yaw) * dt;
+                sim_y += sim_v * std::sin(sim_yaw) * dt;
+                sim_yaw += sim_w * dt;
+            }
+            odom.header.stamp = tick;
+            odom.header.frame_id = odom_frame;
+            odom.child_frame_id = base_frame;
+            odom.pose.pose.position.x = sim_x;
+            odom.pose.pose.position.y = sim_y;
+            odom.pose.pose.position.z = 0;
+            tf2::Quaternion q;
+            q.setRPY(0, 0, sim_yaw);
+            odom.pose.pose.orientation = tf2::toMsg(q);
+            odom.twist.twist = geometry_msgs::Twist();
+            odom.twist.twist.linear.x = sim_v;
+            odom.twist.twist.angular.z = sim_w;
+
+            geometry_msgs::TransformStamped base;
+            base.header = odom.header;
+            base.child_frame_id = base_frame;
+            base.transform.translation.x = sim_x;
+            base.transform.translation.y = sim_y;
+            base.transform.rotation = odom.pose.pose.orientation;
+            buffer.setTransform(base, "replay");
+            if (!planner_target)
+            {
+                tf2_msgs::TFMessage msg;
+                msg.transforms.push_back(base);
+                tf_pub.publish(msg);
+            }
+        }
+
+        ReplayTick t;
+        t.stamp = tick.toSec();
+        t.recorded_v = has_recorded_cmd ? recorded_cmd.linear.x : NaN;
+        t.recorded_w = has_recorded_cmd ? recorded_cmd.angular.z : NaN;
+        t.v = t.w = 0.0;
+        t.latency_ms = 0.0;
+        geometry_msgs::Twist cmd;
+        odom_pub.publish(odom);
+        if (planner_target)
+        {
+            // Delivers odom and the sensor messages to the planner and costmap
+            ros::spinOnce();
+            if (plan_pending)
+            {
+                planner->setPlan(pending_plan);
+                plan_pending = false;
+            }
+            costmap->updateMap();
+            const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+            t.replied = planner->computeVelocityCommands(cmd);
+            t.latency_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        }
+        else
+        {
+            // The node's control timer fires on the new clock
+            const unsigned int count = reply.count;
+            rosgraph_msgs::Clock clock;
+            clock.clock = tick;
+            const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+            clock_pub.publish(clock);
+            const ros::WallTime give_up = ros::WallTime::now() + ros::WallDuration(reply_timeout);
+            while (ros::ok() && reply.count == count && ros::WallTime::now() < give_up)
+            {
+                ros::spinOnce();
+                ros::WallDuration(0.0002).sleep();
+            }
+            t.replied = reply.count != count;
+            if (t.replied)
+            {
+                cmd = reply.twist;
+                t.latency_ms = std::chrono::duration<double, std::milli>(reply.stamp - t0).count();
+            }
+        }
+        if (t.replied)
+        {
+            t.v = cmd.linear.x;
+            t.w = cmd.angular.z;
+        }
+        sim_v = t.v;
+        sim_w = t.w;
+
+        // Robot in the frame of the path
+        t.tracking_error = NaN;
+        if (path_index.Path())
+        {
+            const std::string path_frame = stripSlash(path_index.Path()->Frame());
+            const std::string robot_frame = stripSlash(odom.header.frame_id.empty() ? odom_frame : odom.header.frame_id);
+            try
+            {
+                geometry_msgs::PoseStamped robot, in_path;
+                robot.header.frame_id = robot_frame;
+                robot.pose = odom.pose.pose;
+                if (path_frame.empty() || path_frame == robot_frame)
+                    in_path = robot;
+                else
+                    tf2::doTransform(robot, in_path, buffer.lookupTransform(path_frame, robot_frame, ros::Time(0)));
+                t.tracking_error = pathDistance(path_index, in_path.pose.position.x, in_path.pose.position.y);
+            }
+            catch (const tf2::TransformException &e)
+            {
+                ROS_WARN_THROTTLE(5.0, "mpc_replay: no tracking error, %s", e.what());
+            }
+        }
+        metrics.Add(t);
+    }
+    bag.close();
+
+    const std::map<std::string, double> summary = metrics.Summary();
+    for (std::map<std::string, double>::const_iterator it = summary.begin(); it != summary.end(); ++it)
+    {
+        ROS_INFO("mpc_replay: %s %g", it->first.c_str(), it->second);
+    }
+    if (!csv_path.empty() && !metrics.WriteCsv(csv_path))
+    {
+        ROS_ERROR("mpc_replay: cannot write %s", csv_path.c_str());
+    }
+    if (baseline_path.empty())
+    {
+        return 0;
+    }
+    if (write_baseline)
+    {
+        if (!WriteBaseline(baseline_path, summary))
+        {
+            ROS_ERROR("mpc_replay: cannot write baseline %s", baseline_path.c_str());
+            return 2;
+        }
+        ROS_INFO("mpc_replay: baseline written to %s", baseline_path.c_str());
+        return 0;
+    }
+
+    std::map<std::string, double> baseline;
+    if (!ReadBaseline(baseline_path, baseline))
+    {
+        ROS_ERROR("mpc_replay: cannot read baseline %s", baseline_path.c_str());
+        return 2;
+    }
+    const std::vector<std::string> failures = CompareBaseline(summary, baseline, tolerances);
+    for (size_t i = 0; i < failures.size(); i++)
+    {
+        ROS_ERROR("mpc_replay: regression %s", failures[i].c_str());
+    }
+    ROS_INFO("mpc_replay: %s against %s", failures.empty() ? "PASS" : "FAIL", baseline_path.c_str());
+    return failures.empty() ? 0 : 1;
+}
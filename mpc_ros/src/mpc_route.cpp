@@ -0,0 +1,139 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+// Usage: mpc_route <file> TYPE=name [SPACING=m] [SCALE=s]
+//        mpc_route <file> CSV=route.csv [CLOSED=0|1]
+// Writes a route file for GeonPlanner's ~route_file, see route_store.h.
+// TYPE is a trajectory of reference_trajectory.h, written as a loop. A CSV
+// has one "x,y[,yaw]" pose per line in the route's frame; without yaw the
+// heading points at the next pose.
+
+#include "reference_trajectory.h"
+#include "route_store.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static bool readCsv(const std::string &path, std::vector<double> &x, std::vector<double> &y, std::vector<double> &yaw)
+{
+    std::ifstream file(path.c_str());
+    if (!file)
+    {
+        return false;
+    }
+    bool headings = true;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        double px, py, pyaw;
+        const int n = std::sscanf(line.c_str(), "%lf,%lf,%lf", &px, &py, &pyaw);
+        if (n < 2)
+        {
+            continue; // header or comment
+        }
+        x.push_back(px);
+        y.push_back(py);
+        yaw.push_back(n == 3 ? pyaw : 0.0);
+        headings = headings && n == 3;
+    }
+    if (!headings)
+    {
+        for (size_t i = 0; i + 1 < x.size(); i++)
+        {
+            yaw[i] = std::atan2(y[i + 1] - y[i], x[i + 1] - x[i]);
+        }
+        if (x.size() > 1)
+        {
+            yaw.back() = yaw[x.size() - 2];
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "usage: " << argv[0] << " <file> TYPE=name [SPACING=m] [SCALE=s] | CSV=route.csv [CLOSED=0|1]" << std::endl;
+        return 1;
+    }
+
+    std::string type, csv;
+    double spacing = 0.05, scale = 1.0;
+    bool closed = false;
+    for (int i = 2; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        const size_t eq = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            std::cerr << "ignoring argument " << arg << std::endl;
+            continue;
+        }
+        const std::string key = arg.substr(0, eq);
+        const std::string text = arg.substr(eq + 1);
+        if (key == "TYPE")
+            type = text;
+        else if (key == "CSV")
+            csv = text;
+        else if (key == "SPACING")
+            spacing = std::atof(text.c_str());
+        else if (key == "SCALE")
+            scale = std::atof(text.c_str());
+        else if (key == "CLOSED")
+            closed = std::atoi(text.c_str()) != 0;
+        else
+            std::cerr << "ignoring argument " << arg << std::endl;
+    }
+
+    std::vector<double> x, y, yaw;
+    if (!type.empty())
+    {
+        ReferenceTrajectory reference;
+        if (!reference.Generate(type, spacing, scale))
+        {
+            std::cerr << "unknown trajectory type " << type << std::endl;
+            return 1;
+        }
+        for (size_t i = 0; i < reference.Size(); i++)
+        {
+            x.push_back(reference.X(i));
+            y.push_back(reference.Y(i));
+            yaw.push_back(reference.Theta(i));
+        }
+        closed = true;
+    }
+    else if (!readCsv(csv, x, y, yaw))
+    {
+        std::cerr << "cannot read " << csv << std::endl;
+        return 1;
+    }
+
+    if (!RouteStore::Write(argv[1], x, y, yaw, closed))
+    {
+        std::cerr << "cannot write " << argv[1] << " (" << x.size() << " poses)" << std::endl;
+        return 1;
+    }
+    RouteStore route;
+    route.Open(argv[1]);
+    std::cout << argv[1] << ": " << route.Size() << " poses, " << route.Length() << " m" << (route.Closed() ? ", loop" : "") << std::endl;
+    return 0;
+}
@@ -0,0 +1,226 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+// Trains the NeighborSeed of MPC_Node's mpc_seed_file, see seed_provider.h.
+//
+// Usage: mpc_seed <file> <log> [<log> ...] [KEY=value ...] [THREADS=n] [NEIGHBORS=n] [VALIDATE=n]
+// Each log is a TrajectoryLog file (log_path of the nodes or the .lg of a
+// flight recorder dump). The state and path of every
+// record the node applied are solved again from zero inputs, and the
+// solved input sequences are the training set. KEY is any MPC::LoadParams
+// key and has to match the node configuration (the node checks a hash of
+// them). VALIDATE=n holds every n-th record out and compares the
+// iterations of its solve with and without the seed.
+
+#include "MPC.h"
+#include "control_table.h"
+#include "seed_provider.h"
+#include "trajectory_log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Problem
+{
+    Eigen::VectorXd state, coeffs;
+    bool solved;
+    std::vector<double> angvel, accel;
+    int iterations;
+};
+
+static bool converged(const MPC &mpc)
+{
+    typedef CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> Result;
+    return mpc._mpc_status == Result::success || mpc._mpc_status == Result::stop_at_acceptable_point;
+}
+
+// Iterations of the held out problems from the seed, -1 where it failed
+static void validate(const std::map<std::string, double> &params, const std::shared_ptr<NeighborSeed> &seed,
+                     const std::vector<Problem> &held_out)
+{
+    MPC mpc;
+    mpc.LoadParams(params);
+    mpc.SetSeedProvider(seed);
+    std::vector<int> cold, seeded;
+    int failed = 0;
+    for (size_t i = 0; i < held_out.size(); i++)
+    {
+        if (!held_out[i].solved)
+            continue;
+        mpc.ResetWarmStart();
+        mpc.Solve(held_out[i].state, held_out[i].coeffs);
+        if (!converged(mpc))
+        {
+            failed++;
+            continue;
+        }
+        cold.push_back(held_out[i].iterations);
+        seeded.push_back(mpc._mpc_iterations);
+    }
+    if (cold.empty())
+    {
+        std::printf("validation: no held out problem solved\n");
+        return;
+    }
+    double mean_cold = 0, mean_seeded = 0;
+    for (size_t i = 0; i < cold.size(); i++)
+    {
+        mean_cold += cold[i];
+        mean_seeded += seeded[i];
+    }
+    std::sort(cold.begin(), cold.end());
+    std::sort(seeded.begin(), seeded.end());
+    const size_t p99 = std::min(cold.size() - 1, (size_t)std::ceil(0.99 * cold.size()) - 1);
+    std::printf("validation %zu problems: iterations mean %.1f -> %.1f, p99 %d -> %d, %d failed from the seed\n",
+                cold.size(), mean_cold / cold.size(), mean_seeded / cold.size(), cold[p99], seeded[p99], failed);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "usage: " << argv[0] << " <file> <log> [<log> ...] [KEY=value ...] [THREADS=n] [NEIGHBORS=n] [VALIDATE=n]" << std::endl;
+        return 1;
+    }
+
+    // Same defaults as the MPC_Node parameters
+    std::map<std::string, double> params;
+    params["DT"]        = 0.1;
+    params["STEPS"]     = 40.0;
+    params["REF_CTE"]   = 0.0;
+    params["REF_ETHETA"] = 0.0;
+    params["REF_V"]     = 1.0;
+    params["W_CTE"]     = 5000.0;
+    params["W_EPSI"]    = 5000.0;
+    params["W_V"]       = 1.0;
+    params["W_ANGVEL"]  = 100.0;
+    params["W_A"]       = 50.0;
+    params["W_DANGVEL"] = 10.0;
+    params["W_DA"]      = 10.0;
+    params["ANGVEL"]    = 3.0;
+    params["MAXTHR"]    = 1.0;
+    params["BOUND"]     = 1.0e3;
+    params["TAPE"]      = 1.0;
+    params["ADAPTIVE"]  = 0.0;
+    params["MIN_STEPS"] = 10.0;
+    params["HORIZON_PREVIEW"] = 1.0;
+
+    std::vector<std::string> logs;
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    int neighbors = 3, holdout = 0;
+    for (int i = 2; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        const size_t eq = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            logs.push_back(arg);
+            continue;
+        }
+        const std::string key = arg.substr(0, eq);
+        const std::string text = arg.substr(eq + 1);
+        if (key == "THREADS")
+            threads = std::max(1, std::atoi(text.c_str()));
+        else if (key == "NEIGHBORS")
+            neighbors = std::max(1, std::atoi(text.c_str()));
+        else if (key == "VALIDATE")
+            holdout = std::max(0, std::atoi(text.c_str()));
+        else
+            params[key] = std::atof(text.c_str());
+    }
+    // Every problem is solved on its own, from zero inputs
+    params["WARM"] = 0.0;
+    params["PURSUIT_SEED"] = 0.0;
+
+    // Cycles the node applied, the held out ones apart
+    std::vector<Problem> problems, held_out;
+    for (size_t f = 0; f < logs.size(); f++)
+    {
+        std::vector<TrajectoryRecord> records;
+        if (!TrajectoryLog::Read(logs[f], records))
+        {
+            std::cerr << "cannot read " << logs[f] << std::endl;
+            return 1;
+        }
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            if (records[i].flags & TrajectoryRecord::INFEASIBLE)
+                continue;
+            Problem problem;
+            problem.state = Eigen::Map<const Eigen::VectorXd>(records[i].state, 6);
+            problem.coeffs = Eigen::Map<const Eigen::VectorXd>(records[i].coeffs, 4);
+            problem.solved = false;
+            problem.iterations = -1;
+            const size_t n = problems.size() + held_out.size();
+            (holdout > 0 && n % holdout == size_t(holdout - 1) ? held_out : problems).push_back(problem);
+        }
+    }
+    std::cout << "mpc_seed: " << problems.size() << " problems, " << held_out.size() << " held out, on "
+              << threads << " threads" << std::endl;
+
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++)
+    {
+        pool.emplace_back([&, t]
+        {
+            MPC mpc;
+            mpc.LoadParams(params);
+            const size_t total = problems.size() + held_out.size();
+            for (size_t i = t; i < total; i += threads)
+            {
+                Problem &problem = i < problems.size() ? problems[i] : held_out[i - problems.size()];
+                mpc.Solve(problem.state, problem.coeffs);
+                problem.solved = converged(mpc);
+                problem.angvel = mpc.mpc_angvel;
+                problem.accel = mpc.mpc_accel;
+                problem.iterations = mpc._mpc_iterations;
+            }
+        });
+    }
+    for (int t = 0; t < threads; t++)
+        pool[t].join();
+
+    std::shared_ptr<NeighborSeed> seed = std::make_shared<NeighborSeed>();
+    seed->Create(params["STEPS"], ControlTable::HashParams(params));
+    seed->SetNeighbors(neighbors);
+    size_t failed = 0;
+    for (size_t i = 0; i < problems.size(); i++)
+    {
+        if (!problems[i].solved || !seed->Add(problems[i].state, problems[i].coeffs, problems[i].angvel, problems[i].accel))
+            failed++;
+    }
+    std::printf("solved in %.1f s, %zu samples, %zu problems failed (left out)\n",
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count(), seed->Size(), failed);
+
+    if (!seed->Write(argv[1]))
+    {
+        std::cerr << "cannot write " << argv[1] << std::endl;
+        return 1;
+    }
+    if (!held_out.empty())
+        validate(params, seed, held_out);
+    return 0;
+}
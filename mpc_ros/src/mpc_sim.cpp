@@ -0,0 +1,162 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+// Closed-loop runs of the tracking controller, see closed_loop_sim.h.
+//
+// Usage: mpc_sim [KEY=value ...]
+// KEY is any MPC::LoadParams key (STEPS, DT, TAPE, W_CTE, ...) or one of
+// ClosedLoopSim's (PATH_LENGTH, DELAY_MODE, MAX_SPEED, DIVERGENCE,
+// CONTROLLER=1/2 for Pure Pursuit or DWA, see tracking_controller.h), and
+//
+//   EPISODES=n    runs (100), THREADS=n side by side (one per core)
+//   TRAJ=type     circle, epitrochoid, square, infinite, or all (default),
+//                 which takes them in turn; SCALE of the curves (1)
+//   SECONDS=t     simulated time of a run (30)
+//   OFFSET=d, HEADING=a  the initial lateral offset [m] and heading error
+//                 [rad] of a run are drawn from [-d, d] and [-a, a] (0.3,
+//                 0.2), its start on the loop from [0, 1)
+//   SEED=s        of run i is s + i (0), the runs do not depend on THREADS
+//   PLANT=0/1     unicycle or differential drive, LATENCY [s], POS_NOISE
+//                 [m], YAW_NOISE [rad], VEL_NOISE [m/s], SUBSTEP [s],
+//                 TRACK_WIDTH, WHEEL_RADIUS [m], MAX_WHEEL_SPEED [rad/s],
+//                 WHEEL_TAU [s], see PlantConfig
+//   CSV=file      one line per run
+//
+// The summary has the distribution of the tracking error over the runs and
+// how much faster than real time they went. Exit status 2 if a run
+// diverged, so a parameter change can be checked in a script, e.g.
+//   rosrun mpc_ros mpc_sim EPISODES=2000 W_CTE=3000 LATENCY=0.1 POS_NOISE=0.02
+
+#include "closed_loop_sim.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+static double percentile(std::vector<double> values, double p)
+{
+    if (values.empty())
+        return 0.0;
+    std::sort(values.begin(), values.end());
+    const size_t i = std::min(values.size() - 1, size_t(p * (values.size() - 1) + 0.5));
+    return values[i];
+}
+
+int main(int argc, char **argv)
+{
+    std::map<std::string, double> params = ClosedLoopSim::DefaultParams();
+
+    PlantConfig plant;
+    int episodes = 100;
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    std::string traj = "all", csv;
+    double scale = 1.0, seconds = 30.0, offset = 0.3, heading = 0.2;
+    unsigned seed = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        const size_t eq = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            std::cerr << "ignoring argument " << arg << std::endl;
+            continue;
+        }
+        const std::string key = arg.substr(0, eq);
+        const std::string text = arg.substr(eq + 1);
+        const double value = std::atof(text.c_str());
+        if (key == "EPISODES")
+            episodes = std::max(1, (int)value);
+        else if (key == "THREADS")
+            threads = std::max(1, (int)value);
+        else if (key == "TRAJ")
+            traj = text;
+        else if (key == "CSV")
+            csv = text;
+        else if (key == "SCALE")
+            scale = value;
+        else if (key == "SECONDS")
+            seconds = value;
+        else if (key == "OFFSET")
+            offset = value;
+        else if (key == "HEADING")
+            heading = value;
+        else if (key == "SEED")
+            seed = (unsigned)value;
+        else if (!ClosedLoopSim::SetPlant(key, value, plant))
+            params[key] = value;
+    }
+
+    const std::vector<EpisodeConfig> runs = ClosedLoopSim::RandomEpisodes(episodes, traj, scale, seconds, offset,
+                                                                           heading, seed);
+
+    std::vector<EpisodeResult> results;
+    const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    ClosedLoopSim::RunAll(params, plant, runs, threads, results);
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    std::vector<double> cte_rms, cte_max, etheta_rms, speed, solve_ms;
+    int diverged = 0, infeasible = 0, cycles = 0;
+    double solve_max = 0.0;
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const EpisodeResult &r = results[i];
+        cte_rms.push_back(r.cte_rms);
+        cte_max.push_back(r.cte_max);
+        etheta_rms.push_back(r.etheta_rms);
+        speed.push_back(r.mean_speed);
+        solve_ms.push_back(r.solve_ms_mean);
+        diverged += r.diverged;
+        infeasible += r.infeasible;
+        cycles += r.cycles;
+        solve_max = std::max(solve_max, r.solve_ms_max);
+    }
+    const double simulated = cycles * params["DT"];
+    std::printf("runs          %d on %d threads, %.0f s simulated in %.1f s wall (%.0fx real time)\n",
+                episodes, std::min(threads, episodes), simulated, wall, wall > 0.0 ? simulated / wall : 0.0);
+    std::printf("diverged      %d\n", diverged);
+    std::printf("infeasible    %d of %d solves\n", infeasible, cycles);
+    std::printf("              p50      p90      max\n");
+    std::printf("cte rms [m]   %.4f   %.4f   %.4f\n", percentile(cte_rms, 0.5), percentile(cte_rms, 0.9),
+                percentile(cte_rms, 1.0));
+    std::printf("cte max [m]   %.4f   %.4f   %.4f\n", percentile(cte_max, 0.5), percentile(cte_max, 0.9),
+                percentile(cte_max, 1.0));
+    std::printf("eth rms [rad] %.4f   %.4f   %.4f\n", percentile(etheta_rms, 0.5), percentile(etheta_rms, 0.9),
+                percentile(etheta_rms, 1.0));
+    std::printf("speed [m/s]   %.4f   %.4f   %.4f\n", percentile(speed, 0.5), percentile(speed, 0.9),
+                percentile(speed, 1.0));
+    std::printf("solve [ms]    %.3f    %.3f    %.3f (slowest solve)\n", percentile(solve_ms, 0.5),
+                percentile(solve_ms, 0.9), solve_max);
+
+    if (!csv.empty())
+    {
+        std::ofstream out(csv.c_str());
+        out << "run,trajectory,start,offset,heading,cte_rms,cte_max,etheta_rms,distance,mean_speed,cycles,"
+               "infeasible,solve_ms_mean,solve_ms_max,diverged\n";
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const EpisodeConfig &c = runs[i];
+            const EpisodeResult &r = results[i];
+            out << i << "," << c.trajectory << "," << c.start << "," << c.offset << "," << c.heading << ","
+                << r.cte_rms << "," << r.cte_max << "," << r.etheta_rms << "," << r.distance << ","
+                << r.mean_speed << "," << r.cycles << "," << r.infeasible << "," << r.solve_ms_mean << ","
+                << r.solve_ms_max << "," << r.diverged << "\n";
+        }
+    }
+    return diverged > 0 ? 2 : 0;
+}
@@ -0,0 +1,963 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+// Offline MPC solve benchmark.
+//
+// Replays recorded (state, coeffs) samples through MPC::Solve without ROS
+// and reports the solve latency percentiles, Ipopt iterations and the
+// distribution of solver statuses. The CSV layouts and trajectory logs it
+// reads are those of solve_corpus.h.
+//
+// Usage: mpc_solve_bench <file.csv> [KEY=value ...] [REPEAT=n] [THREADS=n]
+// KEY is any MPC::LoadParams key (STEPS, DT, TAPE, WARM, ...), PATH_HEADING=0
+// solves the model of nav_mpc. HESSIAN=0/1/2
+// compares the exact, Gauss-Newton and limited-memory Hessians: latency and
+// iterations against the mean cost of the returned solutions, HYPOTHESES=n
+// the multi-start solve against the single one.
+//
+// THREADS=n then replays the samples once more on n MPC instances running
+// side by side, each of which has to reproduce the costs of the first
+// sequential pass (exit status 2 otherwise), see cppad_parallel.h.
+//
+// In the planner build OBSTACLE=x puts a 0.2 m block on the path of every
+// sample, x meters ahead, feeds the obstacle term as MPCPlannerROS does
+// (W_OBS, CLEARANCE) and reports the clearance of the predictions.
+// PATH_HEADING defaults to 0 there, the model of the plugin.
+//
+// ADAPTIVE=1 reports how often each horizon of the adaptive mode was
+// picked, see horizon_selector.h. Its choice depends on the measured solve
+// times, the THREADS pass cannot reproduce it. BLOCKS=1,1,2,4,8 holds the
+// inputs over blocks of steps, see move_blocks.h. POLICY=1 stops Ipopt at
+// the tolerances of each phase, see solve_policy.h; compare the iterations
+// and costs against POLICY=0.
+//
+// RETUNE=n calls LoadParams again every n samples, every other time with
+// W_CTE doubled and, with RETUNE_STEPS=m, m steps, and counts the solves
+// that recorded a tape: weights go to the tape as parameters, a new
+// horizon is recorded on the side (see model_params.h and tape_builder.h).
+// The THREADS pass does not retune. PREPARE=1 records the tapes in the
+// background before the first sample, as the planner does in initialize()
+// (MPC::Prepare); compare the first solve.
+// CHECKPOINT=1 records the dynamics as one atomic operation per step,
+// see step_model.h.
+//
+// PROFILE=1 (TAPE=1) reports the size of the tape before and after CppAD's
+// optimize() and the time spent in each Ipopt callback; compare the levels
+// of OPTIMIZE=0/1/2, see tape_optimize.h. With HESSIAN_COLORING=0/1/2 it
+// compares the colors, i.e. the directions of eval_h, of the Hessian
+// colorings. eval_h does up to 16 colors in one forward-over-reverse pass; a
+// bench built with -DCPPAD_SPARSE_HESSIAN_MAX_MULTIPLE_DIRECTION=1 does a
+// pair of sweeps per color. With HESSIAN_REUSE=k (HESSIAN_REUSE_STEP,
+// HESSIAN_REUSE_LAMBDA) it adds the eval_h calls per solve answered with
+// the previous Hessian; compare the iterations and the eval_h time to k=0.
+// The sparsity line gives the representation and the time of the pattern
+// sweeps of the last tape, compare SPARSITY=0/1, see sparsity_patterns.h.
+// PERF=1 adds the hardware counters of each callback and of the rest of the
+// solve (Ipopt's linear solves and its own work): instructions per cycle
+// and cache and branch misses per 1000 instructions, see perf_counters.h.
+// ENERGY=1 reports the joules per solve next to the latency, from RAPL, the
+// perf power PMU or a hwmon rail (see energy_meter.h), and above the idle
+// draw measured over half a second before the first solve. With PROFILE=1
+// it splits them into the function, derivative and Ipopt parts by the time
+// of the callbacks. The meter counts the whole package or board: run the
+// bench alone, with THREADS=1.
+//
+// JACOBIAN_SWEEP=1 replays the samples with the tape backend at 20, 40 and
+// 80 steps for each sparse Jacobian method (JACOBIAN=0 reverse, 1 forward
+// coloring, 2 subgraphs) and reports the eval_jac_g time next to the solve
+// latency; the costs of the three methods have to agree. The forward method
+// sweeps up to 64 colors at once (Forward(1, r, dx)); a bench built with
+// -DCPPAD_SPARSE_JACOBIAN_MAX_MULTIPLE_DIRECTION=1 sweeps one per color.
+//
+// SIMD_EVAL=1 rolls the model out under 64 constant inputs from
+// the state of every sample and evaluates the cost and constraints of the
+// rollouts with MPC::EvaluateFG at 1, 4 and 8 points per sweep, see
+// simd_double.h. The widths have to agree, and the constraints of the
+// rollouts vanish.
+//
+// CONDENSED_SWEEP=1 replays the samples at 10, 20, 40 and 80
+// steps in the multiple shooting layout and with CONDENSED=1, where only
+// the inputs are variables, on the backend of the other arguments (TAPE).
+// It reports the size of the NLP, the iterations and the latency; the mean
+// costs of the two formulations should agree.
+
+// LINEAR_SWEEP=1 replays the samples on every Ipopt linear
+// solver of linear_solver.h (LINEAR_ORDER and LINEAR_THREADS as given) and
+// reports which are in the Ipopt build, their latency and failed solves;
+// the costs should agree. LINEAR_SOLVER takes the names as well, e.g.
+// LINEAR_SOLVER=ma27. MPC_Node's mpc_linear_solver: auto makes the same
+// choice at startup on synthetic samples, see MPC::CalibrateLinearSolver.
+
+// PRECISION_SWEEP=1 replays the samples with the tape backend
+// in double and with PRECISION=1, where Ipopt gets the Jacobian and the
+// Hessian from a float tape (see TapeSolver::RecordSingle). It reports
+// the latency, the eval_jac_g and eval_h time, the iterations, and how far
+// the first controls and the costs of the mixed solves are from the
+// double ones.
+
+// CHECK=1 compares the hand-written derivatives of
+// AnalyticSolver (ANALYTIC=1) with CppAD on the FG_eval tape, for both
+// heading rows (PATH_HEADING): the cost, its gradient, the constraints,
+// the Jacobian and the Lagrangian Hessian at 4 points around the rollout of
+// every sample, with random obj_factor and multipliers. Exit status 2 when
+// one differs by more than CHECK_TOL (default 1e-9) relative to
+// max(1, |tape|), or when the other keys leave the unicycle model with
+// Euler steps.
+
+// MPC_BENCH_PLANNER: the build of the obstacle term, on the distance field
+// of distance_field.h
+#include "MPC.h"
+#include "analytic_solver.h"
+#include "mpc_fg_eval.h"
+#if defined(MPC_BENCH_PLANNER)
+#include "distance_field.h"
+#endif
+#include "solve_corpus.h"
+#include "move_blocks.h"
+#include "tape_solver.h"
+#include "sparsity_patterns.h"
+#include "linear_solver.h"
+#include "perf_counters.h"
+#include "energy_meter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef SolveSample Sample;
+
+static double percentile(const std::vector<double> &sorted, double p)
+{
+    if (sorted.empty())
+        return 0.0;
+    // Nearest rank
+    const int k = (int)std::ceil(p * sorted.size()) - 1;
+    return sorted[std::min(std::max(k, 0), (int)sorted.size() - 1)];
+}
+
+#if defined(MPC_BENCH_PLANNER)
+// 4 x 4 m costmap around the robot with a block at (ahead, f(ahead)) of the
+// sample path, and the obstacle model linearized along the path
+static void obstacleModel(const Sample &sample, double ahead, int steps, double dt, double speed,
+                          DistanceField &field, std::vector<double> &model)
+{
+    const int size = 80;
+    const double res = 0.05, origin_x = -1.0, origin_y = -2.0;
+    std::vector<unsigned char> costs(size * size, 0);
+    double by = 0.0;
+    for (int k = sample.coeffs.size() - 1; k >= 0; k--)
+        by = by * ahead + sample.coeffs[k];
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            const double cx = origin_x + (x + 0.5) * res, cy = origin_y + (y + 0.5) * res;
+            if (std::fabs(cx - ahead) < 0.1 && std::fabs(cy - by) < 0.1)
+                costs[y * size + x] = 254;
+        }
+    }
+    field.Update(costs.data(), size, size, res, origin_x, origin_y);
+
+    model.resize(3 * steps);
+    for (int i = 0; i < steps; i++)
+    {
+        const double px = sample.state[0] + i * dt * speed;
+        double py = 0.0;
+        for (int k = sample.coeffs.size() - 1; k >= 0; k--)
+            py = py * px + sample.coeffs[k];
+        double d, gx, gy;
+        field.Distance(px, py, d, gx, gy);
+        model[3 * i] = d - gx * px - gy * py;
+        model[3 * i + 1] = gx;
+        model[3 * i + 2] = gy;
+    }
+}
+#endif
+
+static void jacobianSweep(std::map<std::string, double> params, const std::vector<Sample> &samples,
+                          const std::vector<int> &blocks)
+{
+    static const int steps[] = {20, 40, 80};
+    static const char *methods[] = {"reverse", "forward", "subgraph"};
+    params["TAPE"] = 1.0;
+    std::printf("steps  jacobian  jac calls/solve  jac mean [us]  jac ms/solve  first [ms]  latency mean [ms]  cost mean\n");
+    for (int s = 0; s < 3; s++)
+    {
+        for (int method = 0; method < 3; method++)
+        {
+            params["STEPS"] = steps[s];
+            params["JACOBIAN"] = method;
+            MPC mpc;
+            mpc.LoadParams(params);
+            mpc.SetMoveBlocks(blocks);
+            int calls = 0;
+            double jac_ms = 0.0, first_ms = 0.0, latency_sum = 0.0, cost_sum = 0.0;
+            for (size_t i = 0; i < samples.size(); i++)
+            {
+                const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+                mpc.Solve(samples[i].state, samples[i].coeffs);
+                const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+                if (i == 0)
+                    first_ms = ms;
+                latency_sum += ms;
+                cost_sum += mpc._mpc_totalcost;
+                calls += mpc._mpc_tape_profile.calls[TapeProfile::EVAL_JAC_G];
+                jac_ms += mpc._mpc_tape_profile.callback_ms[TapeProfile::EVAL_JAC_G];
+            }
+            const double n = samples.size();
+            std::printf("%5d  %-8s  %15.2f  %13.2f  %12.3f  %10.3f  %17.3f  %.4f\n", steps[s], methods[method],
+                        calls / n, calls > 0 ? 1000.0 * jac_ms / calls : 0.0, jac_ms / n, first_ms,
+                        latency_sum / n, cost_sum / n);
+        }
+    }
+}
+
+static void linearSweep(std::map<std::string, double> params, const std::vector<Sample> &samples,
+                        const std::vector<int> &blocks)
+{
+    typedef CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> Result;
+    std::printf("solver   first [ms]  latency mean [ms]  latency p95 [ms]  iterations mean  failed  cost mean\n");
+    for (int backend = linear_solver::DEFAULT; backend < linear_solver::NUM_BACKENDS; backend++)
+    {
+        params["LINEAR_SOLVER"] = backend;
+        MPC mpc;
+        mpc.LoadParams(params);
+        mpc.SetMoveBlocks(blocks);
+        std::vector<double> latency;
+        double iterations = 0.0, cost_sum = 0.0;
+        int failed = 0;
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+            mpc.Solve(samples[i].state, samples[i].coeffs);
+            latency.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count());
+            const bool ok = mpc._mpc_status == Result::success || mpc._mpc_status == Result::stop_at_acceptable_point;
+            if (i == 0 && !ok)
+                break; // not in the Ipopt build
+            failed += ok ? 0 : 1;
+            iterations += mpc._mpc_iterations;
+            cost_sum += mpc._mpc_totalcost;
+        }
+        if (latency.size() < samples.size())
+        {
+            std::printf("%-7s  unavailable\n", linear_solver::Name(backend));
+            continue;
+        }
+        const double n = samples.size();
+        const double first_ms = latency.front();
+        double latency_sum = 0.0;
+        for (size_t i = 0; i < latency.size(); i++)
+            latency_sum += latency[i];
+        std::sort(latency.begin(), latency.end());
+        std::printf("%-7s  %10.3f  %17.3f  %16.3f  %15.2f  %6d  %.4f\n", linear_solver::Name(backend), first_ms,
+                    latency_sum / n, percentile(latency, 0.95), iterations / n, failed, cost_sum / n);
+    }
+}
+
+static void condensedSweep(std::map<std::string, double> params, const std::vector<Sample> &samples,
+                           const std::vector<int> &blocks)
+{
+    static const int steps[] = {10, 20, 40, 80};
+    static const char *layouts[] = {"multiple", "condensed"};
+    std::printf("steps  layout     vars  constraints  iterations mean  first [ms]  latency mean [ms]  latency p95 [ms]  cost mean\n");
+    for (int s = 0; s < 4; s++)
+    {
+        for (int condensed = 0; condensed < 2; condensed++)
+        {
+            params["STEPS"] = steps[s];
+            params["CONDENSED"] = condensed;
+            MPC mpc;
+            mpc.LoadParams(params);
+            mpc.SetMoveBlocks(blocks);
+            const int n_inputs = blocks.empty() ? steps[s] - 1 : MoveBlockIndex(blocks, steps[s]).back() + 1;
+            std::vector<double> latency;
+            double iterations = 0.0, cost_sum = 0.0;
+            for (size_t i = 0; i < samples.size(); i++)
+            {
+                const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+                mpc.Solve(samples[i].state, samples[i].coeffs);
+                latency.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count());
+                iterations += mpc._mpc_iterations;
+                cost_sum += mpc._mpc_totalcost;
+            }
+            const double n = samples.size();
+            const double first_ms = latency.front();
+            double latency_sum = 0.0;
+            for (size_t i = 0; i < latency.size(); i++)
+                latency_sum += latency[i];
+            std::sort(latency.begin(), latency.end());
+            std::printf("%5d  %-9s  %4d  %11d  %15.2f  %10.3f  %17.3f  %16.3f  %.4f\n", steps[s], layouts[condensed],
+                        condensed ? 2 * n_inputs : 6 * steps[s] + 2 * n_inputs, condensed ? 0 : 6 * steps[s],
+                        iterations / n, first_ms, latency_sum / n, percentile(latency, 0.95), cost_sum / n);
+        }
+    }
+}
+
+static void precisionSweep(std::map<std::string, double> params, const std::vector<Sample> &samples,
+                           const std::vector<int> &blocks)
+{
+    typedef CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> Result;
+    static const char *modes[] = {"double", "mixed"};
+    params["TAPE"] = 1.0;
+    std::vector<double> angvel[2], accel[2], cost[2];
+    std::printf("precision  latency mean [ms]  latency p95 [ms]  jac+hes ms/solve  iterations mean  failed  cost mean\n");
+    for (int mode = 0; mode < 2; mode++)
+    {
+        params["PRECISION"] = mode;
+        MPC mpc;
+        mpc.LoadParams(params);
+        mpc.SetMoveBlocks(blocks);
+        std::vector<double> latency;
+        double iterations = 0.0, derivative_ms = 0.0, cost_sum = 0.0;
+        int failed = 0;
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+            const std::vector<double> result = mpc.Solve(samples[i].state, samples[i].coeffs);
+            latency.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count());
+            iterations += mpc._mpc_iterations;
+            derivative_ms += mpc._mpc_tape_profile.callback_ms[TapeProfile::EVAL_JAC_G]
+                             + mpc._mpc_tape_profile.callback_ms[TapeProfile::EVAL_H];
+            cost_sum += mpc._mpc_totalcost;
+            failed += mpc._mpc_status == Result::success || mpc._mpc_status == Result::stop_at_acceptable_point ? 0 : 1;
+            angvel[mode].push_back(result[0]);
+            accel[mode].push_back(result[1]);
+            cost[mode].push_back(mpc._mpc_totalcost);
+        }
+        const double n = samples.size();
+        double latency_sum = 0.0;
+        for (size_t i = 0; i < latency.size(); i++)
+            latency_sum += latency[i];
+        std::sort(latency.begin(), latency.end());
+        std::printf("%-9s  %17.3f  %16.3f  %16.3f  %15.2f  %6d  %.4f\n", modes[mode], latency_sum / n,
+                    percentile(latency, 0.95), derivative_ms / n, iterations / n, failed, cost_sum / n);
+    }
+
+    double angvel_diff = 0.0, accel_diff = 0.0, cost_diff = 0.0;
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        angvel_diff = std::max(angvel_diff, std::fabs(angvel[1][i] - angvel[0][i]));
+        accel_diff = std::max(accel_diff, std::fabs(accel[1][i] - accel[0][i]));
+        cost_diff = std::max(cost_diff, std::fabs(cost[1][i] - cost[0][i]) / std::max(1.0, std::fabs(cost[0][i])));
+    }
+    std::printf("mixed - double: max |angvel| %.3g rad/s, max |accel| %.3g m/s^2, max relative cost %.3g\n",
+                angvel_diff, accel_diff, cost_diff);
+}
+
+// Model of FG_eval from state under constant inputs, in the layout of its variables
+static void rollout(const Sample &sample, int steps, double dt, double angvel, double accel, std::vector<double> &vars)
+{
+    const Eigen::VectorXd &c = sample.coeffs;
+    vars.assign(steps * 8 - 2, 0.0);
+    for (int k = 0; k < 6; k++)
+        vars[k * steps] = sample.state[k];
+    for (int i = 0; i + 1 < steps; i++)
+    {
+        const double x = vars[i], y = vars[steps + i], theta = vars[2 * steps + i];
+        const double v = vars[3 * steps + i], etheta = vars[5 * steps + i];
+        double f = 0.0, grad = 0.0;
+        for (int k = c.size() - 1; k >= 0; k--)
+        {
+            grad = grad * x + f;
+            f = f * x + c[k];
+        }
+        vars[i + 1] = x + v * std::cos(theta) * dt;
+        vars[steps + i + 1] = y + v * std::sin(theta) * dt;
+        vars[2 * steps + i + 1] = theta + angvel * dt;
+        vars[3 * steps + i + 1] = v + accel * dt;
+        vars[4 * steps + i + 1] = (f - y) + v * std::sin(etheta) * dt;
+        vars[5 * steps + i + 1] = (theta - std::atan(grad)) + angvel * dt;
+        vars[6 * steps + i] = angvel;
+        vars[7 * steps - 1 + i] = accel;
+    }
+}
+
+static void simdEval(const std::map<std::string, double> &params, const std::vector<Sample> &samples)
+{
+    static const int widths[] = {1, 4, 8};
+    const int steps = params.at("STEPS");
+    const double dt = params.at("DT");
+    std::vector<std::vector<std::vector<double> > > points(samples.size());
+    for (size_t s = 0; s < samples.size(); s++)
+    {
+        points[s].resize(64);
+        for (int k = 0; k < 64; k++)
+            rollout(samples[s], steps, dt, -1.0 + (k % 8) / 3.5, -0.5 + (k / 8) / 7.0, points[s][k]);
+    }
+
+    MPC mpc;
+    mpc.LoadParams(params);
+    std::vector<std::vector<double> > fg, reference;
+    std::printf("width  us/point  speedup  max |cost - width 1|  max |g|\n");
+    double us_one = 0.0;
+    for (int w = 0; w < 3; w++)
+    {
+        mpc.EvaluateFG(samples[0].coeffs, points[0], fg, widths[w]); // records
+        double cost_diff = 0.0, g_max = 0.0;
+        const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        const int reps = 20;
+        for (int r = 0; r < reps; r++)
+        {
+            for (size_t s = 0; s < samples.size(); s++)
+            {
+                mpc.EvaluateFG(samples[s].coeffs, points[s], fg, widths[w]);
+                if (r > 0)
+                    continue;
+                for (size_t k = 0; k < fg.size(); k++)
+                {
+                    if (w == 0)
+                        reference.push_back(fg[k]);
+                    cost_diff = std::max(cost_diff, std::fabs(fg[k][0] - reference[s * 64 + k][0]));
+                    // fg[1 + k steps] is the initial state, the rest the dynamics
+                    for (size_t j = 1; j < fg[k].size(); j++)
+                        g_max = std::max(g_max, std::fabs(fg[k][j] - ((j - 1) % steps == 0 ? points[s][k][j - 1] : 0.0)));
+                }
+            }
+        }
+        const double us = 1000.0 * std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()
+                          / (reps * samples.size() * 64.0);
+        if (w == 0)
+            us_one = us;
+        std::printf("%5d  %8.3f  %7.2f  %20.3g  %7.3g\n", widths[w], us, us_one / us, cost_diff, g_max);
+    }
+}
+
+// Largest |a - b| / max(1, |b|) so far
+static void relativeError(double a, double b, double &worst)
+{
+    worst = std::max(worst, std::fabs(a - b) / std::max(1.0, std::fabs(b)));
+}
+
+// AnalyticSolver against the FG_eval tape, both heading rows: f and its
+// gradient, g, the dense Jacobian and the lower triangle of the Lagrangian
+// Hessian at points around the rollout of each sample, with random
+// obj_factor and multipliers. Entries outside the hand-written patterns
+// have to vanish in the tape as well.
+static int analyticCheck(std::map<std::string, double> params, const std::vector<Sample> &samples, double tol)
+{
+    typedef CPPAD_TESTVECTOR(double) Dvector;
+    typedef CPPAD_TESTVECTOR(CppAD::AD<double>) ADvector;
+    const int steps = params.at("STEPS");
+    const double dt = params.at("DT");
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> noise(-0.5, 0.5), weight(-2.0, 2.0), factor(0.1, 2.0);
+    std::printf("heading  points  f          grad_f     g          jacobian   hessian\n");
+    int failed = 0;
+    for (int heading = 0; heading < 2; heading++)
+    {
+        params["PATH_HEADING"] = heading;
+        size_t n, m;
+        mpc_fg_eval_size(params, n, m);
+        AnalyticSolver analytic;
+        analytic.LoadParams(params);
+        analytic.SetPathHeading(heading != 0);
+        if (n != analytic.NumVars() || m != 1 + analytic.NumConstraints())
+        {
+            std::printf("CHECK needs the unicycle model with Euler steps, FG_eval has %zu variables and %zu rows\n", n, m);
+            return 2;
+        }
+        double err_f = 0.0, err_grad = 0.0, err_g = 0.0, err_jac = 0.0, err_hes = 0.0;
+        int points = 0;
+        std::vector<double> vars, grad(n), g(m - 1), jac, hes, lambda(m - 1);
+        for (size_t s = 0; s < samples.size(); s++)
+        {
+            for (int p = 0; p < 4; p++)
+            {
+                rollout(samples[s], steps, dt, weight(rng) / 4.0, weight(rng) / 4.0, vars);
+                Dvector x(n);
+                for (size_t j = 0; j < n; j++)
+                    x[j] = vars[j] + noise(rng);
+
+                ADvector a_x(n), a_fg;
+                for (size_t j = 0; j < n; j++)
+                    a_x[j] = x[j];
+                CppAD::Independent(a_x);
+                mpc_fg_eval(params, samples[s].coeffs, a_x, a_fg);
+                CppAD::ADFun<double> fun(a_x, a_fg);
+                const Dvector fg = fun.Forward(0, x);
+                const Dvector dense_jac = fun.Jacobian(x);
+                Dvector w(m);
+                w[0] = factor(rng);
+                for (size_t i = 0; i < m - 1; i++)
+                {
+                    lambda[i] = weight(rng);
+                    w[1 + i] = lambda[i];
+                }
+                const Dvector dense_hes = fun.Hessian(x, w);
+
+                analytic.Prepare(samples[s].coeffs);
+                relativeError(analytic.Cost(x.data()), fg[0], err_f);
+                analytic.Gradient(x.data(), grad.data());
+                for (size_t j = 0; j < n; j++)
+                    relativeError(grad[j], dense_jac[j], err_grad);
+                analytic.Constraints(x.data(), g.data());
+                for (size_t i = 0; i < m - 1; i++)
+                    relativeError(g[i], fg[1 + i], err_g);
+
+                // The hand-written entries summed into dense matrices
+                const std::vector<int> &row_jac = analytic.JacobianRows(), &col_jac = analytic.JacobianCols();
+                std::vector<double> values(row_jac.size());
+                analytic.Jacobian(x.data(), values.data());
+                jac.assign((m - 1) * n, 0.0);
+                for (size_t k = 0; k < values.size(); k++)
+                    jac[row_jac[k] * n + col_jac[k]] += values[k];
+                for (size_t i = 0; i < m - 1; i++)
+                    for (size_t j = 0; j < n; j++)
+                        relativeError(jac[i * n + j], dense_jac[(1 + i) * n + j], err_jac);
+
+                const std::vector<int> &row_hes = analytic.HessianRows(), &col_hes = analytic.HessianCols();
+                values.resize(row_hes.size());
+                analytic.Hessian(x.data(), w[0], lambda.data(), values.data());
+                hes.assign(n * n, 0.0);
+                for (size_t k = 0; k < values.size(); k++)
+                    hes[row_hes[k] * n + col_hes[k]] += values[k];
+                for (size_t i = 0; i < n; i++)
+                    for (size_t j = 0; j <= i; j++)
+                        relativeError(hes[i * n + j], dense_hes[i * n + j], err_hes);
+                points++;
+            }
+        }
+        std::printf("%7d  %6d  %-9.3g  %-9.3g  %-9.3g  %-9.3g  %-9.3g\n", heading, points, err_f, err_grad, err_g,
+                    err_jac, err_hes);
+        if (std::max(std::max(std::max(err_f, err_grad), std::max(err_g, err_jac)), err_hes) > tol)
+            failed++;
+    }
+    std::printf("%s, tolerance %g relative to max(1, |tape|)\n", failed ? "FAILED" : "passed", tol);
+    return failed ? 2 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " <file.csv> [KEY=value ...] [REPEAT=n] [THREADS=n]" << std::endl;
+        return 1;
+    }
+
+    // Same defaults as the MPC_Node parameters
+    std::map<std::string, double> params;
+    params["DT"]        = 0.1;
+    params["STEPS"]     = 40.0;
+    params["REF_CTE"]   = 0.0;
+    params["REF_ETHETA"] = 0.0;
+    params["REF_V"]     = 1.0;
+    params["W_CTE"]     = 5000.0;
+    params["W_EPSI"]    = 5000.0;
+    params["W_V"]       = 1.0;
+    params["W_ANGVEL"]  = 100.0;
+    params["W_A"]       = 50.0;
+    params["W_DANGVEL"] = 10.0;
+    params["W_DA"]      = 10.0;
+    params["ANGVEL"]    = 3.0;
+    params["MAXTHR"]    = 1.0;
+    params["BOUND"]     = 1.0e3;
+    params["TAPE"]      = 1.0;
+    params["WARM"]      = 1.0;
+    params["HESSIAN"]   = 0.0;
+    params["HYPOTHESES"] = 1.0;
+#if defined(MPC_BENCH_PLANNER)
+    // The turn-rate heading model of MPCPlannerROS
+    params["PATH_HEADING"] = 0.0;
+#endif
+    int repeat = 1, threads = 1;
+    double obstacle = 0.0;
+    std::vector<int> blocks;
+    int retune = 0, retune_steps = 0;
+    bool prepare = false, profile = false, jacobian_sweep = false, simd_eval = false, condensed_sweep = false;
+    bool linear_sweep = false, precision_sweep = false, perf = false, energy = false, check = false;
+    double check_tol = 1e-9;
+
+    for (int i = 2; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        const size_t eq = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            std::cerr << "ignoring argument " << arg << std::endl;
+            continue;
+        }
+        const std::string key = arg.substr(0, eq);
+        const double value = std::atof(arg.substr(eq + 1).c_str());
+        if (key == "REPEAT")
+            repeat = std::max(1, (int)value);
+        else if (key == "THREADS")
+            threads = std::max(1, (int)value);
+        else if (key == "OBSTACLE")
+            obstacle = value;
+        else if (key == "BLOCKS")
+            blocks = ParseMoveBlocks(arg.substr(eq + 1));
+        else if (key == "RETUNE")
+            retune = std::max(0, (int)value);
+        else if (key == "RETUNE_STEPS")
+            retune_steps = std::max(0, (int)value);
+        else if (key == "PREPARE")
+            prepare = value != 0.0;
+        else if (key == "PROFILE")
+            profile = value != 0.0;
+        else if (key == "PERF")
+            perf = value != 0.0;
+        else if (key == "ENERGY")
+            energy = value != 0.0;
+        else if (key == "JACOBIAN_SWEEP")
+            jacobian_sweep = value != 0.0;
+        else if (key == "SIMD_EVAL")
+            simd_eval = value != 0.0;
+        else if (key == "CONDENSED_SWEEP")
+            condensed_sweep = value != 0.0;
+        else if (key == "LINEAR_SWEEP")
+            linear_sweep = value != 0.0;
+        else if (key == "PRECISION_SWEEP")
+            precision_sweep = value != 0.0;
+        else if (key == "CHECK")
+            check = value != 0.0;
+        else if (key == "CHECK_TOL")
+            check_tol = value;
+        else if (key == "LINEAR_SOLVER" && linear_solver::Parse(arg.substr(eq + 1)) >= 0)
+            params[key] = linear_solver::Parse(arg.substr(eq + 1));
+        else
+            params[key] = value;
+    }
+
+    std::vector<Sample> samples;
+    std::string error;
+    if (!LoadSolveCorpus(argv[1], samples, error))
+    {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+
+    if (jacobian_sweep)
+    {
+        jacobianSweep(params, samples, blocks);
+        return 0;
+    }
+    if (linear_sweep)
+    {
+        linearSweep(params, samples, blocks);
+        return 0;
+    }
+    if (simd_eval)
+    {
+        simdEval(params, samples);
+        return 0;
+    }
+    if (condensed_sweep)
+    {
+        condensedSweep(params, samples, blocks);
+        return 0;
+    }
+    if (precision_sweep)
+    {
+        precisionSweep(params, samples, blocks);
+        return 0;
+    }
+    if (check)
+        return analyticCheck(params, samples, check_tol);
+
+    MPC mpc;
+    mpc.LoadParams(params);
+    mpc.SetMoveBlocks(blocks);
+    if (prepare)
+        mpc.Prepare(4, obstacle > 0.0);
+
+    std::vector<double> latency_ms;
+    std::map<int, int> status_count;
+    std::map<int, int> iter_count;
+    long iter_sum = 0, iter_n = 0;
+    double cost_sum = 0.0;
+    std::vector<double> first_cost;
+    std::map<std::pair<int, double>, int> horizon_count;
+    TapeProfile tape, callbacks; // last recording, callbacks of all solves
+    int profiled = 0;
+    perf_counters::Counts solve_perf; // solves that were profiled
+    if (perf && !perf_counters::Enable())
+        std::cerr << "cannot open the hardware counters (kernel.perf_event_paranoid?)" << std::endl;
+    std::vector<double> energy_mj;
+    double idle_w = 0.0;
+    if (energy && !energy_meter::Enable())
+        std::cerr << "no readable energy counter (RAPL needs root since Linux 5.10)" << std::endl;
+    else if (energy)
+    {
+        EnergyClock idle;
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        idle_w = idle.Lap() / 0.5;
+    }
+    int retunes = 0, recordings = 0;
+#if defined(MPC_BENCH_PLANNER)
+    DistanceField field;
+    std::vector<double> model;
+    std::vector<double> clearance;
+#endif
+    for (int r = 0; r < repeat; r++)
+    {
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            if (retune > 0 && (r > 0 || i > 0) && i % retune == 0)
+            {
+                std::map<std::string, double> tuned = params;
+                if (++retunes % 2 == 1)
+                {
+                    tuned["W_CTE"] *= 2.0;
+                    if (retune_steps > 0)
+                        tuned["STEPS"] = retune_steps;
+                }
+                mpc.LoadParams(tuned);
+                mpc.SetMoveBlocks(blocks);
+            }
+#if defined(MPC_BENCH_PLANNER)
+            if (obstacle > 0.0)
+            {
+                int steps;
+                double dt;
+                mpc.PlannedHorizon(samples[i].state[3], samples[i].coeffs, steps, dt);
+                obstacleModel(samples[i], obstacle, steps, dt, params["REF_V"], field, model);
+                mpc.SetObstacleModel(model);
+            }
+#endif
+            PerfClock perf_clock;
+            EnergyClock energy_clock;
+            const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+            mpc.Solve(samples[i].state, samples[i].coeffs);
+            const std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+            const perf_counters::Counts perf_solve = perf_clock.Lap();
+            if (energy_meter::Enabled())
+                energy_mj.push_back(1000.0 * energy_clock.Lap());
+#if defined(MPC_BENCH_PLANNER)
+            if (obstacle > 0.0)
+            {
+                double closest = 1e9, d, gx, gy;
+                for (size_t k = 1; k < mpc.mpc_x.size(); k++)
+                {
+                    field.Distance(mpc.mpc_x[k], mpc.mpc_y[k], d, gx, gy);
+                    closest = std::min(closest, d);
+                }
+                clearance.push_back(closest);
+            }
+#endif
+
+            horizon_count[std::make_pair((int)mpc.mpc_x.size(), mpc._mpc_dt)]++;
+            if (mpc._mpc_tape_ms > 0.0)
+                recordings++;
+
+            const TapeProfile &solve_profile = mpc._mpc_tape_profile;
+            if (solve_profile.size_op > 0)
+            {
+                tape = solve_profile;
+                profiled++;
+                for (int k = 0; k < TapeProfile::NUM_CALLBACKS; k++)
+                {
+                    callbacks.calls[k] += solve_profile.calls[k];
+                    callbacks.callback_ms[k] += solve_profile.callback_ms[k];
+                    callbacks.callback_perf[k] += solve_profile.callback_perf[k];
+                }
+                callbacks.hessian_reuses += solve_profile.hessian_reuses;
+                solve_perf += perf_solve;
+            }
+
+            latency_ms.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+            status_count[mpc._mpc_status]++;
+            cost_sum += mpc._mpc_totalcost;
+            if (r == 0)
+                first_cost.push_back(mpc._mpc_totalcost);
+            if (mpc._mpc_iterations >= 0)
+            {
+                iter_count[mpc._mpc_iterations]++;
+                iter_sum += mpc._mpc_iterations;
+                iter_n++;
+            }
+        }
+    }
+
+    std::vector<double> sorted(latency_ms);
+    std::sort(sorted.begin(), sorted.end());
+    double sum = 0.0;
+    for (size_t i = 0; i < sorted.size(); i++)
+        sum += sorted[i];
+
+    std::printf("samples %zu x %d, STEPS %g, TAPE %g, WARM %g, HESSIAN %g, BLOCKS %zu\n",
+                samples.size(), repeat, params["STEPS"], params["TAPE"], params["WARM"], params["HESSIAN"], blocks.size());
+    std::printf("latency [ms]  mean %.3f  p50 %.3f  p95 %.3f  p99 %.3f  max %.3f\n",
+                sum / sorted.size(), percentile(sorted, 0.50), percentile(sorted, 0.95),
+                percentile(sorted, 0.99), sorted.back());
+    std::printf("first solve   %.3f ms\n", latency_ms.front());
+    if (!energy_mj.empty())
+    {
+        std::vector<double> sorted_mj(energy_mj);
+        std::sort(sorted_mj.begin(), sorted_mj.end());
+        double mj = 0.0;
+        for (size_t i = 0; i < sorted_mj.size(); i++)
+            mj += sorted_mj[i];
+        mj /= sorted_mj.size();
+        std::printf("energy [mJ]   %s  mean %.3f  p50 %.3f  p95 %.3f  max %.3f  idle %.2f W\n",
+                    energy_meter::Name(), mj, percentile(sorted_mj, 0.50), percentile(sorted_mj, 0.95),
+                    sorted_mj.back(), idle_w);
+        // What the solves draw above idle, e.g. to compare horizons
+        std::printf("above idle    %.3f mJ/solve", std::max(0.0, mj - idle_w * sum / sorted.size()));
+        if (iter_n > 0)
+            std::printf("  %.4f mJ/iteration", std::max(0.0, mj - idle_w * sum / sorted.size()) * sorted.size() / iter_sum);
+        std::printf("\n");
+    }
+    std::printf("cost          mean %.4f\n", cost_sum / sorted.size());
+    if (iter_n > 0)
+    {
+        std::printf("iterations    mean %.2f\n", (double)iter_sum / iter_n);
+        for (std::map<int, int>::const_iterator it = iter_count.begin(); it != iter_count.end(); ++it)
+            std::printf("  %4d iter  %d\n", it->first, it->second);
+    }
+    else
+    {
+        std::printf("iterations    n/a (only reported with TAPE=1)\n");
+    }
+    std::printf("status\n");
+    for (std::map<int, int>::const_iterator it = status_count.begin(); it != status_count.end(); ++it)
+        std::printf("  %4d  %d\n", it->first, it->second);
+    if (params["ADAPTIVE"] != 0.0)
+    {
+        std::printf("horizon\n");
+        for (std::map<std::pair<int, double>, int>::const_iterator it = horizon_count.begin(); it != horizon_count.end(); ++it)
+            std::printf("  %4d x %.3f s  %d\n", it->first.first, it->first.second, it->second);
+    }
+    if (profile && profiled > 0)
+    {
+        static const char *names[TapeProfile::NUM_CALLBACKS] = {"eval_f", "eval_grad_f", "eval_g", "eval_jac_g", "eval_h"};
+        std::printf("tape          OPTIMIZE %g  size_var %zu -> %zu  size_op %zu -> %zu  optimize %.3f ms\n",
+                    params.count("OPTIMIZE") ? params["OPTIMIZE"] : (double)tape_optimize::STRAIGHT_LINE,
+                    tape.recorded_var, tape.size_var, tape.recorded_op, tape.size_op, tape.optimize_ms);
+        std::printf("sparsity      SPARSITY %g  %s  %.3f ms\n", params.count("SPARSITY") ? params["SPARSITY"] : -1.0,
+                    sparsity_patterns::Name(tape.sparsity), tape.sparsity_ms);
+        std::printf("hessian       HESSIAN_COLORING %g (%s)  %zu colors\n", params["HESSIAN_COLORING"],
+                    TapeSolver::HessianColoring(params["HESSIAN_COLORING"]), tape.hessian_colors);
+        std::printf("callbacks     calls/solve  mean [us]  ms/solve\n");
+        for (int k = 0; k < TapeProfile::NUM_CALLBACKS; k++)
+        {
+            const int calls = callbacks.calls[k];
+            std::printf("  %-11s %11.2f %10.2f %9.3f\n", names[k], (double)calls / profiled,
+                        calls > 0 ? 1000.0 * callbacks.callback_ms[k] / calls : 0.0,
+                        callbacks.callback_ms[k] / profiled);
+        }
+        if (params.count("HESSIAN_REUSE") && params["HESSIAN_REUSE"] > 0)
+            std::printf("  %-11s %11.2f  of the eval_h calls, HESSIAN_REUSE %g\n", "reused", (double)callbacks.hessian_reuses / profiled,
+                        params["HESSIAN_REUSE"]);
+        if (!energy_mj.empty())
+        {
+            // By the time of the callbacks: the meter updates about every ms
+            double mj = 0.0;
+            for (size_t i = 0; i < energy_mj.size(); i++)
+                mj += energy_mj[i];
+            const double per_ms = mj / sum;
+            const double function_ms = callbacks.callback_ms[TapeProfile::EVAL_F] + callbacks.callback_ms[TapeProfile::EVAL_G];
+            const double derivative_ms = callbacks.callback_ms[TapeProfile::EVAL_GRAD_F] + callbacks.callback_ms[TapeProfile::EVAL_JAC_G]
+                                         + callbacks.callback_ms[TapeProfile::EVAL_H];
+            std::printf("energy split  function %.3f  derivatives %.3f  ipopt %.3f mJ/solve\n",
+                        per_ms * function_ms / profiled, per_ms * derivative_ms / profiled,
+                        std::max(0.0, mj / energy_mj.size() - per_ms * (function_ms + derivative_ms) / profiled));
+        }
+        if (perf_counters::Enabled())
+        {
+            // What the callbacks do not count is Ipopt's
+            perf_counters::Counts rest = solve_perf;
+            std::printf("counters      instr/solve  IPC  cache-miss/kI  branch-miss/kI\n");
+            for (int k = 0; k <= TapeProfile::NUM_CALLBACKS; k++)
+            {
+                const bool ipopt = k == TapeProfile::NUM_CALLBACKS;
+                const perf_counters::Counts &c = ipopt ? rest : callbacks.callback_perf[k];
+                if (!ipopt)
+                    rest = rest - c;
+                const double instr = c.value[perf_counters::INSTRUCTIONS];
+                const double cycles = c.value[perf_counters::CYCLES];
+                std::printf("  %-11s %11.0f %5.2f %14.2f %15.2f\n", ipopt ? "ipopt" : names[k], instr / profiled,
+                            cycles > 0 ? instr / cycles : 0.0,
+                            instr > 0 ? 1000.0 * c.value[perf_counters::CACHE_MISSES] / instr : 0.0,
+                            instr > 0 ? 1000.0 * c.value[perf_counters::BRANCH_MISSES] / instr : 0.0);
+            }
+        }
+    }
+    else if (profile)
+    {
+        std::printf("tape          n/a (only profiled with TAPE=1)\n");
+    }
+    if (retune > 0)
+    {
+        std::printf("retune        %d LoadParams, %d solves recorded a tape\n", retunes, recordings);
+        if (params["ADAPTIVE"] == 0.0)
+        {
+            std::printf("horizon\n");
+            for (std::map<std::pair<int, double>, int>::const_iterator it = horizon_count.begin(); it != horizon_count.end(); ++it)
+                std::printf("  %4d x %.3f s  %d\n", it->first.first, it->first.second, it->second);
+        }
+    }
+#if defined(MPC_BENCH_PLANNER)
+    if (!clearance.empty())
+    {
+        std::sort(clearance.begin(), clearance.end());
+        std::printf("clearance [m] min %.3f  p50 %.3f\n", clearance.front(), percentile(clearance, 0.50));
+    }
+#endif
+
+    // Concurrent solves, each on an MPC of its own
+    if (threads < 2)
+        return 0;
+    std::vector<double> max_diff(threads, 0.0);
+    std::vector<std::thread> pool;
+    const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++)
+    {
+        pool.emplace_back([&, t]
+        {
+            MPC local;
+            local.LoadParams(params);
+            local.SetMoveBlocks(blocks);
+#if defined(MPC_BENCH_PLANNER)
+            DistanceField local_field;
+            std::vector<double> local_model;
+#endif
+            for (size_t i = 0; i < samples.size(); i++)
+            {
+#if defined(MPC_BENCH_PLANNER)
+                if (obstacle > 0.0)
+                {
+                    int steps;
+                    double dt;
+                    local.PlannedHorizon(samples[i].state[3], samples[i].coeffs, steps, dt);
+                    obstacleModel(samples[i], obstacle, steps, dt, params["REF_V"], local_field, local_model);
+                    local.SetObstacleModel(local_model);
+                }
+#endif
+                local.Solve(samples[i].state, samples[i].coeffs);
+                const double diff = std::fabs(local._mpc_totalcost - first_cost[i])
+                                    / std::max(1.0, std::fabs(first_cost[i]));
+                max_diff[t] = std::max(max_diff[t], diff);
+            }
+        });
+    }
+    for (int t = 0; t < threads; t++)
+        pool[t].join();
+    const double wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    const double worst = *std::max_element(max_diff.begin(), max_diff.end());
+    std::printf("threads %d     wall %.1f ms for %zu solves, max relative cost difference %g\n",
+                threads, wall_ms, threads * samples.size(), worst);
+    return (worst < 1e-6) ? 0 : 2;
+}
@@ -0,0 +1,190 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+// Tabulates the first control of MPC::Solve for MPC_Node's mpc_table mode,
+// see control_table.h.
+//
+// Usage: mpc_table <file> [KEY=value ...] [AXIS=min:max:n ...] [THREADS=n] [VALIDATE=n]
+// KEY is any MPC::LoadParams key and has to match the node configuration
+// (the node checks a hash of them). AXIS is V, CTE, ETHETA, C2 or C3, the
+// grid of that coordinate. VALIDATE=n solves n random points inside the
+// grid afterwards and reports the interpolation error against them.
+
+#include "MPC.h"
+#include "control_table.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// First control of a fresh solve, false if Ipopt did not converge
+static bool solvePoint(MPC &mpc, const double query[ControlTable::DIMS], double &angvel, double &accel)
+{
+    Eigen::VectorXd state, coeffs;
+    ControlTable::Problem(query, state, coeffs);
+    const std::vector<double> result = mpc.Solve(state, coeffs);
+    angvel = result[0];
+    accel = result[1];
+    typedef CppAD::ipopt::solve_result<CPPAD_TESTVECTOR(double)> Result;
+    return mpc._mpc_status == Result::success || mpc._mpc_status == Result::stop_at_acceptable_point;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " <file> [KEY=value ...] [AXIS=min:max:n ...] [THREADS=n] [VALIDATE=n]" << std::endl;
+        return 1;
+    }
+
+    // Same defaults as the MPC_Node parameters
+    std::map<std::string, double> params;
+    params["DT"]        = 0.1;
+    params["STEPS"]     = 40.0;
+    params["REF_CTE"]   = 0.0;
+    params["REF_ETHETA"] = 0.0;
+    params["REF_V"]     = 1.0;
+    params["W_CTE"]     = 5000.0;
+    params["W_EPSI"]    = 5000.0;
+    params["W_V"]       = 1.0;
+    params["W_ANGVEL"]  = 100.0;
+    params["W_A"]       = 50.0;
+    params["W_DANGVEL"] = 10.0;
+    params["W_DA"]      = 10.0;
+    params["ANGVEL"]    = 3.0;
+    params["MAXTHR"]    = 1.0;
+    params["BOUND"]     = 1.0e3;
+    params["TAPE"]      = 1.0;
+    params["ADAPTIVE"]  = 0.0;
+    params["MIN_STEPS"] = 10.0;
+    params["HORIZON_PREVIEW"] = 1.0;
+
+    const char *names[ControlTable::DIMS] = { "V", "CTE", "ETHETA", "C2", "C3" };
+    ControlTable::Axis axes[ControlTable::DIMS] = {
+        { 0.0, 1.0, 6 }, { -0.5, 0.5, 9 }, { -0.8, 0.8, 9 }, { -1.0, 1.0, 7 }, { -0.5, 0.5, 5 } };
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    int validate = 0;
+
+    for (int i = 2; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        const size_t eq = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            std::cerr << "ignoring argument " << arg << std::endl;
+            continue;
+        }
+        const std::string key = arg.substr(0, eq);
+        const std::string text = arg.substr(eq + 1);
+        const int axis = std::find(names, names + ControlTable::DIMS, key) - names;
+        if (axis < ControlTable::DIMS)
+        {
+            ControlTable::Axis &a = axes[axis];
+            if (std::sscanf(text.c_str(), "%lf:%lf:%d", &a.min, &a.max, &a.n) != 3 || a.n < 2 || a.max <= a.min)
+            {
+                std::cerr << "bad axis " << arg << ", expected min:max:n" << std::endl;
+                return 1;
+            }
+        }
+        else if (key == "THREADS")
+            threads = std::max(1, std::atoi(text.c_str()));
+        else if (key == "VALIDATE")
+            validate = std::max(0, std::atoi(text.c_str()));
+        else
+            params[key] = std::atof(text.c_str());
+    }
+    // Every point is solved on its own, from the same start
+    params["WARM"] = 0.0;
+
+    ControlTable table;
+    table.Create(axes, ControlTable::HashParams(params));
+    std::cout << "mpc_table: " << table.Size() << " points on " << threads << " threads" << std::endl;
+
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    std::vector<size_t> failed(threads, 0);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++)
+    {
+        pool.emplace_back([&, t]
+        {
+            MPC mpc;
+            mpc.LoadParams(params);
+            double query[ControlTable::DIMS], angvel, accel;
+            for (size_t i = t; i < table.Size(); i += threads)
+            {
+                table.Point(i, query);
+                if (solvePoint(mpc, query, angvel, accel))
+                    table.Set(i, angvel, accel);
+                else
+                    failed[t]++;
+            }
+        });
+    }
+    for (int t = 0; t < threads; t++)
+        pool[t].join();
+    size_t n_failed = 0;
+    for (int t = 0; t < threads; t++)
+        n_failed += failed[t];
+    std::printf("solved in %.1f s, %zu points failed (left out of the table)\n",
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count(), n_failed);
+
+    if (!table.Write(argv[1]))
+    {
+        std::cerr << "cannot write " << argv[1] << std::endl;
+        return 1;
+    }
+
+    // Interpolation error at random points of the grid
+    if (validate > 0)
+    {
+        MPC mpc;
+        mpc.LoadParams(params);
+        std::mt19937 random(1);
+        double err_w = 0.0, err_a = 0.0, max_w = 0.0, max_a = 0.0;
+        int n = 0, missed = 0;
+        for (int k = 0; k < validate; k++)
+        {
+            double query[ControlTable::DIMS], angvel, accel, table_w, table_a;
+            for (int d = 0; d < ControlTable::DIMS; d++)
+                query[d] = std::uniform_real_distribution<double>(axes[d].min, axes[d].max)(random);
+            if (!solvePoint(mpc, query, angvel, accel))
+                continue;
+            if (!table.Lookup(query, table_w, table_a))
+            {
+                missed++;
+                continue;
+            }
+            err_w += std::fabs(table_w - angvel);
+            err_a += std::fabs(table_a - accel);
+            max_w = std::max(max_w, std::fabs(table_w - angvel));
+            max_a = std::max(max_a, std::fabs(table_a - accel));
+            n++;
+        }
+        if (n > 0)
+            std::printf("validation %d points: angvel error mean %.4f max %.4f, accel error mean %.4f max %.4f\n",
+                        n, err_w / n, max_w, err_a / n, max_a);
+        std::printf("validation %d points next to failed ones\n", missed);
+    }
+    return 0;
+}
@@ -0,0 +1,205 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+// Parameter search on the closed-loop simulator, see param_tuner.h.
+//
+// Usage: mpc_tune [KEY=value ...] [KEY=a,b,c ...] [KEY=lo:hi ...]
+// A KEY with a list of values or a range is tuned, any other one is fixed;
+// keys and the episode and plant settings are those of mpc_sim (EPISODES
+// per candidate, default 20, TRAJ, SECONDS, OFFSET, HEADING, SEED, PLANT,
+// LATENCY, ...). Every candidate runs the same episodes.
+//
+//   MODE=grid     every combination of the values (default), a range
+//                 gives GRID=n of them (4, on a log scale over a decade)
+//   MODE=bayes    ITERATIONS=n batches (10) of BATCH=n points (THREADS)
+//                 over the ranges, after INITIAL=n random ones (2 BATCH)
+//   THREADS=n     side by side (one per core)
+//   BUDGET=ms     solve time the picked point has to stay within,
+//                 otherwise the knee of the front is picked
+//   YAML=file     node parameters of the picked point, for params/*.yaml
+//   CSV=file      one line per candidate
+//
+// e.g. rosrun mpc_ros mpc_tune W_CTE=500:8000 W_EPSI=100:5000 STEPS=10,20,40 LATENCY=0.1 YAML=/tmp/tuned.yaml
+
+#include "param_tuner.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+using param_tuner::Candidate;
+
+static void printCandidate(const Candidate &c, const std::vector<param_tuner::Dimension> &dims)
+{
+    for (size_t d = 0; d < dims.size(); d++)
+        std::printf(" %s=%g", dims[d].key.c_str(), c.values.at(dims[d].key));
+    std::printf("  cte %.4f (p90 %.4f) m  solve %.3f ms (max %.2f)%s\n", c.cte, c.cte_p90, c.solve_ms,
+                c.solve_max, c.diverged > 0 ? "  diverged" : "");
+}
+
+int main(int argc, char **argv)
+{
+    std::map<std::string, double> params = ClosedLoopSim::DefaultParams();
+    PlantConfig plant;
+    std::vector<std::pair<std::string, std::string> > tuned;
+    int episodes = 20, grid_points = 4, iterations = 10, batch = 0, initial = 0;
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    std::string mode = "grid", traj = "all", yaml, csv;
+    double scale = 1.0, seconds = 30.0, offset = 0.3, heading = 0.2, budget = 0.0;
+    unsigned seed = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        const size_t eq = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            std::cerr << "ignoring argument " << arg << std::endl;
+            continue;
+        }
+        const std::string key = arg.substr(0, eq);
+        const std::string text = arg.substr(eq + 1);
+        const double value = std::atof(text.c_str());
+        if (key == "MODE")
+            mode = text;
+        else if (key == "TRAJ")
+            traj = text;
+        else if (key == "YAML")
+            yaml = text;
+        else if (key == "CSV")
+            csv = text;
+        else if (text.find_first_of(",:") != std::string::npos)
+            tuned.push_back(std::make_pair(key, text));
+        else if (key == "EPISODES")
+            episodes = std::max(1, (int)value);
+        else if (key == "THREADS")
+            threads = std::max(1, (int)value);
+        else if (key == "GRID")
+            grid_points = std::max(2, (int)value);
+        else if (key == "ITERATIONS")
+            iterations = std::max(0, (int)value);
+        else if (key == "BATCH")
+            batch = std::max(1, (int)value);
+        else if (key == "INITIAL")
+            initial = std::max(2, (int)value);
+        else if (key == "BUDGET")
+            budget = value;
+        else if (key == "SCALE")
+            scale = value;
+        else if (key == "SECONDS")
+            seconds = value;
+        else if (key == "OFFSET")
+            offset = value;
+        else if (key == "HEADING")
+            heading = value;
+        else if (key == "SEED")
+            seed = (unsigned)value;
+        else if (!ClosedLoopSim::SetPlant(key, value, plant))
+            params[key] = value;
+    }
+
+    std::vector<param_tuner::Dimension> dims;
+    for (size_t i = 0; i < tuned.size(); i++)
+    {
+        param_tuner::Dimension dim;
+        if (!param_tuner::ParseDimension(tuned[i].first, tuned[i].second, grid_points, dim))
+        {
+            std::cerr << "cannot tune " << tuned[i].first << "=" << tuned[i].second << std::endl;
+            return 1;
+        }
+        dims.push_back(dim);
+    }
+    if (dims.empty())
+    {
+        std::cerr << "nothing to tune, give a KEY=a,b,c or KEY=lo:hi" << std::endl;
+        return 1;
+    }
+    const std::vector<EpisodeConfig> runs = ClosedLoopSim::RandomEpisodes(episodes, traj, scale, seconds, offset,
+                                                                           heading, seed);
+
+    const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    std::vector<Candidate> candidates;
+    if (mode == "bayes")
+    {
+        if (batch == 0)
+            batch = threads;
+        param_tuner::BayesSearch search(dims, seed);
+        candidates = search.Initial(initial > 0 ? initial : 2 * batch);
+        param_tuner::Evaluate(params, plant, runs, threads, candidates);
+        for (int it = 0; it < iterations; it++)
+        {
+            const std::vector<Candidate> next = search.Suggest(candidates, batch);
+            candidates.insert(candidates.end(), next.begin(), next.end());
+            param_tuner::Evaluate(params, plant, runs, threads, candidates);
+            const std::vector<size_t> front = param_tuner::ParetoFront(candidates);
+            std::printf("iteration %2d  %zu candidates, %zu on the front\n", it + 1, candidates.size(), front.size());
+        }
+    }
+    else
+    {
+        candidates = param_tuner::Grid(dims);
+        param_tuner::Evaluate(params, plant, runs, threads, candidates);
+    }
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    int diverged = 0;
+    for (size_t i = 0; i < candidates.size(); i++)
+        diverged += candidates[i].diverged > 0;
+    std::printf("candidates    %zu x %d episodes in %.1f s, %d diverged\n", candidates.size(), episodes, wall, diverged);
+    const std::vector<size_t> front = param_tuner::ParetoFront(candidates);
+    if (front.empty())
+    {
+        std::printf("every candidate diverged\n");
+        return 2;
+    }
+    std::printf("pareto front (cte against solve time)\n");
+    for (size_t k = 0; k < front.size(); k++)
+    {
+        std::printf("  ");
+        printCandidate(candidates[front[k]], dims);
+    }
+    const Candidate &picked = candidates[param_tuner::Pick(candidates, front, budget)];
+    std::printf(budget > 0.0 ? "picked within %.3f ms\n  " : "picked (knee)\n  ", budget);
+    printCandidate(picked, dims);
+
+    if (!yaml.empty())
+    {
+        std::ostringstream header;
+        header << "# mpc_tune: cte " << picked.cte << " m (p90 " << picked.cte_p90 << "), solve " << picked.solve_ms
+               << " ms over " << episodes << " episodes\n";
+        std::ofstream out(yaml.c_str());
+        out << param_tuner::Yaml(params, picked, header.str());
+    }
+    if (!csv.empty())
+    {
+        std::ofstream out(csv.c_str());
+        for (size_t d = 0; d < dims.size(); d++)
+            out << dims[d].key << ",";
+        out << "cte,cte_p90,solve_ms,solve_max,diverged,front\n";
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            const Candidate &c = candidates[i];
+            for (size_t d = 0; d < dims.size(); d++)
+                out << c.values.at(dims[d].key) << ",";
+            out << c.cte << "," << c.cte_p90 << "," << c.solve_ms << "," << c.solve_max << "," << c.diverged << ","
+                << (std::find(front.begin(), front.end(), i) != front.end()) << "\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,341 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+// Worst-case execution time harness of the deterministic solve mode.
+//
+// Runs FixedWorkSolver (see fixed_work_solver.h) over the recorded samples
+// of the given files (solve_corpus.h) and over generated adversarial ones,
+// and reports the distribution of the CPU cycles per solve and the
+// observed maximum with the input that caused it. The observed maximum is
+// evidence for a WCET bound, not a bound itself: quote it with a margin.
+//
+// Usage: mpc_wcet [file.csv|file.lg ...] [KEY=value ...]
+// KEY is any MPC::LoadParams key (STEPS, DT, weights, ANGVEL, MAXTHR) and
+//   SQP_ITERATIONS=n       SQP steps per solve (1)
+//   ACTIVE_SET_MAX_ITER=n  cap of the QP active set iterations (0: 4 per
+//                          input and step)
+//   ADVERSARIAL=n          generated samples (1000): every corner of the
+//                          box of cte, etheta, v and curvature below, then
+//                          uniform samples inside it, all in random order
+//                          so that the warm starts do not match
+//   MAX_CTE, MAX_ETHETA, MAX_CURVATURE  half-widths of the box (1, 1.2, 2)
+//   SEED=n                 of the generated samples (1)
+//   COLD=1                 every solve starts from rest instead of the
+//                          shifted plan of the previous sample
+//   REPEAT=n               passes over the samples (1)
+//   WARMUP=n               solves before timing (10)
+//   FLUSH_KB=n             written and read before every solve to evict the
+//                          caches, e.g. twice the last level cache (0: off)
+//   CPU=2                  CPUs of the thread, e.g. an isolcpus core
+//   PRIORITY=n             SCHED_FIFO priority (0: off)
+//   LOCK=1                 mlockall, no page faults after the warmup
+//   CSV=path               one line per timed solve
+//
+// Cycles come from the hardware counters (perf_counters.h) and are
+// wall-clock nanoseconds when those cannot be opened. Run with the
+// allocation hook preloaded (BUILD_ALLOC_HOOK=ON) to check that no solve
+// allocates; exit status 2 when one did.
+//
+// e.g. somewhere with isolcpus=3 on the kernel command line:
+//   LD_PRELOAD=<devel>/lib/libmpc_alloc_hook.so rosrun mpc_ros mpc_wcet assets/mpc.csv STEPS=20 CPU=3 PRIORITY=80 LOCK=1 FLUSH_KB=16384
+#include "fixed_work_solver.h"
+#include "solve_corpus.h"
+#include "perf_counters.h"
+#include "alloc_counter.h"
+#include "realtime.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Input
+    {
+        SolveSample sample;
+        std::string source; // file:line or adversarial:n
+    };
+
+    struct Timing
+    {
+        double cycles, ns;
+        int qp_iterations;
+        bool ok;
+        size_t input;
+    };
+
+    double percentile(const std::vector<double> &sorted, double p)
+    {
+        if (sorted.empty())
+            return 0.0;
+        // Nearest rank
+        const int k = (int)std::ceil(p * sorted.size()) - 1;
+        return sorted[std::min(std::max(k, 0), (int)sorted.size() - 1)];
+    }
+
+    // State [0, 0, 0, v, cte, etheta] on the path cte + tan(-etheta) x + c x^2,
+    // with the curvature of the path c * 2 at the robot
+    SolveSample adversarial(double cte, double etheta, double v, double curvature)
+    {
+        SolveSample sample;
+        sample.state = Eigen::VectorXd::Zero(6);
+        sample.state << 0, 0, 0, v, cte, etheta;
+        sample.coeffs = Eigen::VectorXd::Zero(4);
+        sample.coeffs << cte, std::tan(-etheta), 0.5 * curvature, 0.0;
+        return sample;
+    }
+
+    // Touch every cache line of buffer, the solve then starts with cold caches
+    unsigned long flush(std::vector<unsigned char> &buffer)
+    {
+        unsigned long sum = 0;
+        for (size_t i = 0; i < buffer.size(); i += 64)
+        {
+            buffer[i]++;
+            sum += buffer[i];
+        }
+        return sum;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    // Same defaults as the MPC_Node parameters
+    std::map<std::string, double> params;
+    params["DT"]        = 0.1;
+    params["STEPS"]     = 40.0;
+    params["REF_CTE"]   = 0.0;
+    params["REF_ETHETA"] = 0.0;
+    params["REF_V"]     = 1.0;
+    params["W_CTE"]     = 5000.0;
+    params["W_EPSI"]    = 5000.0;
+    params["W_V"]       = 1.0;
+    params["W_ANGVEL"]  = 100.0;
+    params["W_A"]       = 50.0;
+    params["W_DANGVEL"] = 10.0;
+    params["W_DA"]      = 10.0;
+    params["ANGVEL"]    = 3.0;
+    params["MAXTHR"]    = 1.0;
+    params["BOUND"]     = 1.0e3;
+    int adversarial_count = 1000, seed = 1, repeat = 1, warmup = 10, priority = 0;
+    double max_cte = 1.0, max_etheta = 1.2, max_curvature = 2.0;
+    size_t flush_kb = 0;
+    bool cold = false, lock = false;
+    std::string cpus, csv_path;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        const size_t eq = arg.find('=');
+        if (eq == std::string::npos)
+        {
+            files.push_back(arg);
+            continue;
+        }
+        const std::string key = arg.substr(0, eq);
+        const double value = std::atof(arg.substr(eq + 1).c_str());
+        if (key == "ADVERSARIAL")
+            adversarial_count = std::max(0, (int)value);
+        else if (key == "MAX_CTE")
+            max_cte = value;
+        else if (key == "MAX_ETHETA")
+            max_etheta = value;
+        else if (key == "MAX_CURVATURE")
+            max_curvature = value;
+        else if (key == "SEED")
+            seed = (int)value;
+        else if (key == "COLD")
+            cold = value != 0.0;
+        else if (key == "REPEAT")
+            repeat = std::max(1, (int)value);
+        else if (key == "WARMUP")
+            warmup = std::max(0, (int)value);
+        else if (key == "FLUSH_KB")
+            flush_kb = (size_t)std::max(0.0, value);
+        else if (key == "CPU")
+            cpus = arg.substr(eq + 1);
+        else if (key == "PRIORITY")
+            priority = std::max(0, (int)value);
+        else if (key == "LOCK")
+            lock = value != 0.0;
+        else if (key == "CSV")
+            csv_path = arg.substr(eq + 1);
+        else
+            params[key] = value;
+    }
+
+    // Recorded inputs in their order, then the generated ones shuffled
+    std::vector<Input> inputs;
+    int n_coeffs = 4;
+    for (size_t f = 0; f < files.size(); f++)
+    {
+        std::vector<SolveSample> samples;
+        std::string error;
+        if (!LoadSolveCorpus(files[f], samples, error))
+        {
+            std::cerr << files[f] << ": " << error << std::endl;
+            return 1;
+        }
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            Input input;
+            input.sample = samples[i];
+            input.source = files[f] + ":" + std::to_string(i);
+            n_coeffs = std::max(n_coeffs, (int)samples[i].coeffs.size());
+            inputs.push_back(input);
+        }
+    }
+    std::vector<Input> generated;
+    const double v_max = 2.0 * params["REF_V"];
+    for (int a = -1; a <= 1; a++)
+        for (int b = -1; b <= 1; b++)
+            for (int c = 0; c <= 2; c++)
+                for (int d = -1; d <= 1; d++)
+                {
+                    Input input;
+                    input.sample = adversarial(a * max_cte, b * max_etheta, 0.5 * c * v_max, d * max_curvature);
+                    generated.push_back(input);
+                }
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    while ((int)generated.size() < adversarial_count)
+    {
+        Input input;
+        input.sample = adversarial(unit(rng) * max_cte, unit(rng) * max_etheta, 0.5 * (unit(rng) + 1.0) * v_max,
+                                   unit(rng) * max_curvature);
+        generated.push_back(input);
+    }
+    generated.resize(std::min((int)generated.size(), adversarial_count));
+    std::shuffle(generated.begin(), generated.end(), rng);
+    for (size_t i = 0; i < generated.size(); i++)
+    {
+        generated[i].source = "adversarial:" + std::to_string(i);
+        inputs.push_back(generated[i]);
+    }
+    if (inputs.empty())
+    {
+        std::cerr << "no samples" << std::endl;
+        return 1;
+    }
+
+    // Isolation of the measuring thread, best effort
+    std::string report;
+    if (lock && !RealtimeSettings::LockMemory(0, report))
+        std::cerr << "memory lock: " << report << std::endl;
+    RealtimeSettings realtime;
+    realtime.Configure(priority, cpus, 256);
+    report.clear();
+    if (realtime.Enabled() && !realtime.Apply(report))
+        std::cerr << "realtime: " << report << std::endl;
+    const bool cycles = perf_counters::Enable();
+    if (!cycles)
+        std::cerr << "no hardware counters, reporting nanoseconds" << std::endl;
+
+    FixedWorkSolver solver;
+    solver.Init(params, n_coeffs);
+    std::vector<unsigned char> flush_buffer(flush_kb * 1024, 0);
+    std::vector<Timing> timings;
+    timings.reserve(inputs.size() * repeat);
+    unsigned long sink = 0;
+    double angvel, accel;
+    for (int i = 0; i < warmup; i++)
+        solver.Solve(inputs[i % inputs.size()].sample.state, inputs[i % inputs.size()].sample.coeffs, angvel, accel);
+    solver.Reset();
+
+    AllocClock allocs;
+    for (int r = 0; r < repeat; r++)
+    {
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            if (cold)
+                solver.Reset();
+            if (!flush_buffer.empty())
+                sink += flush(flush_buffer);
+            PerfClock perf;
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            const bool ok = solver.Solve(inputs[i].sample.state, inputs[i].sample.coeffs, angvel, accel);
+            const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            const perf_counters::Counts counts = perf.Lap();
+            Timing timing;
+            timing.ns = ns;
+            timing.cycles = cycles ? (double)counts.value[perf_counters::CYCLES] : ns;
+            timing.qp_iterations = solver.QpIterations();
+            timing.ok = ok;
+            timing.input = i;
+            timings.push_back(timing);
+        }
+    }
+    const alloc_counter::Counts allocated = allocs.Total();
+
+    std::vector<double> sorted(timings.size());
+    size_t worst = 0, failed = 0;
+    int max_qp = 0;
+    double mean = 0.0;
+    for (size_t k = 0; k < timings.size(); k++)
+    {
+        sorted[k] = timings[k].cycles;
+        mean += timings[k].cycles / timings.size();
+        if (timings[k].cycles > timings[worst].cycles)
+            worst = k;
+        failed += timings[k].ok ? 0 : 1;
+        max_qp = std::max(max_qp, timings[k].qp_iterations);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    const char *unit_name = cycles ? "cycles" : "ns";
+    printf("%zu solves of %d steps, %d SQP iterations each, %s%s\n", timings.size(), solver.Steps(),
+           solver.SqpIterations(), cold ? "cold" : "warm", flush_kb ? ", caches flushed" : "");
+    printf("%s: min %.0f p50 %.0f p90 %.0f p99 %.0f p99.9 %.0f max %.0f mean %.0f, max / p50 %.2f\n", unit_name,
+           sorted.front(), percentile(sorted, 0.5), percentile(sorted, 0.9), percentile(sorted, 0.99),
+           percentile(sorted, 0.999), sorted.back(), mean, sorted.back() / std::max(1.0, percentile(sorted, 0.5)));
+    printf("observed maximum %.0f %s (%.1f us) on %s, %d active set iterations\n", timings[worst].cycles, unit_name,
+           timings[worst].ns / 1000.0, inputs[timings[worst].input].source.c_str(), timings[worst].qp_iterations);
+    printf("QP failures (plan kept) %zu, most active set iterations of a solve %d\n", failed, max_qp);
+
+    // Ten bins between the extremes
+    const int bins = 10;
+    std::vector<size_t> histogram(bins, 0);
+    const double width = std::max(1.0, (sorted.back() - sorted.front()) / bins);
+    for (size_t k = 0; k < sorted.size(); k++)
+        histogram[std::min(bins - 1, int((sorted[k] - sorted.front()) / width))]++;
+    for (int b = 0; b < bins; b++)
+        printf("  [%9.0f, %9.0f) %zu\n", sorted.front() + b * width, sorted.front() + (b + 1) * width, histogram[b]);
+
+    if (alloc_counter::Active())
+        printf("allocations while timing %llu (%llu bytes)\n", allocated.allocs, allocated.bytes);
+    else
+        printf("allocations not counted, preload libmpc_alloc_hook.so\n");
+
+    if (!csv_path.empty())
+    {
+        std::ofstream csv(csv_path.c_str());
+        csv << "source,cycles,ns,qp_iterations,ok\n";
+        for (size_t k = 0; k < timings.size(); k++)
+            csv << inputs[timings[k].input].source << "," << timings[k].cycles << "," << timings[k].ns << ","
+                << timings[k].qp_iterations << "," << (timings[k].ok ? 1 : 0) << "\n";
+    }
+    if (sink == 1)
+        printf("\n"); // keeps the flush
+    return alloc_counter::Active() && allocated.allocs > 0 ? 2 : 0;
+}
@@ -0,0 +1,367 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "mppi.h"
+#include "distance_field.h"
+#include <algorithm>
+#include <cmath>
+
+const double Mppi::COLLISION_COST = 1e6;
+
+namespace
+{
+    double param(const std::map<std::string, double> &params, const char *key, double value)
+    {
+        return params.find(key) != params.end() ? params.at(key) : value;
+    }
+}
+
+Mppi::Mppi()
+{
+    _steps = 30;
+    _samples = 1024;
+    _threads = 1;
+    _dt = 0.1;
+    _ref_v = 0.5;
+    _max_speed = 1.0;
+    _lambda = 1.0;
+    _sigma_w = 0.5;
+    _sigma_a = 0.5;
+    _max_angvel = 3.0;
+    _max_throttle = 1.0;
+    _w_cte = 100;
+    _w_etheta = 100;
+    _w_vel = 100;
+    _w_angvel = 100;
+    _w_accel = 50;
+    _w_dangvel = 0;
+    _w_daccel = 0;
+    _w_obs = 0;
+    _clearance = 0.3;
+    _seed = 1;
+    _warm = false;
+    _x0 = _y0 = _theta0 = _v0 = 0;
+    _field = NULL;
+    _field_x = _field_y = _field_yaw = 0;
+    _mppi_cost = _mppi_min_cost = _mppi_ess = 0;
+    _mppi_collisions = 0;
+    _generation = 0;
+    _busy = 0;
+    _stop = false;
+    _rngs.assign(1, std::mt19937(_seed));
+}
+
+Mppi::~Mppi()
+{
+    stopWorkers();
+}
+
+void Mppi::LoadParams(const std::map<std::string, double> &params)
+{
+    const int steps = std::max(2, int(param(params, "STEPS", _steps)));
+    if (steps != _steps)
+        Reset();
+    _steps = steps;
+    _dt = param(params, "DT", _dt);
+    _ref_v = param(params, "REF_V", _ref_v);
+    _max_speed = param(params, "MAX_SPEED", _max_speed);
+    _w_cte = param(params, "W_CTE", _w_cte);
+    _w_etheta = param(params, "W_EPSI", _w_etheta);
+    _w_vel = param(params, "W_V", _w_vel);
+    _w_angvel = param(params, "W_ANGVEL", _w_angvel);
+    _w_accel = param(params, "W_A", _w_accel);
+    _w_dangvel = param(params, "W_DANGVEL", _w_dangvel);
+    _w_daccel = param(params, "W_DA", _w_daccel);
+    _max_angvel = param(params, "ANGVEL", _max_angvel);
+    _max_throttle = param(params, "MAXTHR", _max_throttle);
+    _w_obs = param(params, "W_OBS", _w_obs);
+    _clearance = param(params, "CLEARANCE", _clearance);
+    _lambda = std::max(1e-6, param(params, "LAMBDA", _lambda));
+    _sigma_w = std::max(1e-6, param(params, "SIGMA_W", _sigma_w));
+    _sigma_a = std::max(1e-6, param(params, "SIGMA_A", _sigma_a));
+
+    // Whole batches of lanes
+    const int samples = std::max(1, int(param(params, "SAMPLES", _samples)));
+    _samples = (samples + LANES - 1) / LANES * LANES;
+
+    const int threads = std::max(1, int(param(params, "THREADS", _threads)));
+    if (threads != _threads || _workers.size() + 1 != size_t(threads))
+        startWorkers(threads);
+}
+
+void Mppi::SetObstacles(const DistanceField *field, double ox, double oy, double yaw)
+{
+    _field = field;
+    _field_x = ox;
+    _field_y = oy;
+    _field_yaw = yaw;
+}
+
+void Mppi::Reset()
+{
+    _warm = false;
+}
+
+void Mppi::startWorkers(int threads)
+{
+    stopWorkers();
+    _threads = threads;
+    _rngs.clear();
+    for (int i = 0; i < _threads; i++)
+        _rngs.push_back(std::mt19937(_seed + 7919u * i));
+    _stop = false;
+    for (int i = 1; i < _threads; i++)
+        _workers.emplace_back(&Mppi::work, this, i, _generation);
+}
+
+void Mppi::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _start_cond.notify_all();
+    for (size_t i = 0; i < _workers.size(); i++)
+    {
+        if (_workers[i].joinable())
+            _workers[i].join();
+    }
+    _workers.clear();
+}
+
+void Mppi::work(int index, unsigned int generation)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _start_cond.wait(lock, [this, generation] { return _stop || _generation != generation; });
+        if (_stop)
+            break;
+        generation = _generation;
+
+        // Batches of this thread
+        const int batches = _samples / LANES;
+        const int begin = batches * index / _threads, end = batches * (index + 1) / _threads;
+        lock.unlock();
+        rollouts(begin, end, index);
+        lock.lock();
+        if (--_busy == 0)
+            _done_cond.notify_one();
+    }
+}
+
+void Mppi::rollouts(int begin, int end, int thread)
+{
+    const int n = _steps - 1;
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::mt19937 &rng = _rngs[thread];
+    const double c0 = _coeffs.size() > 0 ? _coeffs[0] : 0.0, c1 = _coeffs.size() > 1 ? _coeffs[1] : 0.0;
+    const double c2 = _coeffs.size() > 2 ? _coeffs[2] : 0.0, c3 = _coeffs.size() > 3 ? _coeffs[3] : 0.0;
+    const double fc = std::cos(_field_yaw), fs = std::sin(_field_yaw);
+
+    for (int b = begin; b < end; b++)
+    {
+        double x[LANES], y[LANES], theta[LANES], v[LANES], cost[LANES];
+        double prev_w[LANES], prev_a[LANES];
+        bool hit[LANES];
+        for (int l = 0; l < LANES; l++)
+        {
+            x[l] = _x0;
+            y[l] = _y0;
+            theta[l] = _theta0;
+            v[l] = _v0;
+            cost[l] = 0.0;
+            prev_w[l] = _angvel[0];
+            prev_a[l] = _accel[0];
+            hit[l] = false;
+        }
+
+        for (int t = 0; t < n; t++)
+        {
+            double *eps_w = &_noise_w[(size_t(b) * n + t) * LANES];
+            double *eps_a = &_noise_a[(size_t(b) * n + t) * LANES];
+            const double nom_w = _angvel[t], nom_a = _accel[t];
+            // Sample 0 of batch 0 stays on the nominal sequence
+            for (int l = 0; l < LANES; l++)
+            {
+                const bool nominal = b == 0 && l == 0;
+                const double w = std::max(-_max_angvel, std::min(_max_angvel, nom_w + (nominal ? 0.0 : _sigma_w * normal(rng))));
+                const double a = std::max(-_max_throttle, std::min(_max_throttle, nom_a + (nominal ? 0.0 : _sigma_a * normal(rng))));
+                eps_w[l] = w - nom_w;
+                eps_a[l] = a - nom_a;
+            }
+
+            // Euler step of the unicycle as in the MPC model, then the cost
+            // of the new state against the path
+            double cth[LANES], sth[LANES];
+            for (int l = 0; l < LANES; l++)
+            {
+                cth[l] = std::cos(theta[l]);
+                sth[l] = std::sin(theta[l]);
+            }
+            for (int l = 0; l < LANES; l++)
+            {
+                const double w = nom_w + eps_w[l], a = nom_a + eps_a[l];
+                x[l] += v[l] * cth[l] * _dt;
+                y[l] += v[l] * sth[l] * _dt;
+                theta[l] += w * _dt;
+                v[l] = std::max(0.0, std::min(_max_speed, v[l] + a * _dt));
+
+                const double px = x[l];
+                const double cte = c0 + px * (c1 + px * (c2 + px * c3)) - y[l];
+                const double slope = c1 + px * (2.0 * c2 + px * 3.0 * c3);
+                const double dw = w - prev_w[l], da = a - prev_a[l];
+                cost[l] += _w_cte * cte * cte + _w_vel * (v[l] - _ref_v) * (v[l] - _ref_v)
+                           + _w_angvel * w * w + _w_accel * a * a + _w_dangvel * dw * dw + _w_daccel * da * da
+                           // Importance sampling term of the nominal inputs
+                           + _lambda * (nom_w * eps_w[l] / (_sigma_w * _sigma_w) + nom_a * eps_a[l] / (_sigma_a * _sigma_a));
+                prev_w[l] = w;
+                prev_a[l] = a;
+                const double etheta = theta[l] - std::atan(slope);
+                cost[l] += _w_etheta * etheta * etheta;
+            }
+
+            if (_field)
+            {
+                for (int l = 0; l < LANES; l++)
+                {
+                    double d, gx, gy;
+                    if (!_field->Distance(_field_x + fc * x[l] - fs * y[l], _field_y + fs * x[l] + fc * y[l], d, gx, gy))
+                        continue;
+                    if (d <= 0.0)
+                    {
+                        cost[l] += hit[l] ? 0.0 : COLLISION_COST;
+                        hit[l] = true;
+                    }
+                    else if (d < _clearance)
+                        cost[l] += _w_obs * (_clearance - d) * (_clearance - d);
+                }
+            }
+        }
+
+        for (int l = 0; l < LANES; l++)
+        {
+            _cost[b * LANES + l] = cost[l];
+            _hit[b * LANES + l] = hit[l];
+        }
+    }
+}
+
+std::vector<double> Mppi::Solve(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs)
+{
+    const int n = _steps - 1;
+    const int batches = _samples / LANES;
+
+    // Warm start from the last nominal sequence one step on
+    if (!_warm || _angvel.size() != size_t(n))
+    {
+        _angvel.assign(n, 0.0);
+        _accel.assign(n, 0.0);
+    }
+    else
+    {
+        std::rotate(_angvel.begin(), _angvel.begin() + 1, _angvel.end());
+        std::rotate(_accel.begin(), _accel.begin() + 1, _accel.end());
+        _angvel[n - 1] = _angvel[std::max(n - 2, 0)];
+        _accel[n - 1] = _accel[std::max(n - 2, 0)];
+    }
+
+    _x0 = state[0];
+    _y0 = state[1];
+    _theta0 = state[2];
+    _v0 = state[3];
+    _coeffs = coeffs;
+    _noise_w.resize(size_t(_samples) * n);
+    _noise_a.resize(size_t(_samples) * n);
+    _cost.resize(_samples);
+    _hit.resize(_samples);
+
+    // Batch range 0 here, the others on the workers
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _busy = int(_workers.size());
+        _generation++;
+    }
+    _start_cond.notify_all();
+    rollouts(0, batches / _threads, 0);
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done_cond.wait(lock, [this] { return _busy == 0; });
+    }
+
+    // Weights exp(-(cost - min) / lambda)
+    _mppi_cost = _cost[0];
+    double min_cost = _cost[0];
+    _mppi_collisions = 0;
+    for (int k = 0; k < _samples; k++)
+    {
+        min_cost = std::min(min_cost, _cost[k]);
+        _mppi_collisions += _hit[k];
+    }
+    double sum = 0.0, sum_sq = 0.0;
+    for (int k = 0; k < _samples; k++)
+    {
+        _cost[k] = std::exp(-(_cost[k] - min_cost) / _lambda);
+        sum += _cost[k];
+        sum_sq += _cost[k] * _cost[k];
+    }
+    _mppi_min_cost = min_cost;
+    _mppi_ess = sum * sum / sum_sq;
+
+    // Nominal sequence += weighted average of the noise
+    for (int b = 0; b < batches; b++)
+    {
+        for (int t = 0; t < n; t++)
+        {
+            const double *eps_w = &_noise_w[(size_t(b) * n + t) * LANES];
+            const double *eps_a = &_noise_a[(size_t(b) * n + t) * LANES];
+            const double *weight = &_cost[b * LANES];
+            double dw = 0.0, da = 0.0;
+            for (int l = 0; l < LANES; l++)
+            {
+                dw += weight[l] * eps_w[l];
+                da += weight[l] * eps_a[l];
+            }
+            _angvel[t] += dw / sum;
+            _accel[t] += da / sum;
+        }
+    }
+    _warm = true;
+
+    // Rollout of the new nominal sequence
+    mpc_x.resize(_steps);
+    mpc_y.resize(_steps);
+    mpc_theta.resize(_steps);
+    mpc_x[0] = _x0;
+    mpc_y[0] = _y0;
+    mpc_theta[0] = _theta0;
+    double v = _v0;
+    for (int t = 0; t < n; t++)
+    {
+        mpc_x[t + 1] = mpc_x[t] + v * std::cos(mpc_theta[t]) * _dt;
+        mpc_y[t + 1] = mpc_y[t] + v * std::sin(mpc_theta[t]) * _dt;
+        mpc_theta[t + 1] = mpc_theta[t] + _angvel[t] * _dt;
+        v = std::max(0.0, std::min(_max_speed, v + _accel[t] * _dt));
+    }
+    mpc_angvel = _angvel;
+    mpc_accel = _accel;
+
+    std::vector<double> result(2);
+    result[0] = _angvel[0];
+    result[1] = _accel[0];
+    return result;
+}
@@ -0,0 +1,363 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "mppi_planner_ros.h"
+#include <pluginlib/class_list_macros.h>
+#include <tf2/utils.h>
+#include <algorithm>
+#include <cmath>
+
+PLUGINLIB_EXPORT_CLASS(mpc_ros::MPPIPlannerROS, nav_core::BaseLocalPlanner)
+
+namespace mpc_ros{
+
+    MPPIPlannerROS::MPPIPlannerROS() : costmap_ros_(NULL), costmap_(NULL), tf_(NULL), initialized_(false) {}
+    MPPIPlannerROS::~MPPIPlannerROS() {}
+
+    void MPPIPlannerROS::initialize(std::string name, tf2_ros::Buffer* tf, costmap_2d::Costmap2DROS* costmap_ros)
+    {
+        ros::NodeHandle private_nh("~/" + name);
+        tf_ = tf;
+        costmap_ros_ = costmap_ros;
+        costmap_ = costmap_ros_->getCostmap();
+        planner_util_.initialize(tf, costmap_, costmap_ros_->getGlobalFrameID());
+
+        // Goal check of the latched stop-rotate controller, no dynamic
+        // reconfigure here
+        base_local_planner::LocalPlannerLimits limits;
+        private_nh.param("xy_goal_tolerance", limits.xy_goal_tolerance, 0.2);
+        private_nh.param("yaw_goal_tolerance", limits.yaw_goal_tolerance, 0.1);
+        private_nh.param("trans_stopped_vel", limits.trans_stopped_vel, 0.1);
+        private_nh.param("theta_stopped_vel", limits.theta_stopped_vel, 0.1);
+        planner_util_.reconfigureCB(limits, false);
+
+        // Controller frequency of move_base as for MPCPlannerROS
+        double controller_frequency = 20.0;
+        std::string controller_frequency_param_name;
+        if(_nh.searchParam("move_base/controller_frequency", controller_frequency_param_name))
+            _nh.param(controller_frequency_param_name, controller_frequency, 20.0);
+        if(controller_frequency <= 0)
+        {
+            ROS_WARN("A controller_frequency less than 0 has been set. Ignoring the parameter, assuming a rate of 20Hz");
+            controller_frequency = 20.0;
+        }
+        _dt = 1.0 / controller_frequency;
+
+        private_nh.param<std::string>("map_frame", _map_frame, "map");
+        private_nh.param<std::string>("odom_frame", _odom_frame, "odom");
+        private_nh.param<std::string>("base_frame", _base_frame, "base_footprint");
+        double tf_max_age;
+        private_nh.param("tf_max_age", tf_max_age, 0.5);
+        _tf_cache.SetMaxAge(tf_max_age);
+        _tf_cache.AdvertiseDiagnostics(private_nh, private_nh.getNamespace());
+
+        private_nh.param("debug_info", _debug_info, false);
+        private_nh.param("delay_mode", _delay_mode, true);
+        private_nh.param("publish_stats", _publish_stats, false);
+        private_nh.param("obstacle_avoidance", _obstacle_avoidance, true);
+        private_nh.param("max_speed", _max_speed, 0.5);
+        private_nh.param("path_length", _path_length, 5.0);
+        private_nh.param("waypoints_dist", _waypoints_dist, -1.0); // < 0: measured on the plan
+        double viz_rate;
+        private_nh.param("viz_rate", viz_rate, 10.0);
+
+        // Model and cost as the MPC plugin, plus the sampling
+        double value;
+        private_nh.param("steps", value, 30.0);             _mppi_params["STEPS"] = value;
+        private_nh.param("ref_vel", value, 0.5);            _mppi_params["REF_V"] = value;
+        private_nh.param("w_cte", value, 100.0);            _mppi_params["W_CTE"] = value;
+        private_nh.param("w_etheta", value, 100.0);         _mppi_params["W_EPSI"] = value;
+        private_nh.param("w_vel", value, 100.0);            _mppi_params["W_V"] = value;
+        private_nh.param("w_angvel", value, 10.0);          _mppi_params["W_ANGVEL"] = value;
+        private_nh.param("w_accel", value, 10.0);           _mppi_params["W_A"] = value;
+        private_nh.param("w_angvel_d", value, 0.0);         _mppi_params["W_DANGVEL"] = value;
+        private_nh.param("w_accel_d", value, 0.0);          _mppi_params["W_DA"] = value;
+        private_nh.param("max_angvel", value, 1.0);         _mppi_params["ANGVEL"] = value;
+        private_nh.param("max_throttle", value, 1.0);       _mppi_params["MAXTHR"] = value;
+        private_nh.param("obstacle_clearance", value, 0.3); _mppi_params["CLEARANCE"] = value;
+        private_nh.param("w_obstacle", value, 1000.0);      _mppi_params["W_OBS"] = value;
+        private_nh.param("samples", value, 1000.0);         _mppi_params["SAMPLES"] = value;
+        private_nh.param("lambda", value, 100.0);           _mppi_params["LAMBDA"] = value;
+        private_nh.param("sigma_angvel", value, 0.5);       _mppi_params["SIGMA_W"] = value;
+        private_nh.param("sigma_accel", value, 0.5);        _mppi_params["SIGMA_A"] = value;
+        private_nh.param("threads", value, 2.0);            _mppi_params["THREADS"] = value;
+        _mppi_params["DT"] = _dt;
+        _mppi_params["MAX_SPEED"] = _max_speed;
+        _mppi.LoadParams(_mppi_params);
+        _distance_field.SetMaxDistance(_mppi_params["CLEARANCE"] + 0.5);
+
+        _sub_odom = _nh.subscribe("odom", 1, &MPPIPlannerROS::odomCB, this);
+        _pub_globalplan.Advertise(private_nh, "global_plan");
+        _pub_localplan.Advertise(private_nh, "local_plan");
+        _pub_mppitraj.Advertise(_nh, "mppi_trajectory");
+        _pub_odompath.Advertise(_nh, "mppi_reference");
+        _pub_stats = private_nh.advertise<mpc_ros::MPCStats>("mpc_stats", 1);
+        _pub_globalplan.SetRate(viz_rate);
+        _pub_localplan.SetRate(viz_rate);
+        _pub_mppitraj.SetRate(viz_rate);
+        _pub_odompath.SetRate(viz_rate);
+
+        _w = 0.0;
+        _throttle = 0.0;
+        initialized_ = true;
+    }
+
+    bool MPPIPlannerROS::setPlan(const std::vector<geometry_msgs::PoseStamped>& orig_global_plan)
+    {
+        if(!initialized_)
+        {
+            ROS_ERROR("This planner has not been initialized, please call initialize() before using this planner");
+            return false;
+        }
+        latchedStopRotateController_.resetLatching();
+        if(!planner_util_.setPlan(orig_global_plan))
+            return false;
+        _mppi.Reset(); // new plan, no warm start
+
+        if(orig_global_plan.empty())
+        {
+            _global_plan.Clear();
+            return true;
+        }
+        const std::string &plan_frame = orig_global_plan[0].header.frame_id.empty() ? _map_frame : orig_global_plan[0].header.frame_id;
+        tf2::Transform plan_to_odom;
+        if(!_tf_cache.Lookup(*tf_, _odom_frame, plan_frame, plan_to_odom))
+        {
+            _global_plan.Clear();
+            return false;
+        }
+        _global_plan.Set(orig_global_plan, plan_to_odom, _odom_frame);
+        return true;
+    }
+
+    bool MPPIPlannerROS::computeVelocityCommands(geometry_msgs::Twist& cmd_vel)
+    {
+        if(!initialized_)
+        {
+            ROS_ERROR("This planner has not been initialized, please call initialize() before using this planner");
+            return false;
+        }
+        if(!costmap_ros_->getRobotPose(current_pose_))
+        {
+            ROS_ERROR("Could not get robot pose");
+            return false;
+        }
+        nav_msgs::Odometry::ConstPtr odom_msg = _odom.Get();
+        if(odom_msg)
+            _global_plan.Advance(odom_msg->pose.pose.position.x, odom_msg->pose.pose.position.y, _path_length);
+        if(_global_plan.Size() < 2)
+        {
+            ROS_WARN_NAMED("mppi_planner", "Received an empty transformed plan.");
+            return false;
+        }
+
+        cmd_vel = geometry_msgs::Twist();
+        if(latchedStopRotateController_.isPositionReached(&planner_util_, current_pose_))
+        {
+            _w = 0.0;
+            _throttle = 0.0;
+            _mppi.Reset();
+            return true;
+        }
+
+        double speed, angvel;
+        const bool ok = computeCommand(current_pose_, speed, angvel);
+        if(ok)
+        {
+            cmd_vel.linear.x = speed;
+            cmd_vel.angular.z = angvel;
+        }
+
+        // Remaining poses of the plan, only if someone is looking
+        const ros::Time now = ros::Time::now();
+        if(ok && _pub_globalplan.Due(now))
+        {
+            nav_msgs::Path &msg = _pub_globalplan.Reset(_global_plan[0].header.frame_id, now, 0);
+            msg.poses.assign(_global_plan.Plan()->begin() + _global_plan.Start(), _global_plan.Plan()->end());
+            _pub_globalplan.Publish(now);
+        }
+        return ok;
+    }
+
+    bool MPPIPlannerROS::computeCommand(const geometry_msgs::PoseStamped& global_pose, double &speed, double &angvel)
+    {
+        StageClock clock;
+        mpc_ros::MPCStats stats;
+
+        nav_msgs::Odometry::ConstPtr odom_msg = _odom.Get();
+        if(!odom_msg)
+        {
+            ROS_WARN_THROTTLE_NAMED(1.0, "mppi_planner", "No odometry received yet.");
+            return false;
+        }
+        const nav_msgs::Odometry &base_odom = *odom_msg;
+        const double px = base_odom.pose.pose.position.x;
+        const double py = base_odom.pose.pose.position.y;
+        const double theta = tf2::getYaw(base_odom.pose.pose.orientation);
+        const double v = base_odom.twist.twist.linear.x;
+        // The plan is transformed to odom once in setPlan
+        stats.tf_ms = clock.Lap();
+
+        if(_waypoints_dist <= 0.0)
+        {
+            const double dx = _global_plan[1].pose.position.x - _global_plan[0].pose.position.x;
+            const double dy = _global_plan[1].pose.position.y - _global_plan[0].pose.position.y;
+            _waypoints_dist = std::max(std::sqrt(dx * dx + dy * dy), 1e-3);
+        }
+        const int down_sampling = std::max(int(_path_length / 10.0 / _waypoints_dist), 1);
+        CompactPath &odom_path = _plan_samples.Update(_global_plan, down_sampling, size_t(_path_length / _waypoints_dist));
+        if(odom_path.Size() <= 3)
+        {
+            ROS_DEBUG_NAMED("mppi_planner", "Failed to path generation since small down-sampling path.");
+            _waypoints_dist = -1;
+            return false;
+        }
+        odom_path.SetFrame(_odom_frame);
+        odom_path.SetStamp(ros::Time::now());
+        if(_pub_odompath.Due(odom_path.Stamp()))
+            _pub_odompath.Publish(odom_path, odom_path.Stamp());
+        stats.path_ms = clock.Lap();
+
+        if(!_path_fit.Fit(odom_path, px, py, theta))
+            return false;
+        const Eigen::VectorXd &coeffs = _path_fit.Coeffs();
+        const double cte = _path_fit.Eval(0.0);
+        const double etheta = -std::atan(coeffs[1]);
+
+        // Kinematic model over one cycle to the moment of control, as the
+        // MPC plugin does in delay mode
+        Eigen::VectorXd state(6);
+        if(_delay_mode)
+            state << v * _dt, 0, _w * _dt, v + _throttle * _dt, cte + v * std::sin(etheta) * _dt, etheta - _w * _dt;
+        else
+            state << 0, 0, 0, v, cte, etheta;
+
+        // Rollouts against the local costmap, the vehicle frame of the
+        // solve is the robot pose in the costmap frame
+        const double gx = global_pose.pose.position.x, gy = global_pose.pose.position.y;
+        const double gyaw = tf2::getYaw(global_pose.pose.orientation);
+        if(_obstacle_avoidance)
+        {
+            boost::unique_lock<costmap_2d::Costmap2D::mutex_t> lock(*(costmap_->getMutex()));
+            _distance_field.Update(costmap_->getCharMap(), costmap_->getSizeInCellsX(), costmap_->getSizeInCellsY(),
+                                   costmap_->getResolution(), costmap_->getOriginX(), costmap_->getOriginY());
+            _mppi.SetObstacles(&_distance_field, gx, gy, gyaw);
+        }
+        else
+            _mppi.SetObstacles(NULL, 0, 0, 0);
+        stats.fit_ms = clock.Lap();
+        stats.tape_ms = 0.0;
+
+        const std::vector<double> inputs = _mppi.Solve(state, coeffs);
+        stats.solve_ms = clock.Lap();
+        _w = inputs[0];
+        _throttle = inputs[1];
+
+        // Every sample is weighted, a colliding nominal rollout means all
+        // of them are blocked
+        const double c = std::cos(gyaw), s = std::sin(gyaw);
+        int first_lethal = -1;
+        for(size_t i = 0; _obstacle_avoidance && first_lethal < 0 && i < _mppi.mpc_x.size(); i++)
+        {
+            double d, ddx, ddy;
+            if(_distance_field.Distance(gx + c * _mppi.mpc_x[i] - s * _mppi.mpc_y[i],
+                                        gy + s * _mppi.mpc_x[i] + c * _mppi.mpc_y[i], d, ddx, ddy) && d <= 0.0)
+                first_lethal = int(i);
+        }
+        speed = std::max(0.0, std::min(v + _throttle * _dt, _max_speed));
+        angvel = _w;
+        if(first_lethal >= 0)
+        {
+            ROS_WARN_THROTTLE_NAMED(1.0, "mppi_planner", "MPPI rollout collides at step %d, stopping.", first_lethal);
+            _w = 0.0;
+            _throttle = 0.0;
+            speed = 0.0;
+            angvel = 0.0;
+        }
+        if(_debug_info)
+            ROS_INFO_THROTTLE_NAMED(1.0, "mppi_planner", "w %.3f a %.3f cost %.1f min %.1f ess %.1f collisions %d",
+                                    _w, _throttle, _mppi._mppi_cost, _mppi._mppi_min_cost, _mppi._mppi_ess, _mppi._mppi_collisions);
+
+        // Nominal rollout in the costmap frame and in the robot frame
+        const ros::Time now = ros::Time::now();
+        if(_pub_localplan.Due(now))
+        {
+            nav_msgs::Path &msg = _pub_localplan.Reset(costmap_ros_->getGlobalFrameID(), now, _mppi.mpc_x.size());
+            for(size_t i = 0; i < _mppi.mpc_x.size(); i++)
+                PathVisualizer::SetPose(msg.poses[i], gx + c * _mppi.mpc_x[i] - s * _mppi.mpc_y[i],
+                                        gy + s * _mppi.mpc_x[i] + c * _mppi.mpc_y[i], gyaw + _mppi.mpc_theta[i]);
+            _pub_localplan.Publish(now);
+        }
+        if(_pub_mppitraj.Due(now))
+        {
+            nav_msgs::Path &msg = _pub_mppitraj.Reset(_base_frame, now, _mppi.mpc_x.size());
+            for(size_t i = 0; i < _mppi.mpc_x.size(); i++)
+                PathVisualizer::SetPose(msg.poses[i], _mppi.mpc_x[i], _mppi.mpc_y[i], _mppi.mpc_theta[i]);
+            _pub_mppitraj.Publish(now);
+        }
+        stats.publish_ms = clock.Lap();
+        stats.total_ms = clock.Total();
+        publishStats(stats);
+        return first_lethal < 0;
+    }
+
+    bool MPPIPlannerROS::isGoalReached()
+    {
+        if(!initialized_)
+        {
+            ROS_ERROR("This planner has not been initialized, please call initialize() before using this planner");
+            return false;
+        }
+        if(!costmap_ros_->getRobotPose(current_pose_))
+        {
+            ROS_ERROR("Could not get robot pose");
+            return false;
+        }
+        if(latchedStopRotateController_.isGoalReached(&planner_util_, odom_helper_, current_pose_))
+        {
+            ROS_INFO("Goal reached");
+            return true;
+        }
+        return false;
+    }
+
+    void MPPIPlannerROS::publishStats(mpc_ros::MPCStats &stats)
+    {
+        _stage_stats.Add(stats);
+        if(_debug_info)
+            ROS_INFO_THROTTLE_NAMED(10.0, "mppi_planner", "Cycle latency [ms] p50 p95 max over %d cycles:%s",
+                                    _stage_stats.Size(), _stage_stats.Table().c_str());
+        if(!_publish_stats)
+            return;
+
+        // No Ipopt: the objective is the cost of the nominal sequence
+        stats.header.stamp = ros::Time::now();
+        stats.iterations = -1;
+        stats.status = 0;
+        stats.objective = _mppi._mppi_cost;
+        stats.cte_cost = 0.0;
+        stats.etheta_cost = 0.0;
+        stats.vel_cost = 0.0;
+        _stage_stats.FillHistogram(stats);
+        _pub_stats.publish(stats);
+    }
+
+    void MPPIPlannerROS::odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg)
+    {
+        _odom.Set(odomMsg);
+    }
+}
@@ -0,0 +1,323 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "multi_start.h"
+#include "tape_solver.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+typedef MultiStart::Dvector Dvector;
+typedef CppAD::ipopt::solve_result<Dvector> SolveResult;
+
+namespace
+{
+    // Path polynomial and its slope at x
+    void path(const Eigen::VectorXd &coeffs, double x, double &f, double &df)
+    {
+        f = 0.0;
+        df = 0.0;
+        for (int i = coeffs.size() - 1; i >= 0; i--)
+        {
+            df = df * x + f;
+            f = f * x + coeffs[i];
+        }
+    }
+
+    // Ipopt measures the cpu time of the whole process, which the
+    // hypotheses running side by side use up n times faster.
+    std::string scaleCpuTime(const std::string &options, double factor)
+    {
+        std::istringstream lines(options);
+        std::string line, scaled;
+        while (std::getline(lines, line))
+        {
+            std::istringstream tokens(line);
+            std::string type, name;
+            double value;
+            if (tokens >> type >> name >> value && type == "Numeric" && name == "max_cpu_time")
+            {
+                std::ostringstream budget;
+                budget << "Numeric max_cpu_time          " << value * factor;
+                line = budget.str();
+            }
+            scaled += line + "\n";
+        }
+        return scaled;
+    }
+}
+
+MultiStart::MultiStart()
+{
+    _path_heading = true;
+    _time_limit = 0;
+    _cancel = NULL;
+    _ref_vel = 1.0;
+    _max_angvel = 3.0;
+    _max_throttle = 1.0;
+    _winner = -1;
+    _coeffs = NULL;
+    _xl = _xu = _gl = _gu = NULL;
+    _zl = _zu = _lambda = NULL;
+    _generation = 0;
+    _busy = 0;
+    _stop = false;
+}
+
+MultiStart::~MultiStart()
+{
+    stopWorkers();
+}
+
+void MultiStart::LoadParams(const std::map<std::string, double> &params)
+{
+    _params = params;
+    _ref_vel = params.find("REF_V") != params.end() ? params.at("REF_V") : _ref_vel;
+    _max_angvel = params.find("ANGVEL") != params.end() ? params.at("ANGVEL") : _max_angvel;
+    _max_throttle = params.find("MAXTHR") != params.end() ? params.at("MAXTHR") : _max_throttle;
+    int hypotheses = params.find("HYPOTHESES") != params.end() ? int(params.at("HYPOTHESES")) : Hypotheses();
+    hypotheses = (hypotheses > 1) ? hypotheses : 0;
+    const bool gauss_newton = params.find("HESSIAN") != params.end() && params.at("HESSIAN") == 1;
+
+    _nominal.LoadParams(params);
+    _nominal.SetPathHeading(_path_heading);
+
+    if (hypotheses != Hypotheses())
+    {
+        stopWorkers();
+        _hypotheses.clear();
+        for (int i = 0; i < hypotheses; i++)
+        {
+            _hypotheses.emplace_back(new Hypothesis());
+        }
+        _stop = false;
+        for (int i = 1; i < Hypotheses(); i++)
+        {
+            _workers.emplace_back(&MultiStart::work, this, i, _generation);
+        }
+    }
+
+    for (int i = 0; i < Hypotheses(); i++)
+    {
+        // REF_V factors 0.75, 1.25, 0.5, 1.5, ... from hypothesis 3 on
+        const int j = i - 3;
+        const double step = 0.25 * (j / 2 + 1);
+        const double factor = (j < 0) ? 1.0 : std::max(0.25, (j % 2 == 0) ? 1.0 - step : 1.0 + step);
+
+        Hypothesis &h = *_hypotheses[i];
+        h.ref_vel = _ref_vel * factor;
+        std::map<std::string, double> variant = params;
+        variant["REF_V"] = h.ref_vel;
+        h.solver.LoadParams(variant);
+        h.solver.SetPathHeading(_path_heading);
+        h.solver.SetGaussNewton(gauss_newton);
+    }
+}
+
+void MultiStart::SetPathHeading(bool path_heading)
+{
+    _path_heading = path_heading;
+    _nominal.SetPathHeading(path_heading);
+    for (int i = 0; i < Hypotheses(); i++)
+    {
+        _hypotheses[i]->solver.SetPathHeading(path_heading);
+    }
+}
+
+int MultiStart::Iterations() const
+{
+    return (_winner < 0) ? -1 : _hypotheses[_winner]->solver.Iterations();
+}
+
+void MultiStart::Solve(const std::string &options, const Eigen::VectorXd &coeffs,
+                       const Dvector &xi, const Dvector &xl, const Dvector &xu,
+                       const Dvector &gl, const Dvector &gu, SolveResult &solution,
+                       const Dvector *zl, const Dvector *zu, const Dvector *lambda)
+{
+    const int n = Hypotheses();
+    const bool warm = zl && zu && lambda;
+    const int steps = (xi.size() + 2) / 8;
+    const std::string cold_options = scaleCpuTime(options, n);
+    std::string warm_options = cold_options;
+    warm_options += "String  warm_start_init_point      yes\n";
+    warm_options += "Numeric warm_start_bound_push      1e-6\n";
+    warm_options += "Numeric warm_start_mult_bound_push 1e-6\n";
+    warm_options += "Numeric mu_init                    1e-4\n";
+
+    // Starting points. Without a previous solution hypothesis 0 already
+    // starts from zero and 1 is skipped.
+    for (int i = 0; i < n; i++)
+    {
+        Hypothesis &h = *_hypotheses[i];
+        h.run = (i != 1 || warm);
+        h.warm = (i == 0 && warm);
+        h.options = h.warm ? warm_options : cold_options;
+        h.x.resize(xi.size());
+        for (size_t k = 0; k < xi.size(); k++)
+        {
+            // The others keep the initial state only
+            const bool initial = k % steps == 0 && k < size_t(6 * steps);
+            h.x[k] = (i == 0 || initial) ? xi[k] : 0.0;
+        }
+        if (i >= 2)
+            pursuitSeed(coeffs, h.ref_vel, h.x);
+        h.solver.SetTimeLimit(_time_limit);
+        h.solver.SetCancel(_cancel);
+
+        // CppAD memory has to be freed by the thread that allocated it,
+        // see cppad_parallel.h: size the results here so the workers only
+        // write them.
+        h.result.x.resize(xi.size());
+        h.result.zl.resize(xi.size());
+        h.result.zu.resize(xi.size());
+        h.result.g.resize(gl.size());
+        h.result.lambda.resize(gl.size());
+    }
+
+    _coeffs = &coeffs;
+    _xl = &xl;
+    _xu = &xu;
+    _gl = &gl;
+    _gu = &gu;
+    _zl = zl;
+    _zu = zu;
+    _lambda = lambda;
+
+    // Hypothesis 0 here, the others on the workers
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _busy = n - 1;
+        _generation++;
+    }
+    _start_cond.notify_all();
+    solve(0);
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done_cond.wait(lock, [this] { return _busy == 0; });
+    }
+
+    // Lowest nominal cost among the results that satisfy the model
+    _nominal.Prepare(coeffs);
+    _winner = -1;
+    double best = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        const Hypothesis &h = *_hypotheses[i];
+        const SolveResult &r = h.result;
+        if (!h.run || r.x.size() != xi.size())
+            continue;
+        bool usable = r.status == SolveResult::success || r.status == SolveResult::stop_at_acceptable_point;
+        if (!usable && _time_limit > 0 && r.g.size() == gl.size()
+            && (r.status == SolveResult::user_requested_stop || r.status == SolveResult::unknown))
+        {
+            usable = TapeSolver::MaxViolation(r.g, gl, gu) < 1e-4;
+        }
+        if (!usable)
+            continue;
+        const double cost = _nominal.Cost(r.x.data());
+        if (_winner < 0 || cost < best)
+        {
+            _winner = i;
+            best = cost;
+        }
+    }
+
+    // Nothing feasible: hand back the first hypothesis, the caller falls back
+    solution = _hypotheses[_winner < 0 ? 0 : _winner]->result;
+    if (_winner >= 0)
+        solution.obj_value = best;
+
+    _coeffs = NULL;
+}
+
+void MultiStart::pursuitSeed(const Eigen::VectorXd &coeffs, double ref_vel, Dvector &x) const
+{
+    const int N = (x.size() + 2) / 8;
+    const int x_start = 0, y_start = N, theta_start = 2 * N, v_start = 3 * N;
+    const int cte_start = 4 * N, etheta_start = 5 * N, angvel_start = 6 * N, a_start = 7 * N - 1;
+    const double dt = _params.find("DT") != _params.end() ? _params.at("DT") : 0.1;
+    // Half of the distance covered over the horizon at ref_vel
+    const double lookahead = std::max(0.3, 0.5 * std::fabs(ref_vel) * dt * N);
+
+    for (int i = 0; i < N - 1; i++)
+    {
+        const double x0 = x[x_start + i], y0 = x[y_start + i], theta0 = x[theta_start + i];
+        const double v0 = x[v_start + i], etheta0 = x[etheta_start + i];
+        double f0, df0, f_ahead, df_ahead;
+        path(coeffs, x0, f0, df0);
+        path(coeffs, x0 + lookahead, f_ahead, df_ahead);
+
+        // Curvature of the arc through the lookahead point, in the robot frame
+        const double dx = lookahead, dy = f_ahead - y0;
+        const double ly = -sin(theta0) * dx + cos(theta0) * dy;
+        const double kappa = 2.0 * ly / (dx * dx + dy * dy);
+        const double w0 = std::min(_max_angvel, std::max(-_max_angvel, v0 * kappa));
+        const double a0 = std::min(_max_throttle, std::max(-_max_throttle, (ref_vel - v0) / dt));
+
+        // Model rows of AnalyticSolver::Constraints, the seed satisfies them
+        x[angvel_start + i] = w0;
+        x[a_start + i] = a0;
+        x[x_start + i + 1] = x0 + v0 * cos(theta0) * dt;
+        x[y_start + i + 1] = y0 + v0 * sin(theta0) * dt;
+        x[theta_start + i + 1] = theta0 + w0 * dt;
+        x[v_start + i + 1] = v0 + a0 * dt;
+        x[cte_start + i + 1] = (f0 - y0) + v0 * sin(etheta0) * dt;
+        x[etheta_start + i + 1] = _path_heading ? (theta0 - atan(df0)) + w0 * dt : etheta0 + w0 * dt;
+    }
+}
+
+void MultiStart::solve(int index)
+{
+    Hypothesis &h = *_hypotheses[index];
+    if (!h.run)
+        return;
+    h.solver.Solve(h.options, *_coeffs, h.x, *_xl, *_xu, *_gl, *_gu, h.result,
+                   h.warm ? _zl : NULL, h.warm ? _zu : NULL, h.warm ? _lambda : NULL);
+}
+
+void MultiStart::work(int index, unsigned int generation)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _start_cond.wait(lock, [this, generation] { return _stop || _generation != generation; });
+        if (_stop)
+            break;
+        generation = _generation;
+
+        lock.unlock();
+        solve(index);
+        lock.lock();
+        if (--_busy == 0)
+            _done_cond.notify_one();
+    }
+}
+
+void MultiStart::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _start_cond.notify_all();
+    for (size_t i = 0; i < _workers.size(); i++)
+    {
+        if (_workers[i].joinable())
+            _workers[i].join();
+    }
+    _workers.clear();
+}
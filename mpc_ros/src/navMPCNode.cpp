@@ -16,6 +16,8 @@
 
 #include <iostream>
 #include <map>
+#include <atomic>
+#include <mutex>
 #include <math.h>
 #include "ros/ros.h"
 #include <geometry_msgs/PoseWithCovarianceStamped.h>
@@ -25,12 +27,33 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.h>
 #include <nav_msgs/Path.h>
 #include <nav_msgs/Odometry.h>
+#include <boost/make_shared.hpp>
 //#include <ackermann_msgs/AckermannDriveStamped.h>
 #include <visualization_msgs/Marker.h>
+#include <std_msgs/Float32.h>
+#include <std_srvs/Trigger.h>
 
 #include <fstream>
 
-#include "navMpc.h"
+#include "MPC.h"
+#include "linear_solver.h"
+#include "ipopt_options.h"
+#include "latest_msg.h"
+#include "compact_path_msg.h"
+#include "path_fit.h"
+#include "solver_thread.h"
+#include "callback_queues.h"
+#include "trajectory_publisher.h"
+#include "reference_prep.h"
+#include "latency_stats.h"
+#include "transform_cache.h"
+#include "path_transform.h"
+#include "trajectory_log.h"
+#include "flight_recorder.h"
+#include "trace_span.h"
+#include "event_trigger.h"
+#include "control_trigger.h"
+#include "metrics_exporter.h"
 #include <Eigen/Core>
 #include <Eigen/QR>
 
@@ -43,15 +66,25 @@ using namespace Eigen;
 class MPCNode
 {
     public:
-        MPCNode();
+        MPCNode(ros::NodeHandle nh = ros::NodeHandle(), ros::NodeHandle pn = ros::NodeHandle("~"));
+        ~MPCNode();
         int get_thread_numbers();
         
     private:
         ros::NodeHandle _nh;
+        // Before the subscriptions and timers on its queues, see callback_queues.h
+        CallbackQueues _queues;
+        bool _callback_queues;
+        // mpc_trajectory as a nav_msgs/Path, and packed (compact_trajectory)
+        bool _trajectory_path;
+        TrajectoryPublisher _pub_compact_traj;
         ros::Subscriber _sub_odom, _sub_path, _sub_goal, _sub_amcl;
         ros::Publisher _pub_globalpath,_pub_odompath, _pub_twist, _pub_mpctraj;
+        ros::Publisher _pub_totalcost, _pub_ctecost, _pub_ethetacost;
         ros::Timer _timer1;
         tf::TransformListener _tf_listener;
+        TransformCache _tf_cache; // see transform_cache.h
+        PathTransform _path_transform; // path callback buffers, see path_transform.h
         ros::Time tracking_stime;
         ros::Time tracking_etime;
         ros::Time tracking_time;
@@ -59,16 +92,29 @@ class MPCNode
         int tracking_time_nsec;
         
 
-        std::ofstream file;
-        unsigned int idx = 0;
+        // Binary trajectory log, written from solveControl. Declared before
+        // the solver thread so that it outlives it.
+        TrajectoryLog _log;
+        string _log_path;
+        double _log_max_mb;
+        int _log_max_files;
+
+        // Last cycles of solveControl, dumped on a deadline miss, a solve
+        // that did not succeed or dump_flight_recorder, see flight_recorder.h
+        FlightRecorder _flight;
+        ros::ServiceServer _srv_flight;
+
+        // Chrome trace of the spans, written by write_trace (BUILD_TRACE)
+        string _trace_path;
+        ros::ServiceServer _srv_trace;
 
         //time flag
         bool start_timef = false;
         bool end_timef = false;
 
         geometry_msgs::Point _goal_pos;
-        nav_msgs::Odometry _odom;
-        nav_msgs::Path _odom_path, _mpc_traj; 
+        LatestMsg<nav_msgs::Odometry> _odom;
+        LatestMsg<CompactPath> _odom_path;
         //ackermann_msgs::AckermannDriveStamped _ackermann_msg;
         geometry_msgs::Twist _twist_msg;
 
@@ -76,40 +122,126 @@ class MPCNode
         string _map_frame, _odom_frame, _car_frame;
 
         MPC _mpc;
+        PathFit _path_fit;
         map<string, double> _mpc_params;
         double _mpc_steps, _ref_cte, _ref_etheta, _ref_vel, _w_cte, _w_etheta, _w_vel, 
                _w_angvel, _w_accel, _w_angvel_d, _w_accel_d, _max_angvel, _max_throttle, _bound_value;
 
         //double _Lf; 
         double _dt, _w, _throttle, _speed, _max_speed;
-        double _pathLength, _goalRadius, _waypointsDist;
-        int _controller_freq, _downSampling, _thread_numbers;
-        bool _goal_received, _goal_reached, _path_computed, _pub_twist_flag, _debug_info, _delay_mode;
-        double polyeval(Eigen::VectorXd coeffs, double x);
-        Eigen::VectorXd polyfit(Eigen::VectorXd xvals, Eigen::VectorXd yvals, int order);
+        double _cycle_overhead; // cycle time besides the solve [s], for the deadline budget
+        double _pathLength, _goalRadius, _waypointsDist, _goal_phase_dist;
+        std::atomic<bool> _near_goal; // within _goal_phase_dist, set by amclCB
+        // The odom path and the transform it was built with from _path_frame
+        // (empty when it came in odom), moved on localization corrections
+        std::mutex _path_mutex;
+        tf::Transform _path_to_odom;
+        std::string _path_frame;
+        std::atomic<bool> _localization_update; // set by amclCB, see correctPath()
+        ros::Time _localization_stamp;
+        int _controller_freq, _downSampling, _thread_numbers, _hessian, _hypotheses, _integrator, _vehicle_model;
+        double _wheelbase, _max_steer;
+        bool _goal_received, _goal_reached, _path_computed, _pub_twist_flag, _debug_info, _delay_mode, _persistent_tape, _warm_start, _pursuit_seed, _rti, _analytic, _publish_cost, _async_solve, _deadline_mode, _reduced;
+
+        // Event-triggered mode: the command of the last solve is replayed
+        // while the robot stays on its prediction
+        EventTrigger _event_trigger;
+        MPCCommand _event_cmd;
+
+        // Odometry-triggered control, see control_trigger.h: odomCB starts
+        // the cycle, at once or on the one-shot _trigger_timer, and _timer1
+        // runs it only as a watchdog. _cycle_mutex keeps the two apart.
+        ControlTrigger _control_trigger;
+        ros::Timer _trigger_timer;
+        std::mutex _cycle_mutex;
+        void odomTrigger();
 
         void odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg);
-        void pathCB(const nav_msgs::Path::ConstPtr& pathMsg);
+        void pathCB(const CompactPath::ConstPtr& pathMsg);
         void desiredPathCB(const nav_msgs::Path::ConstPtr& pathMsg);
         void goalCB(const geometry_msgs::PoseStamped::ConstPtr& goalMsg);
         void amclCB(const geometry_msgs::PoseWithCovarianceStamped::ConstPtr& amclMsg);
         void controlLoopCB(const ros::TimerEvent&);
+        void triggerCB(const ros::TimerEvent&);
+        void controlCycle();
+        bool solveControl(MPCCommand &cmd);
+        bool prepareReference(ReferencePacket &ref);
+        void correctPath();
+        bool dumpFlightCB(std_srvs::Trigger::Request &req, std_srvs::Trigger::Response &res);
+        bool writeTraceCB(std_srvs::Trigger::Request &req, std_srvs::Trigger::Response &res);
+
+        // Priority and CPUs of the solver thread
+        RealtimeSettings _realtime;
+
+        // Solve and tracking metrics on /diagnostics and optionally HTTP
+        MetricsExporter _metrics;
+
+        // Odometry snapshot and path fit ahead of the solver (prep_thread),
+        // see reference_prep.h. Without the thread _ref_packet is prepared in
+        // solveControl.
+        bool _prep_thread;
+        ReferencePacket _ref_packet;
+        ReferencePrep _reference_prep;
+
+        // Declared last: the solver thread is joined before the members it uses go away
+        SolverThread _solver_thread;
 }; // end of class
 
 
-MPCNode::MPCNode()
+MPCNode::MPCNode(ros::NodeHandle nh, ros::NodeHandle pn) : _nh(nh)
 {
-    //Private parameters handler
-    ros::NodeHandle pn("~");
-
     //Parameters for control loop
     pn.param("thread_numbers", _thread_numbers, 2); // number of threads for this ROS node
     pn.param("pub_twist_cmd", _pub_twist_flag, true);
     pn.param("debug_info", _debug_info, true);
+    pn.param("publish_cost", _publish_cost, false); // publish the MPC cost terms
     pn.param("delay_mode", _delay_mode, true);
+    pn.param("async_solve", _async_solve, false); // solve on a separate thread, the timer replays the last solution
+    pn.param("prep_thread", _prep_thread, false); // fit the path on its own thread whenever the odometry or the path updates
+    pn.param("callback_queues", _callback_queues, false); // odometry and the control timer on a real-time queue, paths and goals on another
+    bool compact_trajectory;
+    pn.param("trajectory_path", _trajectory_path, true); // the prediction on mpc_trajectory as a nav_msgs/Path
+    pn.param("compact_trajectory", compact_trajectory, false); // and packed on mpc_trajectory_compact, see msg/MPCTrajectory.msg
+    int rt_priority, rt_prefault_stack_kb, rt_prefault_heap_mb;
+    std::string rt_cpus;
+    bool rt_lock_memory;
+    pn.param("rt_priority", rt_priority, 0); // SCHED_FIFO priority of the solver thread, 0 keeps SCHED_OTHER
+    pn.param<std::string>("rt_cpus", rt_cpus, ""); // CPUs of the solver thread, e.g. "2,3"; empty: any
+    pn.param("rt_prefault_stack_kb", rt_prefault_stack_kb, 0); // stack the solver thread touches before its first solve
+    pn.param("rt_lock_memory", rt_lock_memory, false); // mlockall the process
+    pn.param("rt_prefault_heap_mb", rt_prefault_heap_mb, 0); // heap touched once after locking
+    _realtime.Configure(rt_priority, rt_cpus, std::max(rt_prefault_stack_kb, 0));
+    if(rt_lock_memory)
+    {
+        std::string report;
+        if(!RealtimeSettings::LockMemory(std::max(rt_prefault_heap_mb, 0), report))
+            ROS_WARN("Memory is not locked: %s", report.c_str());
+    }
+    bool event_trigger;
+    double event_max_position, event_max_heading, event_max_age;
+    pn.param("event_trigger", event_trigger, false); // solve again only when the robot leaves the last prediction
+    pn.param("event_max_position", event_max_position, 0.03); // [m]
+    pn.param("event_max_heading", event_max_heading, 0.05); // [rad]
+    pn.param("event_max_age", event_max_age, 0.5); // oldest prediction that is replayed [s]
+    _event_trigger.Configure(event_trigger, event_max_position, event_max_heading, event_max_age);
+    bool odom_trigger;
+    int odom_trigger_every;
+    double odom_trigger_offset, odom_trigger_watchdog;
+    pn.param("odom_trigger", odom_trigger, false); // start the control cycle on the odometry instead of the timer
+    pn.param("odom_trigger_every", odom_trigger_every, 1); // on every k-th message
+    pn.param("odom_trigger_offset", odom_trigger_offset, 0.0); // this long after it [s]
+    pn.param("odom_trigger_watchdog", odom_trigger_watchdog, 1.5); // control periods without one before the timer runs the cycle
+    _control_trigger.Configure(odom_trigger, odom_trigger_every, odom_trigger_offset, odom_trigger_watchdog);
+    pn.param("deadline_mode", _deadline_mode, false); // bound each solve by the controller period
     pn.param("max_speed", _max_speed, 0.50); // unit: m/s
     pn.param("waypoints_dist", _waypointsDist, -1.0); // unit: m
     pn.param("path_length", _pathLength, 8.0); // unit: m
+    int fit_max_order;
+    double fit_tolerance, fit_min_window;
+    pn.param("path_fit_max_order", fit_max_order, 0); // adaptive fit of order 1 to this, 0 keeps the cubic
+    pn.param("path_fit_tolerance", fit_tolerance, 0.01); // RMS residual of an accepted order [m]
+    pn.param("path_fit_min_window", fit_min_window, 0.5); // shortest window of waypoints that is fitted [m]
+    _path_fit.SetAdaptive(fit_max_order, fit_tolerance, fit_min_window);
     pn.param("goal_radius", _goalRadius, 0.5); // unit: m
     pn.param("controller_freq", _controller_freq, 10);
     //pn.param("vehicle_Lf", _Lf, 0.290); // distance between the front of the vehicle and its center of gravity
@@ -130,6 +262,81 @@ MPCNode::MPCNode()
     pn.param("mpc_max_angvel", _max_angvel, 3.0); // Maximal angvel radian (~30 deg)
     pn.param("mpc_max_throttle", _max_throttle, 1.0); // Maximal throttle accel
     pn.param("mpc_bound_value", _bound_value, 1.0e3); // Bound value for other variables
+    pn.param("mpc_persistent_tape", _persistent_tape, true); // Reuse the recorded CppAD tape across solves
+    pn.param("mpc_warm_start", _warm_start, true); // Seed each solve with the shifted previous solution
+    pn.param("mpc_pursuit_seed", _pursuit_seed, true); // Pure pursuit rollout as the start without a previous solution
+    pn.param("mpc_rti", _rti, false); // One SQP step per cycle instead of a full Ipopt solve
+    bool ltv;
+    pn.param("mpc_ltv", ltv, false); // Linear time-varying MPC: the mpc_rti linearization as one sparse QP solved by ADMM
+    pn.param("mpc_analytic", _analytic, false); // Hand-written derivatives instead of CppAD
+    pn.param("mpc_hessian", _hessian, 0); // 0 exact, 1 Gauss-Newton, 2 limited-memory
+    string linear_solver_name;
+    int linear_order, linear_threads;
+    pn.param<std::string>("mpc_linear_solver", linear_solver_name, ""); // Ipopt linear solver (mumps, ma27, ma57, ...), auto: the fastest at startup, empty: Ipopt's default
+    std::string ipopt_options_path;
+    pn.param<std::string>("mpc_ipopt_options", ipopt_options_path, ""); // Options file of mpc_ipopt_tune over the built-in Ipopt options, empty: none
+    pn.param("mpc_linear_order", linear_order, -1); // its fill-reducing ordering, see linear_solver.h, -1 its default
+    pn.param("mpc_linear_threads", linear_threads, 0); // OpenMP threads of ma86, ma97 and pardiso, 0 leaves OMP_NUM_THREADS
+    bool solve_policy;
+    int tracking_max_iter;
+    double tracking_tol;
+    pn.param("mpc_solve_policy", solve_policy, false); // Ipopt tolerances and max_iter by phase (start-up, tracking, near goal), see solve_policy.h
+    pn.param("mpc_tracking_tol", tracking_tol, 1e-5); // Ipopt tol while tracking
+    pn.param("mpc_tracking_max_iter", tracking_max_iter, 30); // Ipopt max_iter while tracking
+    pn.param("mpc_goal_phase_dist", _goal_phase_dist, 1.0); // Distance to the goal of the near goal phase [m]
+    pn.param("mpc_integrator", _integrator, 0); // 0 Euler, 1 RK2, 2 RK4, 3 exact arc, see integrator.h
+    pn.param("mpc_vehicle_model", _vehicle_model, 0); // 0 unicycle of FG_eval, 1 diff drive, 2 bicycle, 3 holonomic, see vehicle_model.h
+    pn.param("mpc_wheelbase", _wheelbase, 0.3); // bicycle, unit: m
+    pn.param("mpc_max_steer", _max_steer, 0.5); // bicycle, unit: rad
+    bool terminal;
+    double terminal_cte, terminal_etheta;
+    pn.param("mpc_terminal", terminal, false); // LQR cost-to-go on the last step, see terminal_cost.h
+    pn.param("mpc_terminal_cte", terminal_cte, 0.0); // terminal set on its cte [m], 0 none
+    pn.param("mpc_terminal_etheta", terminal_etheta, 0.0); // and on its etheta [rad]
+    pn.param("mpc_hypotheses", _hypotheses, 1); // parallel solves from different starts, 1 disables
+    pn.param("mpc_reduced", _reduced, false); // cte and etheta computed in the cost, not NLP variables
+    bool single_precision;
+    pn.param("mpc_single_precision", single_precision, false); // Jacobian and Hessian of the tape backend on a float tape
+    bool hessian_stages;
+    pn.param("mpc_hessian_stages", hessian_stages, false); // Hessian of the tape backend summed step by step
+    int hessian_threads;
+    pn.param("mpc_hessian_threads", hessian_threads, 1); // threads of those steps, the solving one included
+    int hessian_reuse;
+    pn.param("mpc_hessian_reuse", hessian_reuse, 0); // Ipopt iterations an exact Hessian of the tape backend is kept for, 0 none
+    double hessian_reuse_step, hessian_reuse_lambda;
+    pn.param("mpc_hessian_reuse_step", hessian_reuse_step, 0.05); // largest move of a variable that keeps it
+    pn.param("mpc_hessian_reuse_lambda", hessian_reuse_lambda, 0.1); // largest relative move of a multiplier that keeps it
+    int taylor_capacity;
+    pn.param("mpc_taylor_capacity", taylor_capacity, -1); // Taylor orders the tapes keep between solves, 0 frees them, -1 all
+    int input_stop, input_stop_iters;
+    double input_stop_tol;
+    pn.param("mpc_input_stop", input_stop, 0); // stop the tape solve once the inputs of that many first steps settled, 0 off
+    pn.param("mpc_input_stop_tol", input_stop_tol, 1e-3); // largest change of those inputs between iterates
+    pn.param("mpc_input_stop_iters", input_stop_iters, 2); // iterates in a row within it
+    bool split_tape;
+    pn.param("mpc_split_tape", split_tape, false); // cost and constraints on tapes of their own, for the gradient and Jacobian sweeps
+    bool constant_jacobian;
+    pn.param("mpc_constant_jacobian", constant_jacobian, false); // constant Jacobian entries swept once per recording
+    bool scaling;
+    pn.param("mpc_scaling", scaling, false); // fixed scaling of the tape solves from the parameters, instead of Ipopt's gradient-based one
+    int sparsity;
+    pn.param("mpc_sparsity", sparsity, -1); // sparsity sweeps of the tapes: 0 bit-packed, 1 sets, -1 auto
+
+    //Parameter for the trajectory log, see trajectory_log.h
+    pn.param<std::string>("log_path", _log_path, ""); // binary log file, empty disables it
+    pn.param("log_max_mb", _log_max_mb, 64.0); // rotate above this size
+    pn.param("log_max_files", _log_max_files, 4); // rotated files kept
+
+    //Parameter for the flight recorder, see flight_recorder.h
+    int flight_cycles;
+    string flight_dir;
+    double flight_interval;
+    pn.param("flight_recorder_cycles", flight_cycles, 100); // cycles kept for a dump, 0 disables it
+    pn.param<std::string>("flight_recorder_dir", flight_dir, ""); // dump directory, empty for the working directory (ROS_HOME)
+    pn.param("flight_recorder_interval", flight_interval, 5.0); // least time between automatic dumps [s]
+
+    //Parameter for the trace spans, see trace_span.h
+    pn.param<std::string>("trace_path", _trace_path, "mpc_trace.json"); // Chrome trace JSON of write_trace, relative to the working directory
 
     //Parameter for topics & Frame name
     pn.param<std::string>("global_path_topic", _globalPath_topic, "/move_base/TrajectoryPlannerROS/global_plan" );
@@ -137,6 +344,16 @@ MPCNode::MPCNode()
     pn.param<std::string>("map_frame", _map_frame, "map" ); //*****for mpc, "odom"
     pn.param<std::string>("odom_frame", _odom_frame, "odom");
     pn.param<std::string>("car_frame", _car_frame, "base_footprint" );
+    double tf_max_age;
+    pn.param("tf_max_age", tf_max_age, 0.5); // reuse the last transform this long when TF drops out [s]
+    _tf_cache.SetMaxAge(tf_max_age);
+    _tf_cache.AdvertiseDiagnostics(_nh, pn.getNamespace());
+    _tf_cache.SetMetrics(&_metrics.Metrics());
+    double metrics_period;
+    int metrics_port;
+    pn.param("metrics_period", metrics_period, 1.0); // controller summary on /diagnostics [s]
+    pn.param("metrics_port", metrics_port, 0); // Prometheus metrics on http://host:port/metrics, 0 disables
+    _metrics.Start(_nh, pn.getNamespace(), metrics_period, metrics_port);
 
     //Display the parameters
     cout << "\n===== Parameters =====" << endl;
@@ -152,36 +369,53 @@ MPCNode::MPCNode()
     cout << "mpc_max_angvel: "  << _max_angvel << endl;
 
     //Publishers and Subscribers
-    _sub_odom   = _nh.subscribe("/odom", 1, &MPCNode::odomCB, this);
-    _sub_path   = _nh.subscribe( _globalPath_topic, 1, &MPCNode::pathCB, this);
-    _sub_goal   = _nh.subscribe( _goal_topic, 1, &MPCNode::goalCB, this);
-    _sub_amcl   = _nh.subscribe("/amcl_pose", 5, &MPCNode::amclCB, this);
+    ros::NodeHandle control_nh = _callback_queues ? _queues.Control(_nh) : _nh;
+    ros::NodeHandle bulk_nh = _callback_queues ? _queues.Bulk(_nh) : _nh;
+    _sub_odom   = control_nh.subscribe("/odom", 1, &MPCNode::odomCB, this);
+    _sub_path   = bulk_nh.subscribe( _globalPath_topic, 1, &MPCNode::pathCB, this);
+    _sub_goal   = bulk_nh.subscribe( _goal_topic, 1, &MPCNode::goalCB, this);
+    _sub_amcl   = bulk_nh.subscribe("/amcl_pose", 5, &MPCNode::amclCB, this);
     _pub_globalpath  = _nh.advertise<nav_msgs::Path>("/global_path", 1); // Global path generated from another source
     _pub_odompath  = _nh.advertise<nav_msgs::Path>("/mpc_reference", 1); // reference path for MPC ///mpc_reference 
     _pub_mpctraj   = _nh.advertise<nav_msgs::Path>("/mpc_trajectory", 1);// MPC trajectory output
+    if(compact_trajectory)
+        _pub_compact_traj.Advertise(_nh, "/mpc_trajectory_compact");
     if(_pub_twist_flag)
         _pub_twist = _nh.advertise<geometry_msgs::Twist>("/cmd_vel", 1); //for stage (Ackermann msg non-supported)
+    if(_publish_cost)
+    {
+        _pub_totalcost  = _nh.advertise<std_msgs::Float32>("/total_cost", 1); // cost of the MPC solution
+        _pub_ctecost  = _nh.advertise<std_msgs::Float32>("/cross_track_error", 1); // cross track error term
+        _pub_ethetacost  = _nh.advertise<std_msgs::Float32>("/theta_error", 1); // heading error term
+    }
     
     //Timer
-    _timer1 = _nh.createTimer(ros::Duration((1.0)/_controller_freq), &MPCNode::controlLoopCB, this); // 10Hz //*****mpc
+    _timer1 = control_nh.createTimer(ros::Duration((1.0)/_controller_freq), &MPCNode::controlLoopCB, this); // 10Hz //*****mpc
+    if(_control_trigger.Enabled() && _control_trigger.Offset() > 0)
+        _trigger_timer = control_nh.createTimer(ros::Duration(_control_trigger.Offset()), &MPCNode::triggerCB, this, true, false);
 
     //Init variables
     _goal_received = false;
+    _near_goal = false;
+    _localization_update = false;
     _goal_reached  = false;
     _path_computed = false;
     _throttle = 0.0; 
+    _cycle_overhead = 0.0;
     _w = 0.0;
     _speed = 0.0;
 
     //_ackermann_msg = ackermann_msgs::AckermannDriveStamped();
     _twist_msg = geometry_msgs::Twist();
-    _mpc_traj = nav_msgs::Path();
 
 
 
-    idx = 0;
-    file.open("/home/nscl1016/catkin_ws/src/mpc_ros/mpc.csv");
-    file << "idx"<< "," << "cte" << "," <<  "etheta" << "," << "cmd_vel.linear.x" << "," << "cmd_vel.angular.z" << "\n";
+    if(!_log_path.empty() && !_log.Open(_log_path, _log_max_mb * 1e6, _log_max_files))
+        ROS_WARN("Cannot open the trajectory log %s", _log_path.c_str());
+    if(flight_cycles > 0 && _flight.Open(flight_dir, flight_cycles, flight_interval))
+        _srv_flight = _nh.advertiseService("dump_flight_recorder", &MPCNode::dumpFlightCB, this);
+    if(trace_span::Enabled())
+        _srv_trace = _nh.advertiseService("write_trace", &MPCNode::writeTraceCB, this);
 
 
     //Init parameters for MPC object
@@ -201,115 +435,172 @@ MPCNode::MPCNode()
     _mpc_params["ANGVEL"]   = _max_angvel;
     _mpc_params["MAXTHR"]   = _max_throttle;
     _mpc_params["BOUND"]    = _bound_value;
+    _mpc_params["TAPE"]     = _persistent_tape;
+    _mpc_params["WARM"]     = _warm_start;
+    _mpc_params["PURSUIT_SEED"] = _pursuit_seed;
+    _mpc_params["RTI"]      = _rti;
+    _mpc_params["LTV"]      = ltv;
+    _mpc_params["ANALYTIC"] = _analytic;
+    _mpc_params["HESSIAN"]  = _hessian;
+    _mpc_params["INTEGRATOR"] = _integrator;
+    _mpc_params["VEHICLE_MODEL"] = _vehicle_model;
+    _mpc_params["WHEELBASE"] = _wheelbase;
+    _mpc_params["MAXSTEER"] = _max_steer;
+    _mpc_params["TERMINAL"] = terminal;
+    _mpc_params["TERMINAL_CTE"] = terminal_cte;
+    _mpc_params["TERMINAL_ETHETA"] = terminal_etheta;
+    _mpc_params["HYPOTHESES"] = _hypotheses;
+    _mpc_params["REDUCED"]  = _reduced;
+    _mpc_params["PRECISION"] = single_precision ? 1 : 0;
+    _mpc_params["HESSIAN_STAGES"] = hessian_stages ? 1 : 0;
+    _mpc_params["HESSIAN_THREADS"] = hessian_threads;
+    _mpc_params["TAYLOR_CAPACITY"] = taylor_capacity;
+    _mpc_params["HESSIAN_REUSE"] = hessian_reuse;
+    _mpc_params["HESSIAN_REUSE_STEP"] = hessian_reuse_step;
+    _mpc_params["HESSIAN_REUSE_LAMBDA"] = hessian_reuse_lambda;
+    _mpc_params["INPUT_STOP"] = input_stop;
+    _mpc_params["INPUT_STOP_TOL"] = input_stop_tol;
+    _mpc_params["INPUT_STOP_ITERS"] = input_stop_iters;
+    _mpc_params["SCALING"] = scaling ? 1 : 0;
+    _mpc_params["SPLIT_TAPE"] = split_tape ? 1 : 0;
+    _mpc_params["CONST_JACOBIAN"] = constant_jacobian ? 1 : 0;
+    _mpc_params["SPARSITY"] = sparsity;
+    _mpc_params["PATH_HEADING"] = 0; // etheta integrated from the turn rate
+    _mpc_params["LINEAR_ORDER"] = linear_order;
+    _mpc_params["LINEAR_THREADS"] = linear_threads;
+    _mpc_params["POLICY"] = solve_policy;
+    _mpc_params["TOL_TRACKING"] = tracking_tol;
+    _mpc_params["MAX_ITER_TRACKING"] = tracking_max_iter;
+    _mpc_params["LINEAR_SOLVER"] = linear_solver::Parse(linear_solver_name);
+    if(linear_solver_name == "auto")
+    {
+        std::string report;
+        _mpc_params["LINEAR_SOLVER"] = MPC::CalibrateLinearSolver(_mpc_params, report);
+        ROS_INFO("Linear solvers on this horizon: %s. Using %s", report.c_str(), linear_solver::Name(_mpc_params["LINEAR_SOLVER"]));
+    }
+    else if(_mpc_params["LINEAR_SOLVER"] < 0)
+    {
+        ROS_WARN("Unknown mpc_linear_solver %s, using Ipopt's default", linear_solver_name.c_str());
+        _mpc_params["LINEAR_SOLVER"] = linear_solver::DEFAULT;
+    }
     _mpc.LoadParams(_mpc_params);
-}
-
-// Public: return _thread_numbers
-int MPCNode::get_thread_numbers()
-{
-    return _thread_numbers;
-}
+    if(!ipopt_options_path.empty())
+    {
+        std::string ipopt_options, error;
+        if(ipopt_options::Load(ipopt_options_path, ipopt_options, error))
+            _mpc.SetIpoptOptions(ipopt_options);
+        else
+            ROS_WARN("Ipopt options file not used, %s", error.c_str());
+    }
 
-// Evaluate a polynomial.
-double MPCNode::polyeval(Eigen::VectorXd coeffs, double x) 
-{
-    double result = 0.0;
-    for (int i = 0; i < coeffs.size(); i++) 
+    if(_prep_thread)
+        _reference_prep.Start(std::bind(&MPCNode::prepareReference, this, std::placeholders::_1));
+    if(_async_solve)
+    {
+        _solver_thread.Start(std::bind(&MPCNode::solveControl, this, std::placeholders::_1), _realtime);
+        if(!_solver_thread.RealtimeReport().empty())
+            ROS_WARN("Solver thread runs without its realtime settings: %s", _solver_thread.RealtimeReport().c_str());
+    }
+    if(_callback_queues)
     {
-        result += coeffs[i] * pow(x, i);
+        _queues.Start(_realtime, 1);
+        if(!_queues.RealtimeReport().empty())
+            ROS_WARN("Control queue runs without its realtime settings: %s", _queues.RealtimeReport().c_str());
     }
-    return result;
+    else if(!_async_solve && _realtime.Enabled())
+        ROS_WARN("rt_priority, rt_cpus and rt_prefault_stack_kb only apply with async_solve or callback_queues");
 }
 
-// Fit a polynomial.
-// Adapted from
-// https://github.com/JuliaMath/Polynomials.jl/blob/master/src/Polynomials.jl#L676-L716
-Eigen::VectorXd MPCNode::polyfit(Eigen::VectorXd xvals, Eigen::VectorXd yvals, int order) 
+MPCNode::~MPCNode()
 {
-    assert(xvals.size() == yvals.size());
-    assert(order >= 1 && order <= xvals.size() - 1);
-    Eigen::MatrixXd A(xvals.size(), order + 1);
-
-    for (int i = 0; i < xvals.size(); i++)
-        A(i, 0) = 1.0;
+    // No control or bulk callback runs while the members go away
+    _queues.Stop();
+}
 
-    for (int j = 0; j < xvals.size(); j++) 
-    {
-        for (int i = 0; i < order; i++) 
-            A(j, i + 1) = A(j, i) * xvals(j);
-    }
-    auto Q = A.householderQr();
-    auto result = Q.solve(yvals);
-    return result;
+// Public: return _thread_numbers
+int MPCNode::get_thread_numbers()
+{
+    return _thread_numbers;
 }
 
+
 // CallBack: Update odometry
 void MPCNode::odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg)
 {
-    _odom = *odomMsg;
+    MPC_TRACE_SPAN("odom_cb");
+    _odom.Set(odomMsg);
+    if(_prep_thread)
+        _reference_prep.Notify();
+    odomTrigger();
 }
 
 // CallBack: Update path waypoints (conversion to odom frame)
-void MPCNode::pathCB(const nav_msgs::Path::ConstPtr& pathMsg)
+void MPCNode::pathCB(const CompactPath::ConstPtr& pathMsg)
 {
+    MPC_TRACE_SPAN("path_cb");
     if(_goal_received && !_goal_reached)
     {    
-        nav_msgs::Path odom_path = nav_msgs::Path();
-        try
+        boost::shared_ptr<CompactPath> odom_path = boost::make_shared<CompactPath>();
+        // map -> odom once for the whole path, without waiting on TF
+        tf::Transform map_to_odom;
+        const std::string &path_frame = pathMsg->Frame().empty() ? _map_frame : pathMsg->Frame();
+        if(!_tf_cache.Lookup(_tf_listener, _odom_frame, path_frame, map_to_odom))
+            return; // keep the previous path, the next message retries
+
+        double total_length = 0.0;
+        int sampling = _downSampling;
+
+        //find waypoints distance
+        if(_waypointsDist <=0.0)
+        {        
+            double dx = pathMsg->X(1) - pathMsg->X(0);
+            double dy = pathMsg->Y(1) - pathMsg->Y(0);
+            _waypointsDist = sqrt(dx*dx + dy*dy);
+            _downSampling = int(_pathLength/10.0/_waypointsDist);
+        }            
+
+        // Whole path at once, no messages for the waypoints
+        _path_transform.Transform(map_to_odom, *pathMsg);
+
+        // Cut and downsampling the path
+        for(int i =0; i< pathMsg->Size(); i++)
         {
-            double total_length = 0.0;
-            int sampling = _downSampling;
-
-            //find waypoints distance
-            if(_waypointsDist <=0.0)
-            {        
-                double dx = pathMsg->poses[1].pose.position.x - pathMsg->poses[0].pose.position.x;
-                double dy = pathMsg->poses[1].pose.position.y - pathMsg->poses[0].pose.position.y;
-                _waypointsDist = sqrt(dx*dx + dy*dy);
-                _downSampling = int(_pathLength/10.0/_waypointsDist);
-            }            
-
-            // Cut and downsampling the path
-            for(int i =0; i< pathMsg->poses.size(); i++)
-            {
-                if(total_length > _pathLength)
-                    break;
-
-                if(sampling == _downSampling)
-                {   
-                    geometry_msgs::PoseStamped tempPose;
-                    _tf_listener.transformPose(_odom_frame, ros::Time(0) , pathMsg->poses[i], _map_frame, tempPose);                     
-                    odom_path.poses.push_back(tempPose);  
-                    sampling = 0;
-                }
-                total_length = total_length + _waypointsDist; 
-                sampling = sampling + 1;  
-            }
-           
-            if(odom_path.poses.size() >= 6 )
-            {
-                _odom_path = odom_path; // Path waypoints in odom frame
-                _path_computed = true;
-                // publish odom path
-                odom_path.header.frame_id = _odom_frame;
-                odom_path.header.stamp = ros::Time::now();
-                _pub_odompath.publish(odom_path);
+            if(total_length > _pathLength)
+                break;
+
+            if(sampling == _downSampling)
+            {   
+                odom_path->PushBack(_path_transform.X(i), _path_transform.Y(i), _path_transform.Yaw(i));
+                sampling = 0;
             }
-            else
+            total_length = total_length + _waypointsDist; 
+            sampling = sampling + 1;  
+        }
+       
+        if(odom_path->Size() >= 6 )
+        {
+            // hand the path to the control loop, publish it as a message
+            odom_path->SetFrame(_odom_frame);
+            odom_path->SetStamp(ros::Time::now());
             {
-                cout << "Failed to path generation" << endl;
-                _waypointsDist = -1;
+                std::lock_guard<std::mutex> lock(_path_mutex);
+                _odom_path.Set(odom_path); // Path waypoints in odom frame
+                _path_to_odom = map_to_odom;
+                _path_frame = path_frame;
             }
-            //DEBUG            
-            //cout << endl << "N: " << odom_path.poses.size() << endl 
-            //<<  "Car path[0]: " << odom_path.poses[0];
-            // << ", path[N]: " << _odom_path.poses[_odom_path.poses.size()-1] << endl;
+            if(_prep_thread)
+                _reference_prep.Notify();
+            _event_trigger.Reset(); // new plan, solve again
+            _path_computed = true;
+            _pub_odompath.publish(odom_path); // as a nav_msgs/Path, see compact_path_msg.h
         }
-        catch(tf::TransformException &ex)
+        else
         {
-            ROS_ERROR("%s",ex.what());
-            ros::Duration(1.0).sleep();
+            cout << "Failed to path generation" << endl;
+            _waypointsDist = -1;
         }
+        //DEBUG            
+        //cout << endl << "N: " << odom_path->Size() << endl;
     }
 }
 
@@ -326,11 +617,17 @@ void MPCNode::goalCB(const geometry_msgs::PoseStamped::ConstPtr& goalMsg)
 // Callback: Check if the car is inside the goal area or not 
 void MPCNode::amclCB(const geometry_msgs::PoseWithCovarianceStamped::ConstPtr& amclMsg)
 {
+    {
+        std::lock_guard<std::mutex> lock(_path_mutex);
+        _localization_stamp = ros::Time::now();
+    }
+    _localization_update = true;
     if(_goal_received)
     {
         double car2goal_x = _goal_pos.x - amclMsg->pose.pose.position.x;
         double car2goal_y = _goal_pos.y - amclMsg->pose.pose.position.y;
         double dist2goal = sqrt(car2goal_x*car2goal_x + car2goal_y*car2goal_y);
+        _near_goal = dist2goal < _goal_phase_dist;
         if(dist2goal < _goalRadius)
         {
             if(start_timef)
@@ -339,10 +636,6 @@ void MPCNode::amclCB(const geometry_msgs::PoseWithCovarianceStamped::ConstPtr& a
                 tracking_time_sec = tracking_etime.sec - tracking_stime.sec; 
                 tracking_time_nsec = tracking_etime.nsec - tracking_stime.nsec; 
                 
-                                
-                file << "tracking time"<< "," << tracking_time_sec << "," <<  tracking_time_nsec << "\n";
-
-                file.close();
 
                 
                 start_timef = false;
@@ -350,6 +643,7 @@ void MPCNode::amclCB(const geometry_msgs::PoseWithCovarianceStamped::ConstPtr& a
             }
             _goal_received = false;
             _goal_reached = true;
+            _near_goal = false;
             _path_computed = false;
             ROS_INFO("Goal Reached !");
             cout << "tracking time: " << tracking_time_sec << "." << tracking_time_nsec << endl;
@@ -359,158 +653,309 @@ void MPCNode::amclCB(const geometry_msgs::PoseWithCovarianceStamped::ConstPtr& a
 }
 
 
-// Timer: Control Loop (closed loop nonlinear MPC)
+// The odometry starts the cycle with odom_trigger
+void MPCNode::odomTrigger()
+{
+    if(!_control_trigger.Odometry())
+        return;
+    if(_control_trigger.Offset() > 0)
+    {
+        // One-shot, restarted by every k-th message
+        _trigger_timer.stop();
+        _trigger_timer.setPeriod(ros::Duration(_control_trigger.Offset()));
+        _trigger_timer.start();
+    }
+    else
+        controlCycle();
+}
+
+void MPCNode::triggerCB(const ros::TimerEvent&)
+{
+    controlCycle();
+}
+
+// Timer: the control cycle, or with odom_trigger its watchdog
 void MPCNode::controlLoopCB(const ros::TimerEvent&)
-{          
+{
+    if(!_control_trigger.Overdue(ros::Time::now().toSec(), 1.0 / _controller_freq))
+        return;
+    if(_control_trigger.Enabled())
+    {
+        _control_trigger.CountWatchdog();
+        ROS_WARN_THROTTLE(5.0, "No odometry, the timer runs the control cycle (%u times)", _control_trigger.Watchdog());
+    }
+    controlCycle();
+}
+
+// Control Loop (closed loop nonlinear MPC)
+void MPCNode::controlCycle()
+{
+    // An odometry and a watchdog cycle at once: the later one is dropped
+    std::unique_lock<std::mutex> cycle_lock(_cycle_mutex, std::try_to_lock);
+    if(!cycle_lock.owns_lock())
+        return;
+    _control_trigger.Started(ros::Time::now().toSec());
+    MPC_TRACE_SPAN("control_timer");
+    double angvel = 0.0;
     if(_goal_received && !_goal_reached && _path_computed ) //received goal & goal not reached    
     {
-        if(!start_timef)
+        MPCCommand cmd;
+        bool valid;
+        if(_async_solve)
         {
-            tracking_stime == ros::Time::now();
-            start_timef = true;
+            // The solver thread starts from the newest state, meanwhile follow the last solution
+            _solver_thread.Notify();
+            valid = _solver_thread.Latest(cmd) && cmd.Sample(ros::Time::now().toSec(), _speed, angvel);
         }
-        nav_msgs::Odometry odom = _odom; 
-        nav_msgs::Path odom_path = _odom_path;   
-        geometry_msgs::Point goal_pos = _goal_pos;
-
-        // Update system states: X=[x, y, theta, v]
-        const double px = odom.pose.pose.position.x; //pose: odom frame
-        const double py = odom.pose.pose.position.y;
-        tf::Pose pose;
-        tf::poseMsgToTF(odom.pose.pose, pose);
-        double theta = tf::getYaw(pose.getRotation());
-        const double v = odom.twist.twist.linear.x; //twist: body fixed frame
-        // Update system inputs: U=[w, throttle]
-        const double w = _w; // steering -> w
-        //const double steering = _steering;  // radian
-        const double throttle = _throttle; // accel: >0; brake: <0
-        const double dt = _dt;
-        //const double Lf = _Lf;
-
-        // Waypoints related parameters
-        const int N = odom_path.poses.size(); // Number of waypoints
-        const double costheta = cos(theta);
-        const double sintheta = sin(theta);
-
-        // Convert to the vehicle coordinate system
-        VectorXd x_veh(N);
-        VectorXd y_veh(N);
-        for(int i = 0; i < N; i++) 
+        else
         {
-            const double dx = odom_path.poses[i].pose.position.x - px;
-            const double dy = odom_path.poses[i].pose.position.y - py;
-            x_veh[i] = dx * costheta + dy * sintheta;
-            y_veh[i] = dy * costheta - dx * sintheta;
+            // A replayed command is sampled at this tick, a new one at its
+            // first step as before
+            const double t = ros::Time::now().toSec();
+            valid = solveControl(cmd) && cmd.Sample(max(t, cmd.stamp), _speed, angvel);
         }
-
-        // Fit waypoints
-        auto coeffs = polyfit(x_veh, y_veh, 3); 
-        const double cte  = polyeval(coeffs, 0.0);
-        cout << "coeffs : " << coeffs[0] << endl;
-        cout << "pow : " << pow(0.0 ,0) << endl;
-        cout << "cte : " << cte << endl;
-        double etheta = atan(coeffs[1]);
-
-        // Global coordinate system about theta
-        double gx = 0;
-        double gy = 0;
-        int N_sample = N * 0.3;
-        for(int i = 1; i < N_sample; i++) 
+        if(!valid)
         {
-            gx += odom_path.poses[i].pose.position.x - odom_path.poses[i-1].pose.position.x;
-            gy += odom_path.poses[i].pose.position.y - odom_path.poses[i-1].pose.position.y;
-        }       
-        
-        double temp_theta = theta;
-        double traj_deg = atan2(gy,gx);
-        double PI = 3.141592;
-
-        // Degree conversion -pi~pi -> 0~2pi(ccw) since need a continuity        
-        if(temp_theta <= -PI + traj_deg) 
-            temp_theta = temp_theta + 2 * PI;
-        
-        // Implementation about theta error more precisly
-        if(gx && gy && temp_theta - traj_deg < 1.8 * PI)
-            etheta = temp_theta - traj_deg;
+            _speed = 0.0;
+            angvel = 0.0;
+        }
+    }
+    else
+    {
+        // _w and _throttle belong to the solver thread in async mode
+        if(_async_solve)
+            _solver_thread.Clear();
         else
-            etheta = 0;
+        {
+            _throttle = 0.0;
+            _w = 0;
+        }
+        _speed = 0.0;
+        if(_goal_reached && _goal_received)
+        {
+            cout << "Goal Reached: control loop !" << endl;
+        }
+    }
+    // publish general cmd_vel 
+    if(_pub_twist_flag)
+    {
+        _twist_msg.linear.x  = _speed; 
+        _twist_msg.angular.z = angvel;
+        _pub_twist.publish(boost::make_shared<geometry_msgs::Twist>(_twist_msg));
+    }
+}
 
-        cout << "etheta: "<< etheta << ", atan2(gy,gx): " << atan2(gy,gx) << ", temp_theta:" << traj_deg << endl;
 
+// Service: write the trace spans to trace_path, see trace_span.h
+bool MPCNode::writeTraceCB(std_srvs::Trigger::Request &req, std_srvs::Trigger::Response &res)
+{
+    res.success = trace_span::WriteChrome(_trace_path);
+    res.message = res.success ? _trace_path : "cannot write " + _trace_path;
+    return true;
+}
 
-        
-        idx++;
-        file << idx<< "," << cte << "," <<  etheta << "," << _twist_msg.linear.x << "," << _twist_msg.angular.z << "\n";
-        
+// Service: dump the flight recorder after the next cycle
+bool MPCNode::dumpFlightCB(std_srvs::Trigger::Request &req, std_srvs::Trigger::Response &res)
+{
+    _flight.Request();
+    res.success = true;
+    const std::string last = _flight.LastDump();
+    res.message = last.empty() ? "dump requested" : "dump requested, previous one " + last;
+    return true;
+}
 
+// Solve the MPC problem from the current state and fill the predicted command sequence
+bool MPCNode::solveControl(MPCCommand &cmd)
+{
+    MPC_TRACE_SPAN("solve_control");
+    const double stamp = ros::Time::now().toSec();
+    StageClock cycle;
+    // Deadline mode: the solve gets the controller period minus the rest of the cycle
+    const double deadline = _deadline_mode ? max(0.2 * _dt, _dt - _cycle_overhead) : 0.0;
+    _mpc.SetDeadline(deadline);
+    _mpc.SetNearGoal(_near_goal);
+    if(!start_timef)
+    {
+        tracking_stime == ros::Time::now();
+        start_timef = true;
+    }
+    // The freshest reference of the prep thread, or prepared now
+    const ReferencePacket *ref = NULL;
+    if(_prep_thread)
+        ref = _reference_prep.Latest();
+    else if(prepareReference(_ref_packet))
+        ref = &_ref_packet;
+    if(!ref)
+        return false;
+    geometry_msgs::Point goal_pos = _goal_pos;
+
+    // Update system states: X=[x, y, theta, v]
+    const double px = ref->px; //pose: odom frame
+    const double py = ref->py;
+    double theta = ref->theta;
+
+    // Still on the last prediction: follow its inputs without solving
+    if(_event_trigger.Enabled() && _event_trigger.Holds(stamp, px, py, theta))
+    {
+        cmd = _event_cmd;
+        double speed;
+        cmd.Sample(stamp, speed, _w);
+        return true;
+    }
 
-        // Difference bewteen current position and goal position
-        const double x_err = goal_pos.x -  odom.pose.pose.position.x;
-        const double y_err = goal_pos.y -  odom.pose.pose.position.y;
-        const double goal_err = sqrt(x_err*x_err + y_err*y_err);
+    const double v = ref->v; //twist: body fixed frame
+    // Update system inputs: U=[w, throttle]
+    const double w = _w; // steering -> w
+    //const double steering = _steering;  // radian
+    const double throttle = _throttle; // accel: >0; brake: <0
+    const double dt = _dt;
+    //const double Lf = _Lf;
 
-        cout << "x_err:"<< x_err << ", y_err:"<< y_err  << endl;
+    // Waypoints fitted in the vehicle coordinate system
+    if(!ref->fitted)
+    {
+        _event_trigger.Reset();
+        return false;
+    }
+    const VectorXd &coeffs = ref->coeffs;
 
-        VectorXd state(6);
-        if(_delay_mode)
-        {
-            // Kinematic model is used to predict vehicle state at the actual moment of control (current time + delay dt)
-            const double px_act = v * dt;
-            const double py_act = 0;
-            const double theta_act = w * dt; //(steering) theta_act = v * steering * dt / Lf;
-            const double v_act = v + throttle * dt; //v = v + a * dt
-            
-            const double cte_act = cte + v * sin(etheta) * dt;
-            const double etheta_act = etheta - theta_act;  
-            
-            state << px_act, py_act, theta_act, v_act, cte_act, etheta_act;
-        }
-        else
-        {
-            state << 0, 0, 0, v, cte, etheta;
-        }
+    const double cte  = ref->cte;
+    const double etheta = ref->etheta;
+    _metrics.Metrics().ObserveTracking(cte, atan(coeffs[1]));
+
+    // Difference bewteen current position and goal position
+    const double x_err = goal_pos.x -  px;
+    const double y_err = goal_pos.y -  py;
+    const double goal_err = sqrt(x_err*x_err + y_err*y_err);
+
+    cout << "x_err:"<< x_err << ", y_err:"<< y_err  << endl;
+
+    VectorXd state(6);
+    if(_delay_mode)
+    {
+        // Kinematic model is used to predict vehicle state at the actual moment of control (current time + delay dt)
+        const double px_act = v * dt;
+        const double py_act = 0;
+        const double theta_act = w * dt; //(steering) theta_act = v * steering * dt / Lf;
+        const double v_act = v + throttle * dt; //v = v + a * dt
         
-        // Solve MPC Problem
-        ros::Time begin = ros::Time::now();
-        vector<double> mpc_results = _mpc.Solve(state, coeffs);    
-        ros::Time end = ros::Time::now();
-        cout << "Duration: " << end.sec << "." << end.nsec << endl << begin.sec<< "."  << begin.nsec << endl;
-              
-        // MPC result (all described in car frame), output = (acceleration, w)        
-        _w = mpc_results[0]; // radian/sec, angular velocity
-        _throttle = mpc_results[1]; // acceleration
-
-        _speed = v + _throttle * dt;  // speed
-        if (_speed >= _max_speed)
-            _speed = _max_speed;
-        if(_speed <= 0.0)
-            _speed = 0.0;
+        const double cte_act = cte + v * sin(etheta) * dt;
+        const double etheta_act = etheta - theta_act;  
+        
+        state << px_act, py_act, theta_act, v_act, cte_act, etheta_act;
+    }
+    else
+    {
+        state << 0, 0, 0, v, cte, etheta;
+    }
+    
+    // Solve MPC Problem
+    cycle.Lap();
+    vector<double> mpc_results = _mpc.Solve(state, coeffs);    
+    const double solve_ms = cycle.Lap();
+    if(_debug_info)
+        cout << "Solve duration [ms]: " << solve_ms << endl;
+          
+    // MPC result (all described in car frame), output = (acceleration, w)        
+    _w = mpc_results[0]; // radian/sec, angular velocity
+    _throttle = mpc_results[1]; // acceleration
+
+    // Command sequence along the prediction, the first entry is applied now
+    cmd.stamp = stamp;
+    cmd.dt = dt;
+    double speed = v;
+    for(int i = 0; i < _mpc.mpc_angvel.size(); i++)
+    {
+        speed += _mpc.mpc_accel[i] * dt;  // speed
+        cmd.speed.push_back(max(0.0, min(speed, _max_speed)));
+        cmd.angvel.push_back(_mpc.mpc_angvel[i]);
+    }
+
+    TrajectoryRecord record;
+    record.stamp = stamp;
+    for(int i = 0; i < 6; i++)
+        record.state[i] = state[i];
+    for(int i = 0; i < 4 && i < coeffs.size(); i++)
+        record.coeffs[i] = coeffs[i];
+    record.speed = cmd.speed.empty() ? 0.0 : cmd.speed[0];
+    record.angvel = cmd.angvel.empty() ? 0.0 : cmd.angvel[0];
+    record.solve_ms = solve_ms;
+    record.cost = _mpc._mpc_totalcost;
+    record.status = _mpc._mpc_status;
+    record.iterations = _mpc._mpc_iterations;
+    record.flags = (_mpc._mpc_fallback ? TrajectoryRecord::FALLBACK : 0)
+                   | (_mpc._mpc_slack > 1e-6 ? TrajectoryRecord::SOFT_BOUND : 0)
+                   | (_mpc._mpc_feasible ? 0 : TrajectoryRecord::INFEASIBLE);
+    _log.Push(record);
+
+    FlightFrame frame;
+    frame.record = record;
+    frame.params_version = _mpc._mpc_params_version;
+    frame.deadline_ms = 1000.0 * deadline;
+    frame.journal = _mpc._mpc_journal;
+    _flight.Record(frame);
+
+    // Controller health, lock-free
+    ControllerMetrics &metrics = _metrics.Metrics();
+    metrics.ObserveSolve(solve_ms, _mpc._mpc_iterations, _mpc._mpc_status);
+    metrics.SetMemory(_mpc.Memory());
+    if(deadline > 0 && solve_ms > 1000.0 * deadline)
+        metrics.CountDeadlineMiss();
+    if(_mpc._mpc_fallback)
+        metrics.CountFallback();
+    if(!_mpc._mpc_feasible)
+        metrics.CountInfeasible();
+
+    // Nothing of a solve that failed the model is applied
+    if(!_mpc._mpc_feasible)
+    {
+        _w = 0;
+        _throttle = 0;
+        _event_trigger.Reset();
+        return false;
+    }
 
-        if(_debug_info)
+    // Prediction of a solved plan (not a shifted fallback) for the event
+    // trigger, the first pose is at the control moment in delay mode
+    if(_event_trigger.Enabled())
+    {
+        if(_mpc._mpc_fallback)
+            _event_trigger.Reset();
+        else
         {
-            cout << "\n\nDEBUG" << endl;
-            cout << "theta: " << theta << endl;
-            cout << "V: " << v << endl;
-            //cout << "odom_path: \n" << odom_path << endl;
-            //cout << "x_points: \n" << x_veh << endl;
-            //cout << "y_points: \n" << y_veh << endl;
-            cout << "coeffs: \n" << coeffs << endl;
-            cout << "_w: \n" << _w << endl;
-            cout << "_throttle: \n" << _throttle << endl;
-            cout << "_speed: \n" << _speed << endl;
+            _event_trigger.Store(stamp, px, py, theta, _mpc.mpc_x, _mpc.mpc_y, _mpc.mpc_theta,
+                                 _delay_mode ? dt : 0.0, cmd.dt, cmd.step_dt);
+            _event_cmd = cmd;
         }
+    }
+
+    if(_debug_info)
+    {
+        cout << "\n\nDEBUG" << endl;
+        cout << "theta: " << theta << endl;
+        cout << "V: " << v << endl;
+        //cout << "odom_path: \n" << odom_path << endl;
+        //cout << "x_points: \n" << x_veh << endl;
+        //cout << "y_points: \n" << y_veh << endl;
+        cout << "coeffs: \n" << coeffs << endl;
+        cout << "_w: \n" << _w << endl;
+        cout << "_throttle: \n" << _throttle << endl;
+        cout << "_speed: \n" << cmd.speed[0] << endl;
+    }
 
-        // Display the MPC predicted trajectory
-        _mpc_traj = nav_msgs::Path();
-        _mpc_traj.header.frame_id = _car_frame; // points in car coordinate        
-        _mpc_traj.header.stamp = ros::Time::now();
+    // Display the MPC predicted trajectory
+    if(_trajectory_path)
+    {
+        nav_msgs::PathPtr mpc_traj = boost::make_shared<nav_msgs::Path>();
+        mpc_traj->header.frame_id = _car_frame; // points in car coordinate        
+        mpc_traj->header.stamp = ros::Time::now();
 
         geometry_msgs::PoseStamped tempPose;
         tf2::Quaternion myQuaternion;
 
         for(int i=0; i<_mpc.mpc_x.size(); i++)
         {
-            tempPose.header = _mpc_traj.header;
+            tempPose.header = mpc_traj->header;
             tempPose.pose.position.x = _mpc.mpc_x[i];
             tempPose.pose.position.y = _mpc.mpc_y[i];
 
@@ -519,31 +964,160 @@ void MPCNode::controlLoopCB(const ros::TimerEvent&)
             tempPose.pose.orientation.y = myQuaternion[1];
             tempPose.pose.orientation.z = myQuaternion[2];
             tempPose.pose.orientation.w = myQuaternion[3];
-                
-            _mpc_traj.poses.push_back(tempPose); 
+            
+            mpc_traj->poses.push_back(tempPose); 
         }     
         // publish the mpc trajectory
-        _pub_mpctraj.publish(_mpc_traj);
+        _pub_mpctraj.publish(mpc_traj);
     }
-    else
+
+    // Same prediction packed for low bandwidth consumers, see trajectory_publisher.h
+    if(_pub_compact_traj.Active())
     {
-        _throttle = 0.0;
-        _speed = 0.0;
-        _w = 0;
-        if(_goal_reached && _goal_received)
-        {
-            cout << "Goal Reached: control loop !" << endl;
-        }
+        mpc_ros::MPCTrajectory &traj = _pub_compact_traj.Fill(_car_frame, ros::Time::now(), _mpc.mpc_x, _mpc.mpc_y, _mpc.mpc_theta,
+                                                              _mpc.mpc_angvel, _mpc.mpc_accel, _mpc._mpc_dt, _mpc.mpc_step_dt);
+        traj.status = _mpc._mpc_status;
+        traj.iterations = _mpc._mpc_iterations;
+        traj.solve_ms = solve_ms;
+        traj.cost = _mpc._mpc_totalcost;
+        traj.feasible = _mpc._mpc_feasible;
+        traj.fallback = _mpc._mpc_fallback;
+        _pub_compact_traj.Publish();
     }
-    // publish general cmd_vel 
-    if(_pub_twist_flag)
+
+    // Cost breakdown of the last solution (opt-in diagnostics)
+    if(_publish_cost)
     {
-        _twist_msg.linear.x  = _speed; 
-        _twist_msg.angular.z = _w;
-        _pub_twist.publish(_twist_msg);
+        std_msgs::Float32 mpc_total_cost;
+        mpc_total_cost.data = static_cast<float>(_mpc._mpc_totalcost);
+        _pub_totalcost.publish(mpc_total_cost);
+
+        std_msgs::Float32 mpc_cte_cost;
+        mpc_cte_cost.data = static_cast<float>(_mpc._mpc_ctecost);
+        _pub_ctecost.publish(mpc_cte_cost);
+
+        std_msgs::Float32 mpc_etheta_cost;
+        mpc_etheta_cost.data = static_cast<float>(_mpc._mpc_ethetacost);
+        _pub_ethetacost.publish(mpc_etheta_cost);
     }
+
+    // Overhead of this cycle besides the solve, for the next deadline budget
+    _cycle_overhead = 0.9 * _cycle_overhead + 0.1 * (cycle.Total() - solve_ms) / 1000.0;
+    _metrics.Metrics().ObserveCycle(cycle.Total());
+
+    return true;
 }
 
+// An AMCL correction moves map -> odom: the odom path moves by the change
+// instead of being transformed again from the map. Tried on every reference
+// after amclCB until TF has the new transform, for at most a second.
+void MPCNode::correctPath()
+{
+    std::lock_guard<std::mutex> lock(_path_mutex);
+    CompactPath::ConstPtr path = _odom_path.Get();
+    tf::Transform path_to_odom;
+    if(_path_frame.empty() || !path || !_tf_cache.Lookup(_tf_listener, _odom_frame, _path_frame, path_to_odom))
+        return;
+    const tf::Transform delta = path_to_odom * _path_to_odom.inverse();
+    const double yaw = tf::getYaw(delta.getRotation());
+    if(fabs(delta.getOrigin().x()) < 1e-6 && fabs(delta.getOrigin().y()) < 1e-6 && fabs(yaw) < 1e-9)
+    {
+        if((ros::Time::now() - _localization_stamp).toSec() > 1.0)
+            _localization_update = false;
+        return;
+    }
+    boost::shared_ptr<CompactPath> moved = boost::make_shared<CompactPath>(*path);
+    moved->Transform(delta.getOrigin().x(), delta.getOrigin().y(), yaw);
+    _odom_path.Set(moved);
+    _path_to_odom = path_to_odom;
+    _localization_update = false;
+    _event_trigger.Reset(); // the prediction is on the old path
+}
+
+// Reference of the next solve from the newest odometry and path, on the prep
+// thread or at the start of solveControl. False before both arrived.
+bool MPCNode::prepareReference(ReferencePacket &ref)
+{
+    if(_localization_update)
+        correctPath();
+    nav_msgs::Odometry::ConstPtr odom_msg = _odom.Get();
+    CompactPath::ConstPtr odom_path_msg = _odom_path.Get();
+    if(!odom_msg || !odom_path_msg)
+        return false;
+    const nav_msgs::Odometry &odom = *odom_msg; 
+    const CompactPath &odom_path = *odom_path_msg;
+
+    ref.stamp = odom.header.stamp.toSec();
+    const double px = odom.pose.pose.position.x; //pose: odom frame
+    const double py = odom.pose.pose.position.y;
+    tf::Pose pose;
+    tf::poseMsgToTF(odom.pose.pose, pose);
+    const double theta = tf::getYaw(pose.getRotation());
+    ref.px = px;
+    ref.py = py;
+    ref.theta = theta;
+    ref.v = odom.twist.twist.linear.x; //twist: body fixed frame
+    ref.angvel = odom.twist.twist.angular.z;
+
+    // Waypoints related parameters
+    const int N = odom_path.Size(); // Number of waypoints
+
+    // Fit waypoints in the vehicle coordinate system
+    ref.fitted = _path_fit.Fit(odom_path, px, py, theta);
+    if(!ref.fitted)
+        return true;
+    ref.coeffs = _path_fit.Coeffs();
+    const VectorXd &coeffs = ref.coeffs;
+
+    const double cte  = _path_fit.Eval(0.0);
+    cout << "coeffs : " << coeffs[0] << endl;
+    cout << "pow : " << pow(0.0 ,0) << endl;
+    cout << "cte : " << cte << endl;
+    double etheta = atan(coeffs[1]);
+
+    // Global coordinate system about theta
+    double gx = 0;
+    double gy = 0;
+    int N_sample = N * 0.3;
+    for(int i = 1; i < N_sample; i++) 
+    {
+        gx += odom_path.X(i) - odom_path.X(i-1);
+        gy += odom_path.Y(i) - odom_path.Y(i-1);
+    }       
+    
+    double temp_theta = theta;
+    double traj_deg = atan2(gy,gx);
+    double PI = 3.141592;
+
+    // Degree conversion -pi~pi -> 0~2pi(ccw) since need a continuity        
+    if(temp_theta <= -PI + traj_deg) 
+        temp_theta = temp_theta + 2 * PI;
+    
+    // Implementation about theta error more precisly
+    if(gx && gy && temp_theta - traj_deg < 1.8 * PI)
+        etheta = temp_theta - traj_deg;
+    else
+        etheta = 0;
+
+    cout << "etheta: "<< etheta << ", atan2(gy,gx): " << atan2(gy,gx) << ", temp_theta:" << traj_deg << endl;
+
+    ref.cte = cte;
+    ref.etheta = etheta;
+    return true;
+}
+
+#ifdef MPC_NODELET
+#include <pluginlib/class_list_macros.h>
+#include "controller_nodelet.h"
+
+namespace mpc_ros
+{
+    class NavMPCNodelet : public ControllerNodelet<MPCNode> {};
+}
+PLUGINLIB_EXPORT_CLASS(mpc_ros::NavMPCNodelet, nodelet::Nodelet)
+
+#else
+
 /****************/
 /* MAIN FUNCTION */
 /*****************/
@@ -559,3 +1133,4 @@ int main(int argc, char **argv)
     ros::waitForShutdown();
     return 0;
 }
+#endif /* MPC_NODELET */
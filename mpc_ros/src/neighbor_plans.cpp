@@ -0,0 +1,185 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "neighbor_plans.h"
+#include <cmath>
+#include <algorithm>
+
+NeighborPlans::Plan::Plan()
+{
+    robot = 0;
+    stamp = 0.0;
+    dt = 0.0;
+    radius = 0.0;
+}
+
+bool NeighborPlans::Plan::At(double t, double &x, double &y) const
+{
+    const size_t n = xy.size() / 2;
+    if (n == 0)
+        return false;
+    const double s = dt > 0.0 ? (t - stamp) / dt : 0.0;
+    if (s <= 0.0 || n == 1)
+    {
+        x = xy[0];
+        y = xy[1];
+        return true;
+    }
+    if (s >= n - 1)
+    {
+        x = xy[2 * (n - 1)];
+        y = xy[2 * (n - 1) + 1];
+        return true;
+    }
+    const size_t i = size_t(s);
+    const double a = s - i;
+    x = xy[2 * i] + a * (xy[2 * i + 2] - xy[2 * i]);
+    y = xy[2 * i + 1] + a * (xy[2 * i + 3] - xy[2 * i + 1]);
+    return true;
+}
+
+NeighborPlans::NeighborPlans()
+{
+    _cell = 4.0;
+    _max_age = 1.0;
+}
+
+void NeighborPlans::Configure(double cell, double max_age)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cell = cell > 0.0 ? cell : 4.0;
+    _max_age = max_age;
+    _plans.clear();
+    _cells.clear();
+}
+
+long long NeighborPlans::key(long long ix, long long iy)
+{
+    return (long long)(((unsigned long long)ix << 32) ^ ((unsigned long long)iy & 0xffffffffULL));
+}
+
+long long NeighborPlans::cell(double x, double y) const
+{
+    return key((long long)std::floor(x / _cell), (long long)std::floor(y / _cell));
+}
+
+void NeighborPlans::unlink(unsigned int robot, long long key)
+{
+    std::unordered_map<long long, std::vector<unsigned int> >::iterator it = _cells.find(key);
+    if (it == _cells.end())
+        return;
+    std::vector<unsigned int> &robots = it->second;
+    std::vector<unsigned int>::iterator r = std::find(robots.begin(), robots.end(), robot);
+    if (r != robots.end())
+    {
+        *r = robots.back();
+        robots.pop_back();
+    }
+    if (robots.empty())
+        _cells.erase(it);
+}
+
+void NeighborPlans::Set(unsigned int robot, double stamp, double radius, double dt, const float *xy, int steps)
+{
+    if (steps <= 0)
+        return;
+    std::lock_guard<std::mutex> lock(_mutex);
+    const long long key = cell(xy[0], xy[1]);
+    std::unordered_map<unsigned int, Entry>::iterator it = _plans.find(robot);
+    if (it == _plans.end())
+    {
+        it = _plans.insert(std::make_pair(robot, Entry())).first;
+        _cells[key].push_back(robot);
+    }
+    else if (it->second.cell != key)
+    {
+        unlink(robot, it->second.cell);
+        _cells[key].push_back(robot);
+    }
+    Entry &entry = it->second;
+    entry.cell = key;
+    entry.plan.robot = robot;
+    entry.plan.stamp = stamp;
+    entry.plan.dt = dt;
+    entry.plan.radius = radius;
+    entry.plan.xy.assign(xy, xy + 2 * steps);
+}
+
+void NeighborPlans::Near(unsigned int self, double x, double y, double now, std::vector<Plan> &near)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    size_t count = 0;
+    _stale.clear();
+    const long long ix = (long long)std::floor(x / _cell);
+    const long long iy = (long long)std::floor(y / _cell);
+    for (long long dx = -1; dx <= 1; dx++)
+    {
+        for (long long dy = -1; dy <= 1; dy++)
+        {
+            std::unordered_map<long long, std::vector<unsigned int> >::const_iterator it = _cells.find(key(ix + dx, iy + dy));
+            if (it == _cells.end())
+                continue;
+            for (size_t k = 0; k < it->second.size(); k++)
+            {
+                const unsigned int robot = it->second[k];
+                const Plan &plan = _plans[robot].plan;
+                if (now - plan.stamp > _max_age)
+                    _stale.push_back(robot);
+                else if (robot != self)
+                {
+                    // Reuses the vectors of near, no allocation once it grew
+                    if (near.size() <= count)
+                        near.resize(count + 1);
+                    near[count++] = plan;
+                }
+            }
+        }
+    }
+    near.resize(count);
+    for (size_t k = 0; k < _stale.size(); k++)
+    {
+        unlink(_stale[k], _plans[_stale[k]].cell);
+        _plans.erase(_stale[k]);
+    }
+}
+
+bool NeighborPlans::Closest(const std::vector<Plan> &near, double t, double x, double y, double &qx, double &qy, double &radius)
+{
+    bool found = false;
+    double best = 0.0;
+    for (size_t k = 0; k < near.size(); k++)
+    {
+        double px, py;
+        if (!near[k].At(t, px, py))
+            continue;
+        const double d = std::hypot(px - x, py - y) - near[k].radius;
+        if (!found || d < best)
+        {
+            found = true;
+            best = d;
+            qx = px;
+            qy = py;
+            radius = near[k].radius;
+        }
+    }
+    return found;
+}
+
+size_t NeighborPlans::Size() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _plans.size();
+}
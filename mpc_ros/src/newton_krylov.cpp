@@ -0,0 +1,329 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "newton_krylov.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include "tape_optimize.h"
+
+NewtonKrylov::NewtonKrylov()
+{
+    _recorded = false;
+    _pre_valid = false;
+    _nx = 0;
+    _np = 0;
+    _max_iter = 30;
+    _cg_max_iter = 50;
+    _tol = 1e-6;
+    _time_limit = 0;
+    _time_limit_hit = false;
+    _cancel = NULL;
+    _cancel_hit = false;
+    _cost = 0;
+    _iterations = 0;
+    _products = 0;
+}
+
+void NewtonKrylov::LoadParams(const std::map<std::string, double> &params)
+{
+    _max_iter = params.find("NK_MAX_ITER") != params.end() ? params.at("NK_MAX_ITER") : _max_iter;
+    _cg_max_iter = params.find("NK_CG_ITER") != params.end() ? params.at("NK_CG_ITER") : _cg_max_iter;
+    _tol = params.find("NK_TOL") != params.end() ? params.at("NK_TOL") : _tol;
+    _max_iter = std::max(_max_iter, 1);
+    _cg_max_iter = std::max(_cg_max_iter, 1);
+}
+
+void NewtonKrylov::Record(size_t n_vars, size_t n_params, const std::string &name, const CostFunction &cost)
+{
+    _nx = n_vars;
+    _np = n_params;
+    const size_t n = _nx + _np;
+
+    // Same as TapeSolver::Record(), the cost has no value dependent branches
+    ADvector a_x(n), a_fg(1);
+    for (size_t j = 0; j < n; j++)
+        a_x[j] = 0.0;
+    CppAD::Independent(a_x);
+    cost(a_fg, a_x);
+    _fun.Dependent(a_x, a_fg);
+    tape_optimize::Apply(_fun, tape_optimize::STRAIGHT_LINE);
+
+    _x.resize(n);
+    _dx.resize(n);
+    _w.resize(1);
+    for (size_t j = 0; j < n; j++)
+    {
+        _x[j] = 0;
+        _dx[j] = 0;
+    }
+    _w[0] = 1;
+    _pre_valid = false;
+    _name = name;
+    _recorded = true;
+}
+
+double NewtonKrylov::value(const Dvector &x)
+{
+    for (size_t j = 0; j < _nx; j++)
+        _x[j] = x[j];
+    return _fun.Forward(0, _x)[0];
+}
+
+void NewtonKrylov::gradient(Dvector &g)
+{
+    const Dvector dw = _fun.Reverse(1, _w);
+    g.resize(_nx);
+    for (size_t j = 0; j < _nx; j++)
+        g[j] = dw[j];
+}
+
+void NewtonKrylov::product(const Dvector &v, Dvector &hv)
+{
+    // Directional derivative of the gradient along v: the order 1 sweep
+    // seeds v, the order 2 reverse sweep returns d/dx (g . v) in the odd
+    // entries
+    for (size_t j = 0; j < _nx; j++)
+        _dx[j] = v[j];
+    _fun.Forward(1, _dx);
+    const Dvector dw = _fun.Reverse(2, _w);
+    hv.resize(_nx);
+    for (size_t j = 0; j < _nx; j++)
+        hv[j] = dw[2 * j + 1];
+    _products++;
+}
+
+void NewtonKrylov::factor(const Dvector &x, const std::vector<bool> &free)
+{
+    _pre_valid = false;
+    if (!_pre_function)
+        return;
+    _pre_function(x, _pre_stages);
+    const int N = _pre_stages.size();
+    if (N < 2 || 2 * size_t(N - 1) != _nx)
+        return;
+
+    // Unbounded inputs and no offsets, so that Solve() is one Riccati
+    // sweep of M u = r. The weight of a held input dwarfs its Hessian
+    // entries; the stages that did not change keep their factors.
+    const double inf = std::numeric_limits<double>::infinity();
+    for (int k = 0; k < N; k++)
+    {
+        Preconditioner::Stage &st = _pre_stages[k];
+        st.d.setZero();
+        st.q.setZero();
+        st.r.setZero();
+        st.lb.setConstant(-inf);
+        st.ub.setConstant(inf);
+        for (int j = 0; j < NU && k < N - 1; j++)
+        {
+            if (!free[j * (N - 1) + k])
+                st.R(j, j) += 1e8 * (1.0 + std::fabs(st.R(j, j)));
+        }
+    }
+    _pre_z.resize(N);
+    _pre_u.resize(N - 1);
+    _pre_free = free;
+    _pre_valid = true;
+}
+
+void NewtonKrylov::precondition(const Dvector &r, Dvector &z)
+{
+    z.resize(_nx);
+    const size_t n = _nx / 2;
+    bool solved = false;
+    if (_pre_valid)
+    {
+        for (size_t k = 0; k < n; k++)
+        {
+            _pre_stages[k].r << -r[k], -r[n + k];
+            _pre_u[k].setZero();
+        }
+        solved = _pre.Solve(_pre_stages, Preconditioner::VectorZ::Zero(), _pre_z, _pre_u);
+    }
+    for (size_t k = 0; k < n; k++)
+    {
+        z[k] = solved && _pre_free[k] ? _pre_u[k][0] : r[k];
+        z[n + k] = solved && _pre_free[n + k] ? _pre_u[k][1] : r[n + k];
+    }
+}
+
+NewtonKrylov::Status NewtonKrylov::Solve(const Dvector &params, const Dvector &lower, const Dvector &upper, Dvector &x)
+{
+    _iterations = 0;
+    _products = 0;
+    _time_limit_hit = false;
+    _cancel_hit = false;
+    if (!_recorded || params.size() != _np || x.size() != _nx || lower.size() != _nx || upper.size() != _nx)
+        return INVALID;
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (size_t j = 0; j < _np; j++)
+        _x[_nx + j] = params[j];
+
+    const size_t n = _nx;
+    for (size_t i = 0; i < n; i++)
+        x[i] = std::min(std::max(x[i], lower[i]), upper[i]);
+    Dvector g, r(n), z(n), d(n), hd(n), p(n), xt(n), hs(n);
+    std::vector<bool> free(n);
+    double f = value(x);
+    gradient(g);
+    double radius = -1; // of the trust region in the preconditioner norm, set on the first step
+
+    Status status = MAX_ITER;
+    for (; _iterations < _max_iter; _iterations++)
+    {
+        if (_cancel && _cancel->load(std::memory_order_relaxed))
+        {
+            _cancel_hit = true;
+            break;
+        }
+        if (_time_limit > 0
+            && std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() > _time_limit)
+        {
+            _time_limit_hit = true;
+            break;
+        }
+
+        // Projected gradient, and the inputs held on their bounds
+        double pg = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            free[i] = !((x[i] <= lower[i] && g[i] > 0) || (x[i] >= upper[i] && g[i] < 0));
+            pg = std::max(pg, free[i] ? std::fabs(g[i]) : 0.0);
+        }
+        if (pg <= _tol)
+        {
+            status = CONVERGED;
+            break;
+        }
+
+        // Preconditioned CG on H p = -g over the free inputs, within the
+        // trust region (Steihaug): negative curvature and steps past the
+        // radius end on its boundary. pMp, pMd and dMd are the
+        // preconditioner products of the iterate and the direction.
+        factor(x, free);
+        double gnorm = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            r[i] = free[i] ? g[i] : 0.0;
+            p[i] = 0;
+            gnorm += r[i] * r[i];
+        }
+        gnorm = std::sqrt(gnorm);
+        const double forcing = std::min(0.5, std::sqrt(gnorm)) * gnorm;
+        precondition(r, z);
+        double rz = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            d[i] = -z[i];
+            rz += r[i] * z[i];
+        }
+        if (radius < 0)
+            radius = std::sqrt(std::max(rz, 0.0));
+        double pMp = 0, pMd = 0, dMd = rz;
+        bool boundary = false;
+        for (int k = 0; k < _cg_max_iter && rz > 0; k++)
+        {
+            product(d, hd);
+            double dhd = 0;
+            for (size_t i = 0; i < n; i++)
+            {
+                hd[i] = free[i] ? hd[i] : 0.0;
+                dhd += d[i] * hd[i];
+            }
+            const double alpha = dhd > 0 ? rz / dhd : 0.0;
+            if (dhd <= 0 || pMp + 2 * alpha * pMd + alpha * alpha * dMd >= radius * radius)
+            {
+                // To the boundary: the positive root of |p + tau d|_M = radius
+                const double tau = (-pMd + std::sqrt(std::max(pMd * pMd + dMd * (radius * radius - pMp), 0.0))) / dMd;
+                for (size_t i = 0; i < n; i++)
+                    p[i] += tau * d[i];
+                boundary = true;
+                break;
+            }
+            double rr = 0;
+            for (size_t i = 0; i < n; i++)
+            {
+                p[i] += alpha * d[i];
+                r[i] += alpha * hd[i];
+                rr += r[i] * r[i];
+            }
+            pMp += 2 * alpha * pMd + alpha * alpha * dMd;
+            if (std::sqrt(rr) <= forcing)
+                break;
+            precondition(r, z);
+            double rz_next = 0;
+            for (size_t i = 0; i < n; i++)
+                rz_next += r[i] * z[i];
+            const double beta = rz_next / rz;
+            rz = rz_next;
+            for (size_t i = 0; i < n; i++)
+                d[i] = -z[i] + beta * d[i];
+            pMd = beta * (pMd + alpha * dMd);
+            dMd = rz + beta * beta * dMd;
+        }
+
+        // The step projected on the bounds, taken if the cost decreases by
+        // a fraction of the decrease of the quadratic model
+        double slope = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            xt[i] = std::min(std::max(x[i] + p[i], lower[i]), upper[i]);
+            p[i] = xt[i] - x[i];
+            slope += g[i] * p[i];
+        }
+        product(p, hs);
+        double curvature = 0;
+        for (size_t i = 0; i < n; i++)
+            curvature += p[i] * hs[i];
+        const double predicted = -(slope + 0.5 * curvature);
+        if (predicted >= 0 && predicted <= 10 * std::numeric_limits<double>::epsilon() * (1 + std::fabs(f)))
+        {
+            // Converged as far as the rounding of the cost goes
+            status = CONVERGED;
+            break;
+        }
+        const double ft = value(xt);
+        const double ratio = predicted > 0 ? (f - ft) / predicted : -1.0;
+        if (ratio < 0.25)
+        {
+            // A fraction of the step taken, in the norm of the Hessian
+            // where the step was cut by the bounds
+            radius = 0.25 * (curvature > 0 ? std::min(radius, std::sqrt(curvature)) : radius);
+        }
+        else if (ratio > 0.75 && boundary)
+            radius *= 2;
+        if (ratio > 1e-4)
+        {
+            x = xt;
+            f = ft;
+            gradient(g);
+        }
+        else
+        {
+            value(x);
+            if (radius < 1e-10 * (1 + std::sqrt(pMp)))
+            {
+                status = LINE_SEARCH;
+                break;
+            }
+        }
+    }
+    _cost = f;
+    return status;
+}
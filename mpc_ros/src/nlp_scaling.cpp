@@ -0,0 +1,77 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "nlp_scaling.h"
+#include "reduced_state.h"
+#include <algorithm>
+
+namespace
+{
+    double factor(double magnitude)
+    {
+        return 1.0 / std::max(1.0, magnitude);
+    }
+}
+
+void NlpScaling::Set(int steps, int n_inputs, int n_tail_vars, int n_tail_rows, const Magnitudes &size)
+{
+    // x, y, theta, v, cte, etheta; cte is bounded by the path error, which
+    // is taken as unit like etheta
+    const double state[6] = { factor(size.position), factor(size.position), 1.0, factor(size.speed), 1.0, 1.0 };
+    _x.resize(6 * steps + 2 * n_inputs + n_tail_vars);
+    _g.resize(6 * steps + n_tail_rows);
+    for (int k = 0; k < 6; k++)
+    {
+        for (int i = 0; i < steps; i++)
+        {
+            _x[k * steps + i] = state[k];
+            _g[k * steps + i] = state[k];
+        }
+    }
+    for (int i = 0; i < n_inputs; i++)
+    {
+        _x[6 * steps + i] = factor(size.angvel);
+        _x[6 * steps + n_inputs + i] = factor(size.accel);
+    }
+    for (size_t i = 6 * steps + 2 * n_inputs; i < _x.size(); i++)
+    {
+        _x[i] = 1.0;
+    }
+    for (size_t i = 6 * steps; i < _g.size(); i++)
+    {
+        _g[i] = 1.0;
+    }
+    // Gradient 2 w e of the largest weight at a unit error
+    _objective = std::min(1.0, 100.0 / std::max(1.0, 2.0 * size.weight));
+}
+
+void NlpScaling::Reduce(int steps, NlpScaling &reduced) const
+{
+    reduced._objective = _objective;
+    reduced_state::ReduceVars(steps, _x, reduced._x);
+    reduced_state::ReduceRows(steps, _g, reduced._g);
+}
+
+void NlpScaling::Condense(int steps, NlpScaling &condensed) const
+{
+    condensed._objective = _objective;
+    condensed._x.resize(_x.size() - 6 * steps);
+    for (size_t i = 0; i < condensed._x.size(); i++)
+    {
+        condensed._x[i] = _x[6 * steps + i];
+    }
+    condensed._g.resize(0);
+}
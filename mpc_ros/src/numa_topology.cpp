@@ -0,0 +1,120 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "numa_topology.h"
+#include "realtime.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sstream>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+    void appendError(std::string &report, const char *step, int err)
+    {
+        std::ostringstream os;
+        os << step << ": " << std::strerror(err);
+        if (!report.empty())
+            report += "; ";
+        report += os.str();
+    }
+}
+
+NumaTopology::NumaTopology()
+{
+    DIR *dir = opendir("/sys/devices/system/node");
+    if (dir)
+    {
+        std::vector<int> ids;
+        while (dirent *entry = readdir(dir))
+        {
+            int id;
+            char rest;
+            if (std::sscanf(entry->d_name, "node%d%c", &id, &rest) == 1)
+                ids.push_back(id);
+        }
+        closedir(dir);
+        std::sort(ids.begin(), ids.end());
+        for (size_t i = 0; i < ids.size(); i++)
+        {
+            std::ostringstream path;
+            path << "/sys/devices/system/node/node" << ids[i] << "/cpulist";
+            std::ifstream file(path.str().c_str());
+            std::string list;
+            std::getline(file, list);
+            const std::vector<int> cpus = RealtimeSettings::ParseCpus(list);
+            // Memory-only nodes (no CPUs) run no workers
+            if (cpus.empty())
+                continue;
+            _cpus.push_back(cpus);
+            _ids.push_back(ids[i]);
+        }
+    }
+    if (_cpus.empty())
+    {
+        // No sysfs: one node of every online CPU
+        const long online = sysconf(_SC_NPROCESSORS_ONLN);
+        std::vector<int> cpus;
+        for (long cpu = 0; cpu < std::max(1L, online); cpu++)
+            cpus.push_back(int(cpu));
+        _cpus.push_back(cpus);
+        _ids.push_back(0);
+    }
+}
+
+std::vector<int> NumaTopology::Spread(int workers) const
+{
+    std::vector<int> nodes(std::max(0, workers));
+    for (size_t i = 0; i < nodes.size(); i++)
+        nodes[i] = int(i) % Nodes();
+    return nodes;
+}
+
+bool NumaTopology::BindThread(int node, std::string &report) const
+{
+    bool ok = true;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (size_t i = 0; i < _cpus[node].size(); i++)
+        if (_cpus[node][i] < CPU_SETSIZE)
+            CPU_SET(_cpus[node][i], &set);
+    const int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (err != 0)
+    {
+        appendError(report, "CPU affinity", err);
+        ok = false;
+    }
+
+    // One bit per node id, long words as the syscall takes them
+    const int bits = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> mask(_ids[node] / bits + 1, 0);
+    mask[_ids[node] / bits] |= 1UL << (_ids[node] % bits);
+    if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask.data(), mask.size() * bits + 1) != 0)
+    {
+        appendError(report, "set_mempolicy", errno);
+        ok = false;
+    }
+    return ok;
+}
@@ -0,0 +1,425 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "param_tuner.h"
+#include "cppad_parallel.h"
+#include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    // Node parameter of each MPC::LoadParams / ClosedLoopSim key, as read
+    // by trackRefTrajNode and MPC_Node
+    const char *const NODE_NAMES[][2] = {
+        {"STEPS", "mpc_steps"}, {"REF_CTE", "mpc_ref_cte"}, {"REF_V", "mpc_ref_vel"},
+        {"REF_ETHETA", "mpc_ref_etheta"}, {"W_CTE", "mpc_w_cte"}, {"W_EPSI", "mpc_w_etheta"},
+        {"W_V", "mpc_w_vel"}, {"W_ANGVEL", "mpc_w_angvel"}, {"W_DANGVEL", "mpc_w_angvel_d"},
+        {"W_A", "mpc_w_accel"}, {"W_DA", "mpc_w_accel_d"}, {"ANGVEL", "mpc_max_angvel"},
+        {"MAXTHR", "mpc_max_throttle"}, {"BOUND", "mpc_bound_value"},
+        {"PATH_LENGTH", "path_length"}, {"MAX_SPEED", "max_speed"}};
+
+    // Length scale of the Gaussian process on the unit cube, and the noise
+    // of the scores (the solve times are measured)
+    const double LENGTH = 0.3;
+    const double NOISE = 1e-3;
+
+    std::map<std::string, double> withValues(const std::map<std::string, double> &params,
+                                             const param_tuner::Candidate &c)
+    {
+        std::map<std::string, double> p = params;
+        for (std::map<std::string, double>::const_iterator it = c.values.begin(); it != c.values.end(); ++it)
+            p[it->first] = it->second;
+        return p;
+    }
+
+    void summarize(const std::vector<EpisodeResult> &results, param_tuner::Candidate &c)
+    {
+        std::vector<double> cte;
+        double solve = 0.0;
+        int cycles = 0;
+        c.cte = c.solve_max = 0.0;
+        c.diverged = 0;
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const EpisodeResult &r = results[i];
+            cte.push_back(r.cte_rms);
+            c.cte += r.cte_rms / results.size();
+            solve += r.solve_ms_mean * r.cycles;
+            cycles += r.cycles;
+            c.solve_max = std::max(c.solve_max, r.solve_ms_max);
+            c.diverged += r.diverged;
+        }
+        std::sort(cte.begin(), cte.end());
+        c.cte_p90 = cte.empty() ? 0.0 : cte[std::min(cte.size() - 1, size_t(0.9 * (cte.size() - 1) + 0.5))];
+        c.solve_ms = cycles > 0 ? solve / cycles : 0.0;
+        c.evaluated = true;
+    }
+
+    double uniform(std::mt19937 &rng)
+    {
+        return std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+    }
+}
+
+namespace param_tuner
+{
+    bool ParseDimension(const std::string &key, const std::string &text, int grid_points, Dimension &dim)
+    {
+        dim.key = key;
+        dim.values.clear();
+        dim.integer = key == "STEPS";
+        const size_t colon = text.find(':');
+        if (colon != std::string::npos)
+        {
+            dim.lo = std::atof(text.substr(0, colon).c_str());
+            dim.hi = std::atof(text.substr(colon + 1).c_str());
+            if (!(dim.hi > dim.lo))
+                return false;
+            dim.log = dim.lo > 0.0 && dim.hi >= 10.0 * dim.lo;
+            const int n = std::max(2, grid_points);
+            for (int i = 0; i < n; i++)
+            {
+                const double u = double(i) / (n - 1);
+                double v = dim.log ? dim.lo * std::pow(dim.hi / dim.lo, u) : dim.lo + u * (dim.hi - dim.lo);
+                if (dim.integer)
+                    v = std::round(v);
+                if (dim.values.empty() || v != dim.values.back())
+                    dim.values.push_back(v);
+            }
+            return true;
+        }
+        std::stringstream ss(text);
+        std::string item;
+        while (std::getline(ss, item, ','))
+            if (!item.empty())
+                dim.values.push_back(std::atof(item.c_str()));
+        if (dim.values.size() < 2)
+            return false;
+        dim.lo = *std::min_element(dim.values.begin(), dim.values.end());
+        dim.hi = *std::max_element(dim.values.begin(), dim.values.end());
+        dim.log = dim.lo > 0.0 && dim.hi >= 10.0 * dim.lo;
+        return dim.hi > dim.lo;
+    }
+
+    std::vector<Candidate> Grid(const std::vector<Dimension> &dims)
+    {
+        std::vector<Candidate> grid(1);
+        for (size_t d = 0; d < dims.size(); d++)
+        {
+            std::vector<Candidate> next;
+            for (size_t i = 0; i < grid.size(); i++)
+                for (size_t k = 0; k < dims[d].values.size(); k++)
+                {
+                    Candidate c = grid[i];
+                    c.values[dims[d].key] = dims[d].values[k];
+                    next.push_back(c);
+                }
+            grid.swap(next);
+        }
+        return grid;
+    }
+
+    void Evaluate(const std::map<std::string, double> &params, const PlantConfig &plant,
+                  const std::vector<EpisodeConfig> &episodes, int threads, std::vector<Candidate> &candidates)
+    {
+        std::vector<size_t> todo;
+        for (size_t i = 0; i < candidates.size(); i++)
+            if (!candidates[i].evaluated)
+                todo.push_back(i);
+        threads = std::max(1, threads);
+        if (todo.size() < size_t(threads))
+        {
+            for (size_t k = 0; k < todo.size(); k++)
+            {
+                std::vector<EpisodeResult> results;
+                ClosedLoopSim::RunAll(withValues(params, candidates[todo[k]]), plant, episodes, threads, results);
+                summarize(results, candidates[todo[k]]);
+            }
+            return;
+        }
+
+        // One candidate per worker at a time: its episodes reuse the tapes
+        // of the sim. Before a second thread touches CppAD, see
+        // cppad_parallel.h
+        cppad_parallel::Setup();
+        std::atomic<size_t> next(0);
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++)
+        {
+            pool.emplace_back([&]
+            {
+                std::vector<EpisodeResult> results;
+                for (size_t k = next++; k < todo.size(); k = next++)
+                {
+                    Candidate &c = candidates[todo[k]];
+                    ClosedLoopSim sim(withValues(params, c), plant);
+                    results.clear();
+                    for (size_t e = 0; e < episodes.size(); e++)
+                        results.push_back(sim.Run(episodes[e]));
+                    summarize(results, c);
+                }
+            });
+        }
+        for (size_t t = 0; t < pool.size(); t++)
+            pool[t].join();
+    }
+
+    std::vector<size_t> ParetoFront(const std::vector<Candidate> &candidates)
+    {
+        std::vector<size_t> order;
+        for (size_t i = 0; i < candidates.size(); i++)
+            if (candidates[i].evaluated && candidates[i].diverged == 0)
+                order.push_back(i);
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b)
+        {
+            const Candidate &ca = candidates[a], &cb = candidates[b];
+            return ca.solve_ms < cb.solve_ms || (ca.solve_ms == cb.solve_ms && ca.cte < cb.cte);
+        });
+        std::vector<size_t> front;
+        for (size_t k = 0; k < order.size(); k++)
+            if (front.empty() || candidates[order[k]].cte < candidates[front.back()].cte)
+                front.push_back(order[k]);
+        return front;
+    }
+
+    size_t Pick(const std::vector<Candidate> &candidates, const std::vector<size_t> &front, double budget)
+    {
+        if (budget > 0.0)
+        {
+            // cte falls along the front
+            size_t best = front.front();
+            for (size_t k = 0; k < front.size(); k++)
+                if (candidates[front[k]].solve_ms <= budget)
+                    best = front[k];
+            return best;
+        }
+        const Candidate &fast = candidates[front.front()], &accurate = candidates[front.back()];
+        const double cte_range = std::max(1e-12, fast.cte - accurate.cte);
+        const double solve_range = std::max(1e-12, accurate.solve_ms - fast.solve_ms);
+        size_t best = front.front();
+        double best_dist = 1e300;
+        for (size_t k = 0; k < front.size(); k++)
+        {
+            const Candidate &c = candidates[front[k]];
+            const double a = (c.cte - accurate.cte) / cte_range, b = (c.solve_ms - fast.solve_ms) / solve_range;
+            if (a * a + b * b < best_dist)
+            {
+                best_dist = a * a + b * b;
+                best = front[k];
+            }
+        }
+        return best;
+    }
+
+    BayesSearch::BayesSearch(const std::vector<Dimension> &dims, unsigned seed) : _dims(dims), _rng(seed)
+    {
+    }
+
+    std::vector<double> BayesSearch::unit(const Candidate &c) const
+    {
+        std::vector<double> u(_dims.size());
+        for (size_t d = 0; d < _dims.size(); d++)
+        {
+            const Dimension &dim = _dims[d];
+            std::map<std::string, double>::const_iterator it = c.values.find(dim.key);
+            const double v = it != c.values.end() ? it->second : dim.lo;
+            u[d] = dim.log ? std::log(v / dim.lo) / std::log(dim.hi / dim.lo) : (v - dim.lo) / (dim.hi - dim.lo);
+        }
+        return u;
+    }
+
+    Candidate BayesSearch::candidate(const std::vector<double> &u) const
+    {
+        Candidate c;
+        for (size_t d = 0; d < _dims.size(); d++)
+        {
+            const Dimension &dim = _dims[d];
+            const double t = std::max(0.0, std::min(1.0, u[d]));
+            double v = dim.log ? dim.lo * std::pow(dim.hi / dim.lo, t) : dim.lo + t * (dim.hi - dim.lo);
+            if (dim.integer)
+                v = std::round(v);
+            c.values[dim.key] = v;
+        }
+        return c;
+    }
+
+    std::vector<Candidate> BayesSearch::Initial(size_t count)
+    {
+        // Latin hypercube: one point per stratum of every dimension
+        std::vector<std::vector<double> > u(count, std::vector<double>(_dims.size()));
+        for (size_t d = 0; d < _dims.size(); d++)
+        {
+            std::vector<size_t> strata(count);
+            for (size_t i = 0; i < count; i++)
+                strata[i] = i;
+            std::shuffle(strata.begin(), strata.end(), _rng);
+            for (size_t i = 0; i < count; i++)
+                u[i][d] = (strata[i] + uniform(_rng)) / count;
+        }
+        std::vector<Candidate> points;
+        for (size_t i = 0; i < count; i++)
+            points.push_back(candidate(u[i]));
+        return points;
+    }
+
+    std::vector<Candidate> BayesSearch::Suggest(const std::vector<Candidate> &evaluated, size_t count)
+    {
+        std::vector<std::vector<double> > x;
+        std::vector<double> cte, solve;
+        double worst_cte = 0.0;
+        for (size_t i = 0; i < evaluated.size(); i++)
+            if (evaluated[i].evaluated && evaluated[i].diverged == 0)
+                worst_cte = std::max(worst_cte, evaluated[i].cte);
+        for (size_t i = 0; i < evaluated.size(); i++)
+        {
+            if (!evaluated[i].evaluated)
+                continue;
+            x.push_back(unit(evaluated[i]));
+            // A diverged candidate scores worse than any other one
+            cte.push_back(evaluated[i].diverged > 0 ? 2.0 * std::max(worst_cte, 1e-3) : evaluated[i].cte);
+            solve.push_back(evaluated[i].solve_ms);
+        }
+        if (x.size() < 2)
+            return Initial(count);
+        const size_t n = x.size(), dims = _dims.size();
+        const double cte_lo = *std::min_element(cte.begin(), cte.end());
+        const double cte_hi = *std::max_element(cte.begin(), cte.end());
+        const double solve_lo = *std::min_element(solve.begin(), solve.end());
+        const double solve_hi = *std::max_element(solve.begin(), solve.end());
+
+        Eigen::MatrixXd K(n, n);
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++)
+            {
+                double sq = 0.0;
+                for (size_t d = 0; d < dims; d++)
+                    sq += (x[i][d] - x[j][d]) * (x[i][d] - x[j][d]);
+                K(i, j) = std::exp(-0.5 * sq / (LENGTH * LENGTH)) + (i == j ? NOISE : 0.0);
+            }
+        const Eigen::LLT<Eigen::MatrixXd> llt(K);
+
+        std::vector<Candidate> batch;
+        std::vector<std::vector<double> > chosen;
+        for (size_t b = 0; b < count; b++)
+        {
+            // Augmented Tchebycheff scalarization of the normalized scores
+            const double lambda = uniform(_rng);
+            Eigen::VectorXd y(n);
+            size_t best_i = 0;
+            for (size_t i = 0; i < n; i++)
+            {
+                const double a = lambda * (cte[i] - cte_lo) / std::max(1e-12, cte_hi - cte_lo);
+                const double c = (1.0 - lambda) * (solve[i] - solve_lo) / std::max(1e-12, solve_hi - solve_lo);
+                y[i] = std::max(a, c) + 0.05 * (a + c);
+                if (y[i] < y[best_i])
+                    best_i = i;
+            }
+            const double mean = y.mean();
+            const double scale = std::max(1e-12, std::sqrt((y.array() - mean).square().mean()));
+            const Eigen::VectorXd alpha = llt.solve(((y.array() - mean) / scale).matrix());
+            const double y_best = (y[best_i] - mean) / scale;
+
+            // Expected improvement over random points and around the best
+            double best_ei = -1.0;
+            std::vector<double> best_u;
+            std::normal_distribution<double> step(0.0, 0.05);
+            for (int k = 0; k < 2000; k++)
+            {
+                std::vector<double> u(dims);
+                for (size_t d = 0; d < dims; d++)
+                    u[d] = k < 1500 ? uniform(_rng) : std::max(0.0, std::min(1.0, x[best_i][d] + step(_rng)));
+                bool too_close = false;
+                for (size_t c = 0; c < chosen.size() && !too_close; c++)
+                {
+                    double sq = 0.0;
+                    for (size_t d = 0; d < dims; d++)
+                        sq += (u[d] - chosen[c][d]) * (u[d] - chosen[c][d]);
+                    too_close = sq < 0.05 * 0.05;
+                }
+                if (too_close)
+                    continue;
+                Eigen::VectorXd ks(n);
+                for (size_t i = 0; i < n; i++)
+                {
+                    double sq = 0.0;
+                    for (size_t d = 0; d < dims; d++)
+                        sq += (u[d] - x[i][d]) * (u[d] - x[i][d]);
+                    ks[i] = std::exp(-0.5 * sq / (LENGTH * LENGTH));
+                }
+                const double mu = ks.dot(alpha);
+                const double var = std::max(1e-12, 1.0 - ks.dot(llt.solve(ks)));
+                const double sigma = std::sqrt(var);
+                const double z = (y_best - mu) / sigma;
+                const double ei = (y_best - mu) * 0.5 * std::erfc(-z / std::sqrt(2.0))
+                                  + sigma * std::exp(-0.5 * z * z) / std::sqrt(2.0 * M_PI);
+                if (ei > best_ei)
+                {
+                    best_ei = ei;
+                    best_u = u;
+                }
+            }
+            if (best_u.empty())
+                break;
+            chosen.push_back(best_u);
+            batch.push_back(candidate(best_u));
+        }
+        return batch;
+    }
+
+    std::string Yaml(const std::map<std::string, double> &params, const Candidate &c, const std::string &header)
+    {
+        const std::map<std::string, double> p = withValues(params, c);
+        std::ostringstream out;
+        out << header;
+        std::map<std::string, double>::const_iterator dt = p.find("DT");
+        if (dt != p.end() && dt->second > 0.0)
+        {
+            const double freq = 1.0 / dt->second;
+            out << "controller_freq: " << int(std::round(freq));
+            if (std::fabs(freq - std::round(freq)) > 1e-6)
+                out << " # DT " << dt->second << " s";
+            out << "\n";
+        }
+        std::map<std::string, double>::const_iterator it = p.find("DELAY_MODE");
+        if (it != p.end())
+            out << "delay_mode: " << (it->second != 0.0 ? "true" : "false") << "\n";
+        for (size_t k = 0; k < sizeof(NODE_NAMES) / sizeof(NODE_NAMES[0]); k++)
+        {
+            it = p.find(NODE_NAMES[k][0]);
+            if (it == p.end())
+                continue;
+            std::ostringstream value;
+            value << it->second;
+            const std::string text = value.str();
+            out << NODE_NAMES[k][1] << ": " << text
+                << (text.find_first_of(".e") == std::string::npos ? ".0" : "") << "\n";
+        }
+        for (it = c.values.begin(); it != c.values.end(); ++it)
+        {
+            bool named = it->first == "DT" || it->first == "DELAY_MODE";
+            for (size_t k = 0; k < sizeof(NODE_NAMES) / sizeof(NODE_NAMES[0]) && !named; k++)
+                named = it->first == NODE_NAMES[k][0];
+            if (!named)
+                out << "# " << it->first << ": " << it->second << " (no node parameter)\n";
+        }
+        return out.str();
+    }
+}
@@ -0,0 +1,209 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "path_fit.h"
+#include <Eigen/QR>
+#include <cmath>
+
+const int PathFit::ORDER;
+const int PathFit::MAX_ORDER;
+
+PathFit::PathFit()
+{
+    for (int order = 0; order <= MAX_ORDER; order++)
+        _fits[order] = Eigen::VectorXd::Zero(order + 1);
+    _order = ORDER;
+    _points = 0;
+    _max_order = 0;
+    _tolerance = 0.01;
+    _min_window = 0.5;
+    _max_condition = 1e10;
+}
+
+void PathFit::SetAdaptive(int max_order, double tolerance, double min_window, double max_condition)
+{
+    _max_order = std::max(0, std::min(max_order, MAX_ORDER));
+    _tolerance = tolerance;
+    _min_window = min_window;
+    _max_condition = max_condition;
+}
+
+bool PathFit::Fit(const double *xs, const double *ys, int n, double px, double py, double theta)
+{
+    if (_max_order > 0)
+        return fitAdaptive(xs, ys, n, px, py, theta);
+
+    typedef Eigen::Matrix<double, ORDER + 1, 1> Vector;
+    typedef Eigen::Matrix<double, ORDER + 1, ORDER + 1> Matrix;
+
+    const int N = n;
+    if (N < ORDER + 1)
+        return false;
+
+    const double costheta = cos(theta);
+    const double sintheta = sin(theta);
+
+    // x is scaled to [-1, 1] so that the normal equations stay well conditioned
+    double scale = 0.0;
+    for (int i = 0; i < N; i++)
+    {
+        const double dx = xs[i] - px;
+        const double dy = ys[i] - py;
+        scale = std::max(scale, std::fabs(dx * costheta + dy * sintheta));
+    }
+    if (scale <= 0.0)
+        return false;
+
+    Matrix AtA = Matrix::Zero();
+    Vector Aty = Vector::Zero();
+    Vector a;
+    for (int i = 0; i < N; i++)
+    {
+        const double dx = xs[i] - px;
+        const double dy = ys[i] - py;
+        const double x = (dx * costheta + dy * sintheta) / scale;
+        const double y = dy * costheta - dx * sintheta;
+
+        a[0] = 1.0;
+        for (int j = 0; j < ORDER; j++)
+            a[j + 1] = a[j] * x;
+        AtA.noalias() += a * a.transpose();
+        Aty.noalias() += a * y;
+    }
+
+    Eigen::ColPivHouseholderQR<Matrix> qr(AtA);
+    if (qr.rank() < ORDER + 1)
+        return false;
+    const Vector c = qr.solve(Aty);
+
+    // Undo the scaling of x
+    Eigen::VectorXd &coeffs = _fits[ORDER];
+    double s = 1.0;
+    for (int j = 0; j <= ORDER; j++)
+    {
+        coeffs[j] = c[j] / s;
+        s *= scale;
+    }
+    _order = ORDER;
+    _points = N;
+    return true;
+}
+
+bool PathFit::fitAdaptive(const double *xs, const double *ys, int N, double px, double py, double theta)
+{
+    typedef Eigen::Matrix<double, MAX_ORDER + 1, 1> Vector;
+    typedef Eigen::Matrix<double, MAX_ORDER + 1, MAX_ORDER + 1> Matrix;
+    // Leading blocks of those, on the stack
+    typedef Eigen::Matrix<double, Eigen::Dynamic, 1, 0, MAX_ORDER + 1, 1> Block;
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, 0, MAX_ORDER + 1, MAX_ORDER + 1> BlockMatrix;
+
+    const double costheta = cos(theta);
+    const double sintheta = sin(theta);
+
+    // All the waypoints, then the nearest half of them, down to an eighth.
+    // Each order gets two waypoints more than it has coefficients, so that
+    // its residual tells something.
+    for (int n = N, pass = 0; pass < 4 && n >= 4; pass++, n /= 2)
+    {
+        double scale = 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            const double dx = xs[i] - px;
+            const double dy = ys[i] - py;
+            scale = std::max(scale, std::fabs(dx * costheta + dy * sintheta));
+        }
+        if (scale <= 0.0 || (pass > 0 && scale < _min_window))
+            break;
+
+        // Normal equations of MAX_ORDER, every order solves its leading block
+        Matrix AtA = Matrix::Zero();
+        Vector Aty = Vector::Zero();
+        Vector a;
+        double yty = 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            const double dx = xs[i] - px;
+            const double dy = ys[i] - py;
+            const double x = (dx * costheta + dy * sintheta) / scale;
+            const double y = dy * costheta - dx * sintheta;
+
+            a[0] = 1.0;
+            for (int j = 0; j < MAX_ORDER; j++)
+                a[j + 1] = a[j] * x;
+            AtA.noalias() += a * a.transpose();
+            Aty.noalias() += a * y;
+            yty += y * y;
+        }
+
+        for (int order = 1; order <= std::min(_max_order, n - 3); order++)
+        {
+            const int m = order + 1;
+            const BlockMatrix block = AtA.topLeftCorner(m, m);
+            const Block rhs = Aty.head(m);
+            Eigen::ColPivHouseholderQR<BlockMatrix> qr(block);
+            if (qr.rank() < m)
+                break;
+            // The pivoted diagonal of R decreases, its spread is the condition
+            const double r_max = std::fabs(qr.matrixR()(0, 0)), r_min = std::fabs(qr.matrixR()(m - 1, m - 1));
+            if (r_max > _max_condition * r_min)
+                break;
+            const Block c = qr.solve(rhs);
+            const double rss = yty - 2.0 * c.dot(rhs) + c.dot(block * c);
+            if (std::sqrt(std::max(rss, 0.0) / n) > _tolerance)
+                continue;
+
+            Eigen::VectorXd &coeffs = _fits[order];
+            double s = 1.0;
+            for (int j = 0; j <= order; j++)
+            {
+                coeffs[j] = c[j] / s;
+                s *= scale;
+            }
+            _order = order;
+            _points = n;
+            return true;
+        }
+    }
+
+    // Nothing within tolerance: the cubic of all the waypoints
+    const int max_order = _max_order;
+    _max_order = 0;
+    const bool fitted = Fit(xs, ys, N, px, py, theta);
+    _max_order = max_order;
+    return fitted;
+}
+
+double PathFit::Eval(double x) const
+{
+    return Eval(Coeffs(), x);
+}
+
+double PathFit::Slope(double x) const
+{
+    const Eigen::VectorXd &coeffs = Coeffs();
+    double result = 0.0;
+    for (int i = coeffs.size() - 1; i > 0; i--)
+        result = result * x + i * coeffs[i];
+    return result;
+}
+
+double PathFit::Eval(const Eigen::VectorXd &coeffs, double x)
+{
+    double result = 0.0;
+    for (int i = coeffs.size() - 1; i >= 0; i--)
+        result = result * x + coeffs[i];
+    return result;
+}
@@ -0,0 +1,178 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "path_index.h"
+#include <algorithm>
+#include <cmath>
+
+PathIndex::PathIndex(int window, double relocalize_dist)
+    : _grid_valid(false), _min_cx(0), _max_cx(-1), _min_cy(0), _max_cy(-1), _current(0),
+      _window(std::max(window, 1)), _relocalize_dist(relocalize_dist > 0.0 ? relocalize_dist : 1.0)
+{
+}
+
+void PathIndex::Set(const CompactPath::ConstPtr &path)
+{
+    bool same = false;
+    if (_path && path && !path->Empty() && path->Frame() == _path->Frame() && path->Size() == _path->Size())
+    {
+        const size_t last = path->Size() - 1;
+        same = path->X(0) == _path->X(0) && path->Y(0) == _path->Y(0) &&
+               path->X(last) == _path->X(last) && path->Y(last) == _path->Y(last);
+    }
+
+    size_t offset = 0;
+    const bool shifted = !same && path && _path && Shifted(*path, offset);
+
+    _path = path;
+    if (same)
+        return;
+    _grid_valid = false;
+    _current = (shifted && _current >= offset) ? _current - offset : 0;
+}
+
+// Whether path continues the indexed one from its offset-th pose. Only the
+// poses up to the look ahead window are tried, the robot cannot have passed
+// anything further.
+bool PathIndex::Shifted(const CompactPath &path, size_t &offset) const
+{
+    if (path.Empty() || _path->Empty() || path.Frame() != _path->Frame())
+        return false;
+
+    const size_t end = std::min(_path->Size(), _current + _window + 1);
+    for (size_t k = 0; k < end; k++)
+    {
+        if (_path->X(k) != path.X(0) || _path->Y(k) != path.Y(0))
+            continue;
+        if (k + 1 < _path->Size() && path.Size() > 1 &&
+            (_path->X(k + 1) != path.X(1) || _path->Y(k + 1) != path.Y(1)))
+            continue;
+        offset = k;
+        return true;
+    }
+    return false;
+}
+
+size_t PathIndex::Nearest(double x, double y)
+{
+    if (!_path || _path->Empty())
+        return 0;
+
+    const size_t end = std::min(_path->Size(), _current + _window + 1);
+    size_t best = _current;
+    double best_sq = SqDist(_current, x, y);
+    for (size_t i = _current + 1; i < end; i++)
+    {
+        const double sq = SqDist(i, x, y);
+        if (sq < best_sq)
+        {
+            best_sq = sq;
+            best = i;
+        }
+    }
+
+    if (best_sq > _relocalize_dist * _relocalize_dist)
+    {
+        if (!_grid_valid)
+            Build();
+        best = Relocalize(x, y);
+    }
+
+    _current = best;
+    return best;
+}
+
+void PathIndex::Build()
+{
+    _grid.clear();
+    _grid_valid = true;
+    _min_cx = _min_cy = 0;
+    _max_cx = _max_cy = -1;
+    if (!_path || _path->Empty())
+        return;
+
+    const CompactPath &path = *_path;
+    _grid.reserve(path.Size());
+    _min_cx = _max_cx = CellOf(path.X(0));
+    _min_cy = _max_cy = CellOf(path.Y(0));
+    for (size_t i = 0; i < path.Size(); i++)
+    {
+        const int cx = CellOf(path.X(i));
+        const int cy = CellOf(path.Y(i));
+        _min_cx = std::min(_min_cx, cx);
+        _max_cx = std::max(_max_cx, cx);
+        _min_cy = std::min(_min_cy, cy);
+        _max_cy = std::max(_max_cy, cy);
+        _grid.push_back(Cell(Key(cx, cy), (uint32_t)i));
+    }
+    std::sort(_grid.begin(), _grid.end());
+}
+
+// Search rings of cells around (x, y) until no closer pose can be left.
+// Poses in ring r + 1 are at least r cells away from the query.
+size_t PathIndex::Relocalize(double x, double y) const
+{
+    const int cx0 = CellOf(x), cy0 = CellOf(y);
+    const int max_r = std::max(std::max(std::abs(cx0 - _min_cx), std::abs(_max_cx - cx0)),
+                               std::max(std::abs(cy0 - _min_cy), std::abs(_max_cy - cy0)));
+    size_t best = _current;
+    double best_sq = SqDist(_current, x, y);
+    for (int r = 0; r <= max_r; r++)
+    {
+        const int x0 = std::max(cx0 - r, _min_cx), x1 = std::min(cx0 + r, _max_cx);
+        for (int cx = x0; cx <= x1; cx++)
+        {
+            const bool edge = (cx == cx0 - r || cx == cx0 + r);
+            const int step = edge ? 1 : 2 * r;
+            for (int cy = cy0 - r; cy <= cy0 + r; cy += step)
+            {
+                if (cy < _min_cy || cy > _max_cy)
+                    continue;
+                std::vector<Cell>::const_iterator it = std::lower_bound(_grid.begin(), _grid.end(), Cell(Key(cx, cy), 0));
+                for (; it != _grid.end() && it->first == Key(cx, cy); ++it)
+                {
+                    const double sq = SqDist(it->second, x, y);
+                    if (sq < best_sq)
+                    {
+                        best_sq = sq;
+                        best = it->second;
+                    }
+                }
+            }
+        }
+        const double reach = r * _relocalize_dist;
+        if (best_sq <= reach * reach)
+            break;
+    }
+    return best;
+}
+
+double PathIndex::SqDist(size_t i, double x, double y) const
+{
+    const double dx = _path->X(i) - x, dy = _path->Y(i) - y;
+    return dx * dx + dy * dy;
+}
+
+int PathIndex::CellOf(double v) const
+{
+    return (int)std::floor(v / _relocalize_dist);
+}
+
+uint64_t PathIndex::Key(int cx, int cy)
+{
+    return ((uint64_t)(uint32_t)cx << 32) | (uint32_t)cy;
+}
@@ -0,0 +1,133 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "path_transform.h"
+#include <cmath>
+
+PathTransform::PathTransform() : _size(0) {}
+
+void PathTransform::Transform(const tf::Transform &transform, const Poses &in)
+{
+    const tf::Vector3 &t = transform.getOrigin();
+    const tf::Quaternion q = transform.getRotation();
+    const double origin[3] = { t.x(), t.y(), t.z() };
+    const double rotation[4] = { q.x(), q.y(), q.z(), q.w() };
+    Transform(origin, rotation, in);
+}
+
+void PathTransform::Transform(const tf2::Transform &transform, const Poses &in)
+{
+    const tf2::Vector3 &t = transform.getOrigin();
+    const tf2::Quaternion q = transform.getRotation();
+    const double origin[3] = { t.x(), t.y(), t.z() };
+    const double rotation[4] = { q.x(), q.y(), q.z(), q.w() };
+    Transform(origin, rotation, in);
+}
+
+void PathTransform::Transform(const tf::Transform &transform, const CompactPath &in)
+{
+    const tf::Vector3 &t = transform.getOrigin();
+    const tf::Quaternion q = transform.getRotation();
+    const double origin[3] = { t.x(), t.y(), t.z() };
+    const double rotation[4] = { q.x(), q.y(), q.z(), q.w() };
+
+    Resize(in.Size());
+    for (size_t i = 0; i < _size; i++)
+    {
+        _in(i, PX) = in.X(i);
+        _in(i, PY) = in.Y(i);
+        _in(i, PZ) = 0.0;
+        _in(i, QX) = 0.0;
+        _in(i, QY) = 0.0;
+        _in(i, QZ) = std::sin(0.5 * in.Yaw(i));
+        _in(i, QW) = std::cos(0.5 * in.Yaw(i));
+        _stamps[i] = in.Stamp();
+    }
+    Apply(origin, rotation);
+}
+
+void PathTransform::Resize(size_t size)
+{
+    _size = size;
+    // Grow only, a new path of the same length reuses the buffers
+    if ((size_t)_in.rows() < _size)
+    {
+        _in.resize(_size, COLUMNS);
+        _out.resize(_size, COLUMNS);
+    }
+    _stamps.resize(_size);
+}
+
+void PathTransform::Transform(const double origin[3], const double rotation[4], const Poses &in)
+{
+    Resize(in.size());
+    for (size_t i = 0; i < _size; i++)
+    {
+        const geometry_msgs::Pose &pose = in[i].pose;
+        _in(i, PX) = pose.position.x;
+        _in(i, PY) = pose.position.y;
+        _in(i, PZ) = pose.position.z;
+        _in(i, QX) = pose.orientation.x;
+        _in(i, QY) = pose.orientation.y;
+        _in(i, QZ) = pose.orientation.z;
+        _in(i, QW) = pose.orientation.w;
+        _stamps[i] = in[i].header.stamp;
+    }
+    Apply(origin, rotation);
+}
+
+void PathTransform::Apply(const double origin[3], const double rotation[4])
+{
+    const double x = rotation[0], y = rotation[1], z = rotation[2], w = rotation[3];
+    // Rotation matrix of the unit quaternion (x, y, z, w)
+    const double r00 = 1.0 - 2.0 * (y * y + z * z), r01 = 2.0 * (x * y - z * w), r02 = 2.0 * (x * z + y * w);
+    const double r10 = 2.0 * (x * y + z * w), r11 = 1.0 - 2.0 * (x * x + z * z), r12 = 2.0 * (y * z - x * w);
+    const double r20 = 2.0 * (x * z - y * w), r21 = 2.0 * (y * z + x * w), r22 = 1.0 - 2.0 * (x * x + y * y);
+
+    const Eigen::Index n = _size;
+    const Eigen::Ref<const Eigen::ArrayXd> px = _in.col(PX).head(n), py = _in.col(PY).head(n), pz = _in.col(PZ).head(n);
+    const Eigen::Ref<const Eigen::ArrayXd> qx = _in.col(QX).head(n), qy = _in.col(QY).head(n);
+    const Eigen::Ref<const Eigen::ArrayXd> qz = _in.col(QZ).head(n), qw = _in.col(QW).head(n);
+
+    // p' = R p + t
+    _out.col(PX).head(n) = r00 * px + r01 * py + r02 * pz + origin[0];
+    _out.col(PY).head(n) = r10 * px + r11 * py + r12 * pz + origin[1];
+    _out.col(PZ).head(n) = r20 * px + r21 * py + r22 * pz + origin[2];
+    // q' = rotation * q, the Hamilton product is linear in q
+    _out.col(QX).head(n) = w * qx + x * qw + y * qz - z * qy;
+    _out.col(QY).head(n) = w * qy - x * qz + y * qw + z * qx;
+    _out.col(QZ).head(n) = w * qz + x * qy - y * qx + z * qw;
+    _out.col(QW).head(n) = w * qw - x * qx - y * qy - z * qz;
+}
+
+double PathTransform::Yaw(size_t i) const
+{
+    const double qx = _out(i, QX), qy = _out(i, QY), qz = _out(i, QZ), qw = _out(i, QW);
+    return std::atan2(2.0 * (qw * qz + qx * qy), 1.0 - 2.0 * (qy * qy + qz * qz));
+}
+
+void PathTransform::Pose(size_t i, const std::string &frame, geometry_msgs::PoseStamped &out) const
+{
+    out.header.stamp = _stamps[i];
+    out.header.frame_id = frame;
+    out.pose.position.x = _out(i, PX);
+    out.pose.position.y = _out(i, PY);
+    out.pose.position.z = _out(i, PZ);
+    out.pose.orientation.x = _out(i, QX);
+    out.pose.orientation.y = _out(i, QY);
+    out.pose.orientation.z = _out(i, QZ);
+    out.pose.orientation.w = _out(i, QW);
+}
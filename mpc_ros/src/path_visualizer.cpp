@@ -0,0 +1,78 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "path_visualizer.h"
+#include <cmath>
+
+PathVisualizer::PathVisualizer() : _period(0.0)
+{
+}
+
+void PathVisualizer::Advertise(ros::NodeHandle &nh, const std::string &topic)
+{
+    _pub = nh.advertise<nav_msgs::Path>(topic, 1);
+}
+
+void PathVisualizer::SetRate(double rate)
+{
+    _period = ros::Duration(rate > 0.0 ? 1.0 / rate : 0.0);
+}
+
+bool PathVisualizer::Due(const ros::Time &now) const
+{
+    if (!_pub || _pub.getNumSubscribers() == 0)
+        return false;
+    return _last.isZero() || now < _last || now - _last >= _period;
+}
+
+nav_msgs::Path &PathVisualizer::Reset(const std::string &frame, const ros::Time &stamp, size_t n)
+{
+    _msg.header.frame_id = frame;
+    _msg.header.stamp = stamp;
+    _msg.poses.resize(n);
+    return _msg;
+}
+
+void PathVisualizer::SetPose(geometry_msgs::PoseStamped &pose, double x, double y, double yaw)
+{
+    pose.pose.position.x = x;
+    pose.pose.position.y = y;
+    pose.pose.position.z = 0.0;
+    pose.pose.orientation.x = 0.0;
+    pose.pose.orientation.y = 0.0;
+    pose.pose.orientation.z = sin(0.5 * yaw);
+    pose.pose.orientation.w = cos(0.5 * yaw);
+}
+
+void PathVisualizer::Publish(const ros::Time &now)
+{
+    Publish(_msg, now);
+}
+
+void PathVisualizer::Publish(const nav_msgs::Path &msg, const ros::Time &now)
+{
+    _pub.publish(msg);
+    _last = now;
+}
+
+void PathVisualizer::Publish(const CompactPath &path, const ros::Time &now)
+{
+    nav_msgs::Path &msg = Reset(path.Frame(), path.Stamp(), path.Size());
+    for (size_t i = 0; i < path.Size(); i++)
+        SetPose(msg.poses[i], path.X(i), path.Y(i), path.Yaw(i));
+    Publish(now);
+}
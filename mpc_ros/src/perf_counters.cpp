@@ -0,0 +1,147 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "perf_counters.h"
+#include <atomic>
+#include <cstring>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    std::atomic<bool> g_enabled(false);
+
+#if defined(__linux__)
+    const uint64_t CONFIG[perf_counters::NUM_EVENTS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+
+    // Counter group of one thread, read at once with PERF_FORMAT_GROUP
+    class Group
+    {
+        public:
+            Group() : _opened(false), _leader(-1), _size(0)
+            {
+                for (int k = 0; k < perf_counters::NUM_EVENTS; k++)
+                    _fd[k] = -1;
+            }
+            ~Group()
+            {
+                for (int k = 0; k < perf_counters::NUM_EVENTS; k++)
+                    if (_fd[k] >= 0)
+                        close(_fd[k]);
+            }
+
+            bool Open()
+            {
+                if (_opened)
+                    return _leader >= 0;
+                _opened = true;
+                for (int k = 0; k < perf_counters::NUM_EVENTS; k++)
+                {
+                    perf_event_attr attr;
+                    std::memset(&attr, 0, sizeof(attr));
+                    attr.size = sizeof(attr);
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.config = CONFIG[k];
+                    attr.disabled = _leader < 0;
+                    attr.exclude_kernel = 1;
+                    attr.exclude_hv = 1;
+                    attr.read_format = PERF_FORMAT_GROUP;
+                    const int fd = syscall(__NR_perf_event_open, &attr, 0, -1, _leader, 0);
+                    if (fd < 0)
+                        continue;
+                    _fd[k] = fd;
+                    _event[_size++] = k;
+                    if (_leader < 0)
+                        _leader = fd;
+                }
+                if (_leader < 0)
+                    return false;
+                ioctl(_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                ioctl(_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+                return true;
+            }
+
+            bool Read(perf_counters::Counts &counts)
+            {
+                // nr and then the values in the order the events were opened
+                uint64_t data[1 + perf_counters::NUM_EVENTS];
+                if (read(_leader, data, sizeof(data)) < (ssize_t)sizeof(uint64_t))
+                    return false;
+                for (uint64_t i = 0; i < data[0] && i < (uint64_t)_size; i++)
+                    counts.value[_event[i]] = data[1 + i];
+                return true;
+            }
+
+        private:
+            bool _opened;
+            int _leader, _size;
+            int _fd[perf_counters::NUM_EVENTS];
+            int _event[perf_counters::NUM_EVENTS]; // Event of the i-th value
+    };
+
+    Group &group()
+    {
+        thread_local Group group;
+        return group;
+    }
+#endif
+}
+
+namespace perf_counters
+{
+    bool Enable()
+    {
+#if defined(__linux__)
+        if (!group().Open())
+            return false;
+        g_enabled.store(true);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool Enabled()
+    {
+        return g_enabled.load(std::memory_order_relaxed);
+    }
+
+    bool Read(Counts &counts)
+    {
+        counts = Counts();
+        if (!Enabled())
+            return false;
+#if defined(__linux__)
+        Group &g = group();
+        return g.Open() && g.Read(counts);
+#else
+        return false;
+#endif
+    }
+
+    const char *Name(int event)
+    {
+        static const char *const names[NUM_EVENTS] = {"cycles", "instructions", "cache_misses", "branch_misses"};
+        return event >= 0 && event < NUM_EVENTS ? names[event] : "";
+    }
+}
@@ -0,0 +1,152 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "plan_prefetch.h"
+#include "trace_span.h"
+#include <algorithm>
+#include <cmath>
+
+// Poses of the published and of the set plan closer than this are the same [m]
+static const double SAME_POSE = 1e-3;
+
+PlanPrefetch::PlanPrefetch()
+{
+    _running = false;
+    _pending = false;
+    const double config[6] = { 0.5, 3.0, 0.5, 1.0, 0.3, 0.1 };
+    std::copy(config, config + 6, _config);
+    _ready = false;
+    _matched = false;
+}
+
+PlanPrefetch::~PlanPrefetch()
+{
+    Stop();
+}
+
+void PlanPrefetch::Start()
+{
+    Stop();
+    _running = true;
+    _thread = std::thread(&PlanPrefetch::Run, this);
+}
+
+void PlanPrefetch::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _running = false;
+    }
+    _cond.notify_all();
+    if (_thread.joinable())
+        _thread.join();
+}
+
+void PlanPrefetch::Configure(double max_speed, double max_angvel, double max_lat_accel, double max_accel,
+                             double window, double end_speed)
+{
+    const double config[6] = { max_speed, max_angvel, max_lat_accel, max_accel, window, end_speed };
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (std::equal(config, config + 6, _config))
+            return;
+        std::copy(config, config + 6, _config);
+        if (!_ready || _pending)
+            return;
+        _request = _plan;
+        _pending = true;
+    }
+    _cond.notify_one();
+}
+
+void PlanPrefetch::Request(const PlanWindow::Poses &plan)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _request = plan;
+        _pending = true;
+    }
+    _cond.notify_one();
+}
+
+bool PlanPrefetch::Match(const PlanWindow::Poses &plan)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_ready || plan.size() != _plan.size())
+        return false;
+    for (size_t i = 0; i < plan.size(); i++)
+    {
+        const geometry_msgs::Point &a = plan[i].pose.position, &b = _plan[i].pose.position;
+        if (std::fabs(a.x - b.x) > SAME_POSE || std::fabs(a.y - b.y) > SAME_POSE)
+            return false;
+    }
+    _matched = true;
+    return true;
+}
+
+bool PlanPrefetch::Adopt(const CompactPath::ConstPtr &path, SpeedProfile &profile)
+{
+    if (!_matched || !path || path == _tried)
+        return false;
+    _tried = path;
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_ready || !profile.Adopt(_profile, path))
+        return false;
+    _matched = false;
+    _ready = false;
+    _plan.clear();
+    return true;
+}
+
+void PlanPrefetch::Run()
+{
+    MPC_TRACE_THREAD("mpc_plan_prefetch");
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _cond.wait(lock, [this] { return _pending || !_running; });
+        if (!_running)
+            break;
+        _pending = false;
+        PlanWindow::Poses plan;
+        plan.swap(_request);
+        double config[6];
+        std::copy(_config, _config + 6, config);
+
+        // Profile without holding the lock, in the frame of the plan
+        lock.unlock();
+        SpeedProfile profile;
+        {
+            MPC_TRACE_SPAN("plan_prefetch");
+            boost::shared_ptr<CompactPath> path(new CompactPath());
+            path->Reserve(plan.size());
+            for (size_t i = 0; i < plan.size(); i++)
+                path->PushBack(plan[i].pose);
+            profile.Configure(config[0], config[1], config[2], config[3], config[4], config[5]);
+            profile.Update(path);
+        }
+        lock.lock();
+
+        // A newer plan or configuration replaces this one
+        if (_pending || plan.empty())
+            continue;
+        _plan.swap(plan);
+        _profile = profile;
+        _ready = true;
+        _matched = false;
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "plan_sensitivity.h"
+#include <algorithm>
+#include <cmath>
+
+PlanSensitivity::PlanSensitivity()
+{
+    dt = 0.1;
+    max_angvel = 0;
+    max_throttle = 0;
+    _stamp = 0;
+    _offset = 0;
+    _ox = 0;
+    _oy = 0;
+    _otheta = 0;
+}
+
+void PlanSensitivity::Clear()
+{
+    states.clear();
+    inputs.clear();
+    gains.clear();
+}
+
+void PlanSensitivity::SetOrigin(double stamp, double ox, double oy, double otheta, double offset)
+{
+    _stamp = stamp;
+    _ox = ox;
+    _oy = oy;
+    _otheta = otheta;
+    _offset = offset;
+}
+
+bool PlanSensitivity::Correct(double t, double x, double y, double theta, double v,
+                              double &dangvel, double &daccel) const
+{
+    dangvel = 0;
+    daccel = 0;
+    const double tau = t - _stamp - _offset;
+    if (!Valid() || dt <= 0 || tau < 0)
+        return false;
+    const int k = std::floor(tau / dt);
+    if (k >= (int)gains.size())
+        return false;
+
+    // Measurement in the frame of the plan
+    const double dx = x - _ox, dy = y - _oy;
+    const double c = cos(_otheta), s = sin(_otheta);
+    State meas;
+    meas[0] = c * dx + s * dy;
+    meas[1] = -s * dx + c * dy;
+    meas[2] = atan2(sin(theta - _otheta), cos(theta - _otheta));
+    meas[3] = v;
+
+    // Predicted state at t, between steps k and k + 1
+    const double frac = tau / dt - k;
+    const State nominal = (1 - frac) * states[k] + frac * states[k + 1];
+
+    // cte and etheta move with the pose along the path (the cte and etheta
+    // rows of RtiSolver::model())
+    double f = 0, df = 0, ddf = 0;
+    for (int i = coeffs.size() - 1; i >= 0; i--)
+    {
+        ddf = ddf * nominal[0] + 2 * df;
+        df = df * nominal[0] + f;
+        f = f * nominal[0] + coeffs[i];
+    }
+    State ds = meas - nominal;
+    ds[2] = atan2(sin(ds[2]), cos(ds[2]));
+    ds[4] = df * ds[0] - ds[1];
+    ds[5] = ds[2] - ddf / (1 + df * df) * ds[0];
+
+    const Input du = gains[k] * ds;
+    const Input &u = inputs[k];
+    dangvel = std::min(std::max(u[0] + du[0], -max_angvel), max_angvel) - u[0];
+    daccel = std::min(std::max(u[1] + du[1], -max_throttle), max_throttle) - u[1];
+    return true;
+}
@@ -0,0 +1,119 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "plan_window.h"
+#include "path_transform.h"
+#include <cmath>
+#include <algorithm>
+
+PlanWindow::PlanWindow() : _start(0) {}
+
+void PlanWindow::Set(const Poses &plan, const tf2::Transform &plan_to_odom, const std::string &odom_frame)
+{
+    PathTransform transform;
+    transform.Transform(plan_to_odom, plan);
+    boost::shared_ptr<Poses> poses(new Poses(plan.size()));
+    boost::shared_ptr<CompactPath> path(new CompactPath());
+    path->Reserve(plan.size());
+    for (size_t i = 0; i < plan.size(); i++)
+    {
+        transform.Pose(i, odom_frame, (*poses)[i]);
+        path->PushBack(transform.X(i), transform.Y(i), transform.Yaw(i));
+    }
+    path->SetFrame(odom_frame);
+    _plan = poses;
+    _path = path;
+    _start = 0;
+}
+
+void PlanWindow::Clear()
+{
+    _plan.reset();
+    _path.reset();
+    _start = 0;
+}
+
+void PlanWindow::Advance(double x, double y, double max_dist)
+{
+    if (Empty())
+        return;
+
+    // Poses within max_dist of arc length from the start
+    const std::vector<double> &s = _path->Ss();
+    const size_t end = std::upper_bound(s.begin() + _start, s.end(), s[_start] + max_dist) - s.begin();
+    const double *xs = _path->Xs(), *ys = _path->Ys();
+    size_t best = _start;
+    double best_sq = INFINITY;
+    for (size_t i = _start; i < end; i++)
+    {
+        const double dx = xs[i] - x, dy = ys[i] - y;
+        const double sq = dx * dx + dy * dy;
+        if (sq < best_sq)
+        {
+            best_sq = sq;
+            best = i;
+        }
+    }
+    _start = best;
+}
+
+PlanSamples::PlanSamples() : _stride(0), _count(0), _first(0) {}
+
+void PlanSamples::Clear()
+{
+    _plan.reset();
+    _path.Clear();
+    _first = 0;
+}
+
+CompactPath &PlanSamples::Update(const PlanWindow &plan, size_t stride, size_t count)
+{
+    if (plan.Empty() || stride == 0)
+    {
+        Clear();
+        return _path;
+    }
+    if (plan.Path() != _plan || stride != _stride || count != _count)
+    {
+        Clear();
+        _plan = plan.Path();
+        _stride = stride;
+        _count = count;
+    }
+
+    const CompactPath &path = *_plan;
+    CompactPath &samples = _path;
+    const size_t start = plan.Start();
+    const size_t first = start - start % stride;
+    if (first < _first || first >= _first + samples.Size() * stride)
+    {
+        // Nothing to keep
+        samples.Clear();
+        _first = first;
+    }
+    else if (first > _first)
+    {
+        // Behind the robot
+        samples.EraseFront((first - _first) / stride);
+        _first = first;
+    }
+
+    const size_t end = std::min(path.Size(), start + count + 1);
+    for (size_t i = _first + samples.Size() * stride; i < end; i += stride)
+        samples.PushBack(path.X(i), path.Y(i), path.Yaw(i));
+    return _path;
+}
@@ -0,0 +1,49 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "planner_stats.h"
+
+static const char *STAGE_NAMES[PlannerStats::NUM_STAGES] = { "tf", "path", "fit", "tape", "solve", "publish", "total" };
+
+PlannerStats::PlannerStats(int window) : _stages(NUM_STAGES, RollingStats(window))
+{
+    const double edges[] = { 1.0, 2.0, 5.0, 10.0, 20.0, 50.0, 100.0 }; // ms
+    _hist_edges.assign(edges, edges + sizeof(edges) / sizeof(edges[0]));
+}
+
+void PlannerStats::Add(const mpc_ros::MPCStats &stats)
+{
+    const float stage_ms[NUM_STAGES] = { stats.tf_ms, stats.path_ms, stats.fit_ms, stats.tape_ms,
+                                         stats.solve_ms, stats.publish_ms, stats.total_ms };
+    for(int i = 0; i < NUM_STAGES; i++)
+        _stages[i].Add(stage_ms[i]);
+}
+
+std::string PlannerStats::Table() const
+{
+    std::string table;
+    for(int i = 0; i < NUM_STAGES; i++)
+        table += std::string("\n  ") + STAGE_NAMES[i] + "\t" + _stages[i].Summary();
+    return table;
+}
+
+void PlannerStats::FillHistogram(mpc_ros::MPCStats &stats) const
+{
+    stats.hist_edges_ms.assign(_hist_edges.begin(), _hist_edges.end());
+    const std::vector<unsigned int> hist = _stages[STAGE_TOTAL].Histogram(_hist_edges);
+    stats.total_hist.assign(hist.begin(), hist.end());
+}
@@ -0,0 +1,239 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "poly_ref_atomic.h"
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+using CppAD::AD;
+
+void PolyRef(const CPPAD_TESTVECTOR(AD<double>) &c, const AD<double> &x0, AD<double> &f0, AD<double> &heading)
+{
+    PolyRefAtomic *atomic = PolyRefAtomic::Get(c.size());
+    if (!atomic)
+    {
+        PolyRef<CPPAD_TESTVECTOR(AD<double>), AD<double> >(c, x0, f0, heading);
+        return;
+    }
+    CPPAD_TESTVECTOR(AD<double>) in(1 + c.size()), out(2);
+    in[0] = x0;
+    for (size_t k = 0; k < c.size(); k++)
+    {
+        in[1 + k] = c[k];
+    }
+    (*atomic)(in, out);
+    f0 = out[0];
+    heading = out[1];
+}
+
+PolyRefAtomic *PolyRefAtomic::Get(size_t n_coeffs)
+{
+    static std::mutex mutex;
+    static std::map<size_t, PolyRefAtomic*> atomics; // never freed, tapes refer to them
+    std::lock_guard<std::mutex> lock(mutex);
+    std::map<size_t, PolyRefAtomic*>::const_iterator it = atomics.find(n_coeffs);
+    if (it != atomics.end())
+    {
+        return it->second;
+    }
+    if (n_coeffs == 0 || n_coeffs > MAX_COEFFS || CppAD::thread_alloc::in_parallel())
+    {
+        return NULL;
+    }
+    PolyRefAtomic *atomic = new PolyRefAtomic(n_coeffs);
+    atomics[n_coeffs] = atomic;
+    return atomic;
+}
+
+std::string PolyRefAtomic::name(size_t n_coeffs)
+{
+    std::ostringstream ss;
+    ss << "poly_ref_atomic_" << n_coeffs;
+    return ss.str();
+}
+
+PolyRefAtomic::PolyRefAtomic(size_t n_coeffs)
+    : PatternAtomic(name(n_coeffs), 1 + n_coeffs, 2)
+{
+    // f depends on every coefficient and, unless it is constant, on x;
+    // f' only on the coefficients from c_1 on, and on x from degree 2 on
+    const size_t n = _n_in;
+    std::vector<bool> jac(2 * n, false), hes(2 * n * n, false);
+    for (size_t k = 0; k < n_coeffs; k++)
+    {
+        jac[1 + k] = true;
+        if (k >= 1)
+        {
+            jac[n + 1 + k] = true;
+        }
+    }
+    jac[0] = n_coeffs >= 2;
+    jac[n] = n_coeffs >= 3;
+
+    // f: d2/dx2 from degree 2 on and d2/dx dc_k for k >= 1.
+    // atan(f'): every pair of its inputs.
+    for (size_t k = 1; k < n_coeffs; k++)
+    {
+        hes[0 * n + 1 + k] = hes[(1 + k) * n + 0] = true;
+    }
+    hes[0] = n_coeffs >= 3;
+    for (size_t j = 0; j < n; j++)
+    {
+        for (size_t l = 0; l < n; l++)
+        {
+            hes[n * n + j * n + l] = jac[n + j] && jac[n + l];
+        }
+    }
+    SetPattern(jac, hes);
+}
+
+void PolyRefAtomic::derivatives(const double *c, double x, double d[4]) const
+{
+    // Horner form of f and of its first three derivatives
+    const int n_coeffs = NumCoeffs();
+    d[0] = c[n_coeffs - 1];
+    d[1] = d[2] = d[3] = 0.0;
+    for (int k = n_coeffs - 2; k >= 0; k--)
+    {
+        d[3] = d[3] * x + 3.0 * d[2];
+        d[2] = d[2] * x + 2.0 * d[1];
+        d[1] = d[1] * x + d[0];
+        d[0] = d[0] * x + c[k];
+    }
+}
+
+bool PolyRefAtomic::forward(size_t p, size_t q, const CppAD::vector<bool> &vx, CppAD::vector<bool> &vy,
+                            const CppAD::vector<double> &tx, CppAD::vector<double> &ty)
+{
+    if (q > 1)
+    {
+        return false;
+    }
+    if (vx.size() > 0)
+    {
+        Variables(vx, vy);
+    }
+    const size_t n_coeffs = NumCoeffs(), o = q + 1;
+    double c[MAX_COEFFS], d[4];
+    for (size_t k = 0; k < n_coeffs; k++)
+    {
+        c[k] = tx[(1 + k) * o];
+    }
+    const double x = tx[0];
+    derivatives(c, x, d);
+    if (p == 0)
+    {
+        ty[0] = d[0];
+#if CPPAD_FAST_MATH
+        ty[o] = CppAD::fast_math::atan(d[1]);
+#else
+        ty[o] = std::atan(d[1]);
+#endif
+    }
+    if (q == 1)
+    {
+        // First order: the Jacobian times the direction
+        double df = d[1] * tx[1], dg = d[2] * tx[1];
+        double xk = 1.0; // x^k
+        for (size_t k = 0; k < n_coeffs; k++)
+        {
+            df += xk * tx[(1 + k) * o + 1];
+            if (k + 1 < n_coeffs)
+            {
+                dg += (k + 1) * xk * tx[(2 + k) * o + 1];
+            }
+            xk *= x;
+        }
+        ty[1] = df;
+        ty[o + 1] = dg / (1.0 + d[1] * d[1]);
+    }
+    return true;
+}
+
+bool PolyRefAtomic::reverse(size_t q, const CppAD::vector<double> &tx, const CppAD::vector<double> &ty,
+                            CppAD::vector<double> &px, const CppAD::vector<double> &py)
+{
+    if (q > 1)
+    {
+        return false;
+    }
+    const size_t n_coeffs = NumCoeffs(), o = q + 1;
+    double c[MAX_COEFFS], d[4];
+    for (size_t k = 0; k < n_coeffs; k++)
+    {
+        c[k] = tx[(1 + k) * o];
+    }
+    const double x = tx[0];
+    derivatives(c, x, d);
+    const double g = d[1], g1 = d[2], g2 = d[3];
+    const double s = 1.0 / (1.0 + g * g);
+
+    // xk = x^k, dk = d f'/d c_k = k x^(k-1), ek = d f''/d c_k = k (k-1) x^(k-2)
+    double xk[MAX_COEFFS], dk[MAX_COEFFS], ek[MAX_COEFFS];
+    for (size_t k = 0; k < n_coeffs; k++)
+    {
+        xk[k] = k == 0 ? 1.0 : xk[k - 1] * x;
+        dk[k] = k >= 1 ? k * xk[k - 1] : 0.0;
+        ek[k] = k >= 2 ? k * (k - 1) * xk[k - 2] : 0.0;
+    }
+
+    // Order zero: the Jacobian transposed times the weights. Input 0 is
+    // x, input 1 + k is c_k.
+    const double wf = py[0], wh = py[o];
+    px[0] = wf * g + wh * s * g1;
+    for (size_t k = 0; k < n_coeffs; k++)
+    {
+        px[(1 + k) * o] = wf * xk[k] + wh * s * dk[k];
+    }
+    if (q == 0)
+    {
+        return true;
+    }
+
+    // Order one: the same for the first order weights, and for the order
+    // zero partials the Hessians of f and atan(f') times the direction.
+    //   f:        f_xx = f'',   f_xc = dk,   f_cc = 0
+    //   atan(f'): h_xx = f''' s + r f''^2,   h_xc = ek s + r f'' dk,
+    //             h_cc = r dk dl,            with r = d s / d f' = -2 f' s^2
+    const double vf = py[1], vh = py[o + 1];
+    px[1] = vf * g + vh * s * g1;
+    for (size_t k = 0; k < n_coeffs; k++)
+    {
+        px[(1 + k) * o + 1] = vf * xk[k] + vh * s * dk[k];
+    }
+    const double r = -2.0 * g * s * s;
+    const double dx = tx[1];
+    double dg = 0.0; // sum of dk dc_k
+    for (size_t k = 0; k < n_coeffs; k++)
+    {
+        dg += dk[k] * tx[(1 + k) * o + 1];
+    }
+    double hx = (g2 * s + r * g1 * g1) * dx;
+    for (size_t k = 0; k < n_coeffs; k++)
+    {
+        hx += (ek[k] * s + r * g1 * dk[k]) * tx[(1 + k) * o + 1];
+    }
+    px[0] += vf * (g1 * dx + dg) + vh * hx;
+    for (size_t k = 0; k < n_coeffs; k++)
+    {
+        const double hc = (ek[k] * s + r * g1 * dk[k]) * dx + r * dk[k] * dg;
+        px[(1 + k) * o] += vf * dk[k] * dx + vh * hc;
+    }
+    return true;
+}
@@ -1,85 +1,104 @@
 #include <nav_msgs/Odometry.h>
-#include <geometry_msgs/PoseWithCovarianceStamped.h>
-#include <tf/transform_broadcaster.h>
+#include <geometry_msgs/TransformStamped.h>
+#include <tf2_ros/transform_broadcaster.h>
 
 #include <ros/ros.h>
-
-
-class SubscribeAndPublish
+#include "latest_msg.h"
+
+
+// Relays the ground truth odometry of the simulation to /odom and
+// broadcasts it as the odom -> base_footprint transform.
+//
+// The message is forwarded as the ConstPtr it arrived in: as a nodelet in
+// the manager of the MPC nodelets it reaches them without a copy or
+// serialization. The transform is not sent per message but by a timer at
+// tf_rate, with the newest pose, so a 1 kHz ground truth does not turn
+// into 1 kHz of tf traffic. tf_rate 0 broadcasts every message as before.
+class RobotPosePublisher
 {
 public:
-  SubscribeAndPublish()
-  {
-    //Topic you want to publish
-    odom_pub = _nodeHandle.advertise<nav_msgs::Odometry>("/odom", 1);
-
-    //Topic you want to subscribe
-    odomSub_ = _nodeHandle.subscribe("/ground_truth", 1, &SubscribeAndPublish::groundTruthCallback, this);
-
-    // _sub_odom   = _nh.subscribe("odom", 1, &MPCPlannerROS::odomCB, this);
-    //     _pub_mpctraj   = _nh.advertise<nav_msgs::Path>("mpc_trajectory", 1);// MPC trajectory output
-  }
-
-  void groundTruthCallback (const nav_msgs::Odometry::ConstPtr& msg)
-  {
-    odom_pub.publish(msg);
-	  static tf::TransformBroadcaster br;
-    tf::Transform o_transform_b;
-
-    // orientation
-    tf::Quaternion baseOrientation;
-    baseOrientation.setX(msg->pose.pose.orientation.x);
-    baseOrientation.setY(msg->pose.pose.orientation.y);
-    baseOrientation.setZ(msg->pose.pose.orientation.z);
-    baseOrientation.setW(msg->pose.pose.orientation.w);
-
-    // translation
-    tf::Vector3 translationWorldToBaseFootprint(msg->pose.pose.position.x, msg->pose.pose.position.y, 0.0);
-
-    // transform from world -> base_footprint
-    o_transform_b.setRotation(baseOrientation);
-    o_transform_b.setOrigin(translationWorldToBaseFootprint);
-    br.sendTransform(tf::StampedTransform(o_transform_b, msg->header.stamp, "odom", "base_footprint"));
-  }
+    RobotPosePublisher(ros::NodeHandle nh = ros::NodeHandle(), ros::NodeHandle pn = ros::NodeHandle("~"))
+        : _nh(nh), _last_stamp(0.0)
+    {
+        std::string odom_frame, base_frame;
+        double tf_rate;
+        pn.param<std::string>("odom_frame", odom_frame, "odom");
+        pn.param<std::string>("base_frame", base_frame, "base_footprint");
+        pn.param("tf_rate", tf_rate, 50.0); // transforms per second, 0 for every message
+        _transform.header.frame_id = odom_frame;
+        _transform.child_frame_id = base_frame;
+
+        //Topic you want to publish
+        _odom_pub = _nh.advertise<nav_msgs::Odometry>("/odom", 1);
+
+        //Topic you want to subscribe
+        _odom_sub = _nh.subscribe("/ground_truth", 1, &RobotPosePublisher::groundTruthCallback, this,
+                                  ros::TransportHints().tcpNoDelay());
+
+        if(tf_rate > 0.0)
+            _tf_timer = _nh.createTimer(ros::Duration(1.0 / tf_rate), &RobotPosePublisher::broadcastCallback, this);
+    }
 
 private:
-  ros::NodeHandle _nodeHandle;
-  ros::Publisher odom_pub;
-  ros::Subscriber odomSub_;
-
+    void groundTruthCallback(const nav_msgs::Odometry::ConstPtr& msg)
+    {
+        _odom_pub.publish(msg);
+        if(_tf_timer)
+            _odom.Set(msg);
+        else
+            broadcast(*msg);
+    }
+
+    // Newest pose, unless it was sent already
+    void broadcastCallback(const ros::TimerEvent&)
+    {
+        nav_msgs::Odometry::ConstPtr msg = _odom.Get();
+        if(!msg || msg->header.stamp.toSec() == _last_stamp)
+            return;
+        _last_stamp = msg->header.stamp.toSec();
+        broadcast(*msg);
+    }
+
+    // transform from world -> base_footprint, in the plane
+    void broadcast(const nav_msgs::Odometry &odom)
+    {
+        _transform.header.stamp = odom.header.stamp;
+        _transform.transform.translation.x = odom.pose.pose.position.x;
+        _transform.transform.translation.y = odom.pose.pose.position.y;
+        _transform.transform.translation.z = 0.0;
+        _transform.transform.rotation = odom.pose.pose.orientation;
+        _broadcaster.sendTransform(_transform);
+    }
+
+    ros::NodeHandle _nh;
+    ros::Publisher _odom_pub;
+    tf2_ros::TransformBroadcaster _broadcaster;
+    geometry_msgs::TransformStamped _transform; // frames set once, only the broadcasting thread writes it
+    LatestMsg<nav_msgs::Odometry> _odom;
+    double _last_stamp;
+
+    // Declared last: their callbacks stop before the members above go away
+    ros::Subscriber _odom_sub;
+    ros::Timer _tf_timer;
 };
 
-// void groundTruthCallback (const nav_msgs::Odometry::ConstPtr& msg)
-// {
-//   odom_pub.publish(msg);
-// 	static tf::TransformBroadcaster br;
-//   tf::Transform o_transform_b;
+#ifdef MPC_NODELET
+#include <pluginlib/class_list_macros.h>
+#include "controller_nodelet.h"
 
-//   // orientation
-//   tf::Quaternion baseOrientation;
-//   baseOrientation.setX(msg->pose.pose.orientation.x);
-//   baseOrientation.setY(msg->pose.pose.orientation.y);
-//   baseOrientation.setZ(msg->pose.pose.orientation.z);
-//   baseOrientation.setW(msg->pose.pose.orientation.w);
-
-//   // translation
-//   tf::Vector3 translationWorldToBaseFootprint(msg->pose.pose.position.x, msg->pose.pose.position.y, 0.0);
+namespace mpc_ros
+{
+    class RobotPoseNodelet : public ControllerNodelet<RobotPosePublisher> {};
+}
+PLUGINLIB_EXPORT_CLASS(mpc_ros::RobotPoseNodelet, nodelet::Nodelet)
 
-//   // transform from world -> base_footprint
-//   o_transform_b.setRotation(baseOrientation);
-//   o_transform_b.setOrigin(translationWorldToBaseFootprint);
-//   br.sendTransform(tf::StampedTransform(o_transform_b, msg->header.stamp, "odom", "base_footprint"));
-// }
+#else
 
 int main(int argc, char** argv)
 {
-  ros::init(argc, argv, "publish_robot_pose");
-  
-  
-  // ros::Subscriber odomSub_ = nodeHandle.subscribe("/ground_truth", 1, groundTruthCallback);
-  SubscribeAndPublish SAPObject;
-  
-	ros::spin();
-  
-  return 0;
+    ros::init(argc, argv, "publish_robot_pose");
+    RobotPosePublisher publisher;
+    ros::spin();
+    return 0;
 }
+#endif /* MPC_NODELET */
@@ -0,0 +1,159 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "realtime.h"
+#include <alloca.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sstream>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace
+{
+    std::size_t pageSize()
+    {
+        const long page = sysconf(_SC_PAGESIZE);
+        return (page > 0) ? std::size_t(page) : 4096;
+    }
+
+    void appendError(std::string &report, const char *step, int err, const char *privilege)
+    {
+        std::ostringstream os;
+        os << step << ": " << std::strerror(err);
+        if ((err == EPERM || err == ENOMEM) && privilege != nullptr)
+            os << " (needs " << privilege << ")";
+        if (!report.empty())
+            report += "; ";
+        report += os.str();
+    }
+
+    // Touch every page of a block on this stack, the frame is dropped again
+    // on return but its pages stay mapped
+    void __attribute__((noinline)) prefaultStack(std::size_t bytes)
+    {
+        volatile unsigned char *stack = static_cast<volatile unsigned char*>(alloca(bytes));
+        const std::size_t page = pageSize();
+        for (std::size_t i = 0; i < bytes; i += page)
+            stack[i] = 0;
+    }
+}
+
+RealtimeSettings::RealtimeSettings()
+{
+    _priority = 0;
+    _prefault_stack = 0;
+}
+
+void RealtimeSettings::Configure(int priority, const std::string &cpus, std::size_t prefault_stack_kb)
+{
+    const int max_priority = sched_get_priority_max(SCHED_FIFO);
+    _priority = (priority > 0) ? std::min(priority, max_priority) : 0;
+    _cpus = ParseCpus(cpus);
+    _prefault_stack = prefault_stack_kb * 1024;
+}
+
+bool RealtimeSettings::Apply(std::string &report) const
+{
+    bool ok = true;
+    if (!_cpus.empty())
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : _cpus)
+            CPU_SET(cpu, &set);
+        const int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        if (err != 0)
+        {
+            appendError(report, "CPU affinity", err, nullptr);
+            ok = false;
+        }
+    }
+    if (_priority > 0)
+    {
+        sched_param param;
+        param.sched_priority = _priority;
+        const int err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (err != 0)
+        {
+            appendError(report, "SCHED_FIFO", err, "CAP_SYS_NICE or RLIMIT_RTPRIO");
+            ok = false;
+        }
+    }
+    if (_prefault_stack > 0)
+        prefaultStack(_prefault_stack);
+    return ok;
+}
+
+bool RealtimeSettings::LockMemory(std::size_t heap_mb, std::string &report)
+{
+    bool ok = true;
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        appendError(report, "mlockall", errno, "CAP_IPC_LOCK or a larger RLIMIT_MEMLOCK");
+        ok = false;
+    }
+
+    if (heap_mb > 0)
+    {
+        // Freed blocks stay in the heap instead of being trimmed or unmapped,
+        // so the prefaulted pages are the ones handed out later
+        mallopt(M_TRIM_THRESHOLD, -1);
+        mallopt(M_MMAP_MAX, 0);
+        const std::size_t bytes = heap_mb * 1024 * 1024;
+        unsigned char *heap = static_cast<unsigned char*>(std::malloc(bytes));
+        if (heap == nullptr)
+        {
+            appendError(report, "heap prefault", ENOMEM, nullptr);
+            return false;
+        }
+        const std::size_t page = pageSize();
+        for (std::size_t i = 0; i < bytes; i += page)
+            heap[i] = 0;
+        std::free(heap);
+    }
+    return ok;
+}
+
+std::vector<int> RealtimeSettings::ParseCpus(const std::string &cpus)
+{
+    std::vector<int> result;
+    std::stringstream ss(cpus);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        int first, last;
+        char dash;
+        std::stringstream range(item);
+        if (!(range >> first))
+            continue;
+        last = first;
+        if (range >> dash)
+        {
+            if (dash != '-' || !(range >> last))
+                continue;
+        }
+        for (int cpu = first; cpu <= last; cpu++)
+            if (cpu >= 0 && cpu < CPU_SETSIZE)
+                result.push_back(cpu);
+    }
+    return result;
+}
@@ -0,0 +1,93 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "reduced_state.h"
+
+namespace reduced_state
+{
+    void ReduceVars(int steps, const Dvector &full, Dvector &reduced)
+    {
+        const size_t states = 4 * steps, errors = 2 * steps;
+        reduced.resize(full.size() - errors);
+        for (size_t i = 0; i < states; i++)
+        {
+            reduced[i] = full[i];
+        }
+        for (size_t i = states; i < reduced.size(); i++)
+        {
+            reduced[i] = full[i + errors];
+        }
+    }
+
+    void ReduceRows(int steps, const Dvector &full, Dvector &reduced)
+    {
+        reduced.resize(4 * steps);
+        for (size_t i = 0; i < reduced.size(); i++)
+        {
+            reduced[i] = full[i];
+        }
+    }
+
+    void ExpandSolution(int steps, const SolveResult &reduced, const Dvector &cte, const Dvector &etheta,
+                        SolveResult &full)
+    {
+        const size_t states = 4 * steps, errors = 2 * steps;
+        full.status = reduced.status;
+        full.obj_value = reduced.obj_value;
+        full.x.resize(0);
+        full.zl.resize(0);
+        full.zu.resize(0);
+        full.g.resize(0);
+        full.lambda.resize(0);
+        if (reduced.x.size() < states)
+        {
+            return;
+        }
+
+        const size_t n_vars = reduced.x.size() + errors;
+        const bool multipliers = reduced.zl.size() == reduced.x.size() && reduced.zu.size() == reduced.x.size();
+        full.x.resize(n_vars);
+        full.zl.resize(n_vars);
+        full.zu.resize(n_vars);
+        for (size_t i = 0; i < n_vars; i++)
+        {
+            const bool error = i >= states && i < states + errors;
+            const size_t k = i < states ? i : i - errors;
+            if (!error)
+            {
+                full.x[i] = reduced.x[k];
+            }
+            full.zl[i] = !error && multipliers ? reduced.zl[k] : 0;
+            full.zu[i] = !error && multipliers ? reduced.zu[k] : 0;
+        }
+        for (int i = 0; i < steps; i++)
+        {
+            full.x[states + i] = cte[i];
+            full.x[states + steps + i] = etheta[i];
+        }
+
+        full.g.resize(states + errors);
+        full.lambda.resize(states + errors);
+        for (size_t i = 0; i < states + errors; i++)
+        {
+            full.g[i] = i < states && reduced.g.size() == states ? reduced.g[i] : 0;
+            full.lambda[i] = i < states && reduced.lambda.size() == states ? reduced.lambda[i] : 0;
+        }
+        full.g[states] = cte[0];
+        full.g[states + steps] = etheta[0];
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include <string>
+
+#include "ros/ros.h"
+#include <nav_msgs/Odometry.h>
+#include <nav_msgs/Path.h>
+#include <boost/make_shared.hpp>
+
+#include "reference_trajectory.h"
+#include "path_index.h"
+
+using namespace std;
+
+/********************/
+/* CLASS DEFINITION */
+/********************/
+// Publishes the reference trajectory of the tracking demo, in place of
+// script/mpc_trajectory_generation.py. The trajectory is sampled once (see
+// reference_trajectory.h) and latched whole on desired_path_full; on
+// desired_path only the window ahead of the robot goes out, and only when
+// the robot has moved on to another pose of it.
+class ReferenceGeneratorNode
+{
+    public:
+        ReferenceGeneratorNode(ros::NodeHandle nh = ros::NodeHandle(), ros::NodeHandle pn = ros::NodeHandle("~"));
+
+    private:
+        void odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg);
+
+        ros::NodeHandle _nh;
+        ros::Subscriber _sub_odom;
+        ros::Publisher _pub_window, _pub_full;
+
+        ReferenceTrajectory _trajectory;
+        PathIndex _index;
+        std::string _frame;
+        double _window_length;
+        long _published; // start of the last window, -1 before the first
+};
+
+ReferenceGeneratorNode::ReferenceGeneratorNode(ros::NodeHandle nh, ros::NodeHandle pn) : _nh(nh), _index(50, 1.0)
+{
+    std::string type;
+    double spacing, scale;
+    pn.param<std::string>("trajectory_type", type, "circle"); // circle, epitrochoid, square or infinite
+    pn.param("spacing", spacing, 0.05); // between the poses [m]
+    pn.param("scale", scale, 1.0);
+    pn.param("window_length", _window_length, 4.0); // of desired_path [m], longer than path_length of the tracking node
+    pn.param<std::string>("frame_id", _frame, "odom");
+    _published = -1;
+
+    if(!_trajectory.Generate(type, spacing, scale))
+    {
+        ROS_ERROR("Unknown trajectory_type %s", type.c_str());
+        return;
+    }
+    ROS_INFO("Reference %s: %zu poses over %.2f m", type.c_str(), _trajectory.Size(), _trajectory.Length());
+
+    const ros::Time now = ros::Time::now();
+    boost::shared_ptr<CompactPath> indexed = boost::make_shared<CompactPath>();
+    _trajectory.Full(_frame, now, *indexed);
+    _index.Set(indexed);
+    nav_msgs::PathPtr full = boost::make_shared<nav_msgs::Path>();
+    _trajectory.Full(_frame, now, *full);
+
+    _pub_full = _nh.advertise<nav_msgs::Path>("desired_path_full", 1, true);
+    _pub_full.publish(full);
+    _pub_window = _nh.advertise<nav_msgs::Path>("desired_path", 1, true); // latched for a robot standing still
+    _sub_odom = _nh.subscribe("odom", 1, &ReferenceGeneratorNode::odomCB, this);
+}
+
+// CallBack: move the window along with the robot
+void ReferenceGeneratorNode::odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg)
+{
+    if(_trajectory.Empty())
+        return;
+    const long start = _index.Nearest(odomMsg->pose.pose.position.x, odomMsg->pose.pose.position.y);
+    if(start == _published)
+        return;
+    _published = start;
+
+    nav_msgs::PathPtr window = boost::make_shared<nav_msgs::Path>();
+    _trajectory.Window(start, _window_length, _frame, odomMsg->header.stamp, *window);
+    _pub_window.publish(window);
+}
+
+/*****************/
+/* MAIN FUNCTION */
+/*****************/
+int main(int argc, char **argv)
+{
+    //Initiate ROS
+    ros::init(argc, argv, "reference_generator");
+    ReferenceGeneratorNode generator;
+    ros::spin();
+    return 0;
+}
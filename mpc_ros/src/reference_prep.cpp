@@ -0,0 +1,95 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "reference_prep.h"
+#include "trace_span.h"
+
+ReferencePacket::ReferencePacket()
+{
+    stamp = 0.0;
+    px = py = theta = 0.0;
+    v = angvel = 0.0;
+    fitted = false;
+    cte = etheta = 0.0;
+}
+
+ReferencePrep::ReferencePrep()
+{
+    _running = false;
+    _pending = false;
+}
+
+ReferencePrep::~ReferencePrep()
+{
+    Stop();
+}
+
+void ReferencePrep::Start(const PrepFunction &prep)
+{
+    Stop();
+    _prep = prep;
+    _running = true;
+    _pending = true; // inputs may have arrived before
+    _thread = std::thread(&ReferencePrep::Run, this);
+}
+
+void ReferencePrep::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _running = false;
+    }
+    _cond.notify_all();
+    if (_thread.joinable())
+        _thread.join();
+}
+
+bool ReferencePrep::IsRunning() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _running;
+}
+
+void ReferencePrep::Notify()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending = true;
+    }
+    _cond.notify_one();
+}
+
+void ReferencePrep::Run()
+{
+    MPC_TRACE_THREAD("mpc_reference");
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _cond.wait(lock, [this] { return _pending || !_running; });
+        if (!_running)
+            break;
+        _pending = false;
+
+        // Prepare without holding the lock so the callbacks never wait
+        lock.unlock();
+        {
+            MPC_TRACE_SPAN("reference_prep");
+            if (_prep(_mailbox.Back()))
+                _mailbox.Publish();
+        }
+        lock.lock();
+    }
+}
@@ -0,0 +1,187 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "reference_trajectory.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Dense samples of the curve parameter for the arc length table
+    const int DENSE = 20000;
+
+    // Position at u in [0, 1), one lap; the curves and constants of
+    // script/mpc_trajectory_generation.py
+    bool curve(const std::string &type, double u, double &x, double &y)
+    {
+        const double a = 2.0 * M_PI * u;
+        if (type == "circle")
+        {
+            const double radius = 5.0;
+            x = radius * std::sin(a);
+            y = -radius * std::cos(a);
+        }
+        else if (type == "epitrochoid")
+        {
+            const double R = 5.0, r = 1.0, d = 3.0;
+            x = (R + r) * std::cos(a) - d * std::cos((R + r) / r * a);
+            y = (R + r) * std::sin(a) - d * std::sin((R + r) / r * a);
+        }
+        else if (type == "infinite" || type == "infinity")
+        {
+            const double s = std::sin(a);
+            x = 10.0 * std::cos(a) / (s * s + 1.0);
+            y = 10.0 * s * std::cos(a) / (s * s + 1.0);
+        }
+        else if (type == "square")
+        {
+            // Side 10 counterclockwise from the origin: up, left, down, right
+            const double side = 10.0;
+            const double p = 4.0 * u;
+            const int k = std::min(int(p), 3);
+            const double t = side * (p - k);
+            const double xs[] = {0.0, -t, -side, -side + t};
+            const double ys[] = {t, side, side - t, 0.0};
+            x = xs[k];
+            y = ys[k];
+        }
+        else
+            return false;
+        return true;
+    }
+}
+
+ReferenceTrajectory::ReferenceTrajectory()
+{
+    _spacing = 0.0;
+}
+
+bool ReferenceTrajectory::Generate(const std::string &type, double spacing, double scale)
+{
+    _x.clear();
+    _y.clear();
+    _theta.clear();
+    double x, y;
+    if (!curve(type, 0.0, x, y) || spacing <= 0.0)
+        return false;
+
+    // Arc length of the dense samples, the last one closes the loop
+    std::vector<double> u(DENSE + 1), s(DENSE + 1);
+    double px = scale * x, py = scale * y;
+    s[0] = 0.0;
+    for (int i = 1; i <= DENSE; i++)
+    {
+        u[i] = double(i) / DENSE;
+        curve(type, u[i] < 1.0 ? u[i] : 0.0, x, y);
+        s[i] = s[i - 1] + std::hypot(scale * x - px, scale * y - py);
+        px = scale * x;
+        py = scale * y;
+    }
+    u[0] = 0.0;
+
+    // Poses at whole multiples of the spacing, the lap length rounded to them
+    const int n = std::max(int(std::round(s[DENSE] / spacing)), 2);
+    _spacing = s[DENSE] / n;
+    _x.resize(n);
+    _y.resize(n);
+    int j = 0;
+    for (int i = 0; i < n; i++)
+    {
+        const double target = i * _spacing;
+        while (j < DENSE - 1 && s[j + 1] < target)
+            j++;
+        const double ds = s[j + 1] - s[j];
+        const double ui = u[j] + (ds > 0.0 ? (target - s[j]) / ds : 0.0) * (u[j + 1] - u[j]);
+        curve(type, ui, x, y);
+        _x[i] = scale * x;
+        _y[i] = scale * y;
+    }
+
+    // Heading toward the next pose, so corners turn at the corner pose
+    _theta.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        const int next = (i + 1) % n;
+        _theta[i] = std::atan2(_y[next] - _y[i], _x[next] - _x[i]);
+    }
+    return true;
+}
+
+void ReferenceTrajectory::Full(const std::string &frame, const ros::Time &stamp, nav_msgs::Path &path) const
+{
+    path.header.frame_id = frame;
+    path.header.stamp = stamp;
+    path.poses.resize(_x.size());
+    for (size_t i = 0; i < _x.size(); i++)
+        pose(i, frame, stamp, path.poses[i]);
+}
+
+void ReferenceTrajectory::Full(const std::string &frame, const ros::Time &stamp, CompactPath &path) const
+{
+    path.SetFrame(frame);
+    path.SetStamp(stamp);
+    path.Clear();
+    path.Reserve(_x.size());
+    for (size_t i = 0; i < _x.size(); i++)
+        path.PushBack(_x[i], _y[i], _theta[i]);
+}
+
+void ReferenceTrajectory::Window(size_t start, double length, const std::string &frame, const ros::Time &stamp,
+                                 nav_msgs::Path &path) const
+{
+    path.header.frame_id = frame;
+    path.header.stamp = stamp;
+    const size_t count = windowSize(length);
+    path.poses.resize(count);
+    for (size_t k = 0; k < count; k++)
+        pose((start + k) % _x.size(), frame, stamp, path.poses[k]);
+}
+
+void ReferenceTrajectory::Window(size_t start, double length, const std::string &frame, const ros::Time &stamp,
+                                 CompactPath &path) const
+{
+    path.SetFrame(frame);
+    path.SetStamp(stamp);
+    path.Clear();
+    const size_t count = windowSize(length);
+    path.Reserve(count);
+    for (size_t k = 0; k < count; k++)
+    {
+        const size_t i = (start + k) % _x.size();
+        path.PushBack(_x[i], _y[i], _theta[i]);
+    }
+}
+
+size_t ReferenceTrajectory::windowSize(double length) const
+{
+    if (_x.empty())
+        return 0;
+    return std::min(_x.size(), size_t(std::ceil(length / _spacing)) + 1);
+}
+
+void ReferenceTrajectory::pose(size_t i, const std::string &frame, const ros::Time &stamp,
+                               geometry_msgs::PoseStamped &pose) const
+{
+    pose.header.frame_id = frame;
+    pose.header.stamp = stamp;
+    pose.pose.position.x = _x[i];
+    pose.pose.position.y = _y[i];
+    pose.pose.position.z = 0.0;
+    pose.pose.orientation.x = 0.0;
+    pose.pose.orientation.y = 0.0;
+    pose.pose.orientation.z = std::sin(0.5 * _theta[i]);
+    pose.pose.orientation.w = std::cos(0.5 * _theta[i]);
+}
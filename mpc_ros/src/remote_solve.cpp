@@ -0,0 +1,271 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "remote_solve.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+namespace remote_solve
+{
+    bool EncodeParams(const std::map<std::string, double> &params, Params &packet)
+    {
+        size_t size = 0;
+        for (std::map<std::string, double>::const_iterator it = params.begin(); it != params.end(); ++it)
+        {
+            const int n = snprintf(packet.text + size, MAX_PARAMS_TEXT - size, "%s=%.17g\n",
+                                   it->first.c_str(), it->second);
+            if (n < 0 || size + n >= size_t(MAX_PARAMS_TEXT))
+                return false;
+            size += n;
+        }
+        packet.size = size;
+        return true;
+    }
+
+    bool DecodeParams(const Params &packet, size_t length, std::map<std::string, double> &params)
+    {
+        const size_t text_begin = offsetof(Params, text);
+        if (length < text_begin || packet.size > length - text_begin || packet.size > size_t(MAX_PARAMS_TEXT))
+            return false;
+        params.clear();
+        const char *p = packet.text, *end = packet.text + packet.size;
+        while (p < end)
+        {
+            const char *eol = std::find(p, end, '\n');
+            const char *eq = std::find(p, eol, '=');
+            if (eq == eol || eq == p)
+                return false;
+            const std::string value(eq + 1, eol);
+            char *parsed;
+            const double v = strtod(value.c_str(), &parsed);
+            if (parsed == value.c_str())
+                return false;
+            params[std::string(p, eq)] = v;
+            p = eol + 1;
+        }
+        return true;
+    }
+
+    void SetRobotId(Header &header, const std::string &robot_id)
+    {
+        memset(header.robot_id, 0, sizeof(header.robot_id));
+        strncpy(header.robot_id, robot_id.c_str(), sizeof(header.robot_id) - 1);
+    }
+
+    bool Valid(const Header &header, uint32_t type)
+    {
+        return header.magic == MAGIC && header.type == type
+            && memchr(header.robot_id, 0, sizeof(header.robot_id)) != NULL && header.robot_id[0] != 0;
+    }
+}
+
+using namespace remote_solve;
+
+RemoteSolveClient::RemoteSolveClient()
+    : _socket(-1), _seq(0), _acked_version(0), _sent_version(0), _miss_streak(0), _last_rtt_ms(0),
+      _window(0), _window_max(0), _last_window_max(0)
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+RemoteSolveClient::~RemoteSolveClient()
+{
+    if (_socket >= 0)
+        close(_socket);
+}
+
+bool RemoteSolveClient::Open(const std::string &address, const std::string &robot_id)
+{
+    const size_t colon = address.rfind(':');
+    if (colon == std::string::npos || robot_id.empty() || robot_id.size() >= sizeof(Header().robot_id))
+    {
+        _error = "expected host:port and a robot id of at most 31 characters";
+        return false;
+    }
+    const std::string host = address.substr(0, colon), port = address.substr(colon + 1);
+
+    addrinfo hints, *found = NULL;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+    const int err = getaddrinfo(host.c_str(), port.c_str(), &hints, &found);
+    if (err != 0)
+    {
+        _error = gai_strerror(err);
+        return false;
+    }
+    // Connected, so that only datagrams of the server are received
+    for (addrinfo *ai = found; ai && _socket < 0; ai = ai->ai_next)
+    {
+        _socket = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (_socket >= 0 && connect(_socket, ai->ai_addr, ai->ai_addrlen) != 0)
+        {
+            _error = strerror(errno);
+            close(_socket);
+            _socket = -1;
+        }
+    }
+    freeaddrinfo(found);
+    if (_socket < 0)
+        return false;
+    fcntl(_socket, F_SETFL, fcntl(_socket, F_GETFL, 0) | O_NONBLOCK);
+    _robot_id = robot_id;
+    _error.clear();
+    return true;
+}
+
+bool RemoteSolveClient::sendParams(const std::map<std::string, double> &params, unsigned long version)
+{
+    Params packet;
+    packet.header.magic = MAGIC;
+    packet.header.type = PARAMS;
+    SetRobotId(packet.header, _robot_id);
+    packet.header.seq = _seq;
+    packet.header.params_version = version;
+    if (!EncodeParams(params, packet))
+    {
+        _error = "the parameters do not fit in one datagram";
+        return false;
+    }
+    const size_t length = offsetof(Params, text) + packet.size;
+    return send(_socket, &packet, length, 0) == ssize_t(length);
+}
+
+bool RemoteSolveClient::receive(Reply &reply, double &rtt_ms)
+{
+    for (;;)
+    {
+        const ssize_t length = recv(_socket, &reply, sizeof(reply), 0);
+        if (length < 0)
+            return false; // EAGAIN, or an ICMP error of the last send
+        if (length == ssize_t(sizeof(reply)) && Valid(reply.header, REPLY) && _seq - reply.header.seq < 64)
+        {
+            rtt_ms = std::chrono::duration<double, std::milli>(Clock::now() - _sent_at[reply.header.seq % 64]).count();
+            return true;
+        }
+    }
+}
+
+void RemoteSolveClient::addRtt(double rtt_ms)
+{
+    _stats.rtt_ms = _stats.replies == 0 ? rtt_ms : 0.9 * _stats.rtt_ms + 0.1 * rtt_ms;
+    _stats.replies++;
+    // Largest of the last 100 to 200 replies
+    _window_max = std::max(_window_max, rtt_ms);
+    _stats.rtt_max_ms = std::max(_last_window_max, _window_max);
+    if (++_window == 100)
+    {
+        _last_window_max = _window_max;
+        _window = 0;
+        _window_max = 0;
+    }
+}
+
+void RemoteSolveClient::addLate(const Reply &reply, double rtt_ms)
+{
+    _stats.late++;
+    addRtt(rtt_ms);
+    if (reply.result == UNKNOWN_PARAMS)
+        _acked_version = 0;
+    else if (reply.header.params_version == _sent_version)
+        _acked_version = _sent_version;
+}
+
+bool RemoteSolveClient::Solve(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs,
+                              const std::map<std::string, double> &params, unsigned long version,
+                              double timeout, Reply &reply)
+{
+    if (_socket < 0 || state.size() < 6 || coeffs.size() > MAX_COEFFS)
+        return false;
+
+    // Replies of earlier requests that came too late, they still tell
+    // whether the server has the parameters
+    double rtt_ms;
+    while (receive(reply, rtt_ms))
+        addLate(reply, rtt_ms);
+
+    if (version != _acked_version && !sendParams(params, version))
+        return false;
+    _sent_version = version;
+
+    Request request;
+    memset(&request, 0, sizeof(request));
+    request.header.magic = MAGIC;
+    request.header.type = REQUEST;
+    SetRobotId(request.header, _robot_id);
+    request.header.seq = ++_seq;
+    request.header.params_version = version;
+    for (int i = 0; i < 6; i++)
+        request.state[i] = state[i];
+    for (int i = 0; i < coeffs.size(); i++)
+        request.coeffs[i] = coeffs[i];
+    request.n_coeffs = coeffs.size();
+    request.deadline = timeout;
+    const Clock::time_point sent = Clock::now();
+    _sent_at[_seq % 64] = sent;
+    if (send(_socket, &request, sizeof(request), 0) != ssize_t(sizeof(request)))
+        return false;
+    _stats.sent++;
+
+    // Wait for the reply of this request, after a streak of misses only
+    // on every MISS_STREAK-th request to see if the server is back
+    const bool wait = _miss_streak < MISS_STREAK || _miss_streak % MISS_STREAK == 0;
+    const Clock::time_point until = sent + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(wait ? timeout : 0.0));
+    bool answered = false;
+    while (!answered)
+    {
+        while (!answered && receive(reply, rtt_ms))
+        {
+            if (reply.header.seq != _seq)
+            {
+                addLate(reply, rtt_ms);
+                continue;
+            }
+            addRtt(rtt_ms);
+            answered = true;
+            _acked_version = reply.result == UNKNOWN_PARAMS ? 0 : version;
+            if (reply.result == SOLVED || reply.result == FALLBACK)
+            {
+                _miss_streak = 0;
+                _last_rtt_ms = rtt_ms;
+                return true;
+            }
+        }
+        const Clock::time_point now = Clock::now();
+        if (answered || now >= until)
+            break;
+        pollfd fd;
+        fd.fd = _socket;
+        fd.events = POLLIN;
+        const int wait_ms = std::max(1, int(std::chrono::duration<double, std::milli>(until - now).count()));
+        poll(&fd, 1, wait_ms);
+    }
+    _stats.misses++;
+    _miss_streak++;
+    return false;
+}
@@ -0,0 +1,191 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "replay_metrics.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    double percentile(std::vector<double> values, double p)
+    {
+        if (values.empty())
+            return 0.0;
+        // Nearest rank
+        std::sort(values.begin(), values.end());
+        const int k = (int)std::ceil(p * values.size()) - 1;
+        return values[std::min(std::max(k, 0), (int)values.size() - 1)];
+    }
+
+    void meanMax(const std::vector<double> &values, const std::string &name,
+                 std::map<std::string, double> &summary)
+    {
+        if (values.empty())
+            return;
+        double sum = 0.0, max = 0.0;
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            sum += values[i];
+            max = std::max(max, values[i]);
+        }
+        summary[name + "_mean"] = sum / values.size();
+        summary[name + "_max"] = max;
+    }
+}
+
+std::map<std::string, double> ReplayMetrics::Summary() const
+{
+    std::vector<double> latency, delta_v, delta_w, tracking;
+    double jump_v = 0.0, jump_w = 0.0;
+    int missed = 0;
+    const ReplayTick *last = NULL;
+    for (size_t i = 0; i < _ticks.size(); i++)
+    {
+        const ReplayTick &t = _ticks[i];
+        if (!std::isnan(t.tracking_error))
+            tracking.push_back(t.tracking_error);
+        if (!t.replied)
+        {
+            missed++;
+            continue;
+        }
+        latency.push_back(t.latency_ms);
+        if (!std::isnan(t.recorded_v))
+        {
+            delta_v.push_back(std::fabs(t.v - t.recorded_v));
+            delta_w.push_back(std::fabs(t.w - t.recorded_w));
+        }
+        if (last)
+        {
+            jump_v = std::max(jump_v, std::fabs(t.v - last->v));
+            jump_w = std::max(jump_w, std::fabs(t.w - last->w));
+        }
+        last = &t;
+    }
+
+    std::map<std::string, double> summary;
+    summary["ticks"] = _ticks.size();
+    summary["missed"] = missed;
+    summary["latency_p50_ms"] = percentile(latency, 0.5);
+    summary["latency_p95_ms"] = percentile(latency, 0.95);
+    summary["latency_max_ms"] = percentile(latency, 1.0);
+    meanMax(delta_v, "cmd_delta_v", summary);
+    meanMax(delta_w, "cmd_delta_w", summary);
+    summary["cmd_jump_v_max"] = jump_v;
+    summary["cmd_jump_w_max"] = jump_w;
+    meanMax(tracking, "tracking_error", summary);
+    return summary;
+}
+
+bool ReplayMetrics::WriteCsv(const std::string &path) const
+{
+    std::ofstream out(path.c_str());
+    if (!out)
+        return false;
+    out << "stamp,replied,latency_ms,v,w,recorded_v,recorded_w,tracking_error\n";
+    out.precision(9);
+    for (size_t i = 0; i < _ticks.size(); i++)
+    {
+        const ReplayTick &t = _ticks[i];
+        out << t.stamp << ',' << t.replied << ',' << t.latency_ms << ',' << t.v << ',' << t.w << ','
+            << t.recorded_v << ',' << t.recorded_w << ',' << t.tracking_error << '\n';
+    }
+    return bool(out);
+}
+
+bool WriteBaseline(const std::string &path, const std::map<std::string, double> &summary)
+{
+    std::ofstream out(path.c_str());
+    if (!out)
+        return false;
+    out << "# mpc_replay baseline, see include/replay_metrics.h\n";
+    out.precision(9);
+    for (std::map<std::string, double>::const_iterator it = summary.begin(); it != summary.end(); ++it)
+    {
+        out << it->first << ": " << it->second << '\n';
+    }
+    return bool(out);
+}
+
+bool ReadBaseline(const std::string &path, std::map<std::string, double> &baseline)
+{
+    std::ifstream in(path.c_str());
+    if (!in)
+        return false;
+    baseline.clear();
+    std::string line;
+    while (std::getline(in, line))
+    {
+        line = line.substr(0, line.find('#'));
+        const size_t colon = line.find(':');
+        if (colon == std::string::npos)
+            continue;
+        std::istringstream key(line.substr(0, colon)), value(line.substr(colon + 1));
+        std::string name;
+        double number;
+        if (key >> name && value >> number)
+            baseline[name] = number;
+    }
+    return true;
+}
+
+std::vector<std::string> CompareBaseline(const std::map<std::string, double> &summary,
+                                         const std::map<std::string, double> &baseline,
+                                         const std::map<std::string, ReplayTolerance> &tolerances)
+{
+    std::vector<std::string> failures;
+    for (std::map<std::string, double>::const_iterator it = baseline.begin(); it != baseline.end(); ++it)
+    {
+        const std::string &name = it->first;
+        if (name == "ticks")
+            continue;
+
+        ReplayTolerance tolerance = {0.0, 0.0};
+        size_t matched = 0;
+        bool found = false;
+        for (std::map<std::string, ReplayTolerance>::const_iterator t = tolerances.begin(); t != tolerances.end(); ++t)
+        {
+            const bool prefix = name.compare(0, t->first.size(), t->first) == 0;
+            if ((prefix && t->first.size() > matched) || (!found && t->first == "default"))
+            {
+                tolerance = t->second;
+                found = true;
+                matched = prefix ? t->first.size() : 0;
+            }
+        }
+
+        char line[256];
+        const std::map<std::string, double>::const_iterator current = summary.find(name);
+        if (current == summary.end())
+        {
+            std::snprintf(line, sizeof(line), "%s: missing (baseline %g)", name.c_str(), it->second);
+            failures.push_back(line);
+            continue;
+        }
+        const double limit = it->second + tolerance.relative * std::fabs(it->second) + tolerance.absolute;
+        if (current->second > limit)
+        {
+            std::snprintf(line, sizeof(line), "%s: %g > %g (baseline %g)", name.c_str(), current->second,
+                          limit, it->second);
+            failures.push_back(line);
+        }
+    }
+    return failures;
+}
@@ -0,0 +1,221 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "route_store.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdint.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    const char MAGIC[8] = { 'M', 'P', 'C', 'R', 'T', 'E', '1', '\0' };
+
+    struct FileHeader
+    {
+        char magic[8];
+        uint64_t size;
+        uint32_t closed, reserved;
+    };
+}
+
+RouteStore::RouteStore()
+    : _size(0), _closed(false), _x(NULL), _y(NULL), _yaw(NULL), _s(NULL), _map(NULL), _map_size(0)
+{
+}
+
+RouteStore::~RouteStore()
+{
+    Close();
+}
+
+bool RouteStore::Write(const std::string &path, const std::vector<double> &x, const std::vector<double> &y,
+                       const std::vector<double> &yaw, bool closed)
+{
+    const size_t n = x.size();
+    if (n < 2 || y.size() != n || yaw.size() != n)
+    {
+        return false;
+    }
+    std::vector<double> s(n, 0.0);
+    for (size_t i = 1; i < n; i++)
+    {
+        s[i] = s[i - 1] + std::hypot(x[i] - x[i - 1], y[i] - y[i - 1]);
+    }
+
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.size = n;
+    header.closed = closed ? 1 : 0;
+    std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(x.data()), n * sizeof(double));
+    file.write(reinterpret_cast<const char *>(y.data()), n * sizeof(double));
+    file.write(reinterpret_cast<const char *>(yaw.data()), n * sizeof(double));
+    file.write(reinterpret_cast<const char *>(s.data()), n * sizeof(double));
+    return file.good();
+}
+
+bool RouteStore::Open(const std::string &path)
+{
+    Close();
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    void *map = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(FileHeader))
+    {
+        map = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (map == MAP_FAILED)
+    {
+        return false;
+    }
+    _map = map;
+    _map_size = info.st_size;
+
+    // Check the header and that the arrays fill the rest of the file
+    const FileHeader *header = static_cast<const FileHeader *>(map);
+    const bool ok = std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) == 0 && header->size >= 2
+                    && _map_size == sizeof(FileHeader) + 4 * header->size * sizeof(double);
+    if (!ok)
+    {
+        Close();
+        return false;
+    }
+    _size = header->size;
+    _closed = header->closed != 0;
+    const double *data = reinterpret_cast<const double *>(static_cast<const char *>(map) + sizeof(FileHeader));
+    _x = data;
+    _y = data + _size;
+    _yaw = data + 2 * _size;
+    _s = data + 3 * _size;
+    return true;
+}
+
+void RouteStore::Close()
+{
+    if (_map)
+    {
+        munmap(_map, _map_size);
+    }
+    _map = NULL;
+    _map_size = 0;
+    _x = _y = _yaw = _s = NULL;
+    _size = 0;
+    _closed = false;
+}
+
+double RouteStore::Length() const
+{
+    if (!Valid())
+    {
+        return 0.0;
+    }
+    const double open = _s[_size - 1];
+    return _closed ? open + std::sqrt(sqDist(0, _x[_size - 1], _y[_size - 1])) : open;
+}
+
+size_t RouteStore::Nearest(double x, double y, size_t &hint, int window, double relocalize_dist) const
+{
+    if (!Valid())
+    {
+        return 0;
+    }
+    const size_t start = std::min(hint, _size - 1);
+    const size_t count = std::min(_size, size_t(std::max(window, 1)) + 1);
+    size_t best = start;
+    double best_sq = sqDist(start, x, y);
+    for (size_t k = 1; k < count; k++)
+    {
+        size_t i = start + k;
+        if (i >= _size)
+        {
+            if (!_closed)
+            {
+                break;
+            }
+            i -= _size;
+        }
+        const double sq = sqDist(i, x, y);
+        if (sq < best_sq)
+        {
+            best_sq = sq;
+            best = i;
+        }
+    }
+
+    // Moved, or a new route: the whole route
+    if (best_sq > relocalize_dist * relocalize_dist)
+    {
+        for (size_t i = 0; i < _size; i++)
+        {
+            const double sq = sqDist(i, x, y);
+            if (sq < best_sq)
+            {
+                best_sq = sq;
+                best = i;
+            }
+        }
+    }
+    hint = best;
+    return best;
+}
+
+size_t RouteStore::Slice(size_t start, double length) const
+{
+    if (!Valid() || start >= _size)
+    {
+        return 0;
+    }
+    if (!_closed)
+    {
+        // First pose past start + length, binary search on the arc length
+        const double *end = std::upper_bound(_s + start, _s + _size, _s[start] + length);
+        return std::min<size_t>(end - (_s + start) + 1, _size - start);
+    }
+
+    const double lap = Length();
+    if (length >= lap)
+    {
+        return _size;
+    }
+    // The same on the unrolled loop
+    const double target = _s[start] + length;
+    if (target <= _s[_size - 1])
+    {
+        const double *end = std::upper_bound(_s + start, _s + _size, target);
+        return std::min<size_t>(end - (_s + start) + 1, _size);
+    }
+    const double *end = std::upper_bound(_s, _s + start, target - lap);
+    return std::min<size_t>(_size - start + (end - _s) + 1, _size);
+}
+
+double RouteStore::sqDist(size_t i, double x, double y) const
+{
+    const double dx = _x[i] - x, dy = _y[i] - y;
+    return dx * dx + dy * dy;
+}
@@ -0,0 +1,519 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "rti_solver.h"
+#include <algorithm>
+#include <cmath>
+
+RtiSolver::RtiSolver()
+{
+    // Same defaults as FG_eval
+    _dt = 0.1;
+    _ref_cte = 0;
+    _ref_etheta = 0;
+    _ref_vel = 0.5;
+    _w_cte = 100;
+    _w_etheta = 100;
+    _w_vel = 1;
+    _w_angvel = 100;
+    _w_accel = 50;
+    _w_angvel_d = 0;
+    _w_accel_d = 0;
+    _max_angvel = 3.0;
+    _max_throttle = 1.0;
+    _mpc_steps = 40;
+    _qp_iterations = 0;
+    _sparse = false;
+    _sparse_steps = 0;
+    _sparse_warm = false;
+}
+
+void RtiSolver::LoadParams(const std::map<std::string, double> &params)
+{
+    _dt = params.find("DT") != params.end() ? params.at("DT") : _dt;
+    _mpc_steps = params.find("STEPS") != params.end() ? params.at("STEPS") : _mpc_steps;
+    _ref_cte = params.find("REF_CTE") != params.end() ? params.at("REF_CTE") : _ref_cte;
+    _ref_etheta = params.find("REF_ETHETA") != params.end() ? params.at("REF_ETHETA") : _ref_etheta;
+    _ref_vel = params.find("REF_V") != params.end() ? params.at("REF_V") : _ref_vel;
+    _w_cte = params.find("W_CTE") != params.end() ? params.at("W_CTE") : _w_cte;
+    _w_etheta = params.find("W_EPSI") != params.end() ? params.at("W_EPSI") : _w_etheta;
+    _w_vel = params.find("W_V") != params.end() ? params.at("W_V") : _w_vel;
+    _w_angvel = params.find("W_ANGVEL") != params.end() ? params.at("W_ANGVEL") : _w_angvel;
+    _w_accel = params.find("W_A") != params.end() ? params.at("W_A") : _w_accel;
+    _w_angvel_d = params.find("W_DANGVEL") != params.end() ? params.at("W_DANGVEL") : _w_angvel_d;
+    _w_accel_d = params.find("W_DA") != params.end() ? params.at("W_DA") : _w_accel_d;
+    _max_angvel = params.find("ANGVEL") != params.end() ? params.at("ANGVEL") : _max_angvel;
+    _max_throttle = params.find("MAXTHR") != params.end() ? params.at("MAXTHR") : _max_throttle;
+    _sparse = params.find("LTV") != params.end() ? params.at("LTV") != 0 : _sparse;
+
+    AdmmQp::Settings settings = _admm.GetSettings();
+    settings.eps_abs = params.find("QP_EPS") != params.end() ? params.at("QP_EPS") : settings.eps_abs;
+    settings.eps_rel = settings.eps_abs;
+    settings.max_iter = params.find("QP_MAX_ITER") != params.end() ? params.at("QP_MAX_ITER") : settings.max_iter;
+    _admm.SetSettings(settings);
+    if (params.find("ACTIVE_SET_MAX_ITER") != params.end())
+        _qp.SetMaxIterations(params.at("ACTIVE_SET_MAX_ITER"));
+    if (params.find("QP_REUSE_TOL") != params.end())
+        _qp.SetReuseTolerance(params.at("QP_REUSE_TOL"));
+    _sparse_steps = 0; // P holds the weights
+}
+
+void RtiSolver::model(const State &s, double w, double a, const Eigen::VectorXd &coeffs,
+                      State &next, StateMatrix *A, InputMatrix *B) const
+{
+    const double x = s[0], theta = s[2], v = s[3], etheta = s[5];
+
+    // Path value, slope and curvature term at x (Horner form)
+    double f = 0, df = 0, ddf = 0;
+    for (int k = coeffs.size() - 1; k >= 0; k--)
+    {
+        ddf = ddf * x + 2 * df;
+        df = df * x + f;
+        f = f * x + coeffs[k];
+    }
+
+    next[0] = x + v * cos(theta) * _dt;
+    next[1] = s[1] + v * sin(theta) * _dt;
+    next[2] = theta + w * _dt;
+    next[3] = v + a * _dt;
+    next[4] = (f - s[1]) + v * sin(etheta) * _dt;
+    next[5] = (theta - atan(df)) + w * _dt;
+
+    if (A)
+    {
+        A->setZero();
+        (*A)(0, 0) = 1;
+        (*A)(0, 2) = -v * sin(theta) * _dt;
+        (*A)(0, 3) = cos(theta) * _dt;
+        (*A)(1, 1) = 1;
+        (*A)(1, 2) = v * cos(theta) * _dt;
+        (*A)(1, 3) = sin(theta) * _dt;
+        (*A)(2, 2) = 1;
+        (*A)(3, 3) = 1;
+        (*A)(4, 0) = df;
+        (*A)(4, 1) = -1;
+        (*A)(4, 3) = sin(etheta) * _dt;
+        (*A)(4, 5) = v * cos(etheta) * _dt;
+        (*A)(5, 0) = -ddf / (1 + df * df);
+        (*A)(5, 2) = 1;
+    }
+    if (B)
+    {
+        B->setZero();
+        (*B)(2, 0) = _dt;
+        (*B)(3, 1) = _dt;
+        (*B)(5, 0) = _dt;
+    }
+}
+
+void RtiSolver::curvature(const State &s, const State &lambda, const Eigen::VectorXd &coeffs, StateMatrix &H) const
+{
+    const double x = s[0], theta = s[2], v = s[3], etheta = s[5];
+    double f = 0, df = 0, ddf = 0, dddf = 0;
+    for (int k = coeffs.size() - 1; k >= 0; k--)
+    {
+        dddf = dddf * x + 3 * ddf;
+        ddf = ddf * x + 2 * df;
+        df = df * x + f;
+        f = f * x + coeffs[k];
+    }
+    const double g = 1 + df * df;
+
+    // Second derivatives of the x, y, cte and etheta rows of model()
+    H.setZero();
+    H(2, 2) = -lambda[0] * v * cos(theta) * _dt - lambda[1] * v * sin(theta) * _dt;
+    H(2, 3) = -lambda[0] * sin(theta) * _dt + lambda[1] * cos(theta) * _dt;
+    H(0, 0) = lambda[4] * ddf - lambda[5] * (dddf * g - 2 * df * ddf * ddf) / (g * g);
+    H(3, 5) = lambda[4] * cos(etheta) * _dt;
+    H(5, 5) = -lambda[4] * v * sin(etheta) * _dt;
+    H(3, 2) = H(2, 3);
+    H(5, 3) = H(3, 5);
+}
+
+double RtiSolver::Cost(const std::vector<double> &vars) const
+{
+    const int N = _mpc_steps;
+    if ((int)vars.size() != NX * N + NU * (N - 1))
+        return 0;
+    const double *v = &vars[3 * N], *cte = &vars[4 * N], *etheta = &vars[5 * N];
+    const double *w = &vars[NX * N], *a = &vars[NX * N + N - 1];
+
+    double cost = 0;
+    for (int i = 0; i < N; i++)
+    {
+        cost += _w_cte * pow(cte[i] - _ref_cte, 2);
+        cost += _w_etheta * pow(etheta[i] - _ref_etheta, 2);
+        cost += _w_vel * pow(v[i] - _ref_vel, 2);
+    }
+    for (int i = 0; i < N - 1; i++)
+    {
+        cost += _w_angvel * w[i] * w[i];
+        cost += _w_accel * a[i] * a[i];
+    }
+    for (int i = 0; i < N - 2; i++)
+    {
+        cost += _w_angvel_d * pow(w[i + 1] - w[i], 2);
+        cost += _w_accel_d * pow(a[i + 1] - a[i], 2);
+    }
+    return cost;
+}
+
+bool RtiSolver::Step(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, std::vector<double> &vars)
+{
+    const int N = _mpc_steps;
+    const int n_vars = NX * N + NU * (N - 1);
+    _qp_iterations = 0;
+    if (N < 2 || state.size() != NX)
+        return false;
+
+    // Linearization point, stage-major: _s[k] = (x, y, theta, v, cte, etheta), _u[k] = (w, a)
+    _s.resize(N);
+    _u.resize(N - 1);
+    if ((int)vars.size() == n_vars)
+    {
+        for (int k = 0; k < N; k++)
+            for (int j = 0; j < NX; j++)
+                _s[k][j] = vars[j * N + k];
+        for (int k = 0; k < N - 1; k++)
+        {
+            _u[k][0] = std::min(std::max(vars[NX * N + k], -_max_angvel), _max_angvel);
+            _u[k][1] = std::min(std::max(vars[NX * N + N - 1 + k], -_max_throttle), _max_throttle);
+        }
+    }
+    else
+    {
+        _s[0] = state;
+        for (int k = 0; k < N - 1; k++)
+        {
+            _u[k].setZero();
+            model(_s[k], 0.0, 0.0, coeffs, _s[k + 1], NULL, NULL);
+        }
+    }
+
+    if (_sparse)
+        return stepSparse(state, coeffs, vars);
+
+    buildStages(coeffs);
+    Qp::VectorZ z0 = Qp::VectorZ::Zero();
+    z0.head<NX>() = state - _s[0];
+    _du.assign(N - 1, Qp::VectorU::Zero());
+    const bool ok = _qp.Solve(_stages, z0, _dz, _du);
+    _qp_iterations = _qp.Iterations();
+    if (!ok)
+    {
+        _dz.assign(N, Qp::VectorZ::Zero());
+        _du.assign(N - 1, Qp::VectorU::Zero());
+    }
+
+    // New iterate, states from the linearized prediction
+    vars.assign(n_vars, 0.0);
+    for (int k = 0; k < N; k++)
+        for (int j = 0; j < NX; j++)
+            vars[j * N + k] = _s[k][j] + _dz[k][j];
+    for (int k = 0; k < N - 1; k++)
+    {
+        vars[NX * N + k] = _u[k][0] + _du[k][0];
+        vars[NX * N + N - 1 + k] = _u[k][1] + _du[k][1];
+    }
+    return ok;
+}
+
+void RtiSolver::buildStages(const Eigen::VectorXd &coeffs)
+{
+    const int N = _mpc_steps;
+
+    // Stage-wise QP in the deviations from the linearization point. The
+    // Riccati state is z = (ds, du_prev): the previous input deviation is
+    // carried along for the input rate terms.
+    const Eigen::Matrix<double, NU, 1> wu(_w_angvel, _w_accel), wd(_w_angvel_d, _w_accel_d);
+    const Qp::MatrixUU Wu = wu.asDiagonal();
+    const Qp::MatrixUU Wd = wd.asDiagonal();
+    _stages.resize(N);
+    StateMatrix A;
+    InputMatrix B;
+    State next;
+    for (int k = 0; k < N; k++)
+    {
+        Qp::Stage &st = _stages[k];
+
+        // Tracking terms of v, cte and etheta
+        st.Q.setZero();
+        st.q.setZero();
+        st.Q(3, 3) = _w_vel;
+        st.Q(4, 4) = _w_cte;
+        st.Q(5, 5) = _w_etheta;
+        st.q[3] = _w_vel * (_s[k][3] - _ref_vel);
+        st.q[4] = _w_cte * (_s[k][4] - _ref_cte);
+        st.q[5] = _w_etheta * (_s[k][5] - _ref_etheta);
+        if (k == N - 1)
+            break;
+
+        model(_s[k], _u[k][0], _u[k][1], coeffs, next, &A, &B);
+        st.A.setZero();
+        st.A.topLeftCorner<NX, NX>() = A;
+        st.B.setZero();
+        st.B.topRows<NX>() = B;
+        st.B.bottomRows<NU>().setIdentity();
+        st.d.setZero();
+        st.d.head<NX>() = next - _s[k + 1];
+
+        // Input terms
+        st.R = Wu;
+        st.r = Wu * _u[k];
+        st.S.setZero();
+
+        // Input rate terms: 1/2 (delta + du - du_prev)' Wd (delta + du - du_prev)
+        if (k > 0)
+        {
+            const Qp::VectorU delta = _u[k] - _u[k - 1];
+            st.R += Wd;
+            st.r += Wd * delta;
+            st.Q.bottomRightCorner<NU, NU>() = Wd;
+            st.q.tail<NU>() = -Wd * delta;
+            st.S.rightCols<NU>() = -Wd;
+        }
+
+        st.lb << -_max_angvel - _u[k][0], -_max_throttle - _u[k][1];
+        st.ub << _max_angvel - _u[k][0], _max_throttle - _u[k][1];
+    }
+}
+
+bool RtiSolver::Sensitivity(const Eigen::VectorXd &coeffs, const double *vars, size_t n, PlanSensitivity &sens)
+{
+    const int N = _mpc_steps;
+    sens.Clear();
+    if (N < 2 || (int)n != NX * N + NU * (N - 1))
+        return false;
+
+    // The solution is the linearization point, its QP is solved near du = 0
+    // and the feedback of the final face is the sensitivity
+    _s.resize(N);
+    _u.resize(N - 1);
+    for (int k = 0; k < N; k++)
+        for (int j = 0; j < NX; j++)
+            _s[k][j] = vars[j * N + k];
+    for (int k = 0; k < N - 1; k++)
+    {
+        _u[k][0] = std::min(std::max(vars[NX * N + k], -_max_angvel), _max_angvel);
+        _u[k][1] = std::min(std::max(vars[NX * N + N - 1 + k], -_max_throttle), _max_throttle);
+    }
+    buildStages(coeffs);
+    _du.assign(N - 1, Qp::VectorU::Zero());
+    if (!_qp.Solve(_stages, Qp::VectorZ::Zero(), _dz, _du))
+        return false;
+
+    // Costates of the Gauss-Newton solve, then the exact Hessian
+    StateMatrix H;
+    for (int k = 0; k < N - 1; k++)
+    {
+        curvature(_s[k], _qp.Costate(k + 1).head<NX>(), coeffs, H);
+        _stages[k].Q.topLeftCorner<NX, NX>() += H;
+    }
+    _du.assign(N - 1, Qp::VectorU::Zero());
+    if (!_qp.Solve(_stages, Qp::VectorZ::Zero(), _dz, _du))
+    {
+        buildStages(coeffs);
+        _du.assign(N - 1, Qp::VectorU::Zero());
+        if (!_qp.Solve(_stages, Qp::VectorZ::Zero(), _dz, _du))
+            return false;
+    }
+
+    sens.states.assign(_s.begin(), _s.end());
+    sens.inputs.assign(_u.begin(), _u.end());
+    sens.gains.resize(N - 1);
+    for (int k = 0; k < N - 1; k++)
+        sens.gains[k] = _qp.Gain(k).leftCols<NX>();
+    sens.coeffs = coeffs;
+    sens.dt = _dt;
+    sens.max_angvel = _max_angvel;
+    sens.max_throttle = _max_throttle;
+    return true;
+}
+
+namespace
+{
+    // Entries of the Jacobians of RtiSolver::model(), (row, column)
+    const int A_PATTERN[][2] = { {0, 0}, {0, 2}, {0, 3}, {1, 1}, {1, 2}, {1, 3}, {2, 2}, {3, 3},
+                                 {4, 0}, {4, 1}, {4, 3}, {4, 5}, {5, 0}, {5, 2} };
+    const int B_PATTERN[][2] = { {2, 0}, {3, 1}, {5, 0} };
+    const int A_ENTRIES = sizeof(A_PATTERN) / sizeof(A_PATTERN[0]);
+    const int B_ENTRIES = sizeof(B_PATTERN) / sizeof(B_PATTERN[0]);
+}
+
+bool RtiSolver::setupSparse(int N)
+{
+    const int n = NX * N + NU * (N - 1);
+    // Rows: state j of stage k at NX * k + j (the initial state, then the
+    // dynamics of step k - 1), bound of input i at step k at NX * N + i * (N - 1) + k
+    const int m = n;
+    std::vector<Eigen::Triplet<double> > entries;
+
+    // Cost: tracking of v, cte, etheta, the inputs and their rates
+    for (int k = 0; k < N; k++)
+    {
+        entries.push_back(Eigen::Triplet<double>(3 * N + k, 3 * N + k, _w_vel));
+        entries.push_back(Eigen::Triplet<double>(4 * N + k, 4 * N + k, _w_cte));
+        entries.push_back(Eigen::Triplet<double>(5 * N + k, 5 * N + k, _w_etheta));
+    }
+    const double wu[NU] = { _w_angvel, _w_accel }, wd[NU] = { _w_angvel_d, _w_accel_d };
+    for (int i = 0; i < NU; i++)
+    {
+        const int u0 = NX * N + i * (N - 1);
+        for (int k = 0; k < N - 1; k++)
+        {
+            const double rate = (k > 0 ? wd[i] : 0.0) + (k < N - 2 ? wd[i] : 0.0);
+            entries.push_back(Eigen::Triplet<double>(u0 + k, u0 + k, wu[i] + rate));
+            if (k > 0)
+                entries.push_back(Eigen::Triplet<double>(u0 + k, u0 + k - 1, -wd[i]));
+        }
+    }
+    _qp_P.resize(n, n);
+    _qp_P.setFromTriplets(entries.begin(), entries.end());
+
+    // Constraints, the Jacobian entries as structural zeros
+    entries.clear();
+    for (int k = 0; k < N; k++)
+        for (int j = 0; j < NX; j++)
+            entries.push_back(Eigen::Triplet<double>(NX * k + j, j * N + k, 1.0));
+    for (int k = 0; k < N - 1; k++)
+    {
+        for (int e = 0; e < A_ENTRIES; e++)
+            entries.push_back(Eigen::Triplet<double>(NX * (k + 1) + A_PATTERN[e][0], A_PATTERN[e][1] * N + k, 0.0));
+        for (int e = 0; e < B_ENTRIES; e++)
+            entries.push_back(Eigen::Triplet<double>(NX * (k + 1) + B_PATTERN[e][0],
+                                                     NX * N + B_PATTERN[e][1] * (N - 1) + k, 0.0));
+        for (int i = 0; i < NU; i++)
+            entries.push_back(Eigen::Triplet<double>(NX * N + i * (N - 1) + k, NX * N + i * (N - 1) + k, 1.0));
+    }
+    _qp_A.resize(m, n);
+    _qp_A.setFromTriplets(entries.begin(), entries.end());
+    _qp_A.makeCompressed();
+
+    const double *values = _qp_A.valuePtr();
+    _jac_in_a.clear();
+    for (int k = 0; k < N - 1; k++)
+    {
+        for (int e = 0; e < A_ENTRIES; e++)
+            _jac_in_a.push_back(&_qp_A.coeffRef(NX * (k + 1) + A_PATTERN[e][0], A_PATTERN[e][1] * N + k) - values);
+        for (int e = 0; e < B_ENTRIES; e++)
+            _jac_in_a.push_back(&_qp_A.coeffRef(NX * (k + 1) + B_PATTERN[e][0],
+                                                NX * N + B_PATTERN[e][1] * (N - 1) + k) - values);
+    }
+
+    _qp_q.resize(n);
+    _qp_l.resize(m);
+    _qp_u.resize(m);
+    _qp_x.setZero(n);
+    _qp_y.resize(m);
+    _sparse_warm = false;
+    _sparse_steps = N;
+    return _admm.Setup(_qp_P, _qp_A);
+}
+
+bool RtiSolver::stepSparse(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, std::vector<double> &vars)
+{
+    const int N = _mpc_steps;
+    const int n_vars = NX * N + NU * (N - 1);
+    if (_sparse_steps != N && !setupSparse(N))
+    {
+        _sparse_steps = 0;
+        return false;
+    }
+
+    // Dynamics rows: ds_{k+1} - A_k ds_k - B_k du_k = F(s_k, u_k) - s_{k+1}
+    StateMatrix A;
+    InputMatrix B;
+    State next;
+    double *values = _qp_A.valuePtr();
+    const int *jac = &_jac_in_a[0];
+    _qp_l.head<NX>() = state - _s[0];
+    for (int k = 0; k < N - 1; k++)
+    {
+        model(_s[k], _u[k][0], _u[k][1], coeffs, next, &A, &B);
+        for (int e = 0; e < A_ENTRIES; e++)
+            values[*jac++] = -A(A_PATTERN[e][0], A_PATTERN[e][1]);
+        for (int e = 0; e < B_ENTRIES; e++)
+            values[*jac++] = -B(B_PATTERN[e][0], B_PATTERN[e][1]);
+        _qp_l.segment<NX>(NX * (k + 1)) = next - _s[k + 1];
+        for (int i = 0; i < NU; i++)
+        {
+            const double bound = i == 0 ? _max_angvel : _max_throttle;
+            _qp_l[NX * N + i * (N - 1) + k] = -bound - _u[k][i];
+            _qp_u[NX * N + i * (N - 1) + k] = bound - _u[k][i];
+        }
+    }
+    _qp_u.head(NX * N) = _qp_l.head(NX * N);
+    _admm.UpdateA(_qp_A);
+
+    // Gradient of the cost at the linearization point
+    _qp_q.setZero();
+    for (int k = 0; k < N; k++)
+    {
+        _qp_q[3 * N + k] = _w_vel * (_s[k][3] - _ref_vel);
+        _qp_q[4 * N + k] = _w_cte * (_s[k][4] - _ref_cte);
+        _qp_q[5 * N + k] = _w_etheta * (_s[k][5] - _ref_etheta);
+    }
+    const double wu[NU] = { _w_angvel, _w_accel }, wd[NU] = { _w_angvel_d, _w_accel_d };
+    for (int i = 0; i < NU; i++)
+    {
+        const int u0 = NX * N + i * (N - 1);
+        for (int k = 0; k < N - 1; k++)
+        {
+            _qp_q[u0 + k] += wu[i] * _u[k][i];
+            if (k > 0)
+            {
+                const double delta = wd[i] * (_u[k][i] - _u[k - 1][i]);
+                _qp_q[u0 + k] += delta;
+                _qp_q[u0 + k - 1] -= delta;
+            }
+        }
+    }
+
+    // The linearization point is the shifted previous solution, so the
+    // deviations start at zero and the multipliers one stage on
+    if (_sparse_warm)
+    {
+        const Eigen::VectorXd &y = _admm.Y();
+        for (int k = 0; k < N; k++)
+            _qp_y.segment<NX>(NX * k) = y.segment<NX>(NX * std::min(k + 1, N - 1));
+        for (int i = 0; i < NU; i++)
+            for (int k = 0; k < N - 1; k++)
+                _qp_y[NX * N + i * (N - 1) + k] = y[NX * N + i * (N - 1) + std::min(k + 1, N - 2)];
+    }
+    else
+    {
+        _qp_y.setZero();
+    }
+    _admm.WarmStart(_qp_x, _qp_y);
+    const bool ok = _admm.Solve(_qp_q, _qp_l, _qp_u);
+    _qp_iterations = _admm.Iterations();
+    _sparse_warm = ok;
+
+    // New iterate, the linearization point if the QP failed
+    const Eigen::VectorXd &dz = _admm.X();
+    const double scale = ok ? 1.0 : 0.0;
+    vars.assign(n_vars, 0.0);
+    for (int k = 0; k < N; k++)
+        for (int j = 0; j < NX; j++)
+            vars[j * N + k] = _s[k][j] + scale * dz[j * N + k];
+    for (int k = 0; k < N - 1; k++)
+    {
+        vars[NX * N + k] = _u[k][0] + scale * dz[NX * N + k];
+        vars[NX * N + N - 1 + k] = _u[k][1] + scale * dz[NX * N + N - 1 + k];
+    }
+    return ok;
+}
@@ -0,0 +1,131 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "scan_circles.h"
+#include <cmath>
+#include <algorithm>
+
+ScanCircles::ScanCircles()
+{
+    _max_gap = 0.2;
+    _max_radius = 0.5;
+    _max_range = 4.0;
+    _max_circles = 16;
+}
+
+void ScanCircles::Configure(double max_gap, double max_radius, double max_range, int max_circles)
+{
+    _max_gap = max_gap;
+    _max_radius = max_radius;
+    _max_range = max_range;
+    _max_circles = std::max(1, max_circles);
+}
+
+void ScanCircles::Update(const float *ranges, int n, double angle_min, double angle_increment, double range_min, double range_max,
+                         double x, double y, double yaw, double rx, double ry)
+{
+    _circles.clear();
+    _px.clear();
+    _py.clear();
+    const double c = std::cos(yaw), s = std::sin(yaw);
+    const double max_range = std::min(range_max, _max_range);
+    for (int i = 0; i < n; i++)
+    {
+        const double r = ranges[i];
+        if (!(r >= range_min && r <= max_range))
+        {
+            // No return: the piece ends here
+            close(rx, ry);
+            continue;
+        }
+        const double a = angle_min + i * angle_increment;
+        const double sx = r * std::cos(a), sy = r * std::sin(a);
+        const double px = x + c * sx - s * sy, py = y + s * sx + c * sy;
+        if (!_px.empty())
+        {
+            const double gap = std::hypot(px - _px.back(), py - _py.back());
+            const double span = std::hypot(px - _px.front(), py - _py.front());
+            if (gap > _max_gap || span > 2.0 * _max_radius)
+                close(rx, ry);
+        }
+        _px.push_back(px);
+        _py.push_back(py);
+    }
+    close(rx, ry);
+
+    // The closest max_circles, in the order of the scan
+    if ((int)_circles.size() > _max_circles)
+    {
+        _keys.resize(_circles.size());
+        for (size_t k = 0; k < _circles.size(); k++)
+            _keys[k] = std::hypot(_circles[k].x - rx, _circles[k].y - ry) - _circles[k].radius;
+        _sorted = _keys;
+        std::nth_element(_sorted.begin(), _sorted.begin() + (_max_circles - 1), _sorted.end());
+        const double limit = _sorted[_max_circles - 1];
+        size_t kept = 0;
+        for (size_t k = 0; k < _circles.size() && (int)kept < _max_circles; k++)
+        {
+            if (_keys[k] <= limit)
+                _circles[kept++] = _circles[k];
+        }
+        _circles.resize(kept);
+    }
+}
+
+void ScanCircles::close(double rx, double ry)
+{
+    if (_px.empty())
+        return;
+    // Center between the ends, pushed away from the robot by the sagitta of
+    // the piece so that the circle covers all of it
+    const size_t n = _px.size();
+    Circle circle;
+    circle.x = 0.5 * (_px.front() + _px.back());
+    circle.y = 0.5 * (_py.front() + _py.back());
+    const double dx = circle.x - rx, dy = circle.y - ry;
+    const double dist = std::hypot(dx, dy);
+    if (dist > 0.0)
+    {
+        const double mid = std::hypot(_px[n / 2] - rx, _py[n / 2] - ry);
+        const double push = std::max(0.0, dist - mid);
+        circle.x += push * dx / dist;
+        circle.y += push * dy / dist;
+    }
+    circle.radius = 0.0;
+    for (size_t i = 0; i < n; i++)
+        circle.radius = std::max(circle.radius, std::hypot(_px[i] - circle.x, _py[i] - circle.y));
+    _circles.push_back(circle);
+    _px.clear();
+    _py.clear();
+}
+
+bool ScanCircles::Distance(double x, double y, double &d, double &ddx, double &ddy) const
+{
+    bool found = false;
+    for (size_t k = 0; k < _circles.size(); k++)
+    {
+        const double dx = x - _circles[k].x, dy = y - _circles[k].y;
+        const double dist = std::hypot(dx, dy);
+        const double edge = dist - _circles[k].radius;
+        if (found && edge >= d)
+            continue;
+        found = true;
+        d = edge;
+        ddx = dist > 0.0 ? dx / dist : 0.0;
+        ddy = dist > 0.0 ? dy / dist : 0.0;
+    }
+    return found;
+}
@@ -0,0 +1,221 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "seed_provider.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdint.h>
+
+namespace
+{
+    const char MAGIC[8] = { 'M', 'P', 'C', 'S', 'E', 'E', 'D', '1' };
+
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t features, steps;
+        uint64_t count, params_hash;
+        double scale[NeighborSeed::FEATURES];
+    };
+}
+
+NeighborSeed::NeighborSeed()
+    : _steps(0), _neighbors(3), _params_hash(0)
+{
+    _scale.setOnes();
+}
+
+void NeighborSeed::Create(int steps, unsigned long long params_hash)
+{
+    _steps = steps;
+    _params_hash = params_hash;
+    _scale.setOnes();
+    _features.clear();
+    _scaled.clear();
+    _inputs.clear();
+}
+
+bool NeighborSeed::Features(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, Feature &feature)
+{
+    if (state.size() < 6 || coeffs.size() > 4)
+    {
+        return false;
+    }
+    feature.setZero();
+    feature[0] = state[3];
+    feature[1] = state[4];
+    feature[2] = state[5];
+    for (int i = 0; i < coeffs.size(); i++)
+    {
+        feature[3 + i] = coeffs[i];
+    }
+    return true;
+}
+
+bool NeighborSeed::Add(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs,
+                       const std::vector<double> &angvel, const std::vector<double> &accel)
+{
+    Feature feature;
+    if (_steps < 2 || (int)angvel.size() != _steps - 1 || (int)accel.size() != _steps - 1
+        || !Features(state, coeffs, feature))
+    {
+        return false;
+    }
+    _features.push_back(feature);
+    _inputs.insert(_inputs.end(), angvel.begin(), angvel.end());
+    _inputs.insert(_inputs.end(), accel.begin(), accel.end());
+    return true;
+}
+
+void NeighborSeed::updateScale()
+{
+    // Standard deviation of each feature, 1 where it does not vary
+    const size_t n = _features.size();
+    Feature mean = Feature::Zero(), var = Feature::Zero();
+    for (size_t i = 0; i < n; i++)
+    {
+        mean += _features[i];
+    }
+    mean /= std::max<size_t>(n, 1);
+    for (size_t i = 0; i < n; i++)
+    {
+        var += (_features[i] - mean).cwiseAbs2();
+    }
+    var /= std::max<size_t>(n, 1);
+    for (int d = 0; d < FEATURES; d++)
+    {
+        _scale[d] = var[d] > 1e-12 ? std::sqrt(var[d]) : 1.0;
+    }
+    _scaled.resize(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        _scaled[i] = _features[i].cwiseQuotient(_scale);
+    }
+}
+
+bool NeighborSeed::Write(const std::string &path)
+{
+    if (_steps < 2)
+    {
+        return false;
+    }
+    updateScale();
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.features = FEATURES;
+    header.steps = _steps;
+    header.count = _features.size();
+    header.params_hash = _params_hash;
+    for (int d = 0; d < FEATURES; d++)
+    {
+        header.scale[d] = _scale[d];
+    }
+    const size_t inputs = 2 * (_steps - 1);
+    std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (size_t i = 0; i < _features.size(); i++)
+    {
+        file.write(reinterpret_cast<const char *>(_features[i].data()), FEATURES * sizeof(double));
+        file.write(reinterpret_cast<const char *>(&_inputs[i * inputs]), inputs * sizeof(float));
+    }
+    return file.good();
+}
+
+bool NeighborSeed::Open(const std::string &path)
+{
+    Create(0, 0);
+    std::ifstream file(path.c_str(), std::ios::binary);
+    FileHeader header;
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(header))
+        || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.features != FEATURES || header.steps < 2)
+    {
+        return false;
+    }
+    const size_t inputs = 2 * (header.steps - 1);
+    _features.resize(header.count);
+    _inputs.resize(header.count * inputs);
+    for (size_t i = 0; i < header.count; i++)
+    {
+        if (!file.read(reinterpret_cast<char *>(_features[i].data()), FEATURES * sizeof(double))
+            || !file.read(reinterpret_cast<char *>(&_inputs[i * inputs]), inputs * sizeof(float)))
+        {
+            Create(0, 0);
+            return false;
+        }
+    }
+    _steps = header.steps;
+    _params_hash = header.params_hash;
+    updateScale();
+    return true;
+}
+
+bool NeighborSeed::Seed(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, int steps,
+                        std::vector<double> &angvel, std::vector<double> &accel)
+{
+    Feature query;
+    if (steps != _steps || _scaled.empty() || !Features(state, coeffs, query))
+    {
+        return false;
+    }
+    query = query.cwiseQuotient(_scale);
+
+    // The k nearest, kept sorted by insertion
+    const int k = std::min<int>(_neighbors, _scaled.size());
+    _nearest.assign(k, -1);
+    _distance.assign(k, HUGE_VAL);
+    for (size_t i = 0; i < _scaled.size(); i++)
+    {
+        const double d = (_scaled[i] - query).squaredNorm();
+        if (d >= _distance[k - 1])
+        {
+            continue;
+        }
+        int j = k - 1;
+        for (; j > 0 && _distance[j - 1] > d; j--)
+        {
+            _distance[j] = _distance[j - 1];
+            _nearest[j] = _nearest[j - 1];
+        }
+        _distance[j] = d;
+        _nearest[j] = i;
+    }
+
+    // Inverse-distance weights, an exact match wins
+    const size_t n = _steps - 1;
+    angvel.assign(n, 0.0);
+    accel.assign(n, 0.0);
+    double total = 0;
+    for (int j = 0; j < k; j++)
+    {
+        const double w = 1.0 / (std::sqrt(_distance[j]) + 1e-6);
+        const float *inputs = &_inputs[_nearest[j] * 2 * n];
+        for (size_t i = 0; i < n; i++)
+        {
+            angvel[i] += w * inputs[i];
+            accel[i] += w * inputs[n + i];
+        }
+        total += w;
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        angvel[i] /= total;
+        accel[i] /= total;
+    }
+    return true;
+}
@@ -0,0 +1,289 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "shadow_solver.h"
+#include "MPC.h"
+#include "controller_metrics.h"
+#include "realtime.h"
+#include "trace_span.h"
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+struct ShadowSolver::Worker
+{
+    Backend backend;
+    std::string codegen_library;
+    RealtimeSettings affinity;
+    ShadowMetrics *metrics;
+    std::thread thread;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    bool running, pending, reload;
+    std::map<std::string, double> params;
+    std::vector<int> move_blocks;
+    // Inputs of the newest primary solve
+    Eigen::VectorXd state, coeffs;
+    double deadline, angvel, accel, solve_ms;
+    bool near_goal;
+};
+
+namespace
+{
+    // The flags choosing the backend, all set by every named backend so it
+    // does not inherit the choice of the primary
+    bool selectBackend(const std::string &name, std::map<std::string, double> &params, bool &codegen)
+    {
+        double rti = 0, ltv = 0, analytic = 0;
+        codegen = false;
+        if (name == "rti")
+            rti = 1;
+        else if (name == "ltv")
+            rti = ltv = 1;
+        else if (name == "analytic")
+            analytic = 1;
+        else if (name == "codegen")
+            codegen = true;
+        else if (name != "ipopt")
+            return false;
+        params["RTI"] = rti;
+        params["LTV"] = ltv;
+        params["ANALYTIC"] = analytic;
+        return true;
+    }
+
+    // Lowest priority of the scheduler for the calling thread
+    void idlePriority(const std::string &name)
+    {
+        sched_param param;
+        param.sched_priority = 0;
+        if (pthread_setschedparam(pthread_self(), SCHED_IDLE, &param) == 0)
+            return;
+        if (setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), 19) != 0)
+            std::cout << "ShadowSolver: " << name << " runs at the priority of the controller" << std::endl;
+    }
+}
+
+bool ShadowSolver::Parse(const std::string &spec, std::vector<Backend> &backends, std::string &error)
+{
+    backends.clear();
+    std::stringstream entries(spec);
+    std::string entry;
+    while (std::getline(entries, entry, ','))
+    {
+        entry.erase(0, entry.find_first_not_of(" \t"));
+        entry.erase(entry.find_last_not_of(" \t") + 1);
+        if (entry.empty())
+            continue;
+        Backend backend;
+        backend.name = entry;
+        std::stringstream parts(entry);
+        std::string part;
+        std::getline(parts, part, '+');
+        if (!selectBackend(part, backend.params, backend.codegen))
+        {
+            error = "unknown backend " + part + " in " + entry;
+            return false;
+        }
+        while (std::getline(parts, part, '+'))
+        {
+            const size_t eq = part.find('=');
+            char *end = nullptr;
+            const double value = eq == std::string::npos ? 0.0 : std::strtod(part.c_str() + eq + 1, &end);
+            if (eq == std::string::npos || eq == 0 || end == part.c_str() + eq + 1 || *end != '\0')
+            {
+                error = "override " + part + " of " + entry + " is not KEY=value";
+                return false;
+            }
+            backend.params[part.substr(0, eq)] = value;
+        }
+        backends.push_back(backend);
+    }
+    return true;
+}
+
+ShadowSolver::ShadowSolver()
+{
+}
+
+ShadowSolver::~ShadowSolver()
+{
+    Stop();
+}
+
+void ShadowSolver::Configure(const std::vector<Backend> &backends, const std::string &codegen_library,
+                             const std::string &cpus, ControllerMetrics &metrics)
+{
+    Stop();
+    _workers.clear();
+    for (size_t i = 0; i < backends.size(); i++)
+    {
+        if (backends[i].codegen && codegen_library.empty())
+        {
+            std::cout << "ShadowSolver: " << backends[i].name << " needs mpc_codegen_library, skipped" << std::endl;
+            continue;
+        }
+        std::unique_ptr<Worker> worker(new Worker);
+        worker->backend = backends[i];
+        worker->codegen_library = codegen_library;
+        worker->affinity.Configure(0, cpus, 0);
+        worker->metrics = &metrics.AddShadow(backends[i].name);
+        worker->running = false;
+        worker->pending = false;
+        worker->reload = true;
+        worker->deadline = worker->angvel = worker->accel = worker->solve_ms = 0.0;
+        worker->near_goal = false;
+        _workers.push_back(std::move(worker));
+    }
+}
+
+void ShadowSolver::Start(const std::map<std::string, double> &params, const std::vector<int> &move_blocks)
+{
+    Stop();
+    for (size_t i = 0; i < _workers.size(); i++)
+    {
+        Worker &worker = *_workers[i];
+        worker.running = true;
+        worker.pending = false;
+        worker.reload = true;
+        worker.params = params;
+        worker.move_blocks = move_blocks;
+        worker.thread = std::thread(&ShadowSolver::run, &worker);
+    }
+}
+
+void ShadowSolver::Stop()
+{
+    for (size_t i = 0; i < _workers.size(); i++)
+    {
+        Worker &worker = *_workers[i];
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.running = false;
+        }
+        worker.cond.notify_one();
+        if (worker.thread.joinable())
+            worker.thread.join();
+    }
+}
+
+void ShadowSolver::SetParams(const std::map<std::string, double> &params, const std::vector<int> &move_blocks)
+{
+    for (size_t i = 0; i < _workers.size(); i++)
+    {
+        Worker &worker = *_workers[i];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.params = params;
+        worker.move_blocks = move_blocks;
+        worker.reload = true;
+    }
+}
+
+void ShadowSolver::Submit(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, double deadline, bool near_goal,
+                          double angvel, double accel, double solve_ms)
+{
+    for (size_t i = 0; i < _workers.size(); i++)
+    {
+        Worker &worker = *_workers[i];
+        // Only held by the worker to swap an input in or out
+        std::unique_lock<std::mutex> lock(worker.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || worker.pending)
+        {
+            worker.metrics->CountDropped();
+            if (!lock.owns_lock())
+                continue;
+        }
+        worker.state = state;
+        worker.coeffs = coeffs;
+        worker.deadline = deadline;
+        worker.near_goal = near_goal;
+        worker.angvel = angvel;
+        worker.accel = accel;
+        worker.solve_ms = solve_ms;
+        worker.pending = true;
+        lock.unlock();
+        worker.cond.notify_one();
+    }
+}
+
+void ShadowSolver::run(Worker *worker)
+{
+    MPC_TRACE_THREAD("mpc_shadow");
+    std::string report;
+    if (worker->affinity.Enabled() && !worker->affinity.Apply(report))
+        std::cout << "ShadowSolver: " << worker->backend.name << ": " << report << std::endl;
+    idlePriority(worker->backend.name);
+
+    // Built on this thread, CppAD memory is freed by the thread that took it
+    MPC mpc;
+    if (worker->backend.codegen)
+        mpc.SetGeneratedModel(worker->codegen_library);
+    Eigen::VectorXd state, coeffs;
+    std::unique_lock<std::mutex> lock(worker->mutex);
+    while (true)
+    {
+        worker->cond.wait(lock, [worker] { return worker->pending || !worker->running; });
+        if (!worker->running)
+            break;
+        worker->pending = false;
+        state = worker->state;
+        coeffs = worker->coeffs;
+        const double deadline = worker->deadline, angvel = worker->angvel, accel = worker->accel;
+        const double primary_ms = worker->solve_ms;
+        const bool near_goal = worker->near_goal;
+        std::map<std::string, double> params;
+        std::vector<int> move_blocks;
+        const bool reload = worker->reload;
+        if (reload)
+        {
+            params = worker->params;
+            for (std::map<std::string, double>::const_iterator it = worker->backend.params.begin();
+                 it != worker->backend.params.end(); ++it)
+                params[it->first] = it->second;
+            move_blocks = worker->move_blocks;
+            worker->reload = false;
+        }
+        lock.unlock();
+
+        if (reload)
+        {
+            mpc.LoadParams(params);
+            mpc.SetMoveBlocks(move_blocks);
+        }
+        mpc.SetDeadline(deadline);
+        mpc.SetNearGoal(near_goal);
+        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        const std::vector<double> result = mpc.Solve(state, coeffs);
+        const double solve_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        if (!mpc._mpc_feasible || result.size() < 2)
+            worker->metrics->CountInfeasible();
+        else
+            worker->metrics->ObserveSolve(solve_ms, mpc._mpc_iterations, primary_ms,
+                                          std::fabs(result[0] - angvel), std::fabs(result[1] - accel));
+        lock.lock();
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "shm_transport.h"
+#include <algorithm>
+#include <chrono>
+
+ShmTransport::ShmTransport() : _odom_retry(0.0)
+{
+    _config.odom_timeout = 0.2;
+    _odom_seen.store(-1e9);
+}
+
+double ShmTransport::now()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void ShmTransport::Configure(const Config &config, std::string &report)
+{
+    _config = config;
+    report.clear();
+    if (!_config.cmd_vel.empty() && !_cmd_vel.Create(_config.cmd_vel))
+        report += " " + _cmd_vel.Error();
+    if (!_config.commands.empty() && !_commands.Create(_config.commands))
+        report += " " + _commands.Error();
+    if (!_config.trajectory.empty() && !_trajectory.Create(_config.trajectory))
+        report += " " + _trajectory.Error();
+}
+
+nav_msgs::Odometry::Ptr ShmTransport::TakeOdometry(const std::string &frame, const std::string &child_frame)
+{
+    if (_config.odom.empty())
+        return nav_msgs::Odometry::Ptr();
+    // Until the localization created the segment, try once a second
+    const double t = now();
+    if (!_odom.IsOpen() && (t < _odom_retry || !_odom.Open(_config.odom)))
+    {
+        _odom_retry = std::max(_odom_retry, t + 1.0);
+        return nav_msgs::Odometry::Ptr();
+    }
+
+    ShmOdometry odom;
+    if (!_odom.Take(odom))
+        return nav_msgs::Odometry::Ptr();
+    _odom_seen.store(t);
+    nav_msgs::Odometry::Ptr msg(new nav_msgs::Odometry());
+    msg->header.stamp.fromSec(odom.stamp);
+    msg->header.frame_id = frame;
+    msg->child_frame_id = child_frame;
+    msg->pose.pose.position.x = odom.x;
+    msg->pose.pose.position.y = odom.y;
+    msg->pose.pose.position.z = odom.z;
+    msg->pose.pose.orientation.x = odom.qx;
+    msg->pose.pose.orientation.y = odom.qy;
+    msg->pose.pose.orientation.z = odom.qz;
+    msg->pose.pose.orientation.w = odom.qw;
+    msg->twist.twist.linear.x = odom.vx;
+    msg->twist.twist.linear.y = odom.vy;
+    msg->twist.twist.angular.z = odom.wz;
+    return msg;
+}
+
+bool ShmTransport::OdometryLive() const
+{
+    return !_config.odom.empty() && now() - _odom_seen.load() < _config.odom_timeout;
+}
+
+void ShmTransport::PublishTwist(double stamp, double linear_x, double angular_z)
+{
+    if (!_cmd_vel.IsOpen())
+        return;
+    ShmTwist twist;
+    twist.stamp = stamp;
+    twist.linear_x = linear_x;
+    twist.angular_z = angular_z;
+    _cmd_vel.Set(twist);
+}
+
+void ShmTransport::PublishCommands(const CommandWindow &window)
+{
+    if (_commands.IsOpen())
+        _commands.Set(window);
+}
+
+void ShmTransport::PublishTrajectory(const mpc_ros::MPCTrajectory &traj)
+{
+    if (!_trajectory.IsOpen())
+        return;
+    const size_t stride = ShmTrajectory::STRIDE;
+    ShmTrajectory out;
+    out.stamp = traj.header.stamp.toSec();
+    out.steps = std::min<size_t>(traj.states.size() / stride, ShmTrajectory::CAPACITY);
+    out.grid = traj.step_dt.size() >= size_t(out.steps) && !traj.step_dt.empty();
+    out.dt = traj.dt;
+    std::copy(traj.states.begin(), traj.states.begin() + out.steps * stride, out.states);
+    std::fill(out.states + out.steps * stride, out.states + ShmTrajectory::CAPACITY * stride, 0.0f);
+    for (int i = 0; i < ShmTrajectory::CAPACITY; i++)
+        out.step_dt[i] = out.grid && i < out.steps ? traj.step_dt[i] : 0.0f;
+    out.status = traj.status;
+    out.iterations = traj.iterations;
+    out.solve_ms = traj.solve_ms;
+    out.cost = traj.cost;
+    out.feasible = traj.feasible;
+    out.fallback = traj.fallback;
+    _trajectory.Set(out);
+}
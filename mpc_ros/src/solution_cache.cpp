@@ -0,0 +1,114 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "solution_cache.h"
+#include <cmath>
+
+SolutionCache::SolutionCache(size_t capacity)
+{
+    _enabled = false;
+    _resolution = 1e-4;
+    _version = 0;
+    _capacity = capacity > 0 ? capacity : 1;
+    _next = 0;
+    _hits = 0;
+    _misses = 0;
+}
+
+void SolutionCache::Configure(bool enabled, double resolution)
+{
+    resolution = resolution > 0.0 ? resolution : 1e-4;
+    if(enabled != _enabled || resolution != _resolution)
+        Clear();
+    _enabled = enabled;
+    _resolution = resolution;
+}
+
+void SolutionCache::Clear()
+{
+    _entries.clear();
+    _next = 0;
+    _key.clear();
+}
+
+bool SolutionCache::append(double value)
+{
+    if(!std::isfinite(value) || std::fabs(value / _resolution) > 9e18)
+        return false;
+    _key.push_back(std::llround(value / _resolution));
+    return true;
+}
+
+const SolutionCache::Solution *SolutionCache::Find(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs,
+                                                   const std::vector<double> &obstacles,
+                                                   const std::vector<double> &corridor,
+                                                   const std::vector<double> &speeds)
+{
+    // The sizes are part of the key, a value can't shift into another block
+    _key.clear();
+    _key.push_back(_version);
+    _key.push_back(state.size());
+    _key.push_back(coeffs.size());
+    _key.push_back(obstacles.size());
+    _key.push_back(corridor.size());
+    _key.push_back(speeds.size());
+    bool valid = true;
+    for(int i = 0; i < state.size(); i++)
+        valid = valid && append(state[i]);
+    for(int i = 0; i < coeffs.size(); i++)
+        valid = valid && append(coeffs[i]);
+    for(size_t i = 0; i < obstacles.size(); i++)
+        valid = valid && append(obstacles[i]);
+    for(size_t i = 0; i < corridor.size(); i++)
+        valid = valid && append(corridor[i]);
+    for(size_t i = 0; i < speeds.size(); i++)
+        valid = valid && append(speeds[i]);
+    if(!valid)
+    {
+        // Non-finite inputs are left to the solve and not stored
+        _key.clear();
+        _misses++;
+        return 0;
+    }
+
+    for(size_t i = 0; i < _entries.size(); i++)
+    {
+        if(_entries[i].key == _key)
+        {
+            _hits++;
+            return &_entries[i].solution;
+        }
+    }
+    _misses++;
+    return 0;
+}
+
+void SolutionCache::Insert(const Solution &solution)
+{
+    if(_key.empty())
+        return;
+    if(_entries.size() < _capacity)
+    {
+        _entries.push_back(Entry());
+        _entries.back().key = _key;
+        _entries.back().solution = solution;
+        return;
+    }
+    _entries[_next].key = _key;
+    _entries[_next].solution = solution;
+    _next = (_next + 1) % _capacity;
+}
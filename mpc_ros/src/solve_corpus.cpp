@@ -0,0 +1,94 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "solve_corpus.h"
+#include "trajectory_log.h"
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+bool ParseSolveSample(const std::string &line, SolveSample &sample)
+{
+    std::vector<double> cols;
+    std::stringstream ss(line);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        char *end = NULL;
+        const double value = std::strtod(item.c_str(), &end);
+        if (end == item.c_str())
+            return false;
+        cols.push_back(value);
+    }
+
+    sample.state = Eigen::VectorXd(6);
+    sample.coeffs = Eigen::VectorXd(4);
+    if (cols.size() == 10)
+    {
+        for (int i = 0; i < 6; i++)
+            sample.state[i] = cols[i];
+        for (int i = 0; i < 4; i++)
+            sample.coeffs[i] = cols[6 + i];
+        return true;
+    }
+    if (cols.size() == 5)
+    {
+        const double cte = cols[1], etheta = cols[2], v = cols[3];
+        sample.state << 0, 0, 0, v, cte, etheta;
+        sample.coeffs << cte, std::tan(etheta), 0, 0;
+        return true;
+    }
+    return false;
+}
+
+bool LoadSolveCorpus(const std::string &path, std::vector<SolveSample> &samples, std::string &error)
+{
+    samples.clear();
+    std::vector<TrajectoryRecord> records;
+    if (TrajectoryLog::Read(path, records))
+    {
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            SolveSample sample;
+            sample.state = Eigen::Map<const Eigen::VectorXd>(records[i].state, 6);
+            sample.coeffs = Eigen::Map<const Eigen::VectorXd>(records[i].coeffs, 4);
+            samples.push_back(sample);
+        }
+    }
+    else
+    {
+        std::ifstream file(path.c_str());
+        if (!file)
+        {
+            error = "cannot open " + path;
+            return false;
+        }
+        std::string line;
+        while (std::getline(file, line))
+        {
+            SolveSample sample;
+            if (ParseSolveSample(line, sample))
+                samples.push_back(sample);
+        }
+    }
+    if (samples.empty())
+    {
+        error = "no samples in " + path;
+        return false;
+    }
+    return true;
+}
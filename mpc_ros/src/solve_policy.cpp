@@ -0,0 +1,133 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "solve_policy.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace
+{
+    double param(const std::map<std::string, double> &params, const std::string &key, double value)
+    {
+        std::map<std::string, double>::const_iterator it = params.find(key);
+        return it != params.end() ? it->second : value;
+    }
+
+    const char *const suffixes[] = { "STARTUP", "TRACKING", "GOAL" };
+
+    // Largest factor on the tolerances of a solve predicted to be too long
+    const double MAX_COARSEN = 10.0;
+}
+
+SolvePolicy::SolvePolicy()
+    : _enabled(false), _startup_solves(5), _slack(0.8),
+      _near_goal(false), _startup_left(0), _phase(STARTUP), _iteration_ms(0.0), _predicted_iterations(0.0), _predicted_ms(0.0), _tol_scale(1.0)
+{
+    const Settings startup = { 1e-8, 1e-6, 15, 200, true };
+    const Settings tracking = { 1e-5, 1e-3, 3, 30, false };
+    const Settings near_goal = { 1e-7, 1e-5, 5, 60, false };
+    _settings[STARTUP] = startup;
+    _settings[TRACKING] = tracking;
+    _settings[NEAR_GOAL] = near_goal;
+    Restart();
+}
+
+const char *SolvePolicy::Name(int phase)
+{
+    switch (phase)
+    {
+        case STARTUP:   return "startup";
+        case TRACKING:  return "tracking";
+        case NEAR_GOAL: return "near_goal";
+        default:        return "unknown";
+    }
+}
+
+void SolvePolicy::LoadParams(const std::map<std::string, double> &params)
+{
+    _enabled = param(params, "POLICY", 0.0) != 0.0;
+    _startup_solves = std::max(0, (int)param(params, "STARTUP_SOLVES", _startup_solves));
+    _slack = std::min(1.0, std::max(0.1, param(params, "SLACK", _slack)));
+    for (int p = 0; p < NUM_PHASES; p++)
+    {
+        Settings &s = _settings[p];
+        const std::string suffix = std::string("_") + suffixes[p];
+        s.tol = param(params, "TOL" + suffix, s.tol);
+        s.acceptable_tol = std::max(s.tol, param(params, "ACCEPTABLE_TOL" + suffix, s.acceptable_tol));
+        s.acceptable_iter = std::max(0, (int)param(params, "ACCEPTABLE_ITER" + suffix, s.acceptable_iter));
+        s.max_iter = std::max(1, (int)param(params, "MAX_ITER" + suffix, s.max_iter));
+        s.adaptive_mu = param(params, "ADAPTIVE_MU" + suffix, s.adaptive_mu) != 0.0;
+    }
+    _iteration_ms = 0.0;
+    Restart();
+}
+
+SolvePolicy::Phase SolvePolicy::Next(double deadline, std::string &options)
+{
+    _phase = _startup_left > 0 ? STARTUP : _near_goal ? NEAR_GOAL : TRACKING;
+    if (_startup_left > 0)
+        _startup_left--;
+
+    Settings s = _settings[_phase];
+    s.tol *= _tol_scale;
+    s.acceptable_tol *= _tol_scale;
+    const double iteration_ms = _predicted_ms > 0 ? _predicted_ms : _iteration_ms;
+    if (deadline > 0 && iteration_ms > 0)
+    {
+        const int fit = std::max(3, (int)std::floor(_slack * deadline * 1000.0 / iteration_ms));
+        if (fit < s.max_iter)
+        {
+            s.max_iter = fit;
+            s.acceptable_iter = std::min(s.acceptable_iter, 1);
+        }
+        // Coarser from the start rather than cut off at max_iter
+        if (_predicted_iterations > fit)
+        {
+            const double coarsen = std::min(MAX_COARSEN, _predicted_iterations / fit);
+            s.tol *= coarsen;
+            s.acceptable_tol *= coarsen;
+        }
+    }
+    _predicted_iterations = _predicted_ms = 0.0;
+
+    std::ostringstream lines;
+    lines << "Numeric tol                     " << s.tol << "\n"
+          << "Numeric acceptable_tol          " << s.acceptable_tol << "\n"
+          << "Integer acceptable_iter         " << s.acceptable_iter << "\n"
+          << "Integer max_iter                " << s.max_iter << "\n"
+          << "String  mu_strategy             " << (s.adaptive_mu ? "adaptive" : "monotone") << "\n";
+    options = lines.str();
+    return _phase;
+}
+
+void SolvePolicy::Predict(double iterations, double iteration_ms)
+{
+    _predicted_iterations = iterations;
+    _predicted_ms = iteration_ms;
+}
+
+void SolvePolicy::Observe(bool converged, double solve_ms, int iterations)
+{
+    if (iterations > 0 && solve_ms > 0)
+    {
+        const double ms = solve_ms / iterations;
+        _iteration_ms = _iteration_ms > 0 ? 0.8 * _iteration_ms + 0.2 * ms : ms;
+    }
+    // Recover a lost plan with the start-up settings
+    if (!converged && _phase != STARTUP)
+        Restart();
+}
@@ -0,0 +1,112 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "solve_time_model.h"
+#include <algorithm>
+#include <cmath>
+
+// Initial covariance of the weights, large: the first solves decide
+static const double PRIOR = 1e3;
+
+SolveTimeModel::SolveTimeModel()
+{
+    _enabled = false;
+    _forget = 0.98;
+    _samples = 0;
+    _w.setZero();
+    _p = PRIOR * Matrix::Identity();
+    _u.setZero();
+    _q = PRIOR * Eigen::Matrix2d::Identity();
+    _bend = _dv = _warm = _dref = 0.0;
+    _last_v = _last_c0 = _last_c1 = 0.0;
+    _last_iterations = 0;
+    _error = 0.0;
+}
+
+void SolveTimeModel::LoadParams(const std::map<std::string, double> &params)
+{
+    std::map<std::string, double>::const_iterator it = params.find("PREDICT");
+    _enabled = it != params.end() && it->second != 0.0;
+    it = params.find("PREDICT_FORGET");
+    if (it != params.end())
+        _forget = std::min(1.0, std::max(0.5, it->second));
+}
+
+void SolveTimeModel::Features(double v, const Eigen::VectorXd &coeffs, bool warm)
+{
+    const double c0 = coeffs.size() > 0 ? coeffs[0] : 0.0;
+    const double c1 = coeffs.size() > 1 ? coeffs[1] : 0.0;
+    _bend = (coeffs.size() > 2 ? std::fabs(2.0 * coeffs[2]) : 0.0) + (coeffs.size() > 3 ? std::fabs(6.0 * coeffs[3]) : 0.0);
+    _dv = std::fabs(v - _last_v);
+    _warm = warm ? 1.0 : 0.0;
+    _dref = std::fabs(c0 - _last_c0) + std::fabs(c1 - _last_c1);
+    _last_v = v;
+    _last_c0 = c0;
+    _last_c1 = c1;
+}
+
+// Scaled to about 1, the covariance stays conditioned
+void SolveTimeModel::features(int steps, Vector &x) const
+{
+    x << 1.0, _bend, _dv, _warm, _dref, 0.1 * _last_iterations, 0.01 * steps;
+}
+
+double SolveTimeModel::Iterations(int steps) const
+{
+    Vector x;
+    features(steps, x);
+    return std::max(1.0, _w.dot(x));
+}
+
+double SolveTimeModel::IterationMs(int steps) const
+{
+    return std::max(0.0, _u[0] + _u[1] * 0.01 * steps);
+}
+
+void SolveTimeModel::Observe(int steps, int iterations, double solve_ms)
+{
+    if (iterations <= 0 || solve_ms <= 0.0)
+        return;
+    if (Ready())
+    {
+        const double predicted = SolveMs(steps);
+        _error = 0.95 * _error + 0.05 * std::fabs(predicted - solve_ms) / solve_ms;
+    }
+
+    // Recursive least squares: the gain, the weights, the covariance
+    Vector x;
+    features(steps, x);
+    const Vector px = _p * x;
+    const Vector k = px / (_forget + x.dot(px));
+    _w += k * (iterations - _w.dot(x));
+    // Forgetting only while bounded: features that never vary (always warm)
+    // would grow their covariance without end
+    _p -= k * px.transpose();
+    if (_p.trace() < PRIOR * FEATURES)
+        _p /= _forget;
+
+    const Eigen::Vector2d z(1.0, 0.01 * steps);
+    const Eigen::Vector2d qz = _q * z;
+    const Eigen::Vector2d g = qz / (_forget + z.dot(qz));
+    _u += g * (solve_ms / iterations - _u.dot(z));
+    _q -= g * qz.transpose();
+    if (_q.trace() < PRIOR * 2)
+        _q /= _forget;
+
+    _last_iterations = iterations;
+    _samples++;
+}
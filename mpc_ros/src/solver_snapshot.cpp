@@ -0,0 +1,287 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "solver_snapshot.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "sparsity_patterns.h"
+
+namespace
+{
+    const char MAGIC[8] = {'M', 'P', 'C', 'S', 'N', 'A', 'P', '1'};
+
+    template <class T>
+    void put(std::ostream &out, const T &value)
+    {
+        out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    template <class T>
+    bool get(std::istream &in, T &value)
+    {
+        return (bool)in.read(reinterpret_cast<char *>(&value), sizeof(value));
+    }
+
+    template <class Vector>
+    void putVector(std::ostream &out, const Vector &v)
+    {
+        put(out, (unsigned long long)v.size());
+        for (size_t i = 0; i < v.size(); i++)
+            put(out, v[i]);
+    }
+
+    // Sizes are bounded by what is left of the file, so a damaged one does
+    // not make it allocate the world
+    template <class Vector, class T>
+    bool getVector(std::istream &in, size_t left, Vector &v, T)
+    {
+        unsigned long long size;
+        if (!get(in, size) || size > left / sizeof(T))
+            return false;
+        v.resize(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            T value;
+            if (!get(in, value))
+                return false;
+            v[i] = value;
+        }
+        return true;
+    }
+
+    void putPattern(std::ostream &out, const CppAD::vectorBool &pattern)
+    {
+        put(out, (unsigned long long)pattern.size());
+        unsigned char byte = 0;
+        for (size_t k = 0; k < pattern.size(); k++)
+        {
+            if (pattern[k])
+                byte |= 1 << (k % 8);
+            if (k % 8 == 7 || k + 1 == pattern.size())
+            {
+                put(out, byte);
+                byte = 0;
+            }
+        }
+    }
+
+    bool getPattern(std::istream &in, size_t left, CppAD::vectorBool &pattern)
+    {
+        unsigned long long size;
+        if (!get(in, size) || size / 8 > left)
+            return false;
+        pattern.resize(size);
+        unsigned char byte = 0;
+        for (size_t k = 0; k < size; k++)
+        {
+            if (k % 8 == 0 && !get(in, byte))
+                return false;
+            pattern[k] = (byte >> (k % 8)) & 1;
+        }
+        return true;
+    }
+
+    void putString(std::ostream &out, const std::string &s)
+    {
+        put(out, (unsigned long long)s.size());
+        out.write(s.data(), s.size());
+    }
+
+    bool getString(std::istream &in, size_t left, std::string &s)
+    {
+        unsigned long long size;
+        if (!get(in, size) || size > left)
+            return false;
+        s.resize(size);
+        return size == 0 || (bool)in.read(&s[0], size);
+    }
+}
+
+SolverSnapshot::SolverSnapshot()
+{
+    params_hash = 0;
+    params_version = 0;
+    stamp = 0;
+    n_vars = n_constraints = n_params = size_var = size_op = 0;
+    hes_density = -1.0;
+    steps = 0;
+}
+
+void SolverSnapshot::Capture(const TapeSolver *tape, const WarmStart &warm)
+{
+    stamp = Now();
+    structure.reset();
+    std::shared_ptr<const TapeStructure> recorded = tape ? tape->Structure() : std::shared_ptr<const TapeStructure>();
+    if (recorded)
+    {
+        // A copy: the solver goes on changing its own
+        structure = std::make_shared<TapeStructure>(*recorded);
+        n_vars = tape->NumVars();
+        n_constraints = tape->NumConstraints();
+        n_params = tape->NumParams();
+        size_var = tape->Profile().size_var;
+        size_op = tape->Profile().size_op;
+        hes_density = sparsity_patterns::Density(recorded->pattern_hes, n_vars + n_params);
+    }
+    steps = warm.Steps();
+    x = warm.X();
+    zl = warm.Zl();
+    zu = warm.Zu();
+    lambda = warm.Lambda();
+}
+
+bool SolverSnapshot::Write(const std::string &path) const
+{
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp.c_str(), std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+        out.write(MAGIC, sizeof(MAGIC));
+        put(out, params_hash);
+        put(out, (unsigned long long)params_version);
+        put(out, stamp);
+
+        put(out, (unsigned char)(structure ? 1 : 0));
+        if (structure)
+        {
+            const TapeStructure &s = *structure;
+            put(out, (unsigned long long)n_vars);
+            put(out, (unsigned long long)n_constraints);
+            put(out, (unsigned long long)n_params);
+            put(out, (unsigned long long)size_var);
+            put(out, (unsigned long long)size_op);
+            put(out, hes_density);
+            putPattern(out, s.pattern_jac);
+            putPattern(out, s.pattern_hes);
+            putVector(out, s.row_jac);
+            putVector(out, s.col_jac);
+            putVector(out, s.row_hes);
+            putVector(out, s.col_hes);
+            putVector(out, s.row_sweep);
+            putVector(out, s.col_sweep);
+            putVector(out, s.sweep_entry);
+            putVector(out, s.const_entry);
+            std::vector<unsigned char> linear(s.linear_row.begin(), s.linear_row.end());
+            putVector(out, linear);
+            put(out, (unsigned char)s.const_jacobian);
+            put(out, (int)s.jac_method);
+            putString(out, s.work_jac.color_method);
+            putVector(out, s.work_jac.order);
+            putVector(out, s.work_jac.color);
+            putString(out, s.work_hes.color_method);
+            putVector(out, s.work_hes.row);
+            putVector(out, s.work_hes.col);
+            putVector(out, s.work_hes.order);
+            putVector(out, s.work_hes.color);
+            put(out, (unsigned long long)s.work_hes.group_max);
+        }
+
+        put(out, steps);
+        putVector(out, x);
+        putVector(out, zl);
+        putVector(out, zu);
+        putVector(out, lambda);
+        if (!out.flush())
+            return false;
+    }
+    return std::rename(tmp.c_str(), path.c_str()) == 0;
+}
+
+bool SolverSnapshot::Read(const std::string &path)
+{
+    std::ifstream in(path.c_str(), std::ios::binary | std::ios::ate);
+    if (!in)
+        return false;
+    const size_t left = size_t(in.tellg());
+    in.seekg(0);
+    char magic[sizeof(MAGIC)];
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+        return false;
+    unsigned long long version;
+    unsigned char has_structure;
+    if (!get(in, params_hash) || !get(in, version) || !get(in, stamp) || !get(in, has_structure))
+        return false;
+    params_version = version;
+
+    structure.reset();
+    if (has_structure)
+    {
+        std::shared_ptr<TapeStructure> read = std::make_shared<TapeStructure>();
+        TapeStructure &s = *read;
+        unsigned long long dims[5], group_max;
+        std::vector<unsigned char> linear;
+        unsigned char const_jacobian;
+        for (int k = 0; k < 5; k++)
+            if (!get(in, dims[k]))
+                return false;
+        if (!get(in, hes_density)
+            || !getPattern(in, left, s.pattern_jac) || !getPattern(in, left, s.pattern_hes)
+            || !getVector(in, left, s.row_jac, size_t()) || !getVector(in, left, s.col_jac, size_t())
+            || !getVector(in, left, s.row_hes, size_t()) || !getVector(in, left, s.col_hes, size_t())
+            || !getVector(in, left, s.row_sweep, size_t()) || !getVector(in, left, s.col_sweep, size_t())
+            || !getVector(in, left, s.sweep_entry, size_t()) || !getVector(in, left, s.const_entry, size_t())
+            || !getVector(in, left, linear, (unsigned char)0) || !get(in, const_jacobian) || !get(in, s.jac_method)
+            || !getString(in, left, s.work_jac.color_method)
+            || !getVector(in, left, s.work_jac.order, size_t()) || !getVector(in, left, s.work_jac.color, size_t())
+            || !getString(in, left, s.work_hes.color_method)
+            || !getVector(in, left, s.work_hes.row, size_t()) || !getVector(in, left, s.work_hes.col, size_t())
+            || !getVector(in, left, s.work_hes.order, size_t()) || !getVector(in, left, s.work_hes.color, size_t())
+            || !get(in, group_max))
+            return false;
+        s.linear_row.assign(linear.begin(), linear.end());
+        s.const_jacobian = const_jacobian != 0;
+        s.work_hes.group_max = group_max;
+        n_vars = dims[0];
+        n_constraints = dims[1];
+        n_params = dims[2];
+        size_var = dims[3];
+        size_op = dims[4];
+        structure = read;
+    }
+
+    return get(in, steps) && getVector(in, left, x, double()) && getVector(in, left, zl, double())
+           && getVector(in, left, zu, double()) && getVector(in, left, lambda, double());
+}
+
+unsigned long long SolverSnapshot::HashParams(const std::map<std::string, double> &params)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    for (std::map<std::string, double>::const_iterator it = params.begin(); it != params.end(); ++it)
+    {
+        const unsigned char *bytes = reinterpret_cast<const unsigned char *>(it->first.c_str());
+        for (size_t i = 0; i <= it->first.size(); i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+        bytes = reinterpret_cast<const unsigned char *>(&it->second);
+        for (size_t i = 0; i < sizeof(double); i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+double SolverSnapshot::Now()
+{
+    return std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,180 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "solver_thread.h"
+#include "trace_span.h"
+#include <cmath>
+
+MPCCommand::MPCCommand()
+{
+    stamp = 0.0;
+    dt = 0.0;
+}
+
+bool MPCCommand::Sample(double t, double &speed, double &angvel) const
+{
+    if (this->speed.empty() || this->speed.size() != this->angvel.size())
+        return false;
+    const int k = step(t);
+    if (k < 0)
+        return false;
+
+    speed = this->speed[k];
+    angvel = this->angvel[k];
+    return true;
+}
+
+bool MPCCommand::SampleTorque(double t, double &right, double &left) const
+{
+    if (torque_right.size() != this->speed.size() || torque_left.size() != this->speed.size())
+        return false;
+    const int k = step(t);
+    if (k < 0)
+        return false;
+
+    right = torque_right[k];
+    left = torque_left[k];
+    return true;
+}
+
+int MPCCommand::step(double t) const
+{
+    if (this->speed.empty() || dt <= 0.0)
+        return -1;
+
+    // Inputs are piecewise constant over each prediction step
+    const double elapsed = t - stamp;
+    int k = (elapsed > 0.0) ? int(std::floor(elapsed / dt)) : 0;
+    if (step_dt.size() == this->speed.size())
+    {
+        double end = step_dt[0];
+        for (k = 0; k < int(step_dt.size()) - 1 && elapsed >= end; k++)
+            end += step_dt[k + 1];
+        if (elapsed >= end)
+            return -1;
+    }
+    if (k >= int(this->speed.size()))
+        return -1;
+    return k;
+}
+
+SolverThread::SolverThread()
+{
+    _running = false;
+    _pending = false;
+    _valid = false;
+    _generation = 0;
+    _started = false;
+}
+
+SolverThread::~SolverThread()
+{
+    Stop();
+}
+
+void SolverThread::Start(const SolveFunction &solve, const RealtimeSettings &realtime)
+{
+    Stop();
+    _solve = solve;
+    _realtime = realtime;
+    _realtime_report.clear();
+    _running = true;
+    _pending = false;
+    _started = false;
+    _thread = std::thread(&SolverThread::Run, this);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cond.wait(lock, [this] { return _started; });
+}
+
+void SolverThread::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _running = false;
+    }
+    _cond.notify_all();
+    if (_thread.joinable())
+        _thread.join();
+}
+
+bool SolverThread::IsRunning() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _running;
+}
+
+void SolverThread::Notify()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending = true;
+    }
+    _cond.notify_one();
+}
+
+void SolverThread::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _valid = false;
+    _pending = false;
+    // A solve already running for the old request must not come back as valid
+    _generation++;
+}
+
+bool SolverThread::Latest(MPCCommand &cmd) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_valid)
+        return false;
+    cmd = _latest;
+    return true;
+}
+
+void SolverThread::Run()
+{
+    MPC_TRACE_THREAD("mpc_solver");
+    std::string report;
+    if (_realtime.Enabled())
+        _realtime.Apply(report);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _realtime_report = report;
+    _started = true;
+    _cond.notify_all();
+    while (true)
+    {
+        _cond.wait(lock, [this] { return _pending || !_running; });
+        if (!_running)
+            break;
+        _pending = false;
+        const unsigned int generation = _generation;
+
+        // Solve without holding the lock so the timer can keep publishing
+        lock.unlock();
+        MPCCommand cmd;
+        const bool ok = _solve(cmd);
+        lock.lock();
+
+        if (generation != _generation)
+            continue;
+        if (ok)
+        {
+            _latest = cmd;
+            _valid = true;
+        }
+    }
+}
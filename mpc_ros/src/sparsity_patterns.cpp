@@ -0,0 +1,136 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "sparsity_patterns.h"
+#include <set>
+#include <vector>
+
+namespace sparsity_patterns
+{
+    Representation Choose(int requested, size_t n, double density)
+    {
+        if (requested == PACK || requested == SET)
+            return (Representation)requested;
+        const size_t words = (n + CppAD::vectorBool::bit_per_unit() - 1) / CppAD::vectorBool::bit_per_unit();
+        if (words > 2 && density >= 0.0 && density * n < words)
+            return SET;
+        return PACK;
+    }
+
+    void Compute(CppAD::ADFun<double> &fun, Representation rep,
+                 CppAD::vectorBool &jac, CppAD::vectorBool &hes)
+    {
+        const size_t n = fun.Domain();
+        const size_t m = fun.Range();
+        if (rep == SET)
+        {
+            typedef std::vector<std::set<size_t> > SetVector;
+            // The forward pattern of the Hessian sweep is the Jacobian
+            SetVector id(n), all(1);
+            for (size_t j = 0; j < n; j++)
+                id[j].insert(j);
+            SetVector jac_set = fun.ForSparseJac(n, id);
+            for (size_t i = 0; i < m; i++)
+                all[0].insert(i);
+            SetVector hes_set = fun.RevSparseHes(n, all);
+            fun.size_forward_set(0);
+
+            jac.resize(m * n);
+            hes.resize(n * n);
+            for (size_t k = 0; k < m * n; k++)
+                jac[k] = false;
+            for (size_t k = 0; k < n * n; k++)
+                hes[k] = false;
+            for (size_t i = 0; i < m; i++)
+                for (std::set<size_t>::const_iterator it = jac_set[i].begin(); it != jac_set[i].end(); ++it)
+                    jac[i * n + *it] = true;
+            for (size_t i = 0; i < n; i++)
+                for (std::set<size_t>::const_iterator it = hes_set[i].begin(); it != hes_set[i].end(); ++it)
+                    hes[i * n + *it] = true;
+            return;
+        }
+
+        CppAD::vectorBool r(m * m);
+        for (size_t i = 0; i < m; i++)
+            for (size_t k = 0; k < m; k++)
+                r[i * m + k] = (i == k);
+        jac = fun.RevSparseJac(m, r);
+
+        CppAD::vectorBool id(n * n), s(m);
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++)
+                id[i * n + j] = (i == j);
+        fun.ForSparseJac(n, id);
+        for (size_t i = 0; i < m; i++)
+            s[i] = true;
+        hes = fun.RevSparseHes(n, s);
+        fun.size_forward_bool(0);
+    }
+
+    void ConstantEntries(CppAD::ADFun<double> &fun, const CppAD::vector<size_t> &row,
+                         const CppAD::vector<size_t> &col, CppAD::vector<bool> &constant)
+    {
+        const size_t n = fun.Domain();
+        const size_t m = fun.Range();
+        constant.resize(row.size());
+        if (row.size() == 0)
+            return;
+
+        CppAD::vectorBool id(n * n), s(m), hes;
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++)
+                id[i * n + j] = (i == j);
+        fun.ForSparseJac(n, id);
+        for (size_t i = 0; i < m; i++)
+            s[i] = false;
+        size_t k = 0;
+        while (k < row.size())
+        {
+            const size_t i = row[k];
+            s[i] = true;
+            hes = fun.RevSparseHes(n, s);
+            s[i] = false;
+            for (; k < row.size() && row[k] == i; k++)
+            {
+                bool linear = true;
+                for (size_t c = 0; c < n && linear; c++)
+                    linear = !hes[col[k] * n + c];
+                constant[k] = linear;
+            }
+        }
+        fun.size_forward_bool(0);
+    }
+
+    double Density(const CppAD::vectorBool &pattern, size_t n)
+    {
+        if (n == 0)
+            return 0.0;
+        size_t nnz = 0;
+        for (size_t k = 0; k < pattern.size(); k++)
+            nnz += pattern[k];
+        return (double)nnz / ((double)n * n);
+    }
+
+    const char *Name(int rep)
+    {
+        switch (rep)
+        {
+            case PACK: return "pack";
+            case SET: return "set";
+            default: return "auto";
+        }
+    }
+}
@@ -0,0 +1,212 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "speed_profile.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Waypoints closer than this are the same, a replan transformed to odom
+// again moves them by rounding only [m]
+static const double SAME_POINT = 1e-3;
+
+SpeedProfile::SpeedProfile() : _max_speed(0.5), _max_angvel(3.0), _max_lat_accel(0.5), _max_accel(1.0),
+                               _window(0.3), _end_speed(0.1), _recomputed(0) {}
+
+void SpeedProfile::Configure(double max_speed, double max_angvel, double max_lat_accel, double max_accel,
+                             double window, double end_speed)
+{
+    if (max_speed == _max_speed && max_angvel == _max_angvel && max_lat_accel == _max_lat_accel
+        && max_accel == _max_accel && window == _window && end_speed == _end_speed)
+    {
+        return;
+    }
+    _max_speed = max_speed;
+    _max_angvel = max_angvel;
+    _max_lat_accel = max_lat_accel;
+    _max_accel = max_accel;
+    _window = window;
+    _end_speed = end_speed;
+    // The path of the next Update() starts over
+    const CompactPath::ConstPtr path = _path;
+    Clear();
+    if (path)
+    {
+        Update(path);
+    }
+}
+
+void SpeedProfile::Clear()
+{
+    _path.reset();
+    _v.clear();
+    _recomputed = 0;
+}
+
+size_t SpeedProfile::matchingTail(const CompactPath &path) const
+{
+    if (!_path || _v.size() != _path->Size())
+    {
+        return 0;
+    }
+    const CompactPath &last = *_path;
+    size_t n = 0;
+    while (n < path.Size() && n < last.Size())
+    {
+        const size_t i = path.Size() - 1 - n, j = last.Size() - 1 - n;
+        if (std::fabs(path.X(i) - last.X(j)) > SAME_POINT || std::fabs(path.Y(i) - last.Y(j)) > SAME_POINT)
+        {
+            break;
+        }
+        n++;
+    }
+    return n;
+}
+
+// Speed limit of the curvature at waypoint i, [begin, end] the waypoints
+// half a window around it (moved along by the caller for the next i)
+double SpeedProfile::limit(const CompactPath &path, size_t i, size_t &begin, size_t &end) const
+{
+    const double s = path.S(i);
+    while (begin < i && path.S(begin + 1) <= s - 0.5 * _window)
+    {
+        begin++;
+    }
+    end = std::max(end, i);
+    while (end + 1 < path.Size() && path.S(end + 1) <= s + 0.5 * _window)
+    {
+        end++;
+    }
+    const size_t a = begin < i ? begin : (i > 0 ? i - 1 : i);
+    const size_t b = end > i ? end : (i + 1 < path.Size() ? i + 1 : i);
+    if (a == i || b == i)
+    {
+        return _max_speed;
+    }
+
+    // Menger curvature of a, i, b: 2 |cross| / (|ai| |ib| |ab|)
+    const double ux = path.X(i) - path.X(a), uy = path.Y(i) - path.Y(a);
+    const double wx = path.X(b) - path.X(i), wy = path.Y(b) - path.Y(i);
+    const double cross = std::fabs(ux * wy - uy * wx);
+    const double norms = std::hypot(ux, uy) * std::hypot(wx, wy) * std::hypot(ux + wx, uy + wy);
+    const double curvature = norms > 0 ? 2.0 * cross / norms : 0.0;
+    double v = _max_speed;
+    if (curvature > 1e-9)
+    {
+        v = std::min(v, _max_angvel / curvature);
+        v = std::min(v, std::sqrt(_max_lat_accel / curvature));
+    }
+    return v;
+}
+
+void SpeedProfile::Update(const CompactPath::ConstPtr &path)
+{
+    if (path == _path)
+    {
+        return;
+    }
+    if (!path || path->Empty())
+    {
+        Clear();
+        return;
+    }
+
+    // Braking only looks ahead: the speeds of a matching tail hold, but for
+    // the waypoints whose curvature window reaches before the tail
+    const size_t tail = matchingTail(*path);
+    const size_t n = path->Size();
+    size_t keep = n - tail;
+    while (tail > 0 && keep < n && path->S(keep) - path->S(n - tail) < 0.5 * _window)
+    {
+        keep++;
+    }
+    _v_prev.swap(_v);
+    _v.resize(n);
+    for (size_t i = keep; i < n; i++)
+    {
+        _v[i] = _v_prev[_v_prev.size() - (n - i)];
+    }
+    _recomputed = keep;
+
+    size_t begin = 0, end = 0;
+    for (size_t i = 0; i < keep; i++)
+    {
+        _v[i] = limit(*path, i, begin, end);
+    }
+    if (keep == n)
+    {
+        _v[n - 1] = std::min(_v[n - 1], std::max(0.0, _end_speed));
+        keep = n - 1;
+    }
+    for (size_t i = keep; i-- > 0;)
+    {
+        const double ds = path->S(i + 1) - path->S(i);
+        _v[i] = std::min(_v[i], std::sqrt(_v[i + 1] * _v[i + 1] + 2.0 * _max_accel * ds));
+    }
+    _path = path;
+}
+
+bool SpeedProfile::Adopt(SpeedProfile &profile, const CompactPath::ConstPtr &path)
+{
+    // A rigid transform keeps the arc lengths
+    if (!path || !profile._path || profile._path->Size() != path->Size() || profile._v.size() != path->Size()
+        || std::fabs(profile._path->Length() - path->Length()) > SAME_POINT || profile._max_speed != _max_speed
+        || profile._max_angvel != _max_angvel || profile._max_lat_accel != _max_lat_accel
+        || profile._max_accel != _max_accel || profile._window != _window || profile._end_speed != _end_speed)
+    {
+        return false;
+    }
+    _v_prev.swap(_v);
+    _v.swap(profile._v);
+    _path = path;
+    _recomputed = 0;
+    profile.Clear();
+    return true;
+}
+
+double SpeedProfile::Speed(double s) const
+{
+    if (_v.empty())
+    {
+        return _max_speed;
+    }
+    const std::vector<double> &ss = _path->Ss();
+    const size_t i = std::upper_bound(ss.begin(), ss.end(), s) - ss.begin();
+    if (i == 0)
+    {
+        return _v.front();
+    }
+    if (i >= ss.size())
+    {
+        return _v.back();
+    }
+    const double ds = ss[i] - ss[i - 1];
+    const double t = ds > 0 ? (s - ss[i - 1]) / ds : 0.0;
+    return _v[i - 1] + t * (_v[i] - _v[i - 1]);
+}
+
+void SpeedProfile::Reference(double s, double v, double dt, size_t n, double *speeds) const
+{
+    v = std::max(0.0, v);
+    for (size_t i = 0; i < n; i++)
+    {
+        // Not faster than the profile here nor than accelerating from the
+        // step before allows, the profile brakes in time by itself
+        v = std::min(Speed(s), v + _max_accel * dt);
+        speeds[i] = v;
+        s += v * dt;
+    }
+}
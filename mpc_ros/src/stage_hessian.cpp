@@ -0,0 +1,237 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "stage_hessian.h"
+
+#include <map>
+#include <utility>
+#include "work_stealing_pool.h"
+
+StageHessian::~StageHessian()
+{
+    SetThreads(std::shared_ptr<WorkStealingPool>());
+}
+
+size_t StageHessian::AddKind(size_t n_z, size_t n_hes, size_t n_h, const StageFunction &stage)
+{
+    _kinds.push_back(record(n_z, n_hes, n_h, stage));
+    _mapped = false;
+    // The workers record the new kind on their next Evaluate()
+    if (_pool)
+        runWorkers([this](size_t k) { _workers[k].kinds.clear(); });
+    return _kinds.size() - 1;
+}
+
+std::unique_ptr<StageHessian::Kind> StageHessian::record(size_t n_z, size_t n_hes, size_t n_h,
+                                                         const StageFunction &stage)
+{
+    std::unique_ptr<Kind> kind(new Kind());
+    kind->stage = stage;
+    ADvector a_z(n_z), a_h(n_h);
+    for (size_t j = 0; j < n_z; j++)
+        a_z[j] = 0.0;
+    CppAD::Independent(a_z);
+    stage(a_h, a_z);
+    kind->fun.Dependent(a_z, a_h);
+    kind->fun.optimize();
+    kind->n_z = n_z;
+    kind->n_hes = n_hes;
+    kind->n_h = n_h;
+
+    // Every output may be weighted, as in TapeSolver::Record()
+    CppAD::vectorBool eye(n_z * n_z), all(n_h);
+    for (size_t i = 0; i < n_z; i++)
+        for (size_t j = 0; j < n_z; j++)
+            eye[i * n_z + j] = i == j;
+    for (size_t i = 0; i < n_h; i++)
+        all[i] = true;
+    kind->fun.ForSparseJac(n_z, eye);
+    kind->pattern = kind->fun.RevSparseHes(n_z, all);
+    kind->fun.capacity_order(0);
+    for (size_t i = 0; i < n_hes; i++)
+        for (size_t j = 0; j <= i; j++)
+            if (kind->pattern[i * n_z + j])
+            {
+                kind->row.push_back(i);
+                kind->col.push_back(j);
+            }
+    kind->z.resize(n_z);
+    kind->w.resize(n_h);
+    kind->hes.resize(kind->row.size());
+    return kind;
+}
+
+void StageHessian::AddStage(size_t kind, const std::vector<size_t> &source, const std::vector<size_t> &row)
+{
+    Stage stage;
+    stage.kind = kind;
+    stage.source = source;
+    stage.row = row;
+    _stages.push_back(stage);
+    _mapped = false;
+}
+
+bool StageHessian::Map(const CppAD::vector<size_t> &row_hes, const CppAD::vector<size_t> &col_hes)
+{
+    _mapped = false;
+    std::map<std::pair<size_t, size_t>, size_t> entry;
+    for (size_t k = 0; k < row_hes.size(); k++)
+        entry[std::make_pair(row_hes[k], col_hes[k])] = k;
+    for (size_t s = 0; s < _stages.size(); s++)
+    {
+        Stage &stage = _stages[s];
+        const Kind &kind = *_kinds[stage.kind];
+        if (stage.source.size() != kind.z.size() || stage.row.size() != kind.w.size())
+            return false;
+        stage.slot.resize(kind.row.size());
+        stage.scale.resize(kind.row.size());
+        for (size_t e = 0; e < kind.row.size(); e++)
+        {
+            size_t i = stage.source[kind.row[e]], j = stage.source[kind.col[e]];
+            if (i < j)
+                std::swap(i, j);
+            std::map<std::pair<size_t, size_t>, size_t>::const_iterator it = entry.find(std::make_pair(i, j));
+            if (it == entry.end())
+                return false;
+            stage.slot[e] = it->second;
+            stage.scale[e] = i == j && kind.row[e] != kind.col[e] ? 2.0 : 1.0;
+        }
+    }
+    _mapped = true;
+    return true;
+}
+
+void StageHessian::Evaluate(const Dvector &x, const Dvector &w, Dvector &hes)
+{
+    const size_t n_blocks = _workers.size() + 1, n_stages = _stages.size();
+    if (n_blocks > 1)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _pending = _workers.size();
+        }
+        for (size_t b = 1; b < n_blocks; b++)
+        {
+            Worker *worker = &_workers[b - 1];
+            const size_t begin = b * n_stages / n_blocks, end = (b + 1) * n_stages / n_blocks;
+            const size_t n_hes = hes.size();
+            _pool->Submit(int(b - 1), [this, worker, begin, end, n_hes, &x, &w]() {
+                if (worker->kinds.size() != _kinds.size())
+                {
+                    worker->kinds.clear();
+                    for (size_t k = 0; k < _kinds.size(); k++)
+                    {
+                        const Kind &kind = *_kinds[k];
+                        worker->kinds.push_back(record(kind.n_z, kind.n_hes, kind.n_h, kind.stage));
+                    }
+                }
+                worker->hes.resize(n_hes);
+                evaluate(worker->kinds, begin, end, x, w, worker->hes);
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (--_pending == 0)
+                    _done.notify_one();
+            }, true);
+        }
+    }
+    evaluate(_kinds, 0, n_stages / n_blocks, x, w, hes);
+    if (n_blocks == 1)
+        return;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done.wait(lock, [this] { return _pending == 0; });
+    }
+    for (size_t b = 0; b < _workers.size(); b++)
+        for (size_t k = 0; k < hes.size(); k++)
+            hes[k] += _workers[b].hes[k];
+}
+
+void StageHessian::evaluate(std::vector<std::unique_ptr<Kind> > &kinds, size_t begin, size_t end,
+                            const Dvector &x, const Dvector &w, Dvector &hes) const
+{
+    for (size_t k = 0; k < hes.size(); k++)
+        hes[k] = 0;
+    for (size_t s = begin; s < end; s++)
+    {
+        const Stage &stage = _stages[s];
+        Kind &kind = *kinds[stage.kind];
+        if (kind.row.size() == 0)
+            continue;
+        for (size_t j = 0; j < stage.source.size(); j++)
+            kind.z[j] = x[stage.source[j]];
+        for (size_t i = 0; i < stage.row.size(); i++)
+            kind.w[i] = w[stage.row[i]];
+        kind.fun.SparseHessian(kind.z, kind.w, kind.pattern, kind.row, kind.col, kind.hes, kind.work);
+        for (size_t e = 0; e < stage.slot.size(); e++)
+            hes[stage.slot[e]] += stage.scale[e] * kind.hes[e];
+    }
+}
+
+void StageHessian::SetThreads(const std::shared_ptr<WorkStealingPool> &pool)
+{
+    if (pool == _pool)
+        return;
+    // CppAD memory is freed by the thread that allocated it
+    if (_pool)
+    {
+        runWorkers([this](size_t k) {
+            _workers[k].kinds.clear();
+            _workers[k].hes.clear();
+        });
+    }
+    _workers.clear();
+    _pool = pool;
+    if (_pool)
+        _workers = std::vector<Worker>(_pool->Size());
+}
+
+void StageHessian::runWorkers(const std::function<void(size_t)> &task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending = _workers.size();
+    }
+    for (size_t k = 0; k < _workers.size(); k++)
+    {
+        _pool->Submit(int(k), [this, k, &task]() {
+            task(k);
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (--_pending == 0)
+                _done.notify_one();
+        }, true);
+    }
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done.wait(lock, [this] { return _pending == 0; });
+}
+
+size_t StageHessian::Bytes() const
+{
+    size_t bytes = 0;
+    for (size_t k = 0; k < _kinds.size(); k++)
+    {
+        const Kind &kind = *_kinds[k];
+        bytes += kind.fun.Memory() + kind.pattern.capacity() / 8
+                 + (kind.row.capacity() + kind.col.capacity() + kind.work.order.capacity()
+                    + kind.work.color.capacity()) * sizeof(size_t)
+                 + (kind.z.capacity() + kind.w.capacity() + kind.hes.capacity()) * sizeof(double);
+    }
+    for (size_t s = 0; s < _stages.size(); s++)
+    {
+        const Stage &stage = _stages[s];
+        bytes += (stage.source.size() + stage.row.size() + stage.slot.size()) * sizeof(size_t)
+                 + stage.scale.size() * sizeof(double);
+    }
+    return bytes;
+}
@@ -0,0 +1,225 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "state_estimator.h"
+
+#include <cmath>
+#include <Eigen/LU>
+
+static double wrapAngle(double a)
+{
+    return std::atan2(std::sin(a), std::cos(a));
+}
+
+StateEstimator::StateEstimator()
+{
+    Configure(0.5, 1.0, 0.02, 0.05, 0.02, 0.05, 0.05, 0.5);
+}
+
+void StateEstimator::Configure(double accel_noise, double angaccel_noise, double wheel_v_noise, double wheel_w_noise,
+                               double gyro_noise, double position_noise, double heading_noise, double max_age)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _accel_noise = accel_noise;
+    _angaccel_noise = angaccel_noise;
+    _wheel_v_noise = wheel_v_noise;
+    _wheel_w_noise = wheel_w_noise;
+    _gyro_noise = gyro_noise;
+    _position_noise = position_noise;
+    _heading_noise = heading_noise;
+    _max_age = max_age;
+    _initialized = false;
+    _history_next = _history_size = 0;
+}
+
+void StateEstimator::Reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _initialized = false;
+    _history_next = _history_size = 0;
+}
+
+bool StateEstimator::Initialized() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _initialized;
+}
+
+double StateEstimator::Stamp() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stamp;
+}
+
+// Constant v and w over dt, the heading of the middle of the step
+void StateEstimator::propagate(State &x, double dt)
+{
+    const double theta = x[THETA] + 0.5 * x[W] * dt;
+    x[X] += x[V] * std::cos(theta) * dt;
+    x[Y] += x[V] * std::sin(theta) * dt;
+    x[THETA] = wrapAngle(x[THETA] + x[W] * dt);
+}
+
+void StateEstimator::predict(double stamp)
+{
+    const double dt = stamp - _stamp;
+    if (dt <= 0)
+    {
+        return;
+    }
+    const double theta = _x[THETA] + 0.5 * _x[W] * dt;
+    const double c = std::cos(theta), s = std::sin(theta);
+    Covariance f = Covariance::Identity();
+    f(X, THETA) = -_x[V] * s * dt;
+    f(X, V) = c * dt;
+    f(Y, THETA) = _x[V] * c * dt;
+    f(Y, V) = s * dt;
+    f(THETA, W) = dt;
+    propagate(_x, dt);
+    _p = f * _p * f.transpose();
+    _p(V, V) += _accel_noise * _accel_noise * dt;
+    _p(W, W) += _angaccel_noise * _angaccel_noise * dt;
+    _stamp = stamp;
+}
+
+// State at a stamp before the newest one, from the last state kept before it
+bool StateEstimator::past(double stamp, State &x) const
+{
+    for (int k = 1; k <= _history_size; k++)
+    {
+        const int i = (_history_next - k + HISTORY) % HISTORY;
+        if (_history_stamp[i] <= stamp)
+        {
+            x = _history[i];
+            propagate(x, stamp - _history_stamp[i]);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <int M>
+void StateEstimator::correct(double stamp, const Eigen::Matrix<double, M, SIZE> &h, const Eigen::Matrix<double, M, 1> &z,
+                             const Eigen::Matrix<double, M, M> &r, bool angle)
+{
+    State at;
+    if (stamp >= _stamp)
+    {
+        predict(stamp);
+        at = _x;
+    }
+    else if (_stamp - stamp > _max_age || !past(stamp, at))
+    {
+        return;
+    }
+
+    // The residual of the measurement's time corrects the current state
+    Eigen::Matrix<double, M, 1> residual = z - h * at;
+    if (angle)
+    {
+        residual[THETA] = wrapAngle(residual[THETA]);
+    }
+    const Eigen::Matrix<double, M, M> innovation = h * _p * h.transpose() + r;
+    const Eigen::Matrix<double, SIZE, M> gain = _p * h.transpose() * innovation.inverse();
+    _x += gain * residual;
+    _x[THETA] = wrapAngle(_x[THETA]);
+    _p = (Covariance::Identity() - gain * h) * _p;
+
+    _history_stamp[_history_next] = _stamp;
+    _history[_history_next] = _x;
+    _history_next = (_history_next + 1) % HISTORY;
+    if (_history_size < HISTORY)
+    {
+        _history_size++;
+    }
+}
+
+void StateEstimator::UpdatePose(double stamp, double x, double y, double theta, double var_xy, double var_theta)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (var_xy <= 0)
+    {
+        var_xy = _position_noise * _position_noise;
+    }
+    if (var_theta <= 0)
+    {
+        var_theta = _heading_noise * _heading_noise;
+    }
+    if (!_initialized)
+    {
+        _x << x, y, wrapAngle(theta), 0.0, 0.0;
+        _p = Covariance::Identity();
+        _p(X, X) = _p(Y, Y) = var_xy;
+        _p(THETA, THETA) = var_theta;
+        _stamp = stamp;
+        _history_next = _history_size = 0;
+        _initialized = true;
+        return;
+    }
+    Eigen::Matrix<double, 3, SIZE> h = Eigen::Matrix<double, 3, SIZE>::Zero();
+    h(0, X) = h(1, Y) = h(2, THETA) = 1.0;
+    const Eigen::Matrix<double, 3, 1> z(x, y, theta);
+    const Eigen::Matrix<double, 3, 1> r(var_xy, var_xy, var_theta);
+    correct<3>(stamp, h, z, r.asDiagonal(), true);
+}
+
+void StateEstimator::UpdateWheels(double stamp, double v, double w)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_initialized)
+    {
+        return;
+    }
+    Eigen::Matrix<double, 2, SIZE> h = Eigen::Matrix<double, 2, SIZE>::Zero();
+    h(0, V) = h(1, W) = 1.0;
+    const Eigen::Matrix<double, 2, 1> z(v, w);
+    const Eigen::Matrix<double, 2, 1> r(_wheel_v_noise * _wheel_v_noise, _wheel_w_noise * _wheel_w_noise);
+    correct<2>(stamp, h, z, r.asDiagonal(), false);
+}
+
+void StateEstimator::UpdateGyro(double stamp, double w)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_initialized)
+    {
+        return;
+    }
+    Eigen::Matrix<double, 1, SIZE> h = Eigen::Matrix<double, 1, SIZE>::Zero();
+    h(0, W) = 1.0;
+    const Eigen::Matrix<double, 1, 1> z(w);
+    const Eigen::Matrix<double, 1, 1> r(_gyro_noise * _gyro_noise);
+    correct<1>(stamp, h, z, r, false);
+}
+
+bool StateEstimator::Predict(double stamp, double &x, double &y, double &theta, double &v, double &w) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_initialized)
+    {
+        return false;
+    }
+    State s = _x;
+    if (stamp > _stamp)
+    {
+        propagate(s, stamp - _stamp);
+    }
+    x = s[X];
+    y = s[Y];
+    theta = s[THETA];
+    v = s[V];
+    w = s[W];
+    return true;
+}
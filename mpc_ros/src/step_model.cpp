@@ -0,0 +1,174 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "step_model.h"
+#include "tape_optimize.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+using CppAD::AD;
+
+namespace
+{
+    // The step of every StepModel as recorded by the calling thread, freed
+    // by that thread when it exits as CppAD wants it
+    thread_local std::map<const StepModel*, std::unique_ptr<CppAD::ADFun<double> > > t_funs;
+}
+
+void StepModel::Residuals(const ADvector &in, ADvector &out, size_t n_coeffs, bool path_heading)
+{
+    const AD<double> &x0 = in[X0];
+    const AD<double> &y0 = in[Y0];
+    const AD<double> &theta0 = in[THETA0];
+    const AD<double> &v0 = in[V0];
+    const AD<double> &etheta0 = in[ETHETA0];
+    const AD<double> &w0 = in[ANGVEL];
+    const AD<double> &a0 = in[ACCEL];
+    const AD<double> &dt = in[DT];
+
+    // f(x0) and f'(x0) in Horner form, multiplies and adds instead of pow
+    AD<double> f0 = in[COEFFS + n_coeffs - 1], grad0 = 0.0;
+    for (int k = (int)n_coeffs - 2; k >= 0; k--)
+    {
+        grad0 = grad0 * x0 + f0;
+        f0 = f0 * x0 + in[COEFFS + k];
+    }
+
+    AD<double> sin0, cos0;
+    CppAD::sincos(theta0, sin0, cos0);
+    out[R_X] = in[X1] - (x0 + v0 * cos0 * dt);
+    out[R_Y] = in[Y1] - (y0 + v0 * sin0 * dt);
+    out[R_THETA] = in[THETA1] - (theta0 + w0 * dt);
+    out[R_V] = in[V1] - (v0 + a0 * dt);
+    out[R_CTE] = in[CTE1] - ((f0 - y0) + (v0 * CppAD::sin(etheta0) * dt));
+    if (path_heading)
+    {
+        out[R_ETHETA] = in[ETHETA1] - ((theta0 - CppAD::atan(grad0)) + w0 * dt);
+    }
+    else
+    {
+        out[R_ETHETA] = in[ETHETA1] - (etheta0 + w0 * dt);
+    }
+}
+
+StepModel *StepModel::Get(size_t n_coeffs, bool path_heading)
+{
+    typedef std::pair<size_t, bool> Key;
+    static std::mutex mutex;
+    static std::map<Key, StepModel*> models; // never freed, tapes refer to them
+    std::lock_guard<std::mutex> lock(mutex);
+    const Key key(n_coeffs, path_heading);
+    std::map<Key, StepModel*>::const_iterator it = models.find(key);
+    if (it != models.end())
+    {
+        return it->second;
+    }
+    if (n_coeffs == 0 || CppAD::thread_alloc::in_parallel())
+    {
+        return NULL;
+    }
+    StepModel *model = new StepModel(n_coeffs, path_heading);
+    models[key] = model;
+    return model;
+}
+
+StepModel::StepModel(size_t n_coeffs, bool path_heading)
+    : PatternAtomic(name(n_coeffs, path_heading), COEFFS + n_coeffs, NUM_RESIDUALS),
+      _n_coeffs(n_coeffs), _path_heading(path_heading)
+{
+    // The patterns of the step do not depend on the point
+    CppAD::ADFun<double> &f = fun();
+    const size_t n = _n_in, m = NUM_RESIDUALS;
+    CppAD::vector<bool> id(n * n), s(m);
+    for (size_t j = 0; j < n * n; j++)
+    {
+        id[j] = (j / n == j % n);
+    }
+    const CppAD::vector<bool> jac = f.ForSparseJac(n, id);
+    std::vector<bool> hes(m * n * n);
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t k = 0; k < m; k++)
+        {
+            s[k] = (k == i);
+        }
+        const CppAD::vector<bool> hes_i = f.RevSparseHes(n, s);
+        std::copy(hes_i.data(), hes_i.data() + n * n, hes.begin() + i * n * n);
+    }
+    f.size_forward_bool(0);
+    SetPattern(std::vector<bool>(jac.data(), jac.data() + m * n), hes);
+}
+
+std::string StepModel::name(size_t n_coeffs, bool path_heading)
+{
+    std::ostringstream ss;
+    ss << "mpc_step_" << n_coeffs << (path_heading ? "_path_heading" : "");
+    return ss.str();
+}
+
+void StepModel::Prepare() const
+{
+    fun();
+}
+
+CppAD::ADFun<double> &StepModel::fun() const
+{
+    std::unique_ptr<CppAD::ADFun<double> > &f = t_funs[this];
+    if (!f)
+    {
+        ADvector in(_n_in), out(NUM_RESIDUALS);
+        for (size_t j = 0; j < _n_in; j++)
+        {
+            in[j] = 0.0;
+        }
+        CppAD::Independent(in);
+        Residuals(in, out, _n_coeffs, _path_heading);
+        f.reset(new CppAD::ADFun<double>(in, out));
+        tape_optimize::Apply(*f, tape_optimize::STRAIGHT_LINE);
+    }
+    return *f;
+}
+
+bool StepModel::forward(size_t p, size_t q, const CppAD::vector<bool> &vx, CppAD::vector<bool> &vy,
+                        const CppAD::vector<double> &tx, CppAD::vector<double> &ty)
+{
+    if (vx.size() > 0)
+    {
+        Variables(vx, vy);
+    }
+    // The Taylor coefficients in the ADFun are those of the last step that
+    // was evaluated, so orders below p are computed again
+    const CppAD::vector<double> y = fun().Forward(q, tx);
+    for (size_t i = 0; i < NUM_RESIDUALS; i++)
+    {
+        for (size_t k = p; k <= q; k++)
+        {
+            ty[i * (q + 1) + k] = y[i * (q + 1) + k];
+        }
+    }
+    return true;
+}
+
+bool StepModel::reverse(size_t q, const CppAD::vector<double> &tx, const CppAD::vector<double> &ty,
+                        CppAD::vector<double> &px, const CppAD::vector<double> &py)
+{
+    CppAD::ADFun<double> &f = fun();
+    f.Forward(q, tx);
+    px = f.Reverse(q + 1, py);
+    return true;
+}
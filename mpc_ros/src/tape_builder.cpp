@@ -0,0 +1,97 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "tape_builder.h"
+#include <chrono>
+
+TapeBuilder::TapeBuilder()
+{
+    _state = DONE;
+    _built = NULL;
+    _record_ms = 0.0;
+    _id = 0;
+}
+
+TapeBuilder::~TapeBuilder()
+{
+    Cancel();
+}
+
+void TapeBuilder::Start(const RecordFunction &record, unsigned long id)
+{
+    Cancel();
+    _state = RECORDING;
+    _built = NULL;
+    _id = id;
+    _thread = std::thread(&TapeBuilder::Run, this, record);
+}
+
+void TapeBuilder::Cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _state = DONE;
+    }
+    _cond.notify_all();
+    Join();
+}
+
+void TapeBuilder::Wait()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cond.wait(lock, [this] { return _state != RECORDING; });
+}
+
+bool TapeBuilder::Take(TapeSolver &tape, double &record_ms)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_state != READY)
+            return false;
+        tape.CopyFrom(*_built);
+        record_ms = _record_ms;
+        _state = DONE;
+    }
+    _cond.notify_all();
+    Join();
+    return true;
+}
+
+void TapeBuilder::Run(RecordFunction record)
+{
+    TapeSolver built;
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    record(built);
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    // Wait until the tape was copied or the build abandoned, the copy
+    // here is freed by this thread on return
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_state != RECORDING)
+        return;
+    _built = &built;
+    _record_ms = ms;
+    _state = READY;
+    _cond.notify_all();
+    _cond.wait(lock, [this] { return _state == DONE; });
+    _built = NULL;
+}
+
+void TapeBuilder::Join()
+{
+    if (_thread.joinable())
+        _thread.join();
+}
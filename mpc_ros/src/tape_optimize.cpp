@@ -0,0 +1,52 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "tape_optimize.h"
+
+namespace tape_optimize
+{
+    const char *Options(int level)
+    {
+        return level == CPPAD_DEFAULT ? "" : "no_conditional_skip no_compare_op";
+    }
+
+    void Apply(CppAD::ADFun<double> &fun, int level)
+    {
+        if (level == NONE)
+            return;
+        fun.optimize(Options(level));
+    }
+
+    void Apply(CppAD::ADFun<float> &fun, int level)
+    {
+        if (level == NONE)
+            return;
+        fun.optimize(Options(level));
+    }
+
+    std::string SolveOptions(int level)
+    {
+        switch (level)
+        {
+            case NONE:
+                return "Optimize false\n";
+            case CPPAD_DEFAULT:
+                return "Optimize true\n";
+            default:
+                return "Optimize no_conditional_skip\nOptimize no_compare_op\n";
+        }
+    }
+}
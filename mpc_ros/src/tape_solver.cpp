@@ -0,0 +1,1499 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "tape_solver.h"
+#include "ipopt_util.h"
+#include "sparsity_patterns.h"
+#include "stage_hessian.h"
+#include "trace_span.h"
+#include <algorithm>
+#include <cmath>
+#include <set>
+#ifdef MPC_CODEGEN
+#include "codegen_model.h"
+#endif
+
+using CppAD::AD;
+typedef TapeSolver::Dvector Dvector;
+typedef TapeSolver::Fvector Fvector;
+typedef CppAD::ipopt::solve_result<Dvector> SolveResult;
+
+// =========================================
+// Ipopt interface over a recorded TapeSolver
+// =========================================
+// Same evaluation scheme as CppAD::ipopt::solve_callback, except that the
+// tape, the patterns and the work vectors belong to the TapeSolver (the
+// latter two to its TapeStructure, which may be shared) and the
+// parameter tail of the tape domain is filled from params. A generated
+// model, if loaded, is evaluated instead of the tape, the single precision
+// tape for the Jacobian and the Hessian if there is one.
+//
+// One TapeNLP lives as long as the tape, so that Ipopt can re-optimize it;
+// the data of each solve is attached with Bind().
+class TapeNLP : public Ipopt::TNLP
+{
+    public:
+        typedef Ipopt::Index Index;
+        typedef Ipopt::Number Number;
+
+        // Bytes of the vectors kept between solves
+        size_t Bytes() const
+        {
+            size_t bytes = _select_domain.capacity() * sizeof(bool) + _dw_col.capacity() * sizeof(size_t)
+                           + (_jac_row.capacity() + _dw.capacity() + _xp.capacity() + _fg0.capacity()
+                              + _w1.capacity() + _grad1.capacity() + _jac1.capacity() + _f0.capacity()
+                              + _g0.capacity() + _w_obj.capacity() + _w_con.capacity()) * sizeof(double)
+                           + (_hes_x.capacity() + _hes_lambda.capacity() + _hes_values.capacity()) * sizeof(double)
+                           + _xpf.capacity() * sizeof(float);
+#ifdef MPC_CODEGEN
+            bytes += (_x_gen.capacity() + _fg_gen.capacity() + _jac_gen.capacity() + _hes_gen.capacity()) * sizeof(double);
+#endif
+            return bytes;
+        }
+
+        TapeNLP(TapeSolver &solver)
+            : _solver(solver), _jacobian(ipopt_util::JACOBIAN_REVERSE),
+              _xi(NULL), _xl(NULL), _xu(NULL), _gl(NULL), _gu(NULL), _solution(NULL),
+              _zl(NULL), _zu(NULL), _lambda(NULL), _first_valid(false), _obj_valid(false), _con_valid(false),
+              _hes_valid(false), _hes_age(0), _hes_obj_factor(0.0)
+        {
+            _nx = solver._nx;
+            _ng = solver._ng;
+            _xp.resize(_nx + solver._np);
+            _xpf.resize(_nx + solver._np);
+        }
+
+        // Problem data of the next solve, must outlive it
+        void Bind(ipopt_util::Jacobian jacobian, const Dvector &params,
+                  const Dvector &xi, const Dvector &xl, const Dvector &xu,
+                  const Dvector &gl, const Dvector &gu, SolveResult &solution,
+                  const Dvector *zl, const Dvector *zu, const Dvector *lambda)
+        {
+            _jacobian = jacobian;
+            _xi = &xi;
+            _xl = &xl;
+            _xu = &xu;
+            _gl = &gl;
+            _gu = &gu;
+            _solution = &solution;
+            _zl = zl;
+            _zu = zu;
+            _lambda = lambda;
+            for (size_t j = 0; j < _solver._np; j++)
+            {
+                _xp[_nx + j] = params[j];
+                _xpf[_nx + j] = params[j];
+            }
+            _first_valid = false;
+            _obj_valid = false;
+            _con_valid = false;
+            _hes_valid = false;
+#ifdef MPC_CODEGEN
+            _jac_gen_valid = false;
+#endif
+        }
+
+        virtual bool get_nlp_info(Index& n, Index& m, Index& nnz_jac_g, Index& nnz_h_lag, IndexStyleEnum& index_style)
+        {
+            n = static_cast<Index>(_nx);
+            m = static_cast<Index>(_ng);
+            nnz_jac_g = static_cast<Index>(_solver._structure->row_jac.size());
+            nnz_h_lag = static_cast<Index>(_solver._structure->row_hes.size());
+            index_style = C_STYLE;
+            return true;
+        }
+
+        virtual bool get_bounds_info(Index n, Number* x_l, Number* x_u, Index m, Number* g_l, Number* g_u)
+        {
+            for (size_t j = 0; j < _nx; j++)
+            {
+                x_l[j] = (*_xl)[j];
+                x_u[j] = (*_xu)[j];
+            }
+            for (size_t i = 0; i < _ng; i++)
+            {
+                g_l[i] = (*_gl)[i];
+                g_u[i] = (*_gu)[i];
+            }
+            return true;
+        }
+
+        virtual bool get_starting_point(Index n, bool init_x, Number* x, bool init_z, Number* z_L, Number* z_U,
+                                        Index m, bool init_lambda, Number* lambda)
+        {
+            if (init_x)
+            {
+                for (size_t j = 0; j < _nx; j++)
+                    x[j] = (*_xi)[j];
+            }
+            if (init_z)
+            {
+                for (size_t j = 0; j < _nx; j++)
+                {
+                    z_L[j] = _zl ? (*_zl)[j] : 0.0;
+                    z_U[j] = _zu ? (*_zu)[j] : 0.0;
+                }
+            }
+            if (init_lambda)
+            {
+                for (size_t i = 0; i < _ng; i++)
+                    lambda[i] = _lambda ? (*_lambda)[i] : 0.0;
+            }
+            return true;
+        }
+
+        virtual bool eval_f(Index n, const Number* x, bool new_x, Number& obj_value)
+        {
+            MPC_TRACE_SPAN("eval_f");
+            CallbackTimer timer(_solver._profile, TapeProfile::EVAL_F);
+            if (new_x)
+                cacheNewX(x);
+            obj_value = split() ? objective()[0] : _fg0[0];
+            return true;
+        }
+
+        virtual bool eval_grad_f(Index n, const Number* x, bool new_x, Number* grad_f)
+        {
+            MPC_TRACE_SPAN("eval_grad_f");
+            CallbackTimer timer(_solver._profile, TapeProfile::EVAL_GRAD_F);
+            if (new_x)
+                cacheNewX(x);
+#ifdef MPC_CODEGEN
+            if (_solver._generated)
+            {
+                generatedJacobian();
+                for (size_t j = 0; j < _nx; j++)
+                    grad_f[j] = 0.0;
+                for (size_t k = 0; k < _solver._gen_grad.size(); k++)
+                    grad_f[_solver._gen_grad_col[k]] = _jac_gen[_solver._gen_grad[k]];
+                return true;
+            }
+#endif
+            if (split())
+            {
+                // The order one sweep of the cost tape at its zero order
+                // coefficients
+                objective();
+                _w_obj.resize(1);
+                _w_obj[0] = 1.0;
+                _dw = _solver._fun_obj.Reverse(1, _w_obj);
+                for (size_t j = 0; j < _nx; j++)
+                    grad_f[j] = _dw[j];
+                return true;
+            }
+            if (firstOrder())
+            {
+                for (size_t j = 0; j < _nx; j++)
+                    grad_f[j] = _grad1[j];
+                return true;
+            }
+            Dvector w(1 + _ng), dw(_xp.size());
+            w[0] = 1.0;
+            for (size_t i = 0; i < _ng; i++)
+                w[1 + i] = 0.0;
+            dw = _solver._fun.Reverse(1, w);
+            for (size_t j = 0; j < _nx; j++)
+                grad_f[j] = dw[j];
+            return true;
+        }
+
+        virtual bool eval_g(Index n, const Number* x, bool new_x, Index m, Number* g)
+        {
+            MPC_TRACE_SPAN("eval_g");
+            CallbackTimer timer(_solver._profile, TapeProfile::EVAL_G);
+            if (new_x)
+                cacheNewX(x);
+            if (split())
+            {
+                for (size_t i = 0; i < _ng; i++)
+                    g[i] = constraints()[i];
+                return true;
+            }
+            for (size_t i = 0; i < _ng; i++)
+                g[i] = _fg0[1 + i];
+            return true;
+        }
+
+        virtual bool eval_jac_g(Index n, const Number* x, bool new_x, Index m, Index nele_jac,
+                                Index* iRow, Index* jCol, Number* values)
+        {
+            TapeStructure &structure = *_solver._structure;
+            const CppAD::vector<size_t> &row = structure.row_jac;
+            const CppAD::vector<size_t> &col = structure.col_jac;
+            size_t nk = row.size();
+            if (values == NULL)
+            {
+                for (size_t k = 0; k < nk; k++)
+                {
+                    iRow[k] = static_cast<Index>(row[k] - 1);
+                    jCol[k] = static_cast<Index>(col[k]);
+                }
+                return true;
+            }
+            MPC_TRACE_SPAN("eval_jac_g");
+            CallbackTimer timer(_solver._profile, TapeProfile::EVAL_JAC_G);
+            if (new_x)
+                cacheNewX(x);
+            if (nk == 0)
+                return true;
+#ifdef MPC_CODEGEN
+            if (_solver._generated)
+            {
+                generatedJacobian();
+                for (size_t k = 0; k < nk; k++)
+                    values[k] = _jac_gen[_solver._gen_jac[k]];
+                return true;
+            }
+#endif
+
+            // The constant entries, then the sweeps over the others
+            constantJacobian(values);
+            const CppAD::vector<size_t> &row_sweep = structure.row_sweep;
+            const CppAD::vector<size_t> &col_sweep = structure.col_sweep;
+            const CppAD::vector<size_t> &entry = structure.sweep_entry;
+            const size_t ns = entry.size();
+            if (ns == 0)
+                return true;
+            if (_jacobian == ipopt_util::JACOBIAN_SUBGRAPH)
+            {
+                subgraphJacobian(values);
+                return true;
+            }
+            if (split() ? splitJacobian() : firstOrder())
+            {
+                for (size_t k = 0; k < ns; k++)
+                    values[entry[k]] = _jac1[k];
+                return true;
+            }
+            if (_solver._single)
+            {
+                Fvector jac(ns);
+                if (_jacobian == ipopt_util::JACOBIAN_FORWARD)
+                    _solver._fun_single.SparseJacobianForward(_xpf, structure.pattern_jac, row_sweep, col_sweep, jac, structure.work_jac);
+                else
+                    _solver._fun_single.SparseJacobianReverse(_xpf, structure.pattern_jac, row_sweep, col_sweep, jac, structure.work_jac);
+                for (size_t k = 0; k < ns; k++)
+                    values[entry[k]] = jac[k];
+                return true;
+            }
+            Dvector jac(ns);
+            if (_jacobian == ipopt_util::JACOBIAN_FORWARD)
+                _solver._fun.SparseJacobianForward(_xp, structure.pattern_jac, row_sweep, col_sweep, jac, structure.work_jac);
+            else
+                _solver._fun.SparseJacobianReverse(_xp, structure.pattern_jac, row_sweep, col_sweep, jac, structure.work_jac);
+            for (size_t k = 0; k < ns; k++)
+                values[entry[k]] = jac[k];
+            return true;
+        }
+
+        virtual bool eval_h(Index n, const Number* x, bool new_x, Number obj_factor, Index m,
+                            const Number* lambda, bool new_lambda, Index nele_hess,
+                            Index* iRow, Index* jCol, Number* values)
+        {
+            TapeStructure &structure = *_solver._structure;
+            const CppAD::vector<size_t> &row = structure.row_hes;
+            const CppAD::vector<size_t> &col = structure.col_hes;
+            size_t nk = row.size();
+            if (values == NULL)
+            {
+                for (size_t k = 0; k < nk; k++)
+                {
+                    iRow[k] = static_cast<Index>(row[k]);
+                    jCol[k] = static_cast<Index>(col[k]);
+                }
+                return true;
+            }
+            MPC_TRACE_SPAN("eval_h");
+            CallbackTimer timer(_solver._profile, TapeProfile::EVAL_H);
+            if (new_x)
+                cacheNewX(x);
+            if (nk == 0)
+                return true;
+
+            // Gauss-Newton: the cost Hessian does not depend on x, reuse it
+            const bool gauss_newton = _solver._gauss_newton;
+            if (gauss_newton && _solver._gn_valid)
+            {
+                for (size_t k = 0; k < nk; k++)
+                    values[k] = obj_factor * _solver._gn_hes[k];
+                return true;
+            }
+            if (!gauss_newton && reuseHessian(x, obj_factor, lambda))
+            {
+                for (size_t k = 0; k < nk; k++)
+                    values[k] = _hes_values[k];
+                _solver._profile.hessian_reuses++;
+                return true;
+            }
+
+            // weighting vector for the Lagrangian
+            Dvector w(1 + _ng);
+            w[0] = gauss_newton ? 1.0 : obj_factor;
+            for (size_t i = 0; i < _ng; i++)
+                w[1 + i] = gauss_newton ? 0.0 : lambda[i];
+
+            Dvector hes(nk);
+#ifdef MPC_CODEGEN
+            if (_solver._generated)
+            {
+                std::vector<double> w_gen(w.data(), w.data() + w.size());
+                _solver._generated->SparseHessian(_x_gen, w_gen, _hes_gen);
+                for (size_t k = 0; k < nk; k++)
+                    hes[k] = _hes_gen[_solver._gen_hes[k]];
+            }
+            else
+#endif
+            if (_solver._stages)
+                _solver._stages->Evaluate(_xp, w, hes);
+            else if (_solver._single)
+            {
+                Fvector wf(w.size()), hesf(nk);
+                for (size_t i = 0; i < w.size(); i++)
+                    wf[i] = w[i];
+                _solver._fun_single.SparseHessian(_xpf, wf, structure.pattern_hes, row, col, hesf, structure.work_hes);
+                for (size_t k = 0; k < nk; k++)
+                    hes[k] = hesf[k];
+            }
+            else
+                _solver._fun.SparseHessian(_xp, w, structure.pattern_hes, row, col, hes, structure.work_hes);
+
+            if (gauss_newton)
+            {
+                _solver._gn_hes = hes;
+                _solver._gn_valid = true;
+                for (size_t k = 0; k < nk; k++)
+                    values[k] = obj_factor * hes[k];
+                return true;
+            }
+            for (size_t k = 0; k < nk; k++)
+                values[k] = hes[k];
+            if (_solver._hes_reuse > 0)
+                keepHessian(x, obj_factor, lambda, hes);
+            return true;
+        }
+
+        virtual bool get_scaling_parameters(Number& obj_scaling, bool& use_x_scaling, Index n, Number* x_scaling,
+                                            bool& use_g_scaling, Index m, Number* g_scaling)
+        {
+            obj_scaling = _solver._scale_objective;
+            use_x_scaling = _solver._scale_x.size() == size_t(n);
+            for (Index j = 0; use_x_scaling && j < n; j++)
+                x_scaling[j] = _solver._scale_x[j];
+            use_g_scaling = _solver._scale_g.size() == size_t(m);
+            for (Index i = 0; use_g_scaling && i < m; i++)
+                g_scaling[i] = _solver._scale_g[i];
+            return true;
+        }
+
+        // Journal the iterate, stop at it once the solve is cancelled, the
+        // wall-time budget is used up or the watched inputs settled
+        virtual bool intermediate_callback(Ipopt::AlgorithmMode mode, Index iter, Number obj_value,
+                                           Number inf_pr, Number inf_du, Number mu, Number d_norm,
+                                           Number regularization_size, Number alpha_du, Number alpha_pr,
+                                           Index ls_trials, const Ipopt::IpoptData* ip_data,
+                                           Ipopt::IpoptCalculatedQuantities* ip_cq)
+        {
+            IpoptIterate iterate;
+            iterate.iter = iter;
+            iterate.ls_trials = ls_trials;
+            iterate.obj = obj_value;
+            iterate.inf_pr = inf_pr;
+            iterate.inf_du = inf_du;
+            iterate.mu = mu;
+            iterate.d_norm = d_norm;
+            iterate.alpha_pr = alpha_pr;
+            _solver._journal.Add(iterate);
+
+            if (_solver._cancel && _solver._cancel->load(std::memory_order_relaxed))
+            {
+                _solver._cancel_hit = true;
+                return false;
+            }
+            if (inputsSettled(inf_pr))
+            {
+                _solver._input_stop_hit = true;
+                return false;
+            }
+            if (_solver._time_limit <= 0)
+                return true;
+            const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                                                 - _solver._solve_begin).count();
+            if (elapsed < _solver._time_limit)
+                return true;
+            _solver._time_limit_hit = true;
+            return false;
+        }
+
+        virtual void finalize_solution(Ipopt::SolverReturn status, Index n, const Number* x,
+                                       const Number* z_L, const Number* z_U, Index m, const Number* g,
+                                       const Number* lambda, Number obj_value,
+                                       const Ipopt::IpoptData* ip_data, Ipopt::IpoptCalculatedQuantities* ip_cq)
+        {
+            ipopt_util::StoreSolution(status, _nx, x, z_L, z_U, _ng, g, lambda, obj_value, *_solution);
+        }
+
+    private:
+        // SetHessianReuse(): the last swept Hessian still stands for the
+        // Lagrangian at (x, obj_factor, lambda)
+        bool reuseHessian(const Number *x, Number obj_factor, const Number *lambda)
+        {
+            const TapeSolver &s = _solver;
+            if (!_hes_valid || _hes_age >= s._hes_reuse || obj_factor != _hes_obj_factor)
+                return false;
+            for (size_t j = 0; j < _nx; j++)
+                if (std::fabs(x[j] - _hes_x[j]) > s._hes_reuse_step)
+                    return false;
+            for (size_t i = 0; i < _ng; i++)
+                if (std::fabs(lambda[i] - _hes_lambda[i]) > s._hes_reuse_lambda * std::max(1.0, std::fabs(_hes_lambda[i])))
+                    return false;
+            _hes_age++;
+            return true;
+        }
+
+        void keepHessian(const Number *x, Number obj_factor, const Number *lambda, const Dvector &hes)
+        {
+            _hes_x.assign(x, x + _nx);
+            _hes_lambda.assign(lambda, lambda + _ng);
+            _hes_values.assign(hes.data(), hes.data() + hes.size());
+            _hes_obj_factor = obj_factor;
+            _hes_age = 0;
+            _hes_valid = true;
+        }
+
+        // SetInputStop(): the watched variables at the iterate, which is
+        // the point of the last evaluation, against the previous iterate
+        bool inputsSettled(Number inf_pr)
+        {
+            TapeSolver &s = _solver;
+            if (s._stop_watch.empty() || _xp.size() == 0)
+                return false;
+            bool moved = s._stop_last.size() != s._stop_watch.size();
+            s._stop_last.resize(s._stop_watch.size());
+            for (size_t k = 0; k < s._stop_watch.size(); k++)
+            {
+                const double v = _xp[s._stop_watch[k]];
+                moved = moved || std::fabs(v - s._stop_last[k]) > s._stop_tol;
+                s._stop_last[k] = v;
+            }
+            s._stop_streak = moved ? 0 : s._stop_streak + 1;
+            return s._stop_streak >= s._stop_iterations && inf_pr <= s._stop_inf_pr;
+        }
+
+        // Wall time of one callback, added to the profile of the solver.
+        // The zero order sweep of a new x counts for the callback that
+        // triggers it.
+        class CallbackTimer
+        {
+            public:
+                CallbackTimer(TapeProfile &profile, TapeProfile::Callback callback)
+                    : _profile(profile), _callback(callback), _begin(std::chrono::steady_clock::now())
+                {
+                    perf_counters::Read(_perf_begin);
+                }
+                ~CallbackTimer()
+                {
+                    _profile.calls[_callback]++;
+                    _profile.callback_ms[_callback] += std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - _begin).count();
+                    perf_counters::Counts perf_end;
+                    if (perf_counters::Read(perf_end))
+                        _profile.callback_perf[_callback] += perf_end - _perf_begin;
+                }
+
+            private:
+                TapeProfile &_profile;
+                TapeProfile::Callback _callback;
+                std::chrono::steady_clock::time_point _begin;
+                perf_counters::Counts _perf_begin;
+        };
+
+        // Zero order sweep at [x | params], also leaves the Taylor
+        // coefficients needed by the Reverse(1) in eval_grad_f.
+        void cacheNewX(const Number* x)
+        {
+            for (size_t j = 0; j < _nx; j++)
+                _xp[j] = x[j];
+#ifdef MPC_CODEGEN
+            if (_solver._generated)
+            {
+                _x_gen.assign(_xp.data(), _xp.data() + _xp.size());
+                _solver._generated->ForwardZero(_x_gen, _fg_gen);
+                _fg0.resize(_fg_gen.size());
+                for (size_t i = 0; i < _fg_gen.size(); i++)
+                    _fg0[i] = _fg_gen[i];
+                _jac_gen_valid = false;
+                return;
+            }
+#endif
+            _first_valid = false;
+            _obj_valid = false;
+            _con_valid = false;
+            if (split())
+                return;
+            _fg0 = _solver._fun.Forward(0, _xp);
+            if (_solver._single)
+            {
+                for (size_t j = 0; j < _nx; j++)
+                    _xpf[j] = x[j];
+            }
+        }
+
+        // Constraint Jacobian by one reverse sweep over the subgraph of
+        // each row, at the zero order coefficients of cacheNewX. Needs no
+        // coloring; the subgraphs are marked again on every call (one pass
+        // over the tape), CppAD allows each row only once per marking.
+        void subgraphJacobian(Number* values)
+        {
+            const CppAD::vector<size_t> &row = _solver._structure->row_sweep;
+            const CppAD::vector<size_t> &col = _solver._structure->col_sweep;
+            const CppAD::vector<size_t> &entry = _solver._structure->sweep_entry;
+            if (_select_domain.size() == 0)
+            {
+                _select_domain.resize(_xp.size());
+                for (size_t j = 0; j < _xp.size(); j++)
+                    _select_domain[j] = j < _nx;
+                _jac_row.resize(_nx);
+                for (size_t j = 0; j < _nx; j++)
+                    _jac_row[j] = 0.0;
+            }
+            _solver._fun.subgraph_reverse(_select_domain);
+
+            // Entries are in row order, see TapeSolver::Record()
+            size_t k = 0;
+            while (k < row.size())
+            {
+                const size_t i = row[k];
+                _solver._fun.subgraph_reverse(1, i, _dw_col, _dw);
+                for (size_t c = 0; c < _dw_col.size(); c++)
+                    _jac_row[_dw_col[c]] = _dw[_dw_col[c]];
+                for (; k < row.size() && row[k] == i; k++)
+                    values[entry[k]] = _jac_row[col[k]];
+                for (size_t c = 0; c < _dw_col.size(); c++)
+                    _jac_row[_dw_col[c]] = 0.0;
+            }
+        }
+
+        // Cost gradient and constraint Jacobian (the sweep entries) at the
+        // point of cacheNewX, from the order one reverse sweeps at its zero
+        // order coefficients:
+        // one for the cost row, then one per color of work_jac as in
+        // SparseJacobianReverse, which would sweep order zero once more.
+        // Kept until the next new x, so the second of eval_grad_f and
+        // eval_jac_g is a copy. False for the forward and subgraph
+        // Jacobians, the float tape, and before the first
+        // SparseJacobianReverse has colored the work.
+        bool firstOrder()
+        {
+            if (_first_valid)
+                return true;
+            const TapeStructure &structure = *_solver._structure;
+            const CppAD::vector<size_t> &color = structure.work_jac.color;
+            const size_t m = 1 + _ng;
+            if (_jacobian != ipopt_util::JACOBIAN_REVERSE || _solver._single || color.size() != m)
+                return false;
+            const CppAD::vector<size_t> &row = structure.row_sweep;
+            const CppAD::vector<size_t> &col = structure.col_sweep;
+            const CppAD::vector<size_t> &order = structure.work_jac.order;
+            const size_t nk = row.size();
+
+            _w1.resize(m);
+            _grad1.resize(_nx);
+            _jac1.resize(nk);
+            for (size_t i = 0; i < m; i++)
+                _w1[i] = i == 0 ? 1.0 : 0.0;
+            _dw = _solver._fun.Reverse(1, _w1);
+            for (size_t j = 0; j < _nx; j++)
+                _grad1[j] = _dw[j];
+
+            // Entries in color order, see SparseJacobianRev
+            size_t n_color = 1;
+            for (size_t i = 0; i < m; i++)
+                if (color[i] < m)
+                    n_color = std::max(n_color, color[i] + 1);
+            size_t k = 0;
+            for (size_t ell = 0; ell < n_color && k < nk; ell++)
+            {
+                for (size_t i = 0; i < m; i++)
+                    _w1[i] = color[i] == ell ? 1.0 : 0.0;
+                _dw = _solver._fun.Reverse(1, _w1);
+                for (; k < nk && color[row[order[k]]] == ell; k++)
+                    _jac1[order[k]] = _dw[col[order[k]]];
+            }
+            _first_valid = true;
+            return true;
+        }
+
+        // Values of the constant entries (TapeSolver::SetConstantJacobian),
+        // swept once per Record() at the current point as any will do
+        void constantJacobian(Number* values)
+        {
+            const TapeStructure &structure = *_solver._structure;
+            const CppAD::vector<size_t> &entry = structure.const_entry;
+            const size_t nc = entry.size();
+            if (nc == 0)
+                return;
+            if (!_solver._jac_const_valid)
+            {
+                CppAD::vector<size_t> row(nc), col(nc);
+                for (size_t k = 0; k < nc; k++)
+                {
+                    row[k] = structure.row_jac[entry[k]];
+                    col[k] = structure.col_jac[entry[k]];
+                }
+                CppAD::sparse_jacobian_work work;
+                _solver._jac_const.resize(nc);
+                _solver._fun.SparseJacobianReverse(_xp, structure.pattern_jac, row, col, _solver._jac_const, work);
+                _solver._jac_const_valid = true;
+            }
+            for (size_t k = 0; k < nc; k++)
+                values[entry[k]] = _solver._jac_const[k];
+        }
+
+        // RecordSplit() tapes instead of the whole one, see IsSplit()
+        bool split() const
+        {
+            return _solver._split && _jacobian == ipopt_util::JACOBIAN_REVERSE && !_solver._single;
+        }
+
+        // Zero order sweeps of the split tapes at the point of cacheNewX,
+        // each at most once per point
+        const Dvector &objective()
+        {
+            if (!_obj_valid)
+            {
+                _f0 = _solver._fun_obj.Forward(0, _xp);
+                _obj_valid = true;
+            }
+            return _f0;
+        }
+        const Dvector &constraints()
+        {
+            if (!_con_valid)
+            {
+                _g0 = _solver._fun_con.Forward(0, _xp);
+                _con_valid = true;
+            }
+            return _g0;
+        }
+
+        // Constraint Jacobian from the order one reverse sweeps of the
+        // constraint tape, one per color of work_jac (row i of [f, g] is row
+        // i - 1 there). False until the first SparseJacobianReverse of the
+        // whole tape has colored the work.
+        bool splitJacobian()
+        {
+            if (_first_valid)
+                return true;
+            const TapeStructure &structure = *_solver._structure;
+            const CppAD::vector<size_t> &color = structure.work_jac.color;
+            const size_t m = 1 + _ng;
+            if (color.size() != m)
+                return false;
+            const CppAD::vector<size_t> &row = structure.row_sweep;
+            const CppAD::vector<size_t> &col = structure.col_sweep;
+            const CppAD::vector<size_t> &order = structure.work_jac.order;
+            const size_t nk = row.size();
+
+            constraints();
+            _w_con.resize(_ng);
+            _jac1.resize(nk);
+            size_t n_color = 0;
+            for (size_t i = 1; i < m; i++)
+                if (color[i] < m)
+                    n_color = std::max(n_color, color[i] + 1);
+            size_t k = 0;
+            for (size_t ell = 0; ell < n_color && k < nk; ell++)
+            {
+                for (size_t i = 1; i < m; i++)
+                    _w_con[i - 1] = color[i] == ell ? 1.0 : 0.0;
+                _dw = _solver._fun_con.Reverse(1, _w_con);
+                for (; k < nk && color[row[order[k]]] == ell; k++)
+                    _jac1[order[k]] = _dw[col[order[k]]];
+            }
+            _first_valid = true;
+            return true;
+        }
+
+#ifdef MPC_CODEGEN
+        // Generated Jacobian of [f, g] at the cached point, shared by
+        // eval_grad_f and eval_jac_g
+        void generatedJacobian()
+        {
+            if (_jac_gen_valid)
+                return;
+            _solver._generated->SparseJacobian(_x_gen, _jac_gen);
+            _jac_gen_valid = true;
+        }
+
+        std::vector<double> _x_gen, _fg_gen, _jac_gen, _hes_gen;
+        bool _jac_gen_valid;
+#endif
+
+        TapeSolver &_solver;
+        ipopt_util::Jacobian _jacobian;
+        // subgraphJacobian(): parameters left out, one row, sweep results
+        CppAD::vector<bool> _select_domain;
+        Dvector _jac_row, _dw;
+        CppAD::vector<size_t> _dw_col;
+        size_t _nx, _ng;
+        const Dvector *_xi, *_xl, *_xu, *_gl, *_gu;
+        SolveResult *_solution;
+        const Dvector *_zl, *_zu, *_lambda;
+        Dvector _xp, _fg0;
+        Fvector _xpf; // _xp in single precision
+        // firstOrder(): weights, and its results while _first_valid
+        Dvector _w1, _grad1, _jac1;
+        bool _first_valid;
+        // split(): values of the cost and the constraint tapes, the
+        // weights of their reverse sweeps
+        Dvector _f0, _g0, _w_obj, _w_con;
+        bool _obj_valid, _con_valid;
+        // SetHessianReuse(): the point and the values of the last sweep of
+        // this solve, and the eval_h calls answered with them since
+        std::vector<double> _hes_x, _hes_lambda, _hes_values;
+        bool _hes_valid;
+        int _hes_age;
+        double _hes_obj_factor;
+};
+
+// ====================================
+// TapeSolver class definition implementation.
+// ====================================
+TapeSolver::TapeSolver()
+{
+    _nx = 0;
+    _ng = 0;
+    _np = 0;
+    _recorded = false;
+    _single = false;
+    _split = false;
+    _const_jacobian = false;
+    _jac_const_valid = false;
+    _structure = std::make_shared<TapeStructure>();
+    _iterations = -1;
+    _time_limit = 0;
+    _time_limit_hit = false;
+    _cancel = NULL;
+    _cancel_hit = false;
+    _stop_tol = 0.0;
+    _stop_inf_pr = 0.0;
+    _stop_iterations = 1;
+    _stop_streak = 0;
+    _input_stop_hit = false;
+    _scale_objective = 1.0;
+    _gauss_newton = false;
+    _gn_valid = false;
+    _hes_reuse = 0;
+    _hes_reuse_step = 0.05;
+    _hes_reuse_lambda = 0.1;
+    _optimize = tape_optimize::STRAIGHT_LINE;
+    _hes_coloring = 0;
+    _taylor_capacity = -1;
+    _sparsity = sparsity_patterns::AUTO;
+    _hes_density = -1.0;
+    _adopted = false;
+    _recorded_size[0] = _recorded_size[1] = _recorded_size[2] = 0;
+    _nlp = NULL;
+}
+
+void TapeSolver::SetInputStop(const std::vector<size_t> &watch, double tol, int iterations, double max_inf_pr)
+{
+    _stop_watch = watch;
+    _stop_tol = tol;
+    _stop_iterations = std::max(1, iterations);
+    _stop_inf_pr = max_inf_pr;
+}
+
+static bool sameValues(const Dvector &a, const Dvector &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t k = 0; k < a.size(); k++)
+        if (a[k] != b[k])
+            return false;
+    return true;
+}
+
+void TapeSolver::SetScaling(double objective, const Dvector &x, const Dvector &g)
+{
+    if (objective == _scale_objective && sameValues(x, _scale_x) && sameValues(g, _scale_g))
+        return;
+    _scale_objective = objective;
+    _scale_x = x;
+    _scale_g = g;
+    // Ipopt takes the scaling when it sets the problem up, not on a
+    // ReOptimizeTNLP
+    if (_ipopt && _nlp)
+        _ipopt->SetProblem(_nlp);
+}
+
+void TapeSolver::SetGaussNewton(bool enable)
+{
+    if (enable != _gauss_newton)
+        _gn_valid = false;
+    _gauss_newton = enable;
+}
+
+void TapeSolver::SetHessianReuse(int iterations, double max_step, double max_lambda)
+{
+    _hes_reuse = std::max(0, iterations);
+    _hes_reuse_step = max_step;
+    _hes_reuse_lambda = max_lambda;
+}
+
+void TapeSolver::SetHessianColoring(int method)
+{
+    if (method == _hes_coloring)
+        return;
+    _hes_coloring = method;
+    TapeStructure &structure = ownStructure();
+    structure.work_hes.clear();
+    structure.work_hes.color_method = HessianColoring(method);
+}
+
+const char *TapeSolver::HessianColoring(int method)
+{
+    switch (method)
+    {
+        case 1:
+            return "cppad.general";
+        case 2:
+#if CPPAD_HAS_COLPACK
+            return "colpack.symmetric";
+#endif
+        default:
+            return "cppad.symmetric";
+    }
+}
+
+void TapeSolver::Reset()
+{
+    _recorded = false;
+    _single = false;
+    _split = false;
+    _jac_const_valid = false;
+    releaseShared();
+    _structure = std::make_shared<TapeStructure>();
+    _structure->work_hes.color_method = HessianColoring(_hes_coloring);
+    _gn_valid = false;
+    _nlp = NULL;
+    if (_ipopt)
+        _ipopt->SetProblem(NULL);
+    _generated.reset();
+    _stages.reset();
+    _gen_jac.resize(0);
+    _gen_grad.resize(0);
+    _gen_grad_col.resize(0);
+    _gen_hes.resize(0);
+}
+
+void TapeSolver::CopyFrom(const TapeSolver &other)
+{
+    if (&other == this)
+        return;
+    // Empty CppAD vectors take the size of the right hand side
+    Reset();
+    _gn_hes.resize(0);
+    _fun = other._fun;
+    _fun_single = other._fun_single;
+    _single = other._single;
+    _fun_obj = other._fun_obj;
+    _fun_con = other._fun_con;
+    _split = other._split;
+    _nx = other._nx;
+    _ng = other._ng;
+    _np = other._np;
+    _recorded = other._recorded;
+    *_structure = *other._structure;
+    _gauss_newton = other._gauss_newton;
+    _gn_valid = other._gn_valid;
+    _gn_hes = other._gn_hes;
+    _hes_reuse = other._hes_reuse;
+    _hes_reuse_step = other._hes_reuse_step;
+    _hes_reuse_lambda = other._hes_reuse_lambda;
+    _generated = other._generated;
+    _gen_jac = other._gen_jac;
+    _gen_grad = other._gen_grad;
+    _gen_grad_col = other._gen_grad_col;
+    _gen_hes = other._gen_hes;
+    _optimize = other._optimize;
+    std::copy(other._recorded_size, other._recorded_size + 3, _recorded_size);
+    _hes_coloring = other._hes_coloring;
+    _taylor_capacity = other._taylor_capacity;
+    _sparsity = other._sparsity;
+    _const_jacobian = other._const_jacobian;
+    _hes_density = other._hes_density;
+    _profile = other._profile;
+}
+
+std::shared_ptr<const SharedTape> TapeSolver::Share(unsigned long id)
+{
+    if (!_recorded || _generated)
+        return std::shared_ptr<const SharedTape>();
+    std::shared_ptr<SharedTape> tape(new SharedTape());
+    tape->_fun.share_op_seq(_fun);
+    tape->_single = _single;
+    if (_single)
+        tape->_fun_single.share_op_seq(_fun_single);
+    tape->_nx = _nx;
+    tape->_ng = _ng;
+    tape->_np = _np;
+    tape->_id = id;
+    // From now on whoever changes it, this solver too, takes a copy
+    tape->_structure = _structure;
+    tape->_optimize = _optimize;
+    tape->_hes_coloring = _hes_coloring;
+    tape->_sparsity = _sparsity;
+    tape->_hes_density = _hes_density;
+    std::copy(_recorded_size, _recorded_size + 3, tape->_recorded_size);
+    tape->_profile = _profile;
+    return tape;
+}
+
+void TapeSolver::ShareFrom(const std::shared_ptr<const SharedTape> &tape)
+{
+    Reset();
+    if (!tape)
+        return;
+    _shared = tape;
+    _fun.share_op_seq(tape->_fun);
+    _single = tape->_single;
+    if (_single)
+        _fun_single.share_op_seq(tape->_fun_single);
+    _nx = tape->_nx;
+    _ng = tape->_ng;
+    _np = tape->_np;
+    _structure = tape->_structure;
+    _optimize = tape->_optimize;
+    _hes_coloring = tape->_hes_coloring;
+    _sparsity = tape->_sparsity;
+    _hes_density = tape->_hes_density;
+    std::copy(tape->_recorded_size, tape->_recorded_size + 3, _recorded_size);
+    _profile = tape->_profile;
+    _recorded = true;
+}
+
+static bool samePattern(const CppAD::vectorBool &a, const CppAD::vectorBool &b);
+
+std::shared_ptr<const TapeStructure> TapeSolver::Structure() const
+{
+    return _recorded && !_generated ? _structure : std::shared_ptr<const TapeStructure>();
+}
+
+void TapeSolver::AdoptStructure(const std::shared_ptr<TapeStructure> &structure, size_t n_vars, size_t n_constraints,
+                                size_t n_params, size_t size_var, size_t size_op, double hes_density)
+{
+    _adopt.reset();
+    const size_t n = n_vars + n_params;
+    if (!structure || structure->pattern_jac.size() != (1 + n_constraints) * n
+        || structure->pattern_hes.size() != n * n)
+        return;
+    if (!_recorded)
+    {
+        _adopt = structure;
+        _adopt_dims[0] = n_vars;
+        _adopt_dims[1] = n_constraints;
+        _adopt_dims[2] = n_params;
+        _adopt_dims[3] = size_var;
+        _adopt_dims[4] = size_op;
+        _hes_density = hes_density;
+        return;
+    }
+    if (_generated || _shared || n_vars != _nx || n_constraints != _ng || n_params != _np
+        || size_var != _profile.size_var || size_op != _profile.size_op
+        || !samePattern(structure->pattern_jac, _structure->pattern_jac)
+        || !samePattern(structure->pattern_hes, _structure->pattern_hes)
+        || structure->const_jacobian != _structure->const_jacobian)
+        return;
+    // Same entries, the Ipopt problem stays valid
+    _structure = structure;
+}
+
+void TapeSolver::releaseShared()
+{
+    if (!_shared)
+        return;
+    if (_fun.op_seq_shared())
+        _fun = CppAD::ADFun<double>();
+    if (_fun_single.op_seq_shared())
+        _fun_single = CppAD::ADFun<float>();
+    if (_structure == _shared->_structure)
+        _structure = std::make_shared<TapeStructure>();
+    _shared.reset();
+}
+
+TapeStructure &TapeSolver::ownStructure()
+{
+    if (_structure.use_count() > 1)
+        _structure = std::make_shared<TapeStructure>(*_structure);
+    return *_structure;
+}
+
+// Elements a CppAD work object holds
+template <class Work>
+static size_t workBytes(const Work &work)
+{
+    return (work.order.capacity() + work.color.capacity()) * sizeof(size_t);
+}
+
+TapeStructure::TapeStructure()
+{
+    const_jacobian = false;
+    jac_method = ipopt_util::JACOBIAN_REVERSE;
+}
+
+void TapeStructure::SetConstant(const CppAD::vector<bool> &constant, size_t n_constraints, bool detected)
+{
+    const_jacobian = detected;
+    row_sweep.clear();
+    col_sweep.clear();
+    sweep_entry.clear();
+    const_entry.clear();
+    linear_row.assign(n_constraints, true);
+    for (size_t k = 0; k < row_jac.size(); k++)
+    {
+        if (k < constant.size() && constant[k])
+        {
+            const_entry.push_back(k);
+            continue;
+        }
+        row_sweep.push_back(row_jac[k]);
+        col_sweep.push_back(col_jac[k]);
+        sweep_entry.push_back(k);
+        linear_row[row_jac[k] - 1] = false;
+    }
+}
+
+size_t TapeStructure::Bytes() const
+{
+    return (pattern_jac.capacity() + pattern_hes.capacity()) / 8
+           + (row_jac.capacity() + col_jac.capacity() + row_hes.capacity() + col_hes.capacity()
+              + row_sweep.capacity() + col_sweep.capacity() + sweep_entry.capacity() + const_entry.capacity()
+              + work_hes.row.capacity() + work_hes.col.capacity()) * sizeof(size_t)
+           + workBytes(work_jac) + workBytes(work_hes);
+}
+
+size_t SharedTape::Bytes() const
+{
+    size_t bytes = _fun.size_op_seq() + _structure->Bytes();
+    if (_single)
+        bytes += _fun_single.size_op_seq();
+    return bytes;
+}
+
+TapeMemory TapeSolver::Memory() const
+{
+    // The solver that recorded a SharedTape counts it as its own, the
+    // ones that use it in shared
+    TapeMemory memory;
+    if (_recorded)
+    {
+        // ADFun::Memory() is the operation sequence plus per variable the
+        // Taylor capacity and the forward sparsity
+        memory.tape = _fun.size_op_seq();
+        memory.taylor = _fun.Memory() - memory.tape;
+        if (_shared && _fun.op_seq_shared())
+            memory.tape = 0;
+        if (_single)
+        {
+            memory.tape += _shared && _fun_single.op_seq_shared() ? 0 : _fun_single.size_op_seq();
+            memory.taylor += _fun_single.Memory() - _fun_single.size_op_seq();
+        }
+        if (_split)
+        {
+            memory.tape += _fun_obj.size_op_seq() + _fun_con.size_op_seq();
+            memory.taylor += _fun_obj.Memory() - _fun_obj.size_op_seq() + _fun_con.Memory() - _fun_con.size_op_seq();
+        }
+    }
+    memory.sparsity = (_gen_jac.capacity() + _gen_grad.capacity() + _gen_grad_col.capacity() + _gen_hes.capacity())
+                      * sizeof(size_t) + _gn_hes.capacity() * sizeof(double);
+    if (!_shared || _structure != _shared->_structure)
+        memory.sparsity += _structure->Bytes();
+    if (_stages)
+        memory.tape += _stages->Bytes();
+    if (_shared)
+        memory.shared = _shared->Bytes();
+    if (_nlp)
+    {
+        // Ipopt copies the triplets of the Jacobian and the Hessian: values and indices
+        memory.ipopt = (_structure->row_jac.size() + _structure->row_hes.size()) * (sizeof(double) + 2 * sizeof(int))
+                       + _nlp->Bytes();
+    }
+    return memory;
+}
+
+bool TapeSolver::LoadGenerated(const std::string &library, const std::string &model,
+                               size_t n_vars, size_t n_constraints, size_t n_params)
+{
+    Reset();
+    _profile.Clear();
+#ifdef MPC_CODEGEN
+    std::shared_ptr<CodegenModel> generated = std::make_shared<CodegenModel>();
+    if (!generated->Load(library, model, n_vars, n_constraints, n_params))
+        return false;
+    _nx = n_vars;
+    _ng = n_constraints;
+    _np = n_params;
+
+    // Same entries as Record(): constraint rows and vars columns of the
+    // Jacobian, the lower triangle of the vars block of the Hessian.
+    const std::vector<size_t> &row_jac = generated->JacobianRows();
+    const std::vector<size_t> &col_jac = generated->JacobianCols();
+    for (size_t k = 0; k < row_jac.size(); k++)
+    {
+        if (col_jac[k] >= _nx)
+            continue;
+        if (row_jac[k] == 0)
+        {
+            _gen_grad.push_back(k);
+            _gen_grad_col.push_back(col_jac[k]);
+        }
+        else
+        {
+            _structure->row_jac.push_back(row_jac[k]);
+            _structure->col_jac.push_back(col_jac[k]);
+            _gen_jac.push_back(k);
+        }
+    }
+    _structure->SetConstant(CppAD::vector<bool>(), _ng, false);
+
+    // The generated pattern may hold both triangles, keep an upper entry
+    // only if its mirror is missing
+    const std::vector<size_t> &row_hes = generated->HessianRows();
+    const std::vector<size_t> &col_hes = generated->HessianCols();
+    std::set<std::pair<size_t, size_t> > lower;
+    for (size_t k = 0; k < row_hes.size(); k++)
+        if (row_hes[k] >= col_hes[k])
+            lower.insert(std::make_pair(row_hes[k], col_hes[k]));
+    for (size_t k = 0; k < row_hes.size(); k++)
+    {
+        size_t i = row_hes[k], j = col_hes[k];
+        if (i >= _nx || j >= _nx)
+            continue;
+        if (i < j)
+        {
+            if (lower.count(std::make_pair(j, i)))
+                continue;
+            std::swap(i, j);
+        }
+        _structure->row_hes.push_back(i);
+        _structure->col_hes.push_back(j);
+        _gen_hes.push_back(k);
+    }
+
+    _generated = generated;
+    _recorded = true;
+    return true;
+#else
+    return false;
+#endif
+}
+
+static bool samePattern(const CppAD::vectorBool &a, const CppAD::vectorBool &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t k = 0; k < a.size(); k++)
+        if (a[k] != b[k])
+            return false;
+    return true;
+}
+
+void TapeSolver::Record(size_t n_vars, size_t n_constraints, size_t n_params, const FgFunction &fg_eval)
+{
+    // Recording again with new constants (weights, dt) normally leaves the
+    // structure as it is. If the patterns come out the same, the entry
+    // lists, the colorings in the work vectors and the Ipopt state (TNLP,
+    // symbolic factorization) are kept and only the tape is replaced.
+    const bool same_dims = _recorded && !_generated
+                           && n_vars == _nx && n_constraints == _ng && n_params == _np;
+    if (!same_dims)
+        Reset();
+    _recorded = false;
+    _single = false;
+    _split = false;
+    _jac_const_valid = false;
+    _gn_valid = false;
+    _stages.reset();
+    _nx = n_vars;
+    _ng = n_constraints;
+    _np = n_params;
+
+    size_t n = _nx + _np;
+    size_t m = 1 + _ng;
+
+    // The MPC model has no value dependent branches, so any point will do.
+    ADvector a_x(n), a_fg(m);
+    for (size_t j = 0; j < n; j++)
+        a_x[j] = 0.0;
+    if (same_dims)
+        CppAD::RecordReserve<double>(_recorded_size[0], _recorded_size[1], _recorded_size[2]);
+    CppAD::Independent(a_x);
+    fg_eval(a_fg, a_x);
+    _fun.Dependent(a_x, a_fg);
+    _recorded_size[0] = _fun.size_op();
+    _recorded_size[1] = _fun.size_op_arg();
+    _recorded_size[2] = _fun.size_par();
+    _profile.Clear();
+    _profile.recorded_var = _fun.size_var();
+    _profile.recorded_op = _fun.size_op();
+    const std::chrono::steady_clock::time_point optimize_begin = std::chrono::steady_clock::now();
+    tape_optimize::Apply(_fun, _optimize);
+    _profile.optimize_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()
+                                                                     - optimize_begin).count();
+    _profile.size_var = _fun.size_var();
+    _profile.size_op = _fun.size_op();
+
+    // A structure of AdoptStructure() for this very tape saves the sweeps
+    std::shared_ptr<TapeStructure> adopt;
+    adopt.swap(_adopt);
+    _adopted = false;
+    if (adopt && _adopt_dims[0] == _nx && _adopt_dims[1] == _ng && _adopt_dims[2] == _np
+        && _adopt_dims[3] == _profile.size_var && _adopt_dims[4] == _profile.size_op
+        && adopt->const_jacobian == _const_jacobian)
+    {
+        if (!same_dims || !samePattern(adopt->pattern_jac, _structure->pattern_jac)
+            || !samePattern(adopt->pattern_hes, _structure->pattern_hes))
+        {
+            Reset();
+        }
+        _structure = adopt;
+        _recorded = true;
+        _adopted = true;
+        return;
+    }
+
+    // Jacobian of [f, g] with respect to [vars | params] and the Hessian of
+    // the Lagrangian, every row of [f, g] may be weighted
+    const std::chrono::steady_clock::time_point sparsity_begin = std::chrono::steady_clock::now();
+    const sparsity_patterns::Representation rep = sparsity_patterns::Choose(_sparsity, n, _hes_density);
+    CppAD::vectorBool pattern_jac, pattern_hes;
+    sparsity_patterns::Compute(_fun, rep, pattern_jac, pattern_hes);
+    _hes_density = sparsity_patterns::Density(pattern_hes, n);
+    _profile.sparsity = rep;
+    _profile.sparsity_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()
+                                                                     - sparsity_begin).count();
+
+    // Drop the order one coefficients left by ForSparseJac, only
+    // RevSparseHes reads them. Compute() freed the forward pattern, which
+    // holds n bits per variable, far more than the tape.
+    _fun.capacity_order(0);
+    _recorded = true;
+
+    if (same_dims && samePattern(pattern_jac, _structure->pattern_jac)
+        && samePattern(pattern_hes, _structure->pattern_hes) && _const_jacobian == _structure->const_jacobian)
+        return;
+
+    // New structure (first tape, other dimensions, or a weight set to zero
+    // dropped terms from the tape): start over
+    Reset();
+    _recorded = true;
+    TapeStructure &structure = *_structure;
+    structure.pattern_jac = pattern_jac;
+    structure.pattern_hes = pattern_hes;
+
+    // Entries passed to Ipopt: constraint rows, vars columns, and the
+    // lower triangle of the vars block of the Hessian.
+    for (size_t i = 1; i < m; i++)
+        for (size_t j = 0; j < _nx; j++)
+            if (structure.pattern_jac[i * n + j])
+            {
+                structure.row_jac.push_back(i);
+                structure.col_jac.push_back(j);
+            }
+    // Entries of the sweeps, see SetConstantJacobian()
+    CppAD::vector<bool> constant;
+    if (_const_jacobian)
+        sparsity_patterns::ConstantEntries(_fun, structure.row_jac, structure.col_jac, constant);
+    structure.SetConstant(constant, _ng, _const_jacobian);
+    for (size_t i = 0; i < _nx; i++)
+        for (size_t j = 0; j <= i; j++)
+            if (structure.pattern_hes[i * n + j])
+            {
+                structure.row_hes.push_back(i);
+                structure.col_hes.push_back(j);
+            }
+}
+
+bool TapeSolver::RecordSingle(const FloatFgFunction &fg_eval)
+{
+    _single = false;
+    if (!_recorded || _generated)
+        return false;
+    const size_t n = _nx + _np, m = 1 + _ng;
+    AFvector a_x(n), a_fg(m);
+    for (size_t j = 0; j < n; j++)
+        a_x[j] = 0.0f;
+    CppAD::Independent(a_x);
+    fg_eval(a_fg, a_x);
+    _fun_single.Dependent(a_x, a_fg);
+    if (_fun_single.Domain() != n || _fun_single.Range() != m)
+        return false;
+    tape_optimize::Apply(_fun_single, _optimize);
+    _single = true;
+    return true;
+}
+
+bool TapeSolver::RecordSplit(const FgFunction &fg_eval)
+{
+    _split = false;
+    if (!_recorded || _generated)
+        return false;
+    const size_t n = _nx + _np, m = 1 + _ng;
+    ADvector a_x(n), a_fg(m);
+    for (size_t j = 0; j < n; j++)
+        a_x[j] = 0.0;
+
+    // optimize drops what does not reach the dependents of each tape
+    CppAD::Independent(a_x);
+    fg_eval(a_fg, a_x);
+    ADvector a_f(1);
+    a_f[0] = a_fg[0];
+    _fun_obj.Dependent(a_x, a_f);
+    tape_optimize::Apply(_fun_obj, _optimize);
+
+    // Without constraints (CONDENSED) there is nothing to record
+    _fun_con = CppAD::ADFun<double>();
+    if (_ng > 0)
+    {
+        ADvector a_g(_ng);
+        CppAD::Independent(a_x);
+        fg_eval(a_fg, a_x);
+        for (size_t i = 0; i < _ng; i++)
+            a_g[i] = a_fg[1 + i];
+        _fun_con.Dependent(a_x, a_g);
+        tape_optimize::Apply(_fun_con, _optimize);
+    }
+    _split = _fun_obj.Domain() == n && (_ng == 0 || _fun_con.Domain() == n);
+    return _split;
+}
+
+void TapeSolver::Solve(const std::string &options, const Dvector &params,
+                       const Dvector &xi, const Dvector &xl, const Dvector &xu,
+                       const Dvector &gl, const Dvector &gu, SolveResult &solution,
+                       const Dvector *zl, const Dvector *zu, const Dvector *lambda)
+{
+    solution.status = SolveResult::unknown;
+    _iterations = -1;
+    _time_limit_hit = false;
+    _cancel_hit = false;
+    _input_stop_hit = false;
+    _stop_last.clear();
+    _stop_streak = 0;
+    _journal.Clear();
+    _solve_begin = std::chrono::steady_clock::now();
+    _profile.ClearCallbacks();
+    if (!_recorded || xi.size() != _nx || gl.size() != _ng || params.size() != _np)
+        return;
+    if ((zl && zl->size() != _nx) || (zu && zu->size() != _nx) || (lambda && lambda->size() != _ng))
+        return;
+
+    // The application and the TNLP are kept between solves, options are
+    // only applied again when they change
+    if (!_ipopt)
+        _ipopt = std::make_shared<ipopt_util::PersistentIpopt>();
+    if (!_ipopt->SetOptions(options + linearOptions(gl, gu)))
+        return;
+    const ipopt_util::Jacobian jacobian = _ipopt->JacobianMethod();
+
+    // The coloring in work_jac is only valid for one sweep direction
+    if (jacobian != _structure->jac_method)
+    {
+        TapeStructure &structure = ownStructure();
+        structure.work_jac.clear();
+        structure.jac_method = jacobian;
+    }
+    // The sweeps color the work on their first call; other solvers may be
+    // reading a shared structure, so color a copy
+    if (_structure.use_count() > 1 && !_generated)
+    {
+        const TapeStructure &structure = *_structure;
+        const bool color_jac = jacobian != ipopt_util::JACOBIAN_SUBGRAPH && structure.row_sweep.size() > 0
+                               && structure.work_jac.color.size() == 0;
+        const bool color_hes = structure.row_hes.size() > 0 && structure.work_hes.color.size() == 0
+                               && !(_gauss_newton && _gn_valid);
+        if (color_jac || color_hes)
+            ownStructure();
+    }
+
+    if (!_nlp)
+    {
+        _nlp = new TapeNLP(*this);
+        _ipopt->SetProblem(_nlp);
+    }
+    _nlp->Bind(jacobian, params, xi, xl, xu, gl, gu, solution, zl, zu, lambda);
+    _ipopt->Solve();
+    _iterations = _ipopt->Iterations();
+
+    // The first callback of the next solve has a new x, so nothing reads
+    // the coefficients of this one again
+    if (_taylor_capacity >= 0)
+    {
+        _fun.capacity_order(_taylor_capacity);
+        if (_single)
+            _fun_single.capacity_order(_taylor_capacity);
+        if (_split)
+        {
+            _fun_obj.capacity_order(_taylor_capacity);
+            _fun_con.capacity_order(_taylor_capacity);
+        }
+    }
+
+    // Colors as in SparseHessian, unused ones (ColPack) included
+    const CppAD::vector<size_t> &color = _structure->work_hes.color;
+    _profile.hessian_colors = 0;
+    for (size_t j = 0; j < color.size(); j++)
+        if (color[j] < color.size())
+            _profile.hessian_colors = std::max(_profile.hessian_colors, color[j] + 1);
+}
+
+std::string TapeSolver::linearOptions(const Dvector &gl, const Dvector &gu) const
+{
+    const TapeStructure &structure = *_structure;
+    if (!structure.const_jacobian || structure.linear_row.size() != _ng)
+        return "";
+    bool equality = true, inequality = true;
+    for (size_t i = 0; i < _ng; i++)
+        if (!structure.linear_row[i])
+            (gl[i] == gu[i] ? equality : inequality) = false;
+    std::string options;
+    if (equality)
+        options += "String  jac_c_constant yes\n";
+    if (inequality)
+        options += "String  jac_d_constant yes\n";
+    return options;
+}
+
+bool TapeSolver::SetStages(const std::shared_ptr<StageHessian> &stages)
+{
+    _stages.reset();
+    _gn_valid = false;
+    if (!_recorded || _generated || !stages || !stages->Map(_structure->row_hes, _structure->col_hes))
+        return false;
+    _stages = stages;
+    return true;
+}
+
+double TapeSolver::MaxViolation(const Dvector &g, const Dvector &gl, const Dvector &gu)
+{
+    double violation = 0;
+    for (size_t i = 0; i < g.size() && i < gl.size() && i < gu.size(); i++)
+    {
+        violation = std::max(violation, gl[i] - g[i]);
+        violation = std::max(violation, g[i] - gu[i]);
+    }
+    return violation;
+}
@@ -0,0 +1,109 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "terminal_cost.h"
+#include "time_grid.h"
+#include <cmath>
+
+static double param(const std::map<std::string, double> &params, const char *key, double value)
+{
+    std::map<std::string, double>::const_iterator entry = params.find(key);
+    return entry != params.end() ? entry->second : value;
+}
+
+bool SetTerminalCost(std::map<std::string, double> &params)
+{
+    EraseTerminalCost(params);
+    // Defaults of FG_eval
+    const int steps = param(params, "STEPS", 40);
+    const std::vector<double> grid = TimeGridSteps(params, steps);
+    const double dt = grid.empty() ? param(params, "DT", 0.1) : grid.back();
+    const double vel = param(params, "REF_V", 0.5);
+    const double q_cte = param(params, "W_CTE", 100), q_etheta = param(params, "W_EPSI", 100);
+    const double q_vel = param(params, "W_V", 1);
+    const double r_angvel = param(params, "W_ANGVEL", 100), r_accel = param(params, "W_A", 50);
+    if (!(dt > 0) || q_cte < 0 || q_etheta < 0 || q_vel < 0 || r_angvel < 0 || r_accel < 0)
+    {
+        return false;
+    }
+
+    // [cte, etheta]: A = [1 vel dt; 0 1], B = [0; dt], fixed point of
+    // P = Q + A'PA - A'PB (R + B'PB)^-1 B'PA from P = Q
+    const double b = vel * dt;
+    double p00 = q_cte, p01 = 0, p11 = q_etheta;
+    bool converged = false;
+    for (int k = 0; k < 100000 && !converged; k++)
+    {
+        // A'PA
+        const double a00 = p00, a01 = b * p00 + p01, a11 = b * b * p00 + 2 * b * p01 + p11;
+        // A'PB and B'PB
+        const double g0 = p01 * dt, g1 = (b * p01 + p11) * dt;
+        const double s = r_angvel + p11 * dt * dt;
+        if (!(s > 1e-12))
+        {
+            return false;
+        }
+        const double n00 = q_cte + a00 - g0 * g0 / s;
+        const double n01 = a01 - g0 * g1 / s;
+        const double n11 = q_etheta + a11 - g1 * g1 / s;
+        const double change = std::fabs(n00 - p00) + std::fabs(n01 - p01) + std::fabs(n11 - p11);
+        converged = change <= 1e-10 * (1 + std::fabs(n00) + std::fabs(n11));
+        p00 = n00;
+        p01 = n01;
+        p11 = n11;
+        if (!std::isfinite(p00) || !std::isfinite(p11) || p00 > 1e12)
+        {
+            return false;
+        }
+    }
+    if (!converged)
+    {
+        return false;
+    }
+
+    // v: p = q + p - p^2 dt^2 / (r + p dt^2), the positive root
+    const double d2 = dt * dt;
+    const double p_vel = q_vel > 0 ? (q_vel * d2 + std::sqrt(q_vel * q_vel * d2 * d2 + 4 * d2 * q_vel * r_accel)) / (2 * d2)
+                                   : 0.0;
+
+    params["TERMINAL_P_CTE"] = p00;
+    params["TERMINAL_P_CTE_ETHETA"] = p01;
+    params["TERMINAL_P_ETHETA"] = p11;
+    params["TERMINAL_P_V"] = p_vel;
+    return true;
+}
+
+void EraseTerminalCost(std::map<std::string, double> &params)
+{
+    params.erase("TERMINAL_P_CTE");
+    params.erase("TERMINAL_P_CTE_ETHETA");
+    params.erase("TERMINAL_P_ETHETA");
+    params.erase("TERMINAL_P_V");
+}
+
+bool TerminalCost(const std::map<std::string, double> &params, double &p_cte, double &p_cte_etheta,
+                  double &p_etheta, double &p_vel)
+{
+    if (params.find("TERMINAL_P_CTE") == params.end())
+    {
+        return false;
+    }
+    p_cte = param(params, "TERMINAL_P_CTE", 0);
+    p_cte_etheta = param(params, "TERMINAL_P_CTE_ETHETA", 0);
+    p_etheta = param(params, "TERMINAL_P_ETHETA", 0);
+    p_vel = param(params, "TERMINAL_P_V", 0);
+    return true;
+}
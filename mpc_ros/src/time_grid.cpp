@@ -0,0 +1,74 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "time_grid.h"
+#include <sstream>
+
+static std::string key(size_t i)
+{
+    std::ostringstream name;
+    name << "DT_" << i;
+    return name.str();
+}
+
+bool SetTimeGrid(std::map<std::string, double> &params, const std::vector<double> &grid)
+{
+    for (size_t i = 0; i < grid.size(); i++)
+    {
+        if (!(grid[i] > 0.0))
+        {
+            return false;
+        }
+    }
+    EraseTimeGrid(params);
+    for (size_t i = 0; i < grid.size(); i++)
+    {
+        params[key(i)] = grid[i];
+    }
+    return true;
+}
+
+void EraseTimeGrid(std::map<std::string, double> &params)
+{
+    for (size_t i = 0; params.erase(key(i)) > 0; i++)
+    {
+    }
+}
+
+std::vector<double> TimeGridSteps(const std::map<std::string, double> &params, int steps)
+{
+    std::vector<double> grid;
+    for (size_t i = 0;; i++)
+    {
+        std::map<std::string, double>::const_iterator entry = params.find(key(i));
+        if (entry == params.end())
+        {
+            break;
+        }
+        grid.push_back(entry->second);
+    }
+    std::vector<double> dt;
+    if (grid.empty())
+    {
+        return dt;
+    }
+    for (int i = 0; i < steps - 1; i++)
+    {
+        dt.push_back(grid[i < (int)grid.size() ? i : grid.size() - 1]);
+    }
+    return dt;
+}
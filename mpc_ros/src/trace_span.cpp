@@ -0,0 +1,161 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "trace_span.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+#include <unistd.h>
+
+namespace
+{
+    struct Event
+    {
+        const char *name;
+        uint64_t begin, end; // [ns]
+    };
+
+    // Written by its thread only, count is the number of spans ever pushed
+    struct Ring
+    {
+        explicit Ring(int id) : events(trace_span::CAPACITY), count(0), id(id) {}
+
+        std::vector<Event> events;
+        std::atomic<uint64_t> count;
+        int id;
+        std::string name; // guarded by registryMutex()
+    };
+
+    std::mutex &registryMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    // Never freed, the spans of a thread are exported after it ended too
+    std::vector<Ring *> &registry()
+    {
+        static std::vector<Ring *> rings;
+        return rings;
+    }
+
+    thread_local Ring *t_ring = NULL;
+
+    Ring &ring()
+    {
+        if (!t_ring)
+        {
+            std::lock_guard<std::mutex> lock(registryMutex());
+            t_ring = new Ring(registry().size());
+            registry().push_back(t_ring);
+        }
+        return *t_ring;
+    }
+
+    uint64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Thread names are the only strings that are not literals of ours
+    std::string quote(const std::string &text)
+    {
+        std::string quoted = "\"";
+        for (size_t i = 0; i < text.size(); i++)
+        {
+            if (text[i] == '"' || text[i] == '\\')
+                quoted += '\\';
+            if ((unsigned char)text[i] >= 0x20)
+                quoted += text[i];
+        }
+        return quoted + "\"";
+    }
+}
+
+namespace trace_span
+{
+    Span::Span(const char *name) : _name(name), _begin(now()) {}
+
+    Span::~Span()
+    {
+        Ring &r = ring();
+        const uint64_t n = r.count.load(std::memory_order_relaxed);
+        Event &event = r.events[n & (CAPACITY - 1)];
+        event.name = _name;
+        event.begin = _begin;
+        event.end = now();
+        r.count.store(n + 1, std::memory_order_release);
+    }
+
+    void SetThreadName(const std::string &name)
+    {
+        Ring &r = ring();
+        std::lock_guard<std::mutex> lock(registryMutex());
+        r.name = name;
+    }
+
+    bool Enabled()
+    {
+#ifdef MPC_TRACE
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool WriteChrome(const std::string &path)
+    {
+        FILE *file = std::fopen(path.c_str(), "w");
+        if (!file)
+            return false;
+        const int pid = getpid();
+        std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        bool first = true;
+
+        std::lock_guard<std::mutex> lock(registryMutex());
+        std::vector<Event> events;
+        for (size_t k = 0; k < registry().size(); k++)
+        {
+            const Ring &r = *registry()[k];
+            const std::string name = r.name.empty() ? "thread " + std::to_string(r.id) : r.name;
+            std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":%s}}",
+                         first ? "" : ",\n", pid, r.id, quote(name).c_str());
+            first = false;
+
+            // Copy first, then drop what the thread overwrote meanwhile: the
+            // slot of the span it is writing is that of the oldest one kept
+            const uint64_t end = r.count.load(std::memory_order_acquire);
+            uint64_t begin = end > CAPACITY ? end - CAPACITY : 0;
+            events.resize(end - begin);
+            for (uint64_t i = begin; i < end; i++)
+                events[i - begin] = r.events[i & (CAPACITY - 1)];
+            const uint64_t after = r.count.load(std::memory_order_acquire);
+            const uint64_t valid = after >= CAPACITY ? after - CAPACITY + 1 : 0;
+            for (uint64_t i = std::max(begin, valid); i < end; i++)
+            {
+                const Event &event = events[i - begin];
+                std::fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                             event.name, pid, r.id, event.begin / 1000.0, (event.end - event.begin) / 1000.0);
+            }
+        }
+        std::fprintf(file, "\n]}\n");
+        return std::fclose(file) == 0;
+    }
+}
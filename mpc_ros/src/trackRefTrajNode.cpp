@@ -17,6 +17,8 @@
 
 #include <iostream>
 #include <map>
+#include <atomic>
+#include <mutex>
 #include <math.h>
 
 #include "ros/ros.h"
@@ -25,16 +27,44 @@
 #include <geometry_msgs/Twist.h>
 #include <tf/transform_listener.h>
 #include <std_msgs/Float32.h>
+#include <std_srvs/Trigger.h>
 #include <std_msgs/Float64.h>
 
 // #include <tf/transform_datatypes.h>
 #include <nav_msgs/Path.h>
 #include <nav_msgs/Odometry.h>
+#include <boost/make_shared.hpp>
 //#include <ackermann_msgs/AckermannDriveStamped.h>
 #include <visualization_msgs/Marker.h>
 #include <sensor_msgs/JointState.h>
-
-#include "trackRefTraj.h"
+#include <sensor_msgs/Imu.h>
+
+#include "MPC.h"
+#include "linear_solver.h"
+#include "ipopt_options.h"
+#include "latest_msg.h"
+#include "compact_path_msg.h"
+#include "path_fit.h"
+#include "arc_path.h"
+#include "path_index.h"
+#include "reference_trajectory.h"
+#include "solver_thread.h"
+#include "callback_queues.h"
+#include "trajectory_publisher.h"
+#include "reference_prep.h"
+#include "latency_stats.h"
+#include "transform_cache.h"
+#include "path_transform.h"
+#include "latest_value.h"
+#include "command_window.h"
+#include "trajectory_log.h"
+#include "flight_recorder.h"
+#include "trace_span.h"
+#include "event_trigger.h"
+#include "control_trigger.h"
+#include "state_estimator.h"
+#include "metrics_exporter.h"
+#include "coarse_guide.h"
 #include <Eigen/Core>
 #include <Eigen/QR>
 
@@ -57,20 +87,36 @@ using namespace Eigen;
 class MPCNode
 {
     public:
-        MPCNode();
+        MPCNode(ros::NodeHandle nh = ros::NodeHandle(), ros::NodeHandle pn = ros::NodeHandle("~"));
         ~MPCNode();
         int get_thread_numbers();
+        // Inside a ros_control controller (hardware_controller.h): each
+        // command sequence goes to sink instead of the command topics
+        void SetCommandSink(LatestValue<CommandWindow> *sink) { _command_sink = sink; }
         
     private:
         ros::NodeHandle _nh;
+        // Before the subscriptions and timers on its queues, see callback_queues.h
+        CallbackQueues _queues;
+        bool _callback_queues;
+        // mpc_trajectory as a nav_msgs/Path, and packed (compact_trajectory)
+        bool _trajectory_path;
+        TrajectoryPublisher _pub_compact_traj;
         ros::Subscriber _sub_odom, _sub_gen_path, _sub_path, _sub_goal, _sub_amcl;
         ros::Publisher _pub_totalcost, _pub_ctecost, _pub_ethetacost,_pub_odompath, _pub_twist, _pub_ackermann, _pub_mpctraj;
-        ros::Timer _timer1;
+        ros::Timer _timer1, _path_timer;
         tf::TransformListener _tf_listener;
+        TransformCache _tf_cache; // see transform_cache.h
+        PathTransform _path_transform; // path callback buffers, see path_transform.h
 
         geometry_msgs::Point _goal_pos;
-        nav_msgs::Odometry _odom;
-        nav_msgs::Path _odom_path, _mpc_traj; 
+        LatestMsg<nav_msgs::Odometry> _odom;
+        LatestMsg<CompactPath> _odom_path;
+        // desired_path keeps only its newest message, processed once per
+        // control period by _path_timer
+        LatestMsg<CompactPath> _desired_path;
+        LatestMsg<CompactPath>::ConstPtr _desired_last;
+        CompactPath _desired_window; // kept poses, before path -> odom
 	//ackermann_msgs::AckermannDriveStamped _ackermann_msg;
         geometry_msgs::Twist _twist_msg;
 
@@ -78,60 +124,217 @@ class MPCNode
         string _map_frame, _odom_frame, _car_frame;
 
         MPC _mpc;
+        PathFit _path_fit;
         map<string, double> _mpc_params;
         double _mpc_steps, _ref_cte, _ref_etheta, _ref_vel, _w_cte, _w_etheta, _w_vel, 
                _w_angvel, _w_accel, _w_angvel_d, _w_accel_d, _max_angvel, _max_throttle, _bound_value;
 
         //double _Lf; 
         double _dt, _w, _throttle, _speed, _max_speed;
-        double _pathLength, _goalRadius, _waypointsDist;
-        int _controller_freq, _downSampling, _thread_numbers;
-        bool _goal_received, _goal_reached, _path_computed, _pub_twist_flag, _debug_info, _delay_mode;
-
-        double polyeval(Eigen::VectorXd coeffs, double x);
-        Eigen::VectorXd polyfit(Eigen::VectorXd xvals, Eigen::VectorXd yvals, int order);
+        double _cycle_overhead; // cycle time besides the solve [s], for the deadline budget
+        double _pathLength, _goalRadius, _waypointsDist, _goal_phase_dist;
+        std::atomic<bool> _near_goal; // within _goal_phase_dist, set by amclCB
+        int _controller_freq, _downSampling, _thread_numbers, _hessian, _hypotheses, _integrator, _vehicle_model;
+        double _wheelbase, _max_steer;
+        bool _goal_received, _goal_reached, _path_computed, _pub_twist_flag, _debug_info, _delay_mode, _persistent_tape, _warm_start, _pursuit_seed, _rti, _analytic, _publish_cost, _async_solve, _deadline_mode, _arc_reference, _reduced, _dynamic;
+
+        // Event-triggered mode: the command of the last solve is replayed
+        // while the robot stays on its prediction
+        EventTrigger _event_trigger;
+        MPCCommand _event_cmd;
+
+        // Odometry-triggered control, see control_trigger.h: odomCB starts
+        // the cycle, at once or on the one-shot _trigger_timer, and _timer1
+        // runs it only as a watchdog. _cycle_mutex keeps the two apart.
+        ControlTrigger _control_trigger;
+        ros::Timer _trigger_timer;
+        std::mutex _cycle_mutex;
+        void odomTrigger();
 
         void odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg);
-        void pathCB(const nav_msgs::Path::ConstPtr& pathMsg);
-        void desiredPathCB(const nav_msgs::Path::ConstPtr& pathMsg);
+        void pathCB(const CompactPath::ConstPtr& pathMsg);
+        void desiredPathCB(const CompactPath::ConstPtr& pathMsg);
+        void desiredPathTimerCB(const ros::TimerEvent&);
+        void updateReference(const nav_msgs::Odometry &odom);
+        void setOdomPath(const boost::shared_ptr<CompactPath> &mpc_path, bool new_plan);
         void goalCB(const geometry_msgs::PoseStamped::ConstPtr& goalMsg);
         void amclCB(const geometry_msgs::PoseWithCovarianceStamped::ConstPtr& amclMsg);
         void controlLoopCB(const ros::TimerEvent&);
-
-        //For making global planner
-        nav_msgs::Path _gen_path;
+        void triggerCB(const ros::TimerEvent&);
+        void controlCycle();
+        bool solveControl(MPCCommand &cmd);
+        bool prepareReference(ReferencePacket &ref);
+        bool dumpFlightCB(std_srvs::Trigger::Request &req, std_srvs::Trigger::Response &res);
+        bool writeTraceCB(std_srvs::Trigger::Request &req, std_srvs::Trigger::Response &res);
+        // Hand cmd (NULL to stop) to the command sink, false without one
+        bool sinkCommand(const MPCCommand *cmd);
+        std::atomic<LatestValue<CommandWindow>*> _command_sink;
+        bool solveArcReference(double stamp, double px, double py, double theta, double v, double w, double throttle, double angvel, vector<double> &mpc_results);
+        void arcPoses(const ArcPath &path, double progress, int hint, double px, double py, double theta, double theta0, int steps, double dt, VectorXd &ref) const;
+        bool guidePoses(const GuidePlan &plan, double t0, double px, double py, double theta, double theta0, int steps, double dt, VectorXd &ref, double &speed) const;
+        void setReferenceSpeed(double speed);
+
+        // Hierarchical mode: a coarse MPC on a long horizon solves at
+        // _guide_rate and the arc length reference is sampled from its plan
+        bool _guide_on;
+        int _guide_steps;
+        double _guide_dt, _guide_rate, _guide_max_age, _guide_speed_step;
+
+        //Progress along the desired path
+        PathIndex _path_index;
         unsigned int min_idx;
+
+        // In-process reference (reference_type), instead of desired_path
+        ReferenceTrajectory _reference;
+        PathIndex _reference_index;
+        long _reference_start; // first pose of the current window, -1 before the first
         
         double _mpc_etheta;
         double _mpc_cte;
-        fstream file;
         unsigned int idx;
 
+        // Binary trajectory log, written from solveControl
+        TrajectoryLog _log;
+        string _log_path;
+        double _log_max_mb;
+        int _log_max_files;
+
+        // Last cycles of solveControl, dumped on a deadline miss, a solve
+        // that did not succeed or dump_flight_recorder, see flight_recorder.h
+        FlightRecorder _flight;
+        ros::ServiceServer _srv_flight;
+
+        // Chrome trace of the spans, written by write_trace (BUILD_TRACE)
+        string _trace_path;
+        ros::ServiceServer _srv_trace;
+
         ros::Publisher _pub_RW, _pub_LW;
         double _wr, _wl;
         std_msgs::Float64 _wr_curr, _wl_curr;
         double _torqueR, _torqueL;
         std_msgs::Float64 _WR, _WL;
 
+        // Wheel speed loop on /joint_states, decoupled from the MPC rate:
+        // the control loop only hands over the wheel speed reference
+        struct WheelReference
+        {
+            double left, right; // [rad/s]
+            double stamp;       // [s]
+        };
+        LatestValue<WheelReference> _wheel_ref;
+        bool _wheel_loop;
+        double _wheel_gain, _wheel_ref_timeout;
+        double _wheel_radius, _track_width;
+
+        // Torque-level MPC model (mpc_dynamic), see wheel_dynamics.h: the
+        // predicted torques are published directly, without the wheel loop
+        double _mass, _inertia, _damping, _ang_damping, _max_torque;
+        bool _soft_bounds;
+        double _w_slack;
+
+        // Arc length reference mode
+        LatestMsg<ArcPath> _arc_path;
+        LatestMsg<ArcPath>::ConstPtr _arc_last;
+        int _arc_hint;
+
         ros::Subscriber _sub_vel_rodas;
         void get_vel_rodas(const sensor_msgs::JointState& msg);
 
+        // In-process state estimate (state_estimator): joint states, gyro
+        // and the pose corrections fused on their callbacks, the solve reads
+        // the estimate at its own time instead of the last /odom message,
+        // see state_estimator.h
+        bool _estimator_on, _estimator_odom_pose, _estimator_amcl;
+        StateEstimator _estimator;
+        ros::Subscriber _sub_imu;
+        void imuCB(const sensor_msgs::Imu::ConstPtr& imuMsg);
+
+        // Priority and CPUs of the solver thread
+        RealtimeSettings _realtime;
+
+        // Solve and tracking metrics on /diagnostics and optionally HTTP
+        MetricsExporter _metrics;
+
+        // Odometry snapshot and path fit ahead of the solver (prep_thread),
+        // see reference_prep.h. Without the thread _ref_packet is prepared in
+        // solveControl.
+        bool _prep_thread;
+        ReferencePacket _ref_packet;
+        ReferencePrep _reference_prep;
+
+        CoarseGuide _guide;
+
+        // Declared last: the solver thread is joined before the members it uses go away
+        SolverThread _solver_thread;
+
 }; // end of class
 
 
-MPCNode::MPCNode()
+MPCNode::MPCNode(ros::NodeHandle nh, ros::NodeHandle pn) : _nh(nh), _command_sink(NULL)
 {
-    //Private parameters handler
-    ros::NodeHandle pn("~");
-
     //Parameters for control loop
     pn.param("thread_numbers", _thread_numbers, 2); // number of threads for this ROS node
     pn.param("pub_twist_cmd", _pub_twist_flag, true);
     pn.param("debug_info", _debug_info, true);
+    pn.param("publish_cost", _publish_cost, true); // publish the MPC cost terms
     pn.param("delay_mode", _delay_mode, true);
+    pn.param("async_solve", _async_solve, false); // solve on a separate thread, the timer replays the last solution
+    pn.param("prep_thread", _prep_thread, false); // fit the path on its own thread whenever the odometry or the path updates
+    pn.param("callback_queues", _callback_queues, false); // odometry and the control timer on a real-time queue, paths and goals on another
+    bool compact_trajectory;
+    pn.param("trajectory_path", _trajectory_path, true); // the prediction on mpc_trajectory as a nav_msgs/Path
+    pn.param("compact_trajectory", compact_trajectory, false); // and packed on mpc_trajectory_compact, see msg/MPCTrajectory.msg
+    int rt_priority, rt_prefault_stack_kb, rt_prefault_heap_mb;
+    std::string rt_cpus;
+    bool rt_lock_memory;
+    pn.param("rt_priority", rt_priority, 0); // SCHED_FIFO priority of the solver thread, 0 keeps SCHED_OTHER
+    pn.param<std::string>("rt_cpus", rt_cpus, ""); // CPUs of the solver thread, e.g. "2,3"; empty: any
+    pn.param("rt_prefault_stack_kb", rt_prefault_stack_kb, 0); // stack the solver thread touches before its first solve
+    pn.param("rt_lock_memory", rt_lock_memory, false); // mlockall the process
+    pn.param("rt_prefault_heap_mb", rt_prefault_heap_mb, 0); // heap touched once after locking
+    _realtime.Configure(rt_priority, rt_cpus, std::max(rt_prefault_stack_kb, 0));
+    if(rt_lock_memory)
+    {
+        std::string report;
+        if(!RealtimeSettings::LockMemory(std::max(rt_prefault_heap_mb, 0), report))
+            ROS_WARN("Memory is not locked: %s", report.c_str());
+    }
+    bool event_trigger;
+    double event_max_position, event_max_heading, event_max_age;
+    pn.param("event_trigger", event_trigger, false); // solve again only when the robot leaves the last prediction
+    pn.param("event_max_position", event_max_position, 0.03); // [m]
+    pn.param("event_max_heading", event_max_heading, 0.05); // [rad]
+    pn.param("event_max_age", event_max_age, 0.5); // oldest prediction that is replayed [s]
+    _event_trigger.Configure(event_trigger, event_max_position, event_max_heading, event_max_age);
+    bool odom_trigger;
+    int odom_trigger_every;
+    double odom_trigger_offset, odom_trigger_watchdog;
+    pn.param("odom_trigger", odom_trigger, false); // start the control cycle on the odometry instead of the timer
+    pn.param("odom_trigger_every", odom_trigger_every, 1); // on every k-th message
+    pn.param("odom_trigger_offset", odom_trigger_offset, 0.0); // this long after it [s]
+    pn.param("odom_trigger_watchdog", odom_trigger_watchdog, 1.5); // control periods without one before the timer runs the cycle
+    _control_trigger.Configure(odom_trigger, odom_trigger_every, odom_trigger_offset, odom_trigger_watchdog);
+    pn.param("deadline_mode", _deadline_mode, false); // bound each solve by the controller period
+    pn.param("arc_reference", _arc_reference, false); // track reference poses along an arc length spline instead of the cubic fit
+    pn.param("guide", _guide_on, false); // arc_reference only: sample the poses and speed from a coarse MPC solved on its own thread
+    pn.param("guide_steps", _guide_steps, 30); // horizon of the coarse MPC
+    pn.param("guide_dt", _guide_dt, 0.5); // step of the coarse MPC [s]
+    pn.param("guide_rate", _guide_rate, 1.0); // coarse solves per second [Hz]
+    pn.param("guide_max_age", _guide_max_age, 3.0); // oldest coarse plan that is tracked [s]
+    pn.param("guide_speed_step", _guide_speed_step, 0.05); // the reference speed follows the plan in these steps [m/s]
     pn.param("max_speed", _max_speed, 0.20); // unit: m/s
     pn.param("waypoints_dist", _waypointsDist, -1.0); // unit: m
     pn.param("path_length", _pathLength, 2.0); // unit: m
+    int fit_max_order;
+    double fit_tolerance, fit_min_window;
+    pn.param("path_fit_max_order", fit_max_order, 0); // adaptive fit of order 1 to this, 0 keeps the cubic
+    pn.param("path_fit_tolerance", fit_tolerance, 0.01); // RMS residual of an accepted order [m]
+    pn.param("path_fit_min_window", fit_min_window, 0.5); // shortest window of waypoints that is fitted [m]
+    _path_fit.SetAdaptive(fit_max_order, fit_tolerance, fit_min_window);
+    std::string reference_type;
+    double reference_spacing;
+    pn.param<std::string>("reference_type", reference_type, ""); // circle, epitrochoid, square, infinite: generated here, empty: desired_path topic
+    pn.param("reference_spacing", reference_spacing, 0.05); // between the generated poses [m]
     pn.param("goal_radius", _goalRadius, 0.5); // unit: m
     pn.param("controller_freq", _controller_freq, 10);
     //pn.param("vehicle_Lf", _Lf, 0.290); // distance between the front of the vehicle and its center of gravity
@@ -152,6 +355,106 @@ MPCNode::MPCNode()
     pn.param("mpc_max_angvel", _max_angvel, 3.0); // Maximal angvel radian (~30 deg)
     pn.param("mpc_max_throttle", _max_throttle, 1.0); // Maximal throttle accel
     pn.param("mpc_bound_value", _bound_value, 1.0e3); // Bound value for other variables
+    pn.param("mpc_persistent_tape", _persistent_tape, true); // Reuse the recorded CppAD tape across solves
+    pn.param("mpc_warm_start", _warm_start, true); // Seed each solve with the shifted previous solution
+    pn.param("mpc_pursuit_seed", _pursuit_seed, true); // Pure pursuit rollout as the start without a previous solution
+    pn.param("mpc_rti", _rti, false); // One SQP step per cycle instead of a full Ipopt solve
+    bool ltv;
+    pn.param("mpc_ltv", ltv, false); // Linear time-varying MPC: the mpc_rti linearization as one sparse QP solved by ADMM
+    pn.param("mpc_analytic", _analytic, false); // Hand-written derivatives instead of CppAD
+    pn.param("mpc_hessian", _hessian, 0); // 0 exact, 1 Gauss-Newton, 2 limited-memory
+    string linear_solver_name;
+    int linear_order, linear_threads;
+    pn.param<std::string>("mpc_linear_solver", linear_solver_name, ""); // Ipopt linear solver (mumps, ma27, ma57, ...), auto: the fastest at startup, empty: Ipopt's default
+    std::string ipopt_options_path;
+    pn.param<std::string>("mpc_ipopt_options", ipopt_options_path, ""); // Options file of mpc_ipopt_tune over the built-in Ipopt options, empty: none
+    pn.param("mpc_linear_order", linear_order, -1); // its fill-reducing ordering, see linear_solver.h, -1 its default
+    pn.param("mpc_linear_threads", linear_threads, 0); // OpenMP threads of ma86, ma97 and pardiso, 0 leaves OMP_NUM_THREADS
+    bool solve_policy;
+    int tracking_max_iter;
+    double tracking_tol;
+    pn.param("mpc_solve_policy", solve_policy, false); // Ipopt tolerances and max_iter by phase (start-up, tracking, near goal), see solve_policy.h
+    pn.param("mpc_tracking_tol", tracking_tol, 1e-5); // Ipopt tol while tracking
+    pn.param("mpc_tracking_max_iter", tracking_max_iter, 30); // Ipopt max_iter while tracking
+    pn.param("mpc_goal_phase_dist", _goal_phase_dist, 1.0); // Distance to the goal of the near goal phase [m]
+    pn.param("mpc_integrator", _integrator, 0); // 0 Euler, 1 RK2, 2 RK4, 3 exact arc, see integrator.h
+    pn.param("mpc_vehicle_model", _vehicle_model, 0); // 0 unicycle of FG_eval, 1 diff drive, 2 bicycle, 3 holonomic, see vehicle_model.h
+    pn.param("mpc_wheelbase", _wheelbase, 0.3); // bicycle, unit: m
+    pn.param("mpc_max_steer", _max_steer, 0.5); // bicycle, unit: rad
+    bool terminal;
+    double terminal_cte, terminal_etheta;
+    pn.param("mpc_terminal", terminal, false); // LQR cost-to-go on the last step, see terminal_cost.h
+    pn.param("mpc_terminal_cte", terminal_cte, 0.0); // terminal set on its cte [m], 0 none
+    pn.param("mpc_terminal_etheta", terminal_etheta, 0.0); // and on its etheta [rad]
+    pn.param("mpc_hypotheses", _hypotheses, 1); // parallel solves from different starts, 1 disables
+    pn.param("mpc_reduced", _reduced, false); // cte and etheta computed in the cost, not NLP variables
+    bool single_precision;
+    pn.param("mpc_single_precision", single_precision, false); // Jacobian and Hessian of the tape backend on a float tape
+    bool hessian_stages;
+    pn.param("mpc_hessian_stages", hessian_stages, false); // Hessian of the tape backend summed step by step
+    int hessian_threads;
+    pn.param("mpc_hessian_threads", hessian_threads, 1); // threads of those steps, the solving one included
+    int taylor_capacity;
+    pn.param("mpc_taylor_capacity", taylor_capacity, -1); // Taylor orders the tapes keep between solves, 0 frees them, -1 all
+    int input_stop, input_stop_iters;
+    double input_stop_tol;
+    pn.param("mpc_input_stop", input_stop, 0); // stop the tape solve once the inputs of that many first steps settled, 0 off
+    pn.param("mpc_input_stop_tol", input_stop_tol, 1e-3); // largest change of those inputs between iterates
+    pn.param("mpc_input_stop_iters", input_stop_iters, 2); // iterates in a row within it
+    bool split_tape;
+    pn.param("mpc_split_tape", split_tape, false); // cost and constraints on tapes of their own, for the gradient and Jacobian sweeps
+    bool constant_jacobian;
+    pn.param("mpc_constant_jacobian", constant_jacobian, false); // constant Jacobian entries swept once per recording
+    bool scaling;
+    pn.param("mpc_scaling", scaling, false); // fixed scaling of the tape solves from the parameters, instead of Ipopt's gradient-based one
+    int sparsity;
+    pn.param("mpc_sparsity", sparsity, -1); // sparsity sweeps of the tapes: 0 bit-packed, 1 sets, -1 auto
+    pn.param("wheel_torque_loop", _wheel_loop, true); // wheel torques on every /joint_states instead of every MPC cycle
+    pn.param("wheel_torque_gain", _wheel_gain, 0.001); // torque per wheel speed error [Nm s/rad]
+    pn.param("wheel_ref_timeout", _wheel_ref_timeout, 0.5); // brake to zero wheel speed when the reference is older [s]
+    pn.param("wheel_radius", _wheel_radius, 0.1); // unit: m
+    pn.param("track_width", _track_width, 0.265); // distance between the wheels, unit: m
+    string imu_topic;
+    double estimator_accel_noise, estimator_angaccel_noise, estimator_wheel_noise, estimator_gyro_noise;
+    double estimator_position_noise, estimator_heading_noise, estimator_max_age;
+    pn.param("state_estimator", _estimator_on, false); // fuse joint states, gyro and pose corrections here instead of reading the state from /odom
+    pn.param<std::string>("estimator_imu_topic", imu_topic, ""); // sensor_msgs/Imu of the gyro, empty without
+    pn.param("estimator_odom_pose", _estimator_odom_pose, true); // the pose of /odom corrects the estimate
+    pn.param("estimator_amcl", _estimator_amcl, false); // the AMCL pose in the odom frame corrects the estimate
+    pn.param("estimator_accel_noise", estimator_accel_noise, 0.5); // random walk of v [m/s^2]
+    pn.param("estimator_angaccel_noise", estimator_angaccel_noise, 1.0); // random walk of w [rad/s^2]
+    pn.param("estimator_wheel_noise", estimator_wheel_noise, 0.02); // of the speed of one wheel [m/s]
+    pn.param("estimator_gyro_noise", estimator_gyro_noise, 0.02); // [rad/s]
+    pn.param("estimator_position_noise", estimator_position_noise, 0.05); // of a pose without covariance [m]
+    pn.param("estimator_heading_noise", estimator_heading_noise, 0.05); // [rad]
+    pn.param("estimator_max_age", estimator_max_age, 0.5); // older measurements are dropped [s]
+    _estimator.Configure(estimator_accel_noise, estimator_angaccel_noise,
+                         estimator_wheel_noise / sqrt(2.0), 2.0 * estimator_wheel_noise / sqrt(2.0) / _track_width,
+                         estimator_gyro_noise, estimator_position_noise, estimator_heading_noise, estimator_max_age);
+    pn.param("mpc_dynamic", _dynamic, false); // wheel torques as MPC inputs instead of the wheel speed loop
+    pn.param("mpc_mass", _mass, 10.0); // unit: kg
+    pn.param("mpc_inertia", _inertia, 0.5); // about the vertical axis, unit: kg m^2
+    pn.param("mpc_damping", _damping, 0.0); // rolling resistance per speed [N s/m]
+    pn.param("mpc_ang_damping", _ang_damping, 0.0); // resistance per turn rate [N m s/rad]
+    pn.param("mpc_max_torque", _max_torque, 1.0); // per wheel [N m]
+    pn.param("mpc_soft_bounds", _soft_bounds, false); // angvel and throttle limits of the torque model as penalties
+    pn.param("mpc_w_slack", _w_slack, 1.0e4); // weight of exceeding them
+
+    //Parameter for the trajectory log, see trajectory_log.h
+    pn.param<std::string>("log_path", _log_path, ""); // binary log file, empty disables it
+    pn.param("log_max_mb", _log_max_mb, 64.0); // rotate above this size
+    pn.param("log_max_files", _log_max_files, 4); // rotated files kept
+
+    //Parameter for the flight recorder, see flight_recorder.h
+    int flight_cycles;
+    string flight_dir;
+    double flight_interval;
+    pn.param("flight_recorder_cycles", flight_cycles, 100); // cycles kept for a dump, 0 disables it
+    pn.param<std::string>("flight_recorder_dir", flight_dir, ""); // dump directory, empty for the working directory (ROS_HOME)
+    pn.param("flight_recorder_interval", flight_interval, 5.0); // least time between automatic dumps [s]
+
+    //Parameter for the trace spans, see trace_span.h
+    pn.param<std::string>("trace_path", _trace_path, "mpc_trace.json"); // Chrome trace JSON of write_trace, relative to the working directory
 
     //Parameter for topics & Frame name
     pn.param<std::string>("global_path_topic", _globalPath_topic, "/move_base/TrajectoryPlannerROS/global_plan" );
@@ -159,6 +462,16 @@ MPCNode::MPCNode()
     pn.param<std::string>("map_frame", _map_frame, "odom" ); //*****for mpc, "odom"
     pn.param<std::string>("odom_frame", _odom_frame, "odom");
     pn.param<std::string>("car_frame", _car_frame, "base_footprint" );
+    double tf_max_age;
+    pn.param("tf_max_age", tf_max_age, 0.5); // reuse the last transform this long when TF drops out [s]
+    _tf_cache.SetMaxAge(tf_max_age);
+    _tf_cache.AdvertiseDiagnostics(_nh, pn.getNamespace());
+    _tf_cache.SetMetrics(&_metrics.Metrics());
+    double metrics_period;
+    int metrics_port;
+    pn.param("metrics_period", metrics_period, 1.0); // controller summary on /diagnostics [s]
+    pn.param("metrics_port", metrics_port, 0); // Prometheus metrics on http://host:port/metrics, 0 disables
+    _metrics.Start(_nh, pn.getNamespace(), metrics_period, metrics_port);
 
     //Display the parameters
     cout << "\n===== Parameters =====" << endl;
@@ -173,37 +486,66 @@ MPCNode::MPCNode()
     cout << "mpc_w_etheta: "  << _w_etheta << endl;
     cout << "mpc_max_angvel: "  << _max_angvel << endl;
 
+    // The reference generated in the odom frame, windowed along with the
+    // robot in odomCB, or the desired_path of a generator node
+    _reference_start = -1;
+    if(!reference_type.empty())
+    {
+        if(_reference.Generate(reference_type, reference_spacing))
+        {
+            boost::shared_ptr<CompactPath> full = boost::make_shared<CompactPath>();
+            _reference.Full(_odom_frame, ros::Time::now(), *full);
+            _reference_index.Set(full);
+            ROS_INFO("Reference %s generated: %zu poses over %.2f m", reference_type.c_str(), _reference.Size(), _reference.Length());
+        }
+        else
+            ROS_ERROR("Unknown reference_type %s, waiting for desired_path", reference_type.c_str());
+    }
+
     //Publishers and Subscribers
-    _sub_odom   = _nh.subscribe("/odom", 1, &MPCNode::odomCB, this);
-    _sub_path   = _nh.subscribe( _globalPath_topic, 1, &MPCNode::pathCB, this);
-    _sub_gen_path   = _nh.subscribe( "desired_path", 1, &MPCNode::desiredPathCB, this);
-    _sub_goal   = _nh.subscribe( _goal_topic, 1, &MPCNode::goalCB, this);
-    _sub_amcl   = _nh.subscribe("/amcl_pose", 5, &MPCNode::amclCB, this);
+    ros::NodeHandle control_nh = _callback_queues ? _queues.Control(_nh) : _nh;
+    ros::NodeHandle bulk_nh = _callback_queues ? _queues.Bulk(_nh) : _nh;
+    _sub_odom   = control_nh.subscribe("/odom", 1, &MPCNode::odomCB, this);
+    _sub_path   = bulk_nh.subscribe( _globalPath_topic, 1, &MPCNode::pathCB, this);
+    if(_reference.Empty()) // a generator node publishes the reference
+        _sub_gen_path   = bulk_nh.subscribe( "desired_path", 1, &MPCNode::desiredPathCB, this);
+    _sub_goal   = bulk_nh.subscribe( _goal_topic, 1, &MPCNode::goalCB, this);
+    _sub_amcl   = bulk_nh.subscribe("/amcl_pose", 5, &MPCNode::amclCB, this);
     
     _pub_odompath  = _nh.advertise<nav_msgs::Path>("/mpc_reference", 1); // reference path for MPC ///mpc_reference 
     _pub_mpctraj   = _nh.advertise<nav_msgs::Path>("/mpc_trajectory", 1);// MPC trajectory output
+    if(compact_trajectory)
+        _pub_compact_traj.Advertise(_nh, "/mpc_trajectory_compact");
     //_pub_ackermann = _nh.advertise<ackermann_msgs::AckermannDriveStamped>("/ackermann_cmd", 1);
     if(_pub_twist_flag)
         _pub_twist = _nh.advertise<geometry_msgs::Twist>("/cmd_vel", 1); //for stage (Ackermann msg non-supported)
     
-    _pub_totalcost  = _nh.advertise<std_msgs::Float32>("/total_cost", 1); // Global path generated from another source
-    _pub_ctecost  = _nh.advertise<std_msgs::Float32>("/cross_track_error", 1); // Global path generated from another source
-    _pub_ethetacost  = _nh.advertise<std_msgs::Float32>("/theta_error", 1); // Global path generated from another source
+    if(_publish_cost)
+    {
+        _pub_totalcost  = _nh.advertise<std_msgs::Float32>("/total_cost", 1); // cost of the MPC solution
+        _pub_ctecost  = _nh.advertise<std_msgs::Float32>("/cross_track_error", 1); // cross track error term
+        _pub_ethetacost  = _nh.advertise<std_msgs::Float32>("/theta_error", 1); // heading error term
+    }
     
     //Timer
-    _timer1 = _nh.createTimer(ros::Duration((1.0)/_controller_freq), &MPCNode::controlLoopCB, this); // 10Hz //*****mpc
+    _timer1 = control_nh.createTimer(ros::Duration((1.0)/_controller_freq), &MPCNode::controlLoopCB, this); // 10Hz //*****mpc
+    if(_control_trigger.Enabled() && _control_trigger.Offset() > 0)
+        _trigger_timer = control_nh.createTimer(ros::Duration(_control_trigger.Offset()), &MPCNode::triggerCB, this, true, false);
+    if(_reference.Empty())
+        _path_timer = bulk_nh.createTimer(ros::Duration((1.0)/_controller_freq), &MPCNode::desiredPathTimerCB, this);
 
     //Init variables
     _goal_received = false;
+    _near_goal = false;
     _goal_reached  = false;
     _path_computed = false;
     _throttle = 0.0; 
+    _cycle_overhead = 0.0;
     _w = 0.0;
     _speed = 0.0;
 
     //_ackermann_msg = ackermann_msgs::AckermannDriveStamped();
     _twist_msg = geometry_msgs::Twist();
-    _mpc_traj = nav_msgs::Path();
 
     //Init parameters for MPC object
     _mpc_params["DT"] = _dt;
@@ -222,18 +564,95 @@ MPCNode::MPCNode()
     _mpc_params["ANGVEL"]   = _max_angvel;
     _mpc_params["MAXTHR"]   = _max_throttle;
     _mpc_params["BOUND"]    = _bound_value;
+    _mpc_params["TAPE"]     = _persistent_tape;
+    _mpc_params["WARM"]     = _warm_start;
+    _mpc_params["PURSUIT_SEED"] = _pursuit_seed;
+    _mpc_params["RTI"]      = _rti;
+    _mpc_params["LTV"]      = ltv;
+    _mpc_params["ANALYTIC"] = _analytic;
+    _mpc_params["HESSIAN"]  = _hessian;
+    _mpc_params["INTEGRATOR"] = _integrator;
+    _mpc_params["VEHICLE_MODEL"] = _vehicle_model;
+    _mpc_params["WHEELBASE"] = _wheelbase;
+    _mpc_params["MAXSTEER"] = _max_steer;
+    _mpc_params["TERMINAL"] = terminal;
+    _mpc_params["TERMINAL_CTE"] = terminal_cte;
+    _mpc_params["TERMINAL_ETHETA"] = terminal_etheta;
+    _mpc_params["HYPOTHESES"] = _hypotheses;
+    _mpc_params["REDUCED"]  = _reduced;
+    _mpc_params["PRECISION"] = single_precision ? 1 : 0;
+    _mpc_params["HESSIAN_STAGES"] = hessian_stages ? 1 : 0;
+    _mpc_params["HESSIAN_THREADS"] = hessian_threads;
+    _mpc_params["TAYLOR_CAPACITY"] = taylor_capacity;
+    _mpc_params["INPUT_STOP"] = input_stop;
+    _mpc_params["INPUT_STOP_TOL"] = input_stop_tol;
+    _mpc_params["INPUT_STOP_ITERS"] = input_stop_iters;
+    _mpc_params["SCALING"] = scaling ? 1 : 0;
+    _mpc_params["SPLIT_TAPE"] = split_tape ? 1 : 0;
+    _mpc_params["CONST_JACOBIAN"] = constant_jacobian ? 1 : 0;
+    _mpc_params["SPARSITY"] = sparsity;
+    _mpc_params["DYNAMIC"]  = _dynamic;
+    _mpc_params["MASS"]     = _mass;
+    _mpc_params["INERTIA"]  = _inertia;
+    _mpc_params["WHEEL_RADIUS"] = _wheel_radius;
+    _mpc_params["TRACK_WIDTH"] = _track_width;
+    _mpc_params["DAMPING"]  = _damping;
+    _mpc_params["ANG_DAMPING"] = _ang_damping;
+    _mpc_params["MAXTORQUE"] = _max_torque;
+    _mpc_params["SOFT"] = _soft_bounds;
+    _mpc_params["W_SLACK"] = _w_slack;
+    _mpc_params["LINEAR_ORDER"] = linear_order;
+    _mpc_params["LINEAR_THREADS"] = linear_threads;
+    _mpc_params["POLICY"] = solve_policy;
+    _mpc_params["TOL_TRACKING"] = tracking_tol;
+    _mpc_params["MAX_ITER_TRACKING"] = tracking_max_iter;
+    _mpc_params["LINEAR_SOLVER"] = linear_solver::Parse(linear_solver_name);
+    if(linear_solver_name == "auto")
+    {
+        std::string report;
+        _mpc_params["LINEAR_SOLVER"] = MPC::CalibrateLinearSolver(_mpc_params, report);
+        ROS_INFO("Linear solvers on this horizon: %s. Using %s", report.c_str(), linear_solver::Name(_mpc_params["LINEAR_SOLVER"]));
+    }
+    else if(_mpc_params["LINEAR_SOLVER"] < 0)
+    {
+        ROS_WARN("Unknown mpc_linear_solver %s, using Ipopt's default", linear_solver_name.c_str());
+        _mpc_params["LINEAR_SOLVER"] = linear_solver::DEFAULT;
+    }
     _mpc.LoadParams(_mpc_params);
+    if(!ipopt_options_path.empty())
+    {
+        std::string ipopt_options, error;
+        if(ipopt_options::Load(ipopt_options_path, ipopt_options, error))
+            _mpc.SetIpoptOptions(ipopt_options);
+        else
+            ROS_WARN("Ipopt options file not used, %s", error.c_str());
+    }
+    if(_guide_on && !_arc_reference)
+    {
+        ROS_WARN("guide only applies with arc_reference");
+        _guide_on = false;
+    }
+    if(_guide_on)
+        _guide.Start(_mpc_params, _guide_steps, _guide_dt, _guide_rate);
 
     min_idx = 0;
     idx = 0;
+    _arc_hint = -1;
     _mpc_etheta = 0;
     _mpc_cte = 0;
-    file.open("/home/geonhee/catkin_ws/src/mpc_ros/mpc.csv");
+    if(!_log_path.empty() && !_log.Open(_log_path, _log_max_mb * 1e6, _log_max_files))
+        ROS_WARN("Cannot open the trajectory log %s", _log_path.c_str());
+    if(flight_cycles > 0 && _flight.Open(flight_dir, flight_cycles, flight_interval))
+        _srv_flight = _nh.advertiseService("dump_flight_recorder", &MPCNode::dumpFlightCB, this);
+    if(trace_span::Enabled())
+        _srv_trace = _nh.advertiseService("write_trace", &MPCNode::writeTraceCB, this);
 
     _pub_RW = _nh.advertise<std_msgs::Float64>("/right_wheel_controller/command", 1); // torque on right wheel
     _pub_LW = _nh.advertise<std_msgs::Float64>("/left_wheel_controller/command", 1); // torque on left wheel
 
-    _sub_vel_rodas = _nh.subscribe("/joint_states", 1, &MPCNode::get_vel_rodas, this);
+    _sub_vel_rodas = control_nh.subscribe("/joint_states", 1, &MPCNode::get_vel_rodas, this);
+    if(_estimator_on && !imu_topic.empty())
+        _sub_imu = control_nh.subscribe(imu_topic, 1, &MPCNode::imuCB, this);
 
     _wl = 0.0;
     _wr = 0.0;
@@ -241,181 +660,237 @@ MPCNode::MPCNode()
     _torqueL = 0.0;
     // _wr_curr.data = 0.0;
     // _wl_curr.data = 0.0;
+
+    if(_prep_thread)
+        _reference_prep.Start(std::bind(&MPCNode::prepareReference, this, std::placeholders::_1));
+    if(_async_solve)
+    {
+        _solver_thread.Start(std::bind(&MPCNode::solveControl, this, std::placeholders::_1), _realtime);
+        if(!_solver_thread.RealtimeReport().empty())
+            ROS_WARN("Solver thread runs without its realtime settings: %s", _solver_thread.RealtimeReport().c_str());
+    }
+    if(_callback_queues)
+    {
+        _queues.Start(_realtime, 1);
+        if(!_queues.RealtimeReport().empty())
+            ROS_WARN("Control queue runs without its realtime settings: %s", _queues.RealtimeReport().c_str());
+    }
+    else if(!_async_solve && _realtime.Enabled())
+        ROS_WARN("rt_priority, rt_cpus and rt_prefault_stack_kb only apply with async_solve or callback_queues");
 }
 
 MPCNode::~MPCNode()
 {
-    file.close();
+    _queues.Stop();
+    _solver_thread.Stop();
+    _guide.Stop();
+    _reference_prep.Stop();
+    _log.Close();
+    _flight.Close();
     
 };
 
 void MPCNode::get_vel_rodas(const sensor_msgs::JointState & msg){
+    if(msg.velocity.size() < 2)
+        return;
     _wl_curr.data = msg.velocity[0];
     _wr_curr.data = msg.velocity[1];
-    
+    if(_estimator_on)
+    {
+        const double stamp = msg.header.stamp.isZero() ? ros::Time::now().toSec() : msg.header.stamp.toSec();
+        _estimator.UpdateWheels(stamp, _wheel_radius*(msg.velocity[0] + msg.velocity[1])/2,
+                                _wheel_radius*(msg.velocity[1] - msg.velocity[0])/_track_width);
+    }
+
+    if(!_wheel_loop || !_pub_twist_flag || _dynamic || _command_sink)
+        return;
+
+    // Inner loop: P control of the wheel speeds at the joint state rate
+    WheelReference ref;
+    if(!_wheel_ref.Get(ref) || ros::Time::now().toSec() - ref.stamp > _wheel_ref_timeout)
+        ref.left = ref.right = 0.0;
+    std_msgs::Float64 torque;
+    torque.data = _wheel_gain*(ref.right - msg.velocity[1]);
+    _pub_RW.publish(torque);
+    torque.data = _wheel_gain*(ref.left - msg.velocity[0]);
+    _pub_LW.publish(torque);
 }
 
-// Public: return _thread_numbers
-int MPCNode::get_thread_numbers()
+bool MPCNode::sinkCommand(const MPCCommand *cmd)
 {
-    return _thread_numbers;
+    LatestValue<CommandWindow> *sink = _command_sink;
+    if(!sink)
+        return false;
+    CommandWindow window;
+    window.Assign(cmd);
+    sink->Set(window);
+    return true;
 }
 
-
-// Evaluate a polynomial.
-double MPCNode::polyeval(Eigen::VectorXd coeffs, double x) 
+// CallBack: gyro of the state estimate
+void MPCNode::imuCB(const sensor_msgs::Imu::ConstPtr& imuMsg)
 {
-    double result = 0.0;
-    for (int i = 0; i < coeffs.size(); i++) 
-    {
-        result += coeffs[i] * pow(x, i);
-    }
-    return result;
+    const double stamp = imuMsg->header.stamp.isZero() ? ros::Time::now().toSec() : imuMsg->header.stamp.toSec();
+    _estimator.UpdateGyro(stamp, imuMsg->angular_velocity.z);
 }
 
-
-// Fit a polynomial.
-// Adapted from
-// https://github.com/JuliaMath/Polynomials.jl/blob/master/src/Polynomials.jl#L676-L716
-Eigen::VectorXd MPCNode::polyfit(Eigen::VectorXd xvals, Eigen::VectorXd yvals, int order) 
+// Public: return _thread_numbers
+int MPCNode::get_thread_numbers()
 {
-    assert(xvals.size() == yvals.size());
-    assert(order >= 1 && order <= xvals.size() - 1);
-    Eigen::MatrixXd A(xvals.size(), order + 1);
+    return _thread_numbers;
+}
 
-    for (int i = 0; i < xvals.size(); i++)
-        A(i, 0) = 1.0;
 
-    for (int j = 0; j < xvals.size(); j++) 
+// CallBack: Update odometry
+void MPCNode::odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg)
+{
+    MPC_TRACE_SPAN("odom_cb");
+    _odom.Set(odomMsg);
+    if(_estimator_on && (_estimator_odom_pose || !_estimator.Initialized()))
     {
-        for (int i = 0; i < order; i++) 
-            A(j, i + 1) = A(j, i) * xvals(j);
+        // The first one starts the estimate in any case
+        tf::Pose pose;
+        tf::poseMsgToTF(odomMsg->pose.pose, pose);
+        const double stamp = odomMsg->header.stamp.isZero() ? ros::Time::now().toSec() : odomMsg->header.stamp.toSec();
+        _estimator.UpdatePose(stamp, odomMsg->pose.pose.position.x, odomMsg->pose.pose.position.y,
+                              tf::getYaw(pose.getRotation()),
+                              max(odomMsg->pose.covariance[0], odomMsg->pose.covariance[7]), odomMsg->pose.covariance[35]);
     }
-
-    auto Q = A.householderQr();
-    auto result = Q.solve(yvals);
-    return result;
+    if(!_reference.Empty())
+        updateReference(*odomMsg);
+    if(_prep_thread)
+        _reference_prep.Notify();
+    odomTrigger();
 }
 
-// CallBack: Update odometry
-void MPCNode::odomCB(const nav_msgs::Odometry::ConstPtr& odomMsg)
+// CallBack: Update generated path. Only the newest message is kept, a
+// generator publishing faster than the controller costs one pointer swap per
+// message.
+void MPCNode::desiredPathCB(const CompactPath::ConstPtr& totalPathMsg)
 {
-    _odom = *odomMsg;
-    
+    _desired_path.Set(totalPathMsg);
 }
 
-// CallBack: Update generated path (conversion to odom frame)
-void MPCNode::desiredPathCB(const nav_msgs::Path::ConstPtr& totalPathMsg)
+// Timer: conversion of the newest generated path to the odom frame, at most
+// once per control period
+void MPCNode::desiredPathTimerCB(const ros::TimerEvent&)
 {
-    
-    _gen_path = *totalPathMsg;
-    
+    LatestMsg<CompactPath>::ConstPtr totalPathMsg = _desired_path.Get();
+    if(!totalPathMsg || totalPathMsg == _desired_last)
+        return;
+    _desired_last = totalPathMsg;
+
+    MPC_TRACE_SPAN("desired_path_cb");
     _goal_received = true;
     _goal_reached = false;
-    nav_msgs::Path mpc_path = nav_msgs::Path();   // For generating mpc reference path  
-    geometry_msgs::PoseStamped tempPose;
-    nav_msgs::Odometry odom = _odom; 
-
-    try
-    {
-        double total_length = 0.0;
-        //find waypoints distance
-        if(_waypointsDist <= 0.0)
-        {        
-            double gap_x = totalPathMsg->poses[1].pose.position.x - totalPathMsg->poses[0].pose.position.x;
-            double gap_y = totalPathMsg->poses[1].pose.position.y - totalPathMsg->poses[0].pose.position.y;
-            _waypointsDist = sqrt(gap_x*gap_x + gap_y*gap_y);             
-        }                       
-
-        // Find the nearst point for robot position
-        
-        int min_val = 100; 
-
-        int N = totalPathMsg->poses.size(); // Number of waypoints        
-        const double px = odom.pose.pose.position.x; //pose: odom frame
-        const double py = odom.pose.pose.position.y;
-        const double ptheta = odom.pose.pose.position.y;
+    boost::shared_ptr<CompactPath> mpc_path = boost::make_shared<CompactPath>();   // For generating mpc reference path  
+    static const nav_msgs::Odometry no_odom;
+    nav_msgs::Odometry::ConstPtr odom_msg = _odom.Get();
+    const nav_msgs::Odometry &odom = odom_msg ? *odom_msg : no_odom; 
+
+    // path -> odom once for the whole path, without waiting on TF
+    tf::Transform path_to_odom;
+    const std::string &path_frame = totalPathMsg->Frame().empty() ? _odom_frame : totalPathMsg->Frame();
+    if(!_tf_cache.Lookup(_tf_listener, _odom_frame, path_frame, path_to_odom))
+        return; // keep the previous path, the next message retries
+
+    double total_length = 0.0;
+    //find waypoints distance
+    if(_waypointsDist <= 0.0)
+    {        
+        double gap_x = totalPathMsg->X(1) - totalPathMsg->X(0);
+        double gap_y = totalPathMsg->Y(1) - totalPathMsg->Y(0);
+        _waypointsDist = sqrt(gap_x*gap_x + gap_y*gap_y);             
+    }                       
+
+    // Find the nearst point for robot position, see path_index.h. A path
+    // that only trims what is behind the robot keeps the progress.
+    int N = totalPathMsg->Size(); // Number of waypoints        
+    _path_index.Set(totalPathMsg);
+    min_idx = _path_index.Nearest(odom.pose.pose.position.x, odom.pose.pose.position.y);
+
+    _desired_window.Clear();
+    for(int i = min_idx; i < N ; i++)
+    {
+        if(total_length > _pathLength)
+            break;
         
-        double dx, dy; // difference distance
-        double pre_yaw = 0;
-        double roll, pitch, yaw = 0;
-
-        for(int i = min_idx; i < N; i++) 
-        {
-            dx = totalPathMsg->poses[i].pose.position.x - px;
-            dy = totalPathMsg->poses[i].pose.position.y - py;
-                    
-            tf::Quaternion q(
-                totalPathMsg->poses[i].pose.orientation.x,
-                totalPathMsg->poses[i].pose.orientation.y,
-                totalPathMsg->poses[i].pose.orientation.z,
-                totalPathMsg->poses[i].pose.orientation.w);
-            tf::Matrix3x3 m(q);
-            m.getRPY(roll, pitch, yaw);
-
-            if(abs(pre_yaw - yaw) > 5)
-            {
-                cout << "abs(pre_yaw - yaw)" << abs(pre_yaw - yaw) << endl;
-                pre_yaw = yaw;
-            }
-       
-            if(min_val > sqrt(dx*dx + dy*dy) && abs((int)(i - min_idx)) < 50)
-            {
-                min_val = sqrt(dx*dx + dy*dy);
-                min_idx = i;
-            }
-        }
-        for(int i = min_idx; i < N ; i++)
+        _desired_window.PushBack(totalPathMsg->X(i), totalPathMsg->Y(i), totalPathMsg->Yaw(i));
+        total_length = total_length + _waypointsDist;           
+    }   
+    
+    // Connect the end of path to the front
+    if(total_length < _pathLength )
+    {
+        for(int i = 0; i < N ; i++)
         {
-            if(total_length > _pathLength)
+            if(total_length > _pathLength)                
                 break;
-            
-            _tf_listener.transformPose(_odom_frame, ros::Time(0) , 
-                                            totalPathMsg->poses[i], _odom_frame, tempPose);                     
-            mpc_path.poses.push_back(tempPose);                          
-            total_length = total_length + _waypointsDist;           
-        }   
-        
-        // Connect the end of path to the front
-        if(total_length < _pathLength )
-        {
-            for(int i = 0; i < N ; i++)
-            {
-                if(total_length > _pathLength)                
-                    break;
-                _tf_listener.transformPose(_odom_frame, ros::Time(0) , 
-                                                totalPathMsg->poses[i], _odom_frame, tempPose);                     
-                mpc_path.poses.push_back(tempPose);                          
-                total_length = total_length + _waypointsDist;    
-            }
-        }  
-
-        if(mpc_path.poses.size() >= _pathLength )
-        {
-            _odom_path = mpc_path; // Path waypoints in odom frame
-            _path_computed = true;
-            // publish odom path
-            mpc_path.header.frame_id = _odom_frame;
-            mpc_path.header.stamp = ros::Time::now();
-            _pub_odompath.publish(mpc_path);
+            _desired_window.PushBack(totalPathMsg->X(i), totalPathMsg->Y(i), totalPathMsg->Yaw(i));
+            total_length = total_length + _waypointsDist;    
         }
-        else
-        {
-            cout << "Failed to path generation" << endl;
-            _waypointsDist = -1;
-        }       
+    }  
+
+    // Only the kept poses, no messages for the waypoints
+    _path_transform.Transform(path_to_odom, _desired_window);
+    for(size_t i = 0; i < _desired_window.Size(); i++)
+        mpc_path->PushBack(_path_transform.X(i), _path_transform.Y(i), _path_transform.Yaw(i));
+
+    if(mpc_path->Size() >= _pathLength )
+        setOdomPath(mpc_path, true);
+    else
+    {
+        cout << "Failed to path generation" << endl;
+        _waypointsDist = -1;
+    }       
+    
+}
+
+// Odometry: the window of the in-process reference follows the robot. A
+// moved window is the same trajectory, the event trigger keeps its
+// prediction.
+void MPCNode::updateReference(const nav_msgs::Odometry &odom)
+{
+    const long start = _reference_index.Nearest(odom.pose.pose.position.x, odom.pose.pose.position.y);
+    if(start == _reference_start)
+        return;
+    const bool first = _reference_start < 0;
+    _reference_start = start;
+    if(first)
+    {
+        _goal_received = true;
+        _goal_reached = false;
     }
-    catch(tf::TransformException &ex)
+
+    boost::shared_ptr<CompactPath> mpc_path = boost::make_shared<CompactPath>();
+    _reference.Window(start, _pathLength, _odom_frame, ros::Time::now(), *mpc_path);
+    setOdomPath(mpc_path, first);
+}
+
+// Hand the reference in the odom frame to the control loop and publish it
+void MPCNode::setOdomPath(const boost::shared_ptr<CompactPath> &mpc_path, bool new_plan)
+{
+    mpc_path->SetFrame(_odom_frame);
+    mpc_path->SetStamp(ros::Time::now());
+    _odom_path.Set(mpc_path); // Path waypoints in odom frame
+    if(new_plan)
+        _event_trigger.Reset(); // new plan, solve again
+    if(_arc_reference)
     {
-        ROS_ERROR("%s",ex.what());
-        ros::Duration(1.0).sleep();
+        boost::shared_ptr<ArcPath> arc_path = boost::make_shared<ArcPath>();
+        if(arc_path->Set(*mpc_path))
+            _arc_path.Set(arc_path);
     }
-    
+    _path_computed = true;
+    if(_prep_thread)
+        _reference_prep.Notify();
+    _pub_odompath.publish(mpc_path); // as a nav_msgs/Path, see compact_path_msg.h
 }
 
 // CallBack: Update path waypoints (conversion to odom frame)
-void MPCNode::pathCB(const nav_msgs::Path::ConstPtr& pathMsg)
+void MPCNode::pathCB(const CompactPath::ConstPtr& pathMsg)
 {    
+    MPC_TRACE_SPAN("path_cb");
 }
 
 // CallBack: Update goal status
@@ -431,16 +906,31 @@ void MPCNode::goalCB(const geometry_msgs::PoseStamped::ConstPtr& goalMsg)
 // Callback: Check if the car is inside the goal area or not 
 void MPCNode::amclCB(const geometry_msgs::PoseWithCovarianceStamped::ConstPtr& amclMsg)
 {
+    // Localization correction of the estimate, in the odom frame it runs in
+    tf::Transform map_to_odom;
+    if(_estimator_on && _estimator_amcl
+       && _tf_cache.Lookup(_tf_listener, _odom_frame, amclMsg->header.frame_id, map_to_odom))
+    {
+        tf::Pose pose;
+        tf::poseMsgToTF(amclMsg->pose.pose, pose);
+        pose = map_to_odom * pose;
+        const double stamp = amclMsg->header.stamp.isZero() ? ros::Time::now().toSec() : amclMsg->header.stamp.toSec();
+        _estimator.UpdatePose(stamp, pose.getOrigin().x(), pose.getOrigin().y(), tf::getYaw(pose.getRotation()),
+                              max(amclMsg->pose.covariance[0], amclMsg->pose.covariance[7]), amclMsg->pose.covariance[35]);
+    }
+
     if(_goal_received)
     {
         double car2goal_x = _goal_pos.x - amclMsg->pose.pose.position.x;
         double car2goal_y = _goal_pos.y - amclMsg->pose.pose.position.y;
         double dist2goal = sqrt(car2goal_x*car2goal_x + car2goal_y*car2goal_y);
+        _near_goal = dist2goal < _goal_phase_dist;
         cout << "dist2goal: " << dist2goal << endl;
         if(dist2goal < _goalRadius)
         {
             _goal_received = false;
             _goal_reached = true;
+            _near_goal = false;
             _path_computed = false;
             ROS_INFO("Goal Reached !");
         }
@@ -448,105 +938,101 @@ void MPCNode::amclCB(const geometry_msgs::PoseWithCovarianceStamped::ConstPtr& a
 }
 
 
-// Timer: Control Loop (closed loop nonlinear MPC)
+// The odometry starts the cycle with odom_trigger
+void MPCNode::odomTrigger()
+{
+    if(!_control_trigger.Odometry())
+        return;
+    if(_control_trigger.Offset() > 0)
+    {
+        // One-shot, restarted by every k-th message
+        _trigger_timer.stop();
+        _trigger_timer.setPeriod(ros::Duration(_control_trigger.Offset()));
+        _trigger_timer.start();
+    }
+    else
+        controlCycle();
+}
+
+void MPCNode::triggerCB(const ros::TimerEvent&)
+{
+    controlCycle();
+}
+
+// Timer: the control cycle, or with odom_trigger its watchdog
 void MPCNode::controlLoopCB(const ros::TimerEvent&)
-{          
+{
+    if(!_control_trigger.Overdue(ros::Time::now().toSec(), 1.0 / _controller_freq))
+        return;
+    if(_control_trigger.Enabled())
+    {
+        _control_trigger.CountWatchdog();
+        ROS_WARN_THROTTLE(5.0, "No odometry, the timer runs the control cycle (%u times)", _control_trigger.Watchdog());
+    }
+    controlCycle();
+}
+
+// Control Loop (closed loop nonlinear MPC)
+void MPCNode::controlCycle()
+{
+    // An odometry and a watchdog cycle at once: the later one is dropped
+    std::unique_lock<std::mutex> cycle_lock(_cycle_mutex, std::try_to_lock);
+    if(!cycle_lock.owns_lock())
+        return;
+    _control_trigger.Started(ros::Time::now().toSec());
+    MPC_TRACE_SPAN("control_timer");
     if(_goal_received && !_goal_reached && _path_computed ) //received goal & goal not reached    
     {    
-        nav_msgs::Odometry odom = _odom; 
-        nav_msgs::Path odom_path = _odom_path;   
-
-        // Update system states: X=[x, y, theta, v]
-        const double px = odom.pose.pose.position.x; //pose: odom frame
-        const double py = odom.pose.pose.position.y;
-        tf::Pose pose;
-        tf::poseMsgToTF(odom.pose.pose, pose);
-        const double theta = tf::getYaw(pose.getRotation());
-        const double v = odom.twist.twist.linear.x; //twist: body fixed frame
-        // Update system inputs: U=[w, throttle]
-        const double w = _w; // steering -> w
-        //const double steering = _steering;  // radian
-        const double throttle = _throttle; // accel: >0; brake: <0
-        const double dt = _dt;
-        //const double Lf = _Lf;
-
-        // Waypoints related parameters
-        const int N = odom_path.poses.size(); // Number of waypoints
-        const double costheta = cos(theta);
-        const double sintheta = sin(theta);
-
-        // Convert to the vehicle coordinate system
-        VectorXd x_veh(N);
-        VectorXd y_veh(N);
-        for(int i = 0; i < N; i++) 
+        MPCCommand cmd;
+        double angvel = 0.0;
+        double t;
+        bool valid;
+        if(_async_solve)
         {
-            const double dx = odom_path.poses[i].pose.position.x - px;
-            const double dy = odom_path.poses[i].pose.position.y - py;
-            x_veh[i] = dx * costheta + dy * sintheta;
-            y_veh[i] = dy * costheta - dx * sintheta;
+            // The solver thread starts from the newest state, meanwhile follow the last solution
+            _solver_thread.Notify();
+            t = ros::Time::now().toSec();
+            valid = _solver_thread.Latest(cmd) && cmd.Sample(t, _speed, angvel);
         }
-        
-        // Fit waypoints
-        auto coeffs = polyfit(x_veh, y_veh, 3); 
-
-        const double cte  = polyeval(coeffs, 0.0);
-        const double etheta = atan(coeffs[1]);
+        else
+        {
+            // A replayed command is sampled at this tick, a new one at its
+            // first step as before
+            const double tick = ros::Time::now().toSec();
+            valid = solveControl(cmd);
+            t = max(tick, cmd.stamp);
+            valid = valid && cmd.Sample(t, _speed, angvel);
+        }
+        if(!valid)
+        {
+            _speed = 0.0;
+            angvel = 0.0;
+        }
+        sinkCommand(valid ? &cmd : NULL);
 
-        _mpc_cte = cte;
-        _mpc_etheta = etheta;
+        _wl = (_speed - angvel*(_track_width/2))/_wheel_radius;
+        _wr = (_speed + angvel*(_track_width/2))/_wheel_radius;
 
-        VectorXd state(6);
-        if(_delay_mode)
+        if(_dynamic)
         {
-            // Kinematic model is used to predict vehicle state at the actual moment of control (current time + delay dt)
-            const double px_act = v * dt;
-            const double py_act = 0;
-            const double theta_act = w * dt; //(steering) theta_act = v * steering * dt / Lf;
-            const double v_act = v + throttle * dt; //v = v + a * dt
-            
-            const double cte_act = cte + v * sin(etheta) * dt;
-            const double etheta_act = etheta - theta_act;  
-            
-            state << px_act, py_act, theta_act, v_act, cte_act, etheta_act;
+            // Torques of the MPC model, no wheel speed loop in between
+            if(!valid || !cmd.SampleTorque(t, _torqueR, _torqueL))
+                _torqueR = _torqueL = 0.0;
+        }
+        else if(_wheel_loop)
+        {
+            WheelReference ref = { _wl, _wr, ros::Time::now().toSec() };
+            _wheel_ref.Set(ref);
         }
         else
         {
-            state << 0, 0, 0, v, cte, etheta;
+            _torqueL = _wheel_gain*(_wl - _wl_curr.data);
+            _torqueR = _wheel_gain*(_wr - _wr_curr.data);
         }
-        
-        // Solve MPC Problem
-        vector<double> mpc_results = _mpc.Solve(state, coeffs);
-              
-        // MPC result (all described in car frame), output = (acceleration, w)        
-        _w = mpc_results[0]; // radian/sec, angular velocity
-        _throttle = mpc_results[1]; // acceleration
-        _speed = v + _throttle*dt;  // speed
-        if (_speed >= _max_speed)
-            _speed = _max_speed;
-        if(_speed <= 0.0)
-            _speed = 0.0;
-
-
-        _wl = (_speed - _w*(0.265/2))/0.1;
-        _wr = (_speed + _w*(0.265/2))/0.1;
-
-        _torqueL = 0.001*(_wl - _wl_curr.data);
-        _torqueR = 0.001*(_wr - _wr_curr.data);
-
 
         // if(_debug_info)
         if(1)
         {
-            cout << "\n\nDEBUG" << endl;
-            // cout << "theta: " << theta << endl;
-            cout << "V: " << v << endl;
-            //cout << "odom_path: \n" << odom_path << endl;
-            //cout << "x_points: \n" << x_veh << endl;
-            //cout << "y_points: \n" << y_veh << endl;
-            // cout << "coeffs: \n" << coeffs << endl;
-            cout << "_w: " << _w << "rad/s \n" << endl;
-            cout << "_throttle: " << _throttle << " m/s² \n"  <<endl;
-            cout << "_speed: " << _speed << " m/s \n" << endl;
             cout << "_wl: " << _wl << " rad/s \n" << endl;
             cout << "_wr: " << _wr << " rad/s \n" << endl;
             cout << "_wl_curr: " << _wl_curr.data << " rad/s \n" << endl;
@@ -554,31 +1040,26 @@ void MPCNode::controlLoopCB(const ros::TimerEvent&)
             cout << "_torqueL: " << _torqueL << " Nm \n" << endl;
             cout << "_torqueR: " << _torqueR << " Nm \n" << endl;
         }
-
-        // Display the MPC predicted trajectory
-        _mpc_traj = nav_msgs::Path();
-        _mpc_traj.header.frame_id = _car_frame; // points in car coordinate        
-        _mpc_traj.header.stamp = ros::Time::now();
-        for(int i=0; i<_mpc.mpc_x.size(); i++)
-        {
-            geometry_msgs::PoseStamped tempPose;
-            tempPose.header = _mpc_traj.header;
-            tempPose.pose.position.x = _mpc.mpc_x[i];
-            tempPose.pose.position.y = _mpc.mpc_y[i];
-            tempPose.pose.orientation.w = 1.0;
-            _mpc_traj.poses.push_back(tempPose); 
-        }     
-        // publish the mpc trajectory
-        _pub_mpctraj.publish(_mpc_traj);
-
     }
     else
     {
-        _throttle = 0.0;
+        // _w and _throttle belong to the solver thread in async mode
+        if(_async_solve)
+            _solver_thread.Clear();
+        else
+        {
+            _throttle = 0.0;
+            _w = 0;
+        }
+        sinkCommand(NULL);
         _speed = 0.0;
-        _w = 0;
         _torqueR = 0.0;
         _torqueL = 0.0;
+        if(_wheel_loop)
+        {
+            WheelReference ref = { 0.0, 0.0, ros::Time::now().toSec() };
+            _wheel_ref.Set(ref);
+        }
         if(_goal_reached && _goal_received)
             cout << "Goal Reached: control loop !" << endl;
     }
@@ -589,24 +1070,32 @@ void MPCNode::controlLoopCB(const ros::TimerEvent&)
     {
         // _twist_msg.linear.x  = _speed; 
         // _twist_msg.angular.z = _w;
-        // _pub_twist.publish(_twist_msg);
+        // _pub_twist.publish(boost::make_shared<geometry_msgs::Twist>(_twist_msg));
 
-        _WR.data = _torqueR;
-        _WL.data = _torqueL;
-        _pub_RW.publish(_WR);
-        _pub_LW.publish(_WL);
+        // otherwise published by get_vel_rodas, or applied by the hardware loop
+        if((!_wheel_loop || _dynamic) && !_command_sink)
+        {
+            _WR.data = _torqueR;
+            _WL.data = _torqueL;
+            _pub_RW.publish(_WR);
+            _pub_LW.publish(_WL);
+        }
 
-        std_msgs::Float32 mpc_total_cost;
-        mpc_total_cost.data = static_cast<float>(_mpc._mpc_totalcost);
-        _pub_totalcost.publish(mpc_total_cost);
+        // Cost breakdown of the last solution (opt-in diagnostics)
+        if(_publish_cost)
+        {
+            std_msgs::Float32 mpc_total_cost;
+            mpc_total_cost.data = static_cast<float>(_mpc._mpc_totalcost);
+            _pub_totalcost.publish(mpc_total_cost);
 
-        std_msgs::Float32 mpc_cte_cost;
-        mpc_cte_cost.data = static_cast<float>(_mpc._mpc_ctecost);
-        _pub_ctecost.publish(mpc_cte_cost);
+            std_msgs::Float32 mpc_cte_cost;
+            mpc_cte_cost.data = static_cast<float>(_mpc._mpc_ctecost);
+            _pub_ctecost.publish(mpc_cte_cost);
 
-        std_msgs::Float32 mpc_etheta_cost;
-        mpc_etheta_cost.data = static_cast<float>(_mpc._mpc_ethetacost);
-        _pub_ethetacost.publish(mpc_etheta_cost);
+            std_msgs::Float32 mpc_etheta_cost;
+            mpc_etheta_cost.data = static_cast<float>(_mpc._mpc_ethetacost);
+            _pub_ethetacost.publish(mpc_etheta_cost);
+        }
 
         //cout << "_mpc_totalcost: "<< _mpc._mpc_totalcost << endl;
         //cout << "_mpc_ctecost: "<< _mpc._mpc_ctecost << endl;
@@ -615,14 +1104,13 @@ void MPCNode::controlLoopCB(const ros::TimerEvent&)
         //writefile
         idx++;
         cout << "idx: "<< idx << endl;
-        file << idx<< "," << _wr<< "," << _wl  <<   ",";
 
     }
     else
     {
         // _twist_msg.linear.x  = 0; 
         // _twist_msg.angular.z = 0;
-        // _pub_twist.publish(_twist_msg);
+        // _pub_twist.publish(boost::make_shared<geometry_msgs::Twist>(_twist_msg));
         _WR.data = 0.0;
         _WL.data = 0.0;
         _pub_RW.publish(_WR);
@@ -630,23 +1118,460 @@ void MPCNode::controlLoopCB(const ros::TimerEvent&)
     }
     
   
-    /*
-    file.open("/home/geonhee/catkin_ws/src/mpc_ros/write.csv");
-    string line;
-    while (getline(file, line,'\n')) 
-    {
-        istringstream templine(line); 
-        string data;
-        while (getline( templine, data,',')) 
+
+}
+
+
+// Service: write the trace spans to trace_path, see trace_span.h
+bool MPCNode::writeTraceCB(std_srvs::Trigger::Request &req, std_srvs::Trigger::Response &res)
+{
+    res.success = trace_span::WriteChrome(_trace_path);
+    res.message = res.success ? _trace_path : "cannot write " + _trace_path;
+    return true;
+}
+
+// Service: dump the flight recorder after the next cycle
+bool MPCNode::dumpFlightCB(std_srvs::Trigger::Request &req, std_srvs::Trigger::Response &res)
+{
+    _flight.Request();
+    res.success = true;
+    const std::string last = _flight.LastDump();
+    res.message = last.empty() ? "dump requested" : "dump requested, previous one " + last;
+    return true;
+}
+
+// Solve the MPC problem from the current state and fill the predicted command sequence
+bool MPCNode::solveControl(MPCCommand &cmd)
+{
+    MPC_TRACE_SPAN("solve_control");
+    const double stamp = ros::Time::now().toSec();
+    StageClock cycle;
+    // Deadline mode: the solve gets the controller period minus the rest of the cycle
+    const double deadline = _deadline_mode ? max(0.2 * _dt, _dt - _cycle_overhead) : 0.0;
+    _mpc.SetDeadline(deadline);
+    _mpc.SetNearGoal(_near_goal);
+    // The freshest reference of the prep thread, or prepared now
+    const ReferencePacket *ref = NULL;
+    if(_prep_thread)
+        ref = _reference_prep.Latest();
+    else if(prepareReference(_ref_packet))
+        ref = &_ref_packet;
+    if(!ref)
+        return false;
+
+    // Update system states: X=[x, y, theta, v]
+    const double px = ref->px; //pose: odom frame
+    const double py = ref->py;
+    const double theta = ref->theta;
+
+    // Still on the last prediction: follow its inputs without solving
+    if(_event_trigger.Enabled() && _event_trigger.Holds(stamp, px, py, theta))
+    {
+        cmd = _event_cmd;
+        double speed;
+        cmd.Sample(stamp, speed, _w);
+        return true;
+    }
+
+    const double v = ref->v; //twist: body fixed frame
+    const double angvel = ref->angvel; // measured turn rate, initial state of the torque model
+    // Update system inputs: U=[w, throttle]
+    const double w = _w; // steering -> w
+    //const double steering = _steering;  // radian
+    const double throttle = _throttle; // accel: >0; brake: <0
+    const double dt = _dt;
+    //const double Lf = _Lf;
+
+    // Solve MPC Problem
+    vector<double> mpc_results;
+    double solve_ms = 0.0;
+    TrajectoryRecord record; // state and coeffs stay zero with the arc length reference
+    if(_arc_reference)
+    {
+        cycle.Lap();
+        if(!solveArcReference(stamp, px, py, theta, v, w, throttle, angvel, mpc_results))
+        {
+            _event_trigger.Reset();
+            return false;
+        }
+        solve_ms = cycle.Lap();
+    }
+    else
+    {
+        // Waypoints fitted in the vehicle coordinate system
+        if(!ref->fitted)
+        {
+            _event_trigger.Reset();
+            return false;
+        }
+        const VectorXd &coeffs = ref->coeffs;
+
+        const double cte  = ref->cte;
+        const double etheta = ref->etheta;
+
+        _mpc_cte = cte;
+        _mpc_etheta = etheta;
+        _metrics.Metrics().ObserveTracking(cte, etheta);
+
+        VectorXd state(6);
+        if(_delay_mode)
+        {
+            // Kinematic model is used to predict vehicle state at the actual moment of control (current time + delay dt)
+            const double px_act = v * dt;
+            const double py_act = 0;
+            const double theta_act = w * dt; //(steering) theta_act = v * steering * dt / Lf;
+            const double v_act = v + throttle * dt; //v = v + a * dt
+        
+            const double cte_act = cte + v * sin(etheta) * dt;
+            const double etheta_act = etheta - theta_act;  
+        
+            state << px_act, py_act, theta_act, v_act, cte_act, etheta_act;
+        }
+        else
+        {
+            state << 0, 0, 0, v, cte, etheta;
+        }
+        if(_dynamic)
+        {
+            state.conservativeResize(7);
+            state[6] = angvel;
+        }
+        for(int i = 0; i < 6; i++)
+            record.state[i] = state[i];
+        for(int i = 0; i < 4 && i < coeffs.size(); i++)
+            record.coeffs[i] = coeffs[i];
+    
+        cycle.Lap();
+        mpc_results = _mpc.Solve(state, coeffs);
+        solve_ms = cycle.Lap();
+    }
+          
+    // MPC result (all described in car frame), output = (acceleration, w)        
+    _w = mpc_results[0]; // radian/sec, angular velocity
+    _throttle = mpc_results[1]; // acceleration
+
+    // Command sequence along the prediction, the first entry is applied now
+    cmd.stamp = stamp;
+    cmd.dt = dt;
+    double speed = v;
+    for(int i = 0; i < _mpc.mpc_angvel.size(); i++)
+    {
+        speed += _mpc.mpc_accel[i] * dt;  // speed
+        cmd.speed.push_back(max(0.0, min(speed, _max_speed)));
+        cmd.angvel.push_back(_mpc.mpc_angvel[i]);
+    }
+    cmd.torque_right = _mpc.mpc_torque_right;
+    cmd.torque_left = _mpc.mpc_torque_left;
+
+    record.stamp = stamp;
+    record.speed = cmd.speed.empty() ? 0.0 : cmd.speed[0];
+    record.angvel = cmd.angvel.empty() ? 0.0 : cmd.angvel[0];
+    record.solve_ms = solve_ms;
+    record.cost = _mpc._mpc_totalcost;
+    record.status = _mpc._mpc_status;
+    record.iterations = _mpc._mpc_iterations;
+    record.flags = (_mpc._mpc_fallback ? TrajectoryRecord::FALLBACK : 0)
+                   | (_mpc._mpc_slack > 1e-6 ? TrajectoryRecord::SOFT_BOUND : 0)
+                   | (_mpc._mpc_feasible ? 0 : TrajectoryRecord::INFEASIBLE);
+    _log.Push(record);
+
+    FlightFrame frame;
+    frame.record = record;
+    frame.params_version = _mpc._mpc_params_version;
+    frame.deadline_ms = 1000.0 * deadline;
+    frame.journal = _mpc._mpc_journal;
+    _flight.Record(frame);
+
+    // Controller health, lock-free
+    ControllerMetrics &metrics = _metrics.Metrics();
+    metrics.ObserveSolve(solve_ms, _mpc._mpc_iterations, _mpc._mpc_status);
+    metrics.SetMemory(_mpc.Memory());
+    if(deadline > 0 && solve_ms > 1000.0 * deadline)
+        metrics.CountDeadlineMiss();
+    if(_mpc._mpc_fallback)
+        metrics.CountFallback();
+    if(!_mpc._mpc_feasible)
+        metrics.CountInfeasible();
+
+    // Nothing of a solve that failed the model is applied
+    if(!_mpc._mpc_feasible)
+    {
+        _w = 0;
+        _throttle = 0;
+        _event_trigger.Reset();
+        return false;
+    }
+
+    // Prediction of a solved plan (not a shifted fallback) for the event
+    // trigger, the first pose is at the control moment in delay mode
+    if(_event_trigger.Enabled())
+    {
+        if(_mpc._mpc_fallback)
+            _event_trigger.Reset();
+        else
         {
-            cout << "data.c_str(): "<< data << endl;
-            matrix.push_back(atof(data.c_str()));  
+            _event_trigger.Store(stamp, px, py, theta, _mpc.mpc_x, _mpc.mpc_y, _mpc.mpc_theta,
+                                 _delay_mode ? dt : 0.0, cmd.dt, cmd.step_dt);
+            _event_cmd = cmd;
         }
     }
-    file.close();*/
 
+
+    // if(_debug_info)
+    if(1)
+    {
+        cout << "\n\nDEBUG" << endl;
+        // cout << "theta: " << theta << endl;
+        cout << "V: " << v << endl;
+        //cout << "odom_path: \n" << odom_path << endl;
+        //cout << "x_points: \n" << x_veh << endl;
+        //cout << "y_points: \n" << y_veh << endl;
+        // cout << "coeffs: \n" << coeffs << endl;
+        cout << "_w: " << _w << "rad/s \n" << endl;
+        cout << "_throttle: " << _throttle << " m/s² \n"  <<endl;
+        cout << "_speed: " << cmd.speed[0] << " m/s \n" << endl;
+    }
+
+    // Display the MPC predicted trajectory
+    if(_trajectory_path)
+    {
+        nav_msgs::PathPtr mpc_traj = boost::make_shared<nav_msgs::Path>();
+        mpc_traj->header.frame_id = _car_frame; // points in car coordinate        
+        mpc_traj->header.stamp = ros::Time::now();
+        for(int i=0; i<_mpc.mpc_x.size(); i++)
+        {
+            geometry_msgs::PoseStamped tempPose;
+            tempPose.header = mpc_traj->header;
+            tempPose.pose.position.x = _mpc.mpc_x[i];
+            tempPose.pose.position.y = _mpc.mpc_y[i];
+            tempPose.pose.orientation.w = 1.0;
+            mpc_traj->poses.push_back(tempPose); 
+        }     
+        // publish the mpc trajectory
+        _pub_mpctraj.publish(mpc_traj);
+    }
+
+    // Same prediction packed for low bandwidth consumers, see trajectory_publisher.h
+    if(_pub_compact_traj.Active())
+    {
+        mpc_ros::MPCTrajectory &traj = _pub_compact_traj.Fill(_car_frame, ros::Time::now(), _mpc.mpc_x, _mpc.mpc_y, _mpc.mpc_theta,
+                                                              _mpc.mpc_angvel, _mpc.mpc_accel, _mpc._mpc_dt, _mpc.mpc_step_dt);
+        traj.status = _mpc._mpc_status;
+        traj.iterations = _mpc._mpc_iterations;
+        traj.solve_ms = solve_ms;
+        traj.cost = _mpc._mpc_totalcost;
+        traj.feasible = _mpc._mpc_feasible;
+        traj.fallback = _mpc._mpc_fallback;
+        _pub_compact_traj.Publish();
+    }
+
+    // Overhead of this cycle besides the solve, for the next deadline budget
+    _cycle_overhead = 0.9 * _cycle_overhead + 0.1 * (cycle.Total() - solve_ms) / 1000.0;
+    _metrics.Metrics().ObserveCycle(cycle.Total());
+
+    return true;
 }
 
+
+// Sample one reference pose per MPC step along the arc length path, starting
+// at the progress of the robot, and solve against them. With the guide the
+// poses and the reference speed come from the newest coarse plan instead, and
+// the coarse problem of this state is handed to the guide thread.
+bool MPCNode::solveArcReference(double stamp, double px, double py, double theta, double v, double w, double throttle, double angvel, vector<double> &mpc_results)
+{
+    LatestMsg<ArcPath>::ConstPtr arc_path = _arc_path.Get();
+    if(!arc_path || arc_path->Empty())
+        return false;
+    if(arc_path != _arc_last)
+    {
+        // The segment hint of the previous path means nothing for a new one
+        _arc_last = arc_path;
+        _arc_hint = -1;
+    }
+
+    const double dt = _dt;
+    const int steps = _mpc_steps;
+
+    // Initial state, predicted to the actual moment of control in delay mode
+    double x0 = 0, y0 = 0, theta0 = 0, v0 = v, t0 = stamp;
+    double progress = arc_path->Project(px, py, _arc_hint);
+    if(_delay_mode)
+    {
+        x0 = v * dt;
+        theta0 = w * dt;
+        v0 = v + throttle * dt;
+        progress += v * dt;
+        t0 += dt;
+    }
+
+    VectorXd ref(3 * steps);
+    const GuidePlan *plan = _guide_on ? _guide.Latest() : NULL;
+    double speed = _ref_vel;
+    if(!plan || t0 - plan->stamp > _guide_max_age || !guidePoses(*plan, t0, px, py, theta, theta0, steps, dt, ref, speed))
+    {
+        arcPoses(*arc_path, progress, _arc_hint, px, py, theta, theta0, steps, dt, ref);
+        speed = _ref_vel;
+    }
+    if(_guide_on)
+        setReferenceSpeed(speed);
+
+    // Errors against the first reference pose, as in the model constraints
+    const double cte = (ref[steps] - y0) * cos(ref[2 * steps]) - (ref[0] - x0) * sin(ref[2 * steps]);
+    const double etheta = theta0 - ref[2 * steps];
+    _mpc_cte = cte;
+    _mpc_etheta = etheta;
+
+    VectorXd state(6);
+    state << x0, y0, theta0, v0, cte, etheta;
+    if(_dynamic)
+    {
+        state.conservativeResize(7);
+        state[6] = angvel;
+    }
+
+    if(_guide_on)
+    {
+        // The coarse problem always follows the path, not the last plan
+        GuideRequest &request = _guide.Back();
+        request.stamp = t0;
+        request.px = px;
+        request.py = py;
+        request.theta = theta;
+        request.ref.resize(3 * _guide_steps);
+        arcPoses(*arc_path, progress, _arc_hint, px, py, theta, theta0, _guide_steps, _guide_dt, request.ref);
+        request.state = state;
+        const int n = _guide_steps;
+        request.state[4] = (request.ref[n] - y0) * cos(request.ref[2 * n]) - (request.ref[0] - x0) * sin(request.ref[2 * n]);
+        request.state[5] = theta0 - request.ref[2 * n];
+        _guide.Request();
+    }
+
+    mpc_results = _mpc.SolveReference(state, ref);
+    return true;
+}
+
+// Reference poses in the vehicle frame of px, py, theta, one per step of dt
+// from progress and spaced by the reference speed. Headings are unwrapped
+// along the horizon from theta0 so etheta stays continuous.
+void MPCNode::arcPoses(const ArcPath &path, double progress, int hint, double px, double py, double theta, double theta0, int steps, double dt, VectorXd &ref) const
+{
+    const double costheta = cos(theta);
+    const double sintheta = sin(theta);
+    double ref_theta = theta0;
+    for(int i = 0; i < steps; i++)
+    {
+        double xr, yr, thetar;
+        path.Sample(progress + i * dt * _ref_vel, hint, xr, yr, thetar);
+        const double dx = xr - px;
+        const double dy = yr - py;
+        ref[i] = dx * costheta + dy * sintheta;
+        ref[steps + i] = dy * costheta - dx * sintheta;
+        const double dtheta = thetar - theta - ref_theta;
+        ref_theta += atan2(sin(dtheta), cos(dtheta));
+        ref[2 * steps + i] = ref_theta;
+    }
+}
+
+// The same poses sampled in time from the coarse plan, and its speed halfway
+// along the horizon. False if the plan does not cover the horizon.
+bool MPCNode::guidePoses(const GuidePlan &plan, double t0, double px, double py, double theta, double theta0, int steps, double dt, VectorXd &ref, double &speed) const
+{
+    double xr, yr, thetar, vr;
+    if(!plan.Sample(t0 + (steps - 1) * dt, xr, yr, thetar, vr) || !plan.Sample(t0 + 0.5 * (steps - 1) * dt, xr, yr, thetar, speed))
+        return false;
+    const double costheta = cos(theta);
+    const double sintheta = sin(theta);
+    double ref_theta = theta0;
+    for(int i = 0; i < steps; i++)
+    {
+        plan.Sample(t0 + i * dt, xr, yr, thetar, vr);
+        const double dx = xr - px;
+        const double dy = yr - py;
+        ref[i] = dx * costheta + dy * sintheta;
+        ref[steps + i] = dy * costheta - dx * sintheta;
+        const double dtheta = thetar - theta - ref_theta;
+        ref_theta += atan2(sin(dtheta), cos(dtheta));
+        ref[2 * steps + i] = ref_theta;
+    }
+    return true;
+}
+
+// REF_V of the tracker, in steps of _guide_speed_step: a new value reloads
+// the parameters and records the tape again, so it changes only when the
+// coarse plan really slows down or speeds up
+void MPCNode::setReferenceSpeed(double speed)
+{
+    if(_guide_speed_step > 0.0)
+        speed = _guide_speed_step * floor(speed / _guide_speed_step + 0.5);
+    speed = max(0.0, min(speed, _ref_vel));
+    if(speed == _mpc_params["REF_V"])
+        return;
+    _mpc_params["REF_V"] = speed;
+    _mpc.LoadParams(_mpc_params);
+}
+
+// Reference of the next solve from the newest odometry and path, on the prep
+// thread or at the start of solveControl. False before both arrived. The
+// arc length reference is solved from the pose only, nothing is fitted.
+bool MPCNode::prepareReference(ReferencePacket &ref)
+{
+    nav_msgs::Odometry::ConstPtr odom_msg = _odom.Get();
+    CompactPath::ConstPtr odom_path_msg = _odom_path.Get();
+    // The estimate predicted to this moment, no odometry message is older
+    const double now = ros::Time::now().toSec();
+    const bool estimated = _estimator_on && _estimator.Predict(now, ref.px, ref.py, ref.theta, ref.v, ref.angvel);
+    if((!odom_msg && !estimated) || !odom_path_msg)
+        return false;
+
+    if(estimated)
+        ref.stamp = now;
+    else
+    {
+        const nav_msgs::Odometry &odom = *odom_msg;
+        ref.stamp = odom.header.stamp.toSec();
+        ref.px = odom.pose.pose.position.x; //pose: odom frame
+        ref.py = odom.pose.pose.position.y;
+        tf::Pose pose;
+        tf::poseMsgToTF(odom.pose.pose, pose);
+        ref.theta = tf::getYaw(pose.getRotation());
+        ref.v = odom.twist.twist.linear.x; //twist: body fixed frame
+        ref.angvel = odom.twist.twist.angular.z;
+    }
+
+    // Fit waypoints in the vehicle coordinate system
+    ref.fitted = !_arc_reference && _path_fit.Fit(*odom_path_msg, ref.px, ref.py, ref.theta);
+    if(!ref.fitted)
+        return true;
+    ref.coeffs = _path_fit.Coeffs();
+    ref.cte = _path_fit.Eval(0.0);
+    ref.etheta = atan(ref.coeffs[1]);
+    return true;
+}
+
+#if defined(MPC_NODELET)
+#include <pluginlib/class_list_macros.h>
+#include "controller_nodelet.h"
+
+namespace mpc_ros
+{
+    class TrackRefTrajNodelet : public ControllerNodelet<MPCNode> {};
+}
+PLUGINLIB_EXPORT_CLASS(mpc_ros::TrackRefTrajNodelet, nodelet::Nodelet)
+
+#elif defined(MPC_HARDWARE_CONTROLLER)
+#include <pluginlib/class_list_macros.h>
+#include "hardware_controller.h"
+
+namespace mpc_ros
+{
+    class TrackRefTrajEffortController : public HardwareController<MPCNode, hardware_interface::EffortJointInterface> {};
+    class TrackRefTrajVelocityController : public HardwareController<MPCNode, hardware_interface::VelocityJointInterface> {};
+}
+PLUGINLIB_EXPORT_CLASS(mpc_ros::TrackRefTrajEffortController, controller_interface::ControllerBase)
+PLUGINLIB_EXPORT_CLASS(mpc_ros::TrackRefTrajVelocityController, controller_interface::ControllerBase)
+
+#else
+
 /*****************/
 /* MAIN FUNCTION */
 /*****************/
@@ -662,3 +1587,4 @@ int main(int argc, char **argv)
     ros::waitForShutdown();
     return 0;
 }
+#endif /* MPC_NODELET, MPC_HARDWARE_CONTROLLER */
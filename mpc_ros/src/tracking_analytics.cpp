@@ -0,0 +1,105 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "tracking_analytics.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+TrackingAnalytics::TrackingAnalytics(int window)
+    : _window(window), _cte_window(window), _etheta_window(window)
+{
+    Reset();
+}
+
+void TrackingAnalytics::SetPath(const CompactPath::ConstPtr &path)
+{
+    // PathIndex keeps the progress over republications and trimmed paths
+    if (path != _index.Path())
+        _index.Set(path);
+}
+
+void TrackingAnalytics::Reset()
+{
+    _samples = 0;
+    _cte_sum = _cte_max = 0.0;
+    _etheta_sum = _etheta_max = 0.0;
+    _cte_window = RollingStats(_window);
+    _etheta_window = RollingStats(_window);
+}
+
+bool TrackingAnalytics::project(size_t i, double x, double y, double &d2, double &fx, double &fy, double &yaw) const
+{
+    const CompactPath &path = *_index.Path();
+    const double ax = path.X(i), ay = path.Y(i);
+    const double dx = path.X(i + 1) - ax, dy = path.Y(i + 1) - ay;
+    const double len2 = dx * dx + dy * dy;
+    if (len2 <= 1e-12)
+        return false; // repeated pose
+    const double t = std::min(std::max(((x - ax) * dx + (y - ay) * dy) / len2, 0.0), 1.0);
+    fx = ax + t * dx;
+    fy = ay + t * dy;
+    d2 = (x - fx) * (x - fx) + (y - fy) * (y - fy);
+    yaw = std::atan2(dy, dx);
+    return true;
+}
+
+bool TrackingAnalytics::Observe(double x, double y, double theta, double &cte, double &etheta)
+{
+    const CompactPath::ConstPtr &path = _index.Path();
+    if (!path || path->Size() < 2)
+        return false;
+
+    // The nearest pose ends one segment and starts the next, the foot
+    // point is on the closer of the two
+    const size_t k = _index.Nearest(x, y);
+    double best = -1.0, fx = path->X(k), fy = path->Y(k), yaw = path->Yaw(k);
+    for (size_t i = (k > 0 ? k - 1 : 0); i <= k && i + 1 < path->Size(); i++)
+    {
+        double d2, px, py, pyaw;
+        if (project(i, x, y, d2, px, py, pyaw) && (best < 0.0 || d2 < best))
+        {
+            best = d2;
+            fx = px;
+            fy = py;
+            yaw = pyaw;
+        }
+    }
+
+    // Foot point in the vehicle frame, as the polynomial fit evaluated it
+    const double c = std::cos(theta), s = std::sin(theta);
+    cte = -s * (fx - x) + c * (fy - y);
+    etheta = std::atan2(std::sin(yaw - theta), std::cos(yaw - theta));
+
+    const double acte = std::fabs(cte), aetheta = std::fabs(etheta);
+    _samples++;
+    _cte_sum += acte;
+    _etheta_sum += aetheta;
+    _cte_max = std::max(_cte_max, acte);
+    _etheta_max = std::max(_etheta_max, aetheta);
+    _cte_window.Add(acte);
+    _etheta_window.Add(aetheta);
+    return true;
+}
+
+std::string TrackingAnalytics::Summary() const
+{
+    char buf[160];
+    std::snprintf(buf, sizeof(buf), "n %zu cte %.3f %.3f %.3f m etheta %.3f %.3f %.3f rad", _samples,
+                  CteMean(), _cte_window.Percentile(0.95), _cte_max,
+                  EthetaMean(), _etheta_window.Percentile(0.95), _etheta_max);
+    return buf;
+}
@@ -0,0 +1,223 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "tracking_controller.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    double param(const std::map<std::string, double> &params, const std::string &key, double value)
+    {
+        std::map<std::string, double>::const_iterator it = params.find(key);
+        return it != params.end() ? it->second : value;
+    }
+
+    const char *NAMES[TrackingController::NUM_TYPES] = {"mpc", "pure_pursuit", "dwa"};
+}
+
+std::unique_ptr<TrackingController> TrackingController::Create(int type, const std::map<std::string, double> &params)
+{
+    switch (type)
+    {
+    case MPC_TRACKING:
+        return std::unique_ptr<TrackingController>(new MPCTrackingController(params));
+    case PURE_PURSUIT:
+        return std::unique_ptr<TrackingController>(new PurePursuitController(params));
+    case DWA:
+        return std::unique_ptr<TrackingController>(new DWAController(params));
+    default:
+        return std::unique_ptr<TrackingController>();
+    }
+}
+
+const char *TrackingController::Name(int type)
+{
+    return type >= 0 && type < NUM_TYPES ? NAMES[type] : "unknown";
+}
+
+int TrackingController::Parse(const std::string &name)
+{
+    for (int i = 0; i < NUM_TYPES; i++)
+    {
+        if (name == NAMES[i])
+            return i;
+    }
+    return -1;
+}
+
+MPCTrackingController::MPCTrackingController(const std::map<std::string, double> &params)
+    : _angvel(0.0), _accel(0.0)
+{
+    _mpc.LoadParams(params);
+    _dt = param(params, "DT", 0.1);
+    _path_length = param(params, "PATH_LENGTH", 2.0);
+    _delay_mode = param(params, "DELAY_MODE", 1.0) != 0.0;
+    _max_speed = param(params, "MAX_SPEED", param(params, "REF_V", 1.0));
+}
+
+void MPCTrackingController::Reset()
+{
+    _mpc.ResetWarmStart();
+    _angvel = _accel = 0.0;
+}
+
+bool MPCTrackingController::Command(const CompactPath &window, double x, double y, double theta, double v,
+                                    double &speed, double &angvel)
+{
+    // As in MPCNode::solveControl
+    if (!_path_fit.Fit(window, x, y, theta))
+        return false;
+    const Eigen::VectorXd &coeffs = _path_fit.Coeffs();
+    const double cte = _path_fit.Eval(0.0);
+    const double etheta = std::atan(coeffs[1]);
+    Eigen::VectorXd state(6);
+    if (_delay_mode)
+    {
+        const double theta_act = _angvel * _dt;
+        state << v * _dt, 0, theta_act, v + _accel * _dt, cte + v * std::sin(etheta) * _dt, etheta - theta_act;
+    }
+    else
+        state << 0, 0, 0, v, cte, etheta;
+
+    const std::vector<double> inputs = _mpc.Solve(state, coeffs);
+    _angvel = inputs[0];
+    _accel = inputs[1];
+    speed = std::max(0.0, std::min(v + _accel * _dt, _max_speed));
+    angvel = _angvel;
+    return true;
+}
+
+PurePursuitController::PurePursuitController(const std::map<std::string, double> &params)
+    : _velocity(0.0)
+{
+    _path_length = param(params, "PATH_LENGTH", 2.0);
+    _lfw = param(params, "PP_LFW", 0.5);
+    _vcmd = param(params, "REF_V", 1.0);
+    _gain = param(params, "PP_GAIN", 1.0);
+    _max_w = param(params, "PP_MAX_W", param(params, "ANGVEL", 3.0));
+    _speed_inc = param(params, "PP_SPEED_INC", 0.2);
+}
+
+bool PurePursuitController::Command(const CompactPath &window, double x, double y, double theta, double,
+                                    double &speed, double &angvel)
+{
+    if (window.Empty())
+        return false;
+    // First waypoint ahead of the car at least Lfw away, the last one
+    // when there is none (PurePursuit::get_alpha)
+    const double c = std::cos(theta), s = std::sin(theta);
+    size_t target = window.Size() - 1;
+    for (size_t i = 0; i < window.Size(); i++)
+    {
+        const double dx = window.X(i) - x, dy = window.Y(i) - y;
+        if (dx * c + dy * s > 0.0 && dx * dx + dy * dy >= _lfw * _lfw)
+        {
+            target = i;
+            break;
+        }
+    }
+    const double alpha = std::atan2(window.Y(target) - y, window.X(target) - x) - theta;
+    angvel = std::max(-_max_w, std::min(2.0 * std::sin(alpha) / _lfw * _gain, _max_w));
+    _velocity = std::min(_velocity + _speed_inc, _vcmd);
+    speed = _velocity;
+    return true;
+}
+
+DWAController::DWAController(const std::map<std::string, double> &params)
+    : _angvel(0.0)
+{
+    _dt = param(params, "DT", 0.1);
+    _path_length = param(params, "PATH_LENGTH", 2.0);
+    _min_vel = param(params, "DWA_MIN_VEL", 0.0);
+    _max_vel = param(params, "DWA_MAX_VEL", param(params, "REF_V", 1.0));
+    _max_rot = param(params, "DWA_MAX_ROT", 1.5);
+    _acc_x = param(params, "DWA_ACC_X", 2.0);
+    _acc_theta = param(params, "DWA_ACC_THETA", 3.0);
+    _sim_time = param(params, "DWA_SIM_TIME", 4.0);
+    _sim_granularity = param(params, "DWA_SIM_GRANULARITY", 0.025);
+    _angular_granularity = param(params, "DWA_ANGULAR_GRANULARITY", 0.1);
+    _vx_samples = std::max(1, (int)param(params, "DWA_VX_SAMPLES", 20));
+    _vth_samples = std::max(1, (int)param(params, "DWA_VTH_SAMPLES", 20));
+    _path_bias = param(params, "DWA_PATH_BIAS", 32.0);
+    _goal_bias = param(params, "DWA_GOAL_BIAS", 20.0);
+    _forward_point = param(params, "DWA_FORWARD_POINT", 0.325);
+}
+
+double DWAController::PathLength() const
+{
+    // The plan has to reach past the rollouts, the local costmap does
+    return std::max(_path_length, _max_vel * _sim_time + _forward_point);
+}
+
+double DWAController::pathDistance(const CompactPath &window, double x, double y)
+{
+    double best = 1e300;
+    for (size_t i = 0; i < window.Size(); i++)
+    {
+        const double dx = window.X(i) - x, dy = window.Y(i) - y;
+        best = std::min(best, dx * dx + dy * dy);
+    }
+    return std::sqrt(best);
+}
+
+bool DWAController::Command(const CompactPath &window, double x, double y, double theta, double v,
+                            double &speed, double &angvel)
+{
+    if (window.Empty())
+        return false;
+    const double gx = window.X(window.Size() - 1), gy = window.Y(window.Size() - 1);
+
+    // Velocities reachable within one control period
+    const double v_lo = std::max(_min_vel, v - _acc_x * _dt), v_hi = std::min(_max_vel, v + _acc_x * _dt);
+    const double w_lo = std::max(-_max_rot, _angvel - _acc_theta * _dt);
+    const double w_hi = std::min(_max_rot, _angvel + _acc_theta * _dt);
+    double best_cost = 1e300;
+    bool found = false;
+    for (int i = 0; i < _vx_samples; i++)
+    {
+        const double vs = _vx_samples > 1 ? v_lo + (v_hi - v_lo) * i / (_vx_samples - 1) : v_hi;
+        for (int j = 0; j < _vth_samples; j++)
+        {
+            const double ws = _vth_samples > 1 ? w_lo + (w_hi - w_lo) * j / (_vth_samples - 1) : 0.0;
+            // Rollout at the granularity of the simulator of
+            // base_local_planner, its points are where the costmap is read
+            const int steps = std::max(1, (int)std::ceil(std::max(std::fabs(vs) * _sim_time / _sim_granularity,
+                                                                  std::fabs(ws) * _sim_time / _angular_granularity)));
+            const double h = _sim_time / steps;
+            double px = x, py = y, pt = theta;
+            for (int k = 0; k < steps; k++)
+            {
+                px += vs * std::cos(pt) * h;
+                py += vs * std::sin(pt) * h;
+                pt += ws * h;
+            }
+            const double fx = px + _forward_point * std::cos(pt), fy = py + _forward_point * std::sin(pt);
+            const double cost = _path_bias * (pathDistance(window, px, py) + pathDistance(window, fx, fy)) +
+                                _goal_bias * (std::hypot(gx - px, gy - py) + std::hypot(gx - fx, gy - fy));
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                speed = vs;
+                angvel = ws;
+                found = true;
+            }
+        }
+    }
+    if (found)
+        _angvel = angvel;
+    return found;
+}
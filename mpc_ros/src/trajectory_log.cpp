@@ -0,0 +1,214 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "trajectory_log.h"
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t record_size;
+    };
+
+    const char MAGIC[8] = "MPCTRAJ";
+
+    // Records moved from the ring to the file per fwrite
+    const size_t BATCH = 256;
+}
+
+TrajectoryRecord::TrajectoryRecord()
+{
+    stamp = 0;
+    for (int i = 0; i < 6; i++)
+        state[i] = 0;
+    for (int i = 0; i < 4; i++)
+        coeffs[i] = 0;
+    speed = 0;
+    angvel = 0;
+    solve_ms = 0;
+    cost = 0;
+    seq = 0;
+    status = -1;
+    iterations = -1;
+    flags = 0;
+}
+
+TrajectoryLog::TrajectoryLog()
+{
+    _max_bytes = 0;
+    _bytes = 0;
+    _max_files = 0;
+    _flush_period = 0.1;
+    _file = NULL;
+    _seq = 0;
+    _running.store(false);
+    _dropped.store(0);
+}
+
+TrajectoryLog::~TrajectoryLog()
+{
+    Close();
+}
+
+bool TrajectoryLog::Open(const std::string &path, size_t max_bytes, int max_files,
+                         size_t capacity, double flush_period)
+{
+    Close();
+    _path = path;
+    _max_bytes = max_bytes;
+    _max_files = max_files;
+    _flush_period = flush_period;
+    if (!openFile())
+        return false;
+
+    _ring.reset(new SpscRing<TrajectoryRecord>(capacity));
+    _seq = 0;
+    _dropped.store(0);
+    _running.store(true);
+    _writer = std::thread(&TrajectoryLog::run, this);
+    return true;
+}
+
+void TrajectoryLog::Close()
+{
+    if (_running.exchange(false))
+        _writer.join();
+    if (_file)
+    {
+        std::fclose(_file);
+        _file = NULL;
+    }
+}
+
+bool TrajectoryLog::Push(const TrajectoryRecord &record)
+{
+    if (!_running.load(std::memory_order_relaxed))
+        return false;
+    TrajectoryRecord numbered(record);
+    numbered.seq = _seq++;
+    if (_ring->Push(numbered))
+        return true;
+    _dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+bool TrajectoryLog::openFile()
+{
+    _file = std::fopen(_path.c_str(), "wb");
+    if (!_file)
+        return false;
+    FileHeader header;
+    std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.record_size = sizeof(TrajectoryRecord);
+    std::fwrite(&header, sizeof(header), 1, _file);
+    _bytes = sizeof(header);
+    return true;
+}
+
+void TrajectoryLog::rotate()
+{
+    std::fclose(_file);
+    _file = NULL;
+    for (int i = _max_files; i >= 1; i--)
+    {
+        std::ostringstream from, to;
+        to << _path << "." << i;
+        if (i > 1)
+            from << _path << "." << i - 1;
+        else
+            from << _path;
+        if (i == _max_files)
+            std::remove(to.str().c_str());
+        std::rename(from.str().c_str(), to.str().c_str());
+    }
+    if (_max_files < 1)
+        std::remove(_path.c_str());
+    openFile();
+}
+
+void TrajectoryLog::run()
+{
+    std::vector<TrajectoryRecord> batch(BATCH);
+    const std::chrono::duration<double> period(_flush_period);
+    bool running = true;
+    while (running)
+    {
+        // Read the flag before draining, so the last pass after Close()
+        // picks up everything pushed until then
+        running = _running.load();
+        size_t n;
+        do
+        {
+            n = 0;
+            while (n < BATCH && _ring->Pop(batch[n]))
+                n++;
+            if (n > 0 && _file)
+            {
+                std::fwrite(batch.data(), sizeof(TrajectoryRecord), n, _file);
+                _bytes += n * sizeof(TrajectoryRecord);
+                if (_max_bytes > 0 && _bytes >= _max_bytes)
+                    rotate();
+            }
+        } while (n == BATCH);
+        if (_file)
+            std::fflush(_file);
+        if (running)
+            std::this_thread::sleep_for(period);
+    }
+}
+
+bool TrajectoryLog::Read(const std::string &path, std::vector<TrajectoryRecord> &records)
+{
+    records.clear();
+    FILE *file = std::fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+    FileHeader header;
+    const bool valid = std::fread(&header, sizeof(header), 1, file) == 1
+                       && std::memcmp(header.magic, MAGIC, sizeof(header.magic)) == 0
+                       && header.version == VERSION
+                       && header.record_size == sizeof(TrajectoryRecord);
+    if (valid)
+    {
+        TrajectoryRecord record;
+        while (std::fread(&record, sizeof(record), 1, file) == 1)
+            records.push_back(record);
+    }
+    std::fclose(file);
+    return valid;
+}
+
+bool TrajectoryLog::Write(const std::string &path, const std::vector<TrajectoryRecord> &records)
+{
+    FILE *file = std::fopen(path.c_str(), "wb");
+    if (!file)
+        return false;
+    FileHeader header;
+    std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.record_size = sizeof(TrajectoryRecord);
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    if (ok && !records.empty())
+        ok = std::fwrite(records.data(), sizeof(TrajectoryRecord), records.size(), file) == records.size();
+    return std::fclose(file) == 0 && ok;
+}
@@ -0,0 +1,69 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "trajectory_publisher.h"
+#include <algorithm>
+#include <cmath>
+
+void TrajectoryPublisher::Advertise(ros::NodeHandle &nh, const std::string &topic)
+{
+    _pub = nh.advertise<mpc_ros::MPCTrajectory>(topic, 1);
+}
+
+bool TrajectoryPublisher::Active() const
+{
+    return _pub && _pub.getNumSubscribers() > 0;
+}
+
+mpc_ros::MPCTrajectory &TrajectoryPublisher::Fill(const std::string &frame, const ros::Time &stamp,
+                                                  const std::vector<double> &x, const std::vector<double> &y,
+                                                  const std::vector<double> &theta, const std::vector<double> &angvel,
+                                                  const std::vector<double> &accel, double dt,
+                                                  const std::vector<double> &step_dt)
+{
+    const size_t stride = mpc_ros::MPCTrajectory::STRIDE;
+    const size_t n = std::min(x.size(), std::min(y.size(), theta.size()));
+    _msg.header.frame_id = frame;
+    _msg.header.stamp = stamp;
+    _msg.dt = dt;
+    _msg.step_dt.assign(step_dt.begin(), step_dt.end());
+    _msg.states.resize(n * stride);
+
+    float v = 0.0f;
+    for (size_t i = 0; i < n; i++)
+    {
+        float *s = &_msg.states[i * stride];
+        if (i + 1 < n)
+        {
+            // Speed along the heading, the same for every model
+            const double h = i < step_dt.size() ? step_dt[i] : dt;
+            if (h > 0.0)
+                v = (float)(((x[i + 1] - x[i]) * std::cos(theta[i]) + (y[i + 1] - y[i]) * std::sin(theta[i])) / h);
+        }
+        s[0] = x[i];
+        s[1] = y[i];
+        s[2] = theta[i];
+        s[3] = v;
+        s[4] = i < angvel.size() ? angvel[i] : 0.0;
+        s[5] = i < accel.size() ? accel[i] : 0.0;
+    }
+    return _msg;
+}
+
+void TrajectoryPublisher::Publish()
+{
+    _pub.publish(_msg);
+}
@@ -0,0 +1,185 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "transform_cache.h"
+#include <diagnostic_msgs/DiagnosticArray.h>
+#include <tf2_geometry_msgs/tf2_geometry_msgs.h>
+#include <sstream>
+
+TransformCache::TransformCache(double max_age) : _max_age(max_age), _metrics(nullptr)
+{
+}
+
+void TransformCache::SetMaxAge(double max_age)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _max_age = ros::Duration(max_age > 0.0 ? max_age : 0.0);
+}
+
+void TransformCache::SetMetrics(ControllerMetrics *metrics)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _metrics = metrics;
+}
+
+void TransformCache::AdvertiseDiagnostics(ros::NodeHandle &nh, const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pub_diag = nh.advertise<diagnostic_msgs::DiagnosticArray>("/diagnostics", 1);
+    _name = name;
+}
+
+bool TransformCache::Lookup(const tf::TransformListener &tf, const std::string &target, const std::string &source, tf::Transform &transform)
+{
+    geometry_msgs::Transform msg;
+    std::string error;
+    bool ok = false;
+    try
+    {
+        tf::StampedTransform stamped;
+        tf.lookupTransform(target, source, ros::Time(0), stamped);
+        tf::transformTFToMsg(stamped, msg);
+        ok = true;
+    }
+    catch(tf::TransformException &ex)
+    {
+        error = ex.what();
+    }
+    if (!Update(target, source, ok, error, msg))
+        return false;
+    tf::transformMsgToTF(msg, transform);
+    return true;
+}
+
+bool TransformCache::Lookup(const tf2_ros::Buffer &tf, const std::string &target, const std::string &source, tf2::Transform &transform)
+{
+    geometry_msgs::Transform msg;
+    std::string error;
+    bool ok = false;
+    try
+    {
+        msg = tf.lookupTransform(target, source, ros::Time(0)).transform;
+        ok = true;
+    }
+    catch(tf2::TransformException &ex)
+    {
+        error = ex.what();
+    }
+    if (!Update(target, source, ok, error, msg))
+        return false;
+    tf2::fromMsg(msg, transform);
+    return true;
+}
+
+TransformCache::State TransformCache::GetState(const std::string &target, const std::string &source) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::map<std::string, Entry>::const_iterator it = _entries.find(target + " <- " + source);
+    return it == _entries.end() ? LOST : it->second.state;
+}
+
+void TransformCache::Apply(const tf::Transform &transform, const geometry_msgs::PoseStamped &in,
+                           const std::string &frame, geometry_msgs::PoseStamped &out)
+{
+    tf::Pose pose;
+    tf::poseMsgToTF(in.pose, pose);
+    tf::poseTFToMsg(transform * pose, out.pose);
+    out.header.stamp = in.header.stamp;
+    out.header.frame_id = frame;
+}
+
+bool TransformCache::Update(const std::string &target, const std::string &source, bool ok,
+                            const std::string &error, geometry_msgs::Transform &msg)
+{
+    const ros::Time now = ros::Time::now();
+    const std::string key = target + " <- " + source;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    Entry &entry = _entries[key];
+    const State previous = entry.state;
+    if (ok)
+    {
+        entry.last = msg;
+        entry.stamp = now;
+        entry.valid = true;
+        entry.state = FRESH;
+    }
+    else if (entry.valid && now - entry.stamp <= _max_age)
+    {
+        msg = entry.last;
+        entry.state = STALE;
+        if (_metrics != nullptr)
+            _metrics->CountTfStale();
+    }
+    else
+    {
+        entry.state = LOST;
+    }
+
+    if (entry.state != previous)
+    {
+        if (entry.state == FRESH)
+            ROS_INFO("Transform %s is back", key.c_str());
+        else if (entry.state == STALE)
+            ROS_WARN("Transform %s unavailable, reusing the last one: %s", key.c_str(), error.c_str());
+        else
+            ROS_ERROR("Transform %s lost: %s", key.c_str(), error.c_str());
+    }
+    if (entry.state != previous || (entry.state != FRESH && now - entry.reported >= ros::Duration(1.0)))
+        Report(key, entry, now, error);
+
+    return entry.state != LOST;
+}
+
+void TransformCache::Report(const std::string &key, Entry &entry, const ros::Time &now, const std::string &error)
+{
+    entry.reported = now;
+    if (!_pub_diag)
+        return;
+
+    diagnostic_msgs::DiagnosticStatus status;
+    status.name = _name + ": " + key;
+    if (entry.state == FRESH)
+    {
+        status.level = diagnostic_msgs::DiagnosticStatus::OK;
+        status.message = "transform available";
+    }
+    else if (entry.state == STALE)
+    {
+        status.level = diagnostic_msgs::DiagnosticStatus::WARN;
+        status.message = "reusing the last transform: " + error;
+    }
+    else
+    {
+        status.level = diagnostic_msgs::DiagnosticStatus::ERROR;
+        status.message = "no transform: " + error;
+    }
+    diagnostic_msgs::KeyValue age;
+    age.key = "age";
+    std::ostringstream value;
+    if (entry.valid)
+        value << (now - entry.stamp).toSec();
+    else
+        value << "never";
+    age.value = value.str();
+    status.values.push_back(age);
+
+    diagnostic_msgs::DiagnosticArray array;
+    array.header.stamp = now;
+    array.status.push_back(status);
+    _pub_diag.publish(array);
+}
@@ -0,0 +1,280 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "vehicle_mpc.h"
+#include "tape_solver.h"
+#include "linear_solver.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+std::unique_ptr<VehicleSolver> VehicleSolver::Create(int model)
+{
+    switch (model)
+    {
+        case vehicle_model::DIFF_DRIVE: return std::unique_ptr<VehicleSolver>(new VehicleMPC<vehicle_model::DiffDrive>());
+        case vehicle_model::BICYCLE: return std::unique_ptr<VehicleSolver>(new VehicleMPC<vehicle_model::KinematicBicycle>());
+        case vehicle_model::HOLONOMIC: return std::unique_ptr<VehicleSolver>(new VehicleMPC<vehicle_model::Holonomic>());
+        default: return std::unique_ptr<VehicleSolver>();
+    }
+}
+
+// cte and etheta of the state x against the polynomial c of n entries
+template <class Model, class Scalar>
+static void pathErrors(const Model &model, const Scalar *x, const Scalar *c, size_t n, Scalar &cte, Scalar &etheta)
+{
+    // Horner for f and f' together
+    const Scalar &px = x[Model::X];
+    Scalar f = c[n - 1], df = 0.0;
+    for (size_t j = n - 1; j-- > 0;)
+    {
+        df = df * px + f;
+        f = f * px + c[j];
+    }
+    cte = f - x[Model::Y];
+    etheta = model.Heading(x) - CppAD::atan(df);
+}
+
+template <class Model>
+VehicleMPC<Model>::VehicleMPC()
+{
+    // Defaults of FG_eval
+    _steps = 20;
+    _dt = 0.1;
+    _ref_cte = 0;
+    _ref_etheta = 0;
+    _ref_vel = 0.5;
+    _w_cte = 100;
+    _w_etheta = 100;
+    _w_vel = 1;
+    _w_angvel = 100;
+    _w_accel = 50;
+    _w_angvel_d = 0;
+    _w_accel_d = 0;
+    _bound = 1.0e3;
+    _stale = true;
+    LoadParams(std::map<std::string, double>());
+}
+
+template <class Model>
+VehicleMPC<Model>::~VehicleMPC() {}
+
+template <class Model>
+void VehicleMPC<Model>::LoadParams(const std::map<std::string, double> &params)
+{
+    using vehicle_model::Param;
+    _params = params;
+    const int steps = std::max(2, (int)Param(params, "STEPS", _steps));
+    if (steps != _steps)
+    {
+        _inputs.clear();
+    }
+    _steps = steps;
+    _dt = Param(params, "DT", _dt);
+    _ref_cte = Param(params, "REF_CTE", _ref_cte);
+    _ref_etheta = Param(params, "REF_ETHETA", _ref_etheta);
+    _ref_vel = Param(params, "REF_V", _ref_vel);
+    _w_cte = Param(params, "W_CTE", _w_cte);
+    _w_etheta = Param(params, "W_EPSI", _w_etheta);
+    _w_vel = Param(params, "W_V", _w_vel);
+    _w_angvel = Param(params, "W_ANGVEL", _w_angvel);
+    _w_accel = Param(params, "W_A", _w_accel);
+    _w_angvel_d = Param(params, "W_DANGVEL", _w_angvel_d);
+    _w_accel_d = Param(params, "W_DA", _w_accel_d);
+    _bound = Param(params, "BOUND", _bound);
+    _model.LoadParams(params);
+    _model.Limits(params, _lower, _upper);
+
+    _options.clear();
+    _options += "Integer print_level  0\n";
+    _options += "Sparse  true        forward\n";
+    _options += "Sparse  true        reverse\n";
+    _options += linear_solver::SolveOptions(Param(params, "LINEAR_SOLVER", linear_solver::DEFAULT),
+                                            Param(params, "LINEAR_ORDER", -1));
+    _options += "Numeric max_cpu_time          0.5\n";
+
+    // Weights, dt and the model constants are constants of the tape
+    _stale = true;
+}
+
+template <class Model>
+template <class Vector>
+void VehicleMPC<Model>::Evaluate(Vector &fg, const Vector &vars, size_t n_coeffs) const
+{
+    typedef typename Vector::value_type Scalar;
+    const size_t u_start = _steps * NX;
+    const Scalar *c = &vars[NumVars()];
+
+    fg[0] = 0.0;
+    for (int i = 0; i < _steps; i++)
+    {
+        const Scalar *x = &vars[i * NX];
+        Scalar cte, etheta;
+        pathErrors(_model, x, c, n_coeffs, cte, etheta);
+        const Scalar e_vel = _model.Speed(x) - _ref_vel;
+        fg[0] += _w_cte * (cte - _ref_cte) * (cte - _ref_cte);
+        fg[0] += _w_etheta * (etheta - _ref_etheta) * (etheta - _ref_etheta);
+        fg[0] += _w_vel * e_vel * e_vel;
+    }
+    for (int i = 0; i < _steps - 1; i++)
+    {
+        const Scalar *u = &vars[u_start + i * NU];
+        for (int k = 0; k < NU; k++)
+        {
+            fg[0] += (Model::Angular(k) ? _w_angvel : _w_accel) * u[k] * u[k];
+            if (i < _steps - 2)
+            {
+                const Scalar du = u[NU + k] - u[k];
+                fg[0] += (Model::Angular(k) ? _w_angvel_d : _w_accel_d) * du * du;
+            }
+        }
+    }
+
+    // Initial state, then x(i + 1) = Step(x(i), u(i))
+    for (int k = 0; k < NX; k++)
+    {
+        fg[1 + k] = vars[k];
+    }
+    Scalar next[NX];
+    for (int i = 0; i < _steps - 1; i++)
+    {
+        _model.Step(_dt, &vars[i * NX], &vars[u_start + i * NU], next);
+        for (int k = 0; k < NX; k++)
+        {
+            fg[1 + (i + 1) * NX + k] = vars[(i + 1) * NX + k] - next[k];
+        }
+    }
+}
+
+template <class Model>
+void VehicleMPC<Model>::CostTerms(const double *vars, const Eigen::VectorXd &coeffs,
+                                  double &cte_cost, double &etheta_cost, double &vel_cost) const
+{
+    cte_cost = etheta_cost = vel_cost = 0.0;
+    for (int i = 0; i < _steps; i++)
+    {
+        const double *x = vars + i * NX;
+        double cte, etheta;
+        pathErrors(_model, x, coeffs.data(), coeffs.size(), cte, etheta);
+        const double e_vel = _model.Speed(x) - _ref_vel;
+        cte_cost += _w_cte * (cte - _ref_cte) * (cte - _ref_cte);
+        etheta_cost += _w_etheta * (etheta - _ref_etheta) * (etheta - _ref_etheta);
+        vel_cost += _w_vel * e_vel * e_vel;
+    }
+}
+
+template <class Model>
+bool VehicleMPC<Model>::Solve(const Eigen::VectorXd &state, const Eigen::VectorXd &coeffs, VehiclePlan &plan)
+{
+    typedef CPPAD_TESTVECTOR(double) Dvector;
+    const size_t n_vars = NumVars(), n_rows = NumConstraints(), n_coeffs = coeffs.size();
+    const size_t u_start = _steps * NX;
+
+    // Once per parameter change and number of coefficients
+    plan.tape_ms = 0;
+    if (!_tape)
+    {
+        _tape.reset(new TapeSolver());
+    }
+    if (_stale || !_tape->IsRecorded() || _tape->NumVars() != n_vars || _tape->NumParams() != n_coeffs)
+    {
+        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        _tape->Record(n_vars, n_rows, n_coeffs,
+                      [this, n_coeffs](TapeSolver::ADvector &fg, const TapeSolver::ADvector &vars)
+                      { Evaluate(fg, vars, n_coeffs); });
+        _stale = false;
+        plan.tape_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    }
+
+    // Inputs of the previous plan one step on, states rolled out from the
+    // new initial state
+    Dvector vars(n_vars), xl(n_vars), xu(n_vars), gl(n_rows), gu(n_rows), params(n_coeffs);
+    _model.FromState(state.data(), &vars[0]);
+    const bool shifted = _inputs.size() == size_t((_steps - 1) * NU);
+    for (int i = 0; i < _steps - 1; i++)
+    {
+        const int from = std::min(i + 1, _steps - 2);
+        for (int k = 0; k < NU; k++)
+        {
+            const double u = shifted ? _inputs[from * NU + k] : 0.0;
+            vars[u_start + i * NU + k] = std::min(_upper[k], std::max(_lower[k], u));
+        }
+        _model.Step(_dt, &vars[i * NX], &vars[u_start + i * NU], &vars[(i + 1) * NX]);
+    }
+
+    for (size_t i = 0; i < u_start; i++)
+    {
+        xl[i] = -_bound;
+        xu[i] = _bound;
+    }
+    for (int i = 0; i < _steps - 1; i++)
+    {
+        for (int k = 0; k < NU; k++)
+        {
+            xl[u_start + i * NU + k] = _lower[k];
+            xu[u_start + i * NU + k] = _upper[k];
+        }
+    }
+    for (size_t i = 0; i < n_rows; i++)
+    {
+        gl[i] = gu[i] = i < size_t(NX) ? vars[i] : 0.0;
+    }
+    for (size_t j = 0; j < n_coeffs; j++)
+    {
+        params[j] = coeffs[j];
+    }
+
+    CppAD::ipopt::solve_result<Dvector> solution;
+    _tape->Solve(_options, params, vars, xl, xu, gl, gu, solution);
+    plan.status = solution.status;
+    plan.iterations = _tape->Iterations();
+    const bool ok = solution.status == CppAD::ipopt::solve_result<Dvector>::success;
+    if (solution.x.size() != n_vars)
+    {
+        solution.x = vars;
+    }
+
+    plan.x.resize(_steps);
+    plan.y.resize(_steps);
+    plan.theta.resize(_steps);
+    for (int i = 0; i < _steps; i++)
+    {
+        plan.x[i] = solution.x[i * NX + Model::X];
+        plan.y[i] = solution.x[i * NX + Model::Y];
+        plan.theta[i] = solution.x[i * NX + Model::THETA];
+    }
+    plan.angvel.resize(_steps - 1);
+    plan.accel.resize(_steps - 1);
+    plan.lateral.resize(_steps - 1);
+    _inputs.resize((_steps - 1) * NU);
+    for (int i = 0; i < _steps - 1; i++)
+    {
+        const double *u = &solution.x[u_start + i * NU];
+        _model.Command(&solution.x[i * NX], u, &solution.x[(i + 1) * NX], plan.angvel[i], plan.accel[i], plan.lateral[i]);
+        std::copy(u, u + NU, _inputs.begin() + i * NU);
+    }
+    if (!ok)
+    {
+        _inputs.clear();
+    }
+    plan.cost = solution.obj_value;
+    CostTerms(&solution.x[0], coeffs, plan.cte_cost, plan.etheta_cost, plan.vel_cost);
+    return ok;
+}
+
+template class VehicleMPC<vehicle_model::DiffDrive>;
+template class VehicleMPC<vehicle_model::KinematicBicycle>;
+template class VehicleMPC<vehicle_model::Holonomic>;
@@ -0,0 +1,157 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "warm_start.h"
+#include <algorithm>
+#include <cmath>
+
+// Move block [start, start + len) one entry forward, repeating the last one
+static void shiftBlock(std::vector<double> &v, int start, int len)
+{
+    for (int i = 0; i < len - 1; i++)
+        v[start + i] = v[start + i + 1];
+}
+
+// Blocks of len entries of from into blocks of new_len entries, cut or
+// padded with the last entry of each
+static std::vector<double> resizeBlocks(const std::vector<double> &from, const int *len, const int *new_len, int blocks)
+{
+    std::vector<double> to;
+    size_t start = 0;
+    for (int k = 0; k < blocks; k++)
+    {
+        for (int i = 0; i < new_len[k]; i++)
+            to.push_back(from[start + std::min(i, len[k] - 1)]);
+        start += len[k];
+    }
+    return to;
+}
+
+WarmStart::WarmStart()
+{
+    _steps = 0;
+}
+
+void WarmStart::Reset()
+{
+    _steps = 0;
+    _x.clear();
+    _zl.clear();
+    _zu.clear();
+    _lambda.clear();
+}
+
+bool WarmStart::IsValid(int steps) const
+{
+    return _steps > 1 && _steps == steps;
+}
+
+void WarmStart::Store(int steps, const std::vector<double> &x, const std::vector<double> &zl,
+                      const std::vector<double> &zu, const std::vector<double> &lambda)
+{
+    if (x.size() != zl.size() || x.size() != zu.size())
+    {
+        Reset();
+        return;
+    }
+    Store(steps, x.data(), zl.data(), zu.data(), x.size(), lambda.data(), lambda.size());
+}
+
+void WarmStart::Store(int steps, const double *x, const double *zl, const double *zu, size_t n_vars,
+                      const double *lambda, size_t n_constraints)
+{
+    if (n_vars != size_t(steps * 6 + (steps - 1) * 2) || n_constraints != size_t(steps * 6))
+    {
+        Reset();
+        return;
+    }
+    _steps = steps;
+    _x.assign(x, x + n_vars);
+    _zl.assign(zl, zl + n_vars);
+    _zu.assign(zu, zu + n_vars);
+    _lambda.assign(lambda, lambda + n_constraints);
+}
+
+void WarmStart::Resize(int steps)
+{
+    if (_steps <= 1 || steps <= 1 || steps == _steps)
+        return;
+    // Six state blocks and two input blocks, six constraint blocks
+    int len[8], new_len[8];
+    for (int k = 0; k < 8; k++)
+    {
+        len[k] = k < 6 ? _steps : _steps - 1;
+        new_len[k] = k < 6 ? steps : steps - 1;
+    }
+    _x = resizeBlocks(_x, len, new_len, 8);
+    _zl = resizeBlocks(_zl, len, new_len, 8);
+    _zu = resizeBlocks(_zu, len, new_len, 8);
+    _lambda = resizeBlocks(_lambda, len, new_len, 6);
+    _steps = steps;
+}
+
+bool WarmStart::Shift(int steps, double x, double y, double theta,
+                      std::vector<double> &vars, std::vector<double> &zl,
+                      std::vector<double> &zu, std::vector<double> &lambda) const
+{
+    if (!IsValid(steps))
+        return false;
+
+    const int x_start = 0;
+    const int y_start = x_start + steps;
+    const int theta_start = y_start + steps;
+    const int angvel_start = theta_start + steps * 4;
+
+    vars = _x;
+    zl = _zl;
+    zu = _zu;
+    lambda = _lambda;
+
+    // States and their bound multipliers
+    for (int k = 0; k < 6; k++)
+    {
+        shiftBlock(vars, k * steps, steps);
+        shiftBlock(zl, k * steps, steps);
+        shiftBlock(zu, k * steps, steps);
+    }
+    // Inputs
+    for (int k = 0; k < 2; k++)
+    {
+        shiftBlock(vars, angvel_start + k * (steps - 1), steps - 1);
+        shiftBlock(zl, angvel_start + k * (steps - 1), steps - 1);
+        shiftBlock(zu, angvel_start + k * (steps - 1), steps - 1);
+    }
+    // Dynamics multipliers, row 0 of each block is the initial state
+    for (int k = 0; k < 6; k++)
+        shiftBlock(lambda, k * steps + 1, steps - 1);
+
+    // Re-anchor the predicted pose: express it relative to its first point
+    // and place that point at the new initial pose.
+    const double x0 = vars[x_start];
+    const double y0 = vars[y_start];
+    const double theta0 = vars[theta_start];
+    const double c = std::cos(theta - theta0);
+    const double s = std::sin(theta - theta0);
+    for (int i = 0; i < steps; i++)
+    {
+        const double dx = vars[x_start + i] - x0;
+        const double dy = vars[y_start + i] - y0;
+        vars[x_start + i] = x + c * dx - s * dy;
+        vars[y_start + i] = y + s * dx + c * dy;
+        vars[theta_start + i] += theta - theta0;
+    }
+    return true;
+}
@@ -0,0 +1,60 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "wheel_dynamics.h"
+#include <sstream>
+
+WheelDynamics::WheelDynamics()
+{
+    _enabled = false;
+    _mass = 10.0;
+    _inertia = 0.5;
+    _radius = 0.1;
+    _track = 0.265;
+    _damping = 0.0;
+    _ang_damping = 0.0;
+    _max_torque = 1.0;
+}
+
+void WheelDynamics::LoadParams(const std::map<std::string, double> &params)
+{
+    _enabled = params.find("DYNAMIC") != params.end() ? params.at("DYNAMIC") : _enabled;
+    _mass = params.find("MASS") != params.end() ? params.at("MASS") : _mass;
+    _inertia = params.find("INERTIA") != params.end() ? params.at("INERTIA") : _inertia;
+    _radius = params.find("WHEEL_RADIUS") != params.end() ? params.at("WHEEL_RADIUS") : _radius;
+    _track = params.find("TRACK_WIDTH") != params.end() ? params.at("TRACK_WIDTH") : _track;
+    _damping = params.find("DAMPING") != params.end() ? params.at("DAMPING") : _damping;
+    _ang_damping = params.find("ANG_DAMPING") != params.end() ? params.at("ANG_DAMPING") : _ang_damping;
+    _max_torque = params.find("MAXTORQUE") != params.end() ? params.at("MAXTORQUE") : _max_torque;
+}
+
+void WheelDynamics::Torques(double v, double a, double w0, double w1, double dt, double &right, double &left) const
+{
+    // Sum from the speed equation, difference from the turn rate equation
+    const double sum = _radius * (_mass * a + _damping * v);
+    const double difference = (2.0 * _radius / _track) * (_inertia * (w1 - w0) / dt + _ang_damping * w0);
+    right = 0.5 * (sum + difference);
+    left = 0.5 * (sum - difference);
+}
+
+std::string WheelDynamics::Describe() const
+{
+    std::ostringstream constants;
+    constants.precision(17);
+    constants << _mass << ' ' << _inertia << ' ' << _radius << ' ' << _track << ' ' << _damping << ' ' << _ang_damping;
+    return constants.str();
+}
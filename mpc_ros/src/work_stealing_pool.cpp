@@ -0,0 +1,139 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+
+#include "work_stealing_pool.h"
+
+WorkStealingPool::WorkStealingPool(int threads, const Init &init, const std::vector<int> &groups) : _init(init)
+{
+    _stealable = 0;
+    _stop = false;
+    _queues.resize(threads > 0 ? threads : 1);
+    _groups.assign(_queues.size(), 0);
+    for (size_t i = 0; i < groups.size() && i < _groups.size(); i++)
+    {
+        _groups[i] = groups[i];
+    }
+    for (int i = 0; i < Size(); i++)
+    {
+        _threads.emplace_back(&WorkStealingPool::run, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cond.notify_all();
+    for (size_t i = 0; i < _threads.size(); i++)
+    {
+        _threads[i].join();
+    }
+}
+
+void WorkStealingPool::Submit(int home, const Task &task, bool pinned)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        Entry entry;
+        entry.task = task;
+        entry.pinned = pinned;
+        _queues[((home % Size()) + Size()) % Size()].push_back(entry);
+        if (!pinned)
+            _stealable++;
+    }
+    // Idle workers all look for something to steal
+    _cond.notify_all();
+}
+
+bool WorkStealingPool::take(int index, Task &task)
+{
+    std::deque<Entry> &own = _queues[index];
+    if (!own.empty())
+    {
+        if (!own.front().pinned)
+            _stealable--;
+        task = own.front().task;
+        own.pop_front();
+        return true;
+    }
+    if (_stealable == 0)
+        return false;
+
+    // Longest deque with a stealable task, of the own group first, taken
+    // from its back
+    int from = victim(index, true);
+    if (from < 0)
+        from = victim(index, false);
+    if (from < 0)
+        return false;
+    std::deque<Entry> &other = _queues[from];
+    for (std::deque<Entry>::iterator it = other.end(); it != other.begin();)
+    {
+        --it;
+        if (!it->pinned)
+        {
+            task = it->task;
+            other.erase(it);
+            _stealable--;
+            return true;
+        }
+    }
+    return false;
+}
+
+int WorkStealingPool::victim(int index, bool same_group) const
+{
+    int victim = -1;
+    for (int i = 0; i < Size(); i++)
+    {
+        if (i == index || _queues[i].empty() || (same_group && _groups[i] != _groups[index]))
+            continue;
+        if (victim < 0 || _queues[i].size() > _queues[victim].size())
+        {
+            for (std::deque<Entry>::const_iterator it = _queues[i].begin(); it != _queues[i].end(); ++it)
+            {
+                if (!it->pinned)
+                {
+                    victim = i;
+                    break;
+                }
+            }
+        }
+    }
+    return victim;
+}
+
+void WorkStealingPool::run(int index)
+{
+    if (_init)
+        _init(index);
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        Task task;
+        _cond.wait(lock, [this, index, &task] { return _stop || take(index, task); });
+        if (!task)
+            break; // stopped with nothing left to run
+
+        lock.unlock();
+        task();
+        task = Task(); // captures are released on this thread
+        lock.lock();
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef MPC_COMPONENT_H
+#define MPC_COMPONENT_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <rclcpp/rclcpp.hpp>
+#include <geometry_msgs/msg/twist.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+#include <nav_msgs/msg/path.hpp>
+#include <tf2_ros/buffer.h>
+#include <tf2_ros/transform_listener.h>
+#include "mpc_tracker.h"
+#include "realtime.h"
+
+namespace mpc_ros2
+{
+
+// MPC_Node as an rclcpp component, to be composed with the localization and
+// the base driver in one process.
+//
+// Odometry and the control timer are on a callback group of their own,
+// served by a StaticSingleThreadedExecutor on one thread with the
+// rt_priority and rt_cpus of the node (RealtimeSettings of mpc_ros), the
+// callback_queues of MPC_Node. The plan is taken on the executor of the
+// container and transformed into the odometry frame there, so a long plan
+// never delays a command.
+//
+// Odometry arrives as a unique_ptr: with use_intra_process_comms the
+// message of the localization is moved in, not copied or serialized. The
+// command goes out as a unique_ptr too, or as a loaned message when the
+// middleware can loan one (e.g. iceoryx across processes).
+class MPCComponent : public rclcpp::Node
+{
+    public:
+        explicit MPCComponent(const rclcpp::NodeOptions &options);
+        ~MPCComponent() override;
+
+    private:
+        // The plan in the frame of the odometry, handed to the control thread
+        struct OdomPath
+        {
+            std::vector<double> xs, ys;
+        };
+
+        void odomCB(nav_msgs::msg::Odometry::UniquePtr msg);
+        void pathCB(nav_msgs::msg::Path::UniquePtr msg);
+        void controlLoopCB();
+        void publishCommand(double speed, double angvel);
+        void publishTrajectory();
+
+        MPCTracker _tracker;
+        std::string _odom_frame, _car_frame;
+        bool _intra_process, _trajectory_path;
+        std::atomic<bool> _running;
+
+        // Control thread only
+        nav_msgs::msg::Odometry::UniquePtr _odom;
+        std::shared_ptr<const OdomPath> _path_in_use;
+
+        std::mutex _path_mutex;
+        std::shared_ptr<const OdomPath> _path; // newest, under _path_mutex
+
+        std::shared_ptr<tf2_ros::Buffer> _tf_buffer;
+        std::shared_ptr<tf2_ros::TransformListener> _tf_listener;
+
+        rclcpp::CallbackGroup::SharedPtr _control_group;
+        rclcpp::executors::StaticSingleThreadedExecutor::SharedPtr _control_executor;
+        std::thread _control_thread;
+        RealtimeSettings _realtime;
+
+        rclcpp::Subscription<nav_msgs::msg::Odometry>::SharedPtr _sub_odom;
+        rclcpp::Subscription<nav_msgs::msg::Path>::SharedPtr _sub_path;
+        rclcpp::Publisher<geometry_msgs::msg::Twist>::SharedPtr _pub_twist;
+        rclcpp::Publisher<nav_msgs::msg::Path>::SharedPtr _pub_mpctraj;
+        rclcpp::TimerBase::SharedPtr _timer;
+};
+
+} // namespace mpc_ros2
+
+#endif /* MPC_COMPONENT_H */
@@ -0,0 +1,86 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef MPC_CONTROLLER_H
+#define MPC_CONTROLLER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <nav2_core/controller.hpp>
+#include <nav2_costmap_2d/costmap_2d_ros.hpp>
+#include <nav_msgs/msg/path.hpp>
+#include <rclcpp_lifecycle/lifecycle_node.hpp>
+#include <rclcpp_lifecycle/lifecycle_publisher.hpp>
+#include <tf2_ros/buffer.h>
+#include "mpc_tracker.h"
+
+namespace mpc_ros2
+{
+
+// MPCPlannerROS for nav2: the controller server hands over the plan with
+// setPlan() and asks for a command with computeVelocityCommands() at its
+// controller_frequency.
+//
+// The plan is transformed into the global frame of the local costmap (the
+// frame of the robot pose nav2 passes) in computeVelocityCommands(), once
+// per plan while that transform stays the same. The goal is left to the
+// goal checker of the controller server; setSpeedLimit() scales
+// max_speed. Parameters are those of MPCComponent under "<plugin name>.".
+class MPCController : public nav2_core::Controller
+{
+    public:
+        MPCController();
+        ~MPCController() override = default;
+
+        void configure(const rclcpp_lifecycle::LifecycleNode::WeakPtr &parent, std::string name,
+                       std::shared_ptr<tf2_ros::Buffer> tf,
+                       std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros) override;
+        void cleanup() override;
+        void activate() override;
+        void deactivate() override;
+
+        void setPlan(const nav_msgs::msg::Path &path) override;
+        geometry_msgs::msg::TwistStamped computeVelocityCommands(const geometry_msgs::msg::PoseStamped &pose,
+                                                                 const geometry_msgs::msg::Twist &velocity,
+                                                                 nav2_core::GoalChecker *goal_checker) override;
+        void setSpeedLimit(const double &speed_limit, const bool &percentage) override;
+
+    private:
+        // The plan in frame, into the tracker when the transform changed
+        bool transformPlan(const std::string &frame);
+
+        rclcpp_lifecycle::LifecycleNode::WeakPtr _node;
+        std::string _name;
+        std::shared_ptr<tf2_ros::Buffer> _tf;
+        std::shared_ptr<nav2_costmap_2d::Costmap2DROS> _costmap_ros;
+        rclcpp::Logger _logger;
+        rclcpp::Clock::SharedPtr _clock;
+        rclcpp_lifecycle::LifecyclePublisher<nav_msgs::msg::Path>::SharedPtr _pub_mpctraj;
+
+        MPCTracker _tracker;
+        double _max_speed; // of the parameters, before the speed limit
+
+        nav_msgs::msg::Path _plan;
+        std::vector<double> _xs, _ys;
+        std::string _plan_frame_in_use;
+        double _transform[3]; // x, y, yaw of the plan frame in use
+        bool _plan_stale;
+};
+
+} // namespace mpc_ros2
+
+#endif /* MPC_CONTROLLER_H */
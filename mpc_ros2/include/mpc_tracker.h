@@ -0,0 +1,93 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef MPC_TRACKER_H
+#define MPC_TRACKER_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "MPC.h"
+#include "path_fit.h"
+
+// Path following with the MPC of mpc_ros, without ROS: the part of MPC_Node
+// between its messages, shared by the ROS 2 component and the nav2
+// controller plugin.
+//
+// SetPath() takes the plan once, in the frame of the odometry. Every Solve()
+// then fits the waypoints ahead of the robot, path_length of them at
+// samples points, in the buffers of SetPath(), and solves from the pose and
+// speed of the robot. With delay_mode the state is predicted one period
+// ahead, to the moment the command takes effect, as MPC_Node does.
+class MPCTracker
+{
+    public:
+        struct Config
+        {
+            Config() : controller_freq(10.0), max_speed(0.5), path_length(8.0), samples(10), goal_radius(0.5),
+                       delay_mode(true) {}
+
+            double controller_freq;
+            double max_speed;   // [m/s]
+            double path_length; // fitted ahead of the robot [m]
+            int samples;        // waypoints of that length in the fit
+            double goal_radius; // [m]
+            bool delay_mode;
+        };
+
+        MPCTracker();
+
+        // mpc_params as MPC::LoadParams() reads them, DT is set from
+        // controller_freq
+        void Configure(const Config &config, std::map<std::string, double> mpc_params);
+
+        // n waypoints, false with fewer than 6. The buffers are sized here,
+        // once per plan.
+        bool SetPath(const double *xs, const double *ys, size_t n);
+        void ClearPath();
+        bool HasPath() const { return !_xs.empty(); }
+
+        // Pose and speed of the robot in the frame of the path. speed and
+        // angvel are the command, false when there is none: no path, the fit
+        // failed or the solve found no feasible plan.
+        bool Solve(double px, double py, double theta, double v, double &speed, double &angvel);
+
+        // Within goal_radius of the last waypoint
+        bool GoalReached(double px, double py) const;
+
+        const MPC &Mpc() const { return _mpc; }
+        MPC &Mpc() { return _mpc; }
+        double Cte() const { return _cte; }
+        double Etheta() const { return _etheta; }
+        const Config &GetConfig() const { return _config; }
+        // The speed limit of the plan, the MPC is not loaded again
+        void SetMaxSpeed(double max_speed) { _config.max_speed = max_speed; }
+
+    private:
+        // Waypoints from the nearest one on, into _wx, _wy
+        size_t window(double px, double py);
+
+        Config _config;
+        MPC _mpc;
+        PathFit _path_fit;
+        std::vector<double> _xs, _ys, _wx, _wy;
+        size_t _nearest, _stride;
+        double _spacing;
+        double _w, _throttle; // last inputs
+        double _cte, _etheta;
+};
+
+#endif /* MPC_TRACKER_H */
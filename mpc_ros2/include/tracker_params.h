@@ -0,0 +1,77 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#ifndef TRACKER_PARAMS_H
+#define TRACKER_PARAMS_H
+
+#include <map>
+#include <string>
+#include "mpc_tracker.h"
+
+// Parameters of MPCTracker on a ROS 2 node, by the names and defaults of
+// MPC_Node (params/mpc_params.yaml of mpc_ros), each under prefix: "" for
+// the component, "<plugin name>." for the nav2 controller. NodeT is an
+// rclcpp::Node or an rclcpp_lifecycle::LifecycleNode.
+namespace tracker_params
+{
+    template <class NodeT, class T>
+    T Get(NodeT &node, const std::string &name, const T &value)
+    {
+        if (!node.has_parameter(name))
+            node.declare_parameter(name, value);
+        return node.get_parameter(name).template get_value<T>();
+    }
+
+    template <class NodeT>
+    void Load(NodeT &node, const std::string &prefix, MPCTracker::Config &config, std::map<std::string, double> &mpc)
+    {
+        config.controller_freq = Get(node, prefix + "controller_freq", 10.0);
+        config.max_speed = Get(node, prefix + "max_speed", 0.5); // [m/s]
+        config.path_length = Get(node, prefix + "path_length", 8.0); // [m]
+        config.samples = Get(node, prefix + "path_samples", 10);
+        config.goal_radius = Get(node, prefix + "goal_radius", 0.5); // [m]
+        config.delay_mode = Get(node, prefix + "delay_mode", true);
+
+        mpc["STEPS"] = Get(node, prefix + "mpc_steps", 40.0);
+        mpc["REF_CTE"] = Get(node, prefix + "mpc_ref_cte", 0.0);
+        mpc["REF_V"] = Get(node, prefix + "mpc_ref_vel", 1.0);
+        mpc["REF_ETHETA"] = Get(node, prefix + "mpc_ref_etheta", 0.0);
+        mpc["W_CTE"] = Get(node, prefix + "mpc_w_cte", 5000.0);
+        mpc["W_EPSI"] = Get(node, prefix + "mpc_w_etheta", 5000.0);
+        mpc["W_V"] = Get(node, prefix + "mpc_w_vel", 1.0);
+        mpc["W_ANGVEL"] = Get(node, prefix + "mpc_w_angvel", 100.0);
+        mpc["W_A"] = Get(node, prefix + "mpc_w_accel", 50.0);
+        mpc["W_DANGVEL"] = Get(node, prefix + "mpc_w_angvel_d", 10.0);
+        mpc["W_DA"] = Get(node, prefix + "mpc_w_accel_d", 10.0);
+        mpc["ANGVEL"] = Get(node, prefix + "mpc_max_angvel", 3.0);
+        mpc["MAXTHR"] = Get(node, prefix + "mpc_max_throttle", 1.0);
+        mpc["BOUND"] = Get(node, prefix + "mpc_bound_value", 1.0e3);
+        mpc["TAPE"] = Get(node, prefix + "mpc_persistent_tape", true);
+        mpc["WARM"] = Get(node, prefix + "mpc_warm_start", true);
+        mpc["PURSUIT_SEED"] = Get(node, prefix + "mpc_pursuit_seed", true);
+        mpc["RTI"] = Get(node, prefix + "mpc_rti", false);
+        mpc["LTV"] = Get(node, prefix + "mpc_ltv", false);
+        mpc["ANALYTIC"] = Get(node, prefix + "mpc_analytic", false);
+        mpc["HESSIAN"] = Get(node, prefix + "mpc_hessian", 0);
+        mpc["HESSIAN_THREADS"] = Get(node, prefix + "mpc_hessian_threads", 1);
+        mpc["INTEGRATOR"] = Get(node, prefix + "mpc_integrator", 0);
+        mpc["VEHICLE_MODEL"] = Get(node, prefix + "mpc_vehicle_model", 0);
+        mpc["WHEELBASE"] = Get(node, prefix + "mpc_wheelbase", 0.3); // [m]
+        mpc["MAXSTEER"] = Get(node, prefix + "mpc_max_steer", 0.5); // [rad]
+    }
+}
+
+#endif /* TRACKER_PARAMS_H */
@@ -0,0 +1,27 @@
+# MPCComponent in a component container with intra-process communication,
+# for the localization and the base driver to be loaded next to it, e.g.
+#   ros2 component load /mpc_container <package> <plugin> -e use_intra_process_comms:=true
+import os
+from ament_index_python.packages import get_package_share_directory
+from launch import LaunchDescription
+from launch_ros.actions import ComposableNodeContainer
+from launch_ros.descriptions import ComposableNode
+
+
+def generate_launch_description():
+    params = os.path.join(get_package_share_directory('mpc_ros2'), 'params', 'mpc_ros2_params.yaml')
+    container = ComposableNodeContainer(
+        name='mpc_container',
+        namespace='',
+        package='rclcpp_components',
+        executable='component_container_mt',
+        composable_node_descriptions=[
+            ComposableNode(
+                package='mpc_ros2',
+                plugin='mpc_ros2::MPCComponent',
+                name='mpc_controller',
+                parameters=[params],
+                extra_arguments=[{'use_intra_process_comms': True}]),
+        ],
+        output='screen')
+    return LaunchDescription([container])
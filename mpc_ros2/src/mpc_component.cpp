@@ -0,0 +1,214 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "mpc_component.h"
+#include <chrono>
+#include <cmath>
+#include <tf2/exceptions.h>
+#include <rclcpp_components/register_node_macro.hpp>
+#include "tracker_params.h"
+
+namespace mpc_ros2
+{
+
+namespace
+{
+    double quaternionYaw(double qx, double qy, double qz, double qw)
+    {
+        return std::atan2(2.0 * (qw * qz + qx * qy), 1.0 - 2.0 * (qy * qy + qz * qz));
+    }
+}
+
+MPCComponent::MPCComponent(const rclcpp::NodeOptions &options)
+    : rclcpp::Node("mpc_controller", options), _intra_process(options.use_intra_process_comms()), _running(true)
+{
+    MPCTracker::Config config;
+    std::map<std::string, double> mpc_params;
+    tracker_params::Load(*this, "", config, mpc_params);
+    _tracker.Configure(config, mpc_params);
+    _odom_frame = tracker_params::Get(*this, "odom_frame", std::string("odom"));
+    _car_frame = tracker_params::Get(*this, "car_frame", std::string("base_footprint"));
+    _trajectory_path = tracker_params::Get(*this, "trajectory_path", true); // the prediction on mpc_trajectory
+    const std::string path_topic = tracker_params::Get(*this, "global_path_topic", std::string("plan"));
+    const int rt_priority = tracker_params::Get(*this, "rt_priority", 0); // SCHED_FIFO priority of the control thread
+    const std::string rt_cpus = tracker_params::Get(*this, "rt_cpus", std::string("")); // its CPUs, e.g. "2,3"
+    const int rt_prefault_stack_kb = tracker_params::Get(*this, "rt_prefault_stack_kb", 0);
+    _realtime.Configure(rt_priority, rt_cpus, std::max(rt_prefault_stack_kb, 0));
+
+    _tf_buffer = std::make_shared<tf2_ros::Buffer>(get_clock());
+    _tf_listener = std::make_shared<tf2_ros::TransformListener>(*_tf_buffer);
+
+    // Odometry and the timer on the control thread, the plan on the
+    // executor of the container
+    _control_group = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive, false);
+    rclcpp::SubscriptionOptions control;
+    control.callback_group = _control_group;
+    _sub_odom = create_subscription<nav_msgs::msg::Odometry>("odom", rclcpp::QoS(1),
+        std::bind(&MPCComponent::odomCB, this, std::placeholders::_1), control);
+    _sub_path = create_subscription<nav_msgs::msg::Path>(path_topic, rclcpp::QoS(1),
+        std::bind(&MPCComponent::pathCB, this, std::placeholders::_1));
+    _pub_twist = create_publisher<geometry_msgs::msg::Twist>("cmd_vel", rclcpp::QoS(1));
+    _pub_mpctraj = create_publisher<nav_msgs::msg::Path>("mpc_trajectory", rclcpp::QoS(1));
+    _timer = create_wall_timer(std::chrono::duration<double>(1.0 / _tracker.GetConfig().controller_freq),
+                               std::bind(&MPCComponent::controlLoopCB, this), _control_group);
+
+    _control_executor = std::make_shared<rclcpp::executors::StaticSingleThreadedExecutor>();
+    _control_executor->add_callback_group(_control_group, get_node_base_interface());
+    _control_thread = std::thread([this]
+    {
+        std::string report;
+        if (_realtime.Enabled() && !_realtime.Apply(report))
+            RCLCPP_WARN(get_logger(), "Control thread runs without its realtime settings: %s", report.c_str());
+        // spin() would miss a cancel() from the destructor before it starts
+        while (_running && rclcpp::ok())
+            _control_executor->spin_once(std::chrono::milliseconds(100));
+    });
+    RCLCPP_INFO(get_logger(), "Waiting for a plan on %s, intra-process %s", _sub_path->get_topic_name(),
+                _intra_process ? "on" : "off");
+}
+
+MPCComponent::~MPCComponent()
+{
+    _running = false;
+    _control_executor->cancel();
+    if (_control_thread.joinable())
+        _control_thread.join();
+}
+
+void MPCComponent::odomCB(nav_msgs::msg::Odometry::UniquePtr msg)
+{
+    // Moved in by intra-process communication, kept until the next one
+    _odom = std::move(msg);
+}
+
+void MPCComponent::pathCB(nav_msgs::msg::Path::UniquePtr msg)
+{
+    if (msg->poses.empty())
+    {
+        std::lock_guard<std::mutex> lock(_path_mutex);
+        _path.reset();
+        return;
+    }
+    // map -> odom once for the whole path
+    const std::string &frame = msg->header.frame_id.empty() ? msg->poses[0].header.frame_id : msg->header.frame_id;
+    geometry_msgs::msg::TransformStamped transform;
+    try
+    {
+        transform = _tf_buffer->lookupTransform(_odom_frame, frame, tf2::TimePointZero);
+    }
+    catch (const tf2::TransformException &e)
+    {
+        RCLCPP_WARN(get_logger(), "Plan not used, no transform %s -> %s: %s", frame.c_str(), _odom_frame.c_str(), e.what());
+        return; // keep the previous plan, the next message retries
+    }
+    const geometry_msgs::msg::Vector3 &t = transform.transform.translation;
+    const geometry_msgs::msg::Quaternion &q = transform.transform.rotation;
+    const double yaw = quaternionYaw(q.x, q.y, q.z, q.w);
+    const double c = std::cos(yaw), s = std::sin(yaw);
+
+    std::shared_ptr<OdomPath> path = std::make_shared<OdomPath>();
+    path->xs.resize(msg->poses.size());
+    path->ys.resize(msg->poses.size());
+    for (size_t i = 0; i < msg->poses.size(); i++)
+    {
+        const geometry_msgs::msg::Point &p = msg->poses[i].pose.position;
+        path->xs[i] = c * p.x - s * p.y + t.x;
+        path->ys[i] = s * p.x + c * p.y + t.y;
+    }
+    std::lock_guard<std::mutex> lock(_path_mutex);
+    _path = path;
+}
+
+void MPCComponent::controlLoopCB()
+{
+    std::shared_ptr<const OdomPath> path;
+    {
+        std::lock_guard<std::mutex> lock(_path_mutex);
+        path = _path;
+    }
+    if (path != _path_in_use)
+    {
+        // Sized once per plan
+        _path_in_use = path;
+        if (!path || !_tracker.SetPath(path->xs.data(), path->ys.data(), path->xs.size()))
+        {
+            _tracker.ClearPath();
+            publishCommand(0.0, 0.0);
+        }
+    }
+    if (!_odom || !_tracker.HasPath())
+        return;
+
+    const geometry_msgs::msg::Pose &pose = _odom->pose.pose;
+    const double px = pose.position.x, py = pose.position.y;
+    const double theta = quaternionYaw(pose.orientation.x, pose.orientation.y, pose.orientation.z, pose.orientation.w);
+    if (_tracker.GoalReached(px, py))
+    {
+        RCLCPP_INFO(get_logger(), "Goal reached");
+        _tracker.ClearPath();
+        publishCommand(0.0, 0.0);
+        return;
+    }
+
+    double speed, angvel;
+    if (!_tracker.Solve(px, py, theta, _odom->twist.twist.linear.x, speed, angvel))
+        RCLCPP_WARN_THROTTLE(get_logger(), *get_clock(), 1000, "No feasible MPC solution, stopping");
+    publishCommand(speed, angvel);
+    if (_trajectory_path)
+        publishTrajectory();
+}
+
+void MPCComponent::publishCommand(double speed, double angvel)
+{
+    // A loaned message is written in the middleware's memory, the
+    // intra-process path moves the unique_ptr to the base driver instead
+    if (!_intra_process && _pub_twist->can_loan_messages())
+    {
+        rclcpp::LoanedMessage<geometry_msgs::msg::Twist> twist = _pub_twist->borrow_loaned_message();
+        twist.get() = geometry_msgs::msg::Twist();
+        twist.get().linear.x = speed;
+        twist.get().angular.z = angvel;
+        _pub_twist->publish(std::move(twist));
+        return;
+    }
+    std::unique_ptr<geometry_msgs::msg::Twist> twist = std::make_unique<geometry_msgs::msg::Twist>();
+    twist->linear.x = speed;
+    twist->angular.z = angvel;
+    _pub_twist->publish(std::move(twist));
+}
+
+void MPCComponent::publishTrajectory()
+{
+    if (_pub_mpctraj->get_subscription_count() + _pub_mpctraj->get_intra_process_subscription_count() == 0)
+        return;
+    const MPC &mpc = _tracker.Mpc();
+    std::unique_ptr<nav_msgs::msg::Path> traj = std::make_unique<nav_msgs::msg::Path>();
+    traj->header.frame_id = _car_frame;
+    traj->header.stamp = now();
+    traj->poses.resize(mpc.mpc_x.size());
+    for (size_t i = 0; i < mpc.mpc_x.size(); i++)
+    {
+        traj->poses[i].header = traj->header;
+        traj->poses[i].pose.position.x = mpc.mpc_x[i];
+        traj->poses[i].pose.position.y = mpc.mpc_y[i];
+        traj->poses[i].pose.orientation.w = 1.0;
+    }
+    _pub_mpctraj->publish(std::move(traj));
+}
+
+} // namespace mpc_ros2
+
+RCLCPP_COMPONENTS_REGISTER_NODE(mpc_ros2::MPCComponent)
@@ -0,0 +1,167 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "mpc_controller.h"
+#include <cmath>
+#include <nav2_core/exceptions.hpp>
+#include <pluginlib/class_list_macros.hpp>
+#include <tf2/exceptions.h>
+#include "tracker_params.h"
+
+namespace mpc_ros2
+{
+
+MPCController::MPCController() : _logger(rclcpp::get_logger("MPCController")), _max_speed(0.5), _plan_stale(true)
+{
+    _transform[0] = _transform[1] = _transform[2] = 0.0;
+}
+
+void MPCController::configure(const rclcpp_lifecycle::LifecycleNode::WeakPtr &parent, std::string name,
+                              std::shared_ptr<tf2_ros::Buffer> tf,
+                              std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros)
+{
+    _node = parent;
+    rclcpp_lifecycle::LifecycleNode::SharedPtr node = parent.lock();
+    if (!node)
+        throw nav2_core::PlannerException("MPCController: the controller server is gone");
+    _name = name;
+    _tf = tf;
+    _costmap_ros = costmap_ros;
+    _logger = node->get_logger();
+    _clock = node->get_clock();
+
+    MPCTracker::Config config;
+    std::map<std::string, double> mpc_params;
+    tracker_params::Load(*node, _name + ".", config, mpc_params);
+    // The controller server sets the rate
+    config.controller_freq = tracker_params::Get(*node, std::string("controller_frequency"), 20.0);
+    _max_speed = config.max_speed;
+    _tracker.Configure(config, mpc_params);
+    _pub_mpctraj = node->create_publisher<nav_msgs::msg::Path>(_name + "/mpc_trajectory", rclcpp::QoS(1));
+}
+
+void MPCController::cleanup()
+{
+    _pub_mpctraj.reset();
+    _tracker.ClearPath();
+}
+
+void MPCController::activate()
+{
+    _pub_mpctraj->on_activate();
+}
+
+void MPCController::deactivate()
+{
+    _pub_mpctraj->on_deactivate();
+}
+
+void MPCController::setPlan(const nav_msgs::msg::Path &path)
+{
+    _plan = path;
+    _plan_stale = true;
+}
+
+void MPCController::setSpeedLimit(const double &speed_limit, const bool &percentage)
+{
+    // nav2_costmap_2d::NO_SPEED_LIMIT is 0.0
+    if (speed_limit <= 0.0)
+        _tracker.SetMaxSpeed(_max_speed);
+    else
+        _tracker.SetMaxSpeed(percentage ? _max_speed * speed_limit / 100.0 : std::min(_max_speed, speed_limit));
+}
+
+bool MPCController::transformPlan(const std::string &frame)
+{
+    if (_plan.poses.empty())
+        return false;
+    const std::string &plan_frame = _plan.header.frame_id.empty() ? _plan.poses[0].header.frame_id : _plan.header.frame_id;
+    geometry_msgs::msg::TransformStamped transform;
+    try
+    {
+        transform = _tf->lookupTransform(frame, plan_frame, tf2::TimePointZero);
+    }
+    catch (const tf2::TransformException &e)
+    {
+        RCLCPP_WARN(_logger, "No transform %s -> %s: %s", plan_frame.c_str(), frame.c_str(), e.what());
+        return false;
+    }
+    const geometry_msgs::msg::Quaternion &q = transform.transform.rotation;
+    const double x = transform.transform.translation.x, y = transform.transform.translation.y;
+    const double yaw = std::atan2(2.0 * (q.w * q.z + q.x * q.y), 1.0 - 2.0 * (q.y * q.y + q.z * q.z));
+    // Odometry drifts slowly against the map, the plan is moved again only
+    // when that shows
+    if (!_plan_stale && frame == _plan_frame_in_use && std::hypot(x - _transform[0], y - _transform[1]) < 1e-3
+        && std::fabs(yaw - _transform[2]) < 1e-3)
+        return _tracker.HasPath();
+
+    const double c = std::cos(yaw), s = std::sin(yaw);
+    _xs.resize(_plan.poses.size());
+    _ys.resize(_plan.poses.size());
+    for (size_t i = 0; i < _plan.poses.size(); i++)
+    {
+        const geometry_msgs::msg::Point &p = _plan.poses[i].pose.position;
+        _xs[i] = c * p.x - s * p.y + x;
+        _ys[i] = s * p.x + c * p.y + y;
+    }
+    _plan_frame_in_use = frame;
+    _transform[0] = x;
+    _transform[1] = y;
+    _transform[2] = yaw;
+    _plan_stale = false;
+    return _tracker.SetPath(_xs.data(), _ys.data(), _xs.size());
+}
+
+geometry_msgs::msg::TwistStamped MPCController::computeVelocityCommands(const geometry_msgs::msg::PoseStamped &pose,
+                                                                        const geometry_msgs::msg::Twist &velocity,
+                                                                        nav2_core::GoalChecker * /*goal_checker*/)
+{
+    if (!transformPlan(pose.header.frame_id))
+        throw nav2_core::PlannerException("MPCController: no plan in " + pose.header.frame_id);
+
+    const geometry_msgs::msg::Quaternion &q = pose.pose.orientation;
+    const double theta = std::atan2(2.0 * (q.w * q.z + q.x * q.y), 1.0 - 2.0 * (q.y * q.y + q.z * q.z));
+    double speed, angvel;
+    if (!_tracker.Solve(pose.pose.position.x, pose.pose.position.y, theta, velocity.linear.x, speed, angvel))
+        throw nav2_core::PlannerException("MPCController: no feasible MPC solution");
+
+    geometry_msgs::msg::TwistStamped cmd;
+    cmd.header.frame_id = _costmap_ros->getBaseFrameID();
+    cmd.header.stamp = _clock->now();
+    cmd.twist.linear.x = speed;
+    cmd.twist.angular.z = angvel;
+
+    if (_pub_mpctraj->is_activated() && _pub_mpctraj->get_subscription_count() > 0)
+    {
+        const MPC &mpc = _tracker.Mpc();
+        std::unique_ptr<nav_msgs::msg::Path> traj = std::make_unique<nav_msgs::msg::Path>();
+        traj->header = cmd.header;
+        traj->poses.resize(mpc.mpc_x.size());
+        for (size_t i = 0; i < mpc.mpc_x.size(); i++)
+        {
+            traj->poses[i].header = cmd.header;
+            traj->poses[i].pose.position.x = mpc.mpc_x[i];
+            traj->poses[i].pose.position.y = mpc.mpc_y[i];
+            traj->poses[i].pose.orientation.w = 1.0;
+        }
+        _pub_mpctraj->publish(std::move(traj));
+    }
+    return cmd;
+}
+
+} // namespace mpc_ros2
+
+PLUGINLIB_EXPORT_CLASS(mpc_ros2::MPCController, nav2_core::Controller)
@@ -0,0 +1,141 @@
+/*
+ * mpc_ros
+ * Copyright (c) 2021, Geonhee Lee
+ *
+ * THE WORK (AS DEFINED BELOW) IS PROVIDED UNDER THE TERMS OF THIS CREATIVE
+ * COMMONS PUBLIC LICENSE ("CCPL" OR "LICENSE"). THE WORK IS PROTECTED BY
+ * COPYRIGHT AND/OR OTHER APPLICABLE LAW. ANY USE OF THE WORK OTHER THAN AS
+ * AUTHORIZED UNDER THIS LICENSE OR COPYRIGHT LAW IS PROHIBITED.
+ *
+ * BY EXERCISING ANY RIGHTS TO THE WORK PROVIDED HERE, YOU ACCEPT AND AGREE TO
+ * BE BOUND BY THE TERMS OF THIS LICENSE. THE LICENSOR GRANTS YOU THE RIGHTS
+ * CONTAINED HERE IN CONSIDERATION OF YOUR ACCEPTANCE OF SUCH TERMS AND
+ * CONDITIONS.
+ *
+ */
+
+#include "mpc_tracker.h"
+#include <algorithm>
+#include <cmath>
+
+MPCTracker::MPCTracker() : _nearest(0), _stride(1), _spacing(0.0), _w(0.0), _throttle(0.0), _cte(0.0), _etheta(0.0) {}
+
+void MPCTracker::Configure(const Config &config, std::map<std::string, double> mpc_params)
+{
+    _config = config;
+    _config.controller_freq = std::max(_config.controller_freq, 1.0);
+    _config.samples = std::max(_config.samples, 6);
+    mpc_params["DT"] = 1.0 / _config.controller_freq;
+    _mpc.LoadParams(mpc_params);
+    _w = 0.0;
+    _throttle = 0.0;
+}
+
+bool MPCTracker::SetPath(const double *xs, const double *ys, size_t n)
+{
+    if (n < 6)
+    {
+        ClearPath();
+        return false;
+    }
+    _xs.assign(xs, xs + n);
+    _ys.assign(ys, ys + n);
+    double length = 0.0;
+    for (size_t i = 1; i < n; i++)
+        length += std::hypot(_xs[i] - _xs[i - 1], _ys[i] - _ys[i - 1]);
+    _spacing = length / (n - 1);
+    // Every stride-th waypoint, samples of them over path_length
+    _stride = _spacing > 0.0 ? std::max<size_t>(1, _config.path_length / _config.samples / _spacing) : 1;
+    _wx.resize(n);
+    _wy.resize(n);
+    _nearest = 0;
+    return true;
+}
+
+void MPCTracker::ClearPath()
+{
+    _xs.clear();
+    _ys.clear();
+    _nearest = 0;
+    _w = 0.0;
+    _throttle = 0.0;
+}
+
+size_t MPCTracker::window(double px, double py)
+{
+    // The robot moves on along the plan, search a path_length ahead of the
+    // last nearest waypoint only
+    const size_t n = _xs.size();
+    const size_t reach = _spacing > 0.0 ? (size_t)(_config.path_length / _spacing) + 1 : n;
+    const size_t end = std::min(n, _nearest + reach);
+    double best = HUGE_VAL;
+    for (size_t i = _nearest; i < end; i++)
+    {
+        const double d = (_xs[i] - px) * (_xs[i] - px) + (_ys[i] - py) * (_ys[i] - py);
+        if (d < best)
+        {
+            best = d;
+            _nearest = i;
+        }
+    }
+
+    // Near the goal the last 6 waypoints at a shorter stride, the fit
+    // needs 6 of them
+    const size_t start = std::min(_nearest, n - 6);
+    const size_t stride = std::max<size_t>(1, std::min(_stride, (n - 1 - start) / 5));
+    size_t m = 0;
+    double length = 0.0;
+    for (size_t i = start; i < n && length <= _config.path_length; i += stride)
+    {
+        _wx[m] = _xs[i];
+        _wy[m] = _ys[i];
+        m++;
+        length += stride * _spacing;
+    }
+    return m;
+}
+
+bool MPCTracker::GoalReached(double px, double py) const
+{
+    return !_xs.empty() && std::hypot(_xs.back() - px, _ys.back() - py) < _config.goal_radius;
+}
+
+bool MPCTracker::Solve(double px, double py, double theta, double v, double &speed, double &angvel)
+{
+    speed = 0.0;
+    angvel = 0.0;
+    if (_xs.empty())
+        return false;
+
+    // Waypoints fitted in the vehicle coordinate system
+    const size_t m = window(px, py);
+    if (m < 6 || !_path_fit.Fit(_wx.data(), _wy.data(), (int)m, px, py, theta))
+        return false;
+    const Eigen::VectorXd &coeffs = _path_fit.Coeffs();
+    _cte = _path_fit.Eval(0.0);
+    _etheta = std::atan(coeffs[1]);
+
+    const double dt = 1.0 / _config.controller_freq;
+    Eigen::VectorXd state(6);
+    if (_config.delay_mode)
+    {
+        // The state at the moment the command takes effect, one period on
+        const double theta_act = _w * dt;
+        state << v * dt, 0.0, theta_act, v + _throttle * dt, _cte + v * std::sin(_etheta) * dt, _etheta - theta_act;
+    }
+    else
+        state << 0.0, 0.0, 0.0, v, _cte, _etheta;
+
+    const std::vector<double> results = _mpc.Solve(state, coeffs);
+    if (!_mpc._mpc_feasible)
+    {
+        _w = 0.0;
+        _throttle = 0.0;
+        return false;
+    }
+    _w = results[0];
+    _throttle = results[1];
+    angvel = _w;
+    speed = std::max(0.0, std::min(v + _throttle * _mpc._mpc_dt, _config.max_speed));
+    return true;
+}